@@ -437,6 +437,8 @@ void FKawaiiFluidPresetAssetEditor::OnPreviewSettingsPropertyChanged(const FProp
 	const FName PropertyName = PropertyChangedEvent.GetPropertyName();
 	const bool bNeedsReset =
 		PropertyName == GET_MEMBER_NAME_CHECKED(FFluidPreviewSettings, EmitterMode) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(FFluidPreviewSettings, SimulationBackend) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(FFluidPreviewSettings, CPUParticleBudget) ||
 		PropertyName == GET_MEMBER_NAME_CHECKED(FFluidPreviewSettings, ShapeType) ||
 		PropertyName == GET_MEMBER_NAME_CHECKED(FFluidPreviewSettings, SphereRadius) ||
 		PropertyName == GET_MEMBER_NAME_CHECKED(FFluidPreviewSettings, CubeHalfSize) ||
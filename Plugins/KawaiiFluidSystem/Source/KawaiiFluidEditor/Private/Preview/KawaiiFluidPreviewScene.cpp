@@ -10,8 +10,10 @@
 #include "Modules/KawaiiFluidSimulationModule.h"
 #include "Modules/KawaiiFluidRenderingModule.h"
 #include "Rendering/KawaiiFluidRenderer.h"
+#include "Rendering/KawaiiFluidProxyRenderer.h"
 #include "Rendering/KawaiiFluidRendererSubsystem.h"
 #include "Simulation/KawaiiFluidSimulator.h"
+#include "Simulation/Utils/KawaiiFluidSpawnLattice.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 #include "Materials/MaterialInstanceDynamic.h"
@@ -194,12 +196,11 @@ void FKawaiiFluidPreviewScene::SetPreset(UKawaiiFluidPresetDataAsset* InPreset)
 			SimulationContext->SetCachedPreset(CurrentPreset);
 		}
 
-		// Initialize simulation module with preset and GPU simulator
+		// Initialize simulation module with preset and GPU simulator (backend selected in ResetSimulation)
 		if (SimulationModule)
 		{
 			SimulationModule->Initialize(CurrentPreset);
 			SimulationModule->SetGPUSimulator(SimulationContext->GetGPUSimulatorShared());
-			SimulationModule->SetGPUSimulationActive(true);
 		}
 
 		CachedParticleRadius = CurrentPreset->ParticleRadius;
@@ -284,7 +285,54 @@ void FKawaiiFluidPreviewScene::StopSimulation()
 }
 
 /**
- * @brief Clears GPU particle buffers and resets timers.
+ * @brief Routes the simulation module and renderers to the backend selected in the preview settings.
+ */
+void FKawaiiFluidPreviewScene::ApplyBackend()
+{
+	if (!SimulationModule || !PreviewSettingsObject)
+	{
+		return;
+	}
+
+	const FFluidPreviewSettings& Settings = PreviewSettingsObject->Settings;
+	const bool bCPU = Settings.IsCPUBackend();
+
+	if (bCPU)
+	{
+		SimulationModule->SetCPUSimulationBackend(true, Settings.CPUParticleBudget);
+	}
+	else
+	{
+		SimulationModule->SetCPUSimulationBackend(false);
+		SimulationModule->SetGPUSimulationActive(SimulationContext && SimulationContext->IsGPUSimulatorReady());
+	}
+
+	// CPU particles are drawn by the pooled ISM proxies; the metaball pipeline reads GPU buffers only
+	if (RenderingModule)
+	{
+		if (UKawaiiFluidProxyRenderer* ISM = RenderingModule->GetISMRenderer())
+		{
+			ISM->SetEnabled(bCPU);
+		}
+
+		if (UKawaiiFluidRenderer* Metaball = RenderingModule->GetMetaballRenderer())
+		{
+			Metaball->SetEnabled(!bCPU);
+		}
+	}
+}
+
+/**
+ * @brief Checks whether the preview runs on the CPU backend.
+ * @return True if the CPU solver owns the particles
+ */
+bool FKawaiiFluidPreviewScene::IsCPUBackend() const
+{
+	return SimulationModule && SimulationModule->IsCPUSimulationBackend();
+}
+
+/**
+ * @brief Clears CPU and GPU particles, reapplies the backend and resets timers.
  */
 void FKawaiiFluidPreviewScene::ResetSimulation()
 {
@@ -297,6 +345,16 @@ void FKawaiiFluidPreviewScene::ResetSimulation()
 			GPUSimulator->ClearAllParticles();
 		}
 	}
+
+	// Clear CPU particles
+	if (SimulationModule)
+	{
+		SimulationModule->GetParticlesMutable().Reset();
+		SimulationModule->SetAccumulatedTime(0.0f);
+	}
+
+	ApplyBackend();
+
 	SpawnAccumulatedTime = 0.0f;
 	TotalSimulationTime = 0.0f;
 
@@ -310,28 +368,31 @@ void FKawaiiFluidPreviewScene::ResetSimulation()
 			const FVector SpawnCenter = Settings.PreviewSpawnOffset;
 			const float Spacing = CurrentPreset->ParticleSpacing;
 			const FVector Velocity = Settings.InitialVelocityDirection.GetSafeNormal() * Settings.InitialSpeed;
+			const int32 MaxCount = Settings.GetEffectiveMaxParticleCount();
 
-			// Use SimulationModule's hexagonal spawn functions (same as EmitterComponent)
+			// Same HCP lattices as EmitterComponent
+			TArray<FVector> Positions;
 			switch (Settings.ShapeType)
 			{
 			case EPreviewEmitterShapeType::Sphere:
-				SimulationModule->SpawnParticlesSphereHexagonal(
-					SpawnCenter, Settings.SphereRadius, Spacing,
-					true, Settings.JitterAmount, Velocity);
+				FKawaiiFluidSpawnLattice::GenerateSphere(SpawnCenter, FQuat::Identity, Settings.SphereRadius, Spacing,
+					Settings.JitterAmount, MaxCount, Positions);
 				break;
 
 			case EPreviewEmitterShapeType::Cube:
-				SimulationModule->SpawnParticlesBoxHexagonal(
-					SpawnCenter, Settings.CubeHalfSize, Spacing,
-					true, Settings.JitterAmount, Velocity);
+				FKawaiiFluidSpawnLattice::GenerateBox(SpawnCenter, FQuat::Identity, Settings.CubeHalfSize, Spacing,
+					Settings.JitterAmount, MaxCount, Positions);
 				break;
 
 			case EPreviewEmitterShapeType::Cylinder:
-				SimulationModule->SpawnParticlesCylinderHexagonal(
-					SpawnCenter, Settings.CylinderRadius, Settings.CylinderHalfHeight, Spacing,
-					true, Settings.JitterAmount, Velocity);
+				FKawaiiFluidSpawnLattice::GenerateCylinder(SpawnCenter, FQuat::Identity, Settings.CylinderRadius,
+					Settings.CylinderHalfHeight, Spacing, Settings.JitterAmount, MaxCount, Positions);
 				break;
 			}
+
+			TArray<FVector> Velocities;
+			Velocities.Init(Velocity, Positions.Num());
+			SimulationModule->SpawnParticlesBatch(Positions, Velocities);
 		}
 	}
 }
@@ -347,14 +408,15 @@ void FKawaiiFluidPreviewScene::SpawnParticles(float DeltaTime)
 		return;
 	}
 
+	const FFluidPreviewSettings& Settings = PreviewSettingsObject->Settings;
+	const bool bCPU = IsCPUBackend();
+
 	FKawaiiFluidSimulator* GPUSimulator = SimulationModule->GetGPUSimulator();
-	if (!GPUSimulator)
+	if (!bCPU && !GPUSimulator)
 	{
 		return;
 	}
 
-	const FFluidPreviewSettings& Settings = PreviewSettingsObject->Settings;
-
 	// Only process Stream mode (Fill mode spawns on reset)
 	if (!Settings.IsStreamMode())
 	{
@@ -362,10 +424,14 @@ void FKawaiiFluidPreviewScene::SpawnParticles(float DeltaTime)
 	}
 
 	// Check max particle count (skip if Recycle mode - let recycle handle overflow)
-	if (Settings.MaxParticleCount > 0 && !Settings.bContinuousSpawn)
+	// The CPU budget is a hard cap: the module drops spawns beyond it
+	const int32 MaxCount = Settings.GetEffectiveMaxParticleCount();
+	if (MaxCount > 0 && (bCPU || !Settings.bContinuousSpawn))
 	{
-		const int32 CurrentCount = GPUSimulator->GetParticleCount() + GPUSimulator->GetPendingSpawnCount();
-		if (CurrentCount >= Settings.MaxParticleCount)
+		const int32 CurrentCount = bCPU
+			? SimulationModule->GetParticleCount()
+			: GPUSimulator->GetParticleCount() + GPUSimulator->GetPendingSpawnCount();
+		if (CurrentCount >= MaxCount)
 		{
 			return;
 		}
@@ -407,6 +473,7 @@ void FKawaiiFluidPreviewScene::SpawnParticles(float DeltaTime)
 
 	// === Spawn layers with position offset (reverse order - oldest first) ===
 	// Like EmitterComponent: apply position offset to each layer to prevent overlap
+	TArray<FVector> Positions;
 	for (int32 i = LayerCount - 1; i >= 0; --i)
 	{
 		// Calculate position offset for each layer
@@ -415,16 +482,21 @@ void FKawaiiFluidPreviewScene::SpawnParticles(float DeltaTime)
 		const float PositionOffset = static_cast<float>(i) * LayerSpacing + ResidualDistance;
 		const FVector OffsetLocation = BaseLocation + OffsetDir * PositionOffset;
 
-		SimulationModule->SpawnParticleDirectionalHexLayer(
+		FKawaiiFluidSpawnLattice::GenerateStreamLayer(
 			OffsetLocation,
 			VelocityDir,
-			Settings.InitialSpeed,
 			Settings.StreamRadius,
 			EffectiveSpacing,
-			Settings.StreamJitter
+			Settings.StreamJitter,
+			Positions
 		);
 	}
 
+	// Single batch for all layers this frame
+	TArray<FVector> Velocities;
+	Velocities.Init(VelocityDir * Settings.InitialSpeed, Positions.Num());
+	SimulationModule->SpawnParticlesBatch(Positions, Velocities);
+
 	// Update accumulator with residual distance
 	SpawnAccumulatedTime = ResidualDistance;
 
@@ -436,13 +508,14 @@ void FKawaiiFluidPreviewScene::SpawnParticles(float DeltaTime)
  */
 void FKawaiiFluidPreviewScene::TickSimulation(float DeltaTime)
 {
-	if (!bSimulationActive || !CurrentPreset || !SimulationContext)
+	if (!bSimulationActive || !CurrentPreset || !SimulationContext || !SimulationModule)
 	{
 		return;
 	}
 
+	const bool bCPU = IsCPUBackend();
 	FKawaiiFluidSimulator* GPUSimulator = SimulationContext->GetGPUSimulator();
-	if (!GPUSimulator)
+	if (!bCPU && !GPUSimulator)
 	{
 		return;
 	}
@@ -453,7 +526,7 @@ void FKawaiiFluidPreviewScene::TickSimulation(float DeltaTime)
 	// Request stats readback for density display in preview stats overlay
 	GetFluidStatsCollector().SetReadbackRequested(true);
 
-	// Spawn new particles (GPU spawn requests)
+	// Spawn new particles (CPU particles or GPU spawn requests)
 	SpawnParticles(DeltaTime);
 
 	// Build simulation params
@@ -466,21 +539,49 @@ void FKawaiiFluidPreviewScene::TickSimulation(float DeltaTime)
 	const FVector BoundsMin(-500.0, -500.0, 0.0);
 	const FVector BoundsMax(500.0, 500.0, 500.0);
 	Params.WorldBounds = FBox(BoundsMin, BoundsMax);
-	GPUSimulator->SetSimulationBounds(FVector3f(BoundsMin), FVector3f(BoundsMax));
-
-	// Run GPU simulation
-	static TArray<FKawaiiFluidParticle> DummyParticles;  // GPU mode doesn't use CPU particles
-	static FKawaiiFluidSpatialHash DummySpatialHash(CurrentPreset->SmoothingRadius);
-	float AccumulatedTime = 0.0f;
-
-	SimulationContext->Simulate(
-		DummyParticles,
-		CurrentPreset,
-		Params,
-		DummySpatialHash,
-		DeltaTime,
-		AccumulatedTime
-	);
+
+	if (bCPU)
+	{
+		// Preview viewport location drives the CPU simulation LOD tiers (when enabled on the preset)
+		if (const UWorld* PreviewWorld = GetWorld())
+		{
+			Params.LODViewLocations = PreviewWorld->ViewLocationsRenderedLastFrame;
+		}
+
+		// Run CPU simulation on the module's particles (bounds containment replaces GPU bounds collision)
+		FKawaiiFluidSpatialHash* SpatialHash = SimulationModule->GetSpatialHash();
+		if (SpatialHash)
+		{
+			float AccumulatedTime = SimulationModule->GetAccumulatedTime();
+			SimulationContext->SimulateCPU(
+				SimulationModule->GetParticlesMutable(),
+				CurrentPreset,
+				Params,
+				*SpatialHash,
+				DeltaTime,
+				AccumulatedTime
+			);
+			SimulationModule->SetAccumulatedTime(AccumulatedTime);
+		}
+	}
+	else
+	{
+		GPUSimulator->SetSimulationBounds(FVector3f(BoundsMin), FVector3f(BoundsMax));
+
+		// Run GPU simulation
+		static TArray<FKawaiiFluidParticle> DummyParticles;  // GPU mode doesn't use CPU particles
+		static FKawaiiFluidSpatialHash DummySpatialHash(CurrentPreset->SmoothingRadius);
+		float AccumulatedTime = 0.0f;
+
+		SimulationContext->Simulate(
+			DummyParticles,
+			CurrentPreset,
+			Params,
+			DummySpatialHash,
+			DeltaTime,
+			AccumulatedTime
+		);
+	}
 
 	// Update rendering module
 	if (RenderingModule)
@@ -489,14 +590,6 @@ void FKawaiiFluidPreviewScene::TickSimulation(float DeltaTime)
 	}
 }
 
-/**
- * @brief Floor collision logic (currently handled by GPU bounds).
- */
-void FKawaiiFluidPreviewScene::HandleFloorCollision()
-{
-	// Floor collision is handled by GPU bounds collision
-}
-
 /**
  * @brief Returns the simulation settings.
  * @return Reference to the preview settings
@@ -548,21 +641,26 @@ void FKawaiiFluidPreviewScene::UpdateEnvironment()
 
 /**
  * @brief Returns CPU particles (empty in GPU mode).
- * @return Empty particle array
+ * @return CPU backend particle array
  */
 const TArray<FKawaiiFluidParticle>& FKawaiiFluidPreviewScene::GetParticles() const
 {
+	if (IsCPUBackend())
+	{
+		return SimulationModule->GetParticles();
+	}
+
 	static TArray<FKawaiiFluidParticle> EmptyArray;
 	return EmptyArray;
 }
 
 /**
- * @brief Returns the particle count from GPU.
+ * @brief Returns the particle count of the active backend.
  * @return Current particle count
  */
 int32 FKawaiiFluidPreviewScene::GetParticleCount() const
 {
-	return GetGPUParticleCount();
+	return IsCPUBackend() ? SimulationModule->GetParticles().Num() : GetGPUParticleCount();
 }
 
 /**
@@ -580,15 +678,20 @@ float FKawaiiFluidPreviewScene::GetParticleRadius() const
  */
 bool FKawaiiFluidPreviewScene::IsDataValid() const
 {
-	return IsGPUSimulationActive();
+	return IsCPUBackend() || IsGPUSimulationActive();
 }
 
 /**
  * @brief Returns mutable CPU particles (empty in GPU mode).
- * @return Empty particle array
+ * @return CPU backend particle array
  */
 TArray<FKawaiiFluidParticle>& FKawaiiFluidPreviewScene::GetParticlesMutable()
 {
+	if (IsCPUBackend())
+	{
+		return SimulationModule->GetParticlesMutable();
+	}
+
 	static TArray<FKawaiiFluidParticle> EmptyArray;
 	return EmptyArray;
 }
@@ -612,7 +715,7 @@ float FKawaiiFluidPreviewScene::GetSimulationTime() const
  */
 bool FKawaiiFluidPreviewScene::IsGPUSimulationActive() const
 {
-	return SimulationContext && SimulationContext->IsGPUSimulatorReady();
+	return !IsCPUBackend() && SimulationContext && SimulationContext->IsGPUSimulatorReady();
 }
 
 /**
@@ -639,4 +742,13 @@ int32 FKawaiiFluidPreviewScene::GetGPUParticleCount() const
 FKawaiiFluidSimulator* FKawaiiFluidPreviewScene::GetGPUSimulator() const
 {
 	return SimulationContext ? SimulationContext->GetGPUSimulator() : nullptr;
+}
+
+/**
+ * @brief Returns a shared reference to the GPU simulator instance.
+ * @return Shared GPU simulator
+ */
+TSharedPtr<FKawaiiFluidSimulator> FKawaiiFluidPreviewScene::GetGPUSimulatorShared() const
+{
+	return SimulationContext ? SimulationContext->GetGPUSimulatorShared() : nullptr;
 }
\ No newline at end of file
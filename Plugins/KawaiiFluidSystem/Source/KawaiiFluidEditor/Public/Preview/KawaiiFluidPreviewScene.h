@@ -17,12 +17,13 @@ struct FKawaiiFluidParticle;
  * @brief FKawaiiFluidPreviewScene
  * 
  * A specialized preview world for fluid simulation.
- * Manages the GPU simulator, simulation module, and rendering module 
- * in a lightweight environment for asset editing.
+ * Runs the runtime simulation context on either a budgeted CPU backend (default, rendered
+ * through the pooled ISM proxy renderer) or the full GPU simulator (metaball rendering).
+ * Spawning uses the same FKawaiiFluidSpawnLattice shapes as UKawaiiFluidEmitterComponent.
  * 
  * @param CurrentPreset The fluid preset currently being previewed
  * @param PreviewSettingsObject Wrapper object for simulation settings in Details Panel
- * @param SimulationContext Physics solver with GPU simulator integration
+ * @param SimulationContext Physics solver (CPU substeps or GPU simulator)
  * @param SimulationModule Module handling particle spawn and update logic
  * @param RenderingModule Module handling visualization (ISM/Metaball)
  * @param PreviewActor Transient actor hosting simulation components
@@ -53,6 +54,8 @@ public:
 
 	virtual FKawaiiFluidSimulator* GetGPUSimulator() const override;
 
+	virtual TSharedPtr<FKawaiiFluidSimulator> GetGPUSimulatorShared() const override;
+
 	UKawaiiFluidRenderingModule* GetRenderingModule() const { return RenderingModule; }
 
 	//========================================
@@ -98,7 +101,7 @@ public:
 	void UpdateEnvironment();
 
 	//========================================
-	// Particle Access (GPU mode - limited)
+	// Particle Access (CPU backend only)
 	//========================================
 
 	TArray<FKawaiiFluidParticle>& GetParticlesMutable();
@@ -110,9 +113,9 @@ private:
 
 	void CreateVisualizationComponents();
 
-	void UpdateInstancedMesh();
+	void ApplyBackend();
 
-	void HandleFloorCollision();
+	bool IsCPUBackend() const;
 
 private:
 	/** Current preset being previewed */
@@ -35,6 +35,19 @@ enum class EPreviewEmitterShapeType : uint8
 	Cylinder UMETA(DisplayName = "Cylinder")
 };
 
+/**
+ * Solver backend for preview
+ */
+UENUM(BlueprintType)
+enum class EPreviewSimulationBackend : uint8
+{
+	/** Runtime CPU solver with a fixed particle budget (cheap, rendered through ISM proxies) */
+	CPU UMETA(DisplayName = "CPU"),
+
+	/** Full GPU simulator (same path as runtime volumes, metaball rendering) */
+	GPU UMETA(DisplayName = "GPU")
+};
+
 /**
  * Preview spawn settings - matches UKawaiiFluidEmitterComponent structure
  * for consistent behavior between editor preview and runtime
@@ -52,6 +65,10 @@ struct FFluidPreviewSettings
 	UPROPERTY(EditAnywhere, Category = "Emitter")
 	EPreviewEmitterMode EmitterMode = EPreviewEmitterMode::Stream;
 
+	/** Solver backend: CPU (budgeted, cheap) or GPU (full runtime simulator) */
+	UPROPERTY(EditAnywhere, Category = "Emitter")
+	EPreviewSimulationBackend SimulationBackend = EPreviewSimulationBackend::CPU;
+
 	//========================================
 	// Fill Mode Settings
 	//========================================
@@ -112,6 +129,11 @@ struct FFluidPreviewSettings
 		meta = (ClampMin = "0", ClampMax = "100000"))
 	int32 MaxParticleCount = 10000;
 
+	/** Particle budget for the CPU backend (spawns beyond it are dropped) */
+	UPROPERTY(EditAnywhere, Category = "Limits",
+		meta = (EditCondition = "SimulationBackend == EPreviewSimulationBackend::CPU", EditConditionHides, ClampMin = "100", ClampMax = "30000"))
+	int32 CPUParticleBudget = 4000;
+
 	/** GPU buffer size (fixed allocation) */
 	static constexpr int32 GPUBufferSize = 100000;
 
@@ -150,6 +172,17 @@ struct FFluidPreviewSettings
 
 	bool IsFillMode() const { return EmitterMode == EPreviewEmitterMode::Fill; }
 	bool IsStreamMode() const { return EmitterMode == EPreviewEmitterMode::Stream; }
+	bool IsCPUBackend() const { return SimulationBackend == EPreviewSimulationBackend::CPU; }
+
+	/** Effective particle cap for the active backend (0 = unlimited) */
+	int32 GetEffectiveMaxParticleCount() const
+	{
+		if (!IsCPUBackend())
+		{
+			return MaxParticleCount;
+		}
+		return MaxParticleCount > 0 ? FMath::Min(MaxParticleCount, CPUParticleBudget) : CPUParticleBudget;
+	}
 };
 
 /**
@@ -274,7 +274,8 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 		const int32 ActualParticleCount = bGPUActive ? GPUSimulator->GetParticleCount() : SimulationModule->GetParticleCount();
 		if (ActualParticleCount <= 0)
 		{
-			CachedShadowPositions.Empty();
+			ShadowSnapshot.Reset();
+			ShadowAnisotropySnapshot.Reset();
 			CachedShadowVelocities.Empty();
 			CachedNeighborCounts.Empty();
 			return;
@@ -337,64 +338,55 @@ void AKawaiiFluidVolume::Tick(float DeltaSeconds)
 			const bool bNeedVFX = VolumeComponent->SplashVFX != nullptr;
 			const bool bNeedDebug = IsPointDebugMode(VolumeComponent->DebugDrawMode);
 			const bool bNeedDebugZOrder = (VolumeComponent->DebugDrawMode == EKawaiiFluidDebugDrawMode::Point_ZOrderArrayIndex);
-			const bool bNeedReadback = bNeedShadow || bNeedVFX || bNeedDebug;
+			const bool bNeedReadback = bNeedShadow || bNeedVFX;
 
-			// Only enable readback when actually needed (avoids GPU barrier overhead)
-			GPUSimulator->SetShadowReadbackEnabled(bNeedReadback);
+			// Register only the fields each path reads (no registration = no readback, no GPU barrier)
+			GPUSimulator->SetReadbackConsumerFields(EKawaiiFluidReadbackConsumer::Shadow,
+				bNeedReadback ? EKawaiiFluidReadbackField::ShadowSet : EKawaiiFluidReadbackField::None);
+			GPUSimulator->SetReadbackConsumerFields(EKawaiiFluidReadbackConsumer::DebugDraw,
+				bNeedDebug ? EKawaiiFluidReadbackField::DebugDrawSet : EKawaiiFluidReadbackField::None);
 			GPUSimulator->SetAnisotropyReadbackEnabled(bNeedShadow); // Anisotropy only for shadow rendering
 			GPUSimulator->SetDebugZOrderIndexEnabled(bNeedDebugZOrder); // Enable Z-Order index recording for Post-Sort debug visualization
 
-			TArray<FVector> NewVelocities;
-			TArray<FVector4> NewAnisotropyAxis1, NewAnisotropyAxis2, NewAnisotropyAxis3;
-
-			if (bNeedReadback && GPUSimulator->HasReadyShadowPositions())
+			// Hold the latest immutable snapshot; a new version restarts the prediction clock
+			TSharedPtr<const FKawaiiFluidParticleSnapshot> Snapshot = bNeedReadback ? GPUSimulator->GetParticleSnapshot() : nullptr;
+			if (Snapshot.IsValid() && Snapshot->Frame > 0 && Snapshot->HasNeighborCounts() && Snapshot != ShadowSnapshot)
 			{
-				// New readback data available - update cache (with anisotropy)
-				GPUSimulator->GetShadowDataWithAnisotropy(
-					Positions, NewVelocities,
-					NewAnisotropyAxis1, NewAnisotropyAxis2, NewAnisotropyAxis3);
-				NumParticles = Positions.Num();
-
-				if (NumParticles > 0)
-				{
-					// Use Move for arrays that won't be used after this (avoids deep copy)
-					CachedShadowPositions = Positions;  // Keep copy - needed for RegisterShadowParticles below
-					CachedShadowVelocities = MoveTemp(NewVelocities);
-					CachedAnisotropyAxis1 = MoveTemp(NewAnisotropyAxis1);
-					CachedAnisotropyAxis2 = MoveTemp(NewAnisotropyAxis2);
-					CachedAnisotropyAxis3 = MoveTemp(NewAnisotropyAxis3);
-					LastShadowReadbackFrame = GFrameCounter;
-					LastShadowReadbackTime = FPlatformTime::Seconds();
-
-					// Also cache neighbor counts for isolation detection
-					GPUSimulator->GetShadowNeighborCounts(CachedNeighborCounts);
-				}
+				ShadowSnapshot = Snapshot;
+				ShadowAnisotropySnapshot = GPUSimulator->GetAnisotropySnapshot();
+				LastShadowReadbackFrame = GFrameCounter;
+				LastShadowReadbackTime = FPlatformTime::Seconds();
 			}
-			else if (bNeedReadback && CachedShadowPositions.Num() > 0 && CachedShadowVelocities.Num() == CachedShadowPositions.Num())
+
+			if (bNeedReadback && ShadowSnapshot.IsValid())
 			{
-				// No new data - predict positions using cached velocity
+				// Predict positions using the snapshot velocity (0 on the frame the readback landed)
+				const FKawaiiFluidParticleSnapshot& Shadow = *ShadowSnapshot;
+				const bool bPredict = Shadow.HasVelocities();
 				const double CurrentTime = FPlatformTime::Seconds();
-				const float PredictionDelta = static_cast<float>(CurrentTime - LastShadowReadbackTime);
 
 				// Clamp prediction delta to avoid extreme extrapolation
-				const float ClampedDelta = FMath::Clamp(PredictionDelta, 0.0f, 0.1f);
+				const float ClampedDelta = FMath::Clamp(static_cast<float>(CurrentTime - LastShadowReadbackTime), 0.0f, 0.1f);
 
-				NumParticles = CachedShadowPositions.Num();
+				NumParticles = Shadow.Num();
 				Positions.SetNumUninitialized(NumParticles);
+				CachedShadowVelocities.SetNumUninitialized(bPredict ? NumParticles : 0);
+				CachedNeighborCounts.SetNumUninitialized(NumParticles);
 
-				// Parallelize prediction loop
 				ParallelFor(NumParticles, [&](int32 i)
 				{
-					// Predict: Position += Velocity * DeltaTime
-					Positions[i] = CachedShadowPositions[i] + CachedShadowVelocities[i] * ClampedDelta;
-				});
-				// Note: Anisotropy is not predicted, use cached values directly
-			}
-			else if (bNeedReadback && CachedShadowPositions.Num() > 0)
-			{
-				// Fallback: use cached positions without prediction
-				Positions = CachedShadowPositions;
-				NumParticles = Positions.Num();
+					if (bPredict)
+					{
+						Positions[i] = FVector(Shadow.Positions[i] + Shadow.Velocities[i] * ClampedDelta);
+						CachedShadowVelocities[i] = FVector(Shadow.Velocities[i]);
+					}
+					else
+					{
+						Positions[i] = FVector(Shadow.Positions[i]);
+					}
+					CachedNeighborCounts[i] = static_cast<int32>(Shadow.NeighborCounts[i]);
+				}, NumParticles < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+				// Note: Anisotropy is not predicted, ShadowAnisotropySnapshot is held as read back
 			}
 			// If !bNeedReadback, NumParticles remains 0 and no readback processing occurs
 		}
@@ -627,6 +619,15 @@ void AKawaiiFluidVolume::Simulate(float DeltaTime)
 	// simulated by the Subsystem.
 }
 
+FKawaiiFluidSpawnRequestRing& AKawaiiFluidVolume::GetSpawnRequestRing()
+{
+	if (!SpawnRequestRing.IsValid())
+	{
+		SpawnRequestRing = MakeUnique<FKawaiiFluidSpawnRequestRing>();
+	}
+	return *SpawnRequestRing;
+}
+
 void AKawaiiFluidVolume::QueueSpawnRequest(FVector Position, FVector Velocity, int32 SourceID)
 {
 	FGPUSpawnRequest Request;
@@ -636,7 +637,7 @@ void AKawaiiFluidVolume::QueueSpawnRequest(FVector Position, FVector Velocity, i
 	Request.Mass = 1.0f;
 	Request.Radius = 0.0f; // Use default from preset
 
-	PendingSpawnRequests.Add(Request);
+	GetSpawnRequestRing().Push(Request);
 }
 
 void AKawaiiFluidVolume::QueueSpawnRequests(const TArray<FVector>& Positions, const TArray<FVector>& Velocities, int32 SourceID)
@@ -647,8 +648,7 @@ void AKawaiiFluidVolume::QueueSpawnRequests(const TArray<FVector>& Positions, co
 		return;
 	}
 
-	PendingSpawnRequests.Reserve(PendingSpawnRequests.Num() + Count);
-
+	FKawaiiFluidSpawnRequestRing& Ring = GetSpawnRequestRing();
 	for (int32 i = 0; i < Count; ++i)
 	{
 		FGPUSpawnRequest Request;
@@ -658,13 +658,37 @@ void AKawaiiFluidVolume::QueueSpawnRequests(const TArray<FVector>& Positions, co
 		Request.Mass = 0.0f;
 		Request.Radius = 0.0f;
 
-		PendingSpawnRequests.Add(Request);
+		Ring.Push(Request);
+	}
+}
+
+void AKawaiiFluidVolume::QueueSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests)
+{
+	if (Requests.Num() > 0)
+	{
+		GetSpawnRequestRing().Push(Requests);
+	}
+}
+
+void AKawaiiFluidVolume::ClearPendingSpawnRequests()
+{
+	if (SpawnRequestRing.IsValid())
+	{
+		SpawnRequestRing->CancelAll();
+	}
+}
+
+void AKawaiiFluidVolume::ClearPendingSpawnRequestsForSource(int32 SourceID)
+{
+	if (SpawnRequestRing.IsValid())
+	{
+		SpawnRequestRing->CancelSource(SourceID);
 	}
 }
 
 void AKawaiiFluidVolume::ProcessPendingSpawnRequests()
 {
-	if (PendingSpawnRequests.Num() == 0 || !SimulationModule)
+	if (!SpawnRequestRing.IsValid() || SpawnRequestRing->IsEmpty() || !SimulationModule)
 	{
 		return;
 	}
@@ -675,7 +699,7 @@ void AKawaiiFluidVolume::ProcessPendingSpawnRequests()
 	{
 		KF_LOG(Warning, TEXT("FluidVolume: No GPU simulator available for spawn requests (Volume=%s)"),
 			*GetName());
-		PendingSpawnRequests.Empty();
+		SpawnRequestRing->Consume([](TArrayView<FGPUSpawnRequest>) {});
 		return;
 	}
 
@@ -683,25 +707,27 @@ void AKawaiiFluidVolume::ProcessPendingSpawnRequests()
 	const float DefaultMass = SimulationModule->Preset ? SimulationModule->Preset->ParticleMass : 1.0f;
 	const float DefaultRadius = SimulationModule->Preset ? SimulationModule->Preset->ParticleRadius : 5.0f;
 
-	for (FGPUSpawnRequest& Request : PendingSpawnRequests)
+	// Requests are patched in place in the ring blocks and forwarded span by span (no staging copy)
+	const int32 NumSent = SpawnRequestRing->Consume([GPUSimulator, DefaultMass, DefaultRadius](TArrayView<FGPUSpawnRequest> Span)
 	{
-		if (Request.Mass <= 0.0f)
-		{
-			Request.Mass = DefaultMass;
-		}
-		if (Request.Radius <= 0.0f)
+		for (FGPUSpawnRequest& Request : Span)
 		{
-			Request.Radius = DefaultRadius;
+			if (Request.Mass <= 0.0f)
+			{
+				Request.Mass = DefaultMass;
+			}
+			if (Request.Radius <= 0.0f)
+			{
+				Request.Radius = DefaultRadius;
+			}
 		}
-	}
 
-	// Send all requests directly to GPU (preserving each request's SourceID)
-	GPUSimulator->AddSpawnRequests(PendingSpawnRequests);
+		// Send requests directly to GPU (preserving each request's SourceID)
+		GPUSimulator->AddSpawnRequests(Span);
+	});
 
 	KF_LOG_DEV(Verbose, TEXT("FluidVolume: Sent %d spawn requests to GPU (Volume=%s)"),
-		PendingSpawnRequests.Num(), *GetName());
-
-	PendingSpawnRequests.Empty();
+		NumSent, *GetName());
 }
 
 void AKawaiiFluidVolume::RegisterEmitter(AKawaiiFluidEmitter* Emitter)
@@ -1048,6 +1074,16 @@ void AKawaiiFluidVolume::InitializeEditorRendering()
 
 void AKawaiiFluidVolume::CleanupRendering()
 {
+	// Stop requesting the readback fields registered for shadows and debug draw
+	if (SimulationModule)
+	{
+		if (FKawaiiFluidSimulator* GPUSimulator = SimulationModule->GetGPUSimulator())
+		{
+			GPUSimulator->SetReadbackConsumerFields(EKawaiiFluidReadbackConsumer::Shadow, EKawaiiFluidReadbackField::None);
+			GPUSimulator->SetReadbackConsumerFields(EKawaiiFluidReadbackConsumer::DebugDraw, EKawaiiFluidReadbackField::None);
+		}
+	}
+
 	// Unregister from FluidRendererSubsystem first
 	if (UWorld* World = GetWorld())
 	{
@@ -1099,104 +1135,71 @@ void AKawaiiFluidVolume::DrawDebugParticles()
 		return;
 	}
 
+	FKawaiiFluidDebugPointSettings Settings;
+	Settings.Mode = VolumeComponent->DebugDrawMode;
+	Settings.MaxPoints = VolumeComponent->DebugPointBudget;
+	Settings.DecimationPixels = VolumeComponent->DebugPointDecimationPixels;
+
 	// Get particle size from Preset's ParticleRadius (simulation radius for accurate debug visualization)
-	float DebugPointSize = 5.0f;  // Default fallback
 	if (UKawaiiFluidPresetDataAsset* Preset = VolumeComponent->GetPreset())
 	{
-		DebugPointSize = Preset->ParticleRadius;
+		Settings.PointSize = Preset->ParticleRadius;
+		Settings.RestDensity = Preset->Density;
 	}
 
+	FVector ViewLocation;
+	const bool bHasView = FKawaiiFluidDebugPointBatcher::GetDebugView(World, ViewLocation, Settings.PixelAngle);
+	const FVector* ViewLocationPtr = bHasView ? &ViewLocation : nullptr;
+
 	if (SimulationModule->IsGPUSimulationActive())
 	{
-		// GPU mode: Use lightweight cached positions (no sync readback)
+		// GPU mode: Use the latest readback snapshot (no sync readback), rebuilt only when a new one landed
 		FKawaiiFluidSimulator* Simulator = SimulationModule->GetGPUSimulator();
 		if (!Simulator)
 		{
 			return;
 		}
 
-		TArray<FVector3f> Positions;
-		TArray<int32> ParticleIDs;
-		TArray<int32> SourceIDs;
-		if (!Simulator->GetParticlePositionsAndIDs(Positions, ParticleIDs, SourceIDs))
+		// The batcher reads the held snapshot in place; nothing is copied out of the simulator
+		const TSharedPtr<const FKawaiiFluidParticleSnapshot> Snapshot = Simulator->GetParticleSnapshot();
+		if (!Snapshot.IsValid() || !Snapshot->HasPositions())
 		{
 			return;
 		}
 
-		const int32 TotalCount = Positions.Num();
-		if (TotalCount == 0)
-		{
-			return;
-		}
-
-		// Get flags for Point_IsAttached debug mode
-		const TArray<uint32>* Flags = Simulator->GetParticleFlags();
-
-		// Get Z-Order array indices for Point_ZOrderArrayIndex debug mode (Post-Sort only)
-		TArray<int32> ZOrderIndices;
-		const bool bHasZOrderIndices = (VolumeComponent->DebugDrawMode == EKawaiiFluidDebugDrawMode::Point_ZOrderArrayIndex) &&
-										Simulator->GetZOrderArrayIndices(ZOrderIndices);
-
-		// Update bounds for position-based coloring
-		DebugDrawBoundsMin = FVector(Positions[0]);
-		DebugDrawBoundsMax = FVector(Positions[0]);
-		for (const FVector3f& Pos : Positions)
+		const uint64 CacheVersion = Snapshot->Version;
+		if (!DebugPointBatcher.IsUpToDate(Settings, ViewLocationPtr, CacheVersion))
 		{
-			FVector P(Pos);
-			DebugDrawBoundsMin = DebugDrawBoundsMin.ComponentMin(P);
-			DebugDrawBoundsMax = DebugDrawBoundsMax.ComponentMax(P);
-		}
-
-		// Draw particles
-		for (int32 i = 0; i < TotalCount; ++i)
-		{
-			FVector Pos(Positions[i]);
-			const bool bNearBoundary = Flags && i < Flags->Num() && ((*Flags)[i] & EGPUParticleFlags::NearBoundary);
-			
-			// Determine color index based on debug mode:
-			// - Post-Sort (Point_ZOrderArrayIndex): Z-Order sorted array index from GPU readback
-			// - Pre-Sort (Point_ZOrderPreSortIndex): ParticleID (= spawn order, represents unsorted state)
-			int32 ColorIndex = -1;
-			if (VolumeComponent->DebugDrawMode == EKawaiiFluidDebugDrawMode::Point_ZOrderPreSortIndex)
+			// Get Z-Order array indices for Point_ZOrderArrayIndex debug mode (Post-Sort only)
+			DebugPointZOrderIndices.Reset();
+			if (Settings.Mode == EKawaiiFluidDebugDrawMode::Point_ZOrderArrayIndex)
 			{
-				ColorIndex = ParticleIDs[i];
+				Simulator->GetZOrderArrayIndices(DebugPointZOrderIndices);
 			}
-			else if (bHasZOrderIndices && ParticleIDs[i] < ZOrderIndices.Num())
+
+			FKawaiiFluidDebugPointSource Source;
+			Source.Positions = Snapshot->Positions;
+			Source.ParticleIDs = Snapshot->ParticleIDs;
+			Source.ZOrderIndices = DebugPointZOrderIndices;
+
+			// Get flags for Point_IsAttached debug mode
+			if (Snapshot->HasFlags())
 			{
-				ColorIndex = ZOrderIndices[ParticleIDs[i]];
+				Source.Flags = Snapshot->Flags;
 			}
 
-			FColor Color = ComputeDebugDrawColor(i, TotalCount, Pos, 0.0f, bNearBoundary, ColorIndex);
-			DrawDebugPoint(World, Pos, DebugPointSize, Color, false, -1.0f, 0);
+			DebugPointBatcher.Build(Source, Settings, ViewLocationPtr, CacheVersion);
 		}
 	}
 	else
 	{
-		// CPU mode: Direct particle array
-		const TArray<FKawaiiFluidParticle>& Particles = SimulationModule->GetParticles();
-		const int32 TotalCount = Particles.Num();
-		if (TotalCount == 0)
-		{
-			return;
-		}
-
-		// Update bounds for position-based coloring
-		DebugDrawBoundsMin = Particles[0].Position;
-		DebugDrawBoundsMax = Particles[0].Position;
-		for (const FKawaiiFluidParticle& P : Particles)
-		{
-			DebugDrawBoundsMin = DebugDrawBoundsMin.ComponentMin(P.Position);
-			DebugDrawBoundsMax = DebugDrawBoundsMax.ComponentMax(P.Position);
-		}
-
-		// Draw particles
-		for (int32 i = 0; i < TotalCount; ++i)
-		{
-			const FKawaiiFluidParticle& P = Particles[i];
-			FColor Color = ComputeDebugDrawColor(i, TotalCount, P.Position, P.Density);
-			DrawDebugPoint(World, P.Position, DebugPointSize, Color, false, -1.0f, 0);
-		}
+		// CPU mode: Direct particle array (unversioned, rebuilt every frame)
+		FKawaiiFluidDebugPointSource Source;
+		Source.Particles = SimulationModule->GetParticles();
+		DebugPointBatcher.Build(Source, Settings, ViewLocationPtr);
 	}
+
+	DebugPointBatcher.Draw(World);
 }
 
 void AKawaiiFluidVolume::DrawDebugStaticBoundaryParticles()
@@ -1566,100 +1569,6 @@ void AKawaiiFluidVolume::GenerateEditorBoundaryParticlesPreview()
 }
 #endif
 
-FColor AKawaiiFluidVolume::ComputeDebugDrawColor(int32 ParticleIndex, int32 TotalCount, const FVector& InPosition, float Density, bool bNearBoundary, int32 ZOrderArrayIndex) const
-{
-	if (!VolumeComponent)
-	{
-		return FColor::White;
-	}
-
-	const EKawaiiFluidDebugDrawMode DrawMode = VolumeComponent->DebugDrawMode;
-	const UKawaiiFluidPresetDataAsset* Preset = VolumeComponent->GetPreset();
-
-	switch (DrawMode)
-	{
-	case EKawaiiFluidDebugDrawMode::Point_ZOrderArrayIndex:
-	case EKawaiiFluidDebugDrawMode::Point_ZOrderPreSortIndex:
-	case EKawaiiFluidDebugDrawMode::DebugDraw:  // Legacy fallthrough (default to ZOrderArrayIndex)
-		{
-			// Rainbow gradient based on Z-Order array index (actual post-sort index)
-			// If Z-Order is provided, use it; otherwise fall back to ParticleID (ParticleIndex)
-			const int32 IndexToUse = (ZOrderArrayIndex >= 0) ? ZOrderArrayIndex : ParticleIndex;
-			const float T = TotalCount > 1 ? static_cast<float>(IndexToUse) / static_cast<float>(TotalCount - 1) : 0.0f;
-			return FLinearColor::MakeFromHSV8(static_cast<uint8>(T * 255.0f), 255, 255).ToFColor(true);
-		}
-
-	case EKawaiiFluidDebugDrawMode::Point_ZOrderMortonCode:
-		{
-			// Compute Morton code from position
-			FVector Range = DebugDrawBoundsMax - DebugDrawBoundsMin;
-			float MaxRange = FMath::Max3(Range.X, Range.Y, Range.Z);
-			if (MaxRange < KINDA_SMALL_NUMBER)
-			{
-				MaxRange = 1.0f;
-			}
-
-			FVector NormPos = (InPosition - DebugDrawBoundsMin) / MaxRange;
-			NormPos.X = FMath::Clamp(NormPos.X, 0.0, 1.0);
-			NormPos.Y = FMath::Clamp(NormPos.Y, 0.0, 1.0);
-			NormPos.Z = FMath::Clamp(NormPos.Z, 0.0, 1.0);
-
-			// Simple Morton-like hue (not full Morton code, but visually similar)
-			float Hue = (NormPos.X * 0.33f + NormPos.Y * 0.33f + NormPos.Z * 0.33f);
-			return FLinearColor::MakeFromHSV8(static_cast<uint8>(Hue * 255.0f), 255, 255).ToFColor(true);
-		}
-
-	case EKawaiiFluidDebugDrawMode::Point_PositionX:
-		{
-			const FVector Range = DebugDrawBoundsMax - DebugDrawBoundsMin;
-			const float Normalized = (Range.X > KINDA_SMALL_NUMBER) ?
-				(InPosition.X - DebugDrawBoundsMin.X) / Range.X : 0.0f;
-			return FColor(static_cast<uint8>(FMath::Clamp(Normalized, 0.0f, 1.0f) * 255), 50, 50);
-		}
-
-	case EKawaiiFluidDebugDrawMode::Point_PositionY:
-		{
-			const FVector Range = DebugDrawBoundsMax - DebugDrawBoundsMin;
-			const float Normalized = (Range.Y > KINDA_SMALL_NUMBER) ?
-				(InPosition.Y - DebugDrawBoundsMin.Y) / Range.Y : 0.0f;
-			return FColor(50, static_cast<uint8>(FMath::Clamp(Normalized, 0.0f, 1.0f) * 255), 50);
-		}
-
-	case EKawaiiFluidDebugDrawMode::Point_PositionZ:
-		{
-			const FVector Range = DebugDrawBoundsMax - DebugDrawBoundsMin;
-			const float Normalized = (Range.Z > KINDA_SMALL_NUMBER) ?
-				(InPosition.Z - DebugDrawBoundsMin.Z) / Range.Z : 0.0f;
-			return FColor(50, 50, static_cast<uint8>(FMath::Clamp(Normalized, 0.0f, 1.0f) * 255));
-		}
-
-	case EKawaiiFluidDebugDrawMode::Point_Density:
-		{
-			// Blue (low) to Red (high) based on density
-			const float RestDensity = Preset ? Preset->Density : 1000.0f;
-			const float NormalizedDensity = FMath::Clamp(Density / (RestDensity * 2.0f), 0.0f, 1.0f);
-			return FLinearColor::LerpUsingHSV(FLinearColor::Blue, FLinearColor::Red, NormalizedDensity).ToFColor(true);
-		}
-
-	case EKawaiiFluidDebugDrawMode::Point_IsAttached:
-		{
-			// Green = near boundary, Blue = free particle
-			// This visualizes NEAR_BOUNDARY flag which is dynamically set by GPU BoundaryAdhesion pass
-			if (bNearBoundary)
-			{
-				return FColor(50, 255, 50, 255);  // Bright green for near boundary
-			}
-			else
-			{
-				return FColor(50, 100, 255, 255);  // Blue for free particles
-			}
-		}
-
-	default:
-		return FColor::White;
-	}
-}
-
 //========================================
 // Brush API
 //========================================
@@ -1730,12 +1639,10 @@ void AKawaiiFluidVolume::ClearAllParticles()
 	}
 
 	// Clear cached shadow data (like UKawaiiFluidComponent does)
-	CachedShadowPositions.Empty();
+	ShadowSnapshot.Reset();
+	ShadowAnisotropySnapshot.Reset();
 	CachedShadowVelocities.Empty();
 	CachedNeighborCounts.Empty();
-	CachedAnisotropyAxis1.Empty();
-	CachedAnisotropyAxis2.Empty();
-	CachedAnisotropyAxis3.Empty();
 	PrevNeighborCounts.Empty();
 
 	// Just update rendering - will show 0 particles
@@ -8,6 +8,7 @@
 #include "Core/KawaiiFluidSimulationStats.h"
 #include "Modules/KawaiiFluidSimulationModule.h"
 #include "Simulation/KawaiiFluidSimulator.h"
+#include "Simulation/Utils/KawaiiFluidSpawnLattice.h"
 #include "Core/KawaiiFluidPresetDataAsset.h"
 #include "DrawDebugHelpers.h"
 #include "Components/ArrowComponent.h"
@@ -706,8 +707,7 @@ void UKawaiiFluidEmitterComponent::ProcessStreamEmitter(float DeltaTime)
 	// LayerSpacing = distance traveled in one LayerInterval
 	const float LayerSpacing = InitialSpeed * LayerInterval;
 	
-	TArray<FVector> AllPositions;
-	TArray<FVector> AllVelocities;
+	SpawnRequestBuffer.Reset();
 
 	for (int32 LayerIdx = 0; LayerIdx < LayerCount; ++LayerIdx)
 	{
@@ -721,16 +721,12 @@ void UKawaiiFluidEmitterComponent::ProcessStreamEmitter(float DeltaTime)
 			InitialSpeed,
 			StreamRadius,
 			EffectiveSpacing,
-			AllPositions,
-			AllVelocities
+			SpawnRequestBuffer
 		);
 	}
 
 	// === Send all particles in single batch ===
-	if (AllPositions.Num() > 0)
-	{
-		QueueSpawnRequest(AllPositions, AllVelocities);
-	}
+	QueueSpawnRequests(SpawnRequestBuffer);
 
 	// === Recycle (Stream mode only): GPU-driven per-source recycling ===
 	// SetSourceEmitterMax is called in BeginPlay/EndPlay — GPU autonomously removes
@@ -750,103 +746,17 @@ void UKawaiiFluidEmitterComponent::ProcessStreamEmitter(float DeltaTime)
 int32 UKawaiiFluidEmitterComponent::SpawnParticlesSphereHexagonal(FVector Center, FQuat Rotation, float Radius, float Spacing, FVector InInitialVelocity)
 {
 	AKawaiiFluidVolume* Volume = GetTargetVolume();
-	if (!Volume || Spacing <= 0.0f || Radius <= 0.0f) return 0;
-
-	TArray<FVector> Positions;
-	TArray<FVector> Velocities;
-
-	// HCP density compensation (matches KawaiiFluidSimulationModule exactly)
-	const float HCPCompensation = 1.122f;
-	const float AdjustedSpacing = Spacing * HCPCompensation;
-
-	// Hexagonal close packing offsets
-	const float RowSpacingY = AdjustedSpacing * 0.866025f;   // sqrt(3)/2
-	const float LayerSpacingZ = AdjustedSpacing * 0.816497f; // sqrt(2/3)
-	const float RadiusSq = Radius * Radius;
-	const float JitterRange = AdjustedSpacing * JitterAmount;
-
-	// Integer-based grid (matches SimulationModule)
-	const int32 GridSize = FMath::CeilToInt(Radius / AdjustedSpacing) + 1;
-	const int32 GridSizeY = FMath::CeilToInt(Radius / RowSpacingY) + 1;
-	const int32 GridSizeZ = FMath::CeilToInt(Radius / LayerSpacingZ) + 1;
-
-	const float EstimatedCount = (4.0f / 3.0f) * PI * Radius * Radius * Radius / (AdjustedSpacing * AdjustedSpacing * AdjustedSpacing);
-	Positions.Reserve(FMath::CeilToInt(EstimatedCount));
-	Velocities.Reserve(FMath::CeilToInt(EstimatedCount));
-
-	for (int32 z = -GridSizeZ; z <= GridSizeZ; ++z)
-	{
-		// Z-layer offset pattern (mod 3) - ABCABC stacking for proper HCP
-		const int32 ZMod = ((z + GridSizeZ) % 3);
-		const float ZLayerOffsetX = (ZMod == 1) ? AdjustedSpacing * 0.5f : ((ZMod == 2) ? AdjustedSpacing * 0.25f : 0.0f);
-		const float ZLayerOffsetY = (ZMod == 1) ? RowSpacingY / 3.0f : ((ZMod == 2) ? RowSpacingY * 2.0f / 3.0f : 0.0f);
-
-		for (int32 y = -GridSizeY; y <= GridSizeY; ++y)
-		{
-			const float RowOffsetX = (((y + GridSizeY) % 2) == 1) ? AdjustedSpacing * 0.5f : 0.0f;
-
-			for (int32 x = -GridSize; x <= GridSize; ++x)
-			{
-				// Check MaxParticleCount limit (Fill mode)
-				if (MaxParticleCount > 0 && Positions.Num() >= MaxParticleCount)
-				{
-					break;
-				}
+	if (!Volume) return 0;
 
-				FVector LocalPos(
-					x * AdjustedSpacing + RowOffsetX + ZLayerOffsetX,
-					y * RowSpacingY + ZLayerOffsetY,
-					z * LayerSpacingZ
-				);
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Lattice = FKawaiiFluidSpawnLattice::GetTemplate(
+		EKawaiiFluidLatticeShape::Sphere, Spacing, FKawaiiFluidSpawnLattice::SphereDimensions(Radius));
 
-				// Check sphere bounds
-				const float DistSq = LocalPos.SizeSquared();
-				if (DistSq > RadiusSq)
-				{
-					continue;
-				}
-
-				// Apply rotation to local position, then translate to world
-				FVector RotatedPos = Rotation.RotateVector(LocalPos);
-				FVector WorldPos = Center + RotatedPos;
-
-				// Apply jitter with distance-based falloff (center: 100%, surface: 0%)
-				// This prevents surface particles from protruding and causing jagged edges
-				if (bUseJitter && JitterRange > 0.0f)
-				{
-					const float Dist = FMath::Sqrt(DistSq);
-					const float JitterFactor = FMath::Clamp(1.0f - (Dist / Radius), 0.0f, 1.0f);
-					const float ActualJitter = JitterRange * JitterFactor;
+	SpawnRequestBuffer.Reset();
+	const int32 Count = FKawaiiFluidSpawnLattice::TransformToSpawnRequests(*Lattice, Center, Rotation,
+		bUseJitter ? JitterAmount : 0.0f, MaxParticleCount, InInitialVelocity, CachedSourceID, SpawnRequestBuffer);
 
-					if (ActualJitter > 0.0f)
-					{
-						WorldPos += FVector(
-							FMath::FRandRange(-ActualJitter, ActualJitter),
-							FMath::FRandRange(-ActualJitter, ActualJitter),
-							FMath::FRandRange(-ActualJitter, ActualJitter)
-						);
-					}
-				}
-
-				Positions.Add(WorldPos);
-				Velocities.Add(InInitialVelocity);
-			}
-			
-			// Break outer loops if limit reached
-			if (MaxParticleCount > 0 && Positions.Num() >= MaxParticleCount)
-			{
-				break;
-			}
-		}
-		
-		if (MaxParticleCount > 0 && Positions.Num() >= MaxParticleCount)
-		{
-			break;
-		}
-	}
-
-	QueueSpawnRequest(Positions, Velocities);
-	return Positions.Num();
+	QueueSpawnRequests(SpawnRequestBuffer);
+	return Count;
 }
 
 /**
@@ -861,113 +771,17 @@ int32 UKawaiiFluidEmitterComponent::SpawnParticlesSphereHexagonal(FVector Center
 int32 UKawaiiFluidEmitterComponent::SpawnParticlesCubeHexagonal(FVector Center, FQuat Rotation, FVector HalfSize, float Spacing, FVector InInitialVelocity)
 {
 	AKawaiiFluidVolume* Volume = GetTargetVolume();
-	if (!Volume || Spacing <= 0.0f) return 0;
-
-	TArray<FVector> Positions;
-	TArray<FVector> Velocities;
-
-	// HCP density compensation (matches KawaiiFluidSimulationModule exactly)
-	const float HCPCompensation = 1.122f;
-	const float AdjustedSpacing = Spacing * HCPCompensation;
-
-	// Hexagonal Close Packing constants
-	const float RowSpacingY = AdjustedSpacing * 0.866025f;   // sqrt(3)/2
-	const float LayerSpacingZ = AdjustedSpacing * 0.816497f; // sqrt(2/3)
-	const float JitterRange = AdjustedSpacing * JitterAmount;
-
-	// Calculate grid counts (matches SimulationModule)
-	const int32 CountX = FMath::Max(1, FMath::CeilToInt(HalfSize.X * 2.0f / AdjustedSpacing));
-	const int32 CountY = FMath::Max(1, FMath::CeilToInt(HalfSize.Y * 2.0f / RowSpacingY));
-	const int32 CountZ = FMath::Max(1, FMath::CeilToInt(HalfSize.Z * 2.0f / LayerSpacingZ));
+	if (!Volume) return 0;
 
-	const int32 EstimatedTotal = CountX * CountY * CountZ;
-	Positions.Reserve(EstimatedTotal);
-	Velocities.Reserve(EstimatedTotal);
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Lattice = FKawaiiFluidSpawnLattice::GetTemplate(
+		EKawaiiFluidLatticeShape::Box, Spacing, HalfSize);
 
-	// Start position (bottom-left-back corner with half-spacing offset)
-	const FVector LocalStart(-HalfSize.X + AdjustedSpacing * 0.5f, -HalfSize.Y + RowSpacingY * 0.5f, -HalfSize.Z + LayerSpacingZ * 0.5f);
+	SpawnRequestBuffer.Reset();
+	const int32 Count = FKawaiiFluidSpawnLattice::TransformToSpawnRequests(*Lattice, Center, Rotation,
+		bUseJitter ? JitterAmount : 0.0f, MaxParticleCount, InInitialVelocity, CachedSourceID, SpawnRequestBuffer);
 
-	for (int32 z = 0; z < CountZ; ++z)
-	{
-		// Z layer offset for HCP (ABC stacking pattern - mod 3)
-		const float ZLayerOffsetX = (z % 3 == 1) ? AdjustedSpacing * 0.5f : ((z % 3 == 2) ? AdjustedSpacing * 0.25f : 0.0f);
-		const float ZLayerOffsetY = (z % 3 == 1) ? RowSpacingY / 3.0f : ((z % 3 == 2) ? RowSpacingY * 2.0f / 3.0f : 0.0f);
-
-		for (int32 y = 0; y < CountY; ++y)
-		{
-			// Row offset for hexagonal pattern in XY plane
-			const float RowOffsetX = (y % 2 == 1) ? AdjustedSpacing * 0.5f : 0.0f;
-
-			for (int32 x = 0; x < CountX; ++x)
-			{
-				// Check MaxParticleCount limit (Fill mode)
-				if (MaxParticleCount > 0 && Positions.Num() >= MaxParticleCount)
-				{
-					break;
-				}
-
-				FVector LocalPos(
-					LocalStart.X + x * AdjustedSpacing + RowOffsetX + ZLayerOffsetX,
-					LocalStart.Y + y * RowSpacingY + ZLayerOffsetY,
-					LocalStart.Z + z * LayerSpacingZ
-				);
-
-				// Check bounds
-				if (FMath::Abs(LocalPos.X) > HalfSize.X ||
-				    FMath::Abs(LocalPos.Y) > HalfSize.Y ||
-				    FMath::Abs(LocalPos.Z) > HalfSize.Z)
-				{
-					continue;
-				}
-
-				// Apply rotation to local position, then translate to world
-				FVector RotatedPos = Rotation.RotateVector(LocalPos);
-				FVector WorldPos = Center + RotatedPos;
-
-				// Apply jitter with distance-based falloff (center: 100%, surface: 0%)
-				// This prevents surface particles from protruding and causing jagged edges
-				if (bUseJitter && JitterRange > 0.0f)
-				{
-					// Calculate distance to nearest face
-					const float DistToSurfaceX = HalfSize.X - FMath::Abs(LocalPos.X);
-					const float DistToSurfaceY = HalfSize.Y - FMath::Abs(LocalPos.Y);
-					const float DistToSurfaceZ = HalfSize.Z - FMath::Abs(LocalPos.Z);
-					const float MinDistToSurface = FMath::Min3(DistToSurfaceX, DistToSurfaceY, DistToSurfaceZ);
-
-					// Falloff based on smallest half-size dimension
-					const float MaxDist = FMath::Min3(HalfSize.X, HalfSize.Y, HalfSize.Z);
-					const float JitterFactor = FMath::Clamp(MinDistToSurface / MaxDist, 0.0f, 1.0f);
-					const float ActualJitter = JitterRange * JitterFactor;
-
-					if (ActualJitter > 0.0f)
-					{
-						WorldPos += FVector(
-							FMath::FRandRange(-ActualJitter, ActualJitter),
-							FMath::FRandRange(-ActualJitter, ActualJitter),
-							FMath::FRandRange(-ActualJitter, ActualJitter)
-						);
-					}
-				}
-
-				Positions.Add(WorldPos);
-				Velocities.Add(InInitialVelocity);
-			}
-
-			// Break outer loop if limit reached
-			if (MaxParticleCount > 0 && Positions.Num() >= MaxParticleCount)
-			{
-				break;
-			}
-		}
-
-		if (MaxParticleCount > 0 && Positions.Num() >= MaxParticleCount)
-		{
-			break;
-		}
-	}
-
-	QueueSpawnRequest(Positions, Velocities);
-	return Positions.Num();
+	QueueSpawnRequests(SpawnRequestBuffer);
+	return Count;
 }
 
 /**
@@ -983,110 +797,17 @@ int32 UKawaiiFluidEmitterComponent::SpawnParticlesCubeHexagonal(FVector Center,
 int32 UKawaiiFluidEmitterComponent::SpawnParticlesCylinderHexagonal(FVector Center, FQuat Rotation, float Radius, float HalfHeight, float Spacing, FVector InInitialVelocity)
 {
 	AKawaiiFluidVolume* Volume = GetTargetVolume();
-	if (!Volume || Spacing <= 0.0f || Radius <= 0.0f || HalfHeight <= 0.0f) return 0;
+	if (!Volume) return 0;
 
-	TArray<FVector> Positions;
-	TArray<FVector> Velocities;
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Lattice = FKawaiiFluidSpawnLattice::GetTemplate(
+		EKawaiiFluidLatticeShape::Cylinder, Spacing, FKawaiiFluidSpawnLattice::CylinderDimensions(Radius, HalfHeight));
 
-	// HCP density compensation (matches KawaiiFluidSimulationModule exactly)
-	const float HCPCompensation = 1.122f;
-	const float AdjustedSpacing = Spacing * HCPCompensation;
+	SpawnRequestBuffer.Reset();
+	const int32 Count = FKawaiiFluidSpawnLattice::TransformToSpawnRequests(*Lattice, Center, Rotation,
+		bUseJitter ? JitterAmount : 0.0f, MaxParticleCount, InInitialVelocity, CachedSourceID, SpawnRequestBuffer);
 
-	// Hexagonal Close Packing constants
-	const float RowSpacingY = AdjustedSpacing * 0.866025f;   // sqrt(3)/2
-	const float LayerSpacingZ = AdjustedSpacing * 0.816497f; // sqrt(2/3)
-	const float JitterRange = AdjustedSpacing * JitterAmount;
-	const float RadiusSq = Radius * Radius;
-
-	// Integer-based grid (matches SimulationModule)
-	const int32 GridSizeXY = FMath::CeilToInt(Radius / AdjustedSpacing) + 1;
-	const int32 GridSizeY = FMath::CeilToInt(Radius / RowSpacingY) + 1;
-	const int32 GridSizeZ = FMath::CeilToInt(HalfHeight / LayerSpacingZ);
-
-	const float EstimatedCount = PI * Radius * Radius * HalfHeight * 2.0f / (AdjustedSpacing * AdjustedSpacing * AdjustedSpacing);
-	Positions.Reserve(FMath::CeilToInt(EstimatedCount));
-	Velocities.Reserve(FMath::CeilToInt(EstimatedCount));
-
-	for (int32 z = -GridSizeZ; z <= GridSizeZ; ++z)
-	{
-		// Z layer offset for HCP (ABC stacking pattern - mod 3)
-		const int32 ZMod = ((z + GridSizeZ) % 3);
-		const float ZLayerOffsetX = (ZMod == 1) ? AdjustedSpacing * 0.5f : ((ZMod == 2) ? AdjustedSpacing * 0.25f : 0.0f);
-		const float ZLayerOffsetY = (ZMod == 1) ? RowSpacingY / 3.0f : ((ZMod == 2) ? RowSpacingY * 2.0f / 3.0f : 0.0f);
-
-		for (int32 y = -GridSizeY; y <= GridSizeY; ++y)
-		{
-			const float RowOffsetX = (((y + GridSizeY) % 2) == 1) ? AdjustedSpacing * 0.5f : 0.0f;
-
-			for (int32 x = -GridSizeXY; x <= GridSizeXY; ++x)
-			{
-				// Check MaxParticleCount limit (Fill mode)
-				if (MaxParticleCount > 0 && Positions.Num() >= MaxParticleCount)
-				{
-					break;
-				}
-
-				FVector LocalPos(
-					x * AdjustedSpacing + RowOffsetX + ZLayerOffsetX,
-					y * RowSpacingY + ZLayerOffsetY,
-					z * LayerSpacingZ
-				);
-
-				// Check cylinder bounds (XY plane for radius, Z for height)
-				const float XYDistSq = LocalPos.X * LocalPos.X + LocalPos.Y * LocalPos.Y;
-				if (XYDistSq > RadiusSq || FMath::Abs(LocalPos.Z) > HalfHeight)
-				{
-					continue;
-				}
-
-				// Apply rotation to local position, then translate to world
-				FVector RotatedPos = Rotation.RotateVector(LocalPos);
-				FVector WorldPos = Center + RotatedPos;
-
-				// Apply jitter with distance-based falloff (center: 100%, surface: 0%)
-				// This prevents surface particles from protruding and causing jagged edges
-				if (bUseJitter && JitterRange > 0.0f)
-				{
-					// Calculate distance to nearest surface (radial or caps)
-					const float XYDist = FMath::Sqrt(XYDistSq);
-					const float DistToRadialSurface = Radius - XYDist;
-					const float DistToCapSurface = HalfHeight - FMath::Abs(LocalPos.Z);
-					const float MinDistToSurface = FMath::Min(DistToRadialSurface, DistToCapSurface);
-
-					// Falloff based on smaller dimension (radius or half-height)
-					const float MaxDist = FMath::Min(Radius, HalfHeight);
-					const float JitterFactor = FMath::Clamp(MinDistToSurface / MaxDist, 0.0f, 1.0f);
-					const float ActualJitter = JitterRange * JitterFactor;
-
-					if (ActualJitter > 0.0f)
-					{
-						WorldPos += FVector(
-							FMath::FRandRange(-ActualJitter, ActualJitter),
-							FMath::FRandRange(-ActualJitter, ActualJitter),
-							FMath::FRandRange(-ActualJitter, ActualJitter)
-						);
-					}
-				}
-
-				Positions.Add(WorldPos);
-				Velocities.Add(InInitialVelocity);
-			}
-			
-			// Break outer loop if limit reached
-			if (MaxParticleCount > 0 && Positions.Num() >= MaxParticleCount)
-			{
-				break;
-			}
-		}
-		
-		if (MaxParticleCount > 0 && Positions.Num() >= MaxParticleCount)
-		{
-			break;
-		}
-	}
-
-	QueueSpawnRequest(Positions, Velocities);
-	return Positions.Num();
+	QueueSpawnRequests(SpawnRequestBuffer);
+	return Count;
 }
 
 /**
@@ -1101,87 +822,12 @@ int32 UKawaiiFluidEmitterComponent::SpawnParticlesCylinderHexagonal(FVector Cent
 void UKawaiiFluidEmitterComponent::SpawnStreamLayer(FVector Position, FVector LayerDirection, FVector VelocityDirection, float Speed, float Radius, float Spacing)
 {
 	AKawaiiFluidVolume* Volume = GetTargetVolume();
-	if (!Volume || Spacing <= 0.0f || Radius <= 0.0f) return;
-
-	TArray<FVector> Positions;
-	TArray<FVector> Velocities;
-
-	// Use LayerDirection for particle placement (follows component rotation)
-	FVector Dir = LayerDirection.GetSafeNormal();
-	if (Dir.IsNearlyZero())
-	{
-		Dir = FVector(0, 0, -1);  // Default: downward
-	}
-
-	// Create local coordinate system for particle placement
-	FVector Right, Up;
-	Dir.FindBestAxisVectors(Right, Up);
-
-	// Calculate velocity (independent of layer direction in world space mode)
-	const FVector SpawnVel = VelocityDirection.GetSafeNormal() * Speed;
-
-	// NO HCP compensation for 2D hexagonal layer!
-	// This matches SimulationModule::SpawnParticleDirectionalHexLayerBatch exactly
-	const float RowSpacing = Spacing * FMath::Sqrt(3.0f) * 0.5f;  // ~0.866 * Spacing
-	const float RadiusSq = Radius * Radius;
-
-	// Jitter setup
-	const float Jitter = bUseStreamJitter ? FMath::Clamp(StreamJitterAmount, 0.0f, 0.5f) : 0.0f;
-	const float MaxJitterOffset = Spacing * Jitter;
-	const bool bApplyJitter = bUseStreamJitter && Jitter > KINDA_SMALL_NUMBER;
-
-	// Row count calculation (matches SimulationModule)
-	const int32 NumRows = FMath::CeilToInt(Radius / RowSpacing) * 2 + 1;
-	const int32 HalfRows = NumRows / 2;
-
-	// Estimate and reserve
-	const int32 EstimatedCount = FMath::CeilToInt((PI * RadiusSq) / (Spacing * Spacing));
-	Positions.Reserve(EstimatedCount);
-	Velocities.Reserve(EstimatedCount);
-
-	// Hexagonal grid iteration (matches SimulationModule exactly)
-	for (int32 RowIdx = -HalfRows; RowIdx <= HalfRows; ++RowIdx)
-	{
-		const float LocalY = RowIdx * RowSpacing;
-		const float LocalYSq = LocalY * LocalY;
-
-		// Skip rows outside the circle
-		if (LocalYSq > RadiusSq)
-		{
-			continue;
-		}
-
-		const float MaxX = FMath::Sqrt(RadiusSq - LocalYSq);
-
-		// Odd rows get X offset (Hexagonal Packing) - uses Abs like SimulationModule
-		const float XOffset = (FMath::Abs(RowIdx) % 2 != 0) ? Spacing * 0.5f : 0.0f;
-
-		// Calculate column count
-		const int32 NumCols = FMath::FloorToInt(MaxX / Spacing);
-
-		for (int32 ColIdx = -NumCols; ColIdx <= NumCols; ++ColIdx)
-		{
-			float LocalX = ColIdx * Spacing + XOffset;
-			float LocalYFinal = LocalY;
+	if (!Volume) return;
 
-			// Apply jitter
-			if (bApplyJitter)
-			{
-				LocalX += FMath::FRandRange(-MaxJitterOffset, MaxJitterOffset);
-				LocalYFinal += FMath::FRandRange(-MaxJitterOffset, MaxJitterOffset);
-			}
+	SpawnRequestBuffer.Reset();
+	SpawnStreamLayerBatch(Position, LayerDirection, VelocityDirection, Speed, Radius, Spacing, SpawnRequestBuffer);
 
-			// Check inside circle (after jitter)
-			if (LocalX * LocalX + LocalYFinal * LocalYFinal <= RadiusSq)
-			{
-				FVector SpawnPos = Position + Right * LocalX + Up * LocalYFinal;
-				Positions.Add(SpawnPos);
-				Velocities.Add(SpawnVel);
-			}
-		}
-	}
-
-	QueueSpawnRequest(Positions, Velocities);
+	QueueSpawnRequests(SpawnRequestBuffer);
 }
 
 /**
@@ -1192,92 +838,26 @@ void UKawaiiFluidEmitterComponent::SpawnStreamLayer(FVector Position, FVector La
  * @param Speed Speed
  * @param Radius Radius
  * @param Spacing Spacing
- * @param OutPositions Output position array
- * @param OutVelocities Output velocity array
+ * @param OutRequests Spawn requests are appended here
  */
-void UKawaiiFluidEmitterComponent::SpawnStreamLayerBatch(FVector Position, FVector LayerDirection, 
+void UKawaiiFluidEmitterComponent::SpawnStreamLayerBatch(FVector Position, FVector LayerDirection,
 	FVector VelocityDirection, float Speed, float Radius, float Spacing,
-	TArray<FVector>& OutPositions, TArray<FVector>& OutVelocities)
+	TArray<FGPUSpawnRequest>& OutRequests)
 {
-	if (Spacing <= 0.0f || Radius <= 0.0f) return;
+	// Layer placement follows LayerDirection; velocity is independent of it in world space mode
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Lattice = FKawaiiFluidSpawnLattice::GetTemplate(
+		EKawaiiFluidLatticeShape::StreamDisc, Spacing, FKawaiiFluidSpawnLattice::StreamDiscDimensions(Radius));
 
-	// Use LayerDirection for particle placement (follows component rotation)
-	FVector Dir = LayerDirection.GetSafeNormal();
-	if (Dir.IsNearlyZero())
-	{
-		Dir = FVector(0, 0, -1);  // Default: downward
-	}
-
-	// Create local coordinate system for particle placement
-	FVector Right, Up;
-	Dir.FindBestAxisVectors(Right, Up);
-
-	// Calculate velocity (independent of layer direction in world space mode)
+	const float Jitter = bUseStreamJitter ? StreamJitterAmount : 0.0f;
 	const FVector SpawnVel = VelocityDirection.GetSafeNormal() * Speed;
-
-	// NO HCP compensation for 2D hexagonal layer!
-	// This matches SimulationModule::SpawnParticleDirectionalHexLayerBatch exactly
-	const float RowSpacing = Spacing * FMath::Sqrt(3.0f) * 0.5f;  // ~0.866 * Spacing
-	const float RadiusSq = Radius * Radius;
-
-	// Jitter setup
-	const float Jitter = bUseStreamJitter ? FMath::Clamp(StreamJitterAmount, 0.0f, 0.5f) : 0.0f;
-	const float MaxJitterOffset = Spacing * Jitter;
-	const bool bApplyJitter = bUseStreamJitter && Jitter > KINDA_SMALL_NUMBER;
-
-	// Row count calculation (matches SimulationModule)
-	const int32 NumRows = FMath::CeilToInt(Radius / RowSpacing) * 2 + 1;
-	const int32 HalfRows = NumRows / 2;
-
-	// Hexagonal grid iteration (matches SimulationModule exactly)
-	for (int32 RowIdx = -HalfRows; RowIdx <= HalfRows; ++RowIdx)
-	{
-		const float LocalY = RowIdx * RowSpacing;
-		const float LocalYSq = LocalY * LocalY;
-
-		// Skip rows outside the circle
-		if (LocalYSq > RadiusSq)
-		{
-			continue;
-		}
-
-		const float MaxX = FMath::Sqrt(RadiusSq - LocalYSq);
-
-		// Odd rows get X offset (Hexagonal Packing) - uses Abs like SimulationModule
-		const float XOffset = (FMath::Abs(RowIdx) % 2 != 0) ? Spacing * 0.5f : 0.0f;
-
-		// Calculate column count
-		const int32 NumCols = FMath::FloorToInt(MaxX / Spacing);
-
-		for (int32 ColIdx = -NumCols; ColIdx <= NumCols; ++ColIdx)
-		{
-			float LocalX = ColIdx * Spacing + XOffset;
-			float LocalYFinal = LocalY;
-
-			// Apply jitter
-			if (bApplyJitter)
-			{
-				LocalX += FMath::FRandRange(-MaxJitterOffset, MaxJitterOffset);
-				LocalYFinal += FMath::FRandRange(-MaxJitterOffset, MaxJitterOffset);
-			}
-
-			// Check inside circle (after jitter)
-			if (LocalX * LocalX + LocalYFinal * LocalYFinal <= RadiusSq)
-			{
-				FVector SpawnPos = Position + Right * LocalX + Up * LocalYFinal;
-				OutPositions.Add(SpawnPos);
-				OutVelocities.Add(SpawnVel);
-			}
-		}
-	}
+	FKawaiiFluidSpawnLattice::TransformStreamLayerToSpawnRequests(*Lattice, Position, LayerDirection, Jitter, SpawnVel, CachedSourceID, OutRequests);
 }
 
 /**
  * @brief Queues spawn requests to the target volume.
- * @param Positions Array of particle positions
- * @param Velocities Array of particle velocities
+ * @param Requests Spawn requests (SourceID already set to CachedSourceID)
  */
-void UKawaiiFluidEmitterComponent::QueueSpawnRequest(const TArray<FVector>& Positions, const TArray<FVector>& Velocities)
+void UKawaiiFluidEmitterComponent::QueueSpawnRequests(const TArray<FGPUSpawnRequest>& Requests)
 {
 	if (!bEnabled)
 	{
@@ -1285,16 +865,15 @@ void UKawaiiFluidEmitterComponent::QueueSpawnRequest(const TArray<FVector>& Posi
 	}
 
 	AKawaiiFluidVolume* Volume = GetTargetVolume();
-	if (!Volume || Positions.Num() == 0)
+	if (!Volume || Requests.Num() == 0)
 	{
 		return;
 	}
 
-	// Use pre-allocated SourceID (from Subsystem, 0~63 range)
 	// Queue spawn requests to Volume's batch queue
-	Volume->QueueSpawnRequests(Positions, Velocities, CachedSourceID);
+	Volume->QueueSpawnRequests(Requests);
 
-	SpawnedParticleCount += Positions.Num();
+	SpawnedParticleCount += Requests.Num();
 
 	// Clear the "just cleared" flag now that spawning has started
 	// This re-enables normal limit checking once GPU readback updates
@@ -1325,7 +904,7 @@ void UKawaiiFluidEmitterComponent::ClearSpawnedParticles()
 	bJustCleared = true;  // Allow immediate re-spawn before GPU readback updates
 
 	// Clear any pending spawn requests for this emitter (prevents last-frame spawn leak)
-	// This clears Volume's PendingSpawnRequests queue
+	// This clears Volume's pending spawn request ring
 	if (TargetVolume && CachedSourceID >= 0)
 	{
 		TargetVolume->ClearPendingSpawnRequestsForSource(CachedSourceID);
@@ -10,6 +10,12 @@
 #include "Simulation/Physics/KawaiiFluidViscositySolver.h"
 #include "Simulation/Physics/KawaiiFluidAdhesionSolver.h"
 #include "Simulation/Physics/KawaiiFluidStackPressureSolver.h"
+#include "Simulation/Physics/KawaiiFluidNeighborForceSolver.h"
+#include "Simulation/Physics/KawaiiFluidIslandSolver.h"
+#include "Simulation/Physics/KawaiiFluidLODSolver.h"
+#include "Simulation/Physics/KawaiiFluidSurfaceClassifier.h"
+#include "Simulation/Utils/KawaiiFluidParticleSubset.h"
+#include "Simulation/Utils/KawaiiFluidMortonSort.h"
 #include "Simulation/Collision/KawaiiFluidCollider.h"
 #include "Simulation/Collision/KawaiiFluidMeshCollider.h"
 #include "Components/KawaiiFluidInteractionComponent.h"
@@ -27,6 +33,7 @@
 #include "Engine/World.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Simulation/Utils/KawaiiFluidLandscapeHeightmapExtractor.h"
+#include "Simulation/Utils/KawaiiFluidBoundaryPass.h"
 #include "LandscapeProxy.h"
 
 // Profiling
@@ -41,6 +48,8 @@ DECLARE_CYCLE_STAT(TEXT("Context FinalizePositions"), STAT_ContextFinalizePositi
 DECLARE_CYCLE_STAT(TEXT("Context ApplyViscosity"), STAT_ContextApplyViscosity, STATGROUP_KawaiiFluidContext);
 DECLARE_CYCLE_STAT(TEXT("Context ApplyAdhesion"), STAT_ContextApplyAdhesion, STATGROUP_KawaiiFluidContext);
 DECLARE_CYCLE_STAT(TEXT("Context ApplyCohesion"), STAT_ContextApplyCohesion, STATGROUP_KawaiiFluidContext);
+DECLARE_CYCLE_STAT(TEXT("Context ApplyStackPressure"), STAT_ContextApplyStackPressure, STATGROUP_KawaiiFluidContext);
+DECLARE_CYCLE_STAT(TEXT("Context Instrumentation"), STAT_ContextInstrumentation, STATGROUP_KawaiiFluidContext);
 
 //========================================
 // Auto-Scaling for SmoothingRadius Independence
@@ -326,6 +335,112 @@ namespace
 			AppendConvexToGPUPrimitives(ConvexElem, ComponentTransform, Friction, Restitution, OwnerID, OutPrimitives);
 		}
 	}
+
+	constexpr int32 ReductionChunkSize = 4096;
+
+	/**
+	 * @brief Parallel max reduction of particle speed (CFL condition).
+	 * @param Particles Particles to scan.
+	 * @return Largest velocity magnitude (cm/s).
+	 */
+	float ComputeMaxParticleSpeed(const TArray<FKawaiiFluidParticle>& Particles)
+	{
+		const int32 NumChunks = FMath::DivideAndRoundUp(Particles.Num(), ReductionChunkSize);
+		TArray<double, TInlineAllocator<64>> ChunkMaxSq;
+		ChunkMaxSq.SetNumZeroed(NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 End = FMath::Min((ChunkIndex + 1) * ReductionChunkSize, Particles.Num());
+			double MaxSq = 0.0;
+			for (int32 i = ChunkIndex * ReductionChunkSize; i < End; ++i)
+			{
+				MaxSq = FMath::Max(MaxSq, Particles[i].Velocity.SizeSquared());
+			}
+			ChunkMaxSq[ChunkIndex] = MaxSq;
+		}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		double MaxSq = 0.0;
+		for (const double ChunkValue : ChunkMaxSq)
+		{
+			MaxSq = FMath::Max(MaxSq, ChunkValue);
+		}
+		return static_cast<float>(FMath::Sqrt(MaxSq));
+	}
+
+	/**
+	 * @brief Parallel average/max of the compression error max(0, rho/rho0 - 1).
+	 *
+	 * Under-dense surface particles are not counted as error, otherwise a free surface would never converge.
+	 *
+	 * @param Densities Densities of the solved particles at their current predicted positions.
+	 * @param InvRestDensity 1 / rest density.
+	 * @param OutAvgError Average compression error (fraction).
+	 * @param OutMaxError Largest compression error (fraction).
+	 */
+	void ComputeCompressionError(TConstArrayView<float> Densities, float InvRestDensity, float& OutAvgError, float& OutMaxError)
+	{
+		const int32 NumChunks = FMath::DivideAndRoundUp(Densities.Num(), ReductionChunkSize);
+		TArray<double, TInlineAllocator<64>> ChunkSum;
+		TArray<float, TInlineAllocator<64>> ChunkMax;
+		ChunkSum.SetNumZeroed(NumChunks);
+		ChunkMax.SetNumZeroed(NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 End = FMath::Min((ChunkIndex + 1) * ReductionChunkSize, Densities.Num());
+			double Sum = 0.0;
+			float MaxError = 0.0f;
+			for (int32 i = ChunkIndex * ReductionChunkSize; i < End; ++i)
+			{
+				const float Error = FMath::Max(0.0f, Densities[i] * InvRestDensity - 1.0f);
+				Sum += Error;
+				MaxError = FMath::Max(MaxError, Error);
+			}
+			ChunkSum[ChunkIndex] = Sum;
+			ChunkMax[ChunkIndex] = MaxError;
+		}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		double Sum = 0.0;
+		OutMaxError = 0.0f;
+		for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+		{
+			Sum += ChunkSum[ChunkIndex];
+			OutMaxError = FMath::Max(OutMaxError, ChunkMax[ChunkIndex]);
+		}
+		OutAvgError = Densities.Num() > 0 ? static_cast<float>(Sum / Densities.Num()) : 0.0f;
+	}
+
+	/**
+	 * @brief Parallel average of the absolute density deviation |rho/rho0 - 1| over every solved particle.
+	 * @param Densities Densities of the solved particles at their current predicted positions.
+	 * @param InvRestDensity 1 / rest density.
+	 * @return Average deviation (fraction).
+	 */
+	float ComputeAverageDensityDeviation(TConstArrayView<float> Densities, float InvRestDensity)
+	{
+		const int32 NumChunks = FMath::DivideAndRoundUp(Densities.Num(), ReductionChunkSize);
+		TArray<double, TInlineAllocator<64>> ChunkSum;
+		ChunkSum.SetNumZeroed(NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 End = FMath::Min((ChunkIndex + 1) * ReductionChunkSize, Densities.Num());
+			double Sum = 0.0;
+			for (int32 i = ChunkIndex * ReductionChunkSize; i < End; ++i)
+			{
+				Sum += FMath::Abs(Densities[i] * InvRestDensity - 1.0f);
+			}
+			ChunkSum[ChunkIndex] = Sum;
+		}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		double Sum = 0.0;
+		for (const double ChunkValue : ChunkSum)
+		{
+			Sum += ChunkValue;
+		}
+		return Densities.Num() > 0 ? static_cast<float>(Sum / Densities.Num()) : 0.0f;
+	}
 }
 
 /**
@@ -364,6 +479,13 @@ void UKawaiiFluidSimulationContext::InitializeSolvers(const UKawaiiFluidPresetDa
 	ViscositySolver = MakeShared<FKawaiiFluidViscositySolver>();
 	AdhesionSolver = MakeShared<FKawaiiFluidAdhesionSolver>();
 	StackPressureSolver = MakeShared<FKawaiiFluidStackPressureSolver>();
+	NeighborForceSolver = MakeShared<FKawaiiFluidNeighborForceSolver>();
+	IslandSolver = MakeShared<FKawaiiFluidIslandSolver>();
+	LODSolver = MakeShared<FKawaiiFluidLODSolver>();
+	SurfaceClassifier = MakeShared<FKawaiiFluidSurfaceClassifier>();
+	SolveSubset = MakeShared<FKawaiiFluidParticleSubset>();
+	MortonSorter = MakeShared<FKawaiiFluidMortonSorter>();
+	FramesSinceZOrderSort = 0;
 
 	bSolversInitialized = true;
 }
@@ -380,6 +502,41 @@ void UKawaiiFluidSimulationContext::EnsureSolversInitialized(const UKawaiiFluidP
 	}
 }
 
+/**
+ * @brief Reorder the particle array by hybrid tiled Morton key (the GPU Z-order layout) and remap cached neighbor indices.
+ * @param Particles In/Out particle array.
+ * @param CellSize Key cell size (the spatial hash cell size).
+ */
+void UKawaiiFluidSimulationContext::SortParticlesZOrder(TArray<FKawaiiFluidParticle>& Particles, float CellSize)
+{
+	FKawaiiFluidMortonKeyLayout Layout;
+	Layout.bHybridTiled = true;
+	Layout.CellSize = CellSize;
+
+	MortonSorter->Sort(Particles.Num(), Layout,
+		[&Particles](int32 Index) { return FVector3f(Particles[Index].Position); });
+	if (MortonSorter->GetNumMoved() == 0)
+	{
+		return;
+	}
+
+	MortonSorter->Reorder(Particles, ZOrderScratch);
+
+	// Cached neighbor lists follow their particles until UpdateNeighbors rebuilds them
+	const FKawaiiFluidMortonSorter& Sorter = *MortonSorter;
+	const int32 NumParticles = Particles.Num();
+	ParallelFor(NumParticles, [&Particles, &Sorter, NumParticles](int32 i)
+	{
+		for (int32& NeighborIndex : Particles[i].NeighborIndices)
+		{
+			if (NeighborIndex >= 0 && NeighborIndex < NumParticles)
+			{
+				NeighborIndex = Sorter.GetNewIndex(NeighborIndex);
+			}
+		}
+	}, NumParticles < FKawaiiFluidMortonSorter::ChunkSize ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
 //=============================================================================
 // GPU Simulation Methods
 //=============================================================================
@@ -1257,6 +1414,404 @@ void UKawaiiFluidSimulationContext::Simulate(
 	SimulateGPU(Particles, Preset, Params, SpatialHash, DeltaTime, AccumulatedTime);
 }
 
+/**
+ * @brief CPU solver entry point (editor preview and tooling), fixed-step like the GPU path.
+ *
+ * Runs SimulateSubstep on the caller-owned particle array and confines the result to
+ * Params.WorldBounds when it is valid. The last substep of the frame fuses containment
+ * with the particle AABB reduction (see GetLastParticleBounds).
+ *
+ * With preset sleeping enabled, islands are detected once per frame from the neighbor lists of the
+ * previous frame and only the awake particles are gathered into the substeps; sleeping islands are
+ * not touched at all, and a fully asleep scene skips island detection too.
+ *
+ * With preset LOD enabled and view locations in Params, every grid cell gets a tier from its
+ * distance to the nearest view: near cells run the full substeps, far cells run coarse substeps
+ * with fewer solver iterations, frozen cells are not simulated. Tiers are solved separately, each
+ * seeing the adjacent particles of the other tiers (and of sleeping islands) as read-only neighbors
+ * for density and collision, so a body of fluid stays continuous across a tier seam.
+ *
+ * @param Particles In/Out particle array.
+ * @param Preset Read-only preset data asset.
+ * @param Params Simulation parameters for the current frame.
+ * @param SpatialHash Spatial hash for neighbor finding.
+ * @param DeltaTime Frame delta time.
+ * @param AccumulatedTime In/Out accumulated time for fixed-step simulation.
+ */
+void UKawaiiFluidSimulationContext::SimulateCPU(
+	TArray<FKawaiiFluidParticle>& Particles,
+	const UKawaiiFluidPresetDataAsset* Preset,
+	const FKawaiiFluidSimulationParams& Params,
+	FKawaiiFluidSpatialHash& SpatialHash,
+	float DeltaTime,
+	float& AccumulatedTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ContextSimulate);
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_SimulateCPU);
+
+	if (!Preset || Preset->SubstepDeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	EnsureSolversInitialized(Preset);
+
+	const int32 MaxSubstepsPerFrame = Preset->MaxSubsteps;
+	const float MaxAllowedTime = Preset->SubstepDeltaTime * MaxSubstepsPerFrame;
+	AccumulatedTime += FMath::Min(DeltaTime, MaxAllowedTime);
+
+	// Adaptive substepping consumes the whole accumulated time with CFL-sized substeps,
+	// fixed substepping consumes whole SubstepDeltaTime steps and carries the remainder
+	const bool bAdaptive = Preset->bEnableAdaptiveSubstepping;
+	const int32 TotalSubsteps = bAdaptive ? 0 : FMath::Min(
+		FMath::FloorToInt(AccumulatedTime / Preset->SubstepDeltaTime),
+		MaxSubstepsPerFrame
+	);
+	const float FrameSimTime = bAdaptive ? AccumulatedTime : Preset->SubstepDeltaTime * TotalSubsteps;
+	const bool bHasWork = FrameSimTime > 0.0f;
+
+	LastAdaptiveStepStats.Reset();
+	TierSolverIterations = 0;
+
+	// The stats frame opens in CollectSimulationStats, so substep samples are buffered until then
+	FrameSubstepTimings.Reset();
+	FrameIterationErrors.Reset();
+
+	// Z-order re-sort: particles of one cell stay adjacent in memory as the fluid mixes
+	if (MortonSorter.IsValid() && bHasWork && Preset->CPUZOrderSortInterval > 0 && Particles.Num() > 0
+		&& ++FramesSinceZOrderSort >= Preset->CPUZOrderSortInterval)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_ZOrderSort);
+		SortParticlesZOrder(Particles, Preset->SmoothingRadius);
+		FramesSinceZOrderSort = 0;
+
+		if (IslandSolver.IsValid())
+		{
+			IslandSolver->InvalidateIslands();
+		}
+	}
+
+	// Island sleeping: sleeping islands are left out of the substeps
+	if (IslandSolver.IsValid() && bHasWork && Particles.Num() > 0)
+	{
+		if (Preset->bEnableParticleSleeping)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_IslandSleeping);
+
+			// Islands reuse the neighbor lists of the last substeps; removals shift indices under sleeping lists
+			if (IslandSolver->NeedsNeighborRebuild(Particles.Num()))
+			{
+				UpdateNeighbors(Particles, SpatialHash, Preset->SmoothingRadius);
+			}
+			IslandSolver->Update(Particles, Params.Colliders, Preset->SleepVelocityThreshold, Preset->SleepFrameThreshold, Preset->SmoothingRadius);
+		}
+		else if (IslandSolver->HasSleepingParticles())
+		{
+			IslandSolver->WakeAll(Particles);
+		}
+	}
+
+	// Simulation LOD: grid cells far from every view run coarser, very far cells are frozen
+	bool bUseLOD = false;
+	if (LODSolver.IsValid() && bHasWork)
+	{
+		if (Preset->bEnableSimulationLOD && Params.LODViewLocations.Num() > 0)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_SimulationLOD);
+			bUseLOD = LODSolver->Update(Particles, Params.LODViewLocations, SpatialHash.GetCellSize(),
+				Preset->LODFarDistance, Preset->LODFrozenDistance, Preset->LODHysteresis);
+		}
+		else
+		{
+			LODSolver->Reset();
+		}
+	}
+
+	const bool bHasSleeping = IslandSolver.IsValid() && IslandSolver->HasSleepingParticles();
+
+	const FKawaiiFluidBoundaryBox BoundaryBox = FKawaiiFluidBoundaryBox::FromAABB(
+		Params.WorldBounds, Params.ParticleRadius, Preset->Bounciness, Preset->Friction);
+	const float InvRestDensity = Preset->Density > 0.001f ? 1.0f / Preset->Density : 0.0f;
+
+	// Frame statistics are filled by the final bounds sweep instead of a separate pass over the particles
+	FKawaiiFluidStatsAccumulator FrameStatsAccumulator;
+	FKawaiiFluidStatsAccumulator* FrameStats = GetFluidStatsCollector().IsEnabled() ? &FrameStatsAccumulator : nullptr;
+
+	auto RunNearSubsteps = [&](TArray<FKawaiiFluidParticle>& Target, bool bReduceBounds, FKawaiiFluidStatsAccumulator* OutStats)
+	{
+		if (bAdaptive)
+		{
+			return RunAdaptiveSubstepsCPU(Target, Preset, Params, SpatialHash, BoundaryBox, FrameSimTime, bReduceBounds, OutStats);
+		}
+
+		for (int32 Substep = 0; Substep < TotalSubsteps; ++Substep)
+		{
+			LastAdaptiveStepStats.AddSubstep(Preset->SubstepDeltaTime);
+		}
+		return RunSubstepsCPU(Target, Preset, Params, SpatialHash, BoundaryBox, TotalSubsteps, Preset->SubstepDeltaTime, bReduceBounds, OutStats);
+	};
+
+	bool bBoundsReduced = false;
+	const uint64 NearStartCycles = FPlatformTime::Cycles64();
+
+	if (!bHasSleeping && !bUseLOD)
+	{
+		bBoundsReduced = RunNearSubsteps(Particles, true, FrameStats);
+	}
+	else
+	{
+		// Near tier (or every awake particle without LOD): full substeps
+		TArray<FKawaiiFluidParticle>& NearParticles = SolveSubset->Gather(Particles,
+			[this, bUseLOD](const FKawaiiFluidParticle& P, int32 Index)
+			{
+				return !P.bIsSleeping && (!bUseLOD || LODSolver->GetParticleTier(Index) == EKawaiiFluidLODTier::Near);
+			});
+		SolveSubset->GatherReadOnlyNeighbors(Particles, Preset->SmoothingRadius);
+
+		TGuardValue<bool> SubsetGuard(bSolvingSubset, true);
+		RunNearSubsteps(NearParticles, false, nullptr);
+		SolveSubset->Scatter(Particles);
+	}
+
+	if (bUseLOD)
+	{
+		LODSolver->SetTierTiming(EKawaiiFluidLODTier::Near, LastAdaptiveStepStats.NumSubsteps,
+			FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - NearStartCycles));
+
+		// Far tier: one coarse substep per stride on its own clock, fewer solver iterations
+		const int32 Stride = FMath::Max(1, Preset->LODFarSubstepStride);
+		const float FarSubstepDT = Preset->SubstepDeltaTime * Stride;
+		const int32 FarSubsteps = LODSolver->AdvanceFarClock(
+			FrameSimTime, FarSubstepDT, FMath::DivideAndRoundUp(MaxSubstepsPerFrame, Stride));
+
+		const uint64 FarStartCycles = FPlatformTime::Cycles64();
+		if (FarSubsteps > 0 && LODSolver->GetTierStats(EKawaiiFluidLODTier::Far).NumParticles > 0)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_FarTier);
+			TGuardValue<int32> IterationsGuard(SolverIterationsOverride, FMath::Min(Preset->LODFarSolverIterations, Preset->SolverIterations));
+			TierSolverIterations = 0;
+
+			TArray<FKawaiiFluidParticle>& FarParticles = SolveSubset->Gather(Particles,
+				[this](const FKawaiiFluidParticle& P, int32 Index)
+				{
+					return !P.bIsSleeping && LODSolver->GetParticleTier(Index) == EKawaiiFluidLODTier::Far;
+				});
+			SolveSubset->GatherReadOnlyNeighbors(Particles, Preset->SmoothingRadius);
+
+			TGuardValue<bool> SubsetGuard(bSolvingSubset, true);
+			RunSubstepsCPU(FarParticles, Preset, Params, SpatialHash, BoundaryBox, FarSubsteps, FarSubstepDT, false);
+			SolveSubset->Scatter(Particles);
+		}
+		LODSolver->SetTierTiming(EKawaiiFluidLODTier::Far, FarSubsteps,
+			FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FarStartCycles));
+	}
+
+	AccumulatedTime -= FrameSimTime;
+
+	// Surface classification: flags, normals and a compact surface list for downstream consumers
+	if (SurfaceClassifier.IsValid())
+	{
+		if (Preset->bEnableSurfaceClassification && Particles.Num() > 0)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_SurfaceClassification);
+
+			// Partitioned substeps only saw their subset, and frames without substeps may have spawned or removed particles
+			if (!bHasWork || bHasSleeping || bUseLOD)
+			{
+				UpdateNeighbors(Particles, SpatialHash, Preset->SmoothingRadius);
+			}
+
+			FKawaiiFluidSurfaceParams SurfaceParams;
+			SurfaceParams.SmoothingRadius = Preset->SmoothingRadius;
+			SurfaceParams.GradientThreshold = Preset->SurfaceGradientThreshold;
+			SurfaceParams.NeighborDeficiency = Preset->SurfaceNeighborDeficiency;
+			SurfaceParams.ExitRatio = Preset->SurfaceExitRatio;
+			SurfaceParams.NormalSmoothing = Preset->SurfaceNormalSmoothing;
+			SurfaceClassifier->Classify(Particles, SurfaceParams);
+		}
+		else
+		{
+			SurfaceClassifier->Reset();
+		}
+	}
+
+	// No fused pass ran over the full array this frame (no substep, no bounds, no particles, or a partitioned frame).
+	// Runs after surface classification so the statistics see the neighbor lists it may have rebuilt.
+	if (!bBoundsReduced)
+	{
+		FrameStatsAccumulator.Reset();
+		LastParticleBounds = FKawaiiFluidBoundaryPass::ComputeBounds(Particles, FrameStats, InvRestDensity);
+	}
+
+	CollectSimulationStats(FrameStatsAccumulator, Particles.Num(), Preset, LastAdaptiveStepStats.NumSubsteps, false);
+}
+
+/**
+ * @brief Run a fixed number of CPU substeps on one particle array, each followed by boundary containment.
+ * @param Particles In/Out particles to simulate (full array or a gathered subset).
+ * @param Preset Read-only preset data asset.
+ * @param Params Simulation parameters for the current frame.
+ * @param SpatialHash Spatial hash for neighbor finding.
+ * @param BoundaryBox Containment box built from Params.WorldBounds.
+ * @param NumSubsteps Number of substeps to run.
+ * @param SubstepDT Time step of each substep.
+ * @param bReduceBounds Fuse the last containment pass with the particle AABB reduction (full array only).
+ * @param FrameStats Frame statistics filled by the fused pass (nullptr = not collected).
+ * @return True if LastParticleBounds was updated by the fused pass.
+ */
+bool UKawaiiFluidSimulationContext::RunSubstepsCPU(
+	TArray<FKawaiiFluidParticle>& Particles,
+	const UKawaiiFluidPresetDataAsset* Preset,
+	const FKawaiiFluidSimulationParams& Params,
+	FKawaiiFluidSpatialHash& SpatialHash,
+	const FKawaiiFluidBoundaryBox& BoundaryBox,
+	int32 NumSubsteps,
+	float SubstepDT,
+	bool bReduceBounds,
+	FKawaiiFluidStatsAccumulator* FrameStats)
+{
+	if (Particles.Num() == 0)
+	{
+		return false;
+	}
+
+	bool bBoundsReduced = false;
+	for (int32 Substep = 0; Substep < NumSubsteps; ++Substep)
+	{
+		SimulateSubstep(Particles, Preset, Params, SpatialHash, SubstepDT);
+
+		if (Params.WorldBounds.IsValid)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_BoundaryPass);
+			if (bReduceBounds && Substep == NumSubsteps - 1)
+			{
+				LastParticleBounds = FKawaiiFluidBoundaryPass::ResolveAndComputeBounds(Particles, BoundaryBox, FrameStats,
+					Preset->Density > 0.001f ? 1.0f / Preset->Density : 0.0f);
+				bBoundsReduced = true;
+			}
+			else
+			{
+				FKawaiiFluidBoundaryPass::Resolve(Particles, BoundaryBox);
+			}
+		}
+	}
+	return bBoundsReduced;
+}
+
+/**
+ * @brief Run CFL-sized CPU substeps until the frame time is consumed or the substep ceiling is hit.
+ *
+ * Each substep is the largest step in which the fastest particle (plus one step of gravity) moves
+ * at most CFLNumber * SmoothingRadius, capped by MaxAdaptiveSubstepDeltaTime. The remainder is split
+ * evenly over the last two substeps instead of ending on a sliver. Time left when MaxAdaptiveSubsteps
+ * is reached is dropped (slow motion) rather than taken in unstable steps.
+ *
+ * @param Particles In/Out particles to simulate (full array or a gathered subset).
+ * @param Preset Read-only preset data asset.
+ * @param Params Simulation parameters for the current frame.
+ * @param SpatialHash Spatial hash for neighbor finding.
+ * @param BoundaryBox Containment box built from Params.WorldBounds.
+ * @param FrameTime Simulation time to consume (s).
+ * @param bReduceBounds Fuse the last containment pass with the particle AABB reduction (full array only).
+ * @param FrameStats Frame statistics filled by the fused pass (nullptr = not collected).
+ * @return True if LastParticleBounds was updated by the fused pass.
+ */
+bool UKawaiiFluidSimulationContext::RunAdaptiveSubstepsCPU(
+	TArray<FKawaiiFluidParticle>& Particles,
+	const UKawaiiFluidPresetDataAsset* Preset,
+	const FKawaiiFluidSimulationParams& Params,
+	FKawaiiFluidSpatialHash& SpatialHash,
+	const FKawaiiFluidBoundaryBox& BoundaryBox,
+	float FrameTime,
+	bool bReduceBounds,
+	FKawaiiFluidStatsAccumulator* FrameStats)
+{
+	if (Particles.Num() == 0 || FrameTime <= 0.0f)
+	{
+		return false;
+	}
+
+	const float MaxStepDT = FMath::Max(Preset->MaxAdaptiveSubstepDeltaTime, UE_KINDA_SMALL_NUMBER);
+	const float MaxTravel = Preset->CFLNumber * Preset->SmoothingRadius;
+	const float GravityKick = static_cast<float>(Preset->Gravity.Size()) * MaxStepDT;
+	const int32 MaxSteps = FMath::Max(1, Preset->MaxAdaptiveSubsteps);
+
+	bool bBoundsReduced = false;
+	float Remaining = FrameTime;
+
+	while (Remaining > UE_KINDA_SMALL_NUMBER && LastAdaptiveStepStats.NumSubsteps < MaxSteps)
+	{
+		const float MaxSpeed = ComputeMaxParticleSpeed(Particles);
+		LastAdaptiveStepStats.MaxSpeed = FMath::Max(LastAdaptiveStepStats.MaxSpeed, MaxSpeed);
+
+		float StepDT = MaxStepDT;
+		if (MaxSpeed + GravityKick > UE_KINDA_SMALL_NUMBER)
+		{
+			StepDT = FMath::Min(StepDT, MaxTravel / (MaxSpeed + GravityKick));
+		}
+
+		if (Remaining <= StepDT)
+		{
+			StepDT = Remaining;
+		}
+		else if (Remaining < StepDT * 2.0f)
+		{
+			StepDT = Remaining * 0.5f;
+		}
+
+		const bool bLastStep = Remaining - StepDT <= UE_KINDA_SMALL_NUMBER || LastAdaptiveStepStats.NumSubsteps + 1 == MaxSteps;
+
+		SimulateSubstep(Particles, Preset, Params, SpatialHash, StepDT);
+
+		if (Params.WorldBounds.IsValid)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_BoundaryPass);
+			if (bReduceBounds && bLastStep)
+			{
+				LastParticleBounds = FKawaiiFluidBoundaryPass::ResolveAndComputeBounds(Particles, BoundaryBox, FrameStats,
+					Preset->Density > 0.001f ? 1.0f / Preset->Density : 0.0f);
+				bBoundsReduced = true;
+			}
+			else
+			{
+				FKawaiiFluidBoundaryPass::Resolve(Particles, BoundaryBox);
+			}
+		}
+
+		LastAdaptiveStepStats.AddSubstep(StepDT);
+		Remaining -= StepDT;
+	}
+
+	if (Remaining > UE_KINDA_SMALL_NUMBER)
+	{
+		LastAdaptiveStepStats.DroppedTime += Remaining;
+	}
+
+	return bBoundsReduced;
+}
+
+/**
+ * @brief Confine particles to an axis-aligned box.
+ *
+ * Clamps each axis, reflects the normal velocity with the bounciness and damps the
+ * tangential velocity with the friction (same response as the volume boundary pass).
+ *
+ * @param Particles Particle array to confine.
+ * @param Bounds Container box (cm).
+ * @param ParticleRadius Particle radius (cm).
+ * @param Bounciness Wall restitution.
+ * @param Friction Wall friction.
+ */
+void UKawaiiFluidSimulationContext::ApplyBoundsContainment(
+	TArray<FKawaiiFluidParticle>& Particles,
+	const FBox& Bounds,
+	float ParticleRadius,
+	float Bounciness,
+	float Friction)
+{
+	FKawaiiFluidBoundaryPass::Resolve(Particles, FKawaiiFluidBoundaryBox::FromAABB(Bounds, ParticleRadius, Bounciness, Friction));
+}
+
 /**
  * @brief Perform a single substep of the simulation.
  * @param Particles In/Out particle array.
@@ -1274,12 +1829,30 @@ void UKawaiiFluidSimulationContext::SimulateSubstep(
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_SimulateSubstep);
 
+	// Per-stage wall-clock timings (cheap enough to always record, read by benchmarks)
+	LastSubstepTimings.Reset();
+	const uint64 SubstepStartCycles = FPlatformTime::Cycles64();
+	uint64 StageStartCycles = SubstepStartCycles;
+	auto EndStage = [&StageStartCycles](double& OutStageMs)
+	{
+		const uint64 NowCycles = FPlatformTime::Cycles64();
+		OutStageMs = FPlatformTime::ToMilliseconds64(NowCycles - StageStartCycles);
+		StageStartCycles = NowCycles;
+	};
+
 	// 1. Predict positions
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ContextPredictPositions);
 		TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_PredictPositions);
 		PredictPositions(Particles, Preset, Params.ExternalForce, SubstepDT);
+
+		// Read-only neighbors of another tier (or a sleeping island) hold still in this subset
+		if (bSolvingSubset)
+		{
+			SolveSubset->PinReadOnlyNeighbors(Particles);
+		}
 	}
+	EndStage(LastSubstepTimings.PredictMs);
 
 	// 2. Update neighbors
 	{
@@ -1287,6 +1860,7 @@ void UKawaiiFluidSimulationContext::SimulateSubstep(
 		TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidContext_UpdateNeighbors);
 		UpdateNeighbors(Particles, SpatialHash, Preset->SmoothingRadius);
 	}
+	EndStage(LastSubstepTimings.NeighborsMs);
 
 	// 3. Solve density constraints
 	{
@@ -1295,61 +1869,123 @@ void UKawaiiFluidSimulationContext::SimulateSubstep(
 
 		SolveDensityConstraints(Particles, Preset, SubstepDT);
 	}
+	EndStage(LastSubstepTimings.DensityMs);
 
 	// 4. Handle collisions
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ContextHandleCollisions);
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(KawaiiFluidContext_HandleCollisions, KawaiiFluidChannel);
 		HandleCollisions(Particles, Params.Colliders, SubstepDT);
 	}
+	EndStage(LastSubstepTimings.CollisionMs);
 
 	// 5. World collision
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ContextWorldCollision);
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(KawaiiFluidContext_WorldCollision, KawaiiFluidChannel);
 		if (Params.bUseWorldCollision && Params.World)
 		{
 			HandleWorldCollision(Particles, Params, SpatialHash, Params.ParticleRadius, SubstepDT, Preset->Friction, Preset->Bounciness);
 		}
 	}
+	EndStage(LastSubstepTimings.WorldCollisionMs);
 
 	// 6. Finalize positions
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ContextFinalizePositions);
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(KawaiiFluidContext_FinalizePositions, KawaiiFluidChannel);
 		FinalizePositions(Particles, SubstepDT);
-	}
 
-	// 7. Apply viscosity
-	{
-		SCOPE_CYCLE_COUNTER(STAT_ContextApplyViscosity);
-		ApplyViscosity(Particles, Preset);
+		// Neighbor force passes read the real velocities of the read-only neighbors
+		if (bSolvingSubset)
+		{
+			SolveSubset->PinReadOnlyNeighbors(Particles);
+		}
 	}
+	EndStage(LastSubstepTimings.FinalizeMs);
 
-	// 8. Apply adhesion
+	// 7-10. Viscosity, adhesion, cohesion and stack pressure
+	if (Preset->bFuseNeighborForcePasses && NeighborForceSolver.IsValid())
 	{
-		SCOPE_CYCLE_COUNTER(STAT_ContextApplyAdhesion);
-		ApplyAdhesion(Particles, Preset, Params.Colliders);
-	}
+		// Viscosity, cohesion and stack pressure in one neighbor sweep (timed as the viscosity stage)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_ContextApplyViscosity);
+			TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(KawaiiFluidContext_ApplyNeighborForces, KawaiiFluidChannel);
 
-	// 9. Apply cohesion (surface tension between particles)
-	{
-		SCOPE_CYCLE_COUNTER(STAT_ContextApplyCohesion);
-		ApplyCohesion(Particles, Preset);
-	}
+			FKawaiiFluidNeighborForceParams NeighborParams;
+			NeighborParams.SmoothingRadius = Preset->SmoothingRadius;
+			NeighborParams.ViscosityCoeff = Preset->Viscosity;
+			NeighborParams.CohesionStrength = Preset->SurfaceTension;
+			NeighborParams.bStackPressure = Preset->bEnableStackPressure;
+			NeighborParams.Gravity = Preset->Gravity;
+			NeighborParams.StackPressureScale = Preset->StackPressureScale;
+			NeighborParams.StackPressureRadius = Preset->StackPressureRadius > 0.0f ? Preset->StackPressureRadius : Preset->SmoothingRadius;
+			NeighborParams.DeltaTime = SubstepDT;
 
-	// 10. Apply stack pressure (weight transfer from stacked attached particles)
-	if (Preset->bEnableStackPressure && StackPressureSolver.IsValid())
+			NeighborForceSolver->Apply(Particles, NeighborParams, Preset->bSymmetricNeighborPairs);
+		}
+		EndStage(LastSubstepTimings.ViscosityMs);
+
+		// Adhesion does not touch positions or neighbor terms, so it can follow the fused sweep
+		{
+			SCOPE_CYCLE_COUNTER(STAT_ContextApplyAdhesion);
+			TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(KawaiiFluidContext_ApplyAdhesion, KawaiiFluidChannel);
+			ApplyAdhesion(Particles, Preset, Params.Colliders);
+		}
+		EndStage(LastSubstepTimings.AdhesionMs);
+	}
+	else
 	{
-		float SearchRadius = Preset->StackPressureRadius > 0.0f
-			? Preset->StackPressureRadius
-			: Preset->SmoothingRadius;
+		// 7. Apply viscosity
+		{
+			SCOPE_CYCLE_COUNTER(STAT_ContextApplyViscosity);
+			TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(KawaiiFluidContext_ApplyViscosity, KawaiiFluidChannel);
+			ApplyViscosity(Particles, Preset);
+		}
+		EndStage(LastSubstepTimings.ViscosityMs);
 
-		StackPressureSolver->Apply(
-			Particles,
-			Preset->Gravity,
-			Preset->StackPressureScale,
-			SearchRadius,
-			SubstepDT
-		);
+		// 8. Apply adhesion
+		{
+			SCOPE_CYCLE_COUNTER(STAT_ContextApplyAdhesion);
+			TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(KawaiiFluidContext_ApplyAdhesion, KawaiiFluidChannel);
+			ApplyAdhesion(Particles, Preset, Params.Colliders);
+		}
+		EndStage(LastSubstepTimings.AdhesionMs);
+
+		// 9. Apply cohesion (surface tension between particles)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_ContextApplyCohesion);
+			TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(KawaiiFluidContext_ApplyCohesion, KawaiiFluidChannel);
+			ApplyCohesion(Particles, Preset);
+		}
+		EndStage(LastSubstepTimings.CohesionMs);
+
+		// 10. Apply stack pressure (weight transfer from stacked attached particles)
+		if (Preset->bEnableStackPressure && StackPressureSolver.IsValid())
+		{
+			SCOPE_CYCLE_COUNTER(STAT_ContextApplyStackPressure);
+			TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(KawaiiFluidContext_ApplyStackPressure, KawaiiFluidChannel);
+
+			float SearchRadius = Preset->StackPressureRadius > 0.0f
+				? Preset->StackPressureRadius
+				: Preset->SmoothingRadius;
+
+			StackPressureSolver->Apply(
+				Particles,
+				Preset->Gravity,
+				Preset->StackPressureScale,
+				SearchRadius,
+				SubstepDT
+			);
+		}
+		EndStage(LastSubstepTimings.StackPressureMs);
 	}
+
+	LastSubstepTimings.TotalMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SubstepStartCycles);
+
+	// Insights counters per substep; stat timings are summed and published with the frame's stats
+	FKawaiiFluidSimulationStatsCollector::TraceSubstepTimings(LastSubstepTimings);
+	FrameSubstepTimings += LastSubstepTimings;
 }
 
 /**
@@ -1489,8 +2125,11 @@ void UKawaiiFluidSimulationContext::SolveDensityConstraints(
 		return;
 	}
 
+	// Read-only neighbors after the solved particles keep their positions and Lambda
+	const int32 NumSolved = bSolvingSubset ? SolveSubset->GetNumSolved() : Particles.Num();
+
 	// XPBD: Initialize Lambda (reset to 0 at start of each timestep)
-	ParallelFor(Particles.Num(), [&](int32 i)
+	ParallelFor(NumSolved, [&](int32 i)
 	{
 		Particles[i].Lambda = 0.0f;
 	});
@@ -1506,39 +2145,81 @@ void UKawaiiFluidSimulationContext::SolveDensityConstraints(
 	const float ScaledCompliance = SPHScaling::GetScaledCompliance(
 		Preset->Compressibility, Preset->SmoothingRadius, Preset->ComplianceExponent);
 
+	// Per-iteration density error tracking (only while stats are enabled)
+	const bool bTrackIterationError = GetFluidStatsCollector().IsEnabled() && Preset->Density > 0.0f;
+	const float InvRestDensity = Preset->Density > 0.0f ? 1.0f / Preset->Density : 0.0f;
+
 	// XPBD iterative solver (viscous fluid: 2-3 iterations, water: 4-6 iterations)
-	const int32 SolverIterations = Preset->SolverIterations;
+	int32 SolverIterations = SolverIterationsOverride > 0 ? SolverIterationsOverride : Preset->SolverIterations;
+
+	// Per-frame iteration ceiling of the current tier, never below one iteration per substep
+	if (Preset->MaxSolverIterationsPerFrame > 0)
+	{
+		SolverIterations = FMath::Clamp(Preset->MaxSolverIterationsPerFrame - TierSolverIterations, 1, SolverIterations);
+	}
+
+	// Early exit once the compression error is within tolerance (checked after MinSolverIterations)
+	const bool bEarlyExit = Preset->bEnableSolverEarlyExit && Preset->Density > 0.0f;
+	const int32 MinIterations = FMath::Clamp(Preset->MinSolverIterations, 1, SolverIterations);
+	const float AvgErrorTolerance = Preset->DensityErrorTolerance * 0.01f;
+	const float MaxErrorTolerance = Preset->MaxDensityErrorTolerance * 0.01f;
+
+	// Artificial Pressure (Tensile Instability correction), disabled = default solver
+	FTensileInstabilityParams TensileParams;
+	if (bUseArtificialPressure)
+	{
+		TensileParams.bEnabled = true;
+		TensileParams.K = ScaledArtificialPressureK;
+		TensileParams.N = Preset->ArtificialPressureExponent;
+		TensileParams.DeltaQ = Preset->ArtificialPressureDeltaQ;
+	}
+
 	for (int32 Iter = 0; Iter < SolverIterations; ++Iter)
 	{
-		if (bUseArtificialPressure)
-		{
-			// Solver with Artificial Pressure (Tensile Instability correction)
-			FTensileInstabilityParams TensileParams;
-			TensileParams.bEnabled = true;
-			TensileParams.K = ScaledArtificialPressureK;
-			TensileParams.N = Preset->ArtificialPressureExponent;
-			TensileParams.DeltaQ = Preset->ArtificialPressureDeltaQ;
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(KawaiiFluidContext_DensityIteration, KawaiiFluidChannel);
 
-			DensityConstraint->SolveWithTensileCorrection(
-				Particles,
-				Preset->SmoothingRadius,
-				Preset->Density,
-				ScaledCompliance,
-				DeltaTime,
-				TensileParams
-			);
+		DensityConstraint->EvaluateDensities(
+			Particles,
+			Preset->SmoothingRadius,
+			Preset->Density,
+			ScaledCompliance,
+			DeltaTime,
+			TensileParams,
+			NumSolved
+		);
+
+		// The densities just evaluated measure the positions after the previous iteration's correction
+		if (bEarlyExit && Iter >= MinIterations)
+		{
+			float AvgError = 0.0f;
+			float MaxError = 0.0f;
+			ComputeCompressionError(MakeArrayView(DensityConstraint->GetDensities().GetData(), NumSolved), InvRestDensity, AvgError, MaxError);
+			if (AvgError <= AvgErrorTolerance && MaxError <= MaxErrorTolerance)
+			{
+				DensityConstraint->ApplyCorrections(Particles, false);
+				LastAdaptiveStepStats.NumEarlyExits++;
+				break;
+			}
 		}
-		else
+
+		DensityConstraint->ApplyCorrections(Particles, true);
+
+		// Density is evaluated at the start of each iteration, so this is the residual the iteration corrected
+		if (bTrackIterationError)
 		{
-			// Default solver
-			DensityConstraint->Solve(
-				Particles,
-				Preset->SmoothingRadius,
-				Preset->Density,
-				ScaledCompliance,
-				DeltaTime
-			);
+			SCOPE_CYCLE_COUNTER(STAT_ContextInstrumentation);
+
+			if (NumSolved > 0)
+			{
+				const float ErrorPercent = ComputeAverageDensityDeviation(
+					MakeArrayView(DensityConstraint->GetDensities().GetData(), NumSolved), InvRestDensity) * 100.0f;
+				FKawaiiFluidSimulationStatsCollector::TraceDensityIterationError(ErrorPercent);
+				FrameIterationErrors.Emplace(Iter, ErrorPercent);
+			}
 		}
+
+		LastAdaptiveStepStats.NumSolverIterations++;
+		TierSolverIterations++;
 	}
 }
 
@@ -2705,14 +3386,16 @@ void UKawaiiFluidSimulationContext::UpdateAttachedParticlePositions(
 //=============================================================================
 
 /**
- * @brief Collect simulation statistics for performance and quality monitoring (CPU).
- * @param Particles Particle array to analyze.
+ * @brief Publish simulation statistics for performance and quality monitoring (CPU).
+ * @param FrameStats Per-particle statistics accumulated by the frame's final bounds sweep.
+ * @param ParticleCount Total number of particles in the simulation.
  * @param Preset Read-only preset containing reference values.
  * @param SubstepCount Number of substeps executed in the current frame.
  * @param bIsGPU Flag indicating if statistics were collected during a GPU simulation.
  */
 void UKawaiiFluidSimulationContext::CollectSimulationStats(
-	const TArray<FKawaiiFluidParticle>& Particles,
+	const FKawaiiFluidStatsAccumulator& FrameStats,
+	int32 ParticleCount,
 	const UKawaiiFluidPresetDataAsset* Preset,
 	int32 SubstepCount,
 	bool bIsGPU)
@@ -2735,45 +3418,31 @@ void UKawaiiFluidSimulationContext::CollectSimulationStats(
 		Stats.SetSolverIterations(Preset->SolverIterations);
 	}
 
-	// Count particle types
-	int32 TotalCount = Particles.Num();
-	int32 AttachedCount = 0;
-	int32 GroundCount = 0;
-
-	for (const FKawaiiFluidParticle& Particle : Particles)
+	// Adaptive substeps and early-exit iterations, plus the substep samples buffered before BeginFrame (CPU path only)
+	if (!bIsGPU)
 	{
-		// Velocity sample
-		float VelMag = static_cast<float>(Particle.Velocity.Size());
-		Stats.AddVelocitySample(VelMag);
-
-		// Density sample
-		Stats.AddDensitySample(Particle.Density);
-
-		// Neighbor count sample
-		Stats.AddNeighborCountSample(Particle.NeighborIndices.Num());
-
-		// Count attached particles
-		if (Particle.bIsAttached)
+		Stats.SetAdaptiveStepStats(LastAdaptiveStepStats);
+		Stats.AddSubstepTimings(FrameSubstepTimings);
+		for (const TPair<int32, float>& IterationError : FrameIterationErrors)
 		{
-			AttachedCount++;
+			Stats.AddDensityIterationError(IterationError.Key, IterationError.Value);
 		}
+	}
 
-		// Count ground contact
-		if (Particle.bNearGround)
+	// Simulation LOD tiers (CPU path only)
+	if (!bIsGPU && LODSolver.IsValid())
+	{
+		for (int32 Tier = 0; Tier < FKawaiiFluidLODSolver::NumTiers; ++Tier)
 		{
-			GroundCount++;
+			const FKawaiiFluidLODTierStats& TierStats = LODSolver->GetTierStats(static_cast<EKawaiiFluidLODTier>(Tier));
+			Stats.SetLODTierStats(Tier, TierStats.NumParticles, TierStats.NumSubsteps, TierStats.TimeMs);
 		}
 	}
 
-	// Set particle counts
-	int32 ActiveCount = TotalCount - AttachedCount;
-	Stats.SetParticleCounts(TotalCount, ActiveCount, AttachedCount);
+	Stats.MergeAccumulator(FrameStats);
 
-	// Set ground contact count as collision stat
-	for (int32 i = 0; i < GroundCount; ++i)
-	{
-		Stats.AddGroundContact();
-	}
+	// Set particle counts
+	Stats.SetParticleCounts(ParticleCount, ParticleCount - FrameStats.AttachedCount, FrameStats.AttachedCount);
 
 	// End frame and finalize statistics
 	Stats.EndFrame();
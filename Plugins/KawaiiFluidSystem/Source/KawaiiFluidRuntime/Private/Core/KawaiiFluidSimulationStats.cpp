@@ -1,9 +1,35 @@
 // Copyright 2026 Team_Bruteforce. All Rights Reserved.
 
 #include "Core/KawaiiFluidSimulationStats.h"
+#include "Core/KawaiiFluidSimulationTypes.h"
 #include "Logging/KawaiiFluidLog.h"
 #include "HAL/IConsoleManager.h"
 #include "Engine/Engine.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Async/ParallelFor.h"
+
+UE_TRACE_CHANNEL_DEFINE(KawaiiFluidChannel);
+
+//=============================================================================
+// Insights Counters
+//=============================================================================
+
+TRACE_DECLARE_FLOAT_COUNTER(KawaiiFluidCounter_PredictMs, TEXT("KawaiiFluid/CPU/PredictMs"));
+TRACE_DECLARE_FLOAT_COUNTER(KawaiiFluidCounter_NeighborsMs, TEXT("KawaiiFluid/CPU/NeighborsMs"));
+TRACE_DECLARE_FLOAT_COUNTER(KawaiiFluidCounter_DensityMs, TEXT("KawaiiFluid/CPU/DensityMs"));
+TRACE_DECLARE_FLOAT_COUNTER(KawaiiFluidCounter_CollisionMs, TEXT("KawaiiFluid/CPU/CollisionMs"));
+TRACE_DECLARE_FLOAT_COUNTER(KawaiiFluidCounter_ViscosityMs, TEXT("KawaiiFluid/CPU/ViscosityMs"));
+TRACE_DECLARE_FLOAT_COUNTER(KawaiiFluidCounter_AdhesionMs, TEXT("KawaiiFluid/CPU/AdhesionMs"));
+TRACE_DECLARE_FLOAT_COUNTER(KawaiiFluidCounter_CohesionMs, TEXT("KawaiiFluid/CPU/CohesionMs"));
+TRACE_DECLARE_FLOAT_COUNTER(KawaiiFluidCounter_StackPressureMs, TEXT("KawaiiFluid/CPU/StackPressureMs"));
+TRACE_DECLARE_FLOAT_COUNTER(KawaiiFluidCounter_SubstepMs, TEXT("KawaiiFluid/CPU/SubstepMs"));
+TRACE_DECLARE_FLOAT_COUNTER(KawaiiFluidCounter_DensityIterationError, TEXT("KawaiiFluid/CPU/DensityIterationError%"));
+TRACE_DECLARE_INT_COUNTER(KawaiiFluidCounter_NeighborHist0, TEXT("KawaiiFluid/CPU/Neighbors[0]"));
+TRACE_DECLARE_INT_COUNTER(KawaiiFluidCounter_NeighborHist1, TEXT("KawaiiFluid/CPU/Neighbors[1-7]"));
+TRACE_DECLARE_INT_COUNTER(KawaiiFluidCounter_NeighborHist2, TEXT("KawaiiFluid/CPU/Neighbors[8-15]"));
+TRACE_DECLARE_INT_COUNTER(KawaiiFluidCounter_NeighborHist3, TEXT("KawaiiFluid/CPU/Neighbors[16-31]"));
+TRACE_DECLARE_INT_COUNTER(KawaiiFluidCounter_NeighborHist4, TEXT("KawaiiFluid/CPU/Neighbors[32-63]"));
+TRACE_DECLARE_INT_COUNTER(KawaiiFluidCounter_NeighborHist5, TEXT("KawaiiFluid/CPU/Neighbors[64+]"));
 
 //=============================================================================
 // Stat Definitions
@@ -36,6 +62,16 @@ DEFINE_STAT(STAT_FluidPerParticleError);
 DEFINE_STAT(STAT_FluidKineticEnergy);
 DEFINE_STAT(STAT_FluidStabilityScore);
 
+// Solver convergence / neighbor distribution
+DEFINE_STAT(STAT_FluidDensityErrorFirstIter);
+DEFINE_STAT(STAT_FluidDensityErrorLastIter);
+DEFINE_STAT(STAT_FluidNeighborHist0);
+DEFINE_STAT(STAT_FluidNeighborHist1);
+DEFINE_STAT(STAT_FluidNeighborHist2);
+DEFINE_STAT(STAT_FluidNeighborHist3);
+DEFINE_STAT(STAT_FluidNeighborHist4);
+DEFINE_STAT(STAT_FluidNeighborHist5);
+
 //=============================================================================
 // FFluidSimulationStats Implementation
 //=============================================================================
@@ -88,6 +124,9 @@ void FKawaiiFluidSimulationStats::LogStats(const FString& Label) const
 	// Neighbors
 	KF_LOG_DEV(Log, TEXT("Neighbors: Avg=%.2f, Min=%d, Max=%d"),
 		AvgNeighborCount, MinNeighborCount, MaxNeighborCount);
+	KF_LOG_DEV(Log, TEXT("Neighbor Histogram: [0]=%d [1-7]=%d [8-15]=%d [16-31]=%d [32-63]=%d [64+]=%d"),
+		NeighborHistogram[0], NeighborHistogram[1], NeighborHistogram[2],
+		NeighborHistogram[3], NeighborHistogram[4], NeighborHistogram[5]);
 
 	// Forces
 	KF_LOG_DEV(Log, TEXT("Forces: Pressure=%.4f, Viscosity=%.4f, Cohesion=%.4f"),
@@ -101,18 +140,43 @@ void FKawaiiFluidSimulationStats::LogStats(const FString& Label) const
 	KF_LOG_DEV(Log, TEXT("Solver: Substeps=%d, SolverIter=%d"),
 		SubstepCount, SolverIterations);
 
+	if (!bIsGPUSimulation && SubstepCount > 0)
+	{
+		KF_LOG_DEV(Log, TEXT("  dt=[%.5f, %.5f] s, Iterations=%d, EarlyExits=%d, MaxSpeed=%.1f cm/s, Dropped=%.4f s"),
+			MinSubstepDeltaTime, MaxSubstepDeltaTime, TotalSolverIterations, EarlyExitCount, MaxCFLSpeed, DroppedSimulationTime);
+	}
+
+	for (int32 Iter = 0; Iter < DensityErrorPerIteration.Num(); ++Iter)
+	{
+		KF_LOG_DEV(Log, TEXT("  Density Error Iter %d: %.3f%%"), Iter, DensityErrorPerIteration[Iter]);
+	}
+
 	// Performance
 	KF_LOG_DEV(Log, TEXT("Performance (ms): Total=%.3f, Hash=%.3f, Density=%.3f"),
 		TotalSimulationTimeMs, SpatialHashTimeMs, DensitySolveTimeMs);
 	KF_LOG_DEV(Log, TEXT("  Viscosity=%.3f, Cohesion=%.3f, Collision=%.3f"),
 		ViscosityTimeMs, CohesionTimeMs, CollisionTimeMs);
 
+	if (!bIsGPUSimulation)
+	{
+		KF_LOG_DEV(Log, TEXT("  Predict=%.3f, Finalize=%.3f, Adhesion=%.3f, StackPressure=%.3f"),
+			PredictTimeMs, FinalizeTimeMs, AdhesionTimeMs, StackPressureTimeMs);
+	}
+
 	if (bIsGPUSimulation)
 	{
 		KF_LOG_DEV(Log, TEXT("  GPU Sim=%.3f, GPU Readback=%.3f"),
 			GPUSimulationTimeMs, GPUReadbackTimeMs);
 	}
 
+	if (LODTierParticleCount[1] > 0 || LODTierParticleCount[2] > 0)
+	{
+		KF_LOG_DEV(Log, TEXT("LOD: Near=%d (%d steps, %.3f ms), Far=%d (%d steps, %.3f ms), Frozen=%d"),
+			LODTierParticleCount[0], LODTierSubstepCount[0], LODTierTimeMs[0],
+			LODTierParticleCount[1], LODTierSubstepCount[1], LODTierTimeMs[1],
+			LODTierParticleCount[2]);
+	}
+
 	KF_LOG_DEV(Log, TEXT("========================================"));
 }
 
@@ -141,6 +205,12 @@ FString FKawaiiFluidSimulationStats::ToString() const
 
 	Result += FString::Printf(TEXT("Neighbors: Avg=%.1f (Min=%d, Max=%d)\n"),
 		AvgNeighborCount, MinNeighborCount, MaxNeighborCount);
+	if (DensityErrorPerIteration.Num() > 0)
+	{
+		Result += FString::Printf(TEXT("Density Iter Error: %.2f%% -> %.2f%% (%d iters)\n"),
+			DensityErrorPerIteration[0], DensityErrorPerIteration.Last(), DensityErrorPerIteration.Num());
+	}
+
 	Result += FString::Printf(TEXT("Forces: P=%.4f, V=%.4f, C=%.4f\n"),
 		AvgPressureCorrection, AvgViscosityForce, AvgCohesionForce);
 	Result += FString::Printf(TEXT("Collisions: Bounds=%d, Prim=%d, Ground=%d\n"),
@@ -149,6 +219,18 @@ FString FKawaiiFluidSimulationStats::ToString() const
 		TotalSimulationTimeMs, SpatialHashTimeMs, DensitySolveTimeMs,
 		ViscosityTimeMs, CohesionTimeMs, CollisionTimeMs);
 
+	if (EarlyExitCount > 0 || DroppedSimulationTime > 0.0f || MinSubstepDeltaTime != MaxSubstepDeltaTime)
+	{
+		Result += FString::Printf(TEXT("\nSteps: %d (dt %.4f-%.4f s), Iters=%d, EarlyExit=%d, Dropped=%.3fs"),
+			SubstepCount, MinSubstepDeltaTime, MaxSubstepDeltaTime, TotalSolverIterations, EarlyExitCount, DroppedSimulationTime);
+	}
+
+	if (LODTierParticleCount[1] > 0 || LODTierParticleCount[2] > 0)
+	{
+		Result += FString::Printf(TEXT("\nLOD: Near=%d (%.2fms), Far=%d (%.2fms), Frozen=%d"),
+			LODTierParticleCount[0], LODTierTimeMs[0], LODTierParticleCount[1], LODTierTimeMs[1], LODTierParticleCount[2]);
+	}
+
 	return Result;
 }
 
@@ -250,6 +332,8 @@ void FKawaiiFluidSimulationStatsCollector::BeginFrame()
 	const float SavedPerParticleDensityError = CurrentStats.PerParticleDensityError;
 	const float SavedKineticEnergy = CurrentStats.KineticEnergy;
 	const float SavedStabilityScore = CurrentStats.StabilityScore;
+	int32 SavedNeighborHistogram[FKawaiiFluidSimulationStats::NeighborHistogramBucketCount];
+	FMemory::Memcpy(SavedNeighborHistogram, CurrentStats.NeighborHistogram, sizeof(SavedNeighborHistogram));
 
 	// Reset current stats
 	CurrentStats.Reset();
@@ -276,32 +360,13 @@ void FKawaiiFluidSimulationStatsCollector::BeginFrame()
 		CurrentStats.PerParticleDensityError = SavedPerParticleDensityError;
 		CurrentStats.KineticEnergy = SavedKineticEnergy;
 		CurrentStats.StabilityScore = SavedStabilityScore;
+		FMemory::Memcpy(CurrentStats.NeighborHistogram, SavedNeighborHistogram, sizeof(SavedNeighborHistogram));
 	}
 
-	// Reset accumulators
-	VelocitySum = 0.0;
-	VelocitySampleCount = 0;
-	DensitySum = 0.0;
-	DensitySampleCount = 0;
-	NeighborSum = 0.0;
-	NeighborSampleCount = 0;
-	PressureCorrectionSum = 0.0;
-	PressureCorrectionSampleCount = 0;
-	ViscosityForceSum = 0.0;
-	ViscosityForceSampleCount = 0;
-	CohesionForceSum = 0.0;
-	CohesionForceSampleCount = 0;
-
-	// Initialize min/max (only when not preserving GPU stats)
-	if (!bPreserveGPUStats)
-	{
-		CurrentStats.MinVelocity = TNumericLimits<float>::Max();
-		CurrentStats.MaxVelocity = TNumericLimits<float>::Lowest();
-		CurrentStats.MinDensity = TNumericLimits<float>::Max();
-		CurrentStats.MaxDensity = TNumericLimits<float>::Lowest();
-		CurrentStats.MinNeighborCount = TNumericLimits<int32>::Max();
-		CurrentStats.MaxNeighborCount = TNumericLimits<int32>::Lowest();
-	}
+	// Reset accumulators (min/max sentinels live in the running stats, so untouched fields stay at 0)
+	FrameAccumulator.Reset();
+	DensityIterationErrorSums.Reset();
+	DensityIterationSampleCounts.Reset();
 
 	bFrameActive = true;
 }
@@ -316,71 +381,18 @@ void FKawaiiFluidSimulationStatsCollector::EndFrame()
 		return;
 	}
 
-	// Calculate averages
-	if (VelocitySampleCount > 0)
-	{
-		CurrentStats.AvgVelocity = static_cast<float>(VelocitySum / VelocitySampleCount);
-	}
-
-	if (DensitySampleCount > 0)
-	{
-		CurrentStats.AvgDensity = static_cast<float>(DensitySum / DensitySampleCount);
-
-		// Calculate density error
-		if (CurrentStats.RestDensity > 0.001f)
-		{
-			double ErrorSum = 0.0;
-			// Note: We track the error during sampling now
-			CurrentStats.DensityError = static_cast<float>(
-				FMath::Abs(CurrentStats.AvgDensity - CurrentStats.RestDensity) /
-				CurrentStats.RestDensity * 100.0);
-		}
-	}
+	// Fold the merged per-thread accumulators into the snapshot.
+	// Fields without samples are left untouched so asynchronously preserved GPU values survive.
+	ApplyAccumulatorToStats(FrameAccumulator, CurrentStats.RestDensity, CurrentStats);
+	CurrentStats.GroundContactCount += FrameAccumulator.GroundContactCount;
 
-	if (NeighborSampleCount > 0)
+	// Average per-iteration density error over all substeps of the frame
+	CurrentStats.DensityErrorPerIteration.SetNum(DensityIterationErrorSums.Num());
+	for (int32 Iter = 0; Iter < DensityIterationErrorSums.Num(); ++Iter)
 	{
-		CurrentStats.AvgNeighborCount = static_cast<float>(NeighborSum / NeighborSampleCount);
-	}
-
-	if (PressureCorrectionSampleCount > 0)
-	{
-		CurrentStats.AvgPressureCorrection = static_cast<float>(PressureCorrectionSum / PressureCorrectionSampleCount);
-	}
-
-	if (ViscosityForceSampleCount > 0)
-	{
-		CurrentStats.AvgViscosityForce = static_cast<float>(ViscosityForceSum / ViscosityForceSampleCount);
-	}
-
-	if (CohesionForceSampleCount > 0)
-	{
-		CurrentStats.AvgCohesionForce = static_cast<float>(CohesionForceSum / CohesionForceSampleCount);
-	}
-
-	// Fix min/max if no samples
-	if (CurrentStats.MinVelocity == TNumericLimits<float>::Max())
-	{
-		CurrentStats.MinVelocity = 0.0f;
-	}
-	if (CurrentStats.MaxVelocity == TNumericLimits<float>::Lowest())
-	{
-		CurrentStats.MaxVelocity = 0.0f;
-	}
-	if (CurrentStats.MinDensity == TNumericLimits<float>::Max())
-	{
-		CurrentStats.MinDensity = 0.0f;
-	}
-	if (CurrentStats.MaxDensity == TNumericLimits<float>::Lowest())
-	{
-		CurrentStats.MaxDensity = 0.0f;
-	}
-	if (CurrentStats.MinNeighborCount == TNumericLimits<int32>::Max())
-	{
-		CurrentStats.MinNeighborCount = 0;
-	}
-	if (CurrentStats.MaxNeighborCount == TNumericLimits<int32>::Lowest())
-	{
-		CurrentStats.MaxNeighborCount = 0;
+		CurrentStats.DensityErrorPerIteration[Iter] = DensityIterationSampleCounts[Iter] > 0
+			? static_cast<float>(DensityIterationErrorSums[Iter] / DensityIterationSampleCounts[Iter])
+			: 0.0f;
 	}
 
 	// Update engine stats
@@ -413,11 +425,7 @@ void FKawaiiFluidSimulationStatsCollector::AddVelocitySample(float VelocityMagni
 		return;
 	}
 
-	VelocitySum += VelocityMagnitude;
-	VelocitySampleCount++;
-
-	CurrentStats.MinVelocity = FMath::Min(CurrentStats.MinVelocity, VelocityMagnitude);
-	CurrentStats.MaxVelocity = FMath::Max(CurrentStats.MaxVelocity, VelocityMagnitude);
+	FrameAccumulator.Velocity.Add(VelocityMagnitude);
 }
 
 /**
@@ -431,11 +439,7 @@ void FKawaiiFluidSimulationStatsCollector::AddDensitySample(float Density)
 		return;
 	}
 
-	DensitySum += Density;
-	DensitySampleCount++;
-
-	CurrentStats.MinDensity = FMath::Min(CurrentStats.MinDensity, Density);
-	CurrentStats.MaxDensity = FMath::Max(CurrentStats.MaxDensity, Density);
+	FrameAccumulator.Density.Add(Density);
 }
 
 /**
@@ -449,11 +453,7 @@ void FKawaiiFluidSimulationStatsCollector::AddNeighborCountSample(int32 Neighbor
 		return;
 	}
 
-	NeighborSum += NeighborCount;
-	NeighborSampleCount++;
-
-	CurrentStats.MinNeighborCount = FMath::Min(CurrentStats.MinNeighborCount, NeighborCount);
-	CurrentStats.MaxNeighborCount = FMath::Max(CurrentStats.MaxNeighborCount, NeighborCount);
+	FrameAccumulator.Neighbors.Add(static_cast<float>(NeighborCount));
 }
 
 /**
@@ -466,8 +466,7 @@ void FKawaiiFluidSimulationStatsCollector::AddPressureCorrectionSample(float Cor
 		return;
 	}
 
-	PressureCorrectionSum += CorrectionMagnitude;
-	PressureCorrectionSampleCount++;
+	FrameAccumulator.PressureCorrection.Add(CorrectionMagnitude);
 }
 
 /**
@@ -480,8 +479,7 @@ void FKawaiiFluidSimulationStatsCollector::AddViscosityForceSample(float ForceMa
 		return;
 	}
 
-	ViscosityForceSum += ForceMagnitude;
-	ViscosityForceSampleCount++;
+	FrameAccumulator.ViscosityForce.Add(ForceMagnitude);
 }
 
 /**
@@ -494,101 +492,310 @@ void FKawaiiFluidSimulationStatsCollector::AddCohesionForceSample(float ForceMag
 		return;
 	}
 
-	CohesionForceSum += ForceMagnitude;
-	CohesionForceSampleCount++;
+	FrameAccumulator.CohesionForce.Add(ForceMagnitude);
 }
 
 /**
- * @brief Calculate high-level stability metrics from raw particle data (GPU detailed mode only).
- * @param Densities Pointer to density buffer.
- * @param Velocities Pointer to velocity magnitude buffer.
- * @param Masses Pointer to mass buffer (nullable for uniform mass).
- * @param Count Number of particles in the buffers.
- * @param RestDensity Reference density for error calculation.
+ * @brief Merge a per-thread accumulator into the current frame (one call per worker, not per particle).
+ * @param Accumulator Partial statistics gathered by a solver loop.
  */
-void FKawaiiFluidSimulationStatsCollector::CalculateStabilityMetrics(
-	const float* Densities,
-	const float* Velocities,
-	const float* Masses,
-	int32 Count,
-	float RestDensity)
+void FKawaiiFluidSimulationStatsCollector::MergeAccumulator(const FKawaiiFluidStatsAccumulator& Accumulator)
 {
-	if (!bEnabled || Count <= 0 || !Densities || !Velocities)
+	if (!bEnabled || !bFrameActive)
 	{
 		return;
 	}
 
-	// Pass 1: Calculate means
-	double DensityMean = 0.0;
-	double VelocityMean = 0.0;
-	double KineticEnergySum = 0.0;
-	double PerParticleErrorSum = 0.0;
+	FrameAccumulator.Merge(Accumulator);
+}
 
-	for (int32 i = 0; i < Count; ++i)
+/**
+ * @brief Apply a complete per-particle accumulator immediately (async GPU readback, outside BeginFrame/EndFrame).
+ * @param Accumulator Statistics merged from all readback chunks.
+ * @param RestDensity Reference density for error calculation.
+ */
+void FKawaiiFluidSimulationStatsCollector::ApplyParticleAccumulator(const FKawaiiFluidStatsAccumulator& Accumulator, float RestDensity)
+{
+	if (!bEnabled)
 	{
-		const float Density = Densities[i];
-		const float Velocity = Velocities[i];
-		const float Mass = Masses ? Masses[i] : 1.0f;
+		return;
+	}
+
+	CurrentStats.RestDensity = RestDensity;
+	ApplyAccumulatorToStats(Accumulator, RestDensity, CurrentStats);
+}
 
-		DensityMean += Density;
-		VelocityMean += Velocity;
+/**
+ * @brief Derive averages, extrema, deviations and the stability score from an accumulator.
+ * @param Accumulator Merged statistics.
+ * @param RestDensity Reference density for error calculation.
+ * @param OutStats Snapshot to update (fields without samples are left untouched).
+ */
+void FKawaiiFluidSimulationStatsCollector::ApplyAccumulatorToStats(const FKawaiiFluidStatsAccumulator& Accumulator, float RestDensity, FKawaiiFluidSimulationStats& OutStats)
+{
+	const FKawaiiFluidRunningStat& Velocity = Accumulator.Velocity;
+	const FKawaiiFluidRunningStat& Density = Accumulator.Density;
+	const FKawaiiFluidRunningStat& Neighbors = Accumulator.Neighbors;
+
+	if (Velocity.HasSamples())
+	{
+		OutStats.AvgVelocity = static_cast<float>(Velocity.Mean);
+		OutStats.MinVelocity = Velocity.Min;
+		OutStats.MaxVelocity = Velocity.Max;
+		OutStats.VelocityStdDev = static_cast<float>(Velocity.GetStdDev());
+		OutStats.KineticEnergy = static_cast<float>(Accumulator.KineticEnergySum / Velocity.Count);
+	}
 
-		// Kinetic energy: 0.5 * m * v²
-		KineticEnergySum += 0.5 * Mass * Velocity * Velocity;
+	if (Density.HasSamples())
+	{
+		OutStats.AvgDensity = static_cast<float>(Density.Mean);
+		OutStats.MinDensity = Density.Min;
+		OutStats.MaxDensity = Density.Max;
+		OutStats.DensityStdDev = static_cast<float>(Density.GetStdDev());
 
-		// Per-particle density error: |ρᵢ - ρ₀| / ρ₀ * 100
 		if (RestDensity > 0.001f)
 		{
-			PerParticleErrorSum += FMath::Abs(Density - RestDensity) / RestDensity * 100.0;
+			OutStats.DensityError = static_cast<float>(FMath::Abs(Density.Mean - RestDensity) / RestDensity * 100.0);
+			OutStats.PerParticleDensityError = static_cast<float>(Accumulator.DensityErrorSum / Density.Count);
 		}
 	}
 
-	DensityMean /= Count;
-	VelocityMean /= Count;
+	if (Neighbors.HasSamples())
+	{
+		OutStats.AvgNeighborCount = static_cast<float>(Neighbors.Mean);
+		OutStats.MinNeighborCount = FMath::RoundToInt(Neighbors.Min);
+		OutStats.MaxNeighborCount = FMath::RoundToInt(Neighbors.Max);
+	}
 
-	// Pass 2: Calculate standard deviations
-	double DensityVariance = 0.0;
-	double VelocityVariance = 0.0;
+	if (Accumulator.PressureCorrection.HasSamples())
+	{
+		OutStats.AvgPressureCorrection = static_cast<float>(Accumulator.PressureCorrection.Mean);
+	}
 
-	for (int32 i = 0; i < Count; ++i)
+	if (Accumulator.ViscosityForce.HasSamples())
 	{
-		const double DensityDiff = Densities[i] - DensityMean;
-		const double VelocityDiff = Velocities[i] - VelocityMean;
+		OutStats.AvgViscosityForce = static_cast<float>(Accumulator.ViscosityForce.Mean);
+	}
 
-		DensityVariance += DensityDiff * DensityDiff;
-		VelocityVariance += VelocityDiff * VelocityDiff;
+	if (Accumulator.CohesionForce.HasSamples())
+	{
+		OutStats.AvgCohesionForce = static_cast<float>(Accumulator.CohesionForce.Mean);
 	}
 
-	DensityVariance /= Count;
-	VelocityVariance /= Count;
+	int32 HistogramTotal = 0;
+	for (int32 Bucket = 0; Bucket < FKawaiiFluidSimulationStats::NeighborHistogramBucketCount; ++Bucket)
+	{
+		HistogramTotal += Accumulator.NeighborHistogram[Bucket];
+	}
+	if (HistogramTotal > 0)
+	{
+		FMemory::Memcpy(OutStats.NeighborHistogram, Accumulator.NeighborHistogram, sizeof(OutStats.NeighborHistogram));
+	}
 
-	// Store results
-	CurrentStats.DensityStdDev = static_cast<float>(FMath::Sqrt(DensityVariance));
-	CurrentStats.VelocityStdDev = static_cast<float>(FMath::Sqrt(VelocityVariance));
-	CurrentStats.PerParticleDensityError = static_cast<float>(PerParticleErrorSum / Count);
-	CurrentStats.KineticEnergy = static_cast<float>(KineticEnergySum / Count);
+	if (Velocity.HasSamples() && Density.HasSamples())
+	{
+		UpdateStabilityScore(OutStats);
+	}
+}
 
-	// Calculate Stability Score (0-100, higher = more stable)
+/**
+ * @brief Calculate the composite stability score (0-100, higher = more stable) from finalized metrics.
+ * @param InOutStats Snapshot with PerParticleDensityError, VelocityStdDev, AvgVelocity and MaxVelocity set.
+ */
+void FKawaiiFluidSimulationStatsCollector::UpdateStabilityScore(FKawaiiFluidSimulationStats& InOutStats)
+{
 	// Factors:
 	//   1. PerParticleDensityError: target < 3% for stable, > 10% is unstable
 	//   2. VelocityStdDev: target < 5 cm/s for stable, > 50 cm/s is chaotic
 	//   3. AvgVelocity: target < 10 cm/s for "resting" fluid
-	//   4. KineticEnergy: lower is better for resting fluid
+	//   4. MaxVelocity: target < 50 cm/s, > 500 cm/s indicates explosions
 
 	// Density error score (0-25): 3% error = 25, 10% error = 0
-	const float DensityErrorScore = FMath::Clamp(25.0f - (CurrentStats.PerParticleDensityError - 3.0f) * (25.0f / 7.0f), 0.0f, 25.0f);
+	const float DensityErrorScore = FMath::Clamp(25.0f - (InOutStats.PerParticleDensityError - 3.0f) * (25.0f / 7.0f), 0.0f, 25.0f);
 
 	// Velocity StdDev score (0-25): 5 cm/s = 25, 50 cm/s = 0
-	const float VelocityStdDevScore = FMath::Clamp(25.0f - (CurrentStats.VelocityStdDev - 5.0f) * (25.0f / 45.0f), 0.0f, 25.0f);
+	const float VelocityStdDevScore = FMath::Clamp(25.0f - (InOutStats.VelocityStdDev - 5.0f) * (25.0f / 45.0f), 0.0f, 25.0f);
 
 	// Average velocity score (0-25): 10 cm/s = 25, 100 cm/s = 0
-	const float AvgVelocity = static_cast<float>(VelocityMean);
-	const float AvgVelocityScore = FMath::Clamp(25.0f - (AvgVelocity - 10.0f) * (25.0f / 90.0f), 0.0f, 25.0f);
+	const float AvgVelocityScore = FMath::Clamp(25.0f - (InOutStats.AvgVelocity - 10.0f) * (25.0f / 90.0f), 0.0f, 25.0f);
 
 	// Max velocity score (0-25): 50 cm/s = 25, 500 cm/s = 0
-	const float MaxVelocityScore = FMath::Clamp(25.0f - (CurrentStats.MaxVelocity - 50.0f) * (25.0f / 450.0f), 0.0f, 25.0f);
+	const float MaxVelocityScore = FMath::Clamp(25.0f - (InOutStats.MaxVelocity - 50.0f) * (25.0f / 450.0f), 0.0f, 25.0f);
+
+	InOutStats.StabilityScore = DensityErrorScore + VelocityStdDevScore + AvgVelocityScore + MaxVelocityScore;
+}
+
+/**
+ * @brief Add the density error of one density solver iteration.
+ * @param Iteration Solver iteration index within the substep.
+ * @param ErrorPercent Mean |ρ/ρ₀ - 1| in percent.
+ */
+void FKawaiiFluidSimulationStatsCollector::AddDensityIterationError(int32 Iteration, float ErrorPercent)
+{
+	if (!bEnabled || !bFrameActive || Iteration < 0)
+	{
+		return;
+	}
+
+	if (DensityIterationErrorSums.Num() <= Iteration)
+	{
+		DensityIterationErrorSums.SetNumZeroed(Iteration + 1);
+		DensityIterationSampleCounts.SetNumZeroed(Iteration + 1);
+	}
+
+	DensityIterationErrorSums[Iteration] += ErrorPercent;
+	DensityIterationSampleCounts[Iteration]++;
+}
 
-	CurrentStats.StabilityScore = DensityErrorScore + VelocityStdDevScore + AvgVelocityScore + MaxVelocityScore;
+/**
+ * @brief Record the particle count, substeps and wall-clock time of one simulation LOD tier.
+ * @param Tier LOD tier index (0 = Near, 1 = Far, 2 = Frozen).
+ * @param ParticleCount Particles assigned to the tier.
+ * @param SubstepCount Substeps the tier ran this frame.
+ * @param TimeMs Wall-clock time spent simulating the tier.
+ */
+void FKawaiiFluidSimulationStatsCollector::SetLODTierStats(int32 Tier, int32 ParticleCount, int32 SubstepCount, double TimeMs)
+{
+	if (!bEnabled || !bFrameActive || Tier < 0 || Tier >= FKawaiiFluidSimulationStats::LODTierCount)
+	{
+		return;
+	}
+
+	CurrentStats.LODTierParticleCount[Tier] = ParticleCount;
+	CurrentStats.LODTierSubstepCount[Tier] = SubstepCount;
+	CurrentStats.LODTierTimeMs[Tier] = TimeMs;
+}
+
+/**
+ * @brief Record the substep sizes and solver iterations chosen by the CPU solver this frame.
+ * @param StepStats Adaptive substep / early-exit statistics of the simulation context.
+ */
+void FKawaiiFluidSimulationStatsCollector::SetAdaptiveStepStats(const FKawaiiFluidAdaptiveStepStats& StepStats)
+{
+	if (!bEnabled || !bFrameActive)
+	{
+		return;
+	}
+
+	CurrentStats.TotalSolverIterations = StepStats.NumSolverIterations;
+	CurrentStats.EarlyExitCount = StepStats.NumEarlyExits;
+	CurrentStats.MinSubstepDeltaTime = StepStats.MinSubstepDeltaTime;
+	CurrentStats.MaxSubstepDeltaTime = StepStats.MaxSubstepDeltaTime;
+	CurrentStats.MaxCFLSpeed = StepStats.MaxSpeed;
+	CurrentStats.DroppedSimulationTime = StepStats.DroppedTime;
+
+	if (StepStats.NumSubsteps > 0)
+	{
+		CurrentStats.SolverIterations = FMath::DivideAndRoundNearest(StepStats.NumSolverIterations, StepStats.NumSubsteps);
+	}
+}
+
+/**
+ * @brief Emit the per-stage timings of one CPU substep as Insights counters (works outside a stats frame).
+ * @param Timings Stage timings recorded by the simulation context.
+ */
+void FKawaiiFluidSimulationStatsCollector::TraceSubstepTimings(const FKawaiiFluidSubstepTimings& Timings)
+{
+	// Counters are no-ops unless the counters trace channel is enabled
+	TRACE_COUNTER_SET(KawaiiFluidCounter_PredictMs, Timings.PredictMs);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_NeighborsMs, Timings.NeighborsMs);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_DensityMs, Timings.DensityMs);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_CollisionMs, Timings.CollisionMs + Timings.WorldCollisionMs);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_ViscosityMs, Timings.ViscosityMs);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_AdhesionMs, Timings.AdhesionMs);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_CohesionMs, Timings.CohesionMs);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_StackPressureMs, Timings.StackPressureMs);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_SubstepMs, Timings.TotalMs);
+}
+
+/**
+ * @brief Emit the density error of one solver iteration as an Insights counter.
+ * @param ErrorPercent Mean |ρ/ρ₀ - 1| in percent.
+ */
+void FKawaiiFluidSimulationStatsCollector::TraceDensityIterationError(float ErrorPercent)
+{
+	TRACE_COUNTER_SET(KawaiiFluidCounter_DensityIterationError, ErrorPercent);
+}
+
+/**
+ * @brief Accumulate per-stage timings into the active frame (call after BeginFrame).
+ * @param Timings Stage timings of one substep, or their sum over a frame.
+ */
+void FKawaiiFluidSimulationStatsCollector::AddSubstepTimings(const FKawaiiFluidSubstepTimings& Timings)
+{
+	if (!bEnabled || !bFrameActive)
+	{
+		return;
+	}
+
+	CurrentStats.TotalSimulationTimeMs += Timings.TotalMs;
+	CurrentStats.PredictTimeMs += Timings.PredictMs;
+	CurrentStats.SpatialHashTimeMs += Timings.NeighborsMs;
+	CurrentStats.DensitySolveTimeMs += Timings.DensityMs;
+	CurrentStats.CollisionTimeMs += Timings.CollisionMs + Timings.WorldCollisionMs;
+	CurrentStats.FinalizeTimeMs += Timings.FinalizeMs;
+	CurrentStats.ViscosityTimeMs += Timings.ViscosityMs;
+	CurrentStats.AdhesionTimeMs += Timings.AdhesionMs;
+	CurrentStats.CohesionTimeMs += Timings.CohesionMs;
+	CurrentStats.StackPressureTimeMs += Timings.StackPressureMs;
+}
+
+/**
+ * @brief Calculate high-level stability metrics from raw particle data (GPU detailed mode only).
+ * @param Densities Pointer to density buffer.
+ * @param Velocities Pointer to velocity magnitude buffer.
+ * @param Masses Pointer to mass buffer (nullable for uniform mass).
+ * @param Count Number of particles in the buffers.
+ * @param RestDensity Reference density for error calculation.
+ */
+void FKawaiiFluidSimulationStatsCollector::CalculateStabilityMetrics(
+	const float* Densities,
+	const float* Velocities,
+	const float* Masses,
+	int32 Count,
+	float RestDensity)
+{
+	if (!bEnabled || Count <= 0 || !Densities || !Velocities)
+	{
+		return;
+	}
+
+	// Single parallel pass: per-task Welford accumulators merged once at the end
+	TArray<FKawaiiFluidStatsAccumulator> TaskAccumulators;
+	const float InvRestDensity = RestDensity > 0.001f ? 1.0f / RestDensity : 0.0f;
+
+	ParallelForWithTaskContext(TEXT("KawaiiFluid_StabilityMetrics"), TaskAccumulators, Count, 4096,
+		[Densities, Velocities, Masses, InvRestDensity](FKawaiiFluidStatsAccumulator& Accumulator, int32 i)
+		{
+			const float Density = Densities[i];
+			const float Velocity = Velocities[i];
+			const float Mass = Masses ? Masses[i] : 1.0f;
+
+			Accumulator.Velocity.Add(Velocity);
+			Accumulator.Density.Add(Density);
+			Accumulator.KineticEnergySum += 0.5 * Mass * Velocity * Velocity;
+			if (InvRestDensity > 0.0f)
+			{
+				Accumulator.DensityErrorSum += FMath::Abs(Density * InvRestDensity - 1.0f) * 100.0;
+			}
+		});
+
+	FKawaiiFluidStatsAccumulator Merged;
+	for (const FKawaiiFluidStatsAccumulator& Accumulator : TaskAccumulators)
+	{
+		Merged.Merge(Accumulator);
+	}
+
+	// Stability metrics only; averages and extrema are owned by the caller's sampling path
+	CurrentStats.DensityStdDev = static_cast<float>(Merged.Density.GetStdDev());
+	CurrentStats.VelocityStdDev = static_cast<float>(Merged.Velocity.GetStdDev());
+	CurrentStats.PerParticleDensityError = static_cast<float>(Merged.DensityErrorSum / Count);
+	CurrentStats.KineticEnergy = static_cast<float>(Merged.KineticEnergySum / Count);
+
+	const float SavedAvgVelocity = CurrentStats.AvgVelocity;
+	CurrentStats.AvgVelocity = static_cast<float>(Merged.Velocity.Mean);
+	UpdateStabilityScore(CurrentStats);
+	CurrentStats.AvgVelocity = SavedAvgVelocity;
 }
 
 /**
@@ -613,6 +820,27 @@ void FKawaiiFluidSimulationStatsCollector::UpdateEngineStats() const
 	SET_FLOAT_STAT(STAT_FluidPerParticleError, CurrentStats.PerParticleDensityError);
 	SET_FLOAT_STAT(STAT_FluidKineticEnergy, CurrentStats.KineticEnergy);
 	SET_FLOAT_STAT(STAT_FluidStabilityScore, CurrentStats.StabilityScore);
+
+	// Solver convergence (CPU path)
+	const TArray<float>& IterationErrors = CurrentStats.DensityErrorPerIteration;
+	SET_FLOAT_STAT(STAT_FluidDensityErrorFirstIter, IterationErrors.Num() > 0 ? IterationErrors[0] : 0.0f);
+	SET_FLOAT_STAT(STAT_FluidDensityErrorLastIter, IterationErrors.Num() > 0 ? IterationErrors.Last() : 0.0f);
+
+	// Neighbor histogram
+	const int32* Histogram = CurrentStats.NeighborHistogram;
+	SET_DWORD_STAT(STAT_FluidNeighborHist0, Histogram[0]);
+	SET_DWORD_STAT(STAT_FluidNeighborHist1, Histogram[1]);
+	SET_DWORD_STAT(STAT_FluidNeighborHist2, Histogram[2]);
+	SET_DWORD_STAT(STAT_FluidNeighborHist3, Histogram[3]);
+	SET_DWORD_STAT(STAT_FluidNeighborHist4, Histogram[4]);
+	SET_DWORD_STAT(STAT_FluidNeighborHist5, Histogram[5]);
+
+	TRACE_COUNTER_SET(KawaiiFluidCounter_NeighborHist0, Histogram[0]);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_NeighborHist1, Histogram[1]);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_NeighborHist2, Histogram[2]);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_NeighborHist3, Histogram[3]);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_NeighborHist4, Histogram[4]);
+	TRACE_COUNTER_SET(KawaiiFluidCounter_NeighborHist5, Histogram[5]);
 }
 
 //=============================================================================
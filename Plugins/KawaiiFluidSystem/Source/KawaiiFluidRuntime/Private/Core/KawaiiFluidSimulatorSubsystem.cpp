@@ -133,6 +133,9 @@ void UKawaiiFluidSimulatorSubsystem::Tick(float DeltaTime)
 	// NOTE: Simulation moved to HandlePostActorTick() for correct bone transform timing
 	// Reset event counter at frame start
 	EventCountThisFrame.store(0, std::memory_order_relaxed);
+
+	// Age the released SourceIDs toward reuse
+	SourceSlotTable.AdvanceFrame();
 }
 
 /**
@@ -205,7 +208,7 @@ void UKawaiiFluidSimulatorSubsystem::RegisterModule(UKawaiiFluidSimulationModule
 	{
 		AllModules.Add(Module);
 
-		// Allocate SourceID for per-component GPU counter tracking (0 ~ MaxSourceCount-1)
+		// Allocate SourceID for per-component GPU counter tracking (dense slot index)
 		const int32 NewSourceID = AllocateSourceID();
 		Module->SetSourceID(NewSourceID);
 
@@ -282,28 +285,18 @@ void UKawaiiFluidSimulatorSubsystem::UnregisterModule(UKawaiiFluidSimulationModu
 
 /**
  * @brief Allocate a unique SourceID for tracking a particle source on the GPU.
- * @return An integer index (0 ~ MaxSourceCount-1) or InvalidSourceID if no slots are available.
+ * @return A dense slot index (released slots are reused after a quarantine) or InvalidSourceID if MaxSourceCount sources are live.
  */
 int32 UKawaiiFluidSimulatorSubsystem::AllocateSourceID()
 {
-	if (UsedSourceIDs.Num() == 0)
-	{
-		UsedSourceIDs.Init(false, EGPUParticleSource::MaxSourceCount);
-	}
-
-	for (int32 i = 0; i < EGPUParticleSource::MaxSourceCount; ++i)
+	const int32 SourceID = SourceSlotTable.Allocate();
+	if (SourceID == INDEX_NONE)
 	{
-		const int32 Index = (NextSourceIDHint + i) % EGPUParticleSource::MaxSourceCount;
-		if (!UsedSourceIDs[Index])
-		{
-			UsedSourceIDs[Index] = true;
-			NextSourceIDHint = (Index + 1) % EGPUParticleSource::MaxSourceCount;
-			return Index;
-		}
+		KF_LOG(Warning, TEXT("Subsystem: AllocateSourceID FAILED - all %d slots in use!"), SourceSlotTable.GetMaxSlots());
+		return EGPUParticleSource::InvalidSourceID;
 	}
 
-	KF_LOG(Warning, TEXT("Subsystem: AllocateSourceID FAILED - all %d slots in use!"), EGPUParticleSource::MaxSourceCount);
-	return EGPUParticleSource::InvalidSourceID;
+	return SourceID;
 }
 
 /**
@@ -312,10 +305,7 @@ int32 UKawaiiFluidSimulatorSubsystem::AllocateSourceID()
  */
 void UKawaiiFluidSimulatorSubsystem::ReleaseSourceID(int32 SourceID)
 {
-	if (SourceID >= 0 && SourceID < UsedSourceIDs.Num())
-	{
-		UsedSourceIDs[SourceID] = false;
-	}
+	SourceSlotTable.Release(SourceID);
 }
 
 /**
@@ -0,0 +1,83 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Core/KawaiiFluidSourceSlotTable.h"
+
+/**
+ * @brief Construct an empty table.
+ * @param InMaxSlots Hard upper bound on concurrently allocated slots.
+ */
+FKawaiiFluidSourceSlotTable::FKawaiiFluidSourceSlotTable(int32 InMaxSlots)
+	: MaxSlots(FMath::Max(InMaxSlots, 1))
+{
+}
+
+/**
+ * @brief Allocate a slot: the oldest released slot once its quarantine has expired, otherwise a new one.
+ * @return Slot index, or INDEX_NONE if MaxSlots slots are already allocated.
+ */
+int32 FKawaiiFluidSourceSlotTable::Allocate()
+{
+	int32 SlotIndex = INDEX_NONE;
+
+	// A full table takes the oldest quarantined slot rather than failing
+	const bool bReuseOldest = !FreeSlots.IsEmpty() &&
+		(CurrentFrame - FreeSlots.First().ReleaseFrame >= ReleaseQuarantineFrames || HighWaterMark >= MaxSlots);
+
+	if (bReuseOldest)
+	{
+		SlotIndex = FreeSlots.First().SlotIndex;
+		FreeSlots.PopFirst();
+	}
+	else if (HighWaterMark < MaxSlots)
+	{
+		SlotIndex = HighWaterMark++;
+		AllocatedSlots.Add(false);
+	}
+	else
+	{
+		return INDEX_NONE;
+	}
+
+	AllocatedSlots[SlotIndex] = true;
+	++NumAllocated;
+	return SlotIndex;
+}
+
+/**
+ * @brief Return a slot to the back of the free queue, quarantined from the current frame.
+ * @param SlotIndex Slot previously returned by Allocate.
+ * @return False if the slot was not allocated (out of range or already released).
+ */
+bool FKawaiiFluidSourceSlotTable::Release(int32 SlotIndex)
+{
+	if (!IsAllocated(SlotIndex))
+	{
+		return false;
+	}
+
+	AllocatedSlots[SlotIndex] = false;
+	FreeSlots.PushLast({ SlotIndex, CurrentFrame });
+	--NumAllocated;
+	return true;
+}
+
+/**
+ * @brief Release every slot and drop the high-water mark back to zero.
+ */
+void FKawaiiFluidSourceSlotTable::Reset()
+{
+	FreeSlots.Reset();
+	AllocatedSlots.Reset();
+	HighWaterMark = 0;
+	NumAllocated = 0;
+}
+
+/**
+ * @brief GPU table size needed to cover a slot count (power of two, at least MinSlotCapacity).
+ * @param SlotCount Number of slots that must be addressable.
+ * @return Capacity in slots.
+ */
+int32 FKawaiiFluidSourceSlotTable::GetCapacityForSlotCount(int32 SlotCount)
+{
+	return static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(SlotCount, MinSlotCapacity))));
+}
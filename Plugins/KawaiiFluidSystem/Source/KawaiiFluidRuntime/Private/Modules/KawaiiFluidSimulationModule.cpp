@@ -13,6 +13,7 @@
 #include "Simulation/KawaiiFluidSimulator.h"
 #include "Simulation/Shaders/KawaiiFluidSimulatorShaders.h"  // For GPU_MORTON_GRID_AXIS_BITS
 #include "Simulation/Resources/GPUFluidParticle.h"  // For FGPUSpawnRequest
+#include "Simulation/Utils/KawaiiFluidBoundaryPass.h"
 #include "UObject/UObjectGlobals.h"  // For FCoreUObjectDelegates
 #include "UObject/ObjectSaveContext.h"  // For FObjectPreSaveContext
 #include "Engine/World.h"
@@ -745,10 +746,15 @@ void UKawaiiFluidSimulationModule::ProcessCollisionFeedback(
  * @brief Spawns a single fluid particle at the specified location.
  * @param Position World-space position.
  * @param Velocity Initial velocity vector.
- * @return Unique identifier assigned by the GPU (async, may return -1).
+ * @return ParticleID on the CPU backend; on GPU the ID is assigned asynchronously (returns -1).
  */
 int32 UKawaiiFluidSimulationModule::SpawnParticle(FVector Position, FVector Velocity)
 {
+	if (bCPUSimulationBackend)
+	{
+		return AddCPUParticle(Position, Velocity);
+	}
+
 	TSharedPtr<FKawaiiFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
 	if (!GPUSim)
 	{
@@ -780,6 +786,15 @@ int32 UKawaiiFluidSimulationModule::SpawnParticle(FVector Position, FVector Velo
  */
 void UKawaiiFluidSimulationModule::SpawnParticles(FVector Location, int32 Count, float SpawnRadius)
 {
+	if (bCPUSimulationBackend)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			AddCPUParticle(Location + FMath::VRand() * FMath::FRandRange(0.0f, SpawnRadius), FVector::ZeroVector);
+		}
+		return;
+	}
+
 	TSharedPtr<FKawaiiFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
 	if (!GPUSim)
 	{
@@ -1318,6 +1333,15 @@ int32 UKawaiiFluidSimulationModule::SpawnParticleDirectionalHexLayer(FVector Pos
 	TArray<FGPUSpawnRequest> BatchRequests;
 	int32 SpawnedCount = SpawnParticleDirectionalHexLayerBatch(Position, Direction, Speed, Radius, Spacing, Jitter, BatchRequests);
 
+	if (bCPUSimulationBackend)
+	{
+		for (const FGPUSpawnRequest& Request : BatchRequests)
+		{
+			AddCPUParticle(FVector(Request.Position), FVector(Request.Velocity));
+		}
+		return SpawnedCount;
+	}
+
 	// Send batch requests
 	TSharedPtr<FKawaiiFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
 	if (BatchRequests.Num() > 0 && GPUSim)
@@ -1422,9 +1446,98 @@ int32 UKawaiiFluidSimulationModule::SpawnParticleDirectionalHexLayerBatch(FVecto
 	return SpawnedCount;
 }
 
+/**
+ * @brief Spawns a batch of particles at explicit positions (e.g. an FKawaiiFluidSpawnLattice shape).
+ * @param Positions World-space spawn positions.
+ * @param Velocities Initial velocities (parallel to Positions).
+ * @return Number of particles spawned (CPU) or requested (GPU).
+ */
+int32 UKawaiiFluidSimulationModule::SpawnParticlesBatch(const TArray<FVector>& Positions, const TArray<FVector>& Velocities)
+{
+	const int32 Count = FMath::Min(Positions.Num(), Velocities.Num());
+
+	if (bCPUSimulationBackend)
+	{
+		int32 SpawnedCount = 0;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (AddCPUParticle(Positions[i], Velocities[i]) < 0)
+			{
+				break;
+			}
+			++SpawnedCount;
+		}
+		return SpawnedCount;
+	}
+
+	TSharedPtr<FKawaiiFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
+	if (!GPUSim || Count == 0)
+	{
+		return 0;
+	}
+
+	const float Mass = Preset ? Preset->ParticleMass : 1.0f;
+	const float Radius = Preset ? Preset->ParticleRadius : 5.0f;
+
+	TArray<FGPUSpawnRequest> SpawnRequests;
+	SpawnRequests.SetNumUninitialized(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		FGPUSpawnRequest& Request = SpawnRequests[i];
+		Request = FGPUSpawnRequest(FVector3f(Positions[i]), FVector3f(Velocities[i]), CachedSourceID, Mass);
+		Request.Radius = Radius;
+	}
+
+	GPUSim->AddSpawnRequests(SpawnRequests);
+	return Count;
+}
+
+/**
+ * @brief Switch the module to the CPU solver backend (particles owned by the Particles array).
+ * @param bEnable Enable or disable the CPU backend.
+ * @param InMaxCPUParticles Particle budget; spawns beyond it are dropped (0 = unlimited).
+ */
+void UKawaiiFluidSimulationModule::SetCPUSimulationBackend(bool bEnable, int32 InMaxCPUParticles)
+{
+	bCPUSimulationBackend = bEnable;
+	MaxCPUParticles = FMath::Max(0, InMaxCPUParticles);
+
+	if (bEnable)
+	{
+		bGPUSimulationActive = false;
+
+		if (MaxCPUParticles > 0 && Particles.Num() > MaxCPUParticles)
+		{
+			Particles.SetNum(MaxCPUParticles);
+		}
+	}
+}
+
+/**
+ * @brief Append one particle to the CPU particle array (CPU backend).
+ * @param Position World-space position.
+ * @param Velocity Initial velocity.
+ * @return ParticleID, or -1 if the CPU particle budget is exhausted.
+ */
+int32 UKawaiiFluidSimulationModule::AddCPUParticle(const FVector& Position, const FVector& Velocity)
+{
+	if (MaxCPUParticles > 0 && Particles.Num() >= MaxCPUParticles)
+	{
+		return -1;
+	}
+
+	FKawaiiFluidParticle& Particle = Particles.Emplace_GetRef(Position, NextCPUParticleID++);
+	Particle.Velocity = Velocity;
+	Particle.Mass = Preset ? Preset->ParticleMass : 1.0f;
+	Particle.SourceID = CachedSourceID;
+	return Particle.ParticleID;
+}
+
 void UKawaiiFluidSimulationModule::ClearAllParticles()
 {
 	Particles.Empty();
+	NextCPUParticleID = 0;
+	CachedParticleBounds = FBox(ForceInit);
 
 	// GPU-driven despawn: remove all particles with this Module's SourceID
 	TSharedPtr<FKawaiiFluidSimulator> GPUSim = WeakGPUSimulator.Pin();
@@ -1461,14 +1574,94 @@ void UKawaiiFluidSimulationModule::DespawnBySourceGPU(int32 SourceID)
 }
 
 
+/**
+ * @brief Rebuild the particle index remap: index k maps to the particle with the k-th smallest ParticleID.
+ *
+ * CPU particles are appended in ParticleID order, so this is the order the index-based APIs saw
+ * before the CPU solver started to Z-order sort Particles, and an index stays valid until particles are removed.
+ */
+void UKawaiiFluidSimulationModule::RebuildParticleIndexRemap() const
+{
+	const int32 NumParticles = Particles.Num();
+	ParticleIndexRemap.SetNumUninitialized(NumParticles);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		ParticleIndexRemap[i] = i;
+	}
+	ParticleIndexRemap.Sort([this](int32 A, int32 B) { return Particles[A].ParticleID < Particles[B].ParticleID; });
+
+	ParticleIndexRemapIDs.SetNumUninitialized(NumParticles);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		ParticleIndexRemapIDs[i] = Particles[ParticleIndexRemap[i]].ParticleID;
+	}
+	ParticleIndexRemapNextID = NextCPUParticleID;
+}
+
+/**
+ * @brief Validated particle index remap for APIs that walk every particle.
+ * @return Remap in ascending ParticleID, or nullptr if indices address Particles directly (GPU readback).
+ */
+const TArray<int32>* UKawaiiFluidSimulationModule::GetParticleIndexRemap() const
+{
+	if (!bCPUSimulationBackend)
+	{
+		return nullptr;
+	}
+
+	bool bCurrent = ParticleIndexRemap.Num() == Particles.Num() && ParticleIndexRemapNextID == NextCPUParticleID;
+	for (int32 i = 0; bCurrent && i < ParticleIndexRemap.Num(); ++i)
+	{
+		bCurrent = Particles[ParticleIndexRemap[i]].ParticleID == ParticleIndexRemapIDs[i];
+	}
+
+	if (!bCurrent)
+	{
+		RebuildParticleIndexRemap();
+	}
+	return &ParticleIndexRemap;
+}
+
+/**
+ * @brief Map a particle index of the index-based APIs to its current slot in Particles.
+ *
+ * Only the looked-up entry is validated: if its slot still holds the ParticleID the remap was built
+ * for, the entry is correct even when a Z-order sort moved other particles.
+ *
+ * @param ParticleIndex Index as returned by GetParticlesInRadius/GetParticlesInBox.
+ * @return Slot in Particles, or INDEX_NONE if out of range.
+ */
+int32 UKawaiiFluidSimulationModule::ResolveParticleIndex(int32 ParticleIndex) const
+{
+	if (!Particles.IsValidIndex(ParticleIndex))
+	{
+		return INDEX_NONE;
+	}
+
+	if (!bCPUSimulationBackend)
+	{
+		return ParticleIndex;
+	}
+
+	const bool bCurrent = ParticleIndexRemap.Num() == Particles.Num()
+		&& ParticleIndexRemapNextID == NextCPUParticleID
+		&& Particles[ParticleIndexRemap[ParticleIndex]].ParticleID == ParticleIndexRemapIDs[ParticleIndex];
+	if (!bCurrent)
+	{
+		RebuildParticleIndexRemap();
+	}
+	return ParticleIndexRemap[ParticleIndex];
+}
+
 TArray<FVector> UKawaiiFluidSimulationModule::GetParticlePositions() const
 {
 	TArray<FVector> Positions;
 	Positions.Reserve(Particles.Num());
 
-	for (const FKawaiiFluidParticle& Particle : Particles)
+	const TArray<int32>* Remap = GetParticleIndexRemap();
+	for (int32 i = 0; i < Particles.Num(); ++i)
 	{
-		Positions.Add(Particle.Position);
+		Positions.Add(Particles[Remap ? (*Remap)[i] : i].Position);
 	}
 
 	return Positions;
@@ -1479,9 +1672,10 @@ TArray<FVector> UKawaiiFluidSimulationModule::GetParticleVelocities() const
 	TArray<FVector> Velocities;
 	Velocities.Reserve(Particles.Num());
 
-	for (const FKawaiiFluidParticle& Particle : Particles)
+	const TArray<int32>* Remap = GetParticleIndexRemap();
+	for (int32 i = 0; i < Particles.Num(); ++i)
 	{
-		Velocities.Add(Particle.Velocity);
+		Velocities.Add(Particles[Remap ? (*Remap)[i] : i].Velocity);
 	}
 
 	return Velocities;
@@ -1494,9 +1688,10 @@ void UKawaiiFluidSimulationModule::ApplyExternalForce(FVector Force)
 
 void UKawaiiFluidSimulationModule::ApplyForceToParticle(int32 ParticleIndex, FVector Force)
 {
-	if (Particles.IsValidIndex(ParticleIndex))
+	const int32 Slot = ResolveParticleIndex(ParticleIndex);
+	if (Slot != INDEX_NONE)
 	{
-		Particles[ParticleIndex].Velocity += Force;
+		Particles[Slot].Velocity += Force;
 	}
 }
 
@@ -1518,9 +1713,10 @@ TArray<int32> UKawaiiFluidSimulationModule::GetParticlesInRadius(FVector Locatio
 	TArray<int32> Result;
 	const float RadiusSq = Radius * Radius;
 
+	const TArray<int32>* Remap = GetParticleIndexRemap();
 	for (int32 i = 0; i < Particles.Num(); ++i)
 	{
-		const float DistSq = FVector::DistSquared(Particles[i].Position, Location);
+		const float DistSq = FVector::DistSquared(Particles[Remap ? (*Remap)[i] : i].Position, Location);
 		if (DistSq <= RadiusSq)
 		{
 			Result.Add(i);
@@ -1535,9 +1731,10 @@ TArray<int32> UKawaiiFluidSimulationModule::GetParticlesInBox(FVector Center, FV
 	TArray<int32> Result;
 	const FBox Box(Center - Extent, Center + Extent);
 
+	const TArray<int32>* Remap = GetParticleIndexRemap();
 	for (int32 i = 0; i < Particles.Num(); ++i)
 	{
-		if (Box.IsInside(Particles[i].Position))
+		if (Box.IsInside(Particles[Remap ? (*Remap)[i] : i].Position))
 		{
 			Result.Add(i);
 		}
@@ -1548,12 +1745,13 @@ TArray<int32> UKawaiiFluidSimulationModule::GetParticlesInBox(FVector Center, FV
 
 bool UKawaiiFluidSimulationModule::GetParticleInfo(int32 ParticleIndex, FVector& OutPosition, FVector& OutVelocity, float& OutDensity) const
 {
-	if (!Particles.IsValidIndex(ParticleIndex))
+	const int32 Slot = ResolveParticleIndex(ParticleIndex);
+	if (Slot == INDEX_NONE)
 	{
 		return false;
 	}
 
-	const FKawaiiFluidParticle& Particle = Particles[ParticleIndex];
+	const FKawaiiFluidParticle& Particle = Particles[Slot];
 	OutPosition = Particle.Position;
 	OutVelocity = Particle.Velocity;
 	OutDensity = Particle.Density;
@@ -1848,149 +2046,49 @@ void UKawaiiFluidSimulationModule::SetSimulationVolume(const FVector& Size, cons
 }
 
 /**
- * @brief Manually resolves particle collisions with the volume boundaries on the CPU.
- * 
- * Particles are clamped to the box volume and their velocity is reflected or dampened 
- * based on wall bounce and friction settings.
+ * @brief Build the containment box for CPU boundary resolution (external volume or internal OBB).
+ * @return Boundary box with the effective center, extent, rotation, bounce and friction.
  */
-void UKawaiiFluidSimulationModule::ResolveVolumeBoundaryCollisions()
+FKawaiiFluidBoundaryBox UKawaiiFluidSimulationModule::GetVolumeBoundaryBox() const
 {
-	// Determine bounds parameters based on whether using external or internal volume
-	FVector EffectiveCenter;
-	FVector EffectiveHalfExtent;
-	FQuat EffectiveRotation;
-	float EffectiveBounce;
-	float EffectiveFriction;
+	FKawaiiFluidBoundaryBox Box;
 
 	// Get bounce/friction from Preset
-	const float PresetBounce = Preset ? Preset->Bounciness : 0.0f;
-	const float PresetFriction = Preset ? Preset->Friction : 0.5f;
+	Box.Bounce = Preset ? Preset->Bounciness : 0.0f;
+	Box.Friction = Preset ? Preset->Friction : 0.5f;
 
-	if (UKawaiiFluidVolumeComponent* ExternalVolume = GetTargetVolumeComponent())
+	UKawaiiFluidVolumeComponent* ExternalVolume = GetTargetVolumeComponent();
+	if (ExternalVolume && IsUsingExternalVolume())
 	{
-		if (IsUsingExternalVolume())
-		{
-			// Use external volume's parameters
-			EffectiveCenter = ExternalVolume->GetComponentLocation();
-			EffectiveHalfExtent = ExternalVolume->GetVolumeHalfExtent();
-			EffectiveRotation = FQuat::Identity;  // External volumes are axis-aligned
-			EffectiveBounce = ExternalVolume->GetWallBounce();
-			EffectiveFriction = ExternalVolume->GetWallFriction();
-		}
-		else
-		{
-			// Use internal volume parameters
-			EffectiveCenter = VolumeCenter;
-			EffectiveHalfExtent = GridResolutionPresetHelper::ClampExtentToMaxSupported(GetVolumeHalfExtent(), CellSize);
-			EffectiveRotation = VolumeRotationQuat;
-			EffectiveBounce = PresetBounce;
-			EffectiveFriction = PresetFriction;
-		}
+		// Use external volume's parameters (external volumes are axis-aligned)
+		Box.Center = ExternalVolume->GetComponentLocation();
+		Box.HalfExtent = ExternalVolume->GetVolumeHalfExtent();
+		Box.Rotation = FQuat::Identity;
+		Box.Bounce = ExternalVolume->GetWallBounce();
+		Box.Friction = ExternalVolume->GetWallFriction();
 	}
 	else
 	{
-		// Fallback to internal parameters
-		EffectiveCenter = VolumeCenter;
-		EffectiveHalfExtent = GridResolutionPresetHelper::ClampExtentToMaxSupported(GetVolumeHalfExtent(), CellSize);
-		EffectiveRotation = VolumeRotationQuat;
-		EffectiveBounce = PresetBounce;
-		EffectiveFriction = PresetFriction;
+		// Use internal volume parameters
+		Box.Center = VolumeCenter;
+		Box.HalfExtent = GridResolutionPresetHelper::ClampExtentToMaxSupported(GetVolumeHalfExtent(), CellSize);
+		Box.Rotation = VolumeRotationQuat;
 	}
 
-	// OBB (Oriented Bounding Box) collision handling
-	// Transform particles to local space, check AABB collision, then transform back to world
-	const FQuat InverseRotation = EffectiveRotation.Inverse();
-	const FVector LocalBoxMin = -EffectiveHalfExtent;
-	const FVector LocalBoxMax = EffectiveHalfExtent;
-
-	for (FKawaiiFluidParticle& P : Particles)
-	{
-		// World -> Local transformation
-		FVector LocalPos = InverseRotation.RotateVector(P.PredictedPosition - EffectiveCenter);
-		FVector LocalVel = InverseRotation.RotateVector(P.Velocity);
-		bool bCollided = false;
-
-		// Check AABB collision in local space
-		// Check X axis
-		if (LocalPos.X < LocalBoxMin.X)
-		{
-			LocalPos.X = LocalBoxMin.X;
-			if (LocalVel.X < 0.0f)
-			{
-				LocalVel.X = -LocalVel.X * EffectiveBounce;
-			}
-			LocalVel.Y *= (1.0f - EffectiveFriction);
-			LocalVel.Z *= (1.0f - EffectiveFriction);
-			bCollided = true;
-		}
-		else if (LocalPos.X > LocalBoxMax.X)
-		{
-			LocalPos.X = LocalBoxMax.X;
-			if (LocalVel.X > 0.0f)
-			{
-				LocalVel.X = -LocalVel.X * EffectiveBounce;
-			}
-			LocalVel.Y *= (1.0f - EffectiveFriction);
-			LocalVel.Z *= (1.0f - EffectiveFriction);
-			bCollided = true;
-		}
-
-		// Check Y axis
-		if (LocalPos.Y < LocalBoxMin.Y)
-		{
-			LocalPos.Y = LocalBoxMin.Y;
-			if (LocalVel.Y < 0.0f)
-			{
-				LocalVel.Y = -LocalVel.Y * EffectiveBounce;
-			}
-			LocalVel.X *= (1.0f - EffectiveFriction);
-			LocalVel.Z *= (1.0f - EffectiveFriction);
-			bCollided = true;
-		}
-		else if (LocalPos.Y > LocalBoxMax.Y)
-		{
-			LocalPos.Y = LocalBoxMax.Y;
-			if (LocalVel.Y > 0.0f)
-			{
-				LocalVel.Y = -LocalVel.Y * EffectiveBounce;
-			}
-			LocalVel.X *= (1.0f - EffectiveFriction);
-			LocalVel.Z *= (1.0f - EffectiveFriction);
-			bCollided = true;
-		}
-
-		// Check Z axis
-		if (LocalPos.Z < LocalBoxMin.Z)
-		{
-			LocalPos.Z = LocalBoxMin.Z;
-			if (LocalVel.Z < 0.0f)
-			{
-				LocalVel.Z = -LocalVel.Z * EffectiveBounce;
-			}
-			LocalVel.X *= (1.0f - EffectiveFriction);
-			LocalVel.Y *= (1.0f - EffectiveFriction);
-			bCollided = true;
-		}
-		else if (LocalPos.Z > LocalBoxMax.Z)
-		{
-			LocalPos.Z = LocalBoxMax.Z;
-			if (LocalVel.Z > 0.0f)
-			{
-				LocalVel.Z = -LocalVel.Z * EffectiveBounce;
-			}
-			LocalVel.X *= (1.0f - EffectiveFriction);
-			LocalVel.Y *= (1.0f - EffectiveFriction);
-			bCollided = true;
-		}
+	return Box;
+}
 
-		// Update Position/Velocity by transforming Local -> World
-		if (bCollided)
-		{
-			P.PredictedPosition = EffectiveCenter + EffectiveRotation.RotateVector(LocalPos);
-			P.Position = P.PredictedPosition;
-			P.Velocity = EffectiveRotation.RotateVector(LocalVel);
-		}
-	}
+/**
+ * @brief Resolves particle collisions with the volume boundaries on the CPU.
+ *
+ * Particles are clamped to the (oriented) box volume and their velocity is reflected or dampened
+ * based on wall bounce and friction settings. The same parallel sweep reduces the particle AABB
+ * into CachedParticleBounds.
+ */
+void UKawaiiFluidSimulationModule::ResolveVolumeBoundaryCollisions()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidModule_ResolveVolumeBoundary);
+	CachedParticleBounds = FKawaiiFluidBoundaryPass::ResolveAndComputeBounds(Particles, GetVolumeBoundaryBox());
 }
 
 // Legacy - redirects to new function
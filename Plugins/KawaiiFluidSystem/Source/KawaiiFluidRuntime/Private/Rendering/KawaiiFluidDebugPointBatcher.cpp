@@ -0,0 +1,498 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Rendering/KawaiiFluidDebugPointBatcher.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "Async/ParallelFor.h"
+#include "Components/LineBatchComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace
+{
+	constexpr int32 DebugPointsPerChunk = 8192;
+	constexpr int32 LUTSize = 256;
+	constexpr int32 MaxDecimationResolution = 32767;
+	constexpr float DefaultDebugFOVDegrees = 90.0f;
+	constexpr float DefaultDebugViewportWidth = 1920.0f;
+
+	/**
+	 * @brief Split a particle range into parallel chunks.
+	 * @param NumItems Number of items.
+	 * @param OutChunkSize Items per chunk.
+	 * @return Number of chunks (at least 1).
+	 */
+	int32 GetChunkCount(int32 NumItems, int32& OutChunkSize)
+	{
+		const int32 NumChunks = FMath::Clamp(FMath::DivideAndRoundUp(NumItems, DebugPointsPerChunk), 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+		OutChunkSize = FMath::DivideAndRoundUp(NumItems, NumChunks);
+		return NumChunks;
+	}
+
+	/**
+	 * @brief Octahedral mapping of a direction onto [0, 1]^2 (roughly equal-area angular cells).
+	 * @param Direction Non-zero direction.
+	 * @return Coordinates in [0, 1]^2.
+	 */
+	FVector2D OctahedralEncode(const FVector& Direction)
+	{
+		const double L1 = FMath::Abs(Direction.X) + FMath::Abs(Direction.Y) + FMath::Abs(Direction.Z);
+		FVector2D Oct(Direction.X / L1, Direction.Y / L1);
+		if (Direction.Z < 0.0)
+		{
+			Oct = FVector2D(
+				(1.0 - FMath::Abs(Oct.Y)) * (Oct.X >= 0.0 ? 1.0 : -1.0),
+				(1.0 - FMath::Abs(Oct.X)) * (Oct.Y >= 0.0 ? 1.0 : -1.0));
+		}
+		return Oct * 0.5 + FVector2D(0.5, 0.5);
+	}
+}
+
+//=============================================================================
+// FKawaiiFluidDebugPointSource
+//=============================================================================
+
+/**
+ * @brief Number of source particles.
+ * @return GPU position count, or CPU particle count when no GPU positions are set.
+ */
+int32 FKawaiiFluidDebugPointSource::Num() const
+{
+	return Positions.Num() > 0 ? Positions.Num() : Particles.Num();
+}
+
+/**
+ * @brief World position of a source particle.
+ * @param Index Particle index.
+ * @return Position.
+ */
+FVector FKawaiiFluidDebugPointSource::GetPosition(int32 Index) const
+{
+	return Positions.Num() > 0 ? FVector(Positions[Index]) : Particles[Index].Position;
+}
+
+/**
+ * @brief Density of a source particle (GPU readback positions carry no density).
+ * @param Index Particle index.
+ * @return Density, or 0 for GPU sources.
+ */
+float FKawaiiFluidDebugPointSource::GetDensity(int32 Index) const
+{
+	return Positions.Num() > 0 ? 0.0f : Particles[Index].Density;
+}
+
+//=============================================================================
+// FKawaiiFluidDebugPointBatcher
+//=============================================================================
+
+/**
+ * @brief 256-entry color table for a point debug mode (built once per mode, shared by all volumes).
+ * @param Mode Debug draw mode.
+ * @return Color LUT indexed by the per-particle LUT coordinate.
+ */
+const TArray<FColor>& FKawaiiFluidDebugPointBatcher::GetColorLUT(EKawaiiFluidDebugDrawMode Mode)
+{
+	static const TArray<TArray<FColor>> LUTs = []()
+	{
+		const int32 NumModes = static_cast<int32>(EKawaiiFluidDebugDrawMode::DebugDraw) + 1;
+		TArray<TArray<FColor>> Tables;
+		Tables.SetNum(NumModes);
+
+		for (int32 ModeIndex = 0; ModeIndex < NumModes; ++ModeIndex)
+		{
+			TArray<FColor>& Table = Tables[ModeIndex];
+			Table.SetNumUninitialized(LUTSize);
+
+			for (int32 i = 0; i < LUTSize; ++i)
+			{
+				const uint8 T = static_cast<uint8>(i);
+				const float Alpha = static_cast<float>(i) / static_cast<float>(LUTSize - 1);
+
+				switch (static_cast<EKawaiiFluidDebugDrawMode>(ModeIndex))
+				{
+				case EKawaiiFluidDebugDrawMode::Point_ZOrderArrayIndex:
+				case EKawaiiFluidDebugDrawMode::Point_ZOrderPreSortIndex:
+				case EKawaiiFluidDebugDrawMode::Point_ZOrderMortonCode:
+				case EKawaiiFluidDebugDrawMode::DebugDraw:
+					Table[i] = FLinearColor::MakeFromHSV8(T, 255, 255).ToFColor(true);
+					break;
+				case EKawaiiFluidDebugDrawMode::Point_PositionX:
+					Table[i] = FColor(T, 50, 50);
+					break;
+				case EKawaiiFluidDebugDrawMode::Point_PositionY:
+					Table[i] = FColor(50, T, 50);
+					break;
+				case EKawaiiFluidDebugDrawMode::Point_PositionZ:
+					Table[i] = FColor(50, 50, T);
+					break;
+				case EKawaiiFluidDebugDrawMode::Point_Density:
+					Table[i] = FLinearColor::LerpUsingHSV(FLinearColor::Blue, FLinearColor::Red, Alpha).ToFColor(true);
+					break;
+				case EKawaiiFluidDebugDrawMode::Point_IsAttached:
+					// Upper half = near boundary (green), lower half = free particle (blue)
+					Table[i] = (i >= LUTSize / 2) ? FColor(50, 255, 50, 255) : FColor(50, 100, 255, 255);
+					break;
+				default:
+					Table[i] = FColor::White;
+					break;
+				}
+			}
+		}
+
+		return Tables;
+	}();
+
+	const int32 ModeIndex = FMath::Clamp(static_cast<int32>(Mode), 0, LUTs.Num() - 1);
+	return LUTs[ModeIndex];
+}
+
+/**
+ * @brief LUT coordinate for one particle in the current mode.
+ * @param Source Particle data.
+ * @param Settings Build settings.
+ * @param Index Particle index.
+ * @param TotalCount Total particle count (index-based modes).
+ * @return Coordinate into the mode's color LUT.
+ */
+uint8 FKawaiiFluidDebugPointBatcher::GetLUTCoordinate(const FKawaiiFluidDebugPointSource& Source, const FKawaiiFluidDebugPointSettings& Settings, int32 Index, int32 TotalCount) const
+{
+	auto ToCoordinate = [](double Normalized)
+	{
+		return static_cast<uint8>(FMath::Clamp(Normalized, 0.0, 1.0) * 255.0);
+	};
+
+	switch (Settings.Mode)
+	{
+	case EKawaiiFluidDebugDrawMode::Point_ZOrderArrayIndex:
+	case EKawaiiFluidDebugDrawMode::Point_ZOrderPreSortIndex:
+	case EKawaiiFluidDebugDrawMode::DebugDraw:
+		{
+			// Pre-sort: ParticleID (= spawn order). Post-sort: Z-Order array index, falling back to array index.
+			int32 ColorIndex = Index;
+			const int32 ParticleID = Source.ParticleIDs.IsValidIndex(Index) ? Source.ParticleIDs[Index] : INDEX_NONE;
+			if (Settings.Mode == EKawaiiFluidDebugDrawMode::Point_ZOrderPreSortIndex && ParticleID >= 0)
+			{
+				ColorIndex = ParticleID;
+			}
+			else if (Settings.Mode == EKawaiiFluidDebugDrawMode::Point_ZOrderArrayIndex && Source.ZOrderIndices.IsValidIndex(ParticleID))
+			{
+				ColorIndex = Source.ZOrderIndices[ParticleID];
+			}
+			return ToCoordinate(TotalCount > 1 ? static_cast<double>(ColorIndex) / (TotalCount - 1) : 0.0);
+		}
+
+	case EKawaiiFluidDebugDrawMode::Point_ZOrderMortonCode:
+		{
+			// Morton-like hue from the normalized position (not a full Morton code, but visually similar)
+			const FVector Range = Bounds.GetSize();
+			const double MaxRange = FMath::Max(Range.GetMax(), static_cast<double>(KINDA_SMALL_NUMBER));
+			const FVector NormPos = ((Source.GetPosition(Index) - Bounds.Min) / MaxRange).BoundToBox(FVector::ZeroVector, FVector::OneVector);
+			return ToCoordinate((NormPos.X + NormPos.Y + NormPos.Z) * 0.33);
+		}
+
+	case EKawaiiFluidDebugDrawMode::Point_PositionX:
+	case EKawaiiFluidDebugDrawMode::Point_PositionY:
+	case EKawaiiFluidDebugDrawMode::Point_PositionZ:
+		{
+			const int32 Axis = static_cast<int32>(Settings.Mode) - static_cast<int32>(EKawaiiFluidDebugDrawMode::Point_PositionX);
+			const double Range = Bounds.Max[Axis] - Bounds.Min[Axis];
+			return ToCoordinate(Range > KINDA_SMALL_NUMBER ? (Source.GetPosition(Index)[Axis] - Bounds.Min[Axis]) / Range : 0.0);
+		}
+
+	case EKawaiiFluidDebugDrawMode::Point_Density:
+		return ToCoordinate(Source.GetDensity(Index) / (FMath::Max(Settings.RestDensity, KINDA_SMALL_NUMBER) * 2.0f));
+
+	case EKawaiiFluidDebugDrawMode::Point_IsAttached:
+		{
+			const bool bNearBoundary = Source.Flags.IsValidIndex(Index) && (Source.Flags[Index] & EGPUParticleFlags::NearBoundary);
+			return bNearBoundary ? 255 : 0;
+		}
+
+	default:
+		return 0;
+	}
+}
+
+/**
+ * @brief Keep only the nearest particle per screen-space cell around the view.
+ *
+ * Cells are angular (octahedral map of the direction from the view), so the result does not depend
+ * on the view rotation and the build stays valid while the camera turns in place.
+ *
+ * @param Source Particle data.
+ * @param Settings Build settings (DecimationPixels, PixelAngle).
+ * @param ViewLocation View origin.
+ */
+void FKawaiiFluidDebugPointBatcher::DecimateInScreenSpace(const FKawaiiFluidDebugPointSource& Source, const FKawaiiFluidDebugPointSettings& Settings, const FVector& ViewLocation)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FluidDebugPoints_Decimate);
+
+	const int32 NumParticles = Source.Num();
+
+	// One octahedral unit spans roughly sqrt(pi) radians
+	const double CellAngle = static_cast<double>(Settings.PixelAngle) * Settings.DecimationPixels;
+	const int32 Resolution = FMath::Clamp(FMath::CeilToInt32(2.0 * FMath::Sqrt(UE_DOUBLE_PI) / CellAngle), 1, MaxDecimationResolution);
+
+	int32 ChunkSize = 0;
+	const int32 NumChunks = GetChunkCount(NumParticles, ChunkSize);
+
+	// Per chunk: cell -> packed (distance bits, index); positive float bits order like the floats
+	TArray<TMap<uint32, uint64>> ChunkCells;
+	ChunkCells.SetNum(NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 StartIdx = ChunkIndex * ChunkSize;
+		const int32 EndIdx = FMath::Min(StartIdx + ChunkSize, NumParticles);
+		TMap<uint32, uint64>& LocalCells = ChunkCells[ChunkIndex];
+		LocalCells.Reserve(EndIdx - StartIdx);
+
+		for (int32 i = StartIdx; i < EndIdx; ++i)
+		{
+			const FVector ToParticle = Source.GetPosition(i) - ViewLocation;
+			const float Distance = static_cast<float>(ToParticle.Size());
+
+			uint32 CellKey = MAX_uint32;  // Particles at the view origin share one cell
+			if (Distance > KINDA_SMALL_NUMBER)
+			{
+				const FVector2D Oct = OctahedralEncode(ToParticle);
+				const uint32 CellX = static_cast<uint32>(FMath::Min(FMath::FloorToInt32(Oct.X * Resolution), Resolution - 1));
+				const uint32 CellY = static_cast<uint32>(FMath::Min(FMath::FloorToInt32(Oct.Y * Resolution), Resolution - 1));
+				CellKey = CellY * static_cast<uint32>(Resolution) + CellX;
+			}
+
+			const uint64 Packed = (static_cast<uint64>(FMath::AsUInt(Distance)) << 32) | static_cast<uint32>(i);
+			uint64& Best = LocalCells.FindOrAdd(CellKey, MAX_uint64);
+			Best = FMath::Min(Best, Packed);
+		}
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Merge (min is order-independent, so the result is deterministic)
+	TMap<uint32, uint64>& Cells = ChunkCells[0];
+	for (int32 c = 1; c < NumChunks; ++c)
+	{
+		for (const TPair<uint32, uint64>& Pair : ChunkCells[c])
+		{
+			uint64& Best = Cells.FindOrAdd(Pair.Key, MAX_uint64);
+			Best = FMath::Min(Best, Pair.Value);
+		}
+	}
+
+	KeptIndices.Reset(Cells.Num());
+	for (const TPair<uint32, uint64>& Pair : Cells)
+	{
+		KeptIndices.Add(static_cast<int32>(Pair.Value & MAX_uint32));
+	}
+	KeptIndices.Sort();
+}
+
+/**
+ * @brief Build the batched point buffer (parallel bounds, decimation, budget and color passes).
+ * @param Source Particle data.
+ * @param Settings Mode, decimation and budget.
+ * @param ViewLocation View origin for screen-space decimation (nullptr disables decimation).
+ * @param SourceVersion Version of the source data (0 = unversioned, always rebuilt).
+ */
+void FKawaiiFluidDebugPointBatcher::Build(const FKawaiiFluidDebugPointSource& Source, const FKawaiiFluidDebugPointSettings& Settings,
+	const FVector* ViewLocation, uint64 SourceVersion)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FluidDebugPoints_Build);
+
+	LastSettings = Settings;
+	LastSourceVersion = SourceVersion;
+	bHasView = ViewLocation != nullptr;
+	LastViewLocation = bHasView ? *ViewLocation : FVector::ZeroVector;
+	bBuilt = true;
+
+	Points.Reset();
+	Colors.Reset();
+	KeptIndices.Reset();
+
+	const int32 NumParticles = Source.Num();
+	if (NumParticles == 0)
+	{
+		return;
+	}
+
+	int32 ChunkSize = 0;
+	const int32 NumChunks = GetChunkCount(NumParticles, ChunkSize);
+
+	// Parallel bounds reduction (position-based coloring)
+	{
+		TArray<FBox> ChunkBounds;
+		ChunkBounds.Init(FBox(ForceInit), NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 StartIdx = ChunkIndex * ChunkSize;
+			const int32 EndIdx = FMath::Min(StartIdx + ChunkSize, NumParticles);
+			FBox& LocalBounds = ChunkBounds[ChunkIndex];
+			for (int32 i = StartIdx; i < EndIdx; ++i)
+			{
+				LocalBounds += Source.GetPosition(i);
+			}
+		}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		Bounds = FBox(ForceInit);
+		for (const FBox& LocalBounds : ChunkBounds)
+		{
+			Bounds += LocalBounds;
+		}
+	}
+
+	// Screen-space decimation
+	if (ViewLocation && Settings.DecimationPixels > 0.0f && Settings.PixelAngle > 0.0f)
+	{
+		DecimateInScreenSpace(Source, Settings, *ViewLocation);
+	}
+	else
+	{
+		KeptIndices.SetNumUninitialized(NumParticles);
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			KeptIndices[i] = i;
+		}
+	}
+
+	// Frame budget: evenly strided subset (deterministic, spatially unbiased)
+	const int32 NumKept = KeptIndices.Num();
+	const int32 NumPoints = (Settings.MaxPoints > 0) ? FMath::Min(NumKept, Settings.MaxPoints) : NumKept;
+
+	Points.SetNumUninitialized(NumPoints);
+	Colors.SetNumUninitialized(NumPoints);
+
+	const TArray<FColor>& LUT = GetColorLUT(Settings.Mode);
+	int32 PointChunkSize = 0;
+	const int32 NumPointChunks = GetChunkCount(NumPoints, PointChunkSize);
+
+	ParallelFor(NumPointChunks, [&](int32 ChunkIndex)
+	{
+		const int32 StartIdx = ChunkIndex * PointChunkSize;
+		const int32 EndIdx = FMath::Min(StartIdx + PointChunkSize, NumPoints);
+		for (int32 p = StartIdx; p < EndIdx; ++p)
+		{
+			const int32 KeptSlot = (NumPoints == NumKept) ? p : static_cast<int32>(static_cast<int64>(p) * NumKept / NumPoints);
+			const int32 Index = KeptIndices[KeptSlot];
+
+			Points[p] = Source.GetPosition(Index);
+			Colors[p] = LUT[GetLUTCoordinate(Source, Settings, Index, NumParticles)].ReinterpretAsLinear();
+		}
+	}, NumPointChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+/**
+ * @brief Whether the last build can be reused for this frame.
+ * @param Settings Current settings.
+ * @param ViewLocation Current view origin (nullptr = no view).
+ * @param SourceVersion Current source data version (0 = unversioned, never up to date).
+ * @return True if source, settings and view are unchanged.
+ */
+bool FKawaiiFluidDebugPointBatcher::IsUpToDate(const FKawaiiFluidDebugPointSettings& Settings, const FVector* ViewLocation, uint64 SourceVersion) const
+{
+	if (!bBuilt || SourceVersion == 0 || SourceVersion != LastSourceVersion || !(Settings == LastSettings))
+	{
+		return false;
+	}
+
+	if ((ViewLocation != nullptr) != bHasView)
+	{
+		return false;
+	}
+
+	// Decimation cells are angular: a view move below one point size barely changes which particle wins a cell
+	return !ViewLocation || FVector::DistSquared(*ViewLocation, LastViewLocation) <= FMath::Square(Settings.PointSize);
+}
+
+/**
+ * @brief Submit the batched points to the world line batcher for this frame.
+ * @param World Target world.
+ */
+void FKawaiiFluidDebugPointBatcher::Draw(UWorld* World) const
+{
+#if ENABLE_DRAW_DEBUG
+	TRACE_CPUPROFILER_EVENT_SCOPE(FluidDebugPoints_Draw);
+
+	if (!World || Points.Num() == 0)
+	{
+		return;
+	}
+
+	ULineBatchComponent* LineBatcher = World->GetLineBatcher(UWorld::ELineBatcherType::World);
+	if (!LineBatcher)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < Points.Num(); ++i)
+	{
+		LineBatcher->DrawPoint(Points[i], Colors[i], LastSettings.PointSize, SDPG_World);
+	}
+#endif
+}
+
+/**
+ * @brief Drop the cached build.
+ */
+void FKawaiiFluidDebugPointBatcher::Reset()
+{
+	Points.Empty();
+	Colors.Empty();
+	KeptIndices.Empty();
+	LastSourceVersion = 0;
+	bBuilt = false;
+}
+
+/**
+ * @brief Current view origin and per-pixel angle for screen-space decimation.
+ * @param World World to query.
+ * @param OutViewLocation View origin.
+ * @param OutPixelAngle Angle subtended by one pixel (radians).
+ * @return False if no view is available.
+ */
+bool FKawaiiFluidDebugPointBatcher::GetDebugView(const UWorld* World, FVector& OutViewLocation, float& OutPixelAngle)
+{
+	if (!World)
+	{
+		return false;
+	}
+
+	float FOVDegrees = DefaultDebugFOVDegrees;
+	bool bHasLocation = false;
+
+	const APlayerController* PC = World->GetFirstPlayerController();
+	if (PC && PC->PlayerCameraManager)
+	{
+		FOVDegrees = PC->PlayerCameraManager->GetFOVAngle();
+		OutViewLocation = PC->PlayerCameraManager->GetCameraLocation();
+		bHasLocation = true;
+	}
+
+	// Filled by the renderer for editor viewports and game views alike
+	if (World->ViewLocationsRenderedLastFrame.Num() > 0)
+	{
+		OutViewLocation = World->ViewLocationsRenderedLastFrame[0];
+		bHasLocation = true;
+	}
+
+	if (!bHasLocation)
+	{
+		return false;
+	}
+
+	float ViewportWidth = DefaultDebugViewportWidth;
+	if (GEngine && GEngine->GameViewport)
+	{
+		FVector2D ViewportSize;
+		GEngine->GameViewport->GetViewportSize(ViewportSize);
+		if (ViewportSize.X > 0.0)
+		{
+			ViewportWidth = static_cast<float>(ViewportSize.X);
+		}
+	}
+
+	OutPixelAngle = FMath::DegreesToRadians(FMath::Clamp(FOVDegrees, 1.0f, 170.0f)) / ViewportWidth;
+	return true;
+}
@@ -7,7 +7,27 @@
 #include "Core/KawaiiFluidPresetDataAsset.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Simulation/KawaiiFluidSimulator.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
 #include "Engine/StaticMesh.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	// Particles that moved less than this since their slot was written are not resubmitted (cm²)
+	constexpr float ProxyPositionEpsilonSq = 0.01f * 0.01f;
+
+	// Velocity change that requires a rotation/color refresh ((cm/s)²)
+	constexpr float ProxyVelocityEpsilonSq = 1.0f;
+
+	/**
+	 * @brief Transform for an unused pool slot (zero scale hides the instance without removing it).
+	 * @param Anchor Location kept near the fluid so hidden slots do not inflate the component bounds.
+	 */
+	FTransform MakeHiddenInstanceTransform(const FVector& Anchor)
+	{
+		return FTransform(FQuat::Identity, Anchor, FVector::ZeroVector);
+	}
+}
 
 UKawaiiFluidProxyRenderer::UKawaiiFluidProxyRenderer()
 {
@@ -50,9 +70,11 @@ void UKawaiiFluidProxyRenderer::Initialize(UWorld* InWorld, USceneComponent* InO
 
 void UKawaiiFluidProxyRenderer::Cleanup()
 {
+	ReleaseReadbackFields();
+
 	if (ISMComponent)
 	{
-		ISMComponent->ClearInstances();
+		ReleaseInstancePool();
 		ISMComponent->DestroyComponent(); // Unregister and destroy
 		ISMComponent = nullptr;
 	}
@@ -68,14 +90,32 @@ void UKawaiiFluidProxyRenderer::SetEnabled(bool bInEnabled)
 {
 	bEnabled = bInEnabled;
 
+	// A disabled renderer no longer reads the snapshot, so stop requesting its fields
+	if (!bEnabled)
+	{
+		ReleaseReadbackFields();
+	}
+
 	// Clear instances when disabled and force render state update
 	if (!bEnabled && ISMComponent)
 	{
-		ISMComponent->ClearInstances();
+		ReleaseInstancePool();
 		ISMComponent->MarkRenderStateDirty();
 	}
 }
 
+/**
+ * @brief Remove the Proxy readback registration from the simulator it was made on.
+ */
+void UKawaiiFluidProxyRenderer::ReleaseReadbackFields()
+{
+	if (TSharedPtr<FKawaiiFluidSimulator> Simulator = ReadbackSimulator.Pin())
+	{
+		Simulator->SetReadbackConsumerFields(EKawaiiFluidReadbackConsumer::Proxy, EKawaiiFluidReadbackField::None);
+	}
+	ReadbackSimulator.Reset();
+}
+
 /**
  * @brief Synchronizes Proxy instance transforms with current particle data from the provider.
  * 
@@ -107,33 +147,55 @@ void UKawaiiFluidProxyRenderer::UpdateRendering(const IKawaiiFluidDataProvider*
 	}
 
 	// Get simulation data from DataProvider (GPU or CPU)
-	TArray<FVector3f> Positions;
-	TArray<FVector3f> Velocities;
+	// GPU mode reads the held snapshot in place, CPU mode fills the local arrays
+	TSharedPtr<const FKawaiiFluidParticleSnapshot> Snapshot;
+	TArray<FVector3f> CPUPositions;
+	TArray<FVector3f> CPUVelocities;
+	TArray<int32> CPUParticleIDs;
+	TConstArrayView<FVector3f> Positions;
+	TConstArrayView<FVector3f> Velocities;
+	TConstArrayView<int32> ParticleIDs;
 
 	if (DataProvider->IsGPUSimulationActive())
 	{
-		// GPU mode: Use lightweight readback API (Position + Velocity only)
-		FKawaiiFluidSimulator* Simulator = DataProvider->GetGPUSimulator();
+		// GPU mode: Use the latest readback snapshot (Position + Velocity + Flags from the same readback)
+		TSharedPtr<FKawaiiFluidSimulator> Simulator = DataProvider->GetGPUSimulatorShared();
 		if (Simulator)
 		{
-			// Enable velocity readback for Proxy rendering
-			Simulator->SetFullReadbackEnabled(true);
+			// Request the fields Proxy rendering reads (positions, velocities, IDs, flags)
+			if (ReadbackSimulator.Pin() != Simulator)
+			{
+				ReleaseReadbackFields();
+				ReadbackSimulator = Simulator;
+			}
+			Simulator->SetReadbackConsumerFields(EKawaiiFluidReadbackConsumer::Proxy, EKawaiiFluidReadbackField::ProxySet);
 
 			// Clear instances when GPU has no particles (prevents stale cache rendering)
 			if (Simulator->GetParticleCount() <= 0)
 			{
 				if (ISMComponent->GetInstanceCount() > 0)
 				{
-					ISMComponent->ClearInstances();
+					ReleaseInstancePool();
 				}
 				return;
 			}
 
-			if (!Simulator->GetParticlePositionsAndVelocities(Positions, Velocities))
+			Snapshot = Simulator->GetParticleSnapshot();
+			if (!Snapshot.IsValid() || !Snapshot->HasPositions())
 			{
 				// Readback not yet available — keep previous frame's instances
 				return;
 			}
+
+			Positions = Snapshot->Positions;
+			if (Snapshot->HasVelocities())
+			{
+				Velocities = Snapshot->Velocities;
+			}
+			if (Snapshot->HasParticleIDs())
+			{
+				ParticleIDs = Snapshot->ParticleIDs;
+			}
 		}
 		else
 		{
@@ -143,20 +205,27 @@ void UKawaiiFluidProxyRenderer::UpdateRendering(const IKawaiiFluidDataProvider*
 	else
 	{
 		// CPU mode: Extract positions and velocities from particle array
+		ReleaseReadbackFields();
+
 		const TArray<FKawaiiFluidParticle>& CPUParticles = DataProvider->GetParticles();
 		const int32 Count = CPUParticles.Num();
-		Positions.SetNumUninitialized(Count);
-		Velocities.SetNumUninitialized(Count);
-		for (int32 i = 0; i < Count; ++i)
+		CPUPositions.SetNumUninitialized(Count);
+		CPUVelocities.SetNumUninitialized(Count);
+		CPUParticleIDs.SetNumUninitialized(Count);
+		ParallelFor(Count, [&](int32 i)
 		{
-			Positions[i] = FVector3f(CPUParticles[i].Position);
-			Velocities[i] = FVector3f(CPUParticles[i].Velocity);
-		}
+			CPUPositions[i] = FVector3f(CPUParticles[i].Position);
+			CPUVelocities[i] = FVector3f(CPUParticles[i].Velocity);
+			CPUParticleIDs[i] = CPUParticles[i].ParticleID;
+		}, Count < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+		Positions = CPUPositions;
+		Velocities = CPUVelocities;
+		ParticleIDs = CPUParticleIDs;
 	}
 
 	if (Positions.Num() == 0)
 	{
-		ISMComponent->ClearInstances();
+		ReleaseInstancePool();
 		return;
 	}
 
@@ -171,13 +240,9 @@ void UKawaiiFluidProxyRenderer::UpdateRendering(const IKawaiiFluidDataProvider*
 			ISMComponent->GetInstanceCount());
 	}
 
-	// Use all particles without limit for the debug/proxy view
+	// Use all particles without limit for the debug/proxy view (particle i -> pool slot i)
 	const int32 NumInstances = Positions.Num();
 
-	// Clear existing instances and preallocate memory
-	ISMComponent->ClearInstances();
-	ISMComponent->PreAllocateInstancesMemory(NumInstances);
-
 	// Get ParticleRadius from Preset (simulation radius for accurate debug visualization)
 	float ParticleRadius = 5.0f; // Default fallback
 	if (CachedPreset)
@@ -186,61 +251,252 @@ void UKawaiiFluidProxyRenderer::UpdateRendering(const IKawaiiFluidDataProvider*
 	}
 
 	// Scale factor based on ParticleRadius (Default Sphere has 50cm radius)
-	float ScaleFactor = ParticleRadius / 50.0f;
-	FVector ScaleVec(ScaleFactor, ScaleFactor, ScaleFactor);
+	const float ScaleFactor = ParticleRadius / 50.0f;
+	const FVector ScaleVec(ScaleFactor, ScaleFactor, ScaleFactor);
 
 	// Check if velocities available
 	const bool bHasVelocities = Velocities.Num() == Positions.Num();
+	const bool bHasParticleIDs = ParticleIDs.Num() == Positions.Num();
+	const bool bUseColor = bColorByVelocity && bHasVelocities;
+	const bool bTrackVelocity = (bRotateByVelocity || bColorByVelocity) && bHasVelocities;
 
-	// Add each particle as an instance
-	int32 InstanceIndex = 0;
-	for (int32 i = 0; i < NumInstances; ++i)
+	if (bUseColor && ISMComponent->NumCustomDataFloats != 4)
 	{
-		const FVector3f& Position = Positions[i];
+		ISMComponent->SetNumCustomDataFloats(4); // RGBA
+	}
+
+	// Visual settings changed: every slot has to be rebuilt
+	const uint32 SettingsHash = ComputeSettingsHash(ScaleFactor);
+	const bool bForceFullUpdate = SettingsHash != LastSettingsHash;
+	LastSettingsHash = SettingsHash;
+
+	// Sleeping particles keep their previous transform (GPU mode only, flags come from the same snapshot)
+	const TArray<uint32>* ParticleFlags = Snapshot.IsValid() && Snapshot->HasFlags() ? &Snapshot->Flags : nullptr;
 
-		// Skip NaN/Inf positions (can occur from stale readback after despawn compaction)
-		if (!FMath::IsFinite(Position.X) || !FMath::IsFinite(Position.Y) || !FMath::IsFinite(Position.Z))
+	ResizeInstancePool(NumInstances);
+	const int32 PreviousActiveCount = ActiveInstanceCount;
+
+	// Hidden slots stay near the fluid so UpdateBounds does not stretch to the origin
+	FVector HiddenAnchor = FVector::ZeroVector;
+	for (const FVector3f& Position : Positions)
+	{
+		if (FMath::IsFinite(Position.X) && FMath::IsFinite(Position.Y) && FMath::IsFinite(Position.Z))
 		{
-			continue;
+			HiddenAnchor = FVector(Position);
+			break;
 		}
+	}
 
-		const FVector3f Velocity = bHasVelocities ? Velocities[i] : FVector3f::ZeroVector;
+	// Parallel transform build: one task per block, only changed particles are rewritten
+	const int32 NumBlocks = FMath::DivideAndRoundUp(FMath::Max(NumInstances, PreviousActiveCount), InstanceUpdateBlockSize);
+	TArray<uint8> DirtyBlocks;
+	DirtyBlocks.SetNumZeroed(NumBlocks);
 
-		// Create transform
-		FTransform InstanceTransform;
-		InstanceTransform.SetLocation(FVector(Position));
-		InstanceTransform.SetScale3D(ScaleVec);
+	ParallelFor(NumBlocks, [&](int32 BlockIndex)
+	{
+		const int32 StartIdx = BlockIndex * InstanceUpdateBlockSize;
+		const int32 EndIdx = FMath::Min(StartIdx + InstanceUpdateBlockSize, FMath::Max(NumInstances, PreviousActiveCount));
+		bool bBlockDirty = false;
 
-		// Velocity-based rotation (optional)
-		if (bRotateByVelocity && bHasVelocities && !Velocity.IsNearlyZero())
+		for (int32 i = StartIdx; i < EndIdx; ++i)
 		{
-			FRotator Rotation = FVector(Velocity).ToOrientationRotator();
-			InstanceTransform.SetRotation(Rotation.Quaternion());
+			// Slot no longer used this frame: hide it once
+			if (i >= NumInstances)
+			{
+				InstanceTransforms[i] = MakeHiddenInstanceTransform(HiddenAnchor);
+				RenderedParticleIDs[i] = INDEX_NONE;
+				bBlockDirty = true;
+				continue;
+			}
+
+			const FVector3f& Position = Positions[i];
+			const FVector3f Velocity = bHasVelocities ? Velocities[i] : FVector3f::ZeroVector;
+			const int32 ParticleID = bHasParticleIDs ? ParticleIDs[i] : INDEX_NONE;
+
+			// Sorting and compaction move particles between slots: the shortcuts only hold for the same particle
+			const bool bSlotValid = !bForceFullUpdate && i < PreviousActiveCount
+				&& ParticleID != INDEX_NONE && RenderedParticleIDs[i] == ParticleID;
+
+			if (bSlotValid)
+			{
+				if (ParticleFlags && ((*ParticleFlags)[i] & EGPUParticleFlags::IsSleeping))
+				{
+					continue;
+				}
+
+				const bool bMoved = FVector3f::DistSquared(Position, RenderedPositions[i]) > ProxyPositionEpsilonSq;
+				const bool bVelocityChanged = bTrackVelocity && FVector3f::DistSquared(Velocity, RenderedVelocities[i]) > ProxyVelocityEpsilonSq;
+				if (!bMoved && !bVelocityChanged)
+				{
+					continue;
+				}
+			}
+
+			RenderedPositions[i] = Position;
+			RenderedVelocities[i] = Velocity;
+			RenderedParticleIDs[i] = ParticleID;
+			bBlockDirty = true;
+
+			// Skip NaN/Inf positions (can occur from stale readback after despawn compaction)
+			if (!FMath::IsFinite(Position.X) || !FMath::IsFinite(Position.Y) || !FMath::IsFinite(Position.Z))
+			{
+				InstanceTransforms[i] = MakeHiddenInstanceTransform(HiddenAnchor);
+				continue;
+			}
+
+			// Create transform
+			FTransform& InstanceTransform = InstanceTransforms[i];
+			InstanceTransform.SetIdentity();
+			InstanceTransform.SetLocation(FVector(Position));
+			InstanceTransform.SetScale3D(ScaleVec);
+
+			// Velocity-based rotation (optional)
+			if (bRotateByVelocity && bHasVelocities && !Velocity.IsNearlyZero())
+			{
+				InstanceTransform.SetRotation(FVector(Velocity).ToOrientationQuat());
+			}
+
+			// Velocity-based color (optional), passed as custom data (available in material)
+			if (bUseColor)
+			{
+				const float T = FMath::Clamp(Velocity.Size() / MaxVelocityForColor, 0.0f, 1.0f);
+				const FLinearColor Color = FMath::Lerp(MinVelocityColor, MaxVelocityColor, T);
+
+				float* CustomData = &InstanceCustomData[i * 4];
+				CustomData[0] = Color.R;
+				CustomData[1] = Color.G;
+				CustomData[2] = Color.B;
+				CustomData[3] = Color.A;
+			}
 		}
 
-		// Add instance to the ISM component
-		ISMComponent->AddInstance(InstanceTransform, false);
+		DirtyBlocks[BlockIndex] = bBlockDirty ? 1 : 0;
+	}, EParallelForFlags::Unbalanced);
+
+	ActiveInstanceCount = NumInstances;
+
+	// Submit contiguous runs of dirty blocks as single batched updates
+	bool bAnySubmitted = false;
+	const int32 SlotCount = FMath::Max(NumInstances, PreviousActiveCount);
+	for (int32 BlockIndex = 0; BlockIndex < NumBlocks; )
+	{
+		if (!DirtyBlocks[BlockIndex])
+		{
+			++BlockIndex;
+			continue;
+		}
 
-		// Velocity-based color (optional)
-		if (bColorByVelocity && bHasVelocities)
+		const int32 RunStartBlock = BlockIndex;
+		while (BlockIndex < NumBlocks && DirtyBlocks[BlockIndex])
 		{
-			float VelocityMagnitude = Velocity.Size();
-			float T = FMath::Clamp(VelocityMagnitude / MaxVelocityForColor, 0.0f, 1.0f);
-			FLinearColor Color = FMath::Lerp(MinVelocityColor, MaxVelocityColor, T);
-
-			// Pass color as custom data (available in material)
-			ISMComponent->SetCustomDataValue(InstanceIndex, 0, Color.R, false);
-			ISMComponent->SetCustomDataValue(InstanceIndex, 1, Color.G, false);
-			ISMComponent->SetCustomDataValue(InstanceIndex, 2, Color.B, false);
-			ISMComponent->SetCustomDataValue(InstanceIndex, 3, Color.A, false);
+			++BlockIndex;
 		}
 
-		++InstanceIndex;
+		const int32 RunStart = RunStartBlock * InstanceUpdateBlockSize;
+		const int32 RunEnd = FMath::Min(BlockIndex * InstanceUpdateBlockSize, SlotCount);
+
+		ISMComponent->BatchUpdateInstancesTransforms(
+			RunStart,
+			MakeArrayView(InstanceTransforms.GetData() + RunStart, RunEnd - RunStart),
+			/*bWorldSpace=*/true,
+			/*bMarkRenderStateDirty=*/false,
+			/*bTeleport=*/true);
+
+		if (bUseColor)
+		{
+			for (int32 i = RunStart; i < FMath::Min(RunEnd, NumInstances); ++i)
+			{
+				ISMComponent->SetCustomData(i, MakeArrayView(&InstanceCustomData[i * 4], 4), false);
+			}
+		}
+
+		bAnySubmitted = true;
 	}
 
 	// Update bounds and render state - essential for Virtual Shadow Maps (VSM) and Cascaded Shadows
-	ISMComponent->UpdateBounds();
-	ISMComponent->MarkRenderStateDirty();
+	if (bAnySubmitted)
+	{
+		ISMComponent->UpdateBounds();
+		ISMComponent->MarkRenderStateDirty();
+	}
+}
+
+/**
+ * @brief Grow or shrink the persistent instance pool in InstancePoolChunkSize steps.
+ * 
+ * Shrinking keeps one spare chunk of hysteresis so a particle count oscillating around a
+ * chunk boundary does not add and remove instances every frame.
+ * 
+ * @param RequiredCount Number of slots that must be available.
+ */
+void UKawaiiFluidProxyRenderer::ResizeInstancePool(int32 RequiredCount)
+{
+	const int32 CurrentCount = ISMComponent->GetInstanceCount();
+	const int32 TargetCount = FMath::DivideAndRoundUp(RequiredCount, InstancePoolChunkSize) * InstancePoolChunkSize;
+
+	if (TargetCount > CurrentCount)
+	{
+		TArray<FTransform> NewSlots;
+		NewSlots.Init(MakeHiddenInstanceTransform(FVector::ZeroVector), TargetCount - CurrentCount);
+		ISMComponent->PreAllocateInstancesMemory(TargetCount - CurrentCount);
+		ISMComponent->AddInstances(NewSlots, /*bShouldReturnIndices=*/false, /*bWorldSpace=*/true);
+	}
+	else if (CurrentCount - TargetCount > InstancePoolChunkSize)
+	{
+		const int32 KeepCount = TargetCount + InstancePoolChunkSize;
+		TArray<int32> TailIndices;
+		TailIndices.Reserve(CurrentCount - KeepCount);
+		for (int32 Index = CurrentCount - 1; Index >= KeepCount; --Index)
+		{
+			TailIndices.Add(Index);
+		}
+		ISMComponent->RemoveInstances(TailIndices);
+	}
+
+	// Mirror arrays follow the component's slot count
+	const int32 PoolCount = ISMComponent->GetInstanceCount();
+	InstanceTransforms.SetNum(PoolCount);
+	RenderedPositions.SetNum(PoolCount);
+	RenderedVelocities.SetNum(PoolCount);
+	RenderedParticleIDs.SetNum(PoolCount);
+	InstanceCustomData.SetNumZeroed(PoolCount * 4);
+	ActiveInstanceCount = FMath::Min(ActiveInstanceCount, PoolCount);
+}
+
+/**
+ * @brief Remove all pooled instances and reset the mirrored slot state.
+ */
+void UKawaiiFluidProxyRenderer::ReleaseInstancePool()
+{
+	if (ISMComponent)
+	{
+		ISMComponent->ClearInstances();
+	}
+
+	InstanceTransforms.Reset();
+	InstanceCustomData.Reset();
+	RenderedPositions.Reset();
+	RenderedVelocities.Reset();
+	RenderedParticleIDs.Reset();
+	ActiveInstanceCount = 0;
+	LastSettingsHash = 0;
+}
+
+/**
+ * @brief Hash the visual settings that affect every slot (scale, rotation and color mapping).
+ * @param ScaleFactor Instance scale derived from the particle radius.
+ * @return Hash compared against LastSettingsHash to detect a required full rebuild.
+ */
+uint32 UKawaiiFluidProxyRenderer::ComputeSettingsHash(float ScaleFactor) const
+{
+	uint32 Hash = GetTypeHash(ScaleFactor);
+	Hash = HashCombine(Hash, GetTypeHash(bRotateByVelocity));
+	Hash = HashCombine(Hash, GetTypeHash(bColorByVelocity));
+	Hash = HashCombine(Hash, GetTypeHash(MinVelocityColor));
+	Hash = HashCombine(Hash, GetTypeHash(MaxVelocityColor));
+	Hash = HashCombine(Hash, GetTypeHash(MaxVelocityForColor));
+	// Never 0, so a released pool always forces a full update
+	return Hash == 0 ? 1u : Hash;
 }
 
 void UKawaiiFluidProxyRenderer::InitializeISM()
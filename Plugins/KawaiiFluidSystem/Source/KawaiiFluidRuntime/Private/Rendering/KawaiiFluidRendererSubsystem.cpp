@@ -4,10 +4,14 @@
 #include "Logging/KawaiiFluidLog.h"
 #include "Rendering/KawaiiFluidSceneViewExtension.h"
 #include "Modules/KawaiiFluidRenderingModule.h"
+#include "Rendering/KawaiiFluidShadowClustering.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 #include "GameFramework/Actor.h"
 #include "EngineUtils.h"
+#include "Engine/World.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
 #include "UObject/ConstructorHelpers.h"
 #include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Async/ParallelFor.h"
@@ -522,8 +526,45 @@ UInstancedStaticMeshComponent* UKawaiiFluidRendererSubsystem::GetOrCreateShadowI
 	return ISM;
 }
 
+/**
+ * @brief Resolve the view location used for shadow cluster LOD.
+ * @param OutViewLocation Last rendered view location (editor or game), or the first player camera.
+ * @return True if a view location is available.
+ */
+bool UKawaiiFluidRendererSubsystem::GetShadowViewLocation(FVector& OutViewLocation) const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	// Filled by the renderer for editor viewports and game views alike
+	if (World->ViewLocationsRenderedLastFrame.Num() > 0)
+	{
+		OutViewLocation = World->ViewLocationsRenderedLastFrame[0];
+		return true;
+	}
+
+	if (APlayerController* PC = World->GetFirstPlayerController())
+	{
+		if (PC->PlayerCameraManager)
+		{
+			OutViewLocation = PC->PlayerCameraManager->GetCameraLocation();
+			return true;
+		}
+	}
+
+	return false;
+}
+
 /**
  * @brief Register shadow particles for aggregation.
+ * 
+ * With clustering enabled, particles are collapsed into one scaled instance per occupied voxel
+ * (voxel size grows with camera distance). The clusters of each registration are cached and reused
+ * while its particle positions and per-particle LOD levels stay the same, e.g. when the particles sleep.
+ * 
  * @param ParticlePositions Array of particle world positions.
  * @param NumParticles Number of particles.
  * @param ParticleRadius Radius of each particle.
@@ -545,27 +586,100 @@ void UKawaiiFluidRendererSubsystem::RegisterShadowParticles(const FVector* Parti
 		return;
 	}
 
-	// Apply skip factor
-	const int32 SkipFactor = FMath::Max(1, ParticleSkipFactor);
-	const int32 NumToAdd = (NumParticles + SkipFactor - 1) / SkipFactor;
+	TArray<FTransform>& Buffer = AggregatedTransforms[QualityIndex];
+	bHasParticlesThisFrame[QualityIndex] = true;
+
+	if (!bClusterShadowParticles)
+	{
+		// Apply skip factor
+		const int32 SkipFactor = FMath::Max(1, ParticleSkipFactor);
+		const int32 NumToAdd = (NumParticles + SkipFactor - 1) / SkipFactor;
+		const FVector SphereScale = FVector(ParticleRadius / FKawaiiFluidShadowClustering::ShadowMeshRadius);
+
+		// Reserve space to avoid frequent reallocations
+		Buffer.Reserve(Buffer.Num() + NumToAdd);
+
+		// Add positions with skip factor (no validation - simulation guarantees valid data)
+		for (int32 i = 0; i < NumParticles; i += SkipFactor)
+		{
+			Buffer.Emplace(FQuat::Identity, ParticlePositions[i], SphereScale);
+		}
+
+		bAggregationChanged[QualityIndex] = true;
+		return;
+	}
 
-	// Reserve space to avoid frequent reallocations
-	TArray<FVector>& Buffer = AggregatedPositions[QualityIndex];
-	Buffer.Reserve(Buffer.Num() + NumToAdd);
+	FKawaiiFluidShadowClusterSettings Settings;
+	Settings.CellSizeInRadii = ShadowClusterCellSize;
+	Settings.LODDistance = ShadowLODDistance;
+	Settings.MaxLODLevel = ShadowMaxLODLevel;
 
-	// Add positions with skip factor (no validation - simulation guarantees valid data)
-	for (int32 i = 0; i < NumParticles; i += SkipFactor)
+	uint32 SettingsHash = GetTypeHash(Settings.CellSizeInRadii);
+	SettingsHash = HashCombine(SettingsHash, GetTypeHash(Settings.LODDistance));
+	SettingsHash = HashCombine(SettingsHash, GetTypeHash(Settings.MaxLODLevel));
+
+	FVector ViewLocation = FVector::ZeroVector;
+	const bool bHasView = Settings.LODDistance > 0.0f && GetShadowViewLocation(ViewLocation);
+
+	// Registration order is stable from frame to frame, so the cache is indexed by it
+	const int32 CacheIndex = ShadowRegistrationIndex++;
+	if (ShadowClusterCache.Num() <= CacheIndex)
 	{
-		Buffer.Add(ParticlePositions[i]);
+		ShadowClusterCache.SetNum(CacheIndex + 1);
+	}
+	FKawaiiFluidShadowClusterCacheEntry& Cache = ShadowClusterCache[CacheIndex];
+
+	bool bCacheValid =
+		Cache.QualityIndex == QualityIndex &&
+		Cache.SettingsHash == SettingsHash &&
+		Cache.ParticleRadius == ParticleRadius &&
+		Cache.bHasView == bHasView &&
+		Cache.Positions.Num() == NumParticles &&
+		FMemory::Memcmp(Cache.Positions.GetData(), ParticlePositions, NumParticles * sizeof(FVector)) == 0;
+
+	// The view only reaches the clusters through each particle's LOD level, so a moved view keeps
+	// the cache until some particle actually crosses a band edge
+	TArray<uint8> LODLevels;
+	if (bCacheValid && bHasView && Cache.ViewLocation != ViewLocation)
+	{
+		FKawaiiFluidShadowClustering::ComputeLODLevels(ParticlePositions, NumParticles, Settings, ViewLocation, LODLevels);
+		bCacheValid = LODLevels == Cache.LODLevels;
+		if (bCacheValid)
+		{
+			Cache.ViewLocation = ViewLocation;
+		}
 	}
 
-	// Track max radius for this quality level
-	AggregatedRadius[QualityIndex] = FMath::Max(AggregatedRadius[QualityIndex], ParticleRadius);
-	bHasParticlesThisFrame[QualityIndex] = true;
+	if (!bCacheValid)
+	{
+		Cache.Transforms.Reset();
+		FKawaiiFluidShadowClustering::BuildClusters(
+			ParticlePositions, NumParticles, ParticleRadius, Settings,
+			bHasView ? &ViewLocation : nullptr, Cache.Transforms);
+
+		if (bHasView && LODLevels.Num() != NumParticles)
+		{
+			FKawaiiFluidShadowClustering::ComputeLODLevels(ParticlePositions, NumParticles, Settings, ViewLocation, LODLevels);
+		}
+
+		Cache.Positions.SetNumUninitialized(NumParticles);
+		FMemory::Memcpy(Cache.Positions.GetData(), ParticlePositions, NumParticles * sizeof(FVector));
+		Cache.LODLevels = MoveTemp(LODLevels);
+		Cache.bHasView = bHasView;
+		Cache.ViewLocation = ViewLocation;
+		Cache.ParticleRadius = ParticleRadius;
+		Cache.SettingsHash = SettingsHash;
+		Cache.QualityIndex = QualityIndex;
+
+		bAggregationChanged[QualityIndex] = true;
+	}
+
+	Buffer.Append(Cache.Transforms);
 }
 
 /**
- * @brief Flush aggregated particles to ISM components and update their transforms.
+ * @brief Flush aggregated shadow instances to ISM components.
+ * Quality levels whose registrations were all served from the cluster cache are left untouched.
  */
 void UKawaiiFluidRendererSubsystem::FlushShadowInstances()
 {
@@ -576,15 +690,14 @@ void UKawaiiFluidRendererSubsystem::FlushShadowInstances()
 	for (int32 QualityIndex = 0; QualityIndex < NUM_SHADOW_QUALITY_LEVELS; ++QualityIndex)
 	{
 		const EFluidShadowMeshQuality Quality = static_cast<EFluidShadowMeshQuality>(QualityIndex);
-		TArray<FVector>& Positions = AggregatedPositions[QualityIndex];
-		const float Radius = AggregatedRadius[QualityIndex];
+		const TArray<FTransform>& Transforms = AggregatedTransforms[QualityIndex];
 		const bool bHasParticles = bHasParticlesThisFrame[QualityIndex];
 
 		// Get or create ISM component for this quality
 		UInstancedStaticMeshComponent* ISM = ShadowInstanceComponents[QualityIndex];
 
 		// If no particles registered this frame
-		if (!bHasParticles || Positions.Num() == 0)
+		if (!bHasParticles || Transforms.Num() == 0)
 		{
 			// Clear existing instances if any
 			if (IsValid(ISM) && ISM->GetInstanceCount() > 0)
@@ -605,48 +718,24 @@ void UKawaiiFluidRendererSubsystem::FlushShadowInstances()
 			}
 		}
 
-		const int32 NumInstances = Positions.Num();
-
-		// Prepare transforms
-		CachedInstanceTransforms.SetNumUninitialized(NumInstances);
-		const FVector SphereScale = FVector(Radius / 50.0f);
-
-		// Generate transforms (parallelize only when count is large enough to offset overhead)
-		constexpr int32 ParallelThreshold = 1024;
-		if (NumInstances >= ParallelThreshold)
+		// Update ISM
+		const int32 NumInstances = Transforms.Num();
+		const int32 CurrentCount = ISM->GetInstanceCount();
+		if (CurrentCount == NumInstances)
 		{
-			ParallelFor(NumInstances, [&](int32 i)
+			if (bAggregationChanged[QualityIndex])
 			{
-				FTransform& T = CachedInstanceTransforms[i];
-				T.SetTranslation(Positions[i]);
-				T.SetRotation(FQuat::Identity);
-				T.SetScale3D(SphereScale);
-			});
+				// Fast path: Update existing instances (Always update bounds to ensure correct shadow frustum/VSM pages)
+				ISM->BatchUpdateInstancesTransforms(0, Transforms, true, true, false);
+			}
 		}
 		else
 		{
-			for (int32 i = 0; i < NumInstances; ++i)
-			{
-				FTransform& T = CachedInstanceTransforms[i];
-				T.SetTranslation(Positions[i]);
-				T.SetRotation(FQuat::Identity);
-				T.SetScale3D(SphereScale);
-			}
+			// Rebuild: Clear and add new instances with bounds update
+			ISM->ClearInstances();
+			ISM->AddInstances(Transforms, false, true);
 		}
-
-		// Update ISM
-		const int32 CurrentCount = ISM->GetInstanceCount();
-				if (CurrentCount == NumInstances)
-				{
-					// Fast path: Update existing instances (Always update bounds to ensure correct shadow frustum/VSM pages)
-					ISM->BatchUpdateInstancesTransforms(0, CachedInstanceTransforms, true, true, false);
-				}
-				else
-				{
-					// Rebuild: Clear and add new instances with bounds update
-					ISM->ClearInstances();
-					ISM->AddInstances(CachedInstanceTransforms, true, true);
-				}	}
+	}
 }
 
 /**
@@ -656,10 +745,14 @@ void UKawaiiFluidRendererSubsystem::ClearAggregationBuffers()
 {
 	for (int32 i = 0; i < NUM_SHADOW_QUALITY_LEVELS; ++i)
 	{
-		AggregatedPositions[i].Reset();
-		AggregatedRadius[i] = 0.0f;
+		AggregatedTransforms[i].Reset();
 		bHasParticlesThisFrame[i] = false;
+		bAggregationChanged[i] = false;
 	}
+
+	// Drop cache entries of registrations that did not happen this frame
+	ShadowClusterCache.SetNum(ShadowRegistrationIndex);
+	ShadowRegistrationIndex = 0;
 }
 
 /**
@@ -688,5 +781,5 @@ void UKawaiiFluidRendererSubsystem::CleanupShadowResources()
 
 	// Clear buffers
 	ClearAggregationBuffers();
-	CachedInstanceTransforms.Empty();
+	ShadowClusterCache.Empty();
 }
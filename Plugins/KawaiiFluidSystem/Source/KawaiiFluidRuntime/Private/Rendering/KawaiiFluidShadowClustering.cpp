@@ -0,0 +1,239 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Rendering/KawaiiFluidShadowClustering.h"
+#include "Async/ParallelFor.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace
+{
+	constexpr int32 CellCoordBits = 20;
+	constexpr int32 CellCoordBias = 1 << (CellCoordBits - 1);
+	constexpr uint64 CellCoordMask = (1ull << CellCoordBits) - 1;
+	constexpr int32 MaxEncodedLODLevel = 7;
+	constexpr int32 ParticlesPerChunk = 4096;
+
+	/**
+	 * @struct FShadowVoxel
+	 * @brief Running sums for the particles of one voxel, stored relative to the voxel origin for precision.
+	 */
+	struct FShadowVoxel
+	{
+		FVector Origin = FVector::ZeroVector;
+		FVector Sum = FVector::ZeroVector;
+		FVector SumSq = FVector::ZeroVector;
+		float CellSize = 0.0f;
+		int32 Count = 0;
+
+		void Merge(const FShadowVoxel& Other)
+		{
+			// Same key implies same origin and cell size
+			Sum += Other.Sum;
+			SumSq += Other.SumSq;
+			Count += Other.Count;
+		}
+	};
+
+	using FShadowVoxelMap = TMap<uint64, FShadowVoxel>;
+}
+
+/**
+ * @brief LOD level for a given distance to the view (voxel size doubles per level).
+ * @param DistanceToView Distance from the view location (cm).
+ * @return Level in [0, MaxLODLevel].
+ */
+int32 FKawaiiFluidShadowClusterSettings::GetLODLevel(float DistanceToView) const
+{
+	if (LODDistance <= 0.0f || DistanceToView < LODDistance)
+	{
+		return 0;
+	}
+
+	const int32 Level = FMath::FloorToInt(FMath::Log2(DistanceToView / LODDistance)) + 1;
+	return FMath::Clamp(Level, 0, FMath::Min(MaxLODLevel, MaxEncodedLODLevel));
+}
+
+/**
+ * @brief Per-particle LOD level as BuildClusters assigns it for a view.
+ *
+ * The view only affects the clusters through these levels, so two views that yield the same
+ * levels yield the same clusters.
+ *
+ * @param Positions Particle world positions.
+ * @param NumParticles Number of particles.
+ * @param Settings Voxel size and LOD parameters.
+ * @param ViewLocation View used for distance-based LOD.
+ * @param OutLevels Resized to NumParticles, one level per particle.
+ */
+void FKawaiiFluidShadowClustering::ComputeLODLevels(
+	const FVector* Positions,
+	int32 NumParticles,
+	const FKawaiiFluidShadowClusterSettings& Settings,
+	const FVector& ViewLocation,
+	TArray<uint8>& OutLevels)
+{
+	OutLevels.SetNumUninitialized(FMath::Max(NumParticles, 0));
+	if (!Positions || NumParticles <= 0)
+	{
+		return;
+	}
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumParticles, ParticlesPerChunk);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 EndIdx = FMath::Min((ChunkIndex + 1) * ParticlesPerChunk, NumParticles);
+		for (int32 i = ChunkIndex * ParticlesPerChunk; i < EndIdx; ++i)
+		{
+			OutLevels[i] = static_cast<uint8>(Settings.GetLODLevel(static_cast<float>(FVector::Dist(Positions[i], ViewLocation))));
+		}
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+/**
+ * @brief Integer voxel coordinate of a position, clamped to the range the cell key can encode.
+ *
+ * Both the cell key and the voxel origin are derived from this one coordinate, so particles that
+ * share a key always share an origin.
+ *
+ * @param Position World position.
+ * @param CellSize Voxel edge length for this LOD level.
+ * @return Voxel coordinate in [-CellCoordBias, CellCoordBias - 1] per axis.
+ */
+FIntVector FKawaiiFluidShadowClustering::GetCellCoord(const FVector& Position, float CellSize)
+{
+	const FVector Scaled = Position / static_cast<double>(CellSize);
+	const int32 MinCoord = -CellCoordBias;
+	const int32 MaxCoord = static_cast<int32>(CellCoordMask) - CellCoordBias;
+	return FIntVector(
+		static_cast<int32>(FMath::Clamp(FMath::FloorToDouble(Scaled.X), static_cast<double>(MinCoord), static_cast<double>(MaxCoord))),
+		static_cast<int32>(FMath::Clamp(FMath::FloorToDouble(Scaled.Y), static_cast<double>(MinCoord), static_cast<double>(MaxCoord))),
+		static_cast<int32>(FMath::Clamp(FMath::FloorToDouble(Scaled.Z), static_cast<double>(MinCoord), static_cast<double>(MaxCoord))));
+}
+
+/**
+ * @brief Pack LOD level and voxel coordinates into a single map key.
+ * @param Cell Voxel coordinate from GetCellCoord.
+ * @param LODLevel LOD level (part of the key so voxels of different sizes never merge).
+ * @return 3-bit level + 3 x 20-bit biased voxel coordinates.
+ */
+uint64 FKawaiiFluidShadowClustering::MakeCellKey(const FIntVector& Cell, int32 LODLevel)
+{
+	const uint64 X = static_cast<uint64>(Cell.X + CellCoordBias) & CellCoordMask;
+	const uint64 Y = static_cast<uint64>(Cell.Y + CellCoordBias) & CellCoordMask;
+	const uint64 Z = static_cast<uint64>(Cell.Z + CellCoordBias) & CellCoordMask;
+	const uint64 Level = static_cast<uint64>(FMath::Clamp(LODLevel, 0, MaxEncodedLODLevel));
+
+	return (Level << (CellCoordBits * 3)) | (Z << (CellCoordBits * 2)) | (Y << CellCoordBits) | X;
+}
+
+/**
+ * @brief Pack LOD level and the voxel containing a position into a single map key.
+ * @param Position World position.
+ * @param CellSize Voxel edge length for this LOD level.
+ * @param LODLevel LOD level (part of the key so voxels of different sizes never merge).
+ * @return 3-bit level + 3 x 20-bit biased voxel coordinates.
+ */
+uint64 FKawaiiFluidShadowClustering::MakeCellKey(const FVector& Position, float CellSize, int32 LODLevel)
+{
+	return MakeCellKey(GetCellCoord(Position, CellSize), LODLevel);
+}
+
+/**
+ * @brief Cluster particles into voxels and emit one ellipsoid instance transform per occupied voxel.
+ * @param Positions Particle world positions.
+ * @param NumParticles Number of particles.
+ * @param ParticleRadius Shadow radius of a single particle (cm).
+ * @param Settings Voxel size and LOD parameters.
+ * @param ViewLocation View used for distance-based LOD (nullptr = LOD 0 everywhere).
+ * @param OutTransforms Appended instance transforms (scale relative to ShadowMeshRadius).
+ */
+void FKawaiiFluidShadowClustering::BuildClusters(
+	const FVector* Positions,
+	int32 NumParticles,
+	float ParticleRadius,
+	const FKawaiiFluidShadowClusterSettings& Settings,
+	const FVector* ViewLocation,
+	TArray<FTransform>& OutTransforms)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FluidShadow_BuildClusters);
+
+	if (!Positions || NumParticles <= 0)
+	{
+		return;
+	}
+
+	const float Radius = FMath::Max(ParticleRadius, 0.1f);
+	const float BaseCellSize = Radius * FMath::Max(Settings.CellSizeInRadii, 1.0f);
+	const bool bUseLOD = ViewLocation != nullptr && Settings.LODDistance > 0.0f;
+
+	// Parallel: one voxel map per chunk (no shared writes)
+	const int32 NumChunks = FMath::Clamp(FMath::DivideAndRoundUp(NumParticles, ParticlesPerChunk), 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	const int32 ChunkSize = FMath::DivideAndRoundUp(NumParticles, NumChunks);
+	TArray<FShadowVoxelMap> ChunkVoxels;
+	ChunkVoxels.SetNum(NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 StartIdx = ChunkIndex * ChunkSize;
+		const int32 EndIdx = FMath::Min(StartIdx + ChunkSize, NumParticles);
+		FShadowVoxelMap& LocalVoxels = ChunkVoxels[ChunkIndex];
+
+		for (int32 i = StartIdx; i < EndIdx; ++i)
+		{
+			const FVector& Position = Positions[i];
+			const int32 Level = bUseLOD ? Settings.GetLODLevel(static_cast<float>(FVector::Dist(Position, *ViewLocation))) : 0;
+			const float CellSize = BaseCellSize * static_cast<float>(1 << Level);
+			const FIntVector Cell = GetCellCoord(Position, CellSize);
+			const uint64 Key = MakeCellKey(Cell, Level);
+
+			FShadowVoxel* Voxel = LocalVoxels.Find(Key);
+			if (!Voxel)
+			{
+				Voxel = &LocalVoxels.Add(Key);
+				Voxel->CellSize = CellSize;
+				Voxel->Origin = FVector(Cell) * static_cast<double>(CellSize);
+			}
+
+			const FVector Local = Position - Voxel->Origin;
+			Voxel->Sum += Local;
+			Voxel->SumSq += Local * Local;
+			Voxel->Count++;
+		}
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Merge (voxel count is far below particle count)
+	FShadowVoxelMap& Voxels = ChunkVoxels[0];
+	for (int32 c = 1; c < NumChunks; ++c)
+	{
+		for (const TPair<uint64, FShadowVoxel>& Pair : ChunkVoxels[c])
+		{
+			if (FShadowVoxel* Existing = Voxels.Find(Pair.Key))
+			{
+				Existing->Merge(Pair.Value);
+			}
+			else
+			{
+				Voxels.Add(Pair.Key, Pair.Value);
+			}
+		}
+	}
+
+	// One ellipsoid per voxel: a uniform spread over [-a, a] has a standard deviation of a / sqrt(3)
+	const float InvMeshRadius = 1.0f / ShadowMeshRadius;
+	OutTransforms.Reserve(OutTransforms.Num() + Voxels.Num());
+
+	for (const TPair<uint64, FShadowVoxel>& Pair : Voxels)
+	{
+		const FShadowVoxel& Voxel = Pair.Value;
+		const double InvCount = 1.0 / Voxel.Count;
+		const FVector Mean = Voxel.Sum * InvCount;
+		const FVector Variance = (Voxel.SumSq * InvCount - Mean * Mean).ComponentMax(FVector::ZeroVector);
+		const double MaxHalfExtent = Voxel.CellSize * 0.5;
+
+		const FVector Extent(
+			FMath::Min(FMath::Sqrt(Variance.X * 3.0), MaxHalfExtent) + Radius,
+			FMath::Min(FMath::Sqrt(Variance.Y * 3.0), MaxHalfExtent) + Radius,
+			FMath::Min(FMath::Sqrt(Variance.Z * 3.0), MaxHalfExtent) + Radius);
+
+		OutTransforms.Emplace(FQuat::Identity, Voxel.Origin + Mean, Extent * InvMeshRadius);
+	}
+}
@@ -0,0 +1,651 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Rendering/KawaiiFluidSurfaceMesher.h"
+#include "Simulation/Resources/KawaiiFluidParticleSnapshot.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	/** Node value of a brick outside the narrow band (the field itself is never negative) */
+	constexpr float UnknownValue = -1.0f;
+
+	/** Padded node block of one brick: its own nodes plus the +X/+Y/+Z neighbor layer */
+	constexpr int32 PadSide = FKawaiiFluidSurfaceMesher::BrickSide + 1;
+	constexpr int32 PadVolume = PadSide * PadSide * PadSide;
+
+	/** Smallest anisotropy scale honored by the splat (avoids infinite stretch of degenerate axes) */
+	constexpr float MinAnisotropyScale = 0.05f;
+
+	EParallelForFlags GetForFlags(int32 Num)
+	{
+		return Num < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+	}
+
+	/** A brick is 512 nodes of work, so brick loops go wide from a handful of bricks */
+	EParallelForFlags GetBrickForFlags(int32 NumBricks)
+	{
+		return NumBricks < 16 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+	}
+
+	int32 LocalIndex(int32 X, int32 Y, int32 Z)
+	{
+		return (Z * FKawaiiFluidSurfaceMesher::BrickSide + Y) * FKawaiiFluidSurfaceMesher::BrickSide + X;
+	}
+
+	int32 PadIndex(int32 X, int32 Y, int32 Z)
+	{
+		return (Z * PadSide + Y) * PadSide + X;
+	}
+
+	/** Brick of a node (arithmetic shift = floor division, also for negative nodes) */
+	FIntVector NodeToBrick(const FIntVector& Node)
+	{
+		return FIntVector(Node.X >> FKawaiiFluidSurfaceMesher::BrickBits, Node.Y >> FKawaiiFluidSurfaceMesher::BrickBits, Node.Z >> FKawaiiFluidSurfaceMesher::BrickBits);
+	}
+
+	/**
+	 * @brief Node range covered by a splat.
+	 * @param Position Particle position (cm).
+	 * @param Radius Splat support radius (cm).
+	 * @param InvVoxelSize 1 / voxel size.
+	 * @param OutMin First node.
+	 * @param OutMax Last node.
+	 */
+	void GetNodeRange(const FVector3f& Position, float Radius, float InvVoxelSize, FIntVector& OutMin, FIntVector& OutMax)
+	{
+		OutMin = FIntVector(
+			FMath::FloorToInt((Position.X - Radius) * InvVoxelSize),
+			FMath::FloorToInt((Position.Y - Radius) * InvVoxelSize),
+			FMath::FloorToInt((Position.Z - Radius) * InvVoxelSize));
+		OutMax = FIntVector(
+			FMath::CeilToInt((Position.X + Radius) * InvVoxelSize),
+			FMath::CeilToInt((Position.Y + Radius) * InvVoxelSize),
+			FMath::CeilToInt((Position.Z + Radius) * InvVoxelSize));
+	}
+
+	/**
+	 * @brief Visit every brick coordinate in an inclusive range.
+	 * @param Visitor Callable (const FIntVector& BrickCoord).
+	 */
+	template <typename VisitorType>
+	void ForEachBrick(const FIntVector& Min, const FIntVector& Max, VisitorType&& Visitor)
+	{
+		for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+			{
+				for (int32 X = Min.X; X <= Max.X; ++X)
+				{
+					Visitor(FIntVector(X, Y, Z));
+				}
+			}
+		}
+	}
+
+	bool HasAnisotropy(const FKawaiiFluidAnisotropySnapshot* Anisotropy, int32 Num, const FKawaiiFluidSurfaceMeshSettings& Settings)
+	{
+		return Settings.bUseAnisotropy && Anisotropy && Anisotropy->Num() == Num && Anisotropy->Axis2.Num() == Num && Anisotropy->Axis3.Num() == Num;
+	}
+}
+
+//=============================================================================
+// Mesh
+//=============================================================================
+
+/**
+ * @brief Fill a mesh description with static mesh attributes, one vertex instance per triangle corner.
+ * @param OutMeshDescription Output description (attributes registered here).
+ */
+void FKawaiiFluidSurfaceMesh::ToMeshDescription(FMeshDescription& OutMeshDescription) const
+{
+	FStaticMeshAttributes Attributes(OutMeshDescription);
+	Attributes.Register();
+
+	const FPolygonGroupID PolygonGroup = OutMeshDescription.CreatePolygonGroup();
+	TVertexAttributesRef<FVector3f> VertexPositions = Attributes.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector3f> VertexInstanceNormals = Attributes.GetVertexInstanceNormals();
+
+	OutMeshDescription.ReserveNewVertices(Positions.Num());
+	OutMeshDescription.ReserveNewVertexInstances(Indices.Num());
+	OutMeshDescription.ReserveNewPolygons(NumTriangles());
+
+	TArray<FVertexID> VertexIDs;
+	VertexIDs.Reserve(Positions.Num());
+	for (const FVector3f& Position : Positions)
+	{
+		const FVertexID VertexID = OutMeshDescription.CreateVertex();
+		VertexPositions[VertexID] = Position;
+		VertexIDs.Add(VertexID);
+	}
+
+	TArray<FVertexInstanceID> TriVerts;
+	TriVerts.SetNum(3);
+	for (int32 i = 0; i < Indices.Num(); i += 3)
+	{
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const int32 Vertex = Indices[i + Corner];
+			TriVerts[Corner] = OutMeshDescription.CreateVertexInstance(VertexIDs[Vertex]);
+			VertexInstanceNormals[TriVerts[Corner]] = Normals.IsValidIndex(Vertex) ? Normals[Vertex] : FVector3f::ZeroVector;
+		}
+		OutMeshDescription.CreatePolygon(PolygonGroup, TriVerts);
+	}
+}
+
+//=============================================================================
+// Mesher
+//=============================================================================
+
+/**
+ * @brief Reconstruct the surface of a particle set.
+ * @param Positions Particle positions (cm).
+ * @param Settings Resolution and field parameters.
+ * @param OutMesh Output mesh (reset first).
+ * @param Anisotropy Optional ellipsoid axes matching Positions.
+ * @param Flags Optional EGPUParticleFlags matching Positions.
+ * @return True if a non-empty mesh was produced.
+ */
+bool FKawaiiFluidSurfaceMesher::Extract(TConstArrayView<FVector3f> Positions, const FKawaiiFluidSurfaceMeshSettings& Settings,
+	FKawaiiFluidSurfaceMesh& OutMesh, const FKawaiiFluidAnisotropySnapshot* Anisotropy, TConstArrayView<uint32> Flags)
+{
+	OutMesh.Reset();
+	LastStats = FKawaiiFluidSurfaceMeshStats();
+	if (Positions.Num() == 0 || Settings.GetVoxelSize() <= 0.0f || Settings.GetKernelRadius() <= 0.0f)
+	{
+		return false;
+	}
+
+	const uint64 SplatStart = FPlatformTime::Cycles64();
+	BuildBricks(Positions, Settings, Anisotropy, Flags);
+	SplatField(Positions, Settings, Anisotropy);
+	const uint64 ContourStart = FPlatformTime::Cycles64();
+
+	const bool bBandLimited = Settings.bNarrowBand && Flags.Num() == Positions.Num();
+	Contour(Settings, bBandLimited, OutMesh);
+
+	LastStats.NumBricks = BrickCoords.Num();
+	LastStats.NumSplats = SplatParticles.Num();
+	LastStats.NumVertices = OutMesh.NumVertices();
+	LastStats.NumTriangles = OutMesh.NumTriangles();
+	LastStats.SplatMs = FPlatformTime::ToMilliseconds64(ContourStart - SplatStart);
+	LastStats.ContourMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ContourStart);
+	LastStats.AllocatedBytes = GetAllocatedSize();
+	return OutMesh.NumTriangles() > 0;
+}
+
+/**
+ * @brief Reconstruct the surface of a readback snapshot.
+ * @param Snapshot Particle snapshot (positions required, flags optional).
+ * @param Settings Resolution and field parameters.
+ * @param OutMesh Output mesh (reset first).
+ * @param Anisotropy Optional anisotropy snapshot of the same readback.
+ * @return True if a non-empty mesh was produced.
+ */
+bool FKawaiiFluidSurfaceMesher::Extract(const FKawaiiFluidParticleSnapshot& Snapshot, const FKawaiiFluidSurfaceMeshSettings& Settings,
+	FKawaiiFluidSurfaceMesh& OutMesh, const FKawaiiFluidAnisotropySnapshot* Anisotropy)
+{
+	if (!Snapshot.HasPositions())
+	{
+		OutMesh.Reset();
+		LastStats = FKawaiiFluidSurfaceMeshStats();
+		return false;
+	}
+
+	return Extract(Snapshot.Positions, Settings, OutMesh, Anisotropy,
+		Snapshot.HasFlags() ? TConstArrayView<uint32>(Snapshot.Flags) : TConstArrayView<uint32>());
+}
+
+/**
+ * @brief Release the field and scratch memory.
+ */
+void FKawaiiFluidSurfaceMesher::Reset()
+{
+	BrickMap.Empty();
+	BrickCoords.Empty();
+	Field.Empty();
+	SplatOffsets.Empty();
+	SplatParticles.Empty();
+	SplatRadii.Empty();
+	VoxelVertices.Empty();
+	BrickVertexOffsets.Empty();
+	BrickVertices.Empty();
+	BrickIndices.Empty();
+	LastStats = FKawaiiFluidSurfaceMeshStats();
+}
+
+/**
+ * @brief Field and scratch memory held by the mesher.
+ * @return Allocated bytes.
+ */
+SIZE_T FKawaiiFluidSurfaceMesher::GetAllocatedSize() const
+{
+	SIZE_T Size = BrickMap.GetAllocatedSize() + BrickCoords.GetAllocatedSize() + Field.GetAllocatedSize()
+		+ SplatOffsets.GetAllocatedSize() + SplatParticles.GetAllocatedSize() + SplatRadii.GetAllocatedSize()
+		+ VoxelVertices.GetAllocatedSize() + BrickVertexOffsets.GetAllocatedSize()
+		+ BrickVertices.GetAllocatedSize() + BrickIndices.GetAllocatedSize();
+	for (const TArray<FVector3f>& Vertices : BrickVertices)
+	{
+		Size += Vertices.GetAllocatedSize();
+	}
+	for (const TArray<int32>& Indices : BrickIndices)
+	{
+		Size += Indices.GetAllocatedSize();
+	}
+	return Size;
+}
+
+/**
+ * @brief Create the bricks the contour needs and list the particles overlapping each (CSR).
+ * @param Positions Particle positions (cm).
+ * @param Settings Resolution and field parameters.
+ * @param Anisotropy Optional ellipsoid axes.
+ * @param Flags Optional particle flags (IsSurface seeds the narrow band).
+ */
+void FKawaiiFluidSurfaceMesher::BuildBricks(TConstArrayView<FVector3f> Positions, const FKawaiiFluidSurfaceMeshSettings& Settings,
+	const FKawaiiFluidAnisotropySnapshot* Anisotropy, TConstArrayView<uint32> Flags)
+{
+	const int32 Num = Positions.Num();
+	const float KernelRadius = Settings.GetKernelRadius();
+	const float InvVoxelSize = 1.0f / Settings.GetVoxelSize();
+	const bool bAnisotropic = HasAnisotropy(Anisotropy, Num, Settings);
+
+	// Support radius: the ellipsoid's longest axis bounds it
+	SplatRadii.SetNumUninitialized(Num, EAllowShrinking::No);
+	ParallelFor(Num, [&](int32 i)
+	{
+		float MaxScale = 1.0f;
+		if (bAnisotropic)
+		{
+			MaxScale = FMath::Max3(Anisotropy->Axis1[i].W, Anisotropy->Axis2[i].W, Anisotropy->Axis3[i].W);
+			MaxScale = FMath::Max(MaxScale, MinAnisotropyScale);
+		}
+		SplatRadii[i] = KernelRadius * MaxScale;
+	}, GetForFlags(Num));
+
+	const bool bBandLimited = Settings.bNarrowBand && Flags.Num() == Num;
+
+	// 1. Bricks: every brick a seed's splat reaches, plus the layer below so the cells straddling the
+	//    lower support boundary have an owner
+	BrickMap.Reset();
+	BrickCoords.Reset();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		if (bBandLimited && (Flags[i] & EGPUParticleFlags::IsSurface) == 0)
+		{
+			continue;
+		}
+
+		FIntVector NodeMin;
+		FIntVector NodeMax;
+		GetNodeRange(Positions[i], SplatRadii[i], InvVoxelSize, NodeMin, NodeMax);
+		ForEachBrick(NodeToBrick(NodeMin - FIntVector(1)), NodeToBrick(NodeMax), [this](const FIntVector& Brick)
+		{
+			if (!BrickMap.Contains(Brick))
+			{
+				BrickMap.Add(Brick, BrickCoords.Add(Brick));
+			}
+		});
+	}
+
+	// 2. Particle lists: every particle contributes to the bricks that exist, seed or not
+	const int32 NumBricks = BrickCoords.Num();
+	SplatOffsets.SetNumZeroed(NumBricks + 1, EAllowShrinking::No);
+
+	auto ForEachOverlap = [&](int32 i, auto&& Visitor)
+	{
+		FIntVector NodeMin;
+		FIntVector NodeMax;
+		GetNodeRange(Positions[i], SplatRadii[i], InvVoxelSize, NodeMin, NodeMax);
+		ForEachBrick(NodeToBrick(NodeMin), NodeToBrick(NodeMax), [&](const FIntVector& Brick)
+		{
+			if (const int32* BrickIndex = BrickMap.Find(Brick))
+			{
+				Visitor(*BrickIndex);
+			}
+		});
+	};
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		ForEachOverlap(i, [this](int32 BrickIndex) { ++SplatOffsets[BrickIndex + 1]; });
+	}
+
+	for (int32 b = 0; b < NumBricks; ++b)
+	{
+		SplatOffsets[b + 1] += SplatOffsets[b];
+	}
+
+	SplatParticles.SetNumUninitialized(SplatOffsets[NumBricks], EAllowShrinking::No);
+	TArray<int32> Cursor(SplatOffsets.GetData(), NumBricks);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		ForEachOverlap(i, [this, &Cursor, i](int32 BrickIndex) { SplatParticles[Cursor[BrickIndex]++] = i; });
+	}
+}
+
+/**
+ * @brief Evaluate the node values of every brick in parallel, each brick gathering its particles.
+ * @param Positions Particle positions (cm).
+ * @param Settings Resolution and field parameters.
+ * @param Anisotropy Optional ellipsoid axes.
+ */
+void FKawaiiFluidSurfaceMesher::SplatField(TConstArrayView<FVector3f> Positions, const FKawaiiFluidSurfaceMeshSettings& Settings,
+	const FKawaiiFluidAnisotropySnapshot* Anisotropy)
+{
+	const int32 NumBricks = BrickCoords.Num();
+	const float VoxelSize = Settings.GetVoxelSize();
+	const float InvVoxelSize = 1.0f / VoxelSize;
+	const float InvKernelRadiusSq = 1.0f / FMath::Square(Settings.GetKernelRadius());
+	const bool bAnisotropic = HasAnisotropy(Anisotropy, Positions.Num(), Settings);
+
+	Field.SetNumUninitialized(NumBricks * BrickVolume, EAllowShrinking::No);
+
+	ParallelFor(NumBricks, [&](int32 b)
+	{
+		float* BrickField = Field.GetData() + b * BrickVolume;
+		FMemory::Memzero(BrickField, BrickVolume * sizeof(float));
+		const FIntVector BrickBase = BrickCoords[b] * BrickSide;
+
+		for (int32 k = SplatOffsets[b]; k < SplatOffsets[b + 1]; ++k)
+		{
+			const int32 i = SplatParticles[k];
+			const FVector3f& Center = Positions[i];
+
+			// Ellipsoid metric: offsets along each axis divided by its scale
+			FVector3f Axes[3];
+			if (bAnisotropic)
+			{
+				const FVector4f* AxisData[3] = { &Anisotropy->Axis1[i], &Anisotropy->Axis2[i], &Anisotropy->Axis3[i] };
+				for (int32 a = 0; a < 3; ++a)
+				{
+					Axes[a] = FVector3f(AxisData[a]->X, AxisData[a]->Y, AxisData[a]->Z) / FMath::Max(AxisData[a]->W, MinAnisotropyScale);
+				}
+			}
+
+			FIntVector NodeMin;
+			FIntVector NodeMax;
+			GetNodeRange(Center, SplatRadii[i], InvVoxelSize, NodeMin, NodeMax);
+			const FIntVector LocalMin(FMath::Max(NodeMin.X - BrickBase.X, 0), FMath::Max(NodeMin.Y - BrickBase.Y, 0), FMath::Max(NodeMin.Z - BrickBase.Z, 0));
+			const FIntVector LocalMax(FMath::Min(NodeMax.X - BrickBase.X, BrickSide - 1), FMath::Min(NodeMax.Y - BrickBase.Y, BrickSide - 1), FMath::Min(NodeMax.Z - BrickBase.Z, BrickSide - 1));
+
+			for (int32 Z = LocalMin.Z; Z <= LocalMax.Z; ++Z)
+			{
+				for (int32 Y = LocalMin.Y; Y <= LocalMax.Y; ++Y)
+				{
+					for (int32 X = LocalMin.X; X <= LocalMax.X; ++X)
+					{
+						const FVector3f Node(FIntVector(BrickBase.X + X, BrickBase.Y + Y, BrickBase.Z + Z));
+						const FVector3f Offset = Node * VoxelSize - Center;
+
+						float DistSq;
+						if (bAnisotropic)
+						{
+							DistSq = FMath::Square(FVector3f::DotProduct(Offset, Axes[0]))
+								+ FMath::Square(FVector3f::DotProduct(Offset, Axes[1]))
+								+ FMath::Square(FVector3f::DotProduct(Offset, Axes[2]));
+						}
+						else
+						{
+							DistSq = Offset.SizeSquared();
+						}
+
+						const float Q = DistSq * InvKernelRadiusSq;
+						if (Q < 1.0f)
+						{
+							const float OneMinusQ = 1.0f - Q;
+							BrickField[LocalIndex(X, Y, Z)] += OneMinusQ * OneMinusQ * OneMinusQ;
+						}
+					}
+				}
+			}
+		}
+	}, GetBrickForFlags(NumBricks));
+}
+
+/**
+ * @brief Surface nets over all bricks: vertex placement, then quad emission, then concatenation and normals.
+ * @param Settings Resolution and field parameters.
+ * @param bBandLimited Nodes of missing bricks are unknown (narrow band) instead of empty.
+ * @param OutMesh Output mesh.
+ */
+void FKawaiiFluidSurfaceMesher::Contour(const FKawaiiFluidSurfaceMeshSettings& Settings, bool bBandLimited, FKawaiiFluidSurfaceMesh& OutMesh)
+{
+	const int32 NumBricks = BrickCoords.Num();
+	const float VoxelSize = Settings.GetVoxelSize();
+	const float Iso = Settings.IsoLevel;
+	const float MissingValue = bBandLimited ? UnknownValue : 0.0f;
+	const EParallelForFlags ForFlags = GetBrickForFlags(NumBricks);
+
+	VoxelVertices.SetNumUninitialized(NumBricks * BrickVolume, EAllowShrinking::No);
+	BrickVertices.SetNum(NumBricks, EAllowShrinking::No);
+	BrickIndices.SetNum(NumBricks, EAllowShrinking::No);
+
+	// Own nodes plus the +X/+Y/+Z layer from the neighbor bricks
+	auto GatherPadded = [&](int32 b, float* Padded)
+	{
+		const FIntVector Brick = BrickCoords[b];
+		for (int32 Dz = 0; Dz <= 1; ++Dz)
+		{
+			for (int32 Dy = 0; Dy <= 1; ++Dy)
+			{
+				for (int32 Dx = 0; Dx <= 1; ++Dx)
+				{
+					const int32* Neighbor = (Dx | Dy | Dz) ? BrickMap.Find(Brick + FIntVector(Dx, Dy, Dz)) : &b;
+					const float* Source = Neighbor ? Field.GetData() + *Neighbor * BrickVolume : nullptr;
+
+					const int32 ZBegin = Dz ? BrickSide : 0, ZEnd = Dz ? PadSide : BrickSide;
+					const int32 YBegin = Dy ? BrickSide : 0, YEnd = Dy ? PadSide : BrickSide;
+					const int32 XBegin = Dx ? BrickSide : 0, XEnd = Dx ? PadSide : BrickSide;
+					for (int32 Z = ZBegin; Z < ZEnd; ++Z)
+					{
+						for (int32 Y = YBegin; Y < YEnd; ++Y)
+						{
+							for (int32 X = XBegin; X < XEnd; ++X)
+							{
+								Padded[PadIndex(X, Y, Z)] = Source ? Source[LocalIndex(X & (BrickSide - 1), Y & (BrickSide - 1), Z & (BrickSide - 1))] : MissingValue;
+							}
+						}
+					}
+				}
+			}
+		}
+	};
+
+	// 1. One vertex per voxel with a sign change, at the mean of its edge crossings
+	ParallelFor(NumBricks, [&](int32 b)
+	{
+		float Padded[PadVolume];
+		GatherPadded(b, Padded);
+
+		int32* Vertices = VoxelVertices.GetData() + b * BrickVolume;
+		TArray<FVector3f>& OutVertices = BrickVertices[b];
+		OutVertices.Reset();
+		const FVector3f BrickBase(BrickCoords[b] * BrickSide);
+
+		for (int32 Z = 0; Z < BrickSide; ++Z)
+		{
+			for (int32 Y = 0; Y < BrickSide; ++Y)
+			{
+				for (int32 X = 0; X < BrickSide; ++X)
+				{
+					float Corners[8];
+					uint32 InsideMask = 0;
+					bool bKnown = true;
+					for (int32 c = 0; c < 8; ++c)
+					{
+						Corners[c] = Padded[PadIndex(X + (c & 1), Y + ((c >> 1) & 1), Z + ((c >> 2) & 1))];
+						bKnown &= Corners[c] >= 0.0f;
+						InsideMask |= Corners[c] >= Iso ? (1u << c) : 0u;
+					}
+
+					const int32 Voxel = LocalIndex(X, Y, Z);
+					if (!bKnown || InsideMask == 0 || InsideMask == 0xFF)
+					{
+						Vertices[Voxel] = INDEX_NONE;
+						continue;
+					}
+
+					FVector3f Sum = FVector3f::ZeroVector;
+					int32 NumCrossings = 0;
+					for (int32 c = 0; c < 8; ++c)
+					{
+						for (int32 Bit = 1; Bit < 8; Bit <<= 1)
+						{
+							const int32 Other = c | Bit;
+							if ((c & Bit) || ((InsideMask >> c) & 1) == ((InsideMask >> Other) & 1))
+							{
+								continue;
+							}
+
+							const float T = (Iso - Corners[c]) / (Corners[Other] - Corners[c]);
+							const FVector3f From(c & 1, (c >> 1) & 1, (c >> 2) & 1);
+							const FVector3f To(Other & 1, (Other >> 1) & 1, (Other >> 2) & 1);
+							Sum += FMath::Lerp(From, To, T);
+							++NumCrossings;
+						}
+					}
+
+					Vertices[Voxel] = OutVertices.Add((BrickBase + FVector3f(X, Y, Z) + Sum / NumCrossings) * VoxelSize);
+				}
+			}
+		}
+	}, ForFlags);
+
+	BrickVertexOffsets.SetNumUninitialized(NumBricks + 1, EAllowShrinking::No);
+	BrickVertexOffsets[0] = 0;
+	for (int32 b = 0; b < NumBricks; ++b)
+	{
+		BrickVertexOffsets[b + 1] = BrickVertexOffsets[b] + BrickVertices[b].Num();
+	}
+
+	// Global vertex of a voxel, INDEX_NONE if it has none (or its brick does not exist)
+	auto FindVertex = [this](const FIntVector& Voxel, FVector3f& OutPosition) -> int32
+	{
+		const int32* Brick = BrickMap.Find(NodeToBrick(Voxel));
+		if (!Brick)
+		{
+			return INDEX_NONE;
+		}
+
+		const int32 Local = VoxelVertices[*Brick * BrickVolume + LocalIndex(Voxel.X & (BrickSide - 1), Voxel.Y & (BrickSide - 1), Voxel.Z & (BrickSide - 1))];
+		if (Local == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+
+		OutPosition = BrickVertices[*Brick][Local];
+		return BrickVertexOffsets[*Brick] + Local;
+	};
+
+	// 2. One quad per crossing edge, joining the four voxels around it; each edge belongs to the brick of its lower node
+	ParallelFor(NumBricks, [&](int32 b)
+	{
+		float Padded[PadVolume];
+		GatherPadded(b, Padded);
+
+		TArray<int32>& OutIndices = BrickIndices[b];
+		OutIndices.Reset();
+		const FIntVector BrickBase = BrickCoords[b] * BrickSide;
+		const FIntVector Units[3] = { FIntVector(1, 0, 0), FIntVector(0, 1, 0), FIntVector(0, 0, 1) };
+
+		for (int32 Z = 0; Z < BrickSide; ++Z)
+		{
+			for (int32 Y = 0; Y < BrickSide; ++Y)
+			{
+				for (int32 X = 0; X < BrickSide; ++X)
+				{
+					const float Value = Padded[PadIndex(X, Y, Z)];
+					if (Value < 0.0f)
+					{
+						continue;
+					}
+
+					const FIntVector Node = BrickBase + FIntVector(X, Y, Z);
+					for (int32 Axis = 0; Axis < 3; ++Axis)
+					{
+						const float NextValue = Padded[PadIndex(X + Units[Axis].X, Y + Units[Axis].Y, Z + Units[Axis].Z)];
+						const bool bInside = Value >= Iso;
+						if (NextValue < 0.0f || bInside == (NextValue >= Iso))
+						{
+							continue;
+						}
+
+						// Voxels around the edge, counter-clockwise about +Axis
+						const FIntVector& B = Units[(Axis + 1) % 3];
+						const FIntVector& C = Units[(Axis + 2) % 3];
+						const FIntVector Voxels[4] = { Node - B - C, Node - C, Node, Node - B };
+
+						int32 Quad[4];
+						FVector3f QuadPositions[4];
+						bool bComplete = true;
+						for (int32 q = 0; q < 4 && bComplete; ++q)
+						{
+							Quad[q] = FindVertex(Voxels[q], QuadPositions[q]);
+							bComplete = Quad[q] != INDEX_NONE;
+						}
+						if (!bComplete)
+						{
+							continue;
+						}
+
+						// Counter-clockwise order faces +Axis: keep it when the fluid is on the lower node
+						if (!bInside)
+						{
+							Swap(Quad[1], Quad[3]);
+							Swap(QuadPositions[1], QuadPositions[3]);
+						}
+
+						// Split along the shorter diagonal
+						if (FVector3f::DistSquared(QuadPositions[0], QuadPositions[2]) <= FVector3f::DistSquared(QuadPositions[1], QuadPositions[3]))
+						{
+							OutIndices.Append({ Quad[0], Quad[1], Quad[2], Quad[0], Quad[2], Quad[3] });
+						}
+						else
+						{
+							OutIndices.Append({ Quad[0], Quad[1], Quad[3], Quad[1], Quad[2], Quad[3] });
+						}
+					}
+				}
+			}
+		}
+	}, ForFlags);
+
+	// 3. Concatenate
+	TArray<int32> IndexOffsets;
+	IndexOffsets.SetNumUninitialized(NumBricks + 1);
+	IndexOffsets[0] = 0;
+	for (int32 b = 0; b < NumBricks; ++b)
+	{
+		IndexOffsets[b + 1] = IndexOffsets[b] + BrickIndices[b].Num();
+	}
+
+	OutMesh.Positions.SetNumUninitialized(BrickVertexOffsets[NumBricks]);
+	OutMesh.Indices.SetNumUninitialized(IndexOffsets[NumBricks]);
+	ParallelFor(NumBricks, [&](int32 b)
+	{
+		FMemory::Memcpy(OutMesh.Positions.GetData() + BrickVertexOffsets[b], BrickVertices[b].GetData(), BrickVertices[b].Num() * sizeof(FVector3f));
+		FMemory::Memcpy(OutMesh.Indices.GetData() + IndexOffsets[b], BrickIndices[b].GetData(), BrickIndices[b].Num() * sizeof(int32));
+	}, ForFlags);
+
+	// 4. Area-weighted vertex normals (the cross product's length is twice the area)
+	OutMesh.Normals.SetNumZeroed(OutMesh.Positions.Num());
+	for (int32 i = 0; i < OutMesh.Indices.Num(); i += 3)
+	{
+		const int32 I0 = OutMesh.Indices[i];
+		const int32 I1 = OutMesh.Indices[i + 1];
+		const int32 I2 = OutMesh.Indices[i + 2];
+		const FVector3f FaceNormal = FVector3f::CrossProduct(OutMesh.Positions[I1] - OutMesh.Positions[I0], OutMesh.Positions[I2] - OutMesh.Positions[I0]);
+		OutMesh.Normals[I0] += FaceNormal;
+		OutMesh.Normals[I1] += FaceNormal;
+		OutMesh.Normals[I2] += FaceNormal;
+	}
+
+	ParallelFor(OutMesh.Normals.Num(), [&OutMesh](int32 i)
+	{
+		OutMesh.Normals[i] = OutMesh.Normals[i].GetSafeNormal();
+	}, GetForFlags(OutMesh.Normals.Num()));
+}
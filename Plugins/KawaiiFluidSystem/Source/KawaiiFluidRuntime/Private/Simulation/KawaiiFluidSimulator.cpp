@@ -55,6 +55,26 @@ static FAutoConsoleVariableRef CVarFluidCaptureFrameNumber(
 // Internal flag - reset when CVar is changed back to 1
 static int32 GFluidCapturedFrame = 0;  // Tracks which frame was captured (0 = none)
 
+static int32 GFluidQuantizedReadback = 0;  // 0 = full precision (default)
+static FAutoConsoleVariableRef CVarFluidQuantizedReadback(
+	TEXT("r.Fluid.QuantizedReadback"),
+	GFluidQuantizedReadback,
+	TEXT("Quantize the field-masked particle readback.\n")
+	TEXT("  0 = Full precision (default)\n")
+	TEXT("  1 = Half-precision velocity, 16-bit NeighborCount/Flags and half Density/Mass"),
+	ECVF_Default
+);
+
+static int32 GFluidAdaptiveReadbackDepth = 1;  // 1 = readback rings grow/shrink with the load (default)
+static FAutoConsoleVariableRef CVarFluidAdaptiveReadbackDepth(
+	TEXT("r.Fluid.AdaptiveReadbackDepth"),
+	GFluidAdaptiveReadbackDepth,
+	TEXT("Let GPU readback rings adapt their depth.\n")
+	TEXT("  0 = Fixed depth, overwrite the oldest readback in flight when full\n")
+	TEXT("  1 = Grow instead of overwriting (up to the ring cap), shrink when idle (default)"),
+	ECVF_Default
+);
+
 //=============================================================================
 // Constructor / Destructor
 //=============================================================================
@@ -185,11 +205,8 @@ void FKawaiiFluidSimulator::Release()
 	// Release Anisotropy Readback objects
 	ReleaseAnisotropyReadbackObjects();
 
-	// Clear Shadow data (extracted from StatsReadback)
-	ReadyShadowPositions.Empty();
-	ReadyShadowVelocities.Empty();
-	ReadyShadowNeighborCounts.Empty();
-	ReadyShadowPositionsFrame.store(0);
+	// Drop published snapshots (consumers still holding one keep it alive)
+	ResetSnapshots();
 
 	// Release Stats Readback objects
 	ReleaseStatsReadbackObjects();
@@ -202,15 +219,7 @@ void FKawaiiFluidSimulator::Release()
 
 	// Release Indirect Dispatch resources
 	PersistentParticleCountBuffer = nullptr;
-	for (int32 i = 0; i < NUM_COUNT_READBACK_BUFFERS; ++i)
-	{
-		if (CountReadbacks[i])
-		{
-			delete CountReadbacks[i];
-			CountReadbacks[i] = nullptr;
-		}
-	}
-	CountReadbackWriteIndex = 0;
+	CountReadbackRing.Reset();
 	bEverHadParticles = false;
 
 	bIsInitialized = false;
@@ -929,11 +938,8 @@ void FKawaiiFluidSimulator::BeginFrame()
 			// GPU-accurate before ProcessStatsReadback uses it as iteration bound
 			Self->ProcessParticleCountReadback();
 
-			// Process stats readback - also extracts shadow data if bShadowReadbackEnabled
-			const bool bNeedStatsReadback = GetFluidStatsCollector().IsAnyReadbackNeeded();
-			const bool bNeedShadowReadback = Self->bShadowReadbackEnabled.load();
-			const bool bNeedFullReadback = Self->bFullReadbackEnabled.load();
-			if (bNeedStatsReadback || bNeedShadowReadback || bNeedFullReadback)
+			// Process stats readback - unpacks whatever fields the consumers registered
+			if (Self->ResolveReadbackFieldMask() != EKawaiiFluidReadbackField::None)
 			{
 				SCOPED_DRAW_EVENT(RHICmdList, GPUFluid_BeginFrame_ProcessStatsReadback);
 				Self->ProcessStatsReadback(RHICmdList);
@@ -966,6 +972,8 @@ void FKawaiiFluidSimulator::BeginFrame()
 				Self->SpawnManager->ProcessSourceCounterReadback();
 			}
 
+			Self->PublishReadbackRingStats();
+
 			// =====================================================
 			// Step 2: Process Spawn/Despawn Operations
 			// =====================================================
@@ -1233,57 +1241,55 @@ void FKawaiiFluidSimulator::EndFrame()
 						Self->AddRecordZOrderIndicesPass(GraphBuilder, ParticleBuffer, Self->CurrentParticleCount);
 					}
 
+					// Field-masked readback: pack only what the registered consumers read
 					const int32 ParticleCount = Self->CurrentParticleCount;
-					const bool bNeedDetailedStats = GetFluidStatsCollector().IsDetailedGPUEnabled();
-					const bool bNeedVelocity = Self->bFullReadbackEnabled.load() || Self->bShadowReadbackEnabled.load();
+					const FKawaiiFluidReadbackLayout Layout = FKawaiiFluidReadbackLayout::Build(
+						Self->ResolveReadbackFieldMask(), GFluidQuantizedReadback != 0);
 
-					if (bNeedDetailedStats || bNeedVelocity)
-					{
-						// Full 64-byte readback (Z-Order state, no sort)
-						AddReadbackBufferPass(GraphBuilder,
-							RDG_EVENT_NAME("GPUFluid::ZOrderReadback(Full)"),
-							ParticleBuffer,
-							[Self, ParticleBuffer, ParticleCount](FRHICommandListImmediate& InRHICmdList)
-							{
-								Self->EnqueueStatsReadback(InRHICmdList, ParticleBuffer->GetRHI(), ParticleCount, /*bCompactMode=*/false);
-							});
-					}
-					else
+					if (!Layout.IsEmpty())
 					{
-						// Compact 32-byte readback (50% bandwidth reduction)
 						// ParticleCount (CPU) is used as safe upper bound for allocation only
 						// Shader uses ParticleCountBuffer[6] (GPU-accurate) for bounds
-						FRDGBufferDesc CompactBufferDesc = FRDGBufferDesc::CreateStructuredDesc(
-							sizeof(FCompactParticleStats), ParticleCount);
-						FRDGBufferRef CompactBuffer = GraphBuilder.CreateBuffer(CompactBufferDesc, TEXT("CompactStatsBuffer"));
+						FRDGBufferDesc PackedBufferDesc = FRDGBufferDesc::CreateStructuredDesc(
+							sizeof(uint32), ParticleCount * Layout.StrideWords);
+						FRDGBufferRef PackedBuffer = GraphBuilder.CreateBuffer(PackedBufferDesc, TEXT("PackedReadbackBuffer"));
 
 						// Register ParticleCountBuffer for indirect dispatch + shader bounds
 						FRDGBufferRef CountBuffer = GraphBuilder.RegisterExternalBuffer(
-							Self->PersistentParticleCountBuffer, TEXT("ParticleCountBuffer_CompactStats"));
+							Self->PersistentParticleCountBuffer, TEXT("ParticleCountBuffer_PackedReadback"));
 
 						{
 							FGlobalShaderMap* GlobalShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
-							TShaderMapRef<FCompactStatsCS> ComputeShader(GlobalShaderMap);
+							TShaderMapRef<FPackReadbackCS> ComputeShader(GlobalShaderMap);
 
-							FCompactStatsCS::FParameters* PassParameters =
-								GraphBuilder.AllocParameters<FCompactStatsCS::FParameters>();
+							FPackReadbackCS::FParameters* PassParameters =
+								GraphBuilder.AllocParameters<FPackReadbackCS::FParameters>();
 
 							PassParameters->InParticles = GraphBuilder.CreateSRV(ParticleBuffer);
-							PassParameters->OutCompactStats = GraphBuilder.CreateUAV(CompactBuffer);
+							PassParameters->OutPackedReadback = GraphBuilder.CreateUAV(PackedBuffer);
 							PassParameters->ParticleCountBuffer = GraphBuilder.CreateSRV(CountBuffer);
+							PassParameters->ReadbackStrideWords = Layout.StrideWords;
+							for (int32 Field = 0; Field < EKawaiiFluidReadbackField::NumFields; ++Field)
+							{
+								PassParameters->ReadbackFieldSlots[Field] = FIntVector4(-1, 0, 0, 0);
+							}
+							for (const FKawaiiFluidReadbackFieldSlot& Slot : Layout.Slots)
+							{
+								PassParameters->ReadbackFieldSlots[Slot.FieldIndex] = FIntVector4(Slot.WordOffset, static_cast<int32>(Slot.Encoding), 0, 0);
+							}
 
 							GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
-								RDG_EVENT_NAME("GPUFluid::CompactStats(Indirect)"),
+								RDG_EVENT_NAME("GPUFluid::PackReadback(Indirect)"),
 								ComputeShader, PassParameters, CountBuffer,
 								GPUIndirectDispatch::IndirectArgsOffset_TG256);
 						}
 
 						AddReadbackBufferPass(GraphBuilder,
-							RDG_EVENT_NAME("GPUFluid::ZOrderReadback(Compact)"),
-							CompactBuffer,
-							[Self, CompactBuffer, ParticleCount](FRHICommandListImmediate& InRHICmdList)
+							RDG_EVENT_NAME("GPUFluid::ZOrderReadback(Packed)"),
+							PackedBuffer,
+							[Self, PackedBuffer, ParticleCount, Layout](FRHICommandListImmediate& InRHICmdList)
 							{
-								Self->EnqueueStatsReadback(InRHICmdList, CompactBuffer->GetRHI(), ParticleCount, /*bCompactMode=*/true);
+								Self->EnqueueStatsReadback(InRHICmdList, PackedBuffer->GetRHI(), ParticleCount, Layout);
 							});
 					}
 
@@ -1302,7 +1308,8 @@ void FKawaiiFluidSimulator::EndFrame()
 				// Anisotropy readback
 				{
 					SCOPED_DRAW_EVENT(RHICmdList, EndFrame_AnisotropyReadback);
-					if (Self->bShadowReadbackEnabled.load() && Self->bAnisotropyReadbackEnabled.load())
+					if (Self->GetReadbackConsumerFields(EKawaiiFluidReadbackConsumer::Shadow) != EKawaiiFluidReadbackField::None
+						&& Self->bAnisotropyReadbackEnabled.load())
 					{
 						Self->EnqueueAnisotropyReadback(RHICmdList, Self->CurrentParticleCount);
 					}
@@ -1359,53 +1366,31 @@ void FKawaiiFluidSimulator::EnqueueParticleCountReadback(FRHICommandListImmediat
 		return;
 	}
 
-	const int32 WriteIdx = CountReadbackWriteIndex;
-	CountReadbackWriteIndex = (CountReadbackWriteIndex + 1) % NUM_COUNT_READBACK_BUFFERS;
-
-	if (!CountReadbacks[WriteIdx])
-	{
-		CountReadbacks[WriteIdx] = new FRHIGPUBufferReadback(*FString::Printf(TEXT("ParticleCountReadback_%d"), WriteIdx));
-	}
-
-	CountReadbacks[WriteIdx]->EnqueueCopy(RHICmdList, PersistentParticleCountBuffer->GetRHI(), GPUIndirectDispatch::BufferSizeBytes);
-	bCountReadbackValid[WriteIdx] = true;
-	CountReadbackFrameNumbers[WriteIdx] = GFrameCounterRenderThread;
+	const int32 WriteIdx = CountReadbackRing.BeginWrite(GFrameCounterRenderThread);
+	CountReadbackRing.GetReadback(WriteIdx).EnqueueCopy(RHICmdList, PersistentParticleCountBuffer->GetRHI(), GPUIndirectDispatch::BufferSizeBytes);
 }
 
 void FKawaiiFluidSimulator::ProcessParticleCountReadback()
 {
-	// Find newest valid ready readback by frame number (most up-to-date GPU count)
-	int32 ReadIdx = -1;
-	uint64 NewestFrame = 0;
-	for (int32 i = 0; i < NUM_COUNT_READBACK_BUFFERS; ++i)
-	{
-		if (CountReadbacks[i] && bCountReadbackValid[i] && CountReadbacks[i]->IsReady())
-		{
-			if (CountReadbackFrameNumbers[i] > NewestFrame)
-			{
-				NewestFrame = CountReadbackFrameNumbers[i];
-				ReadIdx = i;
-			}
-		}
-	}
-
+	// Newest ready readback wins (most up-to-date GPU count); older ready ones are dropped as stale,
+	// newer ones still in flight survive
+	const int32 ReadIdx = CountReadbackRing.FindReadySlot();
 	if (ReadIdx < 0)
 	{
 		return;
 	}
 
-	const uint32* Data = static_cast<const uint32*>(CountReadbacks[ReadIdx]->Lock(GPUIndirectDispatch::BufferSizeBytes));
+	FRHIGPUBufferReadback& Readback = CountReadbackRing.GetReadback(ReadIdx);
+	const uint32* Data = static_cast<const uint32*>(Readback.Lock(GPUIndirectDispatch::BufferSizeBytes));
 	if (Data)
 	{
 		const int32 GPUCount = static_cast<int32>(Data[GPUIndirectDispatch::ParticleCountElementIndex]);
 		CurrentParticleCount = GPUCount;
 
-		// Consumed: mark this slot invalid so it won't be re-read.
-		// Other slots are left intact — newer readbacks with count>0 must survive
-		// even when an older stale count=0 readback is consumed first.
-		bCountReadbackValid[ReadIdx] = false;
+		// Consumed: free this slot so it won't be re-read
+		CountReadbackRing.Consume(ReadIdx, GFrameCounterRenderThread);
 	}
-	CountReadbacks[ReadIdx]->Unlock();
+	Readback.Unlock();
 }
 
 FRDGBufferRef FKawaiiFluidSimulator::PrepareParticleBuffer(
@@ -2318,7 +2303,7 @@ void FKawaiiFluidSimulator::AddSpawnRequest(const FVector3f& Position, const FVe
 	if (SpawnManager.IsValid()) { SpawnManager->AddSpawnRequest(Position, Velocity, Mass); }
 }
 
-void FKawaiiFluidSimulator::AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests)
+void FKawaiiFluidSimulator::AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests)
 {
 	if (SpawnManager.IsValid()) { SpawnManager->AddSpawnRequests(Requests); }
 }
@@ -2347,90 +2332,51 @@ void FKawaiiFluidSimulator::SetSourceEmitterMax(int32 SourceID, int32 MaxCount)
 	}
 }
 
-bool FKawaiiFluidSimulator::GetParticlePositionsAndIDs(TArray<FVector3f>& OutPositions, TArray<int32>& OutParticleIDs, TArray<int32>& OutSourceIDs)
-{
-	if (!bHasValidGPUResults.load())
-	{
-		return false;
-	}
-
-	FScopeLock Lock(&BufferLock);
-
-	if (CachedParticlePositions.Num() == 0 || CachedAllParticleIDs.Num() == 0)
-	{
-		return false;
-	}
-
-	OutPositions = CachedParticlePositions;
-	OutParticleIDs = CachedAllParticleIDs;
-	OutSourceIDs = CachedParticleSourceIDs;
-	return true;
-}
-
-bool FKawaiiFluidSimulator::GetParticlePositionsAndVelocities(TArray<FVector3f>& OutPositions, TArray<FVector3f>& OutVelocities)
+TSharedPtr<const FKawaiiFluidParticleSnapshot> FKawaiiFluidSimulator::GetParticleSnapshot() const
 {
-	if (!bHasValidGPUResults.load())
+	TSharedPtr<const FKawaiiFluidParticleSnapshot> Published;
 	{
-		return false;
+		FScopeLock Lock(&SnapshotLock);
+		Published = ParticleSnapshot;
 	}
 
-	FScopeLock Lock(&BufferLock);
-
-	if (CachedParticlePositions.Num() == 0)
+	if (!Published.IsValid())
 	{
-		return false;
+		return nullptr;
 	}
 
-	OutPositions = CachedParticlePositions;
-	OutVelocities = CachedParticleVelocities;  // May be empty if ISM not enabled
-	return true;
+	// The handle has its own reference count and holds the published snapshot strongly until the last
+	// consumer copy is released. Weak pointers therefore only ever reference the handle, and recycling
+	// (AcquireRecycledParticleSnapshot) cannot reach a snapshot that a consumer could still pin.
+	const FKawaiiFluidParticleSnapshot* Raw = Published.Get();
+	return TSharedPtr<const FKawaiiFluidParticleSnapshot>(Raw, [Held = MoveTemp(Published)](const FKawaiiFluidParticleSnapshot*) {});
 }
 
-const TArray<int32>* FKawaiiFluidSimulator::GetParticleIDsBySourceID(int32 SourceID) const
+TSharedPtr<const FKawaiiFluidAnisotropySnapshot> FKawaiiFluidSimulator::GetAnisotropySnapshot() const
 {
-	if (!bHasValidGPUResults.load())
-	{
-		return nullptr;
-	}
-
-	if (SourceID < 0 || SourceID >= CachedSourceIDToParticleIDs.Num())
-	{
-		return nullptr;
-	}
-
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-	const TArray<int32>& Result = CachedSourceIDToParticleIDs[SourceID];
-	return Result.Num() > 0 ? &Result : nullptr;
+	FScopeLock Lock(&SnapshotLock);
+	return AnisotropySnapshot;
 }
 
-const TArray<int32>* FKawaiiFluidSimulator::GetAllParticleIDs() const
+uint32 FKawaiiFluidSimulator::ResolveReadbackFieldMask() const
 {
-	if (!bHasValidGPUResults.load())
-	{
-		return nullptr;
-	}
-
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-	if (CachedAllParticleIDs.Num() == 0)
+	uint32 FieldMask = EKawaiiFluidReadbackField::None;
+	for (const std::atomic<uint32>& ConsumerFields : ReadbackConsumerFields)
 	{
-		return nullptr;
+		FieldMask |= ConsumerFields.load();
 	}
-	return &CachedAllParticleIDs;
-}
 
-const TArray<uint32>* FKawaiiFluidSimulator::GetParticleFlags() const
-{
-	if (!bHasValidGPUResults.load())
+	// The stats collector is global, its requests are folded in here instead of being registered
+	const FKawaiiFluidSimulationStatsCollector& Collector = GetFluidStatsCollector();
+	if (Collector.IsDetailedGPUEnabled())
 	{
-		return nullptr;
+		FieldMask |= EKawaiiFluidReadbackField::DetailedStatsSet;
 	}
-
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-	if (CachedParticleFlags.Num() == 0)
+	if (Collector.IsReadbackRequested())
 	{
-		return nullptr;
+		FieldMask |= EKawaiiFluidReadbackField::DespawnSet;
 	}
-	return &CachedParticleFlags;
+	return FieldMask;
 }
 
 void FKawaiiFluidSimulator::ClearSpawnRequests()
@@ -2943,28 +2889,31 @@ void FKawaiiFluidSimulator::FinalizeUpload()
 		CurrentParticleCount = ParticleCount;
 		bNeedsFullUpload = false;
 
-		// Build readback cache at upload time (immediately usable in ClearAllParticles etc.)
-		// Build cache immediately from CPU data without waiting for GPU readback
-		constexpr int32 MaxSources = EGPUParticleSource::MaxSourceCount;
-		CachedSourceIDToParticleIDs.SetNum(MaxSources);
-		for (int32 i = 0; i < MaxSources; ++i)
-		{
-			CachedSourceIDToParticleIDs[i].Reset();
-		}
-		CachedAllParticleIDs.Empty();
-		CachedAllParticleIDs.Reserve(ParticleCount);
+		bHasValidGPUResults.store(true);
+	}
+
+	// Publish an upload snapshot (immediately usable in ClearAllParticles etc.)
+	// Built from the CPU copy without waiting for GPU readback
+	{
+		TSharedRef<FKawaiiFluidParticleSnapshot> Snapshot = MakeShared<FKawaiiFluidParticleSnapshot>();
+		Snapshot->NumParticles = ParticleCount;
+		Snapshot->Positions.SetNumUninitialized(ParticleCount);
+		Snapshot->Flags.SetNumUninitialized(ParticleCount);
+		Snapshot->ParticleIDs.SetNumUninitialized(ParticleCount);
+		Snapshot->SourceIDs.SetNumUninitialized(ParticleCount);
 
-		for (const FGPUFluidParticle& P : CachedGPUParticles)
+		for (int32 i = 0; i < ParticleCount; ++i)
 		{
-			if (P.SourceID >= 0 && P.SourceID < MaxSources)
-			{
-				CachedSourceIDToParticleIDs[P.SourceID].Add(P.ParticleID);
-			}
-			CachedAllParticleIDs.Add(P.ParticleID);
+			const FGPUFluidParticle& P = ParticlesCopy[i];
+			Snapshot->Positions[i] = P.Position;
+			Snapshot->Flags[i] = P.Flags;
+			Snapshot->ParticleIDs[i] = P.ParticleID;
+			Snapshot->SourceIDs[i] = P.SourceID;
 		}
+		Snapshot->SourceIndex.Build(Snapshot->SourceIDs, Snapshot->ParticleIDs);
 
-		bHasValidGPUResults.store(true);
-		KF_LOG_DEV(Log, TEXT("FinalizeUpload: Built readback cache for %d particles"), ParticleCount);
+		PublishParticleSnapshot(Snapshot);
+		KF_LOG_DEV(Log, TEXT("FinalizeUpload: Published upload snapshot for %d particles"), ParticleCount);
 	}
 	// ═══════════════════════════════════════════════════
 	// Lock released - FlushRenderingCommands is now safe
@@ -3596,145 +3545,40 @@ void FKawaiiFluidSimulator::ProcessColliderContactCountReadback(FRHICommandListI
 //=============================================================================
 
 /**
- * @brief Allocate anisotropy readback objects for async GPU→CPU transfer.
- * @param RHICmdList RHI command list.
- */
-void FKawaiiFluidSimulator::AllocateAnisotropyReadbackObjects(FRHICommandListImmediate& RHICmdList)
-{
-	for (int32 i = 0; i < NUM_ANISOTROPY_READBACK_BUFFERS; ++i)
-	{
-		AnisotropyReadbackFrameNumbers[i] = 0;
-		AnisotropyReadbackParticleCounts[i] = 0;
-
-		// Allocate anisotropy readback objects (3 buffers per frame: Axis1, Axis2, Axis3)
-		for (int32 j = 0; j < 3; ++j)
-		{
-			if (AnisotropyReadbacks[i][j] == nullptr)
-			{
-				AnisotropyReadbacks[i][j] = new FRHIGPUBufferReadback(
-					*FString::Printf(TEXT("AnisotropyReadback_%d_Axis%d"), i, j + 1));
-			}
-		}
-	}
-
-	KF_LOG_DEV(Log, TEXT("Anisotropy readback objects allocated (NumBuffers=%d)"), NUM_ANISOTROPY_READBACK_BUFFERS);
-}
-
-/**
- * @brief Release anisotropy readback objects.
+ * @brief Create the three axis readbacks of one anisotropy ring slot.
+ * @param InName Slot name.
  */
-void FKawaiiFluidSimulator::ReleaseAnisotropyReadbackObjects()
+FKawaiiFluidSimulator::FAnisotropyReadbackSet::FAnisotropyReadbackSet(FName InName)
 {
-	for (int32 i = 0; i < NUM_ANISOTROPY_READBACK_BUFFERS; ++i)
+	for (int32 Axis = 0; Axis < 3; ++Axis)
 	{
-		AnisotropyReadbackFrameNumbers[i] = 0;
-		AnisotropyReadbackParticleCounts[i] = 0;
-
-		// Release anisotropy readback objects
-		for (int32 j = 0; j < 3; ++j)
-		{
-			if (AnisotropyReadbacks[i][j] != nullptr)
-			{
-				delete AnisotropyReadbacks[i][j];
-				AnisotropyReadbacks[i][j] = nullptr;
-			}
-		}
+		Axes[Axis] = MakeUnique<FRHIGPUBufferReadback>(*FString::Printf(TEXT("%s_Axis%d"), *InName.ToString(), Axis + 1));
 	}
-	AnisotropyReadbackWriteIndex = 0;
-	ReadyShadowAnisotropyAxis1.Empty();
-	ReadyShadowAnisotropyAxis2.Empty();
-	ReadyShadowAnisotropyAxis3.Empty();
-	ReadyShadowAnisotropyFrame.store(0);
 }
 
-/**
- * @brief Get shadow positions for ISM shadow instances (non-blocking).
- * @param OutPositions Output array of particle positions (FVector).
- * @return true if valid positions were retrieved.
- */
-bool FKawaiiFluidSimulator::GetShadowPositions(TArray<FVector>& OutPositions) const
-{
-	if (ReadyShadowPositionsFrame.load() == 0 || ReadyShadowPositions.Num() == 0)
-	{
-		OutPositions.Empty();
-		return false;
-	}
-
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-
-	const int32 Count = ReadyShadowPositions.Num();
-	OutPositions.SetNumUninitialized(Count);
-
-	for (int32 i = 0; i < Count; ++i)
-	{
-		OutPositions[i] = FVector(ReadyShadowPositions[i]);
-	}
-
-	return true;
-}
+FKawaiiFluidSimulator::FAnisotropyReadbackSet::~FAnisotropyReadbackSet() = default;
 
 /**
- * @brief Get shadow positions and velocities for prediction.
- * @param OutPositions Output array of particle positions.
- * @param OutVelocities Output array of particle velocities.
- * @return true if valid data was retrieved.
+ * @brief A slot is ready once all three axis copies landed.
+ * @return True if every axis readback is ready.
  */
-bool FKawaiiFluidSimulator::GetShadowPositionsAndVelocities(TArray<FVector>& OutPositions, TArray<FVector>& OutVelocities) const
+bool FKawaiiFluidSimulator::FAnisotropyReadbackSet::IsReady() const
 {
-	if (ReadyShadowPositionsFrame.load() == 0 || ReadyShadowPositions.Num() == 0)
-	{
-		OutPositions.Empty();
-		OutVelocities.Empty();
-		return false;
-	}
-
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-
-	// Defensive check: ensure velocity array matches position array size
-	if (ReadyShadowVelocities.Num() != ReadyShadowPositions.Num())
-	{
-		OutPositions.Empty();
-		OutVelocities.Empty();
-		return false;
-	}
-
-	const int32 Count = ReadyShadowPositions.Num();
-	OutPositions.SetNumUninitialized(Count);
-	OutVelocities.SetNumUninitialized(Count);
-
-	for (int32 i = 0; i < Count; ++i)
-	{
-		OutPositions[i] = FVector(ReadyShadowPositions[i]);
-		OutVelocities[i] = FVector(ReadyShadowVelocities[i]);
-	}
-
-	return true;
+	return Axes[0]->IsReady() && Axes[1]->IsReady() && Axes[2]->IsReady();
 }
 
 /**
- * @brief Get neighbor counts for isolation detection (non-blocking).
- * @param OutNeighborCounts Output array of neighbor counts per particle.
- * @return true if valid data was retrieved.
+ * @brief Release anisotropy readback objects.
  */
-bool FKawaiiFluidSimulator::GetShadowNeighborCounts(TArray<int32>& OutNeighborCounts) const
+void FKawaiiFluidSimulator::ReleaseAnisotropyReadbackObjects()
 {
-	if (ReadyShadowPositionsFrame.load() == 0 || ReadyShadowNeighborCounts.Num() == 0)
-	{
-		OutNeighborCounts.Empty();
-		return false;
-	}
+	AnisotropyReadbackRing.Reset();
 
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-
-	const int32 Count = ReadyShadowNeighborCounts.Num();
-	OutNeighborCounts.SetNumUninitialized(Count);
-
-	for (int32 i = 0; i < Count; ++i)
+	TSharedPtr<const FKawaiiFluidAnisotropySnapshot> Released;
 	{
-		OutNeighborCounts[i] = static_cast<int32>(ReadyShadowNeighborCounts[i]);
+		FScopeLock Lock(&SnapshotLock);
+		Released = MoveTemp(AnisotropySnapshot);
 	}
-
-	return true;
 }
 
 /**
@@ -3757,16 +3601,6 @@ void FKawaiiFluidSimulator::EnqueueAnisotropyReadback(FRHICommandListImmediate&
 		return;
 	}
 
-	// Allocate readback objects if needed
-	if (AnisotropyReadbacks[0][0] == nullptr)
-	{
-		AllocateAnisotropyReadbackObjects(RHICmdList);
-	}
-
-	// Get current write index and advance for next frame
-	const int32 WriteIdx = AnisotropyReadbackWriteIndex;
-	AnisotropyReadbackWriteIndex = (AnisotropyReadbackWriteIndex + 1) % NUM_ANISOTROPY_READBACK_BUFFERS;
-
 	// Calculate copy size (float4 per particle per axis)
 	const uint32 RequiredSize = ParticleCount * sizeof(FVector4f);
 
@@ -3775,35 +3609,28 @@ void FKawaiiFluidSimulator::EnqueueAnisotropyReadback(FRHICommandListImmediate&
 	FRHIBuffer* Axis2RHI = PersistentAnisotropyAxis2Buffer->GetRHI();
 	FRHIBuffer* Axis3RHI = PersistentAnisotropyAxis3Buffer->GetRHI();
 
-	// Validate all buffers and readbacks exist
-	if (!Axis1RHI || !Axis2RHI || !Axis3RHI ||
-		!AnisotropyReadbacks[WriteIdx][0] ||
-		!AnisotropyReadbacks[WriteIdx][1] ||
-		!AnisotropyReadbacks[WriteIdx][2])
+	if (!Axis1RHI || !Axis2RHI || !Axis3RHI)
 	{
 		return;
 	}
 
-	// Check if ALL buffers have sufficient size BEFORE enqueueing any copies
-	const uint32 Axis1Size = Axis1RHI->GetSize();
-	const uint32 Axis2Size = Axis2RHI->GetSize();
-	const uint32 Axis3Size = Axis3RHI->GetSize();
-
-	if (RequiredSize > Axis1Size || RequiredSize > Axis2Size || RequiredSize > Axis3Size)
+	// Check if ALL buffers have sufficient size BEFORE claiming a slot and enqueueing any copies
+	if (RequiredSize > Axis1RHI->GetSize() || RequiredSize > Axis2RHI->GetSize() || RequiredSize > Axis3RHI->GetSize())
 	{
 		return;
 	}
 
-	// All buffers are valid and large enough - now safe to store particle count and enqueue
-	AnisotropyReadbackParticleCounts[WriteIdx] = ParticleCount;
-	AnisotropyReadbackFrameNumbers[WriteIdx] = GFrameCounterRenderThread;
+	// All buffers are valid and large enough - now safe to claim a slot and enqueue
+	const int32 WriteIdx = AnisotropyReadbackRing.BeginWrite(GFrameCounterRenderThread);
+	AnisotropyReadbackRing.GetPayload(WriteIdx) = ParticleCount;
+	FAnisotropyReadbackSet& Readback = AnisotropyReadbackRing.GetReadback(WriteIdx);
 
 	RHICmdList.Transition(FRHITransitionInfo(Axis1RHI, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
 	RHICmdList.Transition(FRHITransitionInfo(Axis2RHI, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
 	RHICmdList.Transition(FRHITransitionInfo(Axis3RHI, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
-	AnisotropyReadbacks[WriteIdx][0]->EnqueueCopy(RHICmdList, Axis1RHI, RequiredSize);
-	AnisotropyReadbacks[WriteIdx][1]->EnqueueCopy(RHICmdList, Axis2RHI, RequiredSize);
-	AnisotropyReadbacks[WriteIdx][2]->EnqueueCopy(RHICmdList, Axis3RHI, RequiredSize);
+	Readback.Axes[0]->EnqueueCopy(RHICmdList, Axis1RHI, RequiredSize);
+	Readback.Axes[1]->EnqueueCopy(RHICmdList, Axis2RHI, RequiredSize);
+	Readback.Axes[2]->EnqueueCopy(RHICmdList, Axis3RHI, RequiredSize);
 	RHICmdList.Transition(FRHITransitionInfo(Axis1RHI, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
 	RHICmdList.Transition(FRHITransitionInfo(Axis2RHI, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
 	RHICmdList.Transition(FRHITransitionInfo(Axis3RHI, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
@@ -3819,611 +3646,331 @@ void FKawaiiFluidSimulator::ProcessAnisotropyReadback()
 		return;
 	}
 
-	// Search for oldest ready buffer
-	int32 ReadIdx = -1;
-	uint64 OldestFrame = UINT64_MAX;
-
-	for (int32 i = 0; i < NUM_ANISOTROPY_READBACK_BUFFERS; ++i)
-	{
-		if (AnisotropyReadbackFrameNumbers[i] > 0 &&
-			AnisotropyReadbacks[i][0] != nullptr &&
-			AnisotropyReadbacks[i][0]->IsReady() &&
-			AnisotropyReadbacks[i][1]->IsReady() &&
-			AnisotropyReadbacks[i][2]->IsReady())
-		{
-			if (AnisotropyReadbackFrameNumbers[i] < OldestFrame)
-			{
-				OldestFrame = AnisotropyReadbackFrameNumbers[i];
-				ReadIdx = i;
-			}
-		}
-	}
-
+	// Oldest ready slot first
+	const int32 ReadIdx = AnisotropyReadbackRing.FindReadySlot();
 	if (ReadIdx < 0)
 	{
 		return;  // No ready buffers
 	}
 
-	const int32 EnqueuedParticleCount = AnisotropyReadbackParticleCounts[ReadIdx];
+	const int32 EnqueuedParticleCount = AnisotropyReadbackRing.GetPayload(ReadIdx);
 	if (EnqueuedParticleCount <= 0)
 	{
+		AnisotropyReadbackRing.Discard(ReadIdx);
 		return;
 	}
 
+	// Copy all 3 axes into a new snapshot (no lock: the published one is never written)
 	const int32 BufferSize = EnqueuedParticleCount * sizeof(FVector4f);
-	FScopeLock Lock(&BufferLock);
+	TSharedRef<FKawaiiFluidAnisotropySnapshot> Snapshot = MakeShared<FKawaiiFluidAnisotropySnapshot>();
+	Snapshot->Frame = AnisotropyReadbackRing.GetFrame(ReadIdx);
+	TArray<FVector4f>* Axes[3] = { &Snapshot->Axis1, &Snapshot->Axis2, &Snapshot->Axis3 };
 
-	// Copy all 3 axes
-	const FVector4f* Axis1Data = (const FVector4f*)AnisotropyReadbacks[ReadIdx][0]->Lock(BufferSize);
-	if (Axis1Data)
+	FAnisotropyReadbackSet& Readback = AnisotropyReadbackRing.GetReadback(ReadIdx);
+	bool bAllAxesRead = true;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
 	{
-		ReadyShadowAnisotropyAxis1.SetNumUninitialized(EnqueuedParticleCount);
-		FMemory::Memcpy(ReadyShadowAnisotropyAxis1.GetData(), Axis1Data, BufferSize);
-		AnisotropyReadbacks[ReadIdx][0]->Unlock();
+		const FVector4f* AxisData = (const FVector4f*)Readback.Axes[Axis]->Lock(BufferSize);
+		if (AxisData)
+		{
+			Axes[Axis]->SetNumUninitialized(EnqueuedParticleCount);
+			FMemory::Memcpy(Axes[Axis]->GetData(), AxisData, BufferSize);
+			Readback.Axes[Axis]->Unlock();
+		}
+		else
+		{
+			bAllAxesRead = false;
+		}
 	}
 
-	const FVector4f* Axis2Data = (const FVector4f*)AnisotropyReadbacks[ReadIdx][1]->Lock(BufferSize);
-	if (Axis2Data)
+	// A partial readback keeps the previous snapshot
+	if (bAllAxesRead)
 	{
-		ReadyShadowAnisotropyAxis2.SetNumUninitialized(EnqueuedParticleCount);
-		FMemory::Memcpy(ReadyShadowAnisotropyAxis2.GetData(), Axis2Data, BufferSize);
-		AnisotropyReadbacks[ReadIdx][1]->Unlock();
+		PublishAnisotropySnapshot(Snapshot);
+		AnisotropyReadbackRing.Consume(ReadIdx, GFrameCounterRenderThread);
 	}
-
-	const FVector4f* Axis3Data = (const FVector4f*)AnisotropyReadbacks[ReadIdx][2]->Lock(BufferSize);
-	if (Axis3Data)
+	else
 	{
-		ReadyShadowAnisotropyAxis3.SetNumUninitialized(EnqueuedParticleCount);
-		FMemory::Memcpy(ReadyShadowAnisotropyAxis3.GetData(), Axis3Data, BufferSize);
-		AnisotropyReadbacks[ReadIdx][2]->Unlock();
+		AnisotropyReadbackRing.Discard(ReadIdx);
 	}
-
-	ReadyShadowAnisotropyFrame.store(AnisotropyReadbackFrameNumbers[ReadIdx]);
-
-	// Mark buffer as available for next write cycle
-	AnisotropyReadbackFrameNumbers[ReadIdx] = 0;
 }
 
 //=============================================================================
 // Stats/Recycle Readback Implementation (Async GPU→CPU for ParticleID-based operations)
 //=============================================================================
 
-void FKawaiiFluidSimulator::AllocateStatsReadbackObjects(FRHICommandListImmediate& RHICmdList)
-{
-	for (int32 i = 0; i < NUM_STATS_READBACK_BUFFERS; ++i)
-	{
-		if (StatsReadbacks[i] == nullptr)
-		{
-			StatsReadbacks[i] = new FRHIGPUBufferReadback(*FString::Printf(TEXT("StatsReadback_%d"), i));
-		}
-		StatsReadbackFrameNumbers[i] = 0;
-		StatsReadbackParticleCounts[i] = 0;
-	}
-
-	KF_LOG_DEV(Log, TEXT("Stats readback objects allocated (NumBuffers=%d)"), NUM_STATS_READBACK_BUFFERS);
-}
-
 void FKawaiiFluidSimulator::ReleaseStatsReadbackObjects()
 {
-	for (int32 i = 0; i < NUM_STATS_READBACK_BUFFERS; ++i)
-	{
-		if (StatsReadbacks[i] != nullptr)
-		{
-			delete StatsReadbacks[i];
-			StatsReadbacks[i] = nullptr;
-		}
-		StatsReadbackFrameNumbers[i] = 0;
-		StatsReadbackParticleCounts[i] = 0;
-		bStatsReadbackCompactMode[i] = false;
-	}
-	StatsReadbackWriteIndex = 0;
+	StatsReadbackRing.Reset();
 }
 
-void FKawaiiFluidSimulator::EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, bool bCompactMode)
+void FKawaiiFluidSimulator::EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, const FKawaiiFluidReadbackLayout& Layout)
 {
-	if (ParticleCount <= 0 || SourceBuffer == nullptr)
+	if (ParticleCount <= 0 || SourceBuffer == nullptr || Layout.IsEmpty())
 	{
 		return;
 	}
 
-	// Validate source buffer size based on mode
+	// Validate source buffer size against the packed record stride
 	const uint32 SourceBufferSize = SourceBuffer->GetSize();
-	const uint32 ElementSize = bCompactMode ? sizeof(FCompactParticleStats) : sizeof(FGPUFluidParticle);
+	const uint32 ElementSize = Layout.GetStrideBytes();
 	const uint32 RequiredSize = ParticleCount * ElementSize;
 	if (RequiredSize > SourceBufferSize)
 	{
-		KF_LOG_DEV(Verbose, TEXT("EnqueueStatsReadback: CopySize (%u) exceeds SourceBuffer size (%u). ParticleCount=%d, Compact=%d, Skipping."),
-			RequiredSize, SourceBufferSize, ParticleCount, bCompactMode ? 1 : 0);
+		KF_LOG_DEV(Verbose, TEXT("EnqueueStatsReadback: CopySize (%u) exceeds SourceBuffer size (%u). ParticleCount=%d, Stride=%u, Skipping."),
+			RequiredSize, SourceBufferSize, ParticleCount, ElementSize);
 		return;
 	}
 
-	// Allocate readback objects if needed
-	if (StatsReadbacks[0] == nullptr)
-	{
-		AllocateStatsReadbackObjects(RHICmdList);
-	}
-
-	// Get current write index and advance for next frame
-	const int32 WriteIdx = StatsReadbackWriteIndex;
-	StatsReadbackWriteIndex = (StatsReadbackWriteIndex + 1) % NUM_STATS_READBACK_BUFFERS;
+	// Claim a ring slot (grows the ring instead of overwriting a readback still in flight)
+	const int32 WriteIdx = StatsReadbackRing.BeginWrite(GFrameCounterRenderThread);
+	FStatsReadbackPayload& Payload = StatsReadbackRing.GetPayload(WriteIdx);
+	Payload.ParticleCount = ParticleCount;
+	Payload.Layout = Layout;
 
-	// Enqueue async copy (compact 32 bytes or full 64 bytes per particle)
+	// Enqueue async copy (StrideWords * 4 bytes per particle)
 	const uint32 CopySize = ParticleCount * ElementSize;
 	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
-	StatsReadbacks[WriteIdx]->EnqueueCopy(RHICmdList, SourceBuffer, CopySize);
+	StatsReadbackRing.GetReadback(WriteIdx).EnqueueCopy(RHICmdList, SourceBuffer, CopySize);
 	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
-	StatsReadbackFrameNumbers[WriteIdx] = GFrameCounterRenderThread;
-	StatsReadbackParticleCounts[WriteIdx] = ParticleCount;
-	bStatsReadbackCompactMode[WriteIdx] = bCompactMode;
 }
 
 void FKawaiiFluidSimulator::ProcessStatsReadback(FRHICommandListImmediate& RHICmdList)
 {
-	if (StatsReadbacks[0] == nullptr)
-	{
-		return;
-	}
-
-	// Search for newest ready buffer (prevents stale pre-despawn data from refilling cache)
-	int32 ReadIdx = -1;
-	uint64 NewestFrame = 0;
-
-	for (int32 i = 0; i < NUM_STATS_READBACK_BUFFERS; ++i)
-	{
-		if (StatsReadbacks[i] != nullptr &&
-			StatsReadbackFrameNumbers[i] > 0 &&
-			StatsReadbacks[i]->IsReady())
-		{
-			if (StatsReadbackFrameNumbers[i] > NewestFrame)
-			{
-				NewestFrame = StatsReadbackFrameNumbers[i];
-				ReadIdx = i;
-			}
-		}
-	}
-
+	// Newest ready buffer wins; the ring drops older ready ones (stale pre-despawn data would refill the cache)
+	const int32 ReadIdx = StatsReadbackRing.FindReadySlot();
 	if (ReadIdx < 0)
 	{
 		return;  // No ready buffers
 	}
 
-	// Discard older ready buffers — they contain stale pre-despawn data
-	for (int32 i = 0; i < NUM_STATS_READBACK_BUFFERS; ++i)
-	{
-		if (i != ReadIdx && StatsReadbackFrameNumbers[i] > 0
-			&& StatsReadbacks[i] && StatsReadbacks[i]->IsReady())
-		{
-			StatsReadbackFrameNumbers[i] = 0;
-		}
-	}
-
 	// Use stored count directly — the readback buffer is a self-contained snapshot
 	// with exactly StoredCount particles of valid data. No min() clamp needed:
 	// the consumer (ProxyRenderer) checks CurrentParticleCount before rendering.
-	const int32 ParticleCount = StatsReadbackParticleCounts[ReadIdx];
-	if (ParticleCount <= 0)
+	const FStatsReadbackPayload& Payload = StatsReadbackRing.GetPayload(ReadIdx);
+	const int32 ParticleCount = Payload.ParticleCount;
+	const FKawaiiFluidReadbackLayout& Layout = Payload.Layout;
+	if (ParticleCount <= 0 || Layout.IsEmpty())
 	{
+		StatsReadbackRing.Discard(ReadIdx);
 		return;
 	}
 
-	// Check if this readback is compact mode (32 bytes) or full mode (64 bytes)
-	const bool bIsCompactMode = bStatsReadbackCompactMode[ReadIdx];
-
-	// Lock buffer with appropriate size
-	const int32 ElementSize = bIsCompactMode ? sizeof(FCompactParticleStats) : sizeof(FGPUFluidParticle);
-	const int32 BufferSize = ParticleCount * ElementSize;
-	const void* RawData = StatsReadbacks[ReadIdx]->Lock(BufferSize);
+	// Lock buffer with the stride of the layout it was packed with
+	FRHIGPUBufferReadback& Readback = StatsReadbackRing.GetReadback(ReadIdx);
+	const int32 BufferSize = ParticleCount * Layout.GetStrideBytes();
+	const uint32* RawData = static_cast<const uint32*>(Readback.Lock(BufferSize));
 
 	if (RawData && ParticleCount > 0)
 	{
-		// Parallel cache build: local map per chunk → merge
-		// Also extract shadow data (Position, Velocity, NeighborCount) in the same pass
-		const int32 NumChunks = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 1, ParticleCount);
-		const int32 ChunkSize = (ParticleCount + NumChunks - 1) / NumChunks;
-
-		// Use fixed-size arrays instead of TMap (SourceID is 0~63 range)
-		constexpr int32 MaxSources = EGPUParticleSource::MaxSourceCount;  // 64
-		TArray<TArray<TArray<int32>>> ChunkSourceArrays;  // [NumChunks][MaxSources][]
-		TArray<TArray<int32>> ChunkAllIDs;
-		ChunkSourceArrays.SetNum(NumChunks);
-		ChunkAllIDs.SetNum(NumChunks);
-		for (int32 c = 0; c < NumChunks; ++c)
+		// Build into the retired snapshot when nobody holds it, so steady-state readbacks reuse its buffers
+		TSharedRef<FKawaiiFluidParticleSnapshot> Snapshot = AcquireRecycledParticleSnapshot();
+		FKawaiiFluidReadbackColumns& Columns = StatsReadbackColumns;
+		Columns.Positions = MoveTemp(Snapshot->Positions);
+		Columns.Velocities = MoveTemp(Snapshot->Velocities);
+		Columns.Flags = MoveTemp(Snapshot->Flags);
+		Columns.NeighborCounts = MoveTemp(Snapshot->NeighborCounts);
+		Columns.ParticleIDs = MoveTemp(Snapshot->ParticleIDs);
+		Columns.SourceIDs = MoveTemp(Snapshot->SourceIDs);
+
+		// Table-driven unpack of exactly the fields that were packed
 		{
-			ChunkSourceArrays[c].SetNum(MaxSources);
+			SCOPED_DRAW_EVENT(RHICmdList, Unpack);
+			FKawaiiFluidReadbackUnpacker::Unpack(Layout, RawData, ParticleCount, Columns);
 		}
 
-		// Pre-allocate data arrays (will be filled in parallel)
-		// Position/SourceID are ALWAYS copied (needed for lightweight despawn API)
-		// Velocity only when ISM rendering enabled AND not in compact mode
-		// NeighborCount only when shadow readback enabled
-		// Density/VelocityMagnitude/Mass/Flags only when detailed GPU stats enabled (requires full mode)
-		const bool bNeedShadowData = bShadowReadbackEnabled.load();
-		const bool bNeedVelocity = (bFullReadbackEnabled.load() || bNeedShadowData) && !bIsCompactMode;  // Velocity not available in compact mode
-		const bool bNeedDetailedStats = GetFluidStatsCollector().IsDetailedGPUEnabled() && !bIsCompactMode;  // Detailed stats require full mode
-		TArray<FVector3f> NewPositions;
-		TArray<int32> NewSourceIDs;
-		TArray<FVector3f> NewVelocities;
-		TArray<uint32> NewNeighborCounts;
-		TArray<float> NewDensities;
-		TArray<float> NewVelocityMagnitudes;
-		TArray<float> NewMasses;
-		TArray<uint32> NewFlags;
-		NewPositions.SetNumUninitialized(ParticleCount);   // Always needed for despawn
-		NewSourceIDs.SetNumUninitialized(ParticleCount);   // Always needed for despawn
-		NewFlags.SetNumUninitialized(ParticleCount);       // Always needed for debug visualization
-		if (bNeedVelocity)
+		// Per-source ID index needs IDs and SourceIDs: parallel counting sort into the snapshot's flat index
+		if (Layout.HasField(EKawaiiFluidReadbackField::ParticleID) && Layout.HasField(EKawaiiFluidReadbackField::SourceID))
 		{
-			NewVelocities.SetNumUninitialized(ParticleCount);  // ISM rendering
+			SCOPED_DRAW_EVENT(RHICmdList, SourceIndex);
+			Snapshot->SourceIndex.Build(Columns.SourceIDs, Columns.ParticleIDs);
 		}
-		if (bNeedShadowData)
+		else
 		{
-			NewNeighborCounts.SetNumUninitialized(ParticleCount);  // Available in both compact and full mode
+			Snapshot->SourceIndex.Reset();
 		}
+
+		// Detailed GPU stats need the whole DetailedStatsSet
+		const bool bNeedDetailedStats = GetFluidStatsCollector().IsDetailedGPUEnabled()
+			&& (Layout.FieldMask & EKawaiiFluidReadbackField::DetailedStatsSet) == EKawaiiFluidReadbackField::DetailedStatsSet;
 		if (bNeedDetailedStats)
 		{
-			NewDensities.SetNumUninitialized(ParticleCount);
-			NewVelocityMagnitudes.SetNumUninitialized(ParticleCount);
-			NewMasses.SetNumUninitialized(ParticleCount);
-			NewNeighborCounts.SetNumUninitialized(ParticleCount);
-		}
+			const float StatsRestDensity = GetFluidStatsCollector().GetStats().RestDensity;
+			const float InvStatsRestDensity = StatsRestDensity > 0.001f ? 1.0f / StatsRestDensity : 0.0f;
 
-		if (bIsCompactMode)
-		{
-			// Compact mode: 32-byte FCompactParticleStats (Position, ParticleID, SourceID, NeighborCount)
-			const FCompactParticleStats* CompactData = static_cast<const FCompactParticleStats*>(RawData);
+			// One accumulator per chunk, merged after the pass
+			const int32 NumChunks = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 1, ParticleCount);
+			const int32 ChunkSize = (ParticleCount + NumChunks - 1) / NumChunks;
+			TArray<FKawaiiFluidStatsAccumulator> ChunkStats;
+			ChunkStats.SetNum(NumChunks);
 
 			ParallelFor(NumChunks, [&](int32 ChunkIndex)
 			{
 				const int32 StartIdx = ChunkIndex * ChunkSize;
 				const int32 EndIdx = FMath::Min(StartIdx + ChunkSize, ParticleCount);
-				if (StartIdx >= EndIdx)
-				{
-					return;
-				}
-
-				auto& LocalSourceArrays = ChunkSourceArrays[ChunkIndex];
-				auto& LocalAllIDs = ChunkAllIDs[ChunkIndex];
-				LocalAllIDs.Reserve(EndIdx - StartIdx);
 
+				FKawaiiFluidStatsAccumulator& LocalStats = ChunkStats[ChunkIndex];
 				for (int32 i = StartIdx; i < EndIdx; ++i)
 				{
-					const FCompactParticleStats& P = CompactData[i];
-					LocalAllIDs.Add(P.ParticleID);
-
-					if (P.SourceID >= 0 && P.SourceID < MaxSources)
-					{
-						LocalSourceArrays[P.SourceID].Add(P.ParticleID);
-					}
-
-					NewPositions[i] = P.Position;
-					NewSourceIDs[i] = P.SourceID;
-					NewFlags[i] = P.Flags;
-
-					// NeighborCount available in compact mode
-					if (bNeedShadowData)
-					{
-						NewNeighborCounts[i] = P.NeighborCount;
-					}
-
-					// Velocity and detailed stats NOT available in compact mode
+					LocalStats.AddParticle(Columns.Velocities[i].Length(), Columns.Densities[i], Columns.Masses[i], static_cast<int32>(Columns.NeighborCounts[i]), InvStatsRestDensity);
+					LocalStats.AttachedCount += (Columns.Flags[i] & EGPUParticleFlags::IsAttached) ? 1 : 0;
 				}
 			}, EParallelForFlags::Unbalanced);
-		}
-		else
-		{
-			// Full mode: 64-byte FGPUFluidParticle (all fields)
-			const FGPUFluidParticle* ParticleData = static_cast<const FGPUFluidParticle*>(RawData);
 
-			ParallelFor(NumChunks, [&](int32 ChunkIndex)
+			FKawaiiFluidStatsAccumulator ReadbackStats;
+			for (const FKawaiiFluidStatsAccumulator& LocalStats : ChunkStats)
 			{
-				const int32 StartIdx = ChunkIndex * ChunkSize;
-				const int32 EndIdx = FMath::Min(StartIdx + ChunkSize, ParticleCount);
-				if (StartIdx >= EndIdx)
-				{
-					return;
-				}
-
-				auto& LocalSourceArrays = ChunkSourceArrays[ChunkIndex];
-				auto& LocalAllIDs = ChunkAllIDs[ChunkIndex];
-				LocalAllIDs.Reserve(EndIdx - StartIdx);
-
-				for (int32 i = StartIdx; i < EndIdx; ++i)
-				{
-					const FGPUFluidParticle& P = ParticleData[i];
-					LocalAllIDs.Add(P.ParticleID);
-
-					if (P.SourceID >= 0 && P.SourceID < MaxSources)
-					{
-						LocalSourceArrays[P.SourceID].Add(P.ParticleID);
-					}
-
-					NewPositions[i] = P.Position;
-					NewSourceIDs[i] = P.SourceID;
-					NewFlags[i] = P.Flags;
-
-					if (bNeedVelocity)
-					{
-						NewVelocities[i] = P.Velocity;
-					}
-
-					if (bNeedShadowData)
-					{
-						NewNeighborCounts[i] = P.NeighborCount;
-					}
-
-					if (bNeedDetailedStats)
-					{
-						NewDensities[i] = P.Density;
-						NewVelocityMagnitudes[i] = P.Velocity.Length();
-						NewMasses[i] = P.Mass;
-						NewNeighborCounts[i] = P.NeighborCount;
-					}
-				}
-			}, EParallelForFlags::Unbalanced);
-		}
-
-		// Merge (single thread) - array-based, no hash operations, MoveTemp for zero-copy
-		TArray<TArray<int32>> NewSourceIDArrays;
-		TArray<int32> NewAllParticleIDs;
-		{
-			SCOPED_DRAW_EVENT(RHICmdList, Merge);
-			NewSourceIDArrays.SetNum(MaxSources);
-			NewAllParticleIDs.Reserve(ParticleCount);
-
-			for (int32 c = 0; c < NumChunks; ++c)
-			{
-				NewAllParticleIDs.Append(MoveTemp(ChunkAllIDs[c]));
+				ReadbackStats.Merge(LocalStats);
 			}
 
-			// Merge SourceID arrays - chunk-first loop order for cache efficiency
-			for (int32 c = 0; c < NumChunks; ++c)
-			{
-				for (int32 SourceID = 0; SourceID < MaxSources; ++SourceID)
-				{
-					if (ChunkSourceArrays[c][SourceID].Num() > 0)
-					{
-						if (NewSourceIDArrays[SourceID].Num() == 0)
-						{
-							NewSourceIDArrays[SourceID] = MoveTemp(ChunkSourceArrays[c][SourceID]);
-						}
-						else
-						{
-							NewSourceIDArrays[SourceID].Append(MoveTemp(ChunkSourceArrays[c][SourceID]));
-						}
-					}
-				}
-			}
-		}
-
-		// Calculate all stats from GPU readback data (only when detailed stats enabled)
-		// IMPORTANT: Must be done BEFORE MoveTemp to avoid accessing moved arrays
-		if (bNeedDetailedStats && ParticleCount > 0)
-		{
-			// Count attached particles
-			int32 AttachedCount = 0;
-			for (int32 i = 0; i < ParticleCount; ++i)
-			{
-				if (NewFlags[i] & EGPUParticleFlags::IsAttached)
-				{
-					++AttachedCount;
-				}
-			}
-
-			// Calculate velocity stats
-			float MinVel = TNumericLimits<float>::Max();
-			float MaxVel = TNumericLimits<float>::Lowest();
-			double VelSum = 0.0;
-			for (int32 i = 0; i < ParticleCount; ++i)
-			{
-				const float Vel = NewVelocityMagnitudes[i];
-				VelSum += Vel;
-				MinVel = FMath::Min(MinVel, Vel);
-				MaxVel = FMath::Max(MaxVel, Vel);
-			}
-
-			// Calculate density stats
-			float MinDen = TNumericLimits<float>::Max();
-			float MaxDen = TNumericLimits<float>::Lowest();
-			double DenSum = 0.0;
-			for (int32 i = 0; i < ParticleCount; ++i)
-			{
-				const float Den = NewDensities[i];
-				DenSum += Den;
-				MinDen = FMath::Min(MinDen, Den);
-				MaxDen = FMath::Max(MaxDen, Den);
-			}
-
-			// Calculate neighbor stats
-			int32 MinNeighbor = TNumericLimits<int32>::Max();
-			int32 MaxNeighbor = TNumericLimits<int32>::Lowest();
-			double NeighborSum = 0.0;
-			for (int32 i = 0; i < ParticleCount; ++i)
-			{
-				const int32 Neighbor = static_cast<int32>(NewNeighborCounts[i]);
-				NeighborSum += Neighbor;
-				MinNeighbor = FMath::Min(MinNeighbor, Neighbor);
-				MaxNeighbor = FMath::Max(MaxNeighbor, Neighbor);
-			}
-
-			// Update stats collector - basic stats
-			auto& Collector = GetFluidStatsCollector();
-			auto& Stats = const_cast<FKawaiiFluidSimulationStats&>(Collector.GetStats());
-
-			Stats.ParticleCount = ParticleCount;
-			Stats.ActiveParticleCount = ParticleCount - AttachedCount;
-			Stats.AttachedParticleCount = AttachedCount;
-
-			Stats.AvgVelocity = static_cast<float>(VelSum / ParticleCount);
-			Stats.MinVelocity = MinVel;
-			Stats.MaxVelocity = MaxVel;
-
-			Stats.AvgDensity = static_cast<float>(DenSum / ParticleCount);
-			Stats.MinDensity = MinDen;
-			Stats.MaxDensity = MaxDen;
-
-			// Density error calculation
-			const float RestDensity = Stats.RestDensity;
-			if (RestDensity > 0.001f)
-			{
-				Stats.DensityError = FMath::Abs(Stats.AvgDensity - RestDensity) / RestDensity * 100.0f;
-			}
-
-			Stats.AvgNeighborCount = static_cast<float>(NeighborSum / ParticleCount);
-			Stats.MinNeighborCount = MinNeighbor;
-			Stats.MaxNeighborCount = MaxNeighbor;
-
-			Stats.bIsGPUSimulation = true;
-
-			// Calculate stability metrics
-			Collector.CalculateStabilityMetrics(
-				NewDensities.GetData(),
-				NewVelocityMagnitudes.GetData(),
-				NewMasses.GetData(),
-				ParticleCount,
-				RestDensity);
+			FKawaiiFluidSimulationStatsCollector& Collector = GetFluidStatsCollector();
+			Collector.SetGPUSimulation(true);
+			Collector.SetParticleCounts(ParticleCount, ParticleCount - ReadbackStats.AttachedCount, ReadbackStats.AttachedCount);
+			Collector.ApplyParticleAccumulator(ReadbackStats, StatsRestDensity);
 		}
 
-		// Hold lock briefly and swap
+		// Publish as one immutable snapshot (the lock only covers the pointer swap)
+		// Columns of fields no consumer registered stay empty
 		{
-			SCOPED_DRAW_EVENT(RHICmdList, Lock);
-			FScopeLock Lock(&BufferLock);
-			CachedSourceIDToParticleIDs = MoveTemp(NewSourceIDArrays);
-			CachedAllParticleIDs = MoveTemp(NewAllParticleIDs);
-			CachedParticlePositions = MoveTemp(NewPositions);    // Always available for despawn API
-			CachedParticleSourceIDs = MoveTemp(NewSourceIDs);    // Always available for despawn API
-			CachedParticleFlags = MoveTemp(NewFlags);            // Always available for debug visualization
-
-			// Velocity for ISM rendering (lightweight API)
-			if (bNeedVelocity)
-			{
-				CachedParticleVelocities = MoveTemp(NewVelocities);
-			}
-
+			SCOPED_DRAW_EVENT(RHICmdList, Publish);
+			Snapshot->Frame = StatsReadbackRing.GetFrame(ReadIdx);
+			Snapshot->NumParticles = ParticleCount;
+			Snapshot->Positions = MoveTemp(Columns.Positions);
+			Snapshot->Velocities = MoveTemp(Columns.Velocities);
+			Snapshot->Flags = MoveTemp(Columns.Flags);
+			Snapshot->NeighborCounts = MoveTemp(Columns.NeighborCounts);
+			Snapshot->ParticleIDs = MoveTemp(Columns.ParticleIDs);
+			Snapshot->SourceIDs = MoveTemp(Columns.SourceIDs);
+
+			PublishParticleSnapshot(Snapshot);
 			bHasValidGPUResults.store(true);
-
-			// NeighborCount only when shadow readback enabled
-			if (bNeedShadowData)
-			{
-				ReadyShadowPositions = CachedParticlePositions;  // Share with despawn data
-				ReadyShadowVelocities = CachedParticleVelocities;  // Share with ISM data
-				ReadyShadowNeighborCounts = MoveTemp(NewNeighborCounts);
-				ReadyShadowPositionsFrame.store(StatsReadbackFrameNumbers[ReadIdx]);
-			}
 		}
 
 		// GPU-driven despawn: no CPU-side cleanup needed
 		// (CleanupCompletedRequests removed - despawn decisions are purely GPU-side)
 	}
 
-	StatsReadbacks[ReadIdx]->Unlock();
+	Readback.Unlock();
 
 	// Mark buffer as available for next write cycle
-	StatsReadbackFrameNumbers[ReadIdx] = 0;
+	StatsReadbackRing.Consume(ReadIdx, GFrameCounterRenderThread);
 }
 
 /**
- * @brief Get shadow data with anisotropy for ellipsoid ISM shadows.
- * @param OutPositions Output array of particle positions.
- * @param OutVelocities Output array of particle velocities.
- * @param OutAnisotropyAxis1 Output array of first ellipsoid axis (xyz=dir, w=scale).
- * @param OutAnisotropyAxis2 Output array of second ellipsoid axis.
- * @param OutAnisotropyAxis3 Output array of third ellipsoid axis.
- * @return true if valid data was retrieved.
+ * @brief Stamp a fully built particle snapshot with the next version and make it the latest.
+ * @param Snapshot Snapshot that nobody writes after this call.
  */
-bool FKawaiiFluidSimulator::GetShadowDataWithAnisotropy(
-	TArray<FVector>& OutPositions,
-	TArray<FVector>& OutVelocities,
-	TArray<FVector4>& OutAnisotropyAxis1,
-	TArray<FVector4>& OutAnisotropyAxis2,
-	TArray<FVector4>& OutAnisotropyAxis3) const
+void FKawaiiFluidSimulator::PublishParticleSnapshot(const TSharedRef<FKawaiiFluidParticleSnapshot>& Snapshot)
 {
-	// First get positions and velocities
-	if (!GetShadowPositionsAndVelocities(OutPositions, OutVelocities))
+	// The replaced snapshot becomes the recycle candidate; the previous candidate is released after
+	// the lock, in case this was its last reference
+	TSharedPtr<FKawaiiFluidParticleSnapshot> Released;
 	{
-		OutAnisotropyAxis1.Empty();
-		OutAnisotropyAxis2.Empty();
-		OutAnisotropyAxis3.Empty();
-		return false;
+		FScopeLock Lock(&SnapshotLock);
+		Snapshot->Version = ++ParticleCacheVersion;
+		Released = MoveTemp(RetiredParticleSnapshot);
+		RetiredParticleSnapshot = MoveTemp(ParticleSnapshot);
+		ParticleSnapshot = Snapshot;
 	}
+}
 
-	FScopeLock Lock(&const_cast<FCriticalSection&>(BufferLock));
-
-	const int32 Count = ReadyShadowPositions.Num();
-
-	// Check if anisotropy data is available and matches position count
-	if (ReadyShadowAnisotropyAxis1.Num() != Count ||
-		ReadyShadowAnisotropyAxis2.Num() != Count ||
-		ReadyShadowAnisotropyAxis3.Num() != Count)
+/**
+ * @brief Snapshot to build the next readback into, reusing the retired one's buffers when no consumer holds it.
+ *
+ * IsUnique() ignores weak references, so the in-place reuse relies on consumers holding snapshots only
+ * through strong references. GetParticleSnapshot enforces this: consumers never receive a reference to the
+ * internal snapshot, only handles that keep it strongly referenced while they live.
+ *
+ * @return Snapshot exclusively owned by the caller until it is published.
+ */
+TSharedRef<FKawaiiFluidParticleSnapshot> FKawaiiFluidSimulator::AcquireRecycledParticleSnapshot()
+{
+	TSharedPtr<FKawaiiFluidParticleSnapshot> Candidate;
 	{
-		// DEBUG: Log count mismatch - disabled for performance
-		// static int32 MismatchLogCounter = 0;
-		// if (++MismatchLogCounter % 10 == 1)
-		// {
-		// 	KF_LOG(Warning, // 		TEXT("ANISO_MISMATCH: Position=%d, Aniso1=%d, Aniso2=%d, Aniso3=%d → Using default W=1.0"),
-		// 		Count, ReadyShadowAnisotropyAxis1.Num(), ReadyShadowAnisotropyAxis2.Num(), ReadyShadowAnisotropyAxis3.Num());
-		// }
-
-		// Anisotropy not available - return default (uniform sphere)
-		OutAnisotropyAxis1.SetNumUninitialized(Count);
-		OutAnisotropyAxis2.SetNumUninitialized(Count);
-		OutAnisotropyAxis3.SetNumUninitialized(Count);
-
-		for (int32 i = 0; i < Count; ++i)
-		{
-			OutAnisotropyAxis1[i] = FVector4(1.0, 0.0, 0.0, 1.0);
-			OutAnisotropyAxis2[i] = FVector4(0.0, 1.0, 0.0, 1.0);
-			OutAnisotropyAxis3[i] = FVector4(0.0, 0.0, 1.0, 1.0);
-		}
-		return true;
+		FScopeLock Lock(&SnapshotLock);
+		Candidate = MoveTemp(RetiredParticleSnapshot);
 	}
 
-	// Copy anisotropy data
-	OutAnisotropyAxis1.SetNumUninitialized(Count);
-	OutAnisotropyAxis2.SetNumUninitialized(Count);
-	OutAnisotropyAxis3.SetNumUninitialized(Count);
-
-	for (int32 i = 0; i < Count; ++i)
+	// A consumer still holding the retired snapshot keeps it alive and unchanged; build a fresh one instead
+	if (!Candidate.IsValid() || !Candidate.IsUnique())
 	{
-		OutAnisotropyAxis1[i] = FVector4(ReadyShadowAnisotropyAxis1[i]);
-		OutAnisotropyAxis2[i] = FVector4(ReadyShadowAnisotropyAxis2[i]);
-		OutAnisotropyAxis3[i] = FVector4(ReadyShadowAnisotropyAxis3[i]);
+		return MakeShared<FKawaiiFluidParticleSnapshot>();
 	}
 
-	return true;
+	Candidate->Version = 0;
+	Candidate->Frame = 0;
+	Candidate->NumParticles = 0;
+	return Candidate.ToSharedRef();
 }
 
-//=============================================================================
-// Debug Z-Order Index Readback Implementation (Async GPU→CPU)
-//=============================================================================
+/**
+ * @brief Make a fully built anisotropy snapshot the latest.
+ * @param Snapshot Snapshot that nobody writes after this call.
+ */
+void FKawaiiFluidSimulator::PublishAnisotropySnapshot(const TSharedRef<FKawaiiFluidAnisotropySnapshot>& Snapshot)
+{
+	TSharedPtr<const FKawaiiFluidAnisotropySnapshot> Replaced;
+	{
+		FScopeLock Lock(&SnapshotLock);
+		Replaced = MoveTemp(AnisotropySnapshot);
+		AnisotropySnapshot = Snapshot;
+	}
+}
 
-void FKawaiiFluidSimulator::AllocateDebugIndexReadbackObjects(FRHICommandListImmediate& RHICmdList)
+/**
+ * @brief Drop the published particle and anisotropy snapshots.
+ */
+void FKawaiiFluidSimulator::ResetSnapshots()
 {
-	for (int32 i = 0; i < NUM_DEBUG_INDEX_READBACK_BUFFERS; ++i)
+	TSharedPtr<FKawaiiFluidParticleSnapshot> ReleasedParticles;
+	TSharedPtr<FKawaiiFluidParticleSnapshot> ReleasedRetired;
+	TSharedPtr<const FKawaiiFluidAnisotropySnapshot> ReleasedAnisotropy;
 	{
-		if (DebugIndexReadbacks[i] == nullptr)
-		{
-			DebugIndexReadbacks[i] = new FRHIGPUBufferReadback(*FString::Printf(TEXT("DebugIndexReadback_%d"), i));
-		}
-		DebugIndexReadbackFrameNumbers[i] = 0;
-		DebugIndexReadbackParticleCounts[i] = 0;
+		FScopeLock Lock(&SnapshotLock);
+		ReleasedParticles = MoveTemp(ParticleSnapshot);
+		ReleasedRetired = MoveTemp(RetiredParticleSnapshot);
+		ReleasedAnisotropy = MoveTemp(AnisotropySnapshot);
 	}
+}
+
+/**
+ * @brief Copy every ring's telemetry for the game thread and apply the adaptive depth CVar.
+ */
+void FKawaiiFluidSimulator::PublishReadbackRingStats()
+{
+	const bool bAdaptive = GFluidAdaptiveReadbackDepth != 0;
+	CountReadbackRing.SetAdaptive(bAdaptive);
+	StatsReadbackRing.SetAdaptive(bAdaptive);
+	AnisotropyReadbackRing.SetAdaptive(bAdaptive);
+	DebugIndexReadbackRing.SetAdaptive(bAdaptive);
+	ParticleBoundsReadbackRing.SetAdaptive(bAdaptive);
+
+	FScopeLock Lock(&ReadbackRingStatsLock);
+	PublishedReadbackRingStats[static_cast<int32>(EKawaiiFluidReadbackRing::ParticleCount)] = CountReadbackRing.GetStats();
+	PublishedReadbackRingStats[static_cast<int32>(EKawaiiFluidReadbackRing::Stats)] = StatsReadbackRing.GetStats();
+	PublishedReadbackRingStats[static_cast<int32>(EKawaiiFluidReadbackRing::Anisotropy)] = AnisotropyReadbackRing.GetStats();
+	PublishedReadbackRingStats[static_cast<int32>(EKawaiiFluidReadbackRing::DebugIndex)] = DebugIndexReadbackRing.GetStats();
+	PublishedReadbackRingStats[static_cast<int32>(EKawaiiFluidReadbackRing::ParticleBounds)] = ParticleBoundsReadbackRing.GetStats();
+}
 
-	KF_LOG_DEV(Log, TEXT("Debug Z-Order index readback objects allocated (NumBuffers=%d)"), NUM_DEBUG_INDEX_READBACK_BUFFERS);
+/**
+ * @brief Telemetry of one readback ring as of the last BeginFrame.
+ * @param Ring Readback ring.
+ * @return Copy of the ring's telemetry.
+ */
+FKawaiiFluidReadbackRingStats FKawaiiFluidSimulator::GetReadbackRingStats(EKawaiiFluidReadbackRing Ring) const
+{
+	FScopeLock Lock(&ReadbackRingStatsLock);
+	return PublishedReadbackRingStats[static_cast<int32>(Ring)];
 }
 
+//=============================================================================
+// Debug Z-Order Index Readback Implementation (Async GPU→CPU)
+//=============================================================================
+
 void FKawaiiFluidSimulator::ReleaseDebugIndexReadbackObjects()
 {
-	for (int32 i = 0; i < NUM_DEBUG_INDEX_READBACK_BUFFERS; ++i)
-	{
-		if (DebugIndexReadbacks[i] != nullptr)
-		{
-			delete DebugIndexReadbacks[i];
-			DebugIndexReadbacks[i] = nullptr;
-		}
-		DebugIndexReadbackFrameNumbers[i] = 0;
-		DebugIndexReadbackParticleCounts[i] = 0;
-	}
-	DebugIndexReadbackWriteIndex = 0;
+	DebugIndexReadbackRing.Reset();
 }
 
 void FKawaiiFluidSimulator::EnqueueDebugIndexReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount)
@@ -4444,64 +3991,37 @@ void FKawaiiFluidSimulator::EnqueueDebugIndexReadback(FRHICommandListImmediate&
 		return;
 	}
 
-	// Allocate readback objects if needed
-	if (DebugIndexReadbacks[0] == nullptr)
-	{
-		AllocateDebugIndexReadbackObjects(RHICmdList);
-	}
-
-	// Get current write index and advance for next frame
-	const int32 WriteIdx = DebugIndexReadbackWriteIndex;
-	DebugIndexReadbackWriteIndex = (DebugIndexReadbackWriteIndex + 1) % NUM_DEBUG_INDEX_READBACK_BUFFERS;
+	// Claim a ring slot
+	const int32 WriteIdx = DebugIndexReadbackRing.BeginWrite(GFrameCounterRenderThread);
+	DebugIndexReadbackRing.GetPayload(WriteIdx) = ParticleCount;
 
 	// Enqueue async copy (int32 per particle = 4 bytes)
 	const uint32 CopySize = ParticleCount * ElementSize;
 	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
-	DebugIndexReadbacks[WriteIdx]->EnqueueCopy(RHICmdList, SourceBuffer, CopySize);
+	DebugIndexReadbackRing.GetReadback(WriteIdx).EnqueueCopy(RHICmdList, SourceBuffer, CopySize);
 	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
-	DebugIndexReadbackFrameNumbers[WriteIdx] = GFrameCounterRenderThread;
-	DebugIndexReadbackParticleCounts[WriteIdx] = ParticleCount;
 }
 
 void FKawaiiFluidSimulator::ProcessDebugIndexReadback()
 {
-	if (DebugIndexReadbacks[0] == nullptr)
-	{
-		return;
-	}
-
-	// Search for oldest ready buffer
-	int32 ReadIdx = -1;
-	uint64 OldestFrame = UINT64_MAX;
-
-	for (int32 i = 0; i < NUM_DEBUG_INDEX_READBACK_BUFFERS; ++i)
-	{
-		if (DebugIndexReadbacks[i] != nullptr &&
-			DebugIndexReadbackFrameNumbers[i] > 0 &&
-			DebugIndexReadbacks[i]->IsReady())
-		{
-			if (DebugIndexReadbackFrameNumbers[i] < OldestFrame)
-			{
-				OldestFrame = DebugIndexReadbackFrameNumbers[i];
-				ReadIdx = i;
-			}
-		}
-	}
-
+	// Oldest ready slot first
+	const int32 ReadIdx = DebugIndexReadbackRing.FindReadySlot();
 	if (ReadIdx < 0)
 	{
 		return;  // No ready buffers
 	}
 
-	const int32 ParticleCount = DebugIndexReadbackParticleCounts[ReadIdx];
+	const int32 ParticleCount = DebugIndexReadbackRing.GetPayload(ReadIdx);
 	if (ParticleCount <= 0)
 	{
+		DebugIndexReadbackRing.Discard(ReadIdx);
 		return;
 	}
 
 	// Lock buffer (int32 per particle)
+	FRHIGPUBufferReadback& Readback = DebugIndexReadbackRing.GetReadback(ReadIdx);
 	const int32 BufferSize = ParticleCount * sizeof(int32);
-	const int32* IndexData = (const int32*)DebugIndexReadbacks[ReadIdx]->Lock(BufferSize);
+	const int32* IndexData = (const int32*)Readback.Lock(BufferSize);
 
 	if (IndexData == nullptr)
 	{
@@ -4514,13 +4034,13 @@ void FKawaiiFluidSimulator::ProcessDebugIndexReadback()
 	FMemory::Memcpy(CachedZOrderArrayIndices.GetData(), IndexData, BufferSize);
 
 	// Unlock buffer
-	DebugIndexReadbacks[ReadIdx]->Unlock();
+	Readback.Unlock();
 
 	// Update frame counter
-	ReadyZOrderIndicesFrame.store(DebugIndexReadbackFrameNumbers[ReadIdx]);
+	ReadyZOrderIndicesFrame.store(DebugIndexReadbackRing.GetFrame(ReadIdx));
 
 	// Mark buffer as available for next write cycle
-	DebugIndexReadbackFrameNumbers[ReadIdx] = 0;
+	DebugIndexReadbackRing.Consume(ReadIdx, GFrameCounterRenderThread);
 }
 
 void FKawaiiFluidSimulator::AddRecordZOrderIndicesPass(FRDGBuilder& GraphBuilder, FRDGBufferRef ParticleBuffer, int32 ParticleCount)
@@ -4593,32 +4113,9 @@ bool FKawaiiFluidSimulator::GetZOrderArrayIndices(TArray<int32>& OutIndices) con
 // Used to expand world collision query bounds in Unlimited Simulation Range mode
 //=============================================================================
 
-void FKawaiiFluidSimulator::AllocateParticleBoundsReadbackObjects(FRHICommandListImmediate& RHICmdList)
-{
-	for (int32 i = 0; i < NUM_PARTICLE_BOUNDS_READBACK_BUFFERS; ++i)
-	{
-		if (ParticleBoundsReadbacks[i] == nullptr)
-		{
-			ParticleBoundsReadbacks[i] = new FRHIGPUBufferReadback(*FString::Printf(TEXT("ParticleBoundsReadback_%d"), i));
-		}
-		ParticleBoundsReadbackFrameNumbers[i] = 0;
-	}
-
-	KF_LOG_DEV(Log, TEXT("Particle bounds readback objects allocated (NumBuffers=%d)"), NUM_PARTICLE_BOUNDS_READBACK_BUFFERS);
-}
-
 void FKawaiiFluidSimulator::ReleaseParticleBoundsReadbackObjects()
 {
-	for (int32 i = 0; i < NUM_PARTICLE_BOUNDS_READBACK_BUFFERS; ++i)
-	{
-		if (ParticleBoundsReadbacks[i] != nullptr)
-		{
-			delete ParticleBoundsReadbacks[i];
-			ParticleBoundsReadbacks[i] = nullptr;
-		}
-		ParticleBoundsReadbackFrameNumbers[i] = 0;
-	}
-	ParticleBoundsReadbackWriteIndex = 0;
+	ParticleBoundsReadbackRing.Reset();
 	CachedParticleBounds = FBox(EForceInit::ForceInit);
 	ReadyParticleBoundsFrame.store(0);
 }
@@ -4640,56 +4137,29 @@ void FKawaiiFluidSimulator::EnqueueParticleBoundsReadback(FRHICommandListImmedia
 		return;
 	}
 
-	// Allocate readback objects if needed
-	if (ParticleBoundsReadbacks[0] == nullptr)
-	{
-		AllocateParticleBoundsReadbackObjects(RHICmdList);
-	}
-
-	// Get current write index and advance for next frame
-	const int32 WriteIdx = ParticleBoundsReadbackWriteIndex;
-	ParticleBoundsReadbackWriteIndex = (ParticleBoundsReadbackWriteIndex + 1) % NUM_PARTICLE_BOUNDS_READBACK_BUFFERS;
+	// Claim a ring slot
+	const int32 WriteIdx = ParticleBoundsReadbackRing.BeginWrite(GFrameCounterRenderThread);
 
 	// Enqueue async copy (2 × FVector3f = 24 bytes)
 	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
-	ParticleBoundsReadbacks[WriteIdx]->EnqueueCopy(RHICmdList, SourceBuffer, BoundsBufferSize);
+	ParticleBoundsReadbackRing.GetReadback(WriteIdx).EnqueueCopy(RHICmdList, SourceBuffer, BoundsBufferSize);
 	RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::CopySrc, ERHIAccess::UAVCompute));
-	ParticleBoundsReadbackFrameNumbers[WriteIdx] = GFrameCounterRenderThread;
 }
 
 void FKawaiiFluidSimulator::ProcessParticleBoundsReadback()
 {
-	if (ParticleBoundsReadbacks[0] == nullptr)
-	{
-		return;
-	}
-
-	// Search for oldest ready buffer
-	int32 ReadIdx = -1;
-	uint64 OldestFrame = UINT64_MAX;
-
-	for (int32 i = 0; i < NUM_PARTICLE_BOUNDS_READBACK_BUFFERS; ++i)
-	{
-		if (ParticleBoundsReadbacks[i] != nullptr &&
-			ParticleBoundsReadbackFrameNumbers[i] > 0 &&
-			ParticleBoundsReadbacks[i]->IsReady())
-		{
-			if (ParticleBoundsReadbackFrameNumbers[i] < OldestFrame)
-			{
-				OldestFrame = ParticleBoundsReadbackFrameNumbers[i];
-				ReadIdx = i;
-			}
-		}
-	}
-
+	// Oldest ready slot first
+	const int32 ReadIdx = ParticleBoundsReadbackRing.FindReadySlot();
 	if (ReadIdx < 0)
 	{
 		return;  // No ready buffers
 	}
+	const uint64 ReadbackFrame = ParticleBoundsReadbackRing.GetFrame(ReadIdx);
+	FRHIGPUBufferReadback& Readback = ParticleBoundsReadbackRing.GetReadback(ReadIdx);
 
 	// Lock buffer (2 × FVector3f = 24 bytes)
 	const int32 BufferSize = 2 * sizeof(FVector3f);
-	const FVector3f* BoundsData = (const FVector3f*)ParticleBoundsReadbacks[ReadIdx]->Lock(BufferSize);
+	const FVector3f* BoundsData = (const FVector3f*)Readback.Lock(BufferSize);
 
 	if (BoundsData == nullptr)
 	{
@@ -4701,7 +4171,7 @@ void FKawaiiFluidSimulator::ProcessParticleBoundsReadback()
 	const FVector3f BoundsMin = BoundsData[0];
 	const FVector3f BoundsMax = BoundsData[1];
 
-	ParticleBoundsReadbacks[ReadIdx]->Unlock();
+	Readback.Unlock();
 
 	// Validate bounds (check for infinity or NaN from empty particle set)
 	if (FMath::IsFinite(BoundsMin.X) && FMath::IsFinite(BoundsMin.Y) && FMath::IsFinite(BoundsMin.Z) &&
@@ -4710,9 +4180,9 @@ void FKawaiiFluidSimulator::ProcessParticleBoundsReadback()
 	{
 		// Update cached bounds
 		CachedParticleBounds = FBox(FVector(BoundsMin), FVector(BoundsMax));
-		ReadyParticleBoundsFrame.store(OldestFrame);
+		ReadyParticleBoundsFrame.store(ReadbackFrame);
 	}
 
-	// Clear processed buffer's frame number to prevent re-processing
-	ParticleBoundsReadbackFrameNumbers[ReadIdx] = 0;
+	// Free the processed slot to prevent re-processing
+	ParticleBoundsReadbackRing.Consume(ReadIdx, GFrameCounterRenderThread);
 }
@@ -2,6 +2,7 @@
 // FGPUSpawnManager - Thread-safe particle spawn queue manager
 
 #include "Simulation/Managers/KawaiiFluidParticleLifecycleManager.h"
+#include "Core/KawaiiFluidSourceSlotTable.h"
 #include "Logging/KawaiiFluidLog.h"
 #include "Simulation/Shaders/KawaiiFluidSimulatorShaders.h"
 #include "Simulation/Utils/GPUIndirectDispatchUtils.h"
@@ -12,6 +13,31 @@
 DECLARE_LOG_CATEGORY_EXTERN(LogGPUSpawnManager, Log, All);
 DEFINE_LOG_CATEGORY(LogGPUSpawnManager);
 
+namespace
+{
+	// Oldest despawn histogram buckets per source (must match OLDEST_BUCKET_COUNT in KawaiiFluidLifecycleDespawn.usf)
+	constexpr int32 OldestBucketCount = 256;
+
+	/**
+	 * @brief Register a persistent per-source oldest despawn table, reallocating it when it is too small.
+	 * @param GraphBuilder RDG builder.
+	 * @param PersistentBuffer Pooled buffer kept across frames.
+	 * @param NumElements Required uint32 element count.
+	 * @param Name Debug name.
+	 * @return Registered RDG buffer with at least NumElements elements.
+	 */
+	FRDGBufferRef RegisterOldestTableBuffer(FRDGBuilder& GraphBuilder, TRefCountPtr<FRDGPooledBuffer>& PersistentBuffer, int32 NumElements, const TCHAR* Name)
+	{
+		if (!PersistentBuffer.IsValid() || static_cast<int32>(PersistentBuffer->Desc.NumElements) < NumElements)
+		{
+			FRDGBufferRef Buffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumElements), Name);
+			PersistentBuffer = GraphBuilder.ConvertToExternalBuffer(Buffer);
+			return Buffer;
+		}
+		return GraphBuilder.RegisterExternalBuffer(PersistentBuffer, Name);
+	}
+}
+
 //=============================================================================
 // Constructor / Destructor
 //=============================================================================
@@ -46,11 +72,10 @@ void FKawaiiFluidParticleLifecycleManager::Initialize(int32 InMaxParticleCount)
 	MaxParticleCapacity = InMaxParticleCount;
 	bIsInitialized = true;
 
-	// Initialize source counter cache
-	CachedSourceCounts.SetNumZeroed(EGPUParticleSource::MaxSourceCount);
-
-	// Initialize per-source emitter max counts
-	EmitterMaxCountsCPU.SetNumZeroed(EGPUParticleSource::MaxSourceCount);
+	// Source counter cache and emitter max counts grow with the highest SourceID seen
+	CachedSourceCounts.Reset();
+	EmitterMaxCountsCPU.Reset();
+	SourceSlotCount.store(0);
 	ActiveEmitterMaxCount = 0;
 	bEmitterMaxCountsDirty = false;
 
@@ -63,6 +88,9 @@ void FKawaiiFluidParticleLifecycleManager::Initialize(int32 InMaxParticleCount)
 	SourceCounterWriteIndex = 0;
 	SourceCounterReadIndex = 0;
 	SourceCounterPendingCount = 0;
+	FMemory::Memzero(SourceCounterReadbackSlotCounts);
+	FMemory::Memzero(SourceCounterReadbackReservedCounts);
+	RecentReservedSlotCount.store(0);
 
 	KF_LOG_DEV(Log, TEXT("GPUSpawnManager initialized with capacity: %d, MaxSourceCount: %d"),
 		MaxParticleCapacity, EGPUParticleSource::MaxSourceCount);
@@ -104,7 +132,11 @@ void FKawaiiFluidParticleLifecycleManager::Release()
 		SourceCounterWriteIndex = 0;
 		SourceCounterReadIndex = 0;
 		SourceCounterPendingCount = 0;
+		FMemory::Memzero(SourceCounterReadbackSlotCounts);
+		FMemory::Memzero(SourceCounterReadbackReservedCounts);
+		RecentReservedSlotCount.store(0);
 		CachedSourceCounts.Empty();
+		SourceSlotCount.store(0);
 	}
 
 	// Release stream compaction buffers
@@ -166,16 +198,23 @@ void FKawaiiFluidParticleLifecycleManager::AddSpawnRequest(const FVector3f& Posi
  * @brief Add multiple spawn requests at once (thread-safe, more efficient).
  * @param Requests Array of spawn requests.
  */
-void FKawaiiFluidParticleLifecycleManager::AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests)
+void FKawaiiFluidParticleLifecycleManager::AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests)
 {
 	if (Requests.Num() == 0)
 	{
 		return;
 	}
 
+	int32 MaxRequestSourceID = EGPUParticleSource::InvalidSourceID;
+	for (const FGPUSpawnRequest& Request : Requests)
+	{
+		MaxRequestSourceID = FMath::Max(MaxRequestSourceID, Request.SourceID);
+	}
+	ReserveSourceSlot(MaxRequestSourceID);
+
 	FScopeLock Lock(&SpawnLock);
 
-	PendingSpawnRequests.Append(Requests);
+	PendingSpawnRequests.Append(Requests.GetData(), Requests.Num());
 	bHasPendingSpawnRequests.store(true);
 
 	KF_LOG_DEV(Verbose, TEXT("AddSpawnRequests: Added %d requests (total pending: %d)"),
@@ -188,7 +227,7 @@ void FKawaiiFluidParticleLifecycleManager::AddSpawnRequests(const TArray<FGPUSpa
 void FKawaiiFluidParticleLifecycleManager::ClearSpawnRequests()
 {
 	FScopeLock Lock(&SpawnLock);
-	PendingSpawnRequests.Empty();
+	PendingSpawnRequests.Reset();
 	bHasPendingSpawnRequests.store(false);
 }
 
@@ -284,11 +323,17 @@ void FKawaiiFluidParticleLifecycleManager::SetSourceEmitterMax(int32 SourceID, i
 		return;
 	}
 
+	ReserveSourceSlot(SourceID);
+
 	FScopeLock Lock(&GPUDespawnLock);
 
-	if (EmitterMaxCountsCPU.Num() == 0)
+	if (SourceID >= EmitterMaxCountsCPU.Num())
 	{
-		EmitterMaxCountsCPU.SetNumZeroed(EGPUParticleSource::MaxSourceCount);
+		if (MaxCount == 0)
+		{
+			return;
+		}
+		EmitterMaxCountsCPU.SetNumZeroed(SourceID + 1);
 	}
 
 	const int32 OldValue = EmitterMaxCountsCPU[SourceID];
@@ -369,9 +414,8 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 	const bool bHasBrush = ActiveGPUBrushDespawns.Num() > 0;
 	const bool bHasSource = ActiveGPUSourceDespawns.Num() > 0;
 	const bool bHasPerSourceRecycle = HasPerSourceRecycle();
-	const bool bHasOldest = bHasPerSourceRecycle;
 
-	if (!bHasBrush && !bHasSource && !bHasOldest)
+	if (!bHasBrush && !bHasSource && !bHasPerSourceRecycle)
 	{
 		return;
 	}
@@ -473,62 +517,20 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 			GPUIndirectDispatch::IndirectArgsOffset_TG256);
 	}
 
-	// Shared: Compute IDShiftBits (used by both per-source and global oldest)
-	const int32 MaxID = FMath::Max(1, NextParticleIDHint);
-	const int32 Log2MaxID = FMath::FloorLog2(MaxID);
-	const int32 IDShiftBits = FMath::Max(0, Log2MaxID - 7);
-
-	// Shared: Ensure histogram buffers exist (reused by per-source loop and global oldest)
-	FRDGBufferRef IDHistogramBuffer = nullptr;
-	FRDGBufferRef OldestThresholdBuffer = nullptr;
-	FRDGBufferRef BoundaryCounterBuffer = nullptr;
-
-	if (bHasOldest)
-	{
-		if (!PersistentIDHistogramBuffer.IsValid())
-		{
-			FRDGBufferDesc HistDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 256);
-			IDHistogramBuffer = GraphBuilder.CreateBuffer(HistDesc, TEXT("IDHistogram"));
-			PersistentIDHistogramBuffer = GraphBuilder.ConvertToExternalBuffer(IDHistogramBuffer);
-		}
-		else
-		{
-			IDHistogramBuffer = GraphBuilder.RegisterExternalBuffer(PersistentIDHistogramBuffer, TEXT("IDHistogram"));
-		}
-
-		if (!PersistentOldestThresholdBuffer.IsValid())
-		{
-			FRDGBufferDesc ThreshDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 2);
-			OldestThresholdBuffer = GraphBuilder.CreateBuffer(ThreshDesc, TEXT("OldestThreshold"));
-			PersistentOldestThresholdBuffer = GraphBuilder.ConvertToExternalBuffer(OldestThresholdBuffer);
-		}
-		else
-		{
-			OldestThresholdBuffer = GraphBuilder.RegisterExternalBuffer(PersistentOldestThresholdBuffer, TEXT("OldestThreshold"));
-		}
-
-		if (!PersistentBoundaryCounterBuffer.IsValid())
-		{
-			FRDGBufferDesc CounterDesc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 1);
-			BoundaryCounterBuffer = GraphBuilder.CreateBuffer(CounterDesc, TEXT("BoundaryCounter"));
-			PersistentBoundaryCounterBuffer = GraphBuilder.ConvertToExternalBuffer(BoundaryCounterBuffer);
-		}
-		else
-		{
-			BoundaryCounterBuffer = GraphBuilder.RegisterExternalBuffer(PersistentBoundaryCounterBuffer, TEXT("BoundaryCounter"));
-		}
-	}
-
-	// Step 3.5: Per-source recycle — compute PerSourceExcess[64] and run oldest 3-pass per source
+	// Step 3.5: Per-source recycle — compute PerSourceExcess[] for live slots, then one oldest 3-pass for every limited source
 	if (bHasPerSourceRecycle)
 	{
 		RDG_EVENT_SCOPE(GraphBuilder, "GPUDespawn_PerSourceRecycle");
 
+		// Per-source tables match the counter buffer capacity; only the live slot prefix is processed
+		const int32 SourceCapacity = GetSourceCounterCapacity();
+		const int32 LiveSourceCount = FMath::Min(SourceSlotCount.load(), SourceCapacity);
+
 		// Ensure PerSourceExcess buffer exists
 		FRDGBufferRef PerSourceExcessBuffer;
-		if (!PersistentPerSourceExcessBuffer.IsValid())
+		if (!PersistentPerSourceExcessBuffer.IsValid() || static_cast<int32>(PersistentPerSourceExcessBuffer->Desc.NumElements) != SourceCapacity)
 		{
-			FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), EGPUParticleSource::MaxSourceCount);
+			FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), SourceCapacity);
 			PerSourceExcessBuffer = GraphBuilder.CreateBuffer(Desc, TEXT("PerSourceExcess"));
 			PersistentPerSourceExcessBuffer = GraphBuilder.ConvertToExternalBuffer(PerSourceExcessBuffer);
 		}
@@ -539,11 +541,12 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 
 		// Ensure EmitterMaxCounts buffer exists and upload if dirty
 		FRDGBufferRef EmitterMaxCountsBuffer;
-		if (!PersistentEmitterMaxCountsBuffer.IsValid() || bEmitterMaxCountsDirty)
+		if (!PersistentEmitterMaxCountsBuffer.IsValid() || bEmitterMaxCountsDirty ||
+			static_cast<int32>(PersistentEmitterMaxCountsBuffer->Desc.NumElements) != SourceCapacity)
 		{
 			TArray<uint32> MaxCountsUint32;
-			MaxCountsUint32.SetNumUninitialized(EGPUParticleSource::MaxSourceCount);
-			for (int32 i = 0; i < EGPUParticleSource::MaxSourceCount; ++i)
+			MaxCountsUint32.SetNumUninitialized(SourceCapacity);
+			for (int32 i = 0; i < SourceCapacity; ++i)
 			{
 				MaxCountsUint32[i] = static_cast<uint32>(FMath::Max(0, EmitterMaxCountsCPU.IsValidIndex(i) ? EmitterMaxCountsCPU[i] : 0));
 			}
@@ -552,7 +555,7 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 				GraphBuilder,
 				TEXT("EmitterMaxCounts"),
 				sizeof(uint32),
-				EGPUParticleSource::MaxSourceCount,
+				SourceCapacity,
 				MaxCountsUint32.GetData(),
 				MaxCountsUint32.Num() * sizeof(uint32),
 				ERDGInitialDataFlags::None
@@ -567,10 +570,10 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 
 		// Build per-source incoming spawn counts from ActiveSpawnRequests
 		TArray<uint32> IncomingCounts;
-		IncomingCounts.SetNumZeroed(EGPUParticleSource::MaxSourceCount);
+		IncomingCounts.SetNumZeroed(SourceCapacity);
 		for (const FGPUSpawnRequest& Req : ActiveSpawnRequests)
 		{
-			if (Req.SourceID >= 0 && Req.SourceID < EGPUParticleSource::MaxSourceCount)
+			if (Req.SourceID >= 0 && Req.SourceID < SourceCapacity)
 			{
 				IncomingCounts[Req.SourceID]++;
 			}
@@ -580,7 +583,7 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 			GraphBuilder,
 			TEXT("IncomingSpawnCounts"),
 			sizeof(uint32),
-			EGPUParticleSource::MaxSourceCount,
+			SourceCapacity,
 			IncomingCounts.GetData(),
 			IncomingCounts.Num() * sizeof(uint32),
 			ERDGInitialDataFlags::None
@@ -592,7 +595,7 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 		// Clear PerSourceExcess before compute
 		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(PerSourceExcessBuffer), 0u);
 
-		// Dispatch ComputePerSourceRecycleCS → PerSourceExcess[64]
+		// Dispatch ComputePerSourceRecycleCS → PerSourceExcess[LiveSourceCount]
 		{
 			TShaderMapRef<FComputePerSourceRecycleCS> RecycleCS(ShaderMap);
 			FComputePerSourceRecycleCS::FParameters* RecycleParams = GraphBuilder.AllocParameters<FComputePerSourceRecycleCS::FParameters>();
@@ -600,28 +603,32 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 			RecycleParams->EmitterMaxCounts = GraphBuilder.CreateSRV(EmitterMaxCountsBuffer);
 			RecycleParams->IncomingSpawnCounts = GraphBuilder.CreateSRV(IncomingSpawnCountsBuffer);
 			RecycleParams->PerSourceExcess = GraphBuilder.CreateUAV(PerSourceExcessBuffer);
-			RecycleParams->ActiveSourceCount = EGPUParticleSource::MaxSourceCount;
+			RecycleParams->ActiveSourceCount = LiveSourceCount;
 
 			FComputeShaderUtils::AddPass(GraphBuilder,
-				RDG_EVENT_NAME("GPUFluid::ComputePerSourceExcess"),
-				RecycleCS, RecycleParams, FIntVector(1, 1, 1));
+				RDG_EVENT_NAME("GPUFluid::ComputePerSourceExcess(%d)", LiveSourceCount),
+				RecycleCS, RecycleParams, FIntVector(FMath::DivideAndRoundUp(FMath::Max(LiveSourceCount, 1), FComputePerSourceRecycleCS::ThreadGroupSize), 1, 1));
 		}
 
 		FRDGBufferSRVRef PerSourceExcessSRV = GraphBuilder.CreateSRV(PerSourceExcessBuffer);
 
-		// Step 3.6: Per-source oldest 3-pass — loop over each source with EmitterMax set
-		for (int32 s = 0; s < EGPUParticleSource::MaxSourceCount; ++s)
+		// Step 3.6: Oldest 3-pass over all limited sources at once (per-source histograms, thresholds and boundary counters)
+		const int32 LimitedSourceCount = FMath::Min(EmitterMaxCountsCPU.Num(), LiveSourceCount);
+		if (LimitedSourceCount > 0)
 		{
-			if (!EmitterMaxCountsCPU.IsValidIndex(s) || EmitterMaxCountsCPU[s] <= 0)
-			{
-				continue;
-			}
+			const int32 MaxID = FMath::Max(1, NextParticleIDHint);
+			const int32 IDShiftBits = FMath::Max(0, FMath::FloorLog2(MaxID) - 7);
+
+			// Tables are sized in power-of-two source steps so they are not reallocated every time a limited source appears
+			const int32 TableSourceCount = FKawaiiFluidSourceSlotTable::GetCapacityForSlotCount(LimitedSourceCount);
+			FRDGBufferRef IDHistogramBuffer = RegisterOldestTableBuffer(GraphBuilder, PersistentIDHistogramBuffer, TableSourceCount * OldestBucketCount, TEXT("IDHistogram"));
+			FRDGBufferRef OldestThresholdBuffer = RegisterOldestTableBuffer(GraphBuilder, PersistentOldestThresholdBuffer, TableSourceCount * 2, TEXT("OldestThreshold"));
+			FRDGBufferRef BoundaryCounterBuffer = RegisterOldestTableBuffer(GraphBuilder, PersistentBoundaryCounterBuffer, TableSourceCount, TEXT("BoundaryCounter"));
 
-			// Clear histogram and boundary counter for this source
 			AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(IDHistogramBuffer), 0u);
 			AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(BoundaryCounterBuffer), 0u);
 
-			// Pass 1: BuildIDHistogramCS (filtered to SourceID == s)
+			// Pass 1: BuildIDHistogramCS (particles of every over-limit source, binned by source)
 			{
 				TShaderMapRef<FBuildIDHistogramCS> HistCS(ShaderMap);
 				FBuildIDHistogramCS::FParameters* HistParams = GraphBuilder.AllocParameters<FBuildIDHistogramCS::FParameters>();
@@ -629,16 +636,16 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 				HistParams->IDHistogram = GraphBuilder.CreateUAV(IDHistogramBuffer);
 				HistParams->ParticleCountBuffer = ParticleCountSRV;
 				HistParams->PerSourceExcess = PerSourceExcessSRV;
-				HistParams->FilterSourceID = s;
+				HistParams->LimitedSourceCount = LimitedSourceCount;
 				HistParams->IDShiftBits = IDShiftBits;
 
 				GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
-					RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Histogram(src=%d)", s),
+					RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Histogram(%d sources)", LimitedSourceCount),
 					HistCS, HistParams, ParticleCountBuffer,
 					GPUIndirectDispatch::IndirectArgsOffset_TG256);
 			}
 
-			// Pass 2: FindOldestThresholdCS (removeCount = PerSourceExcess[s], read on GPU)
+			// Pass 2: FindOldestThresholdCS (removeCount = PerSourceExcess[s], read on GPU, one thread per source)
 			{
 				TShaderMapRef<FFindOldestThresholdCS> ThreshCS(ShaderMap);
 				FFindOldestThresholdCS::FParameters* ThreshParams = GraphBuilder.AllocParameters<FFindOldestThresholdCS::FParameters>();
@@ -646,14 +653,14 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 				ThreshParams->OldestThreshold = GraphBuilder.CreateUAV(OldestThresholdBuffer);
 				ThreshParams->ParticleCountBuffer = ParticleCountSRV;
 				ThreshParams->PerSourceExcess = PerSourceExcessSRV;
-				ThreshParams->FilterSourceID = s;
+				ThreshParams->LimitedSourceCount = LimitedSourceCount;
 
 				FComputeShaderUtils::AddPass(GraphBuilder,
-					RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Threshold(src=%d)", s),
-					ThreshCS, ThreshParams, FIntVector(1, 1, 1));
+					RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Threshold(%d sources)", LimitedSourceCount),
+					ThreshCS, ThreshParams, FIntVector(FMath::DivideAndRoundUp(LimitedSourceCount, FFindOldestThresholdCS::ThreadGroupSize), 1, 1));
 			}
 
-			// Pass 3: MarkOldestParticlesCS (filtered to SourceID == s)
+			// Pass 3: MarkOldestParticlesCS (each particle against its own source's threshold)
 			{
 				TShaderMapRef<FMarkOldestParticlesCS> MarkCS(ShaderMap);
 				FMarkOldestParticlesCS::FParameters* MarkParams = GraphBuilder.AllocParameters<FMarkOldestParticlesCS::FParameters>();
@@ -663,11 +670,11 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 				MarkParams->BoundaryCounter = GraphBuilder.CreateUAV(BoundaryCounterBuffer);
 				MarkParams->ParticleCountBuffer = ParticleCountSRV;
 				MarkParams->PerSourceExcess = PerSourceExcessSRV;
-				MarkParams->FilterSourceID = s;
+				MarkParams->LimitedSourceCount = LimitedSourceCount;
 				MarkParams->IDShiftBits = IDShiftBits;
 
 				GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
-					RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Mark(src=%d)", s),
+					RDG_EVENT_NAME("GPUFluid::PerSourceOldest_Mark(%d sources)", LimitedSourceCount),
 					MarkCS, MarkParams, ParticleCountBuffer,
 					GPUIndirectDispatch::IndirectArgsOffset_TG256);
 			}
@@ -684,7 +691,7 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 		UpdateParams->Particles = GraphBuilder.CreateSRV(InOutParticleBuffer);
 		UpdateParams->SourceCounters = SourceCounterUAV;
 		UpdateParams->ParticleCountBuffer = ParticleCountSRV;
-		UpdateParams->MaxSourceCount = EGPUParticleSource::MaxSourceCount;
+		UpdateParams->MaxSourceCount = GetSourceCounterCapacity();
 
 		GPUIndirectDispatch::AddIndirectComputePass(GraphBuilder,
 			RDG_EVENT_NAME("GPUFluid::DespawnUpdateSourceCounters"),
@@ -784,14 +791,16 @@ void FKawaiiFluidParticleLifecycleManager::AddGPUDespawnPass(
 
 /**
  * @brief Swap pending requests to active buffer.
+ *
+ * Both buffers keep their allocations, so steady-state spawning does not reallocate.
  */
 void FKawaiiFluidParticleLifecycleManager::SwapBuffers()
 {
 	FScopeLock Lock(&SpawnLock);
 
-	// Move pending requests to active buffer
-	ActiveSpawnRequests = MoveTemp(PendingSpawnRequests);
-	PendingSpawnRequests.Empty();
+	// Exchange buffers; pending inherits the (emptied) active allocation
+	ActiveSpawnRequests.Reset();
+	Exchange(ActiveSpawnRequests, PendingSpawnRequests);
 	bHasPendingSpawnRequests.store(false);
 }
 
@@ -840,7 +849,7 @@ void FKawaiiFluidParticleLifecycleManager::AddSpawnParticlesPass(
 	PassParameters->SpawnRequestCount = ActiveSpawnRequests.Num();
 	PassParameters->MaxParticleCount = MaxParticleCount;
 	PassParameters->NextParticleID = NextParticleID.load();
-	PassParameters->MaxSourceCount = EGPUParticleSource::MaxSourceCount;
+	PassParameters->MaxSourceCount = GetSourceCounterCapacity();
 	PassParameters->DefaultRadius = DefaultSpawnRadius;
 	PassParameters->DefaultMass = DefaultSpawnMass;
 
@@ -876,32 +885,50 @@ void FKawaiiFluidParticleLifecycleManager::OnSpawnComplete(int32 SpawnedCount)
 //=============================================================================
 
 /**
- * @brief Register source counter buffer for RDG and get UAV.
+ * @brief Register source counter buffer for RDG and get UAV, growing it to cover every SourceID seen so far.
  * @param GraphBuilder RDG builder.
  * @return Source counter UAV.
  */
 FRDGBufferUAVRef FKawaiiFluidParticleLifecycleManager::RegisterSourceCounterUAV(FRDGBuilder& GraphBuilder)
 {
+	const int32 RequiredCapacity = FKawaiiFluidSourceSlotTable::GetCapacityForSlotCount(SourceSlotCount.load());
+
 	// Create persistent buffer if not exists
 	if (!SourceCounterBuffer.IsValid())
 	{
-		// Allocate on render thread via RDG
-		FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), EGPUParticleSource::MaxSourceCount);
+		FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), RequiredCapacity);
 		FRDGBufferRef TempBuffer = GraphBuilder.CreateBuffer(Desc, TEXT("GPUSourceCounters"));
 
 		// Initialize to zero
 		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(TempBuffer), 0u);
 
-		// Extract to persistent buffer
-		GraphBuilder.QueueBufferExtraction(TempBuffer, &SourceCounterBuffer);
+		// Convert immediately so later passes in this graph see the buffer and its capacity
+		SourceCounterBuffer = GraphBuilder.ConvertToExternalBuffer(TempBuffer);
 
-		KF_LOG_DEV(Log, TEXT("Created SourceCounterBuffer with %d slots"), EGPUParticleSource::MaxSourceCount);
+		KF_LOG_DEV(Log, TEXT("Created SourceCounterBuffer with %d slots"), RequiredCapacity);
 
 		return GraphBuilder.CreateUAV(TempBuffer);
 	}
 
 	// Register existing buffer
 	FRDGBufferRef RegisteredBuffer = GraphBuilder.RegisterExternalBuffer(SourceCounterBuffer, TEXT("GPUSourceCounters"));
+
+	// Grow: existing counts carry over, new slots start at zero
+	const int32 CurrentCapacity = GetSourceCounterCapacity();
+	if (CurrentCapacity < RequiredCapacity)
+	{
+		FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), RequiredCapacity);
+		FRDGBufferRef GrownBuffer = GraphBuilder.CreateBuffer(Desc, TEXT("GPUSourceCounters"));
+
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(GrownBuffer), 0u);
+		AddCopyBufferPass(GraphBuilder, GrownBuffer, 0, RegisteredBuffer, 0, CurrentCapacity * sizeof(uint32));
+
+		SourceCounterBuffer = GraphBuilder.ConvertToExternalBuffer(GrownBuffer);
+		RegisteredBuffer = GrownBuffer;
+
+		KF_LOG_DEV(Log, TEXT("Grew SourceCounterBuffer %d -> %d slots"), CurrentCapacity, RequiredCapacity);
+	}
+
 	return GraphBuilder.CreateUAV(RegisteredBuffer);
 }
 
@@ -924,12 +951,9 @@ int32 FKawaiiFluidParticleLifecycleManager::GetParticleCountForSource(int32 Sour
 		return -1;  // Data not ready
 	}
 
+	// Slots beyond the read-back prefix have not counted any particles yet
 	FScopeLock Lock(&SourceCountLock);
-	if (SourceID < CachedSourceCounts.Num())
-	{
-		return CachedSourceCounts[SourceID];
-	}
-	return -1;
+	return CachedSourceCounts.IsValidIndex(SourceID) ? CachedSourceCounts[SourceID] : 0;
 }
 
 /**
@@ -943,7 +967,7 @@ TArray<int32> FKawaiiFluidParticleLifecycleManager::GetAllSourceCounts() const
 }
 
 /**
- * @brief Enqueue source counter readback.
+ * @brief Enqueue source counter readback (only the live [0, SourceSlotCount) prefix is copied).
  * @param RHICmdList Command list.
  */
 void FKawaiiFluidParticleLifecycleManager::EnqueueSourceCounterReadback(FRHICommandListImmediate& RHICmdList)
@@ -966,10 +990,20 @@ void FKawaiiFluidParticleLifecycleManager::EnqueueSourceCounterReadback(FRHIComm
 		return;
 	}
 
+	const int32 SlotCount = FMath::Min(SourceSlotCount.load(), GetSourceCounterCapacity());
+	if (SlotCount <= 0)
+	{
+		return;
+	}
+
 	// Enqueue to write slot
 	if (SourceCounterReadbacks.IsValidIndex(SourceCounterWriteIndex) && SourceCounterReadbacks[SourceCounterWriteIndex])
 	{
-		const uint32 CopySize = EGPUParticleSource::MaxSourceCount * sizeof(uint32);
+		const uint32 CopySize = SlotCount * sizeof(uint32);
+		SourceCounterReadbackSlotCounts[SourceCounterWriteIndex] = SlotCount;
+
+		// Slots reserved before this copy may still be spawned into after it: keep them until this readback is processed
+		SourceCounterReadbackReservedCounts[SourceCounterWriteIndex] = RecentReservedSlotCount.exchange(0);
 
 		// State transition for readback
 		RHICmdList.Transition(FRHITransitionInfo(SourceBuffer, ERHIAccess::UAVCompute, ERHIAccess::CopySrc));
@@ -1001,16 +1035,24 @@ void FKawaiiFluidParticleLifecycleManager::ProcessSourceCounterReadback()
 		return;
 	}
 
-	const uint32 CopySize = EGPUParticleSource::MaxSourceCount * sizeof(uint32);
+	const int32 SlotCount = SourceCounterReadbackSlotCounts[SourceCounterReadIndex];
+	const uint32 CopySize = SlotCount * sizeof(uint32);
 	const uint32* Data = static_cast<const uint32*>(SourceCounterReadbacks[SourceCounterReadIndex]->Lock(CopySize));
 
+	int32 HighestCountedSlotCount = SlotCount;
 	if (Data)
 	{
 		FScopeLock Lock(&SourceCountLock);
-		CachedSourceCounts.SetNum(EGPUParticleSource::MaxSourceCount);
-		for (int32 i = 0; i < EGPUParticleSource::MaxSourceCount; ++i)
+		UnpackSourceCounts(Data, SlotCount, CachedSourceCounts);
+
+		HighestCountedSlotCount = 0;
+		for (int32 Slot = SlotCount - 1; Slot >= 0; --Slot)
 		{
-			CachedSourceCounts[i] = static_cast<int32>(Data[i]);
+			if (CachedSourceCounts[Slot] != 0)
+			{
+				HighestCountedSlotCount = Slot + 1;
+				break;
+			}
 		}
 	}
 
@@ -1019,6 +1061,40 @@ void FKawaiiFluidParticleLifecycleManager::ProcessSourceCounterReadback()
 	// Advance read index
 	SourceCounterReadIndex = (SourceCounterReadIndex + 1) % SourceCounterRingBufferSize;
 	--SourceCounterPendingCount;
+
+	// Released sources leave empty slots at the top: stop copying and scanning them
+	TrimSourceSlotCount(HighestCountedSlotCount);
+}
+
+/**
+ * @brief Shrink SourceSlotCount to the slots that still hold particles or may receive them.
+ *
+ * A slot stays live if the processed readback counted particles in it, or if it was reserved after the
+ * readback before the processed one was enqueued (its spawns may not be in the processed copy yet).
+ * Reservations racing with the trim win: ReserveSourceSlot publishes RecentReservedSlotCount first.
+ * Must run after the read index advanced past the processed readback.
+ *
+ * @param HighestCountedSlotCount One past the highest slot with a non-zero count in the processed readback.
+ */
+void FKawaiiFluidParticleLifecycleManager::TrimSourceSlotCount(int32 HighestCountedSlotCount)
+{
+	// The processed readback's own window plus every readback still in flight
+	int32 LiveSlotCount = HighestCountedSlotCount;
+	for (int32 Offset = -1; Offset < SourceCounterPendingCount; ++Offset)
+	{
+		const int32 RingIndex = (SourceCounterReadIndex + Offset + SourceCounterRingBufferSize) % SourceCounterRingBufferSize;
+		LiveSlotCount = FMath::Max(LiveSlotCount, SourceCounterReadbackReservedCounts[RingIndex]);
+	}
+
+	int32 Current = SourceSlotCount.load();
+	while (Current > LiveSlotCount)
+	{
+		const int32 Desired = FMath::Max(LiveSlotCount, RecentReservedSlotCount.load());
+		if (Desired >= Current || SourceSlotCount.compare_exchange_weak(Current, Desired))
+		{
+			break;
+		}
+	}
 }
 
 /**
@@ -1060,16 +1136,8 @@ void FKawaiiFluidParticleLifecycleManager::InitializeSourceCountersFromParticles
 
 	// Count particles by SourceID
 	TArray<int32> SourceCounts;
-	SourceCounts.SetNumZeroed(EGPUParticleSource::MaxSourceCount);
-
-	for (const FGPUFluidParticle& Particle : Particles)
-	{
-		const int32 SourceID = Particle.SourceID;
-		if (SourceID >= 0 && SourceID < EGPUParticleSource::MaxSourceCount)
-		{
-			SourceCounts[SourceID]++;
-		}
-	}
+	CountParticlesPerSource(Particles, SourceCounts);
+	ReserveSourceSlot(SourceCounts.Num() - 1);
 
 	// Update CPU cache immediately
 	{
@@ -1077,10 +1145,10 @@ void FKawaiiFluidParticleLifecycleManager::InitializeSourceCountersFromParticles
 		CachedSourceCounts = SourceCounts;
 	}
 
-	// Create or update GPU buffer
+	// Create or update GPU buffer (padded to the power-of-two counter capacity)
 	TArray<uint32> CountsUint32;
-	CountsUint32.SetNumUninitialized(EGPUParticleSource::MaxSourceCount);
-	for (int32 i = 0; i < EGPUParticleSource::MaxSourceCount; ++i)
+	CountsUint32.SetNumZeroed(FKawaiiFluidSourceSlotTable::GetCapacityForSlotCount(SourceSlotCount.load()));
+	for (int32 i = 0; i < SourceCounts.Num(); ++i)
 	{
 		CountsUint32[i] = static_cast<uint32>(SourceCounts[i]);
 	}
@@ -1089,19 +1157,22 @@ void FKawaiiFluidParticleLifecycleManager::InitializeSourceCountersFromParticles
 	TArray<uint32> CountsCopy = CountsUint32;
 
 	ENQUEUE_RENDER_COMMAND(InitializeSourceCounters)(
-		[Self, CountsCopy](FRHICommandListImmediate& RHICmdList)
+		[Self, CountsCopy](FRHICommandListImmediate& RHICmdList) mutable
 		{
 			FRDGBuilder GraphBuilder(RHICmdList, RDG_EVENT_NAME("InitializeSourceCounters"));
 
+			// Overwrite every slot of an existing (possibly larger) buffer
+			CountsCopy.SetNumZeroed(FMath::Max(CountsCopy.Num(), Self->GetSourceCounterCapacity()));
+
 			FRDGBufferRef CounterBuffer;
-			if (!Self->SourceCounterBuffer.IsValid())
+			if (!Self->SourceCounterBuffer.IsValid() || Self->GetSourceCounterCapacity() < CountsCopy.Num())
 			{
-				// Create buffer with initial data if not exists
+				// Create buffer with initial data if not exists (or too small)
 				CounterBuffer = CreateStructuredBuffer(
 					GraphBuilder,
 					TEXT("GPUSourceCounters"),
 					sizeof(uint32),
-					EGPUParticleSource::MaxSourceCount,
+					CountsCopy.Num(),
 					CountsCopy.GetData(),
 					CountsCopy.Num() * sizeof(uint32),
 					ERDGInitialDataFlags::None
@@ -1123,17 +1194,80 @@ void FKawaiiFluidParticleLifecycleManager::InitializeSourceCountersFromParticles
 
 	// Log source counts
 	int32 TotalCounted = 0;
-	for (int32 i = 0; i < EGPUParticleSource::MaxSourceCount; ++i)
+	for (int32 i = 0; i < SourceCounts.Num(); ++i)
 	{
-		if (CachedSourceCounts[i] > 0)
+		if (SourceCounts[i] > 0)
 		{
-			KF_LOG_DEV(Log, TEXT("InitializeSourceCounters: SourceID %d = %d particles"), i, CachedSourceCounts[i]);
-			TotalCounted += CachedSourceCounts[i];
+			KF_LOG_DEV(Verbose, TEXT("InitializeSourceCounters: SourceID %d = %d particles"), i, SourceCounts[i]);
+			TotalCounted += SourceCounts[i];
 		}
 	}
 	KF_LOG_DEV(Log, TEXT("InitializeSourceCounters: Total %d particles from %d input"), TotalCounted, Particles.Num());
 }
 
+/**
+ * @brief Make sure counter tables and readbacks cover a SourceID (lock-free, thread-safe).
+ * @param SourceID Source ID about to be used (ignored if invalid).
+ */
+void FKawaiiFluidParticleLifecycleManager::ReserveSourceSlot(int32 SourceID)
+{
+	if (SourceID < 0 || SourceID >= EGPUParticleSource::MaxSourceCount)
+	{
+		return;
+	}
+
+	// Recent reservation first, so a concurrent TrimSourceSlotCount never drops this slot
+	int32 Recent = RecentReservedSlotCount.load();
+	while (Recent <= SourceID && !RecentReservedSlotCount.compare_exchange_weak(Recent, SourceID + 1))
+	{
+	}
+
+	int32 Current = SourceSlotCount.load();
+	while (Current <= SourceID && !SourceSlotCount.compare_exchange_weak(Current, SourceID + 1))
+	{
+	}
+}
+
+/**
+ * @brief Count particles per SourceID into a table covering [0, highest SourceID].
+ * @param Particles Particles to count.
+ * @param OutCounts Per-source counts (resized; empty if no particle has a valid source).
+ */
+void FKawaiiFluidParticleLifecycleManager::CountParticlesPerSource(const TArray<FGPUFluidParticle>& Particles, TArray<int32>& OutCounts)
+{
+	OutCounts.Reset();
+
+	for (const FGPUFluidParticle& Particle : Particles)
+	{
+		const int32 SourceID = Particle.SourceID;
+		if (SourceID < 0 || SourceID >= EGPUParticleSource::MaxSourceCount)
+		{
+			continue;
+		}
+
+		if (SourceID >= OutCounts.Num())
+		{
+			OutCounts.SetNumZeroed(SourceID + 1);
+		}
+		OutCounts[SourceID]++;
+	}
+}
+
+/**
+ * @brief Decode a compacted counter readback into the CPU cache.
+ * @param Data Read-back counters for slots [0, SlotCount).
+ * @param SlotCount Number of slots in Data.
+ * @param OutCounts Per-source counts (resized to SlotCount).
+ */
+void FKawaiiFluidParticleLifecycleManager::UnpackSourceCounts(const uint32* Data, int32 SlotCount, TArray<int32>& OutCounts)
+{
+	OutCounts.SetNumUninitialized(FMath::Max(SlotCount, 0));
+	for (int32 i = 0; i < OutCounts.Num(); ++i)
+	{
+		OutCounts[i] = static_cast<int32>(Data[i]);
+	}
+}
+
 //=============================================================================
 // Stream Compaction Buffers (Persistent)
 //=============================================================================
@@ -0,0 +1,242 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Managers/KawaiiFluidSpawnRequestRing.h"
+#include "Misc/ScopeLock.h"
+
+/**
+ * @brief Allocates the first block plus a pool of spare blocks.
+ * @param NumPreallocatedBlocks Total blocks allocated up front (at least one).
+ */
+FKawaiiFluidSpawnRequestRing::FKawaiiFluidSpawnRequestRing(int32 NumPreallocatedBlocks)
+{
+	HeadBlock = new FBlock();
+	TailBlock = HeadBlock;
+	NumAllocatedBlocks.store(1, std::memory_order_relaxed);
+
+	for (int32 i = 1; i < NumPreallocatedBlocks; ++i)
+	{
+		FreeBlocks.Add(new FBlock());
+		NumAllocatedBlocks.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+FKawaiiFluidSpawnRequestRing::~FKawaiiFluidSpawnRequestRing()
+{
+	FBlock* Block = HeadBlock;
+	while (Block)
+	{
+		FBlock* Next = Block->Next.load(std::memory_order_relaxed);
+		delete Block;
+		Block = Next;
+	}
+
+	for (FBlock* Free : FreeBlocks)
+	{
+		delete Free;
+	}
+}
+
+//========================================
+// Producer
+//========================================
+
+/**
+ * @brief Publish one spawn request.
+ * @param Request Request to copy into the ring.
+ */
+void FKawaiiFluidSpawnRequestRing::Push(const FGPUSpawnRequest& Request)
+{
+	Push(TConstArrayView<FGPUSpawnRequest>(&Request, 1));
+}
+
+/**
+ * @brief Publish a batch of spawn requests (copied block by block, released per block).
+ * @param Requests Requests to copy into the ring.
+ */
+void FKawaiiFluidSpawnRequestRing::Push(TConstArrayView<FGPUSpawnRequest> Requests)
+{
+	const int32 Total = Requests.Num();
+	int32 Offset = 0;
+
+	while (Offset < Total)
+	{
+		// Committed is only written by the producer, so a relaxed load is exact here
+		const int32 Committed = TailBlock->Committed.load(std::memory_order_relaxed);
+		if (Committed == BlockSize)
+		{
+			FBlock* NewBlock = AcquireBlock();
+			TailBlock->Next.store(NewBlock, std::memory_order_release);
+			TailBlock = NewBlock;
+			continue;
+		}
+
+		const int32 Count = FMath::Min(BlockSize - Committed, Total - Offset);
+		FMemory::Memcpy(&TailBlock->Requests[Committed], Requests.GetData() + Offset, Count * sizeof(FGPUSpawnRequest));
+		TailBlock->Committed.store(Committed + Count, std::memory_order_release);
+		Offset += Count;
+	}
+
+	WrittenCount.fetch_add(Total, std::memory_order_release);
+}
+
+/**
+ * @brief Drop every request of a source published so far (later requests are kept).
+ * @param SourceID Source whose pending requests are cancelled.
+ */
+void FKawaiiFluidSpawnRequestRing::CancelSource(int32 SourceID)
+{
+	AddCancelFence(SourceID);
+}
+
+/**
+ * @brief Drop every request published so far.
+ */
+void FKawaiiFluidSpawnRequestRing::CancelAll()
+{
+	AddCancelFence(AllSources);
+}
+
+/**
+ * @brief Record a cancellation at the producer's current write position.
+ * @param SourceID Source to cancel, or AllSources.
+ */
+void FKawaiiFluidSpawnRequestRing::AddCancelFence(int32 SourceID)
+{
+	const uint64 Sequence = WrittenCount.load(std::memory_order_relaxed);
+	if (Sequence == ConsumedCount.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	FScopeLock Lock(&CancelLock);
+	CancelFences.Add({ SourceID, Sequence });
+	bHasCancelFences.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Producer: take a recycled block, or allocate one while the high-water mark grows.
+ * @return Empty block.
+ */
+FKawaiiFluidSpawnRequestRing::FBlock* FKawaiiFluidSpawnRequestRing::AcquireBlock()
+{
+	{
+		FScopeLock Lock(&FreeLock);
+		if (FreeBlocks.Num() > 0)
+		{
+			return FreeBlocks.Pop(EAllowShrinking::No);
+		}
+	}
+
+	NumAllocatedBlocks.fetch_add(1, std::memory_order_relaxed);
+	return new FBlock();
+}
+
+//========================================
+// Consumer
+//========================================
+
+/**
+ * @brief Consumer: visit every committed request in place, in publish order, skipping cancelled ones.
+ *
+ * Spans are contiguous slices of one block and may be modified (e.g. filling defaults) by the visitor.
+ * They are only valid during the callback.
+ *
+ * @param Visitor Called once per non-empty contiguous span.
+ * @return Number of requests delivered to the visitor.
+ */
+int32 FKawaiiFluidSpawnRequestRing::Consume(TFunctionRef<void(TArrayView<FGPUSpawnRequest>)> Visitor)
+{
+	TArray<FCancelFence, TInlineAllocator<8>> Fences;
+	if (bHasCancelFences.load(std::memory_order_acquire))
+	{
+		FScopeLock Lock(&CancelLock);
+		Fences = CancelFences;
+	}
+
+	int32 Delivered = 0;
+
+	for (;;)
+	{
+		const int32 Committed = HeadBlock->Committed.load(std::memory_order_acquire);
+		if (HeadReadIndex < Committed)
+		{
+			FGPUSpawnRequest* Span = &HeadBlock->Requests[HeadReadIndex];
+			const int32 Count = Committed - HeadReadIndex;
+
+			// Compact out cancelled requests (the consumer owns the committed region)
+			int32 Kept = Count;
+			if (Fences.Num() > 0)
+			{
+				Kept = 0;
+				for (int32 i = 0; i < Count; ++i)
+				{
+					const uint64 Sequence = ReadSequence + i;
+					const int32 SourceID = Span[i].SourceID;
+					const bool bCancelled = Fences.ContainsByPredicate([Sequence, SourceID](const FCancelFence& Fence)
+					{
+						return Sequence < Fence.Sequence && (Fence.SourceID == AllSources || Fence.SourceID == SourceID);
+					});
+
+					if (!bCancelled)
+					{
+						Span[Kept++] = Span[i];
+					}
+				}
+			}
+
+			if (Kept > 0)
+			{
+				Visitor(TArrayView<FGPUSpawnRequest>(Span, Kept));
+				Delivered += Kept;
+			}
+
+			HeadReadIndex = Committed;
+			ReadSequence += Count;
+			ConsumedCount.fetch_add(Count, std::memory_order_release);
+			continue;
+		}
+
+		if (HeadReadIndex == BlockSize)
+		{
+			FBlock* Next = HeadBlock->Next.load(std::memory_order_acquire);
+			if (!Next)
+			{
+				// Producer has not started the next block yet
+				break;
+			}
+
+			ReleaseBlock(HeadBlock);
+			HeadBlock = Next;
+			HeadReadIndex = 0;
+			continue;
+		}
+
+		break;
+	}
+
+	// Fences behind the read position have done their job
+	if (Fences.Num() > 0)
+	{
+		FScopeLock Lock(&CancelLock);
+		CancelFences.RemoveAll([this](const FCancelFence& Fence)
+		{
+			return Fence.Sequence <= ReadSequence;
+		});
+		bHasCancelFences.store(CancelFences.Num() > 0, std::memory_order_release);
+	}
+
+	return Delivered;
+}
+
+/**
+ * @brief Consumer: reset a fully read block and return it to the producer's free list.
+ * @param Block Block to recycle.
+ */
+void FKawaiiFluidSpawnRequestRing::ReleaseBlock(FBlock* Block)
+{
+	Block->Committed.store(0, std::memory_order_relaxed);
+	Block->Next.store(nullptr, std::memory_order_relaxed);
+
+	FScopeLock Lock(&FreeLock);
+	FreeBlocks.Add(Block);
+}
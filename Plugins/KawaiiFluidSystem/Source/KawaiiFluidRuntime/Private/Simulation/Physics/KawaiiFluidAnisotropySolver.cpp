@@ -0,0 +1,565 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Physics/KawaiiFluidAnisotropySolver.h"
+#include "Simulation/Resources/KawaiiFluidParticleSnapshot.h"
+#include "Core/KawaiiFluidParticle.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+
+namespace
+{
+	// KawaiiFluidSimulationAnisotropy.usf
+	constexpr float K_R = 4.0f;
+	constexpr int32 MinNeighborsForAnisotropy = 4;
+	constexpr int32 FullNeighborsForAnisotropy = 6;
+	constexpr float MinKernelWeight = 0.0001f;
+
+	/** Jacobi sweeps; 3x3 matrices converge in 4-6 */
+	constexpr int32 MaxJacobiSweeps = 16;
+
+	/**
+	 * @brief Ellipsoid of one particle (axes in descending scale order of the covariance).
+	 */
+	struct FEllipsoid
+	{
+		FVector3f Axes[3] = { FVector3f(1.0f, 0.0f, 0.0f), FVector3f(0.0f, 1.0f, 0.0f), FVector3f(0.0f, 0.0f, 1.0f) };
+
+		float Scales[3] = { 1.0f, 1.0f, 1.0f };
+	};
+
+	float SafeLog(float X)
+	{
+		return FMath::Loge(FMath::Max(X, 0.001f));
+	}
+
+	/**
+	 * @brief CalculateVelocityBasedWithVelocity: stretch along the velocity.
+	 * @param Velocity Particle velocity (cm/s).
+	 * @param Params Anisotropy parameters.
+	 * @return Ellipsoid (sphere below 0.001 cm/s).
+	 */
+	FEllipsoid ComputeVelocityBased(const FVector3f& Velocity, const FKawaiiFluidAnisotropyParams& Params)
+	{
+		FEllipsoid Result;
+		const float Speed = Velocity.Size();
+		if (Speed <= 0.001f)
+		{
+			return Result;
+		}
+
+		Result.Axes[0] = Velocity / Speed;
+		KawaiiFluidAnisotropyMath::BuildOrthonormalBasis(Result.Axes[0], Result.Axes[1], Result.Axes[2]);
+
+		const float RawScale1 = 1.0f + Speed * Params.VelocityStretchFactor * Params.Strength;
+		if (Params.bPreserveVolume)
+		{
+			// Stretch along the velocity, compress the other two axes: sum of logs stays 0
+			const float LogMin = SafeLog(Params.MinStretch);
+			const float LogMax = SafeLog(Params.MaxStretch);
+			const float LogScale1 = SafeLog(RawScale1);
+			const float LogScales[3] = { LogScale1, -LogScale1 * 0.5f, -LogScale1 * 0.5f };
+			for (int32 k = 0; k < 3; ++k)
+			{
+				Result.Scales[k] = FMath::Exp(FMath::Clamp(LogScales[k], LogMin, LogMax));
+			}
+		}
+		else
+		{
+			Result.Scales[0] = FMath::Clamp(RawScale1 * Params.NonPreservedRenderScale, Params.MinStretch, Params.MaxStretch);
+			Result.Scales[1] = Params.NonPreservedRenderScale;
+			Result.Scales[2] = Params.NonPreservedRenderScale;
+		}
+		return Result;
+	}
+
+	/**
+	 * @brief CalculateDensityBased: principal axes of the kernel-weighted neighbor covariance.
+	 * @param Index Particle index.
+	 * @param Positions Particle positions (cm).
+	 * @param Neighbors Neighbor lists.
+	 * @param H Kernel radius (cm).
+	 * @param Params Anisotropy parameters.
+	 * @return Ellipsoid (sphere below MinNeighborsForAnisotropy neighbors, the particle included).
+	 */
+	FEllipsoid ComputeDensityBased(int32 Index, TConstArrayView<FVector3f> Positions, const FKawaiiFluidNeighborCSR& Neighbors, float H,
+		const FKawaiiFluidAnisotropyParams& Params)
+	{
+		FEllipsoid Result;
+		const FVector3f Center = Positions[Index];
+		const float H2 = H * H;
+		const TConstArrayView<int32> NeighborList = Neighbors.GetNeighbors(Index);
+
+		// Pass 1: smoothed center, relative to the particle to keep precision far from the origin (self has weight 1)
+		FVector3f SumWP = FVector3f::ZeroVector;
+		float SumW = 1.0f;
+		int32 NeighborCount = 1;
+		for (const int32 j : NeighborList)
+		{
+			const FVector3f Diff = Positions[j] - Center;
+			const float Dist2 = Diff.SizeSquared();
+			if (j == Index || Dist2 >= H2)
+			{
+				continue;
+			}
+
+			const float W = KawaiiFluidAnisotropyMath::KernelWeight(FMath::Sqrt(Dist2), H);
+			if (W > MinKernelWeight)
+			{
+				SumWP += W * Diff;
+				SumW += W;
+				++NeighborCount;
+			}
+		}
+
+		if (NeighborCount < MinNeighborsForAnisotropy)
+		{
+			return Result;
+		}
+
+		const FVector3f SmoothedOffset = SumWP / SumW;
+
+		// Pass 2: covariance around the smoothed center
+		float C00 = 0.0f, C01 = 0.0f, C02 = 0.0f, C11 = 0.0f, C12 = 0.0f, C22 = 0.0f;
+		auto Accumulate = [&](const FVector3f& Diff, float W)
+		{
+			const FVector3f O = Diff - SmoothedOffset;
+			C00 += W * O.X * O.X;
+			C01 += W * O.X * O.Y;
+			C02 += W * O.X * O.Z;
+			C11 += W * O.Y * O.Y;
+			C12 += W * O.Y * O.Z;
+			C22 += W * O.Z * O.Z;
+		};
+
+		Accumulate(FVector3f::ZeroVector, 1.0f);
+		for (const int32 j : NeighborList)
+		{
+			const FVector3f Diff = Positions[j] - Center;
+			const float Dist2 = Diff.SizeSquared();
+			if (j == Index || Dist2 >= H2)
+			{
+				continue;
+			}
+
+			const float W = KawaiiFluidAnisotropyMath::KernelWeight(FMath::Sqrt(Dist2), H);
+			if (W > MinKernelWeight)
+			{
+				Accumulate(Diff, W);
+			}
+		}
+
+		const float InvW = 1.0f / SumW;
+		const KawaiiFluidAnisotropyMath::FSymmetricEigen3 Eigen = KawaiiFluidAnisotropyMath::SolveSymmetricEigen3x3(
+			C00 * InvW, C01 * InvW, C02 * InvW, C11 * InvW, C12 * InvW, C22 * InvW);
+
+		float Sigmas[3];
+		for (int32 k = 0; k < 3; ++k)
+		{
+			Sigmas[k] = FMath::Sqrt(FMath::Max(Eigen.Values[k], 0.0001f));
+		}
+
+		// Yu & Turk ratio clamp
+		const float MinSigma = Sigmas[0] / K_R;
+		Sigmas[1] = FMath::Max(Sigmas[1], MinSigma);
+		Sigmas[2] = FMath::Max(Sigmas[2], MinSigma);
+
+		// Sparse neighborhoods fade toward a sphere
+		const float BlendFactor = FMath::Clamp(
+			static_cast<float>(NeighborCount - MinNeighborsForAnisotropy) / static_cast<float>(FullNeighborsForAnisotropy - MinNeighborsForAnisotropy),
+			0.0f, 1.0f);
+
+		if (Params.bPreserveVolume)
+		{
+			float GeoMean = FMath::Pow(Sigmas[0] * Sigmas[1] * Sigmas[2], 1.0f / 3.0f);
+			if (GeoMean < 0.0001f)
+			{
+				GeoMean = 1.0f;
+			}
+
+			float LogScales[3];
+			for (int32 k = 0; k < 3; ++k)
+			{
+				LogScales[k] = SafeLog(Sigmas[k] / GeoMean) * Params.Strength;
+			}
+
+			const float LogAvg = (LogScales[0] + LogScales[1] + LogScales[2]) / 3.0f;
+			const float LogMin = SafeLog(Params.MinStretch);
+			const float LogMax = SafeLog(Params.MaxStretch);
+			for (int32 k = 0; k < 3; ++k)
+			{
+				Result.Scales[k] = FMath::Exp(FMath::Clamp((LogScales[k] - LogAvg) * BlendFactor, LogMin, LogMax));
+			}
+		}
+		else
+		{
+			// FleX: smoothing radius over sigma, minimum relative to the largest sigma
+			const float MinSigmaThreshold = FMath::Max3(Sigmas[0], Sigmas[1], Sigmas[2]) * Params.MinStretch;
+			for (int32 k = 0; k < 3; ++k)
+			{
+				float Scale = H / FMath::Max(FMath::Max(Sigmas[k], MinSigmaThreshold), 0.0001f) * Params.NonPreservedRenderScale;
+				Scale = FMath::Lerp(1.0f, Scale, Params.Strength);
+				Scale = FMath::Lerp(1.0f, Scale, BlendFactor);
+				Result.Scales[k] = FMath::Clamp(Scale, Params.MinStretch, Params.MaxStretch);
+			}
+		}
+
+		for (int32 k = 0; k < 3; ++k)
+		{
+			Result.Axes[k] = Eigen.Vectors[k];
+		}
+		return Result;
+	}
+
+	/**
+	 * @brief MODE_HYBRID: blend density and velocity scales by DensityWeight, take the axes of the dominant one.
+	 * @param Density Density-based ellipsoid.
+	 * @param Velocity Velocity-based ellipsoid.
+	 * @param Params Anisotropy parameters.
+	 * @return Blended ellipsoid.
+	 */
+	FEllipsoid BlendHybrid(const FEllipsoid& Density, const FEllipsoid& Velocity, const FKawaiiFluidAnisotropyParams& Params)
+	{
+		FEllipsoid Result = Params.DensityWeight > 0.5f ? Density : Velocity;
+		for (int32 k = 0; k < 3; ++k)
+		{
+			if (Params.bPreserveVolume)
+			{
+				const float LogScale = FMath::Lerp(SafeLog(Velocity.Scales[k]), SafeLog(Density.Scales[k]), Params.DensityWeight);
+				Result.Scales[k] = FMath::Exp(FMath::Clamp(LogScale, SafeLog(Params.MinStretch), SafeLog(Params.MaxStretch)));
+			}
+			else
+			{
+				Result.Scales[k] = FMath::Clamp(FMath::Lerp(Velocity.Scales[k], Density.Scales[k], Params.DensityWeight), Params.MinStretch, Params.MaxStretch);
+			}
+		}
+		return Result;
+	}
+
+	/**
+	 * @brief Blend toward last update's ellipsoid: sign-aligned normalized lerp of axes, log-space lerp of scales.
+	 * @param Ellipsoid In/Out ellipsoid.
+	 * @param Prev Previous axes (xyz) and scales (w).
+	 * @param Factor TemporalSmoothFactor (weight of the previous ellipsoid).
+	 */
+	void ApplyTemporalSmoothing(FEllipsoid& Ellipsoid, const FVector4f (&Prev)[3], float Factor)
+	{
+		for (int32 k = 0; k < 3; ++k)
+		{
+			const FVector3f PrevAxis(Prev[k].X, Prev[k].Y, Prev[k].Z);
+			const FVector3f Axis = FVector3f::DotProduct(Ellipsoid.Axes[k], PrevAxis) < 0.0f ? -Ellipsoid.Axes[k] : Ellipsoid.Axes[k];
+			Ellipsoid.Axes[k] = FMath::Lerp(Axis, PrevAxis, Factor).GetSafeNormal(UE_SMALL_NUMBER, Axis);
+			Ellipsoid.Scales[k] = FMath::Exp(FMath::Lerp(SafeLog(Ellipsoid.Scales[k]), SafeLog(Prev[k].W), Factor));
+		}
+	}
+}
+
+//=============================================================================
+// Math
+//=============================================================================
+
+namespace KawaiiFluidAnisotropyMath
+{
+	/**
+	 * @brief Eigenvalues and eigenvectors of a symmetric 3x3 matrix by cyclic Jacobi rotations (in double).
+	 * @param M00 Row 0, column 0.
+	 * @param M01 Row 0, column 1.
+	 * @param M02 Row 0, column 2.
+	 * @param M11 Row 1, column 1.
+	 * @param M12 Row 1, column 2.
+	 * @param M22 Row 2, column 2.
+	 * @return Descending eigenvalues with an orthonormal right-handed basis.
+	 */
+	FSymmetricEigen3 SolveSymmetricEigen3x3(float M00, float M01, float M02, float M11, float M12, float M22)
+	{
+		FSymmetricEigen3 Result;
+		if (!FMath::IsFinite(M00) || !FMath::IsFinite(M01) || !FMath::IsFinite(M02)
+			|| !FMath::IsFinite(M11) || !FMath::IsFinite(M12) || !FMath::IsFinite(M22))
+		{
+			return Result;
+		}
+
+		double A[3][3] = { { M00, M01, M02 }, { M01, M11, M12 }, { M02, M12, M22 } };
+		double V[3][3] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+
+		const double Norm2 = A[0][0] * A[0][0] + A[1][1] * A[1][1] + A[2][2] * A[2][2]
+			+ 2.0 * (A[0][1] * A[0][1] + A[0][2] * A[0][2] + A[1][2] * A[1][2]);
+		if (Norm2 == 0.0)
+		{
+			return Result;
+		}
+
+		for (int32 Sweep = 0; Sweep < MaxJacobiSweeps; ++Sweep)
+		{
+			const double OffDiag2 = A[0][1] * A[0][1] + A[0][2] * A[0][2] + A[1][2] * A[1][2];
+			if (OffDiag2 <= 1e-30 * Norm2)
+			{
+				break;
+			}
+
+			for (int32 P = 0; P < 2; ++P)
+			{
+				for (int32 Q = P + 1; Q < 3; ++Q)
+				{
+					const double Apq = A[P][Q];
+					if (Apq == 0.0)
+					{
+						continue;
+					}
+
+					// Smaller rotation angle that zeroes A[P][Q]
+					const double Theta = (A[Q][Q] - A[P][P]) / (2.0 * Apq);
+					const double T = (Theta >= 0.0 ? 1.0 : -1.0) / (FMath::Abs(Theta) + FMath::Sqrt(Theta * Theta + 1.0));
+					const double C = 1.0 / FMath::Sqrt(T * T + 1.0);
+					const double S = T * C;
+
+					for (int32 K = 0; K < 3; ++K)
+					{
+						const double Akp = A[K][P];
+						const double Akq = A[K][Q];
+						A[K][P] = C * Akp - S * Akq;
+						A[K][Q] = S * Akp + C * Akq;
+					}
+					for (int32 K = 0; K < 3; ++K)
+					{
+						const double Apk = A[P][K];
+						const double Aqk = A[Q][K];
+						A[P][K] = C * Apk - S * Aqk;
+						A[Q][K] = S * Apk + C * Aqk;
+					}
+					for (int32 K = 0; K < 3; ++K)
+					{
+						const double Vkp = V[K][P];
+						const double Vkq = V[K][Q];
+						V[K][P] = C * Vkp - S * Vkq;
+						V[K][Q] = S * Vkp + C * Vkq;
+					}
+					A[P][Q] = 0.0;
+					A[Q][P] = 0.0;
+				}
+			}
+		}
+
+		// Descending order (eigenvectors are the columns of V)
+		int32 Order[3] = { 0, 1, 2 };
+		Algo::Sort(Order, [&A](int32 L, int32 R) { return A[L][L] > A[R][R]; });
+
+		for (int32 k = 0; k < 3; ++k)
+		{
+			const int32 Column = Order[k];
+			Result.Values[k] = static_cast<float>(A[Column][Column]);
+			Result.Vectors[k] = FVector3f(static_cast<float>(V[0][Column]), static_cast<float>(V[1][Column]), static_cast<float>(V[2][Column])).GetSafeNormal();
+		}
+
+		// Re-orthogonalize in float and make the basis right-handed
+		Result.Vectors[1] = (Result.Vectors[1] - FVector3f::DotProduct(Result.Vectors[1], Result.Vectors[0]) * Result.Vectors[0]).GetSafeNormal();
+		Result.Vectors[2] = FVector3f::CrossProduct(Result.Vectors[0], Result.Vectors[1]);
+		return Result;
+	}
+
+	/**
+	 * @brief Orthonormal basis from a unit vector (Frisvad).
+	 * @param N Unit vector.
+	 * @param OutT First tangent.
+	 * @param OutB Second tangent.
+	 */
+	void BuildOrthonormalBasis(const FVector3f& N, FVector3f& OutT, FVector3f& OutB)
+	{
+		if (N.Z < -0.9999999f)
+		{
+			OutT = FVector3f(0.0f, -1.0f, 0.0f);
+			OutB = FVector3f(-1.0f, 0.0f, 0.0f);
+			return;
+		}
+
+		const float A = 1.0f / (1.0f + N.Z);
+		const float D = -N.X * N.Y * A;
+		OutT = FVector3f(1.0f - N.X * N.X * A, D, -N.X);
+		OutB = FVector3f(D, 1.0f - N.Y * N.Y * A, -N.Y);
+	}
+
+	/**
+	 * @brief Cubic spline weight of the anisotropy covariance.
+	 * @param Distance Distance (cm).
+	 * @param H Kernel radius (cm).
+	 * @return Weight in [0, 1].
+	 */
+	float KernelWeight(float Distance, float H)
+	{
+		if (Distance >= H)
+		{
+			return 0.0f;
+		}
+
+		const float Q = Distance / H;
+		if (Q < 0.5f)
+		{
+			return 1.0f - 6.0f * Q * Q + 6.0f * Q * Q * Q;
+		}
+
+		const float OneMinusQ = 1.0f - Q;
+		return 2.0f * OneMinusQ * OneMinusQ * OneMinusQ;
+	}
+}
+
+//=============================================================================
+// Solver
+//=============================================================================
+
+/**
+ * @brief Compute ellipsoids from positions, velocities and CSR neighbor lists.
+ * @param Params Anisotropy parameters.
+ * @param Positions Particle positions (cm).
+ * @param Velocities Particle velocities (cm/s).
+ * @param InNeighbors Neighbor lists (unused in velocity-based mode).
+ * @param SmoothingRadius Kernel radius (cm).
+ * @return True if new ellipsoids were computed.
+ */
+bool FKawaiiFluidAnisotropySolver::Update(const FKawaiiFluidAnisotropyParams& Params, TConstArrayView<FVector3f> Positions,
+	TConstArrayView<FVector3f> Velocities, const FKawaiiFluidNeighborCSR& InNeighbors, float SmoothingRadius)
+{
+	if (!ShouldUpdate(Params, Positions.Num()))
+	{
+		return false;
+	}
+
+	Compute(Params, Positions, Velocities, InNeighbors, SmoothingRadius);
+	return true;
+}
+
+/**
+ * @brief Compute ellipsoids from CPU particles; the neighbor CSR is only built when the update runs.
+ * @param Params Anisotropy parameters.
+ * @param Particles Particles with cached neighbor lists.
+ * @param SmoothingRadius Kernel radius (cm).
+ * @return True if new ellipsoids were computed.
+ */
+bool FKawaiiFluidAnisotropySolver::Update(const FKawaiiFluidAnisotropyParams& Params, const TArray<FKawaiiFluidParticle>& Particles, float SmoothingRadius)
+{
+	if (!ShouldUpdate(Params, Particles.Num()))
+	{
+		return false;
+	}
+
+	const int32 Num = Particles.Num();
+	PositionScratch.SetNumUninitialized(Num, EAllowShrinking::No);
+	VelocityScratch.SetNumUninitialized(Num, EAllowShrinking::No);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		PositionScratch[i] = FVector3f(Particles[i].Position);
+		VelocityScratch[i] = FVector3f(Particles[i].Velocity);
+	}
+
+	if (Params.Mode == EKawaiiFluidAnisotropyMode::VelocityBased)
+	{
+		Neighbors.Reset();
+	}
+	else
+	{
+		Neighbors.BuildFromParticles(Particles);
+	}
+
+	Compute(Params, PositionScratch, VelocityScratch, Neighbors, SmoothingRadius);
+	return true;
+}
+
+/**
+ * @brief Drop the results, the temporal history and the interval counter.
+ */
+void FKawaiiFluidAnisotropySolver::Reset()
+{
+	Axis1.Reset();
+	Axis2.Reset();
+	Axis3.Reset();
+	FramesSinceUpdate = 0;
+}
+
+/**
+ * @brief Copy the ellipsoids into an anisotropy snapshot.
+ * @param Frame Frame stamp of the snapshot.
+ * @return Snapshot with the current axes.
+ */
+TSharedRef<FKawaiiFluidAnisotropySnapshot> FKawaiiFluidAnisotropySolver::MakeSnapshot(uint64 Frame) const
+{
+	TSharedRef<FKawaiiFluidAnisotropySnapshot> Snapshot = MakeShared<FKawaiiFluidAnisotropySnapshot>();
+	Snapshot->Frame = Frame;
+	Snapshot->Axis1 = Axis1;
+	Snapshot->Axis2 = Axis2;
+	Snapshot->Axis3 = Axis3;
+	return Snapshot;
+}
+
+/**
+ * @brief Advance the UpdateInterval counter like the GPU frame counter.
+ * @param Params Anisotropy parameters.
+ * @param Num Particle count.
+ * @return True if this call computes (interval elapsed, first call or count changed).
+ */
+bool FKawaiiFluidAnisotropySolver::ShouldUpdate(const FKawaiiFluidAnisotropyParams& Params, int32 Num)
+{
+	if (!Params.bEnabled || Num == 0)
+	{
+		Reset();
+		return false;
+	}
+
+	if (Axis1.Num() == Num && ++FramesSinceUpdate < FMath::Max(1, Params.UpdateInterval))
+	{
+		return false;
+	}
+
+	FramesSinceUpdate = 0;
+	return true;
+}
+
+/**
+ * @brief Per-particle ellipsoids in parallel, smoothed against the previous result of the same index.
+ * @param Params Anisotropy parameters.
+ * @param Positions Particle positions (cm).
+ * @param Velocities Particle velocities (cm/s).
+ * @param InNeighbors Neighbor lists.
+ * @param SmoothingRadius Kernel radius (cm).
+ */
+void FKawaiiFluidAnisotropySolver::Compute(const FKawaiiFluidAnisotropyParams& Params, TConstArrayView<FVector3f> Positions,
+	TConstArrayView<FVector3f> Velocities, const FKawaiiFluidNeighborCSR& InNeighbors, float SmoothingRadius)
+{
+	const int32 Num = Positions.Num();
+	const bool bNeedsNeighbors = Params.Mode != EKawaiiFluidAnisotropyMode::VelocityBased;
+	check(Velocities.Num() == Num);
+	check(!bNeedsNeighbors || InNeighbors.Num() == Num);
+
+	// History is per index, like the persistent GPU buffers; a count change drops it
+	const bool bSmooth = Params.bEnableTemporalSmoothing && Axis1.Num() == Num;
+	Axis1.SetNumUninitialized(Num, EAllowShrinking::No);
+	Axis2.SetNumUninitialized(Num, EAllowShrinking::No);
+	Axis3.SetNumUninitialized(Num, EAllowShrinking::No);
+
+	ParallelFor(Num, [&](int32 i)
+	{
+		FEllipsoid Ellipsoid;
+		switch (Params.Mode)
+		{
+		case EKawaiiFluidAnisotropyMode::VelocityBased:
+			Ellipsoid = ComputeVelocityBased(Velocities[i], Params);
+			break;
+		case EKawaiiFluidAnisotropyMode::DensityBased:
+			Ellipsoid = ComputeDensityBased(i, Positions, InNeighbors, SmoothingRadius, Params);
+			break;
+		default:
+			Ellipsoid = BlendHybrid(
+				ComputeDensityBased(i, Positions, InNeighbors, SmoothingRadius, Params),
+				ComputeVelocityBased(Velocities[i], Params),
+				Params);
+			break;
+		}
+
+		if (bSmooth)
+		{
+			const FVector4f Prev[3] = { Axis1[i], Axis2[i], Axis3[i] };
+			ApplyTemporalSmoothing(Ellipsoid, Prev, Params.TemporalSmoothFactor);
+		}
+
+		Axis1[i] = FVector4f(Ellipsoid.Axes[0], Ellipsoid.Scales[0]);
+		Axis2[i] = FVector4f(Ellipsoid.Axes[1], Ellipsoid.Scales[1]);
+		Axis3[i] = FVector4f(Ellipsoid.Axes[2], Ellipsoid.Scales[2]);
+	}, Num < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
@@ -77,8 +77,9 @@ void FKawaiiFluidDensityConstraint::ResizeSoAArrays(int32 NumParticles)
 /**
  * @brief Copies particle position and mass data from the AOS (Array of Structures) to the SoA buffers.
  * @param Particles Source particle array.
+ * @param NumSolved Particles the solver corrects; read-only neighbors after them also copy their Lambda.
  */
-void FKawaiiFluidDensityConstraint::CopyToSoA(const TArray<FKawaiiFluidParticle>& Particles)
+void FKawaiiFluidDensityConstraint::CopyToSoA(const TArray<FKawaiiFluidParticle>& Particles, int32 NumSolved)
 {
 	ParallelFor(Particles.Num(), [&](int32 i)
 	{
@@ -87,16 +88,22 @@ void FKawaiiFluidDensityConstraint::CopyToSoA(const TArray<FKawaiiFluidParticle>
 		PosY[i] = P.PredictedPosition.Y;
 		PosZ[i] = P.PredictedPosition.Z;
 		Masses[i] = P.Mass;
+
+		if (i >= NumSolved)
+		{
+			Lambdas[i] = P.Lambda;
+		}
 	});
 }
 
 /**
  * @brief Applies calculated position corrections and updates density/lambda in the AOS from SoA buffers.
  * @param Particles Target particle array to update.
+ * @param NumSolved Particles to update (read-only neighbors after them are left untouched).
  */
-void FKawaiiFluidDensityConstraint::ApplyFromSoA(TArray<FKawaiiFluidParticle>& Particles)
+void FKawaiiFluidDensityConstraint::ApplyFromSoA(TArray<FKawaiiFluidParticle>& Particles, int32 NumSolved)
 {
-	ParallelFor(Particles.Num(), [&](int32 i)
+	ParallelFor(NumSolved, [&](int32 i)
 	{
 		FKawaiiFluidParticle& P = Particles[i];
 		P.PredictedPosition.X += DeltaPX[i];
@@ -118,43 +125,12 @@ void FKawaiiFluidDensityConstraint::ApplyFromSoA(TArray<FKawaiiFluidParticle>& P
  * @param InRestDensity Target rest density.
  * @param InCompliance Constraint compliance (stiffness).
  * @param DeltaTime Substep time interval.
+ * @param NumSolved Leading particles to correct, the rest are read-only neighbors (INDEX_NONE = all).
  */
-void FKawaiiFluidDensityConstraint::Solve(TArray<FKawaiiFluidParticle>& Particles, float InSmoothingRadius, float InRestDensity, float InCompliance, float DeltaTime)
+void FKawaiiFluidDensityConstraint::Solve(TArray<FKawaiiFluidParticle>& Particles, float InSmoothingRadius, float InRestDensity, float InCompliance, float DeltaTime, int32 NumSolved)
 {
-	SmoothingRadius = InSmoothingRadius;
-	RestDensity = InRestDensity;
-
-	// XPBD: α̃ = α / dt²
-	const float DtSq = DeltaTime * DeltaTime;
-	Epsilon = InCompliance / FMath::Max(DtSq, 1e-8f);
-
-	const int32 NumParticles = Particles.Num();
-	if (NumParticles == 0) return;
-
-	// 1. Prepare SoA
-	ResizeSoAArrays(NumParticles);
-	CopyToSoA(Particles);
-
-	// 2. Compute kernel coefficients
-	const float h = SmoothingRadius * CM_TO_M;
-	const float h2 = h * h;
-	const float h6 = h2 * h2 * h2;
-	const float h9 = h6 * h2 * h;
-
-	FSPHKernelCoeffs Coeffs;
-	Coeffs.h = h;
-	Coeffs.h2 = h2;
-	Coeffs.Poly6Coeff = 315.0f / (64.0f * PI * h9);
-	Coeffs.SpikyCoeff = -45.0f / (PI * h6);
-	Coeffs.InvRestDensity = 1.0f / RestDensity;
-	Coeffs.SmoothingRadiusSq = SmoothingRadius * SmoothingRadius;
-
-	// 3. SIMD computation
-	ComputeDensityAndLambda_SIMD(Particles, Coeffs);
-	ComputeDeltaP_SIMD(Particles, Coeffs);
-
-	// 4. Apply results
-	ApplyFromSoA(Particles);
+	EvaluateDensities(Particles, InSmoothingRadius, InRestDensity, InCompliance, DeltaTime, FTensileInstabilityParams(), NumSolved);
+	ApplyCorrections(Particles, true);
 }
 
 //========================================
@@ -169,6 +145,7 @@ void FKawaiiFluidDensityConstraint::Solve(TArray<FKawaiiFluidParticle>& Particle
  * @param InCompliance Constraint compliance.
  * @param DeltaTime Substep time interval.
  * @param TensileParams Parameters for the artificial pressure correction.
+ * @param NumSolved Leading particles to correct, the rest are read-only neighbors (INDEX_NONE = all).
  */
 void FKawaiiFluidDensityConstraint::SolveWithTensileCorrection(
 	TArray<FKawaiiFluidParticle>& Particles,
@@ -176,7 +153,39 @@ void FKawaiiFluidDensityConstraint::SolveWithTensileCorrection(
 	float InRestDensity,
 	float InCompliance,
 	float DeltaTime,
-	const FTensileInstabilityParams& TensileParams)
+	const FTensileInstabilityParams& TensileParams,
+	int32 NumSolved)
+{
+	EvaluateDensities(Particles, InSmoothingRadius, InRestDensity, InCompliance, DeltaTime, TensileParams, NumSolved);
+	ApplyCorrections(Particles, true);
+}
+
+//========================================
+// Split Solver (convergence check between the halves)
+//========================================
+
+/**
+ * @brief First half of an iteration: densities and Lambdas at the current predicted positions.
+ *
+ * GetDensities then holds the density error of the positions as they are now, i.e. after the
+ * previous iteration's correction, and ApplyCorrections finishes (or abandons) the iteration.
+ *
+ * @param Particles Particle array (read only).
+ * @param InSmoothingRadius Interaction radius (cm).
+ * @param InRestDensity Target rest density.
+ * @param InCompliance Constraint compliance.
+ * @param DeltaTime Substep time interval.
+ * @param TensileParams Parameters for the artificial pressure correction (bEnabled = false for none).
+ * @param NumSolved Leading particles to correct, the rest are read-only neighbors (INDEX_NONE = all).
+ */
+void FKawaiiFluidDensityConstraint::EvaluateDensities(
+	const TArray<FKawaiiFluidParticle>& Particles,
+	float InSmoothingRadius,
+	float InRestDensity,
+	float InCompliance,
+	float DeltaTime,
+	const FTensileInstabilityParams& TensileParams,
+	int32 NumSolved)
 {
 	SmoothingRadius = InSmoothingRadius;
 	RestDensity = InRestDensity;
@@ -186,11 +195,12 @@ void FKawaiiFluidDensityConstraint::SolveWithTensileCorrection(
 	Epsilon = InCompliance / FMath::Max(DtSq, 1e-8f);
 
 	const int32 NumParticles = Particles.Num();
+	PendingNumSolved = NumSolved == INDEX_NONE ? NumParticles : FMath::Min(NumSolved, NumParticles);
 	if (NumParticles == 0) return;
 
 	// 1. Prepare SoA
 	ResizeSoAArrays(NumParticles);
-	CopyToSoA(Particles);
+	CopyToSoA(Particles, PendingNumSolved);
 
 	// 2. Compute kernel coefficients
 	const float h = SmoothingRadius * CM_TO_M;
@@ -198,16 +208,15 @@ void FKawaiiFluidDensityConstraint::SolveWithTensileCorrection(
 	const float h6 = h2 * h2 * h2;
 	const float h9 = h6 * h2 * h;
 
-	FSPHKernelCoeffs Coeffs;
-	Coeffs.h = h;
-	Coeffs.h2 = h2;
-	Coeffs.Poly6Coeff = 315.0f / (64.0f * PI * h9);
-	Coeffs.SpikyCoeff = -45.0f / (PI * h6);
-	Coeffs.InvRestDensity = 1.0f / RestDensity;
-	Coeffs.SmoothingRadiusSq = SmoothingRadius * SmoothingRadius;
+	PendingCoeffs.h = h;
+	PendingCoeffs.h2 = h2;
+	PendingCoeffs.Poly6Coeff = 315.0f / (64.0f * PI * h9);
+	PendingCoeffs.SpikyCoeff = -45.0f / (PI * h6);
+	PendingCoeffs.InvRestDensity = 1.0f / RestDensity;
+	PendingCoeffs.SmoothingRadiusSq = SmoothingRadius * SmoothingRadius;
 
 	// 3. Configure Tensile Instability parameters
-	Coeffs.TensileParams = TensileParams;
+	PendingCoeffs.TensileParams = TensileParams;
 	if (TensileParams.bEnabled)
 	{
 		// Precompute W(Δq, h) - using Poly6 kernel
@@ -215,15 +224,33 @@ void FKawaiiFluidDensityConstraint::SolveWithTensileCorrection(
 		const float DeltaQ_m = TensileParams.DeltaQ * h;
 		const float DeltaQ2 = DeltaQ_m * DeltaQ_m;
 		const float Diff = h2 - DeltaQ2;
-		Coeffs.TensileParams.W_DeltaQ = Coeffs.Poly6Coeff * Diff * Diff * Diff;
+		PendingCoeffs.TensileParams.W_DeltaQ = PendingCoeffs.Poly6Coeff * Diff * Diff * Diff;
 	}
 
 	// 4. SIMD computation
-	ComputeDensityAndLambda_SIMD(Particles, Coeffs);
-	ComputeDeltaP_SIMD(Particles, Coeffs);
+	ComputeDensityAndLambda_SIMD(Particles, PendingCoeffs, PendingNumSolved);
+}
+
+/**
+ * @brief Second half of an iteration: position corrections from the evaluated Lambdas.
+ * @param Particles In/Out particle array passed to EvaluateDensities.
+ * @param bApplyCorrection False = only store the evaluated densities (converged, iteration abandoned).
+ */
+void FKawaiiFluidDensityConstraint::ApplyCorrections(TArray<FKawaiiFluidParticle>& Particles, bool bApplyCorrection)
+{
+	if (Particles.Num() == 0) return;
 
-	// 5. Apply results
-	ApplyFromSoA(Particles);
+	if (!bApplyCorrection)
+	{
+		ParallelFor(PendingNumSolved, [&](int32 i)
+		{
+			Particles[i].Density = Densities[i];
+		});
+		return;
+	}
+
+	ComputeDeltaP_SIMD(Particles, PendingCoeffs, PendingNumSolved);
+	ApplyFromSoA(Particles, PendingNumSolved);
 }
 
 //========================================
@@ -233,13 +260,14 @@ void FKawaiiFluidDensityConstraint::SolveWithTensileCorrection(
  * @brief Calculate particle densities and Lagrange multipliers (Lambdas) using SIMD optimization.
  * 
  * Processes 4 particles at a time using SSE/NEON instructions.
- * Implements the XPBD Lagrange multiplier update rule.
+ * Implements the XPBD Lagrange multiplier update rule. Only the first NumSolved particles are evaluated.
  */
 void FKawaiiFluidDensityConstraint::ComputeDensityAndLambda_SIMD(
 	const TArray<FKawaiiFluidParticle>& Particles,
-	const FSPHKernelCoeffs& Coeffs)
+	const FSPHKernelCoeffs& Coeffs,
+	int32 NumSolved)
 {
-	const int32 NumParticles = Particles.Num();
+	const int32 NumParticles = NumSolved;
 
 	// RESTRICT pointers
 	const float* RESTRICT PosXPtr = PosX.GetData();
@@ -433,12 +461,14 @@ void FKawaiiFluidDensityConstraint::ComputeDensityAndLambda_SIMD(
  * @brief Calculate position corrections (DeltaP) based on particle Lambdas using SIMD.
  * 
  * Implements tensile instability correction (scorr) if enabled in the coefficients.
+ * Only the first NumSolved particles are corrected.
  */
 void FKawaiiFluidDensityConstraint::ComputeDeltaP_SIMD(
 	const TArray<FKawaiiFluidParticle>& Particles,
-	const FSPHKernelCoeffs& Coeffs)
+	const FSPHKernelCoeffs& Coeffs,
+	int32 NumSolved)
 {
-	const int32 NumParticles = Particles.Num();
+	const int32 NumParticles = NumSolved;
 
 	const float* RESTRICT PosXPtr = PosX.GetData();
 	const float* RESTRICT PosYPtr = PosY.GetData();
@@ -0,0 +1,1490 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Physics/KawaiiFluidGPUReferenceSolver.h"
+#include "Simulation/Shaders/KawaiiFluidSimulatorShaders.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	// KawaiiFluidParticleCore.ush
+	constexpr float GPUSmallNumber = 0.0001f;
+	constexpr float CM_TO_M = 0.01f;
+	constexpr float CM_TO_M_SQ = 0.0001f;
+	constexpr uint32 MaxNeighbors = GPU_MAX_NEIGHBORS_PER_PARTICLE;
+
+	// KawaiiFluidSimulationPredict.usf
+	constexpr float LaplacianViscosityScale = 0.0001f;
+	constexpr float VelocityDragScale = 5.0f;
+
+	/** Particles below which a pass runs on the calling thread */
+	constexpr int32 MinParallelParticles = 1024;
+
+	EParallelForFlags GetForFlags(int32 NumParticles)
+	{
+		return NumParticles >= MinParallelParticles ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+	}
+
+	//========================================
+	// HLSL intrinsics
+	//========================================
+
+	float Saturate(float X)
+	{
+		return FMath::Clamp(X, 0.0f, 1.0f);
+	}
+
+	/** step(Edge, X) */
+	float Step(float Edge, float X)
+	{
+		return X >= Edge ? 1.0f : 0.0f;
+	}
+
+	float RSqrt(float X)
+	{
+		return 1.0f / FMath::Sqrt(X);
+	}
+
+	/** normalize() without the zero-length guard of GetSafeNormal */
+	FVector3f Normalize(const FVector3f& V)
+	{
+		return V * RSqrt(V.SizeSquared());
+	}
+
+	bool HasFlag(uint32 Flags, uint32 Flag)
+	{
+		return (Flags & Flag) != 0;
+	}
+
+	FVector3f RotateByQuat(const FVector3f& V, const FVector4f& Q)
+	{
+		const FVector3f QV(Q.X, Q.Y, Q.Z);
+		const FVector3f T = 2.0f * FVector3f::CrossProduct(QV, V);
+		return V + Q.W * T + FVector3f::CrossProduct(QV, T);
+	}
+
+	FVector3f InverseRotateByQuat(const FVector3f& V, const FVector4f& Q)
+	{
+		return RotateByQuat(V, FVector4f(-Q.X, -Q.Y, -Q.Z, Q.W));
+	}
+
+	//========================================
+	// Kernels (KawaiiFluidParticleCore.ush)
+	//========================================
+
+	float Poly6Kernel(float R2, float H2)
+	{
+		const float Diff = H2 - R2;
+		return Diff > 0.0f ? Diff * Diff * Diff : 0.0f;
+	}
+
+	FVector3f SpikyGradientFast(const FVector3f& R, float R2, float H)
+	{
+		if (R2 < GPUSmallNumber * GPUSmallNumber)
+		{
+			return FVector3f::ZeroVector;
+		}
+
+		const float RLenInv = RSqrt(R2);
+		const float RLen = R2 * RLenInv;
+		const float Diff = H - RLen;
+		if (Diff <= 0.0f)
+		{
+			return FVector3f::ZeroVector;
+		}
+
+		return (R * RLenInv) * (Diff * Diff);
+	}
+
+	float ViscosityLaplacian(float RLen, float H, float Coeff)
+	{
+		const float Diff = H - RLen;
+		return Diff > 0.0f ? Coeff * Diff : 0.0f;
+	}
+
+	float AkinciCohesionSpline(float RLen, float H)
+	{
+		if (RLen > H || RLen < GPUSmallNumber)
+		{
+			return 0.0f;
+		}
+
+		const float H2 = H * H;
+		const float H3 = H2 * H;
+		const float H6 = H3 * H3;
+		const float H9 = H6 * H3;
+		const float Coeff = 32.0f / (PI * H9);
+
+		const float Diff = H - RLen;
+		const float Diff3 = Diff * Diff * Diff;
+		const float R3 = RLen * RLen * RLen;
+
+		if (RLen > H * 0.5f)
+		{
+			return Coeff * Diff3 * R3;
+		}
+		return Coeff * (2.0f * Diff3 * R3 - H6 / 64.0f);
+	}
+
+	//========================================
+	// SDFs (KawaiiFluidCollisionPrimitives.ush)
+	//========================================
+
+	float SdSphere(const FVector3f& P, const FGPUCollisionSphere& Sphere)
+	{
+		return (P - Sphere.Center).Size() - Sphere.Radius;
+	}
+
+	float SdCapsule(const FVector3f& P, const FGPUCollisionCapsule& Capsule)
+	{
+		const FVector3f PA = P - Capsule.Start;
+		const FVector3f BA = Capsule.End - Capsule.Start;
+		const float H = Saturate(FVector3f::DotProduct(PA, BA) / FVector3f::DotProduct(BA, BA));
+		return (PA - BA * H).Size() - Capsule.Radius;
+	}
+
+	float SdBox(const FVector3f& P, const FGPUCollisionBox& Box)
+	{
+		const FVector3f LocalP = InverseRotateByQuat(P - Box.Center, Box.Rotation);
+		const FVector3f Q = LocalP.GetAbs() - Box.Extent;
+		const FVector3f Outside(FMath::Max(Q.X, 0.0f), FMath::Max(Q.Y, 0.0f), FMath::Max(Q.Z, 0.0f));
+		return Outside.Size() + FMath::Min(FMath::Max(Q.X, FMath::Max(Q.Y, Q.Z)), 0.0f);
+	}
+
+	float SdConvex(const FVector3f& P, const FGPUCollisionConvex& Convex, const TArray<FGPUConvexPlane>& Planes)
+	{
+		if ((P - Convex.Center).Size() - Convex.BoundingRadius > 0.0f)
+		{
+			return 1000.0f;
+		}
+
+		float MaxDist = -1e10f;
+		for (int32 PlaneIndex = 0; PlaneIndex < Convex.PlaneCount; ++PlaneIndex)
+		{
+			const FGPUConvexPlane& Plane = Planes[Convex.PlaneStartIndex + PlaneIndex];
+			MaxDist = FMath::Max(MaxDist, FVector3f::DotProduct(P, Plane.Normal) - Plane.Distance);
+		}
+		return MaxDist;
+	}
+
+	/**
+	 * @brief Central-difference SDF normal (CalcNumericalGradient_*).
+	 * @param P Query point.
+	 * @param Sdf Signed distance function of the primitive.
+	 * @return Normalized gradient.
+	 */
+	template <typename SdfType>
+	FVector3f CalcNumericalGradient(const FVector3f& P, SdfType&& Sdf)
+	{
+		constexpr float Eps = 0.1f;
+		const FVector3f Gradient(
+			Sdf(P + FVector3f(Eps, 0, 0)) - Sdf(P - FVector3f(Eps, 0, 0)),
+			Sdf(P + FVector3f(0, Eps, 0)) - Sdf(P - FVector3f(0, Eps, 0)),
+			Sdf(P + FVector3f(0, 0, Eps)) - Sdf(P - FVector3f(0, 0, Eps)));
+		return Normalize(Gradient);
+	}
+
+	//========================================
+	// Collision response
+	//========================================
+
+	/**
+	 * @brief Push-out, position-level friction and restitution of one bounds axis (ApplyAxisFriction).
+	 */
+	void ApplyAxisFriction(FVector3f& PredictedPos, const FVector3f& OriginalPos, const FVector3f& Normal, float Penetration,
+		FVector3f& Vel, float Friction, float Restitution)
+	{
+		PredictedPos += Normal * Penetration;
+
+		const FVector3f DeltaX = PredictedPos - OriginalPos;
+		const FVector3f DeltaXNormalVector = FVector3f::DotProduct(DeltaX, Normal) * Normal;
+		FVector3f DeltaXTangent = DeltaX - DeltaXNormalVector;
+		const float TangentLength = DeltaXTangent.Size();
+
+		if (TangentLength > GPUSmallNumber)
+		{
+			const float FrictionReferenceDistance = FMath::Max(Penetration, 0.1f);
+			if (TangentLength < Friction * FrictionReferenceDistance)
+			{
+				DeltaXTangent = FVector3f::ZeroVector;
+			}
+			else
+			{
+				DeltaXTangent *= (1.0f - FMath::Min(Friction * FrictionReferenceDistance / TangentLength, 1.0f));
+			}
+		}
+
+		PredictedPos = OriginalPos + DeltaXNormalVector + DeltaXTangent;
+
+		const float VelocityAlongNormal = FVector3f::DotProduct(Vel, Normal);
+		if (VelocityAlongNormal < 0.0f)
+		{
+			Vel -= (1.0f + Restitution) * VelocityAlongNormal * Normal;
+		}
+	}
+
+	/**
+	 * @brief Six-sided box response in box space, shared by the AABB and OBB bounds modes.
+	 * @return True if the floor (-Z face) was hit.
+	 */
+	bool ApplyBoxBounds(FVector3f& Pos, FVector3f OriginalPos, FVector3f& Vel, const FVector3f& EffectiveMin,
+		const FVector3f& EffectiveMax, float Friction, float Restitution)
+	{
+		// X and Y hits move the friction reference so the next axis does not undo them
+		for (int32 Axis = 0; Axis < 2; ++Axis)
+		{
+			FVector3f Normal = FVector3f::ZeroVector;
+			if (Pos[Axis] < EffectiveMin[Axis])
+			{
+				Normal[Axis] = 1.0f;
+				ApplyAxisFriction(Pos, OriginalPos, Normal, EffectiveMin[Axis] - Pos[Axis], Vel, Friction, Restitution);
+				OriginalPos = Pos;
+			}
+			else if (Pos[Axis] > EffectiveMax[Axis])
+			{
+				Normal[Axis] = -1.0f;
+				ApplyAxisFriction(Pos, OriginalPos, Normal, Pos[Axis] - EffectiveMax[Axis], Vel, Friction, Restitution);
+				OriginalPos = Pos;
+			}
+		}
+
+		if (Pos.Z < EffectiveMin.Z)
+		{
+			ApplyAxisFriction(Pos, OriginalPos, FVector3f(0, 0, 1), EffectiveMin.Z - Pos.Z, Vel, Friction, Restitution);
+			return true;
+		}
+		if (Pos.Z > EffectiveMax.Z)
+		{
+			ApplyAxisFriction(Pos, OriginalPos, FVector3f(0, 0, -1), Pos.Z - EffectiveMax.Z, Vel, Friction, Restitution);
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Primitive response (ApplyCollisionResponseWithFriction): push-out with 0.1 cm skin, friction, restitution.
+	 */
+	void ApplyCollisionResponseWithFriction(FVector3f& PredictedPos, const FVector3f& OriginalPos, FVector3f& Vel,
+		const FVector3f& Normal, float Penetration, float Friction, float Restitution)
+	{
+		PredictedPos += Normal * (Penetration + 0.1f);
+
+		const FVector3f DeltaX = PredictedPos - OriginalPos;
+		const FVector3f DeltaXNormalVec = FVector3f::DotProduct(DeltaX, Normal) * Normal;
+		FVector3f DeltaXTangent = DeltaX - DeltaXNormalVec;
+		const float TangentLength = DeltaXTangent.Size();
+
+		if (TangentLength > GPUSmallNumber)
+		{
+			const float D = FMath::Max(Penetration, 0.1f);
+			if (TangentLength < Friction * D)
+			{
+				DeltaXTangent = FVector3f::ZeroVector;
+			}
+			else
+			{
+				DeltaXTangent *= (1.0f - FMath::Min(Friction * D / TangentLength, 1.0f));
+			}
+		}
+
+		PredictedPos = OriginalPos + DeltaXNormalVec + DeltaXTangent;
+
+		const float VelNormal = FVector3f::DotProduct(Vel, Normal);
+		if (VelNormal < 0.0f)
+		{
+			Vel -= (1.0f + Restitution) * VelNormal * Normal;
+		}
+	}
+
+	/**
+	 * @brief Resize a buffer the GPU keeps across frames, zeroing only newly added elements.
+	 */
+	void GrowPersistent(TArray<uint32>& Buffer, int32 Num)
+	{
+		if (Buffer.Num() < Num)
+		{
+			Buffer.SetNumZeroed(Num, EAllowShrinking::No);
+		}
+	}
+
+	template <typename ElementType>
+	void CopyInto(TArray<ElementType>& Dest, const TArray<ElementType>& Source)
+	{
+		Dest.SetNumUninitialized(Source.Num(), EAllowShrinking::No);
+		FMemory::Memcpy(Dest.GetData(), Source.GetData(), Source.Num() * sizeof(ElementType));
+	}
+}
+
+/**
+ * @brief Construct a solver with empty neighbor cache and cells.
+ * @param InConfig Simulator state.
+ */
+FKawaiiFluidGPUReferenceSolver::FKawaiiFluidGPUReferenceSolver(const FKawaiiFluidGPUReferenceConfig& InConfig)
+	: Config(InConfig)
+{
+}
+
+/**
+ * @brief Set the heightmap collision input.
+ * @param InParams Same parameters as the GPU pass.
+ * @param InHeights Normalized heights, row-major TextureWidth x TextureHeight (rows along V).
+ */
+void FKawaiiFluidGPUReferenceSolver::SetHeightmap(const FGPUHeightmapCollisionParams& InParams, TArray<float> InHeights)
+{
+	HeightmapParams = InParams;
+	HeightmapHeights = MoveTemp(InHeights);
+}
+
+//=============================================================================
+// Substep
+//=============================================================================
+
+/**
+ * @brief Run one GPU substep (Z-order path) on the particle buffer.
+ * @param Particles Particle buffer, left in sorted order like the GPU buffer.
+ * @param Params Simulation parameters of the substep (kernel coefficients precomputed).
+ */
+void FKawaiiFluidGPUReferenceSolver::SimulateSubstep(TArray<FGPUFluidParticle>& Particles, const FGPUFluidSimulationParams& Params)
+{
+	if (Particles.Num() == 0)
+	{
+		return;
+	}
+
+	PredictPositions(Particles, Params);
+	SortParticles(Particles, Params);
+	SplitToSoA(Particles);
+
+	for (int32 Iteration = 0; Iteration < Params.SolverIterations; ++Iteration)
+	{
+		SolveDensityPressure(Iteration, Params);
+
+		if (!Params.bSkipBoundsCollision)
+		{
+			ApplyBoundsCollision(Params);
+		}
+		ApplyPrimitiveCollision(Params);
+		ApplyHeightmapCollision(Params);
+	}
+
+	FinalizePositions(Params);
+	MergeToAoS(Particles, Params);
+
+	if (Config.bRunSleepingPass && Params.bEnableParticleSleeping)
+	{
+		UpdateSleeping(Particles, Params);
+	}
+}
+
+/**
+ * @brief Make this frame's neighbor cache the one PredictPositions reads next frame.
+ */
+void FKawaiiFluidGPUReferenceSolver::EndFrame()
+{
+	if (NeighborParticleCounts[WriteBufferIndex] == 0)
+	{
+		bPrevNeighborCacheValid = false;
+		return;
+	}
+
+	WriteBufferIndex = 1 - WriteBufferIndex;
+	bPrevNeighborCacheValid = true;
+}
+
+/**
+ * @brief Drop the neighbor cache, cell table and sleep counters.
+ */
+void FKawaiiFluidGPUReferenceSolver::Reset()
+{
+	for (int32 BufferIndex = 0; BufferIndex < 2; ++BufferIndex)
+	{
+		NeighborLists[BufferIndex].Reset();
+		CachedNeighborCounts[BufferIndex].Reset();
+		NeighborParticleCounts[BufferIndex] = 0;
+	}
+	WriteBufferIndex = 0;
+	bPrevNeighborCacheValid = false;
+
+	CellStart.Reset();
+	CellEnd.Reset();
+	TouchedCells.Reset();
+	BrickGrid.Reset();
+	SleepCounters.Reset();
+}
+
+//=============================================================================
+// Predict Positions (KawaiiFluidSimulationPredict.usf)
+//=============================================================================
+
+/**
+ * @brief Gravity, external force, cohesion and viscosity from last frame's neighbor cache, then prediction.
+ * @param Particles Particle buffer (AoS).
+ * @param Params Simulation parameters.
+ */
+void FKawaiiFluidGPUReferenceSolver::PredictPositions(TArray<FGPUFluidParticle>& Particles, const FGPUFluidSimulationParams& Params)
+{
+	const int32 NumParticles = Particles.Num();
+	if (NumParticles == 0)
+	{
+		return;
+	}
+
+	const int32 ReadIndex = 1 - WriteBufferIndex;
+	const bool bUsePrevNeighborCache = bPrevNeighborCacheValid && NeighborParticleCounts[ReadIndex] > 0;
+	const int32 PrevParticleCount = bUsePrevNeighborCache ? NeighborParticleCounts[ReadIndex] : 0;
+	const uint32* PrevNeighborList = NeighborLists[ReadIndex].GetData();
+	const uint32* PrevNeighborCounts = CachedNeighborCounts[ReadIndex].GetData();
+
+	// Neighbor velocities are read before any thread writes its own
+	VelocitySnapshot.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		VelocitySnapshot[i] = Particles[i].Velocity;
+	}
+
+	const float HM = Params.SmoothingRadius * CM_TO_M;
+	const float H2 = HM * HM;
+	const float SmoothingRadiusSqCm = Params.SmoothingRadius * Params.SmoothingRadius;
+	const float MaxCohesionForce = Params.CohesionStrength * Params.RestDensity * HM * HM * HM * 1000.0f;
+	const float H6 = HM * HM * HM * HM * HM * HM;
+	const float ViscLaplacianCoeff = 45.0f / (PI * H6);
+	const float DeltaTime = Params.DeltaTime;
+
+	ParallelFor(NumParticles, [&](int32 Idx)
+	{
+		FGPUFluidParticle& Particle = Particles[Idx];
+
+		const float AttachedMask = HasFlag(Particle.Flags, EGPUParticleFlags::IsAttached) ? 1.0f : 0.0f;
+		const float ActiveMask = 1.0f - AttachedMask;
+		const float CacheValid = (bUsePrevNeighborCache ? 1.0f : 0.0f) * ActiveMask;
+		const float CohesionStrength = Params.CohesionStrength * CacheValid;
+
+		FVector3f Velocity = Particle.Velocity;
+
+		// Force accumulation over the cached neighbors of last frame
+		FVector3f CohesionForce = FVector3f::ZeroVector;
+		FVector3f ViscosityCorrection = FVector3f::ZeroVector;
+		FVector3f LaplacianForce = FVector3f::ZeroVector;
+		float WeightSum = 0.0f;
+
+		const float MI = Particle.Mass;
+		const float RhoI = FMath::Max(Particle.Density, GPUSmallNumber);
+		const uint32 CachedCount = Idx < PrevParticleCount ? PrevNeighborCounts[Idx] : 0;
+		const uint32 BaseIdx = static_cast<uint32>(Idx) * MaxNeighbors;
+
+		for (uint32 N = 0; N < CachedCount; ++N)
+		{
+			const uint32 NeighborIdx = PrevNeighborList[BaseIdx + N];
+			const uint32 SafeNeighborIdx = FMath::Min(NeighborIdx, static_cast<uint32>(NumParticles - 1));
+			const FGPUFluidParticle& Neighbor = Particles[SafeNeighborIdx];
+
+			float ValidMask = (NeighborIdx != static_cast<uint32>(Idx) ? 1.0f : 0.0f)
+				* (NeighborIdx < static_cast<uint32>(NumParticles) ? 1.0f : 0.0f)
+				* (HasFlag(Neighbor.Flags, EGPUParticleFlags::IsAttached) ? 0.0f : 1.0f);
+
+			const FVector3f RCm = Particle.Position - Neighbor.Position;
+			const float R2Cm = FVector3f::DotProduct(RCm, RCm);
+			ValidMask *= Step(GPUSmallNumber, R2Cm) * Step(R2Cm, SmoothingRadiusSqCm);
+
+			const float SafeR2Cm = FMath::Max(R2Cm, GPUSmallNumber);
+			const float RLenInvCm = RSqrt(SafeR2Cm);
+			const float DistM = SafeR2Cm * RLenInvCm * CM_TO_M;
+			const float R2M = DistM * DistM;
+			ValidMask *= Step(DistM + GPUSmallNumber, HM);
+
+			const float MJ = Neighbor.Mass;
+			const float RhoJ = FMath::Max(Neighbor.Density, GPUSmallNumber);
+			const float K_ij = FMath::Clamp((2.0f * Params.RestDensity) / (RhoI + RhoJ), 0.5f, 2.0f);
+
+			const FVector3f Direction = -RCm * RLenInvCm;
+			const float ForceMag = MI * MJ * AkinciCohesionSpline(DistM, HM);
+			CohesionForce += K_ij * CohesionStrength * ForceMag * Direction * ValidMask;
+
+			const float W = Poly6Kernel(R2M, H2) * Params.Poly6Coeff;
+			const FVector3f VelDiff = VelocitySnapshot[SafeNeighborIdx] - Velocity;
+			ViscosityCorrection += VelDiff * W * ValidMask;
+			WeightSum += W * ValidMask;
+
+			const float Laplacian = ViscosityLaplacian(DistM, HM, ViscLaplacianCoeff);
+			LaplacianForce += VelDiff * Laplacian * MJ / FMath::Max(Neighbor.Density, 0.001f) * ValidMask;
+		}
+
+		const float ForceLen = CohesionForce.Size();
+		CohesionForce *= FMath::Min(1.0f, MaxCohesionForce / FMath::Max(ForceLen, GPUSmallNumber));
+		const FVector3f CohesionAccel = (CohesionForce / FMath::Max(MI, GPUSmallNumber)) * 100.0f;
+
+		ViscosityCorrection *= CacheValid;
+		LaplacianForce *= CacheValid;
+		WeightSum *= CacheValid;
+
+		// Velocity update
+		Velocity += (Params.Gravity + Config.ExternalForce + CohesionAccel) * DeltaTime * ActiveMask;
+
+		const float WeightMask = Step(GPUSmallNumber, WeightSum);
+		ViscosityCorrection = (ViscosityCorrection / FMath::Max(WeightSum, GPUSmallNumber)) * WeightMask;
+		Velocity += Params.ViscosityCoefficient * ViscosityCorrection * ActiveMask;
+
+		const float Mu = Params.ViscosityCoefficient * Params.ViscosityCoefficient * LaplacianViscosityScale;
+		Velocity += Mu * LaplacianForce * DeltaTime * ActiveMask;
+
+		const float DragCoeff = Params.ViscosityCoefficient * Params.ViscosityCoefficient * VelocityDragScale;
+		const float Damping = FMath::Max(1.0f - DragCoeff * DeltaTime, 0.0f);
+		Velocity *= FMath::Lerp(Damping, 1.0f, AttachedMask);
+
+		// Only the fields the pass changes are written, neighbors read the rest concurrently
+		Particle.Velocity = Velocity;
+		Particle.PredictedPosition = FMath::Lerp(Particle.Position + Velocity * DeltaTime, Particle.Position, AttachedMask);
+		Particle.Lambda *= FMath::Lerp(0.9f, 1.0f, AttachedMask);
+	}, GetForFlags(NumParticles));
+}
+
+//=============================================================================
+// Z-Order Sort (KawaiiFluidSortingPipeline.usf)
+//=============================================================================
+
+/**
+ * @brief Morton grid bits per axis (hybrid mode forces Medium).
+ * @return Axis bits.
+ */
+int32 FKawaiiFluidGPUReferenceSolver::GetAxisBits() const
+{
+	return GridResolutionPresetHelper::GetAxisBits(Config.bUseHybridTiledZOrder ? EGridResolutionPreset::Medium : Config.GridResolutionPreset);
+}
+
+/**
+ * @brief Size of the CellStart/CellEnd tables.
+ * @return MAX_CELLS of the effective preset.
+ */
+uint32 FKawaiiFluidGPUReferenceSolver::GetMaxCells() const
+{
+	return 1u << (GetAxisBits() * 3);
+}
+
+/**
+ * @brief Key encoding of the configured sort mode.
+ * @param CellSize Cell size (cm).
+ * @return Hybrid tiled layout or bounded Morton layout on the simulation bounds.
+ */
+FKawaiiFluidMortonKeyLayout FKawaiiFluidGPUReferenceSolver::GetKeyLayout(float CellSize) const
+{
+	return FKawaiiFluidMortonKeyLayout::FromPreset(Config.GridResolutionPreset, Config.bUseHybridTiledZOrder, Config.SimulationBoundsMin, CellSize);
+}
+
+/**
+ * @brief Sort key of a position (ComputeMortonCodesCellBasedCS).
+ * @param Position Predicted position (cm).
+ * @param CellSize Cell size (cm).
+ * @return Hybrid tiled key or bounded Morton code.
+ */
+uint32 FKawaiiFluidGPUReferenceSolver::ComputeSortKey(const FVector3f& Position, float CellSize) const
+{
+	return GetKeyLayout(CellSize).ComputeKey(Position);
+}
+
+/**
+ * @brief Cell table index of a cell coordinate (GetMortonCellIDFromCellCoord of the density pass).
+ * @param CellCoord Cell coordinate.
+ * @param CellSize Cell size (cm).
+ * @return Cell ID in [0, MAX_CELLS).
+ */
+uint32 FKawaiiFluidGPUReferenceSolver::GetCellID(const FIntVector& CellCoord, float CellSize) const
+{
+	return GetKeyLayout(CellSize).ComputeCellKey(CellCoord) & (GetMaxCells() - 1);
+}
+
+/**
+ * @brief Sorted particle range of a cell in the active grid (Morton cell table or sparse brick grid).
+ * @param CellCoord Cell coordinate.
+ * @param CellSize Cell size (cm).
+ * @param OutStart First sorted particle.
+ * @param OutEnd Last sorted particle (inclusive).
+ * @return False if the cell is empty.
+ */
+bool FKawaiiFluidGPUReferenceSolver::FindCellRange(const FIntVector& CellCoord, float CellSize, uint32& OutStart, uint32& OutEnd) const
+{
+	if (Config.bUseSparseBrickGrid)
+	{
+		return BrickGrid.FindCell(CellCoord, OutStart, OutEnd);
+	}
+
+	const uint32 CellID = GetCellID(CellCoord, CellSize);
+	OutStart = CellStart[CellID];
+	OutEnd = CellEnd[CellID];
+	return OutStart != InvalidIndex && OutEnd != InvalidIndex;
+}
+
+/**
+ * @brief Key the particles by predicted position, reorder them by key and rebuild CellStart/CellEnd.
+ * @param Particles Particle buffer, reordered in place.
+ * @param Params Simulation parameters.
+ */
+void FKawaiiFluidGPUReferenceSolver::SortParticles(TArray<FGPUFluidParticle>& Particles, const FGPUFluidSimulationParams& Params)
+{
+	const int32 NumParticles = Particles.Num();
+
+	// Sparse mode: the brick grid keys, sorts and builds its own cell ranges
+	if (Config.bUseSparseBrickGrid)
+	{
+		BrickGrid.SetLayout(Params.CellSize, Config.SparseBrickBits);
+		BrickGrid.Build(NumParticles, [&Particles](int32 Idx) { return Particles[Idx].PredictedPosition; }, Sorter);
+		Sorter.Reorder(Particles, SortScratch);
+		return;
+	}
+
+	// Stable radix sort, like the GPU RadixSort passes
+	Sorter.Sort(NumParticles, GetKeyLayout(Params.CellSize),
+		[&Particles](int32 Idx) { return Particles[Idx].PredictedPosition; });
+	Sorter.Reorder(Particles, SortScratch);
+
+	const TConstArrayView<uint32> SortKeys = Sorter.GetSortedKeys();
+
+	// Cell table: full clear on size change, otherwise only the cells the last sort wrote
+	const uint32 MaxCells = GetMaxCells();
+	if (CellStart.Num() != static_cast<int32>(MaxCells))
+	{
+		CellStart.Init(InvalidIndex, MaxCells);
+		CellEnd.Init(InvalidIndex, MaxCells);
+	}
+	else
+	{
+		for (const uint32 CellID : TouchedCells)
+		{
+			CellStart[CellID] = InvalidIndex;
+			CellEnd[CellID] = InvalidIndex;
+		}
+	}
+	TouchedCells.Reset();
+
+	for (int32 Idx = 0; Idx < NumParticles; ++Idx)
+	{
+		const uint32 CellID = SortKeys[Idx] & (MaxCells - 1);
+		if (Idx == 0)
+		{
+			CellStart[CellID] = Idx;
+			TouchedCells.Add(CellID);
+		}
+		else
+		{
+			const uint32 PrevCellID = SortKeys[Idx - 1] & (MaxCells - 1);
+			if (CellID != PrevCellID)
+			{
+				CellStart[CellID] = Idx;
+				CellEnd[PrevCellID] = Idx - 1;
+				TouchedCells.Add(CellID);
+			}
+		}
+
+		if (Idx == NumParticles - 1)
+		{
+			CellEnd[CellID] = Idx;
+		}
+	}
+}
+
+//=============================================================================
+// SoA Split / Merge (KawaiiFluidSimulationDataLayout.usf)
+//=============================================================================
+
+/**
+ * @brief Split the particle buffer into the solver's SoA buffers, packing velocity, density and lambda to half.
+ * @param Particles Particle buffer (AoS).
+ */
+void FKawaiiFluidGPUReferenceSolver::SplitToSoA(const TArray<FGPUFluidParticle>& Particles)
+{
+	const int32 NumParticles = Particles.Num();
+
+	Positions.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	PredictedPositions.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	PackedVelocities.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	PackedDensityLambda.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	Flags.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	NeighborCountField.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	ParticleIDs.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	SourceIDs.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+
+	ParallelFor(NumParticles, [&](int32 Idx)
+	{
+		const FGPUFluidParticle& P = Particles[Idx];
+		Positions[Idx] = P.Position;
+		PredictedPositions[Idx] = P.PredictedPosition;
+		PackVelocity(Idx, P.Velocity);
+		PackedDensityLambda[Idx] = PackHalf2(P.Density, P.Lambda);
+		Flags[Idx] = P.Flags;
+		NeighborCountField[Idx] = P.NeighborCount;
+		ParticleIDs[Idx] = P.ParticleID;
+		SourceIDs[Idx] = P.SourceID;
+	}, GetForFlags(NumParticles));
+}
+
+/**
+ * @brief Write the SoA buffers back into the particle buffer (uniform mass).
+ * @param Particles Particle buffer, resized to the SoA particle count.
+ * @param Params Simulation parameters.
+ */
+void FKawaiiFluidGPUReferenceSolver::MergeToAoS(TArray<FGPUFluidParticle>& Particles, const FGPUFluidSimulationParams& Params) const
+{
+	const int32 NumParticles = Positions.Num();
+	Particles.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+
+	ParallelFor(NumParticles, [&](int32 Idx)
+	{
+		FGPUFluidParticle& P = Particles[Idx];
+		P.Position = Positions[Idx];
+		P.PredictedPosition = PredictedPositions[Idx];
+		P.Velocity = UnpackVelocity(Idx);
+
+		const FVector2f DensityLambda = UnpackHalf2(PackedDensityLambda[Idx]);
+		P.Density = DensityLambda.X;
+		P.Lambda = DensityLambda.Y;
+
+		P.Mass = Params.ParticleMass;
+		P.Flags = Flags[Idx];
+		P.NeighborCount = NeighborCountField[Idx];
+		P.ParticleID = ParticleIDs[Idx];
+		P.SourceID = SourceIDs[Idx];
+	}, GetForFlags(NumParticles));
+}
+
+//=============================================================================
+// Density / Pressure (KawaiiFluidSimulationDensityPressure.usf)
+//=============================================================================
+
+/**
+ * @brief One XPBD density constraint iteration; iteration 0 walks the cells and fills the neighbor cache.
+ *
+ * Neighbors are read from a snapshot taken at the start of the iteration (Jacobi), which is what the
+ * GPU's LDS tile provides inside a 256-particle tile.
+ *
+ * @param IterationIndex Solver iteration (0 rebuilds the neighbor cache).
+ * @param Params Simulation parameters.
+ */
+void FKawaiiFluidGPUReferenceSolver::SolveDensityPressure(int32 IterationIndex, const FGPUFluidSimulationParams& Params)
+{
+	const int32 NumParticles = PredictedPositions.Num();
+	if (NumParticles == 0)
+	{
+		return;
+	}
+
+	TArray<uint32>& NeighborList = NeighborLists[WriteBufferIndex];
+	TArray<uint32>& NeighborCounts = CachedNeighborCounts[WriteBufferIndex];
+	if (IterationIndex == 0)
+	{
+		// Persistent like the GPU buffers: particles that skip the pass keep last substep's count
+		GrowPersistent(NeighborList, NumParticles * MaxNeighbors);
+		GrowPersistent(NeighborCounts, NumParticles);
+		NeighborParticleCounts[WriteBufferIndex] = NumParticles;
+	}
+	check(NeighborCounts.Num() >= NumParticles);
+
+	CopyInto(PredictedSnapshot, PredictedPositions);
+	CopyInto(DensityLambdaSnapshot, PackedDensityLambda);
+
+	const float SmoothingRadius = Params.SmoothingRadius;
+	const float CellSize = Params.CellSize;
+	const float H = SmoothingRadius * CM_TO_M;
+	const float H2 = H * H;
+	const float RestDensity = Params.RestDensity;
+	const float InvRestDensity = 1.0f / RestDensity;
+
+	const float TensileKScaled = Params.TensileK * static_cast<float>(Params.bEnableTensileInstability);
+	const float TensileMult4 = Params.TensileN >= 4 ? 1.0f : 0.0f;
+	const float TensileMult6 = Params.TensileN >= 6 ? 1.0f : 0.0f;
+
+	const float StActivationDistance = SmoothingRadius * Params.SurfaceTensionActivationRatio;
+	const float StFalloffDistance = SmoothingRadius * Params.SurfaceTensionFalloffRatio;
+	const float StActivationWithTolerance = StActivationDistance + Params.SurfaceTensionTolerance;
+	const float StInvFalloffRange = 1.0f / FMath::Max(SmoothingRadius - StFalloffDistance, 0.001f);
+	const float StInvToleranceRange = 1.0f / FMath::Max(StFalloffDistance - StActivationWithTolerance, 0.001f);
+	const bool bDoSurfaceTension = Params.bEnablePositionBasedSurfaceTension && Params.SurfaceTensionStrength > 0.0f;
+
+	const float MassPoly6 = Params.ParticleMass * Params.Poly6Coeff;
+	const float SpikyScale = Params.SpikyCoeff * CM_TO_M;
+	const float BoundaryAdhesionStrength = FMath::Clamp(Params.BoundaryAdhesionStrength, 0.0f, 1.0f);
+	const int32 CellRadius = FMath::CeilToInt32(SmoothingRadius / CellSize);
+
+	ParallelFor(NumParticles, [&](int32 Idx)
+	{
+		const uint32 ParticleFlags = Flags[Idx];
+		if (HasFlag(ParticleFlags, EGPUParticleFlags::IsAttached) || HasFlag(ParticleFlags, EGPUParticleFlags::IsSleeping))
+		{
+			PackedDensityLambda[Idx] = PackHalf2(RestDensity, 0.0f);
+			return;
+		}
+
+		const bool bIsNearBoundary = HasFlag(ParticleFlags, EGPUParticleFlags::NearBoundary);
+		FVector3f Pos = PredictedSnapshot[Idx];
+		FVector3f Vel = UnpackVelocity(Idx);
+		const float LambdaIPrev = UnpackHalf2(DensityLambdaSnapshot[Idx]).Y;
+
+		float Density = 0.0f;
+		FVector3f GradCI = FVector3f::ZeroVector;
+		float SumGradC2 = 0.0f;
+		FVector3f DeltaP = FVector3f::ZeroVector;
+		uint32 NeighborCount = 0;
+		FVector3f SurfaceTensionCorrection = FVector3f::ZeroVector;
+		uint32 SurfaceTensionConstraintCount = 0;
+
+		// Shared neighbor body of the cell walk and the cached list; false if the neighbor is skipped or out of range
+		auto AccumulateNeighbor = [&](uint32 NeighborIdx) -> bool
+		{
+			if (HasFlag(Flags[NeighborIdx], EGPUParticleFlags::IsAttached))
+			{
+				return false;
+			}
+
+			const FVector3f RCm = Pos - PredictedSnapshot[NeighborIdx];
+			const float R2Cm = FVector3f::DotProduct(RCm, RCm);
+			const float R2 = R2Cm * CM_TO_M_SQ;
+			if (R2 >= H2)
+			{
+				return false;
+			}
+
+			const float Diff = H2 - R2;
+			const float Diff3 = Diff * Diff * Diff;
+			Density += MassPoly6 * Diff3;
+
+			const bool bSelf = NeighborIdx == static_cast<uint32>(Idx);
+			NeighborCount += bSelf ? 0 : 1;
+
+			const float R2Safe = R2 + GPUSmallNumber;
+			const float RLenInv = RSqrt(R2Safe);
+			const float RLen = R2Safe * RLenInv;
+			const float DiffSpiky = H - RLen;
+			const FVector3f R = RCm * CM_TO_M;
+			const FVector3f GradW = (R * RLenInv) * (DiffSpiky * DiffSpiky * SpikyScale);
+			const FVector3f GradCJ = -GradW * InvRestDensity;
+			SumGradC2 += FVector3f::DotProduct(GradCJ, GradCJ);
+			GradCI += GradW * InvRestDensity;
+
+			if (!bSelf)
+			{
+				const float Ratio = Diff3 * Params.InvW_DeltaQ;
+				const float Ratio2 = Ratio * Ratio;
+				const float RatioN = Ratio2 * FMath::Lerp(1.0f, Ratio2, TensileMult4) * FMath::Lerp(1.0f, Ratio2, TensileMult6);
+				const float Scorr = -TensileKScaled * RatioN;
+				const float LambdaJ = UnpackHalf2(DensityLambdaSnapshot[NeighborIdx]).Y;
+				DeltaP += (LambdaIPrev + LambdaJ + Scorr) * GradW;
+
+				if (bDoSurfaceTension)
+				{
+					const float DistCm = R2Cm * RSqrt(R2Cm + GPUSmallNumber);
+					const FVector3f PullDirection = -RCm * RLenInv * CM_TO_M;
+					const float DistFromActivation = DistCm - StActivationWithTolerance;
+					const float ActivationMask = Step(0.0f, DistFromActivation);
+					const float FalloffT = Saturate((DistCm - StFalloffDistance) * StInvFalloffRange);
+					const float StStrength = Params.SurfaceTensionStrength * (1.0f - FalloffT);
+					const float NormalizedDist = Saturate(DistFromActivation * StInvToleranceRange);
+					const float StCorrectionMag = DistFromActivation * StStrength * NormalizedDist * NormalizedDist * ActivationMask;
+					SurfaceTensionCorrection += PullDirection * StCorrectionMag;
+					SurfaceTensionConstraintCount += static_cast<uint32>(ActivationMask);
+				}
+			}
+			return true;
+		};
+
+		const uint32 BaseIdx = static_cast<uint32>(Idx) * MaxNeighbors;
+		if (IterationIndex == 0)
+		{
+			uint32 CachedCount = 0;
+			const FIntVector CenterCell = KawaiiFluidMorton::WorldToCell(Pos, CellSize);
+
+			for (int32 Dz = -CellRadius; Dz <= CellRadius; ++Dz)
+			{
+				for (int32 Dy = -CellRadius; Dy <= CellRadius; ++Dy)
+				{
+					for (int32 Dx = -CellRadius; Dx <= CellRadius; ++Dx)
+					{
+						uint32 CellStartIdx = InvalidIndex;
+						uint32 CellEndIdx = InvalidIndex;
+						if (!FindCellRange(CenterCell + FIntVector(Dx, Dy, Dz), CellSize, CellStartIdx, CellEndIdx))
+						{
+							continue;
+						}
+
+						// Clamped Morton coordinates can visit a cell twice; the GPU counts it twice as well
+						const uint32 MaxNeighborIdx = FMath::Min(CellEndIdx, static_cast<uint32>(NumParticles - 1));
+						for (uint32 NeighborIdx = CellStartIdx; NeighborIdx <= MaxNeighborIdx; ++NeighborIdx)
+						{
+							if (AccumulateNeighbor(NeighborIdx) && CachedCount < MaxNeighbors)
+							{
+								NeighborList[BaseIdx + CachedCount++] = NeighborIdx;
+							}
+						}
+					}
+				}
+			}
+
+			NeighborCounts[Idx] = CachedCount;
+		}
+		else
+		{
+			const uint32 CachedCount = NeighborCounts[Idx];
+			const bool bReverseOrder = (IterationIndex & 1) != 0;
+			for (uint32 Ni = 0; Ni < CachedCount; ++Ni)
+			{
+				const uint32 N = bReverseOrder ? (CachedCount - 1 - Ni) : Ni;
+				AccumulateNeighbor(NeighborList[BaseIdx + N]);
+			}
+		}
+
+		SumGradC2 += FVector3f::DotProduct(GradCI, GradCI);
+
+		// Boundary particles (Akinci 2012), brute-force search
+		FVector3f BoundaryVelCorrection = FVector3f::ZeroVector;
+		float BoundaryVelWeight = 0.0f;
+		for (const FGPUBoundaryParticle& Boundary : BoundaryParticles)
+		{
+			const FVector3f RCm = Pos - Boundary.Position;
+			const float R2Cm = FVector3f::DotProduct(RCm, RCm);
+			const float R2 = R2Cm * CM_TO_M_SQ;
+			if (R2 >= H2 || R2 <= GPUSmallNumber)
+			{
+				continue;
+			}
+
+			const float W = Poly6Kernel(R2, H2);
+			Density += Boundary.Psi * Params.Poly6Coeff * W;
+
+			const FVector3f GradW = SpikyGradientFast(RCm * CM_TO_M, R2, H) * (Params.SpikyCoeff * CM_TO_M);
+
+			float PressureDampFactor = 1.0f;
+			if (Params.bEnableRelativeVelocityDamping)
+			{
+				const float RLen = FMath::Sqrt(R2Cm);
+				if (RLen > GPUSmallNumber)
+				{
+					const float ApproachSpeed = -FVector3f::DotProduct(Vel - Boundary.Velocity, RCm / RLen);
+					if (ApproachSpeed > 0.0f)
+					{
+						PressureDampFactor = 1.0f - Saturate(ApproachSpeed / 1000.0f) * Params.RelativeVelocityDampingStrength;
+					}
+				}
+			}
+			DeltaP += PressureDampFactor * LambdaIPrev * Boundary.Psi * GradW;
+
+			if (Params.bEnableBoundaryVelocityTransfer && BoundaryAdhesionStrength > 0.0f)
+			{
+				const float RelativeSpeed = (Vel - Boundary.Velocity).Size();
+				const float DetachFactor = FMath::SmoothStep(Params.BoundaryDetachSpeedThreshold, Params.BoundaryMaxDetachSpeed, RelativeSpeed);
+				const float TransferFactor = (1.0f - DetachFactor) * Params.BoundaryVelocityTransferStrength;
+				const float Contribution = W * Boundary.Psi * BoundaryAdhesionStrength * TransferFactor;
+				BoundaryVelCorrection += (Boundary.Velocity - Vel) * Contribution;
+				BoundaryVelWeight += Contribution;
+			}
+		}
+
+		if (BoundaryVelWeight > GPUSmallNumber && Params.SolverIterations > 0 && !bIsNearBoundary)
+		{
+			Vel += (BoundaryVelCorrection / BoundaryVelWeight) * (1.0f / static_cast<float>(Params.SolverIterations));
+		}
+
+		// XPBD lambda (only compression is corrected)
+		const float C = Density * InvRestDensity - 1.0f;
+		const float AlphaTilde = Params.Compliance / FMath::Max(Params.DeltaTimeSq, 0.00001f);
+		float Lambda = LambdaIPrev;
+		if (C > 0.0f)
+		{
+			Lambda = LambdaIPrev + (-C - AlphaTilde * LambdaIPrev) / (SumGradC2 + AlphaTilde);
+		}
+
+		Pos += DeltaP * InvRestDensity;
+
+		// Position-based surface tension
+		const float InvDeltaTime = 1.0f / FMath::Sqrt(FMath::Max(Params.DeltaTimeSq, 0.0001f));
+		if (SurfaceTensionConstraintCount > 0 && !bIsNearBoundary)
+		{
+			FVector3f AvgSTCorrection = SurfaceTensionCorrection / static_cast<float>(SurfaceTensionConstraintCount);
+			const float StCorrLen = AvgSTCorrection.Size();
+			if (StCorrLen > Params.MaxSurfaceTensionCorrectionPerIteration && StCorrLen > GPUSmallNumber)
+			{
+				AvgSTCorrection *= Params.MaxSurfaceTensionCorrectionPerIteration / StCorrLen;
+			}
+
+			float SurfaceScale = 1.0f;
+			if (Params.SurfaceTensionSurfaceThreshold > 0)
+			{
+				SurfaceScale = FMath::Sqrt(1.0f - Saturate(static_cast<float>(NeighborCount) / static_cast<float>(Params.SurfaceTensionSurfaceThreshold)));
+			}
+
+			if (SurfaceScale > 0.01f)
+			{
+				const FVector3f PosCorrection = AvgSTCorrection * SurfaceScale * (1.0f - Params.SurfaceTensionVelocityDamping);
+				Pos += PosCorrection;
+				Vel += PosCorrection * InvDeltaTime;
+			}
+		}
+
+		PredictedPositions[Idx] = Pos;
+		PackVelocity(Idx, Vel);
+		PackedDensityLambda[Idx] = PackHalf2(Density, Lambda);
+		NeighborCountField[Idx] = NeighborCount;
+	}, GetForFlags(NumParticles));
+}
+
+//=============================================================================
+// Collision (KawaiiFluidCollision.usf)
+//=============================================================================
+
+/**
+ * @brief Keep particles inside the simulation volume (AABB or OBB) with friction and restitution.
+ * @param Params Simulation parameters.
+ */
+void FKawaiiFluidGPUReferenceSolver::ApplyBoundsCollision(const FGPUFluidSimulationParams& Params)
+{
+	const int32 NumParticles = PredictedPositions.Num();
+
+	ParallelFor(NumParticles, [&](int32 Idx)
+	{
+		uint32 FlagsValue = Flags[Idx];
+		if (HasFlag(FlagsValue, EGPUParticleFlags::IsAttached))
+		{
+			return;
+		}
+
+		FVector3f Pos = PredictedPositions[Idx];
+		FVector3f Vel = UnpackVelocity(Idx);
+		bool bHitGround;
+
+		if (Params.bUseOBB != 0)
+		{
+			// Box space of the OBB, extent shrunk by the particle radius
+			FVector3f LocalPos = InverseRotateByQuat(Pos - Params.BoundsCenter, Params.BoundsRotation);
+			const FVector3f LocalOriginalPos = InverseRotateByQuat(Positions[Idx] - Params.BoundsCenter, Params.BoundsRotation);
+			FVector3f LocalVel = InverseRotateByQuat(Vel, Params.BoundsRotation);
+			const FVector3f EffectiveExtent = (Params.BoundsExtent - FVector3f(Params.ParticleRadius)).ComponentMax(FVector3f(0.001f));
+
+			bHitGround = ApplyBoxBounds(LocalPos, LocalOriginalPos, LocalVel, -EffectiveExtent, EffectiveExtent,
+				Params.BoundsFriction, Params.BoundsRestitution);
+
+			Pos = RotateByQuat(LocalPos, Params.BoundsRotation) + Params.BoundsCenter;
+			Vel = RotateByQuat(LocalVel, Params.BoundsRotation);
+		}
+		else
+		{
+			bHitGround = ApplyBoxBounds(Pos, Positions[Idx], Vel,
+				Params.BoundsMin + FVector3f(Params.ParticleRadius), Params.BoundsMax - FVector3f(Params.ParticleRadius),
+				Params.BoundsFriction, Params.BoundsRestitution);
+		}
+
+		FlagsValue = bHitGround ? (FlagsValue | EGPUParticleFlags::NearGround) : (FlagsValue & ~EGPUParticleFlags::NearGround);
+
+		PredictedPositions[Idx] = Pos;
+		PackVelocity(Idx, Vel);
+		Flags[Idx] = FlagsValue;
+	}, GetForFlags(NumParticles));
+}
+
+/**
+ * @brief Center-based collision against spheres, capsules, boxes and convex hulls (feedback not recorded).
+ * @param Params Simulation parameters.
+ */
+void FKawaiiFluidGPUReferenceSolver::ApplyPrimitiveCollision(const FGPUFluidSimulationParams& Params)
+{
+	if (Primitives.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 NumParticles = PredictedPositions.Num();
+	const float CollisionThreshold = Config.PrimitiveCollisionThreshold;
+
+	ParallelFor(NumParticles, [&](int32 Idx)
+	{
+		uint32 FlagsValue = Flags[Idx];
+		if (HasFlag(FlagsValue, EGPUParticleFlags::IsAttached))
+		{
+			return;
+		}
+
+		FVector3f Pos = PredictedPositions[Idx];
+		FVector3f OriginalPos = Positions[Idx];
+		FVector3f Vel = UnpackVelocity(Idx);
+		bool bCollided = false;
+
+		for (const FGPUCollisionSphere& Sphere : Primitives.Spheres)
+		{
+			const float Sdf = SdSphere(Pos, Sphere);
+			if (Sdf < CollisionThreshold)
+			{
+				const FVector3f Normal = CalcNumericalGradient(Pos, [&Sphere](const FVector3f& P) { return SdSphere(P, Sphere); });
+				ApplyCollisionResponseWithFriction(Pos, OriginalPos, Vel, Normal, FMath::Max(0.0f, -Sdf), Sphere.Friction, Sphere.Restitution);
+				OriginalPos = Pos;
+				bCollided = true;
+			}
+		}
+
+		for (const FGPUCollisionCapsule& Capsule : Primitives.Capsules)
+		{
+			const float Sdf = SdCapsule(Pos, Capsule);
+			if (Sdf < CollisionThreshold)
+			{
+				const FVector3f Normal = CalcNumericalGradient(Pos, [&Capsule](const FVector3f& P) { return SdCapsule(P, Capsule); });
+				ApplyCollisionResponseWithFriction(Pos, OriginalPos, Vel, Normal, FMath::Max(0.0f, -Sdf), Capsule.Friction, Capsule.Restitution);
+				OriginalPos = Pos;
+				bCollided = true;
+			}
+		}
+
+		for (const FGPUCollisionBox& Box : Primitives.Boxes)
+		{
+			const float Sdf = SdBox(Pos, Box);
+			if (Sdf < CollisionThreshold)
+			{
+				const FVector3f Normal = CalcNumericalGradient(Pos, [&Box](const FVector3f& P) { return SdBox(P, Box); });
+				ApplyCollisionResponseWithFriction(Pos, OriginalPos, Vel, Normal, FMath::Max(0.0f, -Sdf), Box.Friction, Box.Restitution);
+				OriginalPos = Pos;
+				if (Normal.Z > 0.5f)
+				{
+					FlagsValue |= EGPUParticleFlags::NearGround;
+				}
+				bCollided = true;
+			}
+		}
+
+		for (const FGPUCollisionConvex& Convex : Primitives.Convexes)
+		{
+			if ((Pos - Convex.Center).Size() - Convex.BoundingRadius > CollisionThreshold)
+			{
+				continue;
+			}
+
+			const float Sdf = SdConvex(Pos, Convex, Primitives.ConvexPlanes);
+			if (Sdf < CollisionThreshold)
+			{
+				// Normal of the closest (max distance) plane
+				FVector3f Normal(0, 0, 1);
+				float MaxDistance = -1e10f;
+				for (int32 PlaneIndex = 0; PlaneIndex < Convex.PlaneCount; ++PlaneIndex)
+				{
+					const FGPUConvexPlane& Plane = Primitives.ConvexPlanes[Convex.PlaneStartIndex + PlaneIndex];
+					const float Distance = FVector3f::DotProduct(Pos, Plane.Normal) - Plane.Distance;
+					if (Distance > MaxDistance)
+					{
+						MaxDistance = Distance;
+						Normal = Plane.Normal;
+					}
+				}
+
+				ApplyCollisionResponseWithFriction(Pos, OriginalPos, Vel, Normal, FMath::Max(0.0f, -Sdf), Convex.Friction, Convex.Restitution);
+				OriginalPos = Pos;
+				if (Normal.Z > 0.5f)
+				{
+					FlagsValue |= EGPUParticleFlags::NearGround;
+				}
+				bCollided = true;
+			}
+		}
+
+		if (!bCollided)
+		{
+			FlagsValue &= ~EGPUParticleFlags::NearGround;
+		}
+
+		PredictedPositions[Idx] = Pos;
+		PackVelocity(Idx, Vel);
+		Flags[Idx] = FlagsValue;
+	}, GetForFlags(NumParticles));
+}
+
+/**
+ * @brief Bilinear clamp sample of the heightmap (SampleTerrainHeight).
+ * @param U Horizontal texture coordinate.
+ * @param V Vertical texture coordinate.
+ * @return Terrain height (world Z).
+ */
+float FKawaiiFluidGPUReferenceSolver::SampleHeightmap(float U, float V) const
+{
+	const int32 Width = HeightmapParams.TextureWidth;
+	const int32 Height = HeightmapParams.TextureHeight;
+
+	// Texel centers sit at (i + 0.5) / Size
+	const float X = Saturate(U) * Width - 0.5f;
+	const float Y = Saturate(V) * Height - 0.5f;
+	const int32 X0 = FMath::FloorToInt32(X);
+	const int32 Y0 = FMath::FloorToInt32(Y);
+	const float FracX = X - X0;
+	const float FracY = Y - Y0;
+
+	auto Texel = [&](int32 TexelX, int32 TexelY)
+	{
+		return HeightmapHeights[FMath::Clamp(TexelY, 0, Height - 1) * Width + FMath::Clamp(TexelX, 0, Width - 1)];
+	};
+
+	const float Top = FMath::Lerp(Texel(X0, Y0), Texel(X0 + 1, Y0), FracX);
+	const float Bottom = FMath::Lerp(Texel(X0, Y0 + 1), Texel(X0 + 1, Y0 + 1), FracX);
+	return FMath::Lerp(HeightmapParams.WorldMin.Z, HeightmapParams.WorldMax.Z, FMath::Lerp(Top, Bottom, FracY));
+}
+
+/**
+ * @brief Collision against the terrain plane under each particle, with friction and restitution.
+ * @param Params Simulation parameters.
+ */
+void FKawaiiFluidGPUReferenceSolver::ApplyHeightmapCollision(const FGPUFluidSimulationParams& Params)
+{
+	if (!HeightmapParams.bEnabled || HeightmapParams.TextureWidth <= 0 || HeightmapParams.TextureHeight <= 0
+		|| HeightmapHeights.Num() != HeightmapParams.TextureWidth * HeightmapParams.TextureHeight)
+	{
+		return;
+	}
+
+	const int32 NumParticles = PredictedPositions.Num();
+	const FGPUHeightmapCollisionParams& HP = HeightmapParams;
+	const float ParticleRadius = HP.ParticleRadius > 0 ? HP.ParticleRadius : Params.ParticleRadius;
+	const float WorldTexelX = (HP.WorldMax.X - HP.WorldMin.X) * HP.InvTextureWidth;
+	const float WorldTexelY = (HP.WorldMax.Y - HP.WorldMin.Y) * HP.InvTextureHeight;
+
+	ParallelFor(NumParticles, [&](int32 Idx)
+	{
+		uint32 FlagsValue = Flags[Idx];
+		if (HasFlag(FlagsValue, EGPUParticleFlags::IsAttached))
+		{
+			return;
+		}
+
+		FVector3f Pos = PredictedPositions[Idx];
+		if (Pos.X < HP.WorldMin.X || Pos.X > HP.WorldMax.X || Pos.Y < HP.WorldMin.Y || Pos.Y > HP.WorldMax.Y)
+		{
+			return;
+		}
+
+		const FVector3f OriginalPos = Positions[Idx];
+		FVector3f Vel = UnpackVelocity(Idx);
+
+		const float U = (Pos.X - HP.WorldMin.X) * HP.InvWorldExtent.X;
+		const float V = (Pos.Y - HP.WorldMin.Y) * HP.InvWorldExtent.Y;
+		const float TerrainZ = SampleHeightmap(U, V);
+
+		// Central differences one texel apart
+		const float DZdX = (SampleHeightmap(U + HP.InvTextureWidth, V) - SampleHeightmap(U - HP.InvTextureWidth, V)) / (2.0f * WorldTexelX);
+		const float DZdY = (SampleHeightmap(U, V + HP.InvTextureHeight) - SampleHeightmap(U, V - HP.InvTextureHeight)) / (2.0f * WorldTexelY);
+		const FVector3f Normal = Normalize(FVector3f(-DZdX * HP.NormalStrength, -DZdY * HP.NormalStrength, 1.0f));
+
+		const float SignedDistance = FVector3f::DotProduct(Pos - FVector3f(Pos.X, Pos.Y, TerrainZ), Normal);
+		const float Penetration = (ParticleRadius + HP.CollisionOffset) - SignedDistance;
+
+		if (Penetration > 0.0f)
+		{
+			constexpr float SkinOffset = 0.01f;
+			Pos += Normal * (Penetration + SkinOffset);
+
+			const FVector3f DeltaX = Pos - OriginalPos;
+			const float DeltaXNormal = FVector3f::DotProduct(DeltaX, Normal);
+			const FVector3f DeltaXTangent = DeltaX - DeltaXNormal * Normal;
+			const float TangentLength = DeltaXTangent.Size();
+
+			if (TangentLength > 0.001f)
+			{
+				const float MaxTangent = HP.Friction * Penetration;
+				if (TangentLength < MaxTangent)
+				{
+					Pos = OriginalPos + DeltaXNormal * Normal;
+				}
+				else
+				{
+					Pos = OriginalPos + DeltaXNormal * Normal + DeltaXTangent * (1.0f - MaxTangent / TangentLength);
+				}
+			}
+
+			const float VelocityAlongNormal = FVector3f::DotProduct(Vel, Normal);
+			if (VelocityAlongNormal < 0.0f)
+			{
+				Vel -= (1.0f + HP.Restitution) * VelocityAlongNormal * Normal;
+			}
+
+			if (Normal.Z > 0.5f)
+			{
+				FlagsValue |= EGPUParticleFlags::NearGround;
+			}
+			FlagsValue |= EGPUParticleFlags::HasCollided;
+		}
+		else if (SignedDistance > ParticleRadius * 3.0f)
+		{
+			FlagsValue &= ~EGPUParticleFlags::NearGround;
+		}
+
+		PredictedPositions[Idx] = Pos;
+		PackVelocity(Idx, Vel);
+		Flags[Idx] = FlagsValue;
+	}, GetForFlags(NumParticles));
+}
+
+//=============================================================================
+// Post Step (KawaiiFluidSimulationPostStep.usf)
+//=============================================================================
+
+/**
+ * @brief Commit predicted positions and derive velocity from the displacement (v = (x* - x) / dt).
+ * @param Params Simulation parameters.
+ */
+void FKawaiiFluidGPUReferenceSolver::FinalizePositions(const FGPUFluidSimulationParams& Params)
+{
+	const int32 NumParticles = Positions.Num();
+	const float InvDt = 1.0f / FMath::Max(Params.DeltaTime, 0.0001f);
+
+	ParallelFor(NumParticles, [&](int32 Idx)
+	{
+		const uint32 ParticleFlags = Flags[Idx];
+		const FVector3f OldPosition = Positions[Idx];
+		Positions[Idx] = PredictedPositions[Idx];
+
+		if (HasFlag(ParticleFlags, EGPUParticleFlags::IsAttached))
+		{
+			return;
+		}
+
+		FVector3f Velocity;
+		if (HasFlag(ParticleFlags, EGPUParticleFlags::NearBoundary))
+		{
+			// Velocity was set by the bone transform, only damped here
+			Velocity = UnpackVelocity(Idx);
+		}
+		else
+		{
+			Velocity = (Positions[Idx] - OldPosition) * InvDt;
+			const float VelocityMag = Velocity.Size();
+			if (VelocityMag > Config.MaxVelocity)
+			{
+				Velocity = (Velocity / VelocityMag) * Config.MaxVelocity;
+			}
+		}
+
+		PackVelocity(Idx, Velocity * Params.GlobalDamping);
+		Flags[Idx] = ParticleFlags & ~EGPUParticleFlags::JustDetached;
+	}, GetForFlags(NumParticles));
+}
+
+/**
+ * @brief Sleep slow particles and wake them on speed, collision or a fast awake neighbor (UpdateParticleSleepingCS).
+ * @param Particles Particle buffer after MergeToAoS.
+ * @param Params Simulation parameters.
+ */
+void FKawaiiFluidGPUReferenceSolver::UpdateSleeping(TArray<FGPUFluidParticle>& Particles, const FGPUFluidSimulationParams& Params)
+{
+	const int32 NumParticles = Particles.Num();
+	GrowPersistent(SleepCounters, NumParticles);
+
+	const TArray<uint32>& NeighborList = NeighborLists[WriteBufferIndex];
+	const TArray<uint32>& NeighborCounts = CachedNeighborCounts[WriteBufferIndex];
+	const bool bHasNeighborCache = NeighborCounts.Num() >= NumParticles;
+
+	// Neighbor state is read from before the pass
+	CopyInto(SortScratch, Particles);
+
+	ParallelFor(NumParticles, [&](int32 Idx)
+	{
+		FGPUFluidParticle& Particle = Particles[Idx];
+		if (HasFlag(Particle.Flags, EGPUParticleFlags::IsAttached))
+		{
+			Particle.Flags &= ~EGPUParticleFlags::IsSleeping;
+			SleepCounters[Idx] = 0;
+			return;
+		}
+
+		const float Speed = Particle.Velocity.Size();
+		if (HasFlag(Particle.Flags, EGPUParticleFlags::IsSleeping))
+		{
+			bool bShouldWake = Speed > Params.WakeVelocityThreshold || HasFlag(Particle.Flags, EGPUParticleFlags::HasCollided);
+
+			if (!bShouldWake && bHasNeighborCache)
+			{
+				const uint32 BaseIdx = static_cast<uint32>(Idx) * MaxNeighbors;
+				const uint32 Count = FMath::Min(NeighborCounts[Idx], MaxNeighbors);
+				for (uint32 N = 0; N < Count; ++N)
+				{
+					const uint32 NeighborIdx = NeighborList[BaseIdx + N];
+					if (NeighborIdx < static_cast<uint32>(NumParticles) && NeighborIdx != static_cast<uint32>(Idx))
+					{
+						const FGPUFluidParticle& Neighbor = SortScratch[NeighborIdx];
+						if (!HasFlag(Neighbor.Flags, EGPUParticleFlags::IsSleeping) && Neighbor.Velocity.Size() > Params.WakeVelocityThreshold)
+						{
+							bShouldWake = true;
+							break;
+						}
+					}
+				}
+			}
+
+			if (bShouldWake)
+			{
+				Particle.Flags &= ~EGPUParticleFlags::IsSleeping;
+				SleepCounters[Idx] = 0;
+			}
+		}
+		else if (Speed < Params.SleepVelocityThreshold)
+		{
+			const uint32 SleepCounter = SleepCounters[Idx] + 1;
+			if (SleepCounter >= static_cast<uint32>(Params.SleepFrameThreshold))
+			{
+				Particle.Flags |= EGPUParticleFlags::IsSleeping;
+				Particle.Velocity = FVector3f::ZeroVector;
+			}
+			SleepCounters[Idx] = SleepCounter;
+		}
+		else
+		{
+			SleepCounters[Idx] = 0;
+		}
+
+		Particle.Flags &= ~EGPUParticleFlags::HasCollided;
+	}, GetForFlags(NumParticles));
+}
+
+//=============================================================================
+// Half Packing
+//=============================================================================
+
+/**
+ * @brief Pack two floats as half2 (PackHalf2).
+ * @param X Low half.
+ * @param Y High half.
+ * @return Packed word.
+ */
+uint32 FKawaiiFluidGPUReferenceSolver::PackHalf2(float X, float Y)
+{
+	return static_cast<uint32>(FFloat16(X).Encoded) | (static_cast<uint32>(FFloat16(Y).Encoded) << 16);
+}
+
+/**
+ * @brief Unpack a half2 word (UnpackHalf2).
+ * @param Packed Packed word.
+ * @return Low half in X, high half in Y.
+ */
+FVector2f FKawaiiFluidGPUReferenceSolver::UnpackHalf2(uint32 Packed)
+{
+	FFloat16 Low;
+	Low.Encoded = static_cast<uint16>(Packed & 0xFFFF);
+	FFloat16 High;
+	High.Encoded = static_cast<uint16>(Packed >> 16);
+	return FVector2f(Low.GetFloat(), High.GetFloat());
+}
+
+/**
+ * @brief Density of a particle after the last pass (half precision).
+ * @param Index Sorted particle index.
+ * @return Density (kg/m³).
+ */
+float FKawaiiFluidGPUReferenceSolver::GetDensity(int32 Index) const
+{
+	return UnpackHalf2(PackedDensityLambda[Index]).X;
+}
+
+/**
+ * @brief Lambda of a particle after the last pass (half precision).
+ * @param Index Sorted particle index.
+ * @return XPBD multiplier.
+ */
+float FKawaiiFluidGPUReferenceSolver::GetLambda(int32 Index) const
+{
+	return UnpackHalf2(PackedDensityLambda[Index]).Y;
+}
+
+FVector3f FKawaiiFluidGPUReferenceSolver::UnpackVelocity(int32 Index) const
+{
+	const FVector2f XY = UnpackHalf2(PackedVelocities[Index].X);
+	return FVector3f(XY.X, XY.Y, UnpackHalf2(PackedVelocities[Index].Y).X);
+}
+
+void FKawaiiFluidGPUReferenceSolver::PackVelocity(int32 Index, const FVector3f& Velocity)
+{
+	PackedVelocities[Index] = FUintVector2(PackHalf2(Velocity.X, Velocity.Y), PackHalf2(Velocity.Z, 0.0f));
+}
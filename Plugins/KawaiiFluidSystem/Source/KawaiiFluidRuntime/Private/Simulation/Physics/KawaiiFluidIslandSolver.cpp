@@ -0,0 +1,500 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Physics/KawaiiFluidIslandSolver.h"
+#include "Simulation/Collision/KawaiiFluidCollider.h"
+#include "Async/ParallelFor.h"
+
+/**
+ * @brief Default constructor for FKawaiiFluidIslandSolver.
+ */
+FKawaiiFluidIslandSolver::FKawaiiFluidIslandSolver()
+{
+}
+
+/**
+ * @brief Find the island root of a particle (path halving).
+ * @param Index Particle index.
+ * @return Root particle index.
+ */
+int32 FKawaiiFluidIslandSolver::FindRoot(int32 Index)
+{
+	while (Parents[Index] != Index)
+	{
+		Parents[Index] = Parents[Parents[Index]];
+		Index = Parents[Index];
+	}
+	return Index;
+}
+
+/**
+ * @brief Merge the islands of two particles (smaller root wins, keeps roots deterministic).
+ * @param A First particle index.
+ * @param B Second particle index.
+ */
+void FKawaiiFluidIslandSolver::Union(int32 A, int32 B)
+{
+	const int32 RootA = FindRoot(A);
+	const int32 RootB = FindRoot(B);
+	if (RootA < RootB)
+	{
+		Parents[RootB] = RootA;
+	}
+	else if (RootB < RootA)
+	{
+		Parents[RootA] = RootB;
+	}
+}
+
+namespace
+{
+	/**
+	 * @brief Grid cell of a position in the sleeping cell map.
+	 * @param Position World-space position.
+	 * @param CellSize Cell size (smoothing radius).
+	 * @return Integer cell coordinate.
+	 */
+	FIntVector GetSleepingCell(const FVector& Position, float CellSize)
+	{
+		return FIntVector(
+			FMath::FloorToInt(Position.X / CellSize),
+			FMath::FloorToInt(Position.Y / CellSize),
+			FMath::FloorToInt(Position.Z / CellSize)
+		);
+	}
+}
+
+/**
+ * @brief Rebuild the sleeping islands from scratch: union-find over the sleeping particles only.
+ *
+ * Used when particle indices changed since the last update (reorder, removal). Sleeping neighbor lists
+ * are the ones recorded when the island fell asleep, remapped by reorders or rebuilt by the context
+ * after a removal, so a changed neighbor count marks the island disturbed.
+ *
+ * @param Particles Particle array.
+ */
+void FKawaiiFluidIslandSolver::RebuildSleepingIslands(const TArray<FKawaiiFluidParticle>& Particles)
+{
+	const int32 NumParticles = Particles.Num();
+
+	Parents.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	IslandOfParticle.Init(INDEX_NONE, NumParticles);
+	Islands.Reset();
+
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		Parents[i] = i;
+	}
+
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		if (!Particles[i].bIsSleeping)
+		{
+			continue;
+		}
+		for (const int32 j : Particles[i].NeighborIndices)
+		{
+			if (j > i && j < NumParticles && Particles[j].bIsSleeping)
+			{
+				Union(i, j);
+			}
+		}
+	}
+
+	NumSleepingParticles = 0;
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const FKawaiiFluidParticle& P = Particles[i];
+		if (!P.bIsSleeping)
+		{
+			continue;
+		}
+
+		// Roots are the smallest index of their island, so they were visited first
+		const int32 Root = FindRoot(i);
+		IslandOfParticle[i] = Root == i ? Islands.AddDefaulted() : IslandOfParticle[Root];
+
+		FIsland& Island = Islands[IslandOfParticle[i]];
+		Island.Bounds += P.Position;
+		Island.NumParticles++;
+		Island.NumSleeping++;
+		Island.MinSleepFrames = FMath::Min(Island.MinSleepFrames, P.SleepFrameCount);
+
+		// A neighbor appeared or disappeared since the island fell asleep
+		Island.bDisturbed |= P.NeighborIndices.Num() != P.SleepNeighborCount;
+		NumSleepingParticles++;
+	}
+
+	NumSleepingIslands = Islands.Num();
+	bIslandsValid = true;
+}
+
+/**
+ * @brief Index the sleeping particles by grid cell for the awake-contact queries.
+ * @param Particles Particle array.
+ * @param CellSize Cell size (smoothing radius).
+ */
+void FKawaiiFluidIslandSolver::RebuildSleepingCells(const TArray<FKawaiiFluidParticle>& Particles, float CellSize)
+{
+	SleepingCells.Reset();
+	SleepingCellParticles.Reset();
+	SleepingCellSize = CellSize;
+
+	TArray<TPair<FIntVector, int32>> Entries;
+	Entries.Reserve(NumSleepingParticles);
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		if (Particles[i].bIsSleeping)
+		{
+			Entries.Emplace(GetSleepingCell(Particles[i].Position, CellSize), i);
+		}
+	}
+
+	Entries.Sort([](const TPair<FIntVector, int32>& A, const TPair<FIntVector, int32>& B)
+	{
+		return MakeTuple(A.Key.X, A.Key.Y, A.Key.Z, A.Value) < MakeTuple(B.Key.X, B.Key.Y, B.Key.Z, B.Value);
+	});
+
+	SleepingCellParticles.SetNumUninitialized(Entries.Num());
+	for (int32 k = 0; k < Entries.Num(); ++k)
+	{
+		SleepingCellParticles[k] = Entries[k].Value;
+		SleepingCells.FindOrAdd(Entries[k].Key, FIntPoint(k, 0)).Y++;
+	}
+}
+
+/**
+ * @brief Find a sleeping island with a member within the cell size of a position.
+ * @param Particles Particle array.
+ * @param Position Awake particle position.
+ * @return Sleeping island index, or INDEX_NONE.
+ */
+int32 FKawaiiFluidIslandSolver::FindContactIsland(const TArray<FKawaiiFluidParticle>& Particles, const FVector& Position) const
+{
+	const FIntVector Cell = GetSleepingCell(Position, SleepingCellSize);
+	const double RadiusSq = FMath::Square(static_cast<double>(SleepingCellSize));
+
+	for (int32 DZ = -1; DZ <= 1; ++DZ)
+	{
+		for (int32 DY = -1; DY <= 1; ++DY)
+		{
+			for (int32 DX = -1; DX <= 1; ++DX)
+			{
+				const FIntPoint* Range = SleepingCells.Find(Cell + FIntVector(DX, DY, DZ));
+				if (!Range)
+				{
+					continue;
+				}
+				for (int32 k = Range->X; k < Range->X + Range->Y; ++k)
+				{
+					const int32 j = SleepingCellParticles[k];
+					if (FVector::DistSquared(Particles[j].Position, Position) < RadiusSq)
+					{
+						return IslandOfParticle[j];
+					}
+				}
+			}
+		}
+	}
+	return INDEX_NONE;
+}
+
+/**
+ * @brief Detect islands, wake disturbed sleeping islands and put quiet islands to sleep.
+ *
+ * Sleeping islands are kept from the last update; union-find only runs over the awake particles and
+ * their current NeighborIndices (full-array index space, as left by the substeps). Awake particles
+ * reach sleeping islands through the sleeping cell map instead of their neighbor lists, so the
+ * partitioned substeps never have to search the sleeping particles.
+ *
+ * @param Particles In/Out particle array (sleep state, and velocity of newly sleeping particles).
+ * @param Colliders Colliders that wake islands their bounds overlap.
+ * @param SleepVelocityThreshold Island mean speed below which the sleep counter advances (cm/s).
+ * @param SleepFrameThreshold Consecutive quiet frames before an island sleeps.
+ * @param SmoothingRadius Interaction radius: contact distance and collider test margin.
+ */
+void FKawaiiFluidIslandSolver::Update(
+	TArray<FKawaiiFluidParticle>& Particles,
+	const TArray<TObjectPtr<UKawaiiFluidCollider>>& Colliders,
+	float SleepVelocityThreshold,
+	int32 SleepFrameThreshold,
+	float SmoothingRadius)
+{
+	const int32 NumParticles = Particles.Num();
+	bLastUpdateSkipped = false;
+
+	// 1. Sleeping islands: kept from the last update unless particle indices changed
+	const bool bReuseIslands = bIslandsValid && NumParticles >= LastNumParticles && SleepingCellSize == SmoothingRadius;
+	if (bReuseIslands)
+	{
+		Islands.SetNum(NumSleepingIslands, EAllowShrinking::No);
+		IslandOfParticle.SetNum(NumParticles, EAllowShrinking::No);
+	}
+	else
+	{
+		RebuildSleepingIslands(Particles);
+		RebuildSleepingCells(Particles, SmoothingRadius);
+	}
+
+	// Without spawns every particle still sleeps, so there is nothing awake to look for
+	AwakeIndices.Reset();
+	if (!bReuseIslands || NumParticles != LastNumParticles || NumSleepingParticles != NumParticles)
+	{
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			if (!Particles[i].bIsSleeping)
+			{
+				AwakeIndices.Add(i);
+			}
+		}
+	}
+	LastNumParticles = NumParticles;
+
+	// 2. Colliders wake the sleeping islands they overlap
+	for (const TObjectPtr<UKawaiiFluidCollider>& Collider : Colliders)
+	{
+		if (!Collider || !Collider->IsColliderEnabled())
+		{
+			continue;
+		}
+
+		const FBox ColliderBounds = Collider->IsCacheValid() ? Collider->GetCachedBounds() : FBox(ForceInit);
+
+		for (int32 IslandIndex = 0; IslandIndex < NumSleepingIslands; ++IslandIndex)
+		{
+			FIsland& Island = Islands[IslandIndex];
+			if (Island.bDisturbed)
+			{
+				continue;
+			}
+
+			const FBox IslandBounds = Island.Bounds.ExpandBy(SmoothingRadius);
+			if (ColliderBounds.IsValid)
+			{
+				Island.bDisturbed = IslandBounds.Intersect(ColliderBounds);
+			}
+			else
+			{
+				// No cached bounds: conservative bounding-sphere test against the collider's SDF
+				FVector Gradient;
+				const float Distance = Collider->GetSignedDistance(IslandBounds.GetCenter(), Gradient);
+				Island.bDisturbed = Distance <= IslandBounds.GetExtent().Size();
+			}
+		}
+	}
+
+	// 3. Awake particles within the smoothing radius of a sleeping member wake its island
+	const int32 NumAwake = AwakeIndices.Num();
+	ContactIslands.SetNumUninitialized(NumAwake, EAllowShrinking::No);
+	if (NumSleepingIslands > 0)
+	{
+		ParallelFor(NumAwake, [&](int32 k)
+		{
+			ContactIslands[k] = FindContactIsland(Particles, Particles[AwakeIndices[k]].Position);
+		}, NumAwake < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+	else
+	{
+		for (int32 k = 0; k < NumAwake; ++k)
+		{
+			ContactIslands[k] = INDEX_NONE;
+		}
+	}
+
+	for (int32 k = 0; k < NumAwake; ++k)
+	{
+		if (ContactIslands[k] != INDEX_NONE)
+		{
+			Islands[ContactIslands[k]].bDisturbed = true;
+		}
+	}
+
+	bool bAnySleepingDisturbed = false;
+	for (int32 IslandIndex = 0; IslandIndex < NumSleepingIslands; ++IslandIndex)
+	{
+		bAnySleepingDisturbed |= Islands[IslandIndex].bDisturbed;
+	}
+
+	// Sleeping islands with no awake particle nearby and no collider overlap cannot change
+	if (NumAwake == 0 && !bAnySleepingDisturbed)
+	{
+		bLastUpdateSkipped = true;
+		return;
+	}
+
+	// 4. Connected components over the awake part of the neighbor graph
+	Parents.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	for (const int32 i : AwakeIndices)
+	{
+		Parents[i] = i;
+	}
+
+	for (const int32 i : AwakeIndices)
+	{
+		for (const int32 j : Particles[i].NeighborIndices)
+		{
+			if (j != i && j < NumParticles && !Particles[j].bIsSleeping)
+			{
+				Union(i, j);
+			}
+		}
+	}
+
+	// Awake islands are appended after the sleeping ones (ascending order: roots are visited first)
+	for (int32 k = 0; k < NumAwake; ++k)
+	{
+		const int32 i = AwakeIndices[k];
+		const int32 Root = FindRoot(i);
+		IslandOfParticle[i] = Root == i ? Islands.AddDefaulted() : IslandOfParticle[Root];
+
+		const FKawaiiFluidParticle& P = Particles[i];
+		FIsland& Island = Islands[IslandOfParticle[i]];
+		Island.Bounds += P.Position;
+		Island.SumSpeedSq += P.Velocity.SizeSquared();
+		Island.NumParticles++;
+		Island.MinSleepFrames = FMath::Min(Island.MinSleepFrames, P.SleepFrameCount);
+
+		// Touching a sleeping island wakes both sides
+		Island.bDisturbed |= ContactIslands[k] != INDEX_NONE;
+	}
+
+	// 5. Per-island decision; sleeping islands (kept, then newly asleep) move to the front
+	enum class EIslandAction : uint8 { Keep, Wake, Quiet, Active, Sleep };
+
+	const double SleepSpeedSq = FMath::Square(static_cast<double>(SleepVelocityThreshold));
+	const int32 NumPrevSleepingIslands = NumSleepingIslands;
+	TArray<EIslandAction, TInlineAllocator<64>> Actions;
+	TArray<int32, TInlineAllocator<64>> NextSleepFrames;
+	TArray<int32, TInlineAllocator<64>> Remap;
+	Actions.SetNumUninitialized(Islands.Num());
+	NextSleepFrames.SetNumUninitialized(Islands.Num());
+	Remap.SetNumUninitialized(Islands.Num());
+
+	bool bSleepingSetChanged = bAnySleepingDisturbed;
+	for (int32 IslandIndex = 0; IslandIndex < Islands.Num(); ++IslandIndex)
+	{
+		const FIsland& Island = Islands[IslandIndex];
+		NextSleepFrames[IslandIndex] = 0;
+
+		if (IslandIndex < NumPrevSleepingIslands)
+		{
+			Actions[IslandIndex] = Island.bDisturbed ? EIslandAction::Wake : EIslandAction::Keep;
+		}
+		else if (Island.bDisturbed)
+		{
+			Actions[IslandIndex] = EIslandAction::Wake;
+		}
+		else if (Island.SumSpeedSq < SleepSpeedSq * Island.NumParticles)
+		{
+			const int32 SleepFrames = (Island.MinSleepFrames == MAX_int32 ? 0 : Island.MinSleepFrames) + 1;
+			NextSleepFrames[IslandIndex] = SleepFrames;
+			Actions[IslandIndex] = SleepFrames >= SleepFrameThreshold ? EIslandAction::Sleep : EIslandAction::Quiet;
+			bSleepingSetChanged |= Actions[IslandIndex] == EIslandAction::Sleep;
+		}
+		else
+		{
+			Actions[IslandIndex] = EIslandAction::Active;
+		}
+	}
+
+	TArray<FIsland> NewIslands;
+	NewIslands.Reserve(Islands.Num());
+	NumSleepingParticles = 0;
+	for (const EIslandAction Pass : { EIslandAction::Keep, EIslandAction::Sleep })
+	{
+		for (int32 IslandIndex = 0; IslandIndex < Islands.Num(); ++IslandIndex)
+		{
+			if (Actions[IslandIndex] == Pass)
+			{
+				Remap[IslandIndex] = NewIslands.Add(Islands[IslandIndex]);
+				FIsland& Sleeping = NewIslands.Last();
+				Sleeping.NumSleeping = Sleeping.NumParticles;
+				Sleeping.SumSpeedSq = 0.0;
+				Sleeping.bDisturbed = false;
+				NumSleepingParticles += Sleeping.NumParticles;
+			}
+		}
+	}
+	NumSleepingIslands = NewIslands.Num();
+
+	for (int32 IslandIndex = 0; IslandIndex < Islands.Num(); ++IslandIndex)
+	{
+		if (Actions[IslandIndex] != EIslandAction::Keep && Actions[IslandIndex] != EIslandAction::Sleep)
+		{
+			Remap[IslandIndex] = NewIslands.Add(Islands[IslandIndex]);
+			NewIslands.Last().NumSleeping = 0;
+		}
+	}
+	Islands = MoveTemp(NewIslands);
+
+	auto ApplyAction = [&](int32 i)
+	{
+		FKawaiiFluidParticle& P = Particles[i];
+		const int32 IslandIndex = IslandOfParticle[i];
+		IslandOfParticle[i] = Remap[IslandIndex];
+
+		switch (Actions[IslandIndex])
+		{
+		case EIslandAction::Keep:
+			break;
+
+		case EIslandAction::Wake:
+		case EIslandAction::Active:
+			P.bIsSleeping = false;
+			P.SleepFrameCount = 0;
+			break;
+
+		case EIslandAction::Quiet:
+			P.SleepFrameCount = NextSleepFrames[IslandIndex];
+			break;
+
+		case EIslandAction::Sleep:
+			P.bIsSleeping = true;
+			P.SleepFrameCount = NextSleepFrames[IslandIndex];
+			P.SleepNeighborCount = P.NeighborIndices.Num();
+			P.Velocity = FVector::ZeroVector;
+			P.PredictedPosition = P.Position;
+			break;
+		}
+	};
+
+	// 6. Apply to the awake particles; sleeping members only need a pass when an island woke (indices shift)
+	if (bAnySleepingDisturbed)
+	{
+		ParallelFor(NumParticles, [&](int32 i)
+		{
+			ApplyAction(i);
+		}, NumParticles < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+	else
+	{
+		ParallelFor(NumAwake, [&](int32 k)
+		{
+			ApplyAction(AwakeIndices[k]);
+		}, NumAwake < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+
+	if (bSleepingSetChanged)
+	{
+		RebuildSleepingCells(Particles, SmoothingRadius);
+	}
+}
+
+/**
+ * @brief Wake every particle (e.g. sleeping was disabled on the preset).
+ * @param Particles In/Out particle array.
+ */
+void FKawaiiFluidIslandSolver::WakeAll(TArray<FKawaiiFluidParticle>& Particles)
+{
+	for (FKawaiiFluidParticle& P : Particles)
+	{
+		P.bIsSleeping = false;
+		P.SleepFrameCount = 0;
+	}
+
+	Islands.Reset();
+	SleepingCells.Reset();
+	SleepingCellParticles.Reset();
+	NumSleepingParticles = 0;
+	NumSleepingIslands = 0;
+	bIslandsValid = false;
+}
@@ -0,0 +1,172 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Physics/KawaiiFluidLODSolver.h"
+
+/**
+ * @brief Default constructor for FKawaiiFluidLODSolver.
+ */
+FKawaiiFluidLODSolver::FKawaiiFluidLODSolver()
+{
+}
+
+/**
+ * @brief Tier of a cell at a given view distance, with hysteresis around the tier distances.
+ * @param Distance Distance from the cell center to the nearest view (cm).
+ * @param PreviousTier Tier the cell had last frame (Near for newly occupied cells, with Hysteresis 0).
+ * @param FarDistance Distance beyond which the far tier starts (cm).
+ * @param FrozenDistance Distance beyond which the frozen tier starts (cm).
+ * @param Hysteresis Fraction of a tier distance to cross before switching.
+ * @return New tier.
+ */
+EKawaiiFluidLODTier FKawaiiFluidLODSolver::ResolveTier(float Distance, EKawaiiFluidLODTier PreviousTier, float FarDistance, float FrozenDistance, float Hysteresis)
+{
+	// Start distance of each tier (Near starts at 0)
+	const float TierStart[NumTiers] = { 0.0f, FarDistance, FMath::Max(FrozenDistance, FarDistance) };
+
+	int32 Tier = static_cast<int32>(PreviousTier);
+	while (Tier < NumTiers - 1 && Distance > TierStart[Tier + 1] * (1.0f + Hysteresis))
+	{
+		++Tier;
+	}
+	while (Tier > 0 && Distance < TierStart[Tier] * (1.0f - Hysteresis))
+	{
+		--Tier;
+	}
+	return static_cast<EKawaiiFluidLODTier>(Tier);
+}
+
+/**
+ * @brief Assign a tier to every occupied grid cell and to every particle.
+ * @param Particles Full particle array.
+ * @param ViewLocations World-space view locations (the nearest one decides).
+ * @param CellSize Grid cell size (cm), normally the spatial hash cell size.
+ * @param FarDistance Distance beyond which the far tier starts (cm).
+ * @param FrozenDistance Distance beyond which the frozen tier starts (cm).
+ * @param Hysteresis Fraction of a tier distance to cross before switching.
+ * @return True if any particle is outside the near tier.
+ */
+bool FKawaiiFluidLODSolver::Update(
+	const TArray<FKawaiiFluidParticle>& Particles,
+	TConstArrayView<FVector> ViewLocations,
+	float CellSize,
+	float FarDistance,
+	float FrozenDistance,
+	float Hysteresis)
+{
+	const int32 NumParticles = Particles.Num();
+	const float InvCellSize = CellSize > UE_SMALL_NUMBER ? 1.0f / CellSize : 0.0f;
+
+	ParticleTiers.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+	NextCellTiers.Reset();
+
+	for (FKawaiiFluidLODTierStats& Stats : TierStats)
+	{
+		Stats = FKawaiiFluidLODTierStats();
+	}
+
+	// Neighboring particles usually share a cell, so the last lookup is cached
+	FIntVector LastCell(MAX_int32);
+	EKawaiiFluidLODTier LastTier = EKawaiiFluidLODTier::Near;
+	bool bAnyCoarse = false;
+
+	for (int32 i = 0; i < NumParticles; ++i)
+	{
+		const FVector& Position = Particles[i].Position;
+		const FIntVector Cell(
+			FMath::FloorToInt(Position.X * InvCellSize),
+			FMath::FloorToInt(Position.Y * InvCellSize),
+			FMath::FloorToInt(Position.Z * InvCellSize));
+
+		if (Cell != LastCell)
+		{
+			if (const EKawaiiFluidLODTier* Known = NextCellTiers.Find(Cell))
+			{
+				LastTier = *Known;
+			}
+			else
+			{
+				const FVector CellCenter = (FVector(Cell) + FVector(0.5)) * CellSize;
+				double MinDistanceSq = UE_BIG_NUMBER;
+				for (const FVector& View : ViewLocations)
+				{
+					MinDistanceSq = FMath::Min(MinDistanceSq, FVector::DistSquared(CellCenter, View));
+				}
+				const float Distance = static_cast<float>(FMath::Sqrt(MinDistanceSq));
+
+				const EKawaiiFluidLODTier* Previous = CellTiers.Find(Cell);
+				LastTier = Previous
+					? ResolveTier(Distance, *Previous, FarDistance, FrozenDistance, Hysteresis)
+					: ResolveTier(Distance, EKawaiiFluidLODTier::Near, FarDistance, FrozenDistance, 0.0f);
+
+				NextCellTiers.Add(Cell, LastTier);
+				TierStats[static_cast<int32>(LastTier)].NumCells++;
+			}
+			LastCell = Cell;
+		}
+
+		ParticleTiers[i] = static_cast<uint8>(LastTier);
+		TierStats[static_cast<int32>(LastTier)].NumParticles++;
+		bAnyCoarse |= LastTier != EKawaiiFluidLODTier::Near;
+	}
+
+	// Cells nobody occupies any more drop their hysteresis state
+	Swap(CellTiers, NextCellTiers);
+
+	if (TierStats[static_cast<int32>(EKawaiiFluidLODTier::Far)].NumParticles == 0)
+	{
+		FarAccumulatedTime = 0.0f;
+	}
+
+	return bAnyCoarse;
+}
+
+/**
+ * @brief Advance the far-tier clock by the simulated time of the frame.
+ * @param SimulatedTime Time the near tier simulated this frame (s).
+ * @param FarSubstepDeltaTime Coarse far-tier substep (s).
+ * @param MaxFarSubsteps Upper limit on far substeps per frame.
+ * @return Number of coarse substeps the far tier should run now.
+ */
+int32 FKawaiiFluidLODSolver::AdvanceFarClock(float SimulatedTime, float FarSubstepDeltaTime, int32 MaxFarSubsteps)
+{
+	if (FarSubstepDeltaTime <= 0.0f)
+	{
+		return 0;
+	}
+
+	FarAccumulatedTime = FMath::Min(FarAccumulatedTime + SimulatedTime, FarSubstepDeltaTime * MaxFarSubsteps);
+
+	// The tolerance keeps float drift from dropping a coarse step that is due exactly now
+	const int32 NumSubsteps = FMath::Min(FMath::FloorToInt(FarAccumulatedTime / FarSubstepDeltaTime + 1.0e-3f), MaxFarSubsteps);
+	FarAccumulatedTime = FMath::Max(0.0f, FarAccumulatedTime - NumSubsteps * FarSubstepDeltaTime);
+	return NumSubsteps;
+}
+
+/**
+ * @brief Forget all tiers (LOD disabled or no view); every particle counts as near.
+ */
+void FKawaiiFluidLODSolver::Reset()
+{
+	CellTiers.Reset();
+	NextCellTiers.Reset();
+	ParticleTiers.Reset();
+	FarAccumulatedTime = 0.0f;
+
+	for (FKawaiiFluidLODTierStats& Stats : TierStats)
+	{
+		Stats = FKawaiiFluidLODTierStats();
+	}
+}
+
+/**
+ * @brief Record how many substeps a tier ran and how long it took.
+ * @param Tier LOD tier.
+ * @param NumSubsteps Substeps run this frame.
+ * @param TimeMs Wall-clock time (ms).
+ */
+void FKawaiiFluidLODSolver::SetTierTiming(EKawaiiFluidLODTier Tier, int32 NumSubsteps, double TimeMs)
+{
+	FKawaiiFluidLODTierStats& Stats = TierStats[static_cast<int32>(Tier)];
+	Stats.NumSubsteps = NumSubsteps;
+	Stats.TimeMs = TimeMs;
+}
@@ -0,0 +1,396 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Physics/KawaiiFluidNeighborForceSolver.h"
+#include "Simulation/Physics/KawaiiFluidSPHKernels.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+
+namespace
+{
+	constexpr float CM_TO_M_SQ = 0.01f * 0.01f;
+
+	/** Particles per task below which the symmetric mode does not split the work further */
+	constexpr int32 SymmetricMinBatchSize = 1024;
+
+	/**
+	 * @brief Sliding direction of an attached particle (gravity projected onto its surface).
+	 * @param Particle Attached particle.
+	 * @param Gravity World gravity (cm/s²).
+	 * @param OutTangentDir Normalized sliding direction.
+	 * @return False if the surface is too flat for stack pressure.
+	 */
+	bool ComputeStackTangent(const FKawaiiFluidParticle& Particle, const FVector& Gravity, FVector& OutTangentDir)
+	{
+		const FVector& SurfaceNormal = Particle.AttachedSurfaceNormal;
+		const FVector TangentGravity = Gravity - FVector::DotProduct(Gravity, SurfaceNormal) * SurfaceNormal;
+		const float TangentMag = TangentGravity.Size();
+
+		if (TangentMag < 0.1f)
+		{
+			return false;
+		}
+
+		OutTangentDir = TangentGravity / TangentMag;
+		return true;
+	}
+
+	/**
+	 * @brief Weight one attached neighbor above the particle adds to its stack.
+	 * @param Particle Attached particle receiving weight.
+	 * @param Neighbor Neighbor particle.
+	 * @param ToNeighbor Neighbor position minus particle position.
+	 * @param DistSq Squared length of ToNeighbor.
+	 * @param TangentDir Sliding direction of the particle.
+	 * @param StackRadius Stack pressure search radius (cm).
+	 * @return Weight contribution (0 if the neighbor does not rest on the particle).
+	 */
+	float ComputeStackPairWeight(
+		const FKawaiiFluidParticle& Particle,
+		const FKawaiiFluidParticle& Neighbor,
+		const FVector& ToNeighbor,
+		float DistSq,
+		const FVector& TangentDir,
+		float StackRadius)
+	{
+		if (!Neighbor.bIsAttached || Neighbor.AttachedActor != Particle.AttachedActor
+			|| DistSq > StackRadius * StackRadius || DistSq < KINDA_SMALL_NUMBER)
+		{
+			return 0.0f;
+		}
+
+		const float HeightDiff = -FVector::DotProduct(ToNeighbor, TangentDir);
+		if (HeightDiff <= 0.0f)
+		{
+			return 0.0f;
+		}
+
+		const float Dist = FMath::Sqrt(DistSq);
+		return Neighbor.Mass * SPHKernels::Poly6(Dist, StackRadius) * (HeightDiff / Dist);
+	}
+
+	/**
+	 * @brief Velocity change from stack pressure accumulated over a particle's neighbors.
+	 * @param TangentDir Sliding direction of the particle.
+	 * @param StackWeight Accumulated stack weight.
+	 * @param Params Pass inputs.
+	 * @return Velocity change (zero if negligible).
+	 */
+	FVector FinishStackPressure(const FVector& TangentDir, float StackWeight, const FKawaiiFluidNeighborForceParams& Params)
+	{
+		if (StackWeight <= 0.0f)
+		{
+			return FVector::ZeroVector;
+		}
+
+		const FVector StackForce = TangentDir * StackWeight * Params.StackPressureScale;
+		return StackForce.IsNearlyZero() ? FVector::ZeroVector : StackForce * Params.DeltaTime;
+	}
+}
+
+/**
+ * @brief Default constructor for FKawaiiFluidNeighborForceSolver.
+ */
+FKawaiiFluidNeighborForceSolver::FKawaiiFluidNeighborForceSolver()
+{
+}
+
+/**
+ * @brief Apply viscosity, cohesion and stack pressure in one neighbor pass.
+ * @param Particles Particle array with cached neighbor lists.
+ * @param Params Pass inputs.
+ * @param bSymmetricPairs Evaluate each unordered pair once instead of gathering per particle.
+ */
+void FKawaiiFluidNeighborForceSolver::Apply(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidNeighborForceParams& Params, bool bSymmetricPairs)
+{
+	const bool bAnyTerm = Params.ViscosityCoeff > 0.0f || Params.CohesionStrength > 0.0f
+		|| (Params.bStackPressure && Params.StackPressureScale > 0.0f && Params.DeltaTime > 0.0f);
+
+	if (!bAnyTerm || Particles.Num() == 0)
+	{
+		return;
+	}
+
+	if (bSymmetricPairs)
+	{
+		ApplySymmetric(Particles, Params);
+	}
+	else
+	{
+		ApplyGather(Particles, Params);
+	}
+}
+
+/**
+ * @brief Per-particle gather: every particle visits its neighbors once and evaluates all terms.
+ * @param Particles Particle array with cached neighbor lists.
+ * @param Params Pass inputs.
+ */
+void FKawaiiFluidNeighborForceSolver::ApplyGather(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidNeighborForceParams& Params)
+{
+	const int32 ParticleCount = Particles.Num();
+
+	SPHKernels::FKernelCoefficients KernelCoeffs;
+	KernelCoeffs.Precompute(Params.SmoothingRadius);
+
+	const bool bViscosity = Params.ViscosityCoeff > 0.0f;
+	const bool bCohesion = Params.CohesionStrength > 0.0f;
+	const bool bStack = Params.bStackPressure && Params.StackPressureScale > 0.0f && Params.DeltaTime > 0.0f;
+
+	const float RadiusSq = Params.SmoothingRadius * Params.SmoothingRadius;
+	const float MaxRadiusSq = FMath::Max(RadiusSq, Params.StackPressureRadius * Params.StackPressureRadius);
+
+	// Viscosity reads neighbor velocities, so the result goes to a buffer first
+	VelocityDeltas.SetNumUninitialized(ParticleCount, EAllowShrinking::No);
+
+	ParallelFor(ParticleCount, [&](int32 i)
+	{
+		const FKawaiiFluidParticle& Particle = Particles[i];
+
+		FVector TangentDir = FVector::ZeroVector;
+		const bool bParticleStack = bStack && Particle.bIsAttached && ComputeStackTangent(Particle, Params.Gravity, TangentDir);
+
+		FVector ViscositySum = FVector::ZeroVector;
+		float ViscosityWeight = 0.0f;
+		FVector CohesionForce = FVector::ZeroVector;
+		float StackWeight = 0.0f;
+
+		for (int32 NeighborIdx : Particle.NeighborIndices)
+		{
+			if (NeighborIdx == i)
+			{
+				continue;
+			}
+
+			const FKawaiiFluidParticle& Neighbor = Particles[NeighborIdx];
+			const FVector r = Particle.Position - Neighbor.Position;
+			const float rSquared = r.SizeSquared();
+
+			if (rSquared > MaxRadiusSq)
+			{
+				continue;
+			}
+
+			if (rSquared <= RadiusSq)
+			{
+				if (bViscosity)
+				{
+					const float diff = KernelCoeffs.h2 - rSquared * CM_TO_M_SQ;
+					const float Weight = (diff > 0.0f) ? KernelCoeffs.Poly6Coeff * diff * diff * diff : 0.0f;
+					ViscositySum += (Neighbor.Velocity - Particle.Velocity) * Weight;
+					ViscosityWeight += Weight;
+				}
+
+				if (bCohesion)
+				{
+					const float Distance = FMath::Sqrt(rSquared);
+					if (Distance >= KINDA_SMALL_NUMBER)
+					{
+						CohesionForce -= Params.CohesionStrength * SPHKernels::Cohesion(Distance, Params.SmoothingRadius) * (r / Distance);
+					}
+				}
+			}
+
+			if (bParticleStack)
+			{
+				StackWeight += ComputeStackPairWeight(Particle, Neighbor, -r, rSquared, TangentDir, Params.StackPressureRadius);
+			}
+		}
+
+		FVector Delta = CohesionForce;
+		if (ViscosityWeight > 0.0f)
+		{
+			Delta += Params.ViscosityCoeff * (ViscositySum / ViscosityWeight);
+		}
+		if (bParticleStack)
+		{
+			Delta += FinishStackPressure(TangentDir, StackWeight, Params);
+		}
+		VelocityDeltas[i] = Delta;
+
+	}, EParallelForFlags::Unbalanced);
+
+	ParallelFor(ParticleCount, [&](int32 i)
+	{
+		Particles[i].Velocity += VelocityDeltas[i];
+	}, ParticleCount < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+/**
+ * @brief Half-pair traversal: kernels are evaluated once per pair and scattered to both particles.
+ *
+ * Each task owns a contiguous particle range and accumulators sized to that range only, so the
+ * scatter needs no atomics and the buffers total one entry per particle. A pair whose higher index
+ * lies in a later task's range is buffered for that task and added during its reduce. Pairs are
+ * taken from the lower index's neighbor list, which relies on symmetric neighbor lists (true for the
+ * spatial hash radius query on the same positions).
+ *
+ * @param Particles Particle array with cached neighbor lists.
+ * @param Params Pass inputs.
+ */
+void FKawaiiFluidNeighborForceSolver::ApplySymmetric(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidNeighborForceParams& Params)
+{
+	const int32 ParticleCount = Particles.Num();
+
+	SPHKernels::FKernelCoefficients KernelCoeffs;
+	KernelCoeffs.Precompute(Params.SmoothingRadius);
+
+	const bool bViscosity = Params.ViscosityCoeff > 0.0f;
+	const bool bCohesion = Params.CohesionStrength > 0.0f;
+	const bool bPairTerms = bViscosity || bCohesion;
+	const bool bStack = Params.bStackPressure && Params.StackPressureScale > 0.0f && Params.DeltaTime > 0.0f;
+	const float RadiusSq = Params.SmoothingRadius * Params.SmoothingRadius;
+
+	const int32 NumTasks = FMath::Clamp(
+		FMath::DivideAndRoundUp(ParticleCount, SymmetricMinBatchSize), 1, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+	const int32 TaskSize = FMath::DivideAndRoundUp(ParticleCount, NumTasks);
+	const EParallelForFlags TaskFlags = NumTasks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+
+	if (TaskAccumulators.Num() < NumTasks)
+	{
+		TaskAccumulators.SetNum(NumTasks);
+	}
+
+	// 1. Pair terms, once per unordered pair
+	if (bPairTerms)
+	{
+		ParallelFor(NumTasks, [&](int32 TaskIndex)
+		{
+			const int32 Begin = TaskIndex * TaskSize;
+			const int32 End = FMath::Min(Begin + TaskSize, ParticleCount);
+			const int32 RangeCount = FMath::Max(End - Begin, 0);
+
+			FPairAccumulator& Accumulator = TaskAccumulators[TaskIndex];
+			Accumulator.ViscositySums.SetNumUninitialized(RangeCount, EAllowShrinking::No);
+			Accumulator.ViscosityWeights.SetNumUninitialized(RangeCount, EAllowShrinking::No);
+			Accumulator.CohesionForces.SetNumUninitialized(RangeCount, EAllowShrinking::No);
+			FMemory::Memzero(Accumulator.ViscositySums.GetData(), RangeCount * sizeof(FVector));
+			FMemory::Memzero(Accumulator.ViscosityWeights.GetData(), RangeCount * sizeof(float));
+			FMemory::Memzero(Accumulator.CohesionForces.GetData(), RangeCount * sizeof(FVector));
+
+			Accumulator.CrossPairs.SetNum(NumTasks, EAllowShrinking::No);
+			for (TArray<FCrossPair>& Bucket : Accumulator.CrossPairs)
+			{
+				Bucket.Reset();
+			}
+
+			for (int32 i = Begin; i < End; ++i)
+			{
+				const FKawaiiFluidParticle& Particle = Particles[i];
+				const int32 Local = i - Begin;
+
+				for (int32 j : Particle.NeighborIndices)
+				{
+					if (j <= i)
+					{
+						continue;
+					}
+
+					const FKawaiiFluidParticle& Neighbor = Particles[j];
+					const FVector r = Particle.Position - Neighbor.Position;
+					const float rSquared = r.SizeSquared();
+
+					if (rSquared > RadiusSq)
+					{
+						continue;
+					}
+
+					FVector WeightedDiff = FVector::ZeroVector;
+					float Weight = 0.0f;
+					if (bViscosity)
+					{
+						const float diff = KernelCoeffs.h2 - rSquared * CM_TO_M_SQ;
+						Weight = (diff > 0.0f) ? KernelCoeffs.Poly6Coeff * diff * diff * diff : 0.0f;
+						WeightedDiff = (Neighbor.Velocity - Particle.Velocity) * Weight;
+					}
+
+					FVector Force = FVector::ZeroVector;
+					if (bCohesion)
+					{
+						const float Distance = FMath::Sqrt(rSquared);
+						if (Distance >= KINDA_SMALL_NUMBER)
+						{
+							Force = Params.CohesionStrength * SPHKernels::Cohesion(Distance, Params.SmoothingRadius) * (r / Distance);
+						}
+					}
+
+					Accumulator.ViscositySums[Local] += WeightedDiff;
+					Accumulator.ViscosityWeights[Local] += Weight;
+					Accumulator.CohesionForces[Local] -= Force;
+
+					// j > i, so a neighbor outside the range always belongs to a later task
+					if (j < End)
+					{
+						Accumulator.ViscositySums[j - Begin] -= WeightedDiff;
+						Accumulator.ViscosityWeights[j - Begin] += Weight;
+						Accumulator.CohesionForces[j - Begin] += Force;
+					}
+					else
+					{
+						Accumulator.CrossPairs[j / TaskSize].Add({ j, Weight, -WeightedDiff, Force });
+					}
+				}
+			}
+		}, TaskFlags);
+	}
+
+	// 2. Per task: add the pairs buffered by earlier tasks, then finish the range; stack pressure is
+	//    gathered here for attached particles. Only positions are read from here on, so velocities
+	//    can be written in place.
+	ParallelFor(NumTasks, [&](int32 TaskIndex)
+	{
+		const int32 Begin = TaskIndex * TaskSize;
+		const int32 End = FMath::Min(Begin + TaskSize, ParticleCount);
+
+		if (bPairTerms)
+		{
+			FPairAccumulator& Accumulator = TaskAccumulators[TaskIndex];
+			for (int32 SourceTask = 0; SourceTask < TaskIndex; ++SourceTask)
+			{
+				for (const FCrossPair& Pair : TaskAccumulators[SourceTask].CrossPairs[TaskIndex])
+				{
+					const int32 Local = Pair.Index - Begin;
+					Accumulator.ViscositySums[Local] += Pair.ViscositySum;
+					Accumulator.ViscosityWeights[Local] += Pair.ViscosityWeight;
+					Accumulator.CohesionForces[Local] += Pair.CohesionForce;
+				}
+			}
+		}
+
+		for (int32 i = Begin; i < End; ++i)
+		{
+			FKawaiiFluidParticle& Particle = Particles[i];
+			FVector Delta = FVector::ZeroVector;
+
+			if (bPairTerms)
+			{
+				const FPairAccumulator& Accumulator = TaskAccumulators[TaskIndex];
+				const int32 Local = i - Begin;
+				Delta += Accumulator.CohesionForces[Local];
+
+				if (Accumulator.ViscosityWeights[Local] > 0.0f)
+				{
+					Delta += Params.ViscosityCoeff * (Accumulator.ViscositySums[Local] / Accumulator.ViscosityWeights[Local]);
+				}
+			}
+
+			FVector TangentDir;
+			if (bStack && Particle.bIsAttached && ComputeStackTangent(Particle, Params.Gravity, TangentDir))
+			{
+				float StackWeight = 0.0f;
+				for (int32 NeighborIdx : Particle.NeighborIndices)
+				{
+					if (NeighborIdx == i)
+					{
+						continue;
+					}
+
+					const FVector ToNeighbor = Particles[NeighborIdx].Position - Particle.Position;
+					StackWeight += ComputeStackPairWeight(Particle, Particles[NeighborIdx], ToNeighbor, ToNeighbor.SizeSquared(), TangentDir, Params.StackPressureRadius);
+				}
+				Delta += FinishStackPressure(TangentDir, StackWeight, Params);
+			}
+
+			Particle.Velocity += Delta;
+		}
+	}, TaskFlags);
+}
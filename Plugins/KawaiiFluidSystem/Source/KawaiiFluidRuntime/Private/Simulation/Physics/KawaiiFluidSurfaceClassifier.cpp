@@ -0,0 +1,217 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Physics/KawaiiFluidSurfaceClassifier.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	EParallelForFlags GetForFlags(int32 Num)
+	{
+		return Num < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+	}
+}
+
+/**
+ * @brief Classify surface particles, write their flags and normals, and compact the surface list.
+ * @param Particles In/Out particles with up-to-date neighbor lists (bIsSurfaceParticle holds last frame's state).
+ * @param Params Classification inputs.
+ */
+void FKawaiiFluidSurfaceClassifier::Classify(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidSurfaceParams& Params)
+{
+	const int32 Num = Particles.Num();
+	const float H = Params.SmoothingRadius;
+	if (Num == 0 || H <= 0.0f)
+	{
+		Reset();
+		return;
+	}
+
+	Asymmetry.SetNumUninitialized(Num, EAllowShrinking::No);
+	Normals.SetNumUninitialized(Num, EAllowShrinking::No);
+	NeighborCounts.SetNumUninitialized(Num, EAllowShrinking::No);
+
+	// 1. Color-field gradient and neighbor count
+	const float H2 = H * H;
+	const float InvH = 1.0f / H;
+	ParallelFor(Num, [&](int32 i)
+	{
+		const FVector3f Position(Particles[i].Position);
+		FVector3f Gradient = FVector3f::ZeroVector;
+		float GradientMagnitudeSum = 0.0f;
+		int32 Count = 0;
+
+		for (const int32 j : Particles[i].NeighborIndices)
+		{
+			if (j == i)
+			{
+				continue;
+			}
+
+			const FVector3f Diff = Position - FVector3f(Particles[j].Position);
+			const float DistSq = Diff.SizeSquared();
+			if (DistSq >= H2)
+			{
+				continue;
+			}
+
+			++Count;
+			if (DistSq < UE_KINDA_SMALL_NUMBER)
+			{
+				continue;
+			}
+
+			// Spiky gradient profile (h - r)^2 along the unit offset, pointing away from the neighbor
+			const float Dist = FMath::Sqrt(DistSq);
+			const float Falloff = FMath::Square(1.0f - Dist * InvH);
+			Gradient += Diff * (Falloff / Dist);
+			GradientMagnitudeSum += Falloff;
+		}
+
+		const float GradientSize = Gradient.Size();
+		Asymmetry[i] = GradientMagnitudeSum > 0.0f ? GradientSize / GradientMagnitudeSum : 1.0f;
+		Normals[i] = GradientSize > UE_KINDA_SMALL_NUMBER ? Gradient / GradientSize : FVector3f::ZeroVector;
+		NeighborCounts[i] = Count;
+	}, GetForFlags(Num));
+
+	LastReferenceNeighborCount = Params.ReferenceNeighborCount > 0.0f ? Params.ReferenceNeighborCount : EstimateReferenceNeighborCount();
+
+	// 2. Score with hysteresis, write the particles and count surface particles per chunk
+	const int32 NumChunks = FMath::DivideAndRoundUp(Num, ChunkSize);
+	ChunkOffsets.SetNumZeroed(NumChunks + 1, EAllowShrinking::No);
+	const float NormalSmoothing = FMath::Clamp(Params.NormalSmoothing, 0.0f, 1.0f);
+
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		const int32 Begin = Chunk * ChunkSize;
+		const int32 End = FMath::Min(Begin + ChunkSize, Num);
+		int32 ChunkCount = 0;
+
+		for (int32 i = Begin; i < End; ++i)
+		{
+			FKawaiiFluidParticle& Particle = Particles[i];
+			const float Score = ComputeScore(Asymmetry[i], NeighborCounts[i], LastReferenceNeighborCount, Params);
+			const bool bWasSurface = Particle.bIsSurfaceParticle;
+			const bool bIsSurface = ResolveSurface(Score, bWasSurface, Params.ExitRatio);
+
+			FVector3f Normal = bIsSurface ? Normals[i] : FVector3f::ZeroVector;
+			if (bIsSurface && bWasSurface)
+			{
+				const FVector3f PrevNormal(Particle.SurfaceNormal);
+				if (Normal.IsZero())
+				{
+					// Isolated particle: no gradient, keep the last direction
+					Normal = PrevNormal;
+				}
+				else if (NormalSmoothing > 0.0f && !PrevNormal.IsZero())
+				{
+					Normal = FMath::Lerp(Normal, PrevNormal, NormalSmoothing).GetSafeNormal(UE_SMALL_NUMBER, Normal);
+				}
+			}
+
+			Particle.bIsSurfaceParticle = bIsSurface;
+			Particle.SurfaceNormal = FVector(Normal);
+			Normals[i] = Normal;
+			ChunkCount += bIsSurface ? 1 : 0;
+		}
+
+		ChunkOffsets[Chunk + 1] = ChunkCount;
+	}, GetForFlags(Num));
+
+	for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+	{
+		ChunkOffsets[Chunk + 1] += ChunkOffsets[Chunk];
+	}
+
+	// 3. Compact in index order
+	SurfaceIndices.SetNumUninitialized(ChunkOffsets[NumChunks], EAllowShrinking::No);
+	SurfaceNormals.SetNumUninitialized(ChunkOffsets[NumChunks], EAllowShrinking::No);
+
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		const int32 Begin = Chunk * ChunkSize;
+		const int32 End = FMath::Min(Begin + ChunkSize, Num);
+		int32 Write = ChunkOffsets[Chunk];
+
+		for (int32 i = Begin; i < End; ++i)
+		{
+			if (Particles[i].bIsSurfaceParticle)
+			{
+				SurfaceIndices[Write] = i;
+				SurfaceNormals[Write] = Normals[i];
+				++Write;
+			}
+		}
+	}, GetForFlags(Num));
+}
+
+/**
+ * @brief Drop the surface list (particle flags are left as they are).
+ */
+void FKawaiiFluidSurfaceClassifier::Reset()
+{
+	SurfaceIndices.Reset();
+	SurfaceNormals.Reset();
+	LastReferenceNeighborCount = 0.0f;
+}
+
+/**
+ * @brief Surface score of one particle (1 = threshold).
+ * @param InAsymmetry Normalized color-field gradient (0 inside, about 0.5 on a flat surface, 1 alone).
+ * @param NumNeighbors Neighbors within the kernel radius, the particle itself excluded.
+ * @param ReferenceNeighborCount Neighbor count of an interior particle.
+ * @param Params Classification inputs.
+ * @return Larger of the gradient and deficiency scores.
+ */
+float FKawaiiFluidSurfaceClassifier::ComputeScore(float InAsymmetry, int32 NumNeighbors, float ReferenceNeighborCount, const FKawaiiFluidSurfaceParams& Params)
+{
+	const float GradientScore = InAsymmetry / FMath::Max(Params.GradientThreshold, UE_KINDA_SMALL_NUMBER);
+
+	float DeficiencyScore = 0.0f;
+	if (Params.NeighborDeficiency > 0.0f && ReferenceNeighborCount > 0.0f)
+	{
+		const float Missing = 1.0f - static_cast<float>(NumNeighbors) / ReferenceNeighborCount;
+		DeficiencyScore = FMath::Max(Missing, 0.0f) / FMath::Max(1.0f - Params.NeighborDeficiency, UE_KINDA_SMALL_NUMBER);
+	}
+
+	return FMath::Max(GradientScore, DeficiencyScore);
+}
+
+/**
+ * @brief Schmitt trigger: enter at score 1, leave below ExitRatio.
+ * @param Score Surface score of this frame.
+ * @param bWasSurface Classification of the previous frame.
+ * @param ExitRatio Exit threshold (clamped to 0..1).
+ * @return True if the particle is on the surface this frame.
+ */
+bool FKawaiiFluidSurfaceClassifier::ResolveSurface(float Score, bool bWasSurface, float ExitRatio)
+{
+	return Score >= (bWasSurface ? FMath::Clamp(ExitRatio, 0.0f, 1.0f) : 1.0f);
+}
+
+/**
+ * @brief Interior neighbor count of the frame: mean count of the particles at or above the overall mean.
+ * @return Reference neighbor count (0 if no particle has neighbors).
+ */
+float FKawaiiFluidSurfaceClassifier::EstimateReferenceNeighborCount() const
+{
+	int64 Sum = 0;
+	for (const int32 Count : NeighborCounts)
+	{
+		Sum += Count;
+	}
+
+	// Surface particles pull the plain mean down; the upper half approximates the interior
+	const double Mean = static_cast<double>(Sum) / NeighborCounts.Num();
+	int64 UpperSum = 0;
+	int32 UpperNum = 0;
+	for (const int32 Count : NeighborCounts)
+	{
+		if (Count >= Mean)
+		{
+			UpperSum += Count;
+			++UpperNum;
+		}
+	}
+
+	return UpperNum > 0 ? static_cast<float>(static_cast<double>(UpperSum) / UpperNum) : 0.0f;
+}
@@ -55,3 +55,26 @@ void FCompactStatsExCS::ModifyCompilationEnvironment(
 	FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
 	OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
 }
+
+IMPLEMENT_GLOBAL_SHADER(FPackReadbackCS,
+	"/Plugin/KawaiiFluidSystem/Private/Simulation/KawaiiFluidSimulationDataLayout.usf",
+	"PackReadbackCS", SF_Compute);
+
+/**
+ * @brief Check if readback packing shader permutation should be compiled.
+ */
+bool FPackReadbackCS::ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+{
+	return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+}
+
+/**
+ * @brief Modify readback packing shader compilation environment.
+ */
+void FPackReadbackCS::ModifyCompilationEnvironment(
+	const FGlobalShaderPermutationParameters& Parameters,
+	FShaderCompilerEnvironment& OutEnvironment)
+{
+	FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	OutEnvironment.SetDefine(TEXT("THREAD_GROUP_SIZE"), ThreadGroupSize);
+}
@@ -0,0 +1,279 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidBoundaryPass.h"
+#include "Core/KawaiiFluidParticle.h"
+#include "Core/KawaiiFluidSimulationStats.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/**
+	 * @brief Box constants shared by every particle of a pass.
+	 */
+	struct FBoundaryPassConstants
+	{
+		FVector Center;
+		FVector LocalMin;
+		FVector LocalMax;
+		FQuat Rotation;
+		FQuat InverseRotation;
+		float Bounce;
+		float TangentScale;
+	};
+
+	/**
+	 * @brief Clamp one particle to the box in local space and reflect/damp its velocity.
+	 * @param P Particle to resolve (PredictedPosition is tested, both positions are written on contact).
+	 * @param C Pass constants.
+	 */
+	template <bool bRotated>
+	FORCEINLINE void ResolveParticle(FKawaiiFluidParticle& P, const FBoundaryPassConstants& C)
+	{
+		FVector LocalPos = P.PredictedPosition - C.Center;
+		FVector LocalVel = P.Velocity;
+		if constexpr (bRotated)
+		{
+			LocalPos = C.InverseRotation.RotateVector(LocalPos);
+			LocalVel = C.InverseRotation.RotateVector(LocalVel);
+		}
+
+		bool bCollided = false;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const int32 AxisA = (Axis + 1) % 3;
+			const int32 AxisB = (Axis + 2) % 3;
+
+			if (LocalPos[Axis] < C.LocalMin[Axis])
+			{
+				LocalPos[Axis] = C.LocalMin[Axis];
+				if (LocalVel[Axis] < 0.0)
+				{
+					LocalVel[Axis] = -LocalVel[Axis] * C.Bounce;
+				}
+				LocalVel[AxisA] *= C.TangentScale;
+				LocalVel[AxisB] *= C.TangentScale;
+				bCollided = true;
+			}
+			else if (LocalPos[Axis] > C.LocalMax[Axis])
+			{
+				LocalPos[Axis] = C.LocalMax[Axis];
+				if (LocalVel[Axis] > 0.0)
+				{
+					LocalVel[Axis] = -LocalVel[Axis] * C.Bounce;
+				}
+				LocalVel[AxisA] *= C.TangentScale;
+				LocalVel[AxisB] *= C.TangentScale;
+				bCollided = true;
+			}
+		}
+
+		if (bCollided)
+		{
+			if constexpr (bRotated)
+			{
+				LocalPos = C.Rotation.RotateVector(LocalPos);
+				LocalVel = C.Rotation.RotateVector(LocalVel);
+			}
+			P.PredictedPosition = C.Center + LocalPos;
+			P.Position = P.PredictedPosition;
+			P.Velocity = LocalVel;
+		}
+	}
+
+	/**
+	 * @brief Add one particle's final state to the frame statistics.
+	 * @param Accumulator Chunk accumulator.
+	 * @param P Particle after containment.
+	 * @param InvRestDensity 1 / rest density (0 skips density error).
+	 */
+	FORCEINLINE void AccumulateParticleStats(FKawaiiFluidStatsAccumulator& Accumulator, const FKawaiiFluidParticle& P, float InvRestDensity)
+	{
+		Accumulator.AddParticle(static_cast<float>(P.Velocity.Size()), P.Density, P.Mass, P.NeighborIndices.Num(), InvRestDensity);
+		Accumulator.AttachedCount += P.bIsAttached ? 1 : 0;
+		Accumulator.GroundContactCount += P.bNearGround ? 1 : 0;
+	}
+
+	/**
+	 * @brief Chunked parallel sweep: optional containment, optional per-chunk min/max and statistics merged at the end.
+	 * @param Particles Particles to process.
+	 * @param Constants Pass constants (ignored when bResolve is false).
+	 * @param OutStats Frame statistics to merge into (reducing sweeps only, nullptr = none).
+	 * @param InvRestDensity 1 / rest density for the density error statistics.
+	 * @return Particle AABB (invalid when bReduce is false or there are no particles).
+	 */
+	template <bool bResolve, bool bReduce, bool bRotated>
+	FBox RunBoundaryPass(TArrayView<FKawaiiFluidParticle> Particles, const FBoundaryPassConstants& Constants,
+		FKawaiiFluidStatsAccumulator* OutStats = nullptr, float InvRestDensity = 0.0f)
+	{
+		const int32 NumParticles = Particles.Num();
+		const int32 ChunkSize = FKawaiiFluidBoundaryPass::ChunkSize;
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumParticles, ChunkSize);
+		if (NumChunks == 0)
+		{
+			return FBox(ForceInit);
+		}
+
+		TArray<FVector, TInlineAllocator<128>> ChunkMin;
+		TArray<FVector, TInlineAllocator<128>> ChunkMax;
+		TArray<FKawaiiFluidStatsAccumulator> ChunkStats;
+		if constexpr (bReduce)
+		{
+			ChunkMin.SetNumUninitialized(NumChunks);
+			ChunkMax.SetNumUninitialized(NumChunks);
+			if (OutStats)
+			{
+				ChunkStats.SetNum(NumChunks);
+			}
+		}
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 Start = ChunkIndex * ChunkSize;
+			const int32 End = FMath::Min(Start + ChunkSize, NumParticles);
+
+			FVector LocalMin(UE_BIG_NUMBER);
+			FVector LocalMax(-UE_BIG_NUMBER);
+			FKawaiiFluidStatsAccumulator* Stats = ChunkStats.Num() > 0 ? &ChunkStats[ChunkIndex] : nullptr;
+
+			for (int32 i = Start; i < End; ++i)
+			{
+				FKawaiiFluidParticle& P = Particles[i];
+				if constexpr (bResolve)
+				{
+					ResolveParticle<bRotated>(P, Constants);
+				}
+				if constexpr (bReduce)
+				{
+					LocalMin = LocalMin.ComponentMin(P.Position);
+					LocalMax = LocalMax.ComponentMax(P.Position);
+					if (Stats)
+					{
+						AccumulateParticleStats(*Stats, P, InvRestDensity);
+					}
+				}
+			}
+
+			if constexpr (bReduce)
+			{
+				ChunkMin[ChunkIndex] = LocalMin;
+				ChunkMax[ChunkIndex] = LocalMax;
+			}
+		}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		if constexpr (bReduce)
+		{
+			FVector BoundsMin = ChunkMin[0];
+			FVector BoundsMax = ChunkMax[0];
+			for (int32 ChunkIndex = 1; ChunkIndex < NumChunks; ++ChunkIndex)
+			{
+				BoundsMin = BoundsMin.ComponentMin(ChunkMin[ChunkIndex]);
+				BoundsMax = BoundsMax.ComponentMax(ChunkMax[ChunkIndex]);
+			}
+
+			// Merged in chunk order so the statistics do not depend on scheduling
+			for (const FKawaiiFluidStatsAccumulator& Stats : ChunkStats)
+			{
+				OutStats->Merge(Stats);
+			}
+			return FBox(BoundsMin, BoundsMax);
+		}
+		else
+		{
+			return FBox(ForceInit);
+		}
+	}
+
+	/**
+	 * @brief Precompute the per-pass box constants.
+	 * @param Box Containment box.
+	 * @return Pass constants.
+	 */
+	FBoundaryPassConstants MakeConstants(const FKawaiiFluidBoundaryBox& Box)
+	{
+		FBoundaryPassConstants Constants;
+		Constants.Center = Box.Center;
+		Constants.LocalMin = -Box.HalfExtent;
+		Constants.LocalMax = Box.HalfExtent;
+		Constants.Rotation = Box.Rotation;
+		Constants.InverseRotation = Box.Rotation.Inverse();
+		Constants.Bounce = Box.Bounce;
+		Constants.TangentScale = 1.0f - Box.Friction;
+		return Constants;
+	}
+
+	/**
+	 * @brief Dispatch to the rotated or axis-aligned kernel.
+	 * @param Particles Particles to process.
+	 * @param Box Containment box.
+	 * @param OutStats Frame statistics to merge into (nullptr = none).
+	 * @param InvRestDensity 1 / rest density for the density error statistics.
+	 * @return Particle AABB when bReduce is true.
+	 */
+	template <bool bReduce>
+	FBox DispatchBoundaryPass(TArrayView<FKawaiiFluidParticle> Particles, const FKawaiiFluidBoundaryBox& Box,
+		FKawaiiFluidStatsAccumulator* OutStats = nullptr, float InvRestDensity = 0.0f)
+	{
+		const FBoundaryPassConstants Constants = MakeConstants(Box);
+		if (Box.Rotation.Equals(FQuat::Identity))
+		{
+			return RunBoundaryPass<true, bReduce, false>(Particles, Constants, OutStats, InvRestDensity);
+		}
+		return RunBoundaryPass<true, bReduce, true>(Particles, Constants, OutStats, InvRestDensity);
+	}
+}
+
+/**
+ * @brief Build an axis-aligned boundary box from world bounds, shrunk by the particle radius.
+ * @param Bounds Container box (cm).
+ * @param Inset Distance kept from every wall (typically the particle radius).
+ * @param InBounce Wall restitution.
+ * @param InFriction Wall friction.
+ * @return Boundary box.
+ */
+FKawaiiFluidBoundaryBox FKawaiiFluidBoundaryBox::FromAABB(const FBox& Bounds, float Inset, float InBounce, float InFriction)
+{
+	FKawaiiFluidBoundaryBox Box;
+	Box.Center = Bounds.GetCenter();
+	Box.HalfExtent = (Bounds.GetExtent() - FVector(Inset)).ComponentMax(FVector::ZeroVector);
+	Box.Bounce = InBounce;
+	Box.Friction = InFriction;
+	return Box;
+}
+
+/**
+ * @brief Confine particles to the box without computing bounds.
+ * @param Particles Particles to confine.
+ * @param Box Containment box.
+ */
+void FKawaiiFluidBoundaryPass::Resolve(TArrayView<FKawaiiFluidParticle> Particles, const FKawaiiFluidBoundaryBox& Box)
+{
+	DispatchBoundaryPass<false>(Particles, Box);
+}
+
+/**
+ * @brief Confine particles to the box and return the AABB of the resolved positions in the same sweep.
+ * @param Particles Particles to confine.
+ * @param Box Containment box.
+ * @param OutStats Frame statistics of the resolved particles are merged into this (nullptr = none).
+ * @param InvRestDensity 1 / rest density for the density error statistics (0 = skip).
+ * @return AABB of particle positions (invalid if empty).
+ */
+FBox FKawaiiFluidBoundaryPass::ResolveAndComputeBounds(TArrayView<FKawaiiFluidParticle> Particles, const FKawaiiFluidBoundaryBox& Box,
+	FKawaiiFluidStatsAccumulator* OutStats, float InvRestDensity)
+{
+	return DispatchBoundaryPass<true>(Particles, Box, OutStats, InvRestDensity);
+}
+
+/**
+ * @brief Parallel min/max reduction of particle positions.
+ * @param Particles Particles to bound.
+ * @param OutStats Frame statistics of the particles are merged into this (nullptr = none).
+ * @param InvRestDensity 1 / rest density for the density error statistics (0 = skip).
+ * @return AABB of particle positions (invalid if empty).
+ */
+FBox FKawaiiFluidBoundaryPass::ComputeBounds(TConstArrayView<FKawaiiFluidParticle> Particles, FKawaiiFluidStatsAccumulator* OutStats, float InvRestDensity)
+{
+	// The reduce-only kernel never writes, so the const cast is safe
+	const TArrayView<FKawaiiFluidParticle> Mutable(const_cast<FKawaiiFluidParticle*>(Particles.GetData()), Particles.Num());
+	return RunBoundaryPass<false, true, false>(Mutable, FBoundaryPassConstants{}, OutStats, InvRestDensity);
+}
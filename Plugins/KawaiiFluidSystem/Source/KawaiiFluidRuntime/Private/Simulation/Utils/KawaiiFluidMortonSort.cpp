@@ -0,0 +1,115 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidMortonSort.h"
+
+/**
+ * @brief Sort precomputed keys.
+ * @param InKeys Key per element.
+ * @param KeyBits Significant key bits (higher bits must be zero).
+ */
+void FKawaiiFluidMortonSorter::Sort(TConstArrayView<uint32> InKeys, int32 KeyBits)
+{
+	Keys.SetNumUninitialized(InKeys.Num(), EAllowShrinking::No);
+	FMemory::Memcpy(Keys.GetData(), InKeys.GetData(), InKeys.Num() * sizeof(uint32));
+	SortKeys(KeyBits);
+}
+
+/**
+ * @brief Stable LSD radix sort of Keys with 8-bit digits, then the inverse permutation.
+ * @param KeyBits Significant key bits.
+ */
+void FKawaiiFluidMortonSorter::SortKeys(int32 KeyBits)
+{
+	const int32 Num = Keys.Num();
+	const int32 NumChunks = FMath::Max(FMath::DivideAndRoundUp(Num, ChunkSize), 1);
+	const EParallelForFlags ForFlags = NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+	SortedIndices.SetNumUninitialized(Num, EAllowShrinking::No);
+	KeysScratch.SetNumUninitialized(Num, EAllowShrinking::No);
+	IndicesScratch.SetNumUninitialized(Num, EAllowShrinking::No);
+	ChunkCursors.SetNumUninitialized(NumChunks * NumBuckets, EAllowShrinking::No);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 End = FMath::Min((ChunkIndex + 1) * ChunkSize, Num);
+		for (int32 i = ChunkIndex * ChunkSize; i < End; ++i)
+		{
+			SortedIndices[i] = static_cast<uint32>(i);
+		}
+	}, ForFlags);
+
+	const int32 NumPasses = FMath::DivideAndRoundUp(FMath::Clamp(KeyBits, 1, 32), RadixBits);
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		const uint32 Shift = static_cast<uint32>(Pass * RadixBits);
+
+		// Per-chunk digit histograms
+		FMemory::Memzero(ChunkCursors.GetData(), ChunkCursors.Num() * sizeof(int32));
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 End = FMath::Min((ChunkIndex + 1) * ChunkSize, Num);
+			int32* Counts = ChunkCursors.GetData() + ChunkIndex * NumBuckets;
+			for (int32 i = ChunkIndex * ChunkSize; i < End; ++i)
+			{
+				++Counts[(Keys[i] >> Shift) & (NumBuckets - 1)];
+			}
+		}, ForFlags);
+
+		// Exclusive scan in (digit, chunk) order; chunks of one digit stay in chunk order (stability)
+		int32 Running = 0;
+		bool bSingleDigit = false;
+		for (int32 Digit = 0; Digit < NumBuckets; ++Digit)
+		{
+			const int32 DigitStart = Running;
+			for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+			{
+				int32& Cursor = ChunkCursors[ChunkIndex * NumBuckets + Digit];
+				const int32 Count = Cursor;
+				Cursor = Running;
+				Running += Count;
+			}
+			bSingleDigit |= Running - DigitStart == Num;
+		}
+
+		// Every key has the same digit: the pass would not move anything
+		if (bSingleDigit)
+		{
+			continue;
+		}
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 End = FMath::Min((ChunkIndex + 1) * ChunkSize, Num);
+			int32* Cursors = ChunkCursors.GetData() + ChunkIndex * NumBuckets;
+			for (int32 i = ChunkIndex * ChunkSize; i < End; ++i)
+			{
+				const int32 Dest = Cursors[(Keys[i] >> Shift) & (NumBuckets - 1)]++;
+				KeysScratch[Dest] = Keys[i];
+				IndicesScratch[Dest] = SortedIndices[i];
+			}
+		}, ForFlags);
+
+		Swap(Keys, KeysScratch);
+		Swap(SortedIndices, IndicesScratch);
+	}
+
+	// Inverse permutation, counting moved elements per chunk (first cursor row is free again)
+	NewIndices.SetNumUninitialized(Num, EAllowShrinking::No);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 End = FMath::Min((ChunkIndex + 1) * ChunkSize, Num);
+		int32 ChunkMoved = 0;
+		for (int32 i = ChunkIndex * ChunkSize; i < End; ++i)
+		{
+			NewIndices[SortedIndices[i]] = static_cast<uint32>(i);
+			ChunkMoved += SortedIndices[i] != static_cast<uint32>(i) ? 1 : 0;
+		}
+		ChunkCursors[ChunkIndex] = ChunkMoved;
+	}, ForFlags);
+
+	NumMoved = 0;
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		NumMoved += ChunkCursors[ChunkIndex];
+	}
+}
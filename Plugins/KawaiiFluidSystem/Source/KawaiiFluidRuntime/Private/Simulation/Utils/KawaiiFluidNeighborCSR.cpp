@@ -0,0 +1,121 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidNeighborCSR.h"
+#include "Simulation/Utils/KawaiiFluidSparseBrickGrid.h"
+#include "Core/KawaiiFluidParticle.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	EParallelForFlags GetForFlags(int32 Num)
+	{
+		return Num < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+	}
+
+	/**
+	 * @brief Visit every particle within Radius of particle P through the grid's 27 surrounding cells.
+	 * @param Visitor Callable (int32 NeighborIndex).
+	 */
+	template <typename VisitorType>
+	void ForEachNeighbor(int32 P, TConstArrayView<FVector3f> Positions, float Radius, const FKawaiiFluidSparseBrickGrid& Grid,
+		TConstArrayView<uint32> SortedIndices, VisitorType&& Visitor)
+	{
+		const FVector3f& Position = Positions[P];
+		const FIntVector Center = KawaiiFluidMorton::WorldToCell(Position, Radius);
+		const float RadiusSq = Radius * Radius;
+
+		for (int32 Dz = -1; Dz <= 1; ++Dz)
+		{
+			for (int32 Dy = -1; Dy <= 1; ++Dy)
+			{
+				for (int32 Dx = -1; Dx <= 1; ++Dx)
+				{
+					uint32 Start = 0;
+					uint32 End = 0;
+					if (!Grid.FindCell(Center + FIntVector(Dx, Dy, Dz), Start, End))
+					{
+						continue;
+					}
+
+					for (uint32 k = Start; k <= End; ++k)
+					{
+						const int32 Q = static_cast<int32>(SortedIndices[k]);
+						if (Q != P && FVector3f::DistSquared(Position, Positions[Q]) < RadiusSq)
+						{
+							Visitor(Q);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief Flatten the cached NeighborIndices of the CPU particles.
+ * @param Particles Particles with up-to-date neighbor lists.
+ */
+void FKawaiiFluidNeighborCSR::BuildFromParticles(const TArray<FKawaiiFluidParticle>& Particles)
+{
+	const int32 Num = Particles.Num();
+	Offsets.SetNumUninitialized(Num + 1, EAllowShrinking::No);
+
+	Offsets[0] = 0;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Offsets[i + 1] = Offsets[i] + Particles[i].NeighborIndices.Num();
+	}
+
+	Indices.SetNumUninitialized(Offsets[Num], EAllowShrinking::No);
+	ParallelFor(Num, [&](int32 i)
+	{
+		const TArray<int32>& Neighbors = Particles[i].NeighborIndices;
+		FMemory::Memcpy(Indices.GetData() + Offsets[i], Neighbors.GetData(), Neighbors.Num() * sizeof(int32));
+	}, GetForFlags(Num));
+}
+
+/**
+ * @brief Radius search over bare positions: count pass, prefix sum, fill pass.
+ * @param Positions Particle positions (cm).
+ * @param Radius Search radius (cm).
+ * @param Grid Reused grid (cell size = Radius).
+ * @param Sorter Reused sorter.
+ */
+void FKawaiiFluidNeighborCSR::BuildFromPositions(TConstArrayView<FVector3f> Positions, float Radius, FKawaiiFluidSparseBrickGrid& Grid, FKawaiiFluidMortonSorter& Sorter)
+{
+	const int32 Num = Positions.Num();
+	Offsets.SetNumUninitialized(Num + 1, EAllowShrinking::No);
+	Offsets[0] = 0;
+	if (Num == 0 || Radius <= 0.0f)
+	{
+		FMemory::Memzero(Offsets.GetData(), Offsets.Num() * sizeof(int32));
+		Indices.Reset();
+		return;
+	}
+
+	Grid.SetLayout(Radius, 3);
+	Grid.Build(Num, [&Positions](int32 Index) { return Positions[Index]; }, Sorter);
+	const TConstArrayView<uint32> SortedIndices = Sorter.GetSortedIndices();
+
+	// Walk particles in sorted order so neighboring queries touch the same cells
+	ParallelFor(Num, [&](int32 k)
+	{
+		const int32 P = static_cast<int32>(SortedIndices[k]);
+		int32 Count = 0;
+		ForEachNeighbor(P, Positions, Radius, Grid, SortedIndices, [&Count](int32) { ++Count; });
+		Offsets[P + 1] = Count;
+	}, GetForFlags(Num));
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Offsets[i + 1] += Offsets[i];
+	}
+
+	Indices.SetNumUninitialized(Offsets[Num], EAllowShrinking::No);
+	ParallelFor(Num, [&](int32 k)
+	{
+		const int32 P = static_cast<int32>(SortedIndices[k]);
+		int32 Write = Offsets[P];
+		ForEachNeighbor(P, Positions, Radius, Grid, SortedIndices, [this, &Write](int32 Q) { Indices[Write++] = Q; });
+	}, GetForFlags(Num));
+}
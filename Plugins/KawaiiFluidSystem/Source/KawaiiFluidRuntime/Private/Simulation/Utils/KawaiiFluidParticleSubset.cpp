@@ -0,0 +1,138 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidParticleSubset.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/**
+	 * @brief Grid cell of a position for the read-only neighbor search.
+	 * @param Position World-space position.
+	 * @param CellSize Cell size (smoothing radius).
+	 * @return Integer cell coordinate.
+	 */
+	FIntVector GetSubsetCell(const FVector& Position, float CellSize)
+	{
+		return FIntVector(
+			FMath::FloorToInt(Position.X / CellSize),
+			FMath::FloorToInt(Position.Y / CellSize),
+			FMath::FloorToInt(Position.Z / CellSize)
+		);
+	}
+}
+
+/**
+ * @brief Append copies of the particles left out that lie in or next to a cell of a gathered particle.
+ *
+ * Must follow Gather (before any substep). The copies start at rest in their current position:
+ * PredictedPosition = Position, neighbor lists cleared.
+ *
+ * @param FullParticles Full particle array passed to Gather.
+ * @param CellSize Grid cell size, normally the smoothing radius.
+ */
+void FKawaiiFluidParticleSubset::GatherReadOnlyNeighbors(const TArray<FKawaiiFluidParticle>& FullParticles, float CellSize)
+{
+	check(Particles.Num() == NumSolved);
+	if (NumSolved == 0 || NumSolved == FullParticles.Num() || CellSize <= 0.0f)
+	{
+		return;
+	}
+
+	// Cells occupied by the gathered particles, then grown by one cell
+	TSet<FIntVector> OccupiedCells;
+	for (const FKawaiiFluidParticle& P : Particles)
+	{
+		OccupiedCells.Add(GetSubsetCell(P.Position, CellSize));
+	}
+
+	TSet<FIntVector> NeighborCells;
+	NeighborCells.Reserve(OccupiedCells.Num() * 4);
+	for (const FIntVector& Cell : OccupiedCells)
+	{
+		for (int32 DZ = -1; DZ <= 1; ++DZ)
+		{
+			for (int32 DY = -1; DY <= 1; ++DY)
+			{
+				for (int32 DX = -1; DX <= 1; ++DX)
+				{
+					NeighborCells.Add(Cell + FIntVector(DX, DY, DZ));
+				}
+			}
+		}
+	}
+
+	// Gathered entries are moved-from but keep their positions; they are excluded below
+	const int32 NumFull = FullParticles.Num();
+	ReadOnlyFlags.SetNumUninitialized(NumFull, EAllowShrinking::No);
+	ParallelFor(NumFull, [&](int32 i)
+	{
+		ReadOnlyFlags[i] = NeighborCells.Contains(GetSubsetCell(FullParticles[i].Position, CellSize)) ? 1 : 0;
+	}, NumFull < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	for (int32 k = 0; k < NumSolved; ++k)
+	{
+		ReadOnlyFlags[Indices[k]] = 0;
+	}
+
+	for (int32 i = 0; i < NumFull; ++i)
+	{
+		if (!ReadOnlyFlags[i])
+		{
+			continue;
+		}
+
+		const FKawaiiFluidParticle& Source = FullParticles[i];
+		Indices.Add(i);
+		ReadOnlyPositions.Add(Source.Position);
+		ReadOnlyVelocities.Add(Source.Velocity);
+
+		FKawaiiFluidParticle& Copy = Particles.Add_GetRef(Source);
+		Copy.PredictedPosition = Copy.Position;
+		Copy.NeighborIndices.Reset();
+	}
+}
+
+/**
+ * @brief Reset the read-only neighbors to their copied state (called after stages that move particles).
+ * @param SubsetParticles Array returned by Gather.
+ */
+void FKawaiiFluidParticleSubset::PinReadOnlyNeighbors(TArray<FKawaiiFluidParticle>& SubsetParticles) const
+{
+	const int32 NumReadOnly = ReadOnlyPositions.Num();
+	check(SubsetParticles.Num() == NumSolved + NumReadOnly);
+
+	ParallelFor(NumReadOnly, [&](int32 k)
+	{
+		FKawaiiFluidParticle& P = SubsetParticles[NumSolved + k];
+		P.Position = ReadOnlyPositions[k];
+		P.PredictedPosition = ReadOnlyPositions[k];
+		P.Velocity = ReadOnlyVelocities[k];
+	}, NumReadOnly < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+/**
+ * @brief Move the gathered particles back and remap their neighbor lists to full-array indices.
+ *
+ * Neighbors among the read-only copies map to the particles they were copied from; the copies are dropped.
+ *
+ * @param FullParticles Full particle array passed to Gather.
+ */
+void FKawaiiFluidParticleSubset::Scatter(TArray<FKawaiiFluidParticle>& FullParticles)
+{
+	check(Particles.Num() == Indices.Num());
+
+	ParallelFor(NumSolved, [&](int32 k)
+	{
+		FKawaiiFluidParticle& P = Particles[k];
+		for (int32& Neighbor : P.NeighborIndices)
+		{
+			Neighbor = Indices[Neighbor];
+		}
+		FullParticles[Indices[k]] = MoveTemp(P);
+	}, NumSolved < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	Particles.Reset();
+	ReadOnlyPositions.Reset();
+	ReadOnlyVelocities.Reset();
+	NumSolved = 0;
+}
@@ -0,0 +1,336 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidReadbackLayout.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "Async/ParallelFor.h"
+#include "Math/Float16.h"
+
+namespace
+{
+	/** Particles per ParallelFor chunk in the unpack pass */
+	constexpr int32 UnpackChunkSize = 4096;
+
+	enum EFieldIndex : int32
+	{
+		PositionIndex,
+		VelocityIndex,
+		ParticleIDIndex,
+		SourceIDIndex,
+		FlagsIndex,
+		NeighborCountIndex,
+		DensityIndex,
+		MassIndex
+	};
+
+	/**
+	 * @brief Words a field occupies on its own (shared 16-bit pairs are handled by the caller).
+	 * @param FieldIndex Field index.
+	 * @param bQuantize Whether velocity is stored as half3.
+	 * @return Encoding and word count.
+	 */
+	TPair<EKawaiiFluidReadbackEncoding, int32> GetStandaloneEncoding(int32 FieldIndex, bool bQuantize)
+	{
+		switch (FieldIndex)
+		{
+		case PositionIndex:
+			return { EKawaiiFluidReadbackEncoding::Float3, 3 };
+		case VelocityIndex:
+			return bQuantize ? TPair<EKawaiiFluidReadbackEncoding, int32>{ EKawaiiFluidReadbackEncoding::Half3, 2 }
+				: TPair<EKawaiiFluidReadbackEncoding, int32>{ EKawaiiFluidReadbackEncoding::Float3, 3 };
+		default:
+			return { EKawaiiFluidReadbackEncoding::Word, 1 };
+		}
+	}
+
+	uint32 FloatToHalfBits(float Value)
+	{
+		return FFloat16(Value).Encoded;
+	}
+
+	float HalfBitsToFloat(uint32 Bits)
+	{
+		FFloat16 Half;
+		Half.Encoded = static_cast<uint16>(Bits & 0xFFFF);
+		return Half.GetFloat();
+	}
+
+	/**
+	 * @brief Helper: Vector column of a field (Position/Velocity), sized for the unpack.
+	 */
+	FVector3f* GetVectorColumn(FKawaiiFluidReadbackColumns& Columns, int32 FieldIndex)
+	{
+		return FieldIndex == PositionIndex ? Columns.Positions.GetData() : Columns.Velocities.GetData();
+	}
+
+	/**
+	 * @brief Helper: Scalar column of a field viewed as raw 32-bit words (all scalar columns are 4 bytes wide).
+	 */
+	uint32* GetScalarColumn(FKawaiiFluidReadbackColumns& Columns, int32 FieldIndex)
+	{
+		switch (FieldIndex)
+		{
+		case ParticleIDIndex:		return reinterpret_cast<uint32*>(Columns.ParticleIDs.GetData());
+		case SourceIDIndex:			return reinterpret_cast<uint32*>(Columns.SourceIDs.GetData());
+		case FlagsIndex:			return Columns.Flags.GetData();
+		case NeighborCountIndex:	return Columns.NeighborCounts.GetData();
+		case DensityIndex:			return reinterpret_cast<uint32*>(Columns.Densities.GetData());
+		case MassIndex:				return reinterpret_cast<uint32*>(Columns.Masses.GetData());
+		default:					return nullptr;
+		}
+	}
+
+	/**
+	 * @brief Helper: Raw 32-bit value of a scalar field of a particle.
+	 */
+	uint32 GetScalarBits(const FGPUFluidParticle& Particle, int32 FieldIndex)
+	{
+		switch (FieldIndex)
+		{
+		case ParticleIDIndex:		return static_cast<uint32>(Particle.ParticleID);
+		case SourceIDIndex:			return static_cast<uint32>(Particle.SourceID);
+		case FlagsIndex:			return Particle.Flags;
+		case NeighborCountIndex:	return Particle.NeighborCount;
+		case DensityIndex:			return FMath::AsUInt(Particle.Density);
+		case MassIndex:				return FMath::AsUInt(Particle.Mass);
+		default:					return 0;
+		}
+	}
+
+	/**
+	 * @brief Helper: Resize the columns of the layout's fields and empty the others.
+	 */
+	void PrepareColumns(const FKawaiiFluidReadbackLayout& Layout, int32 NumParticles, FKawaiiFluidReadbackColumns& Columns)
+	{
+		auto Prepare = [&](auto& Column, uint32 Field)
+		{
+			if (Layout.HasField(Field))
+			{
+				Column.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+			}
+			else
+			{
+				Column.Reset();
+			}
+		};
+
+		Prepare(Columns.Positions, EKawaiiFluidReadbackField::Position);
+		Prepare(Columns.Velocities, EKawaiiFluidReadbackField::Velocity);
+		Prepare(Columns.ParticleIDs, EKawaiiFluidReadbackField::ParticleID);
+		Prepare(Columns.SourceIDs, EKawaiiFluidReadbackField::SourceID);
+		Prepare(Columns.Flags, EKawaiiFluidReadbackField::Flags);
+		Prepare(Columns.NeighborCounts, EKawaiiFluidReadbackField::NeighborCount);
+		Prepare(Columns.Densities, EKawaiiFluidReadbackField::Density);
+		Prepare(Columns.Masses, EKawaiiFluidReadbackField::Mass);
+	}
+}
+
+/**
+ * @brief Lay out the requested fields in field-index order.
+ * @param FieldMask EKawaiiFluidReadbackField bits.
+ * @param bQuantize Use half3 velocity and shared 16-bit words for NeighborCount/Flags and Density/Mass.
+ * @return Packed record layout.
+ */
+FKawaiiFluidReadbackLayout FKawaiiFluidReadbackLayout::Build(uint32 FieldMask, bool bQuantize)
+{
+	FKawaiiFluidReadbackLayout Layout;
+	Layout.FieldMask = FieldMask & EKawaiiFluidReadbackField::All;
+	Layout.bQuantized = bQuantize;
+
+	const bool bShareFlagsWord = bQuantize && Layout.HasField(EKawaiiFluidReadbackField::Flags) && Layout.HasField(EKawaiiFluidReadbackField::NeighborCount);
+	const bool bShareDensityWord = bQuantize && Layout.HasField(EKawaiiFluidReadbackField::Density) && Layout.HasField(EKawaiiFluidReadbackField::Mass);
+
+	int32 WordOffset = 0;
+	for (int32 FieldIndex = 0; FieldIndex < EKawaiiFluidReadbackField::NumFields; ++FieldIndex)
+	{
+		if (!Layout.HasField(1u << FieldIndex))
+		{
+			continue;
+		}
+
+		FKawaiiFluidReadbackFieldSlot& Slot = Layout.Slots.AddDefaulted_GetRef();
+		Slot.FieldIndex = FieldIndex;
+
+		// The second half of a shared word reuses the word opened by the first half
+		if ((bShareFlagsWord && FieldIndex == NeighborCountIndex) || (bShareDensityWord && FieldIndex == MassIndex))
+		{
+			Slot.WordOffset = WordOffset - 1;
+			Slot.Encoding = FieldIndex == MassIndex ? EKawaiiFluidReadbackEncoding::HalfHigh : EKawaiiFluidReadbackEncoding::High16;
+			continue;
+		}
+
+		Slot.WordOffset = WordOffset;
+		if ((bShareFlagsWord && FieldIndex == FlagsIndex) || (bShareDensityWord && FieldIndex == DensityIndex))
+		{
+			Slot.Encoding = FieldIndex == DensityIndex ? EKawaiiFluidReadbackEncoding::HalfLow : EKawaiiFluidReadbackEncoding::Low16;
+			WordOffset += 1;
+			continue;
+		}
+
+		const TPair<EKawaiiFluidReadbackEncoding, int32> Standalone = GetStandaloneEncoding(FieldIndex, bQuantize);
+		Slot.Encoding = Standalone.Key;
+		WordOffset += Standalone.Value;
+	}
+
+	Layout.StrideWords = WordOffset;
+	check(Layout.StrideWords <= MaxStrideWords);
+	return Layout;
+}
+
+/**
+ * @brief Slot of a field.
+ * @param Field Single EKawaiiFluidReadbackField bit.
+ * @return Slot, or nullptr if the field is not in the layout.
+ */
+const FKawaiiFluidReadbackFieldSlot* FKawaiiFluidReadbackLayout::FindSlot(uint32 Field) const
+{
+	const int32 FieldIndex = FMath::CountTrailingZeros(Field);
+	return Slots.FindByPredicate([FieldIndex](const FKawaiiFluidReadbackFieldSlot& Slot) { return Slot.FieldIndex == FieldIndex; });
+}
+
+/**
+ * @brief Decode packed records into SoA columns, one slot at a time per chunk.
+ * @param Layout Layout the records were packed with.
+ * @param Records Packed records (NumParticles * StrideWords words).
+ * @param NumParticles Number of records.
+ * @param OutColumns Destination; columns of missing fields are emptied.
+ */
+void FKawaiiFluidReadbackUnpacker::Unpack(const FKawaiiFluidReadbackLayout& Layout, const uint32* Records, int32 NumParticles, FKawaiiFluidReadbackColumns& OutColumns)
+{
+	PrepareColumns(Layout, NumParticles, OutColumns);
+	if (NumParticles <= 0 || Layout.IsEmpty() || !Records)
+	{
+		return;
+	}
+
+	const int32 Stride = Layout.StrideWords;
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumParticles, UnpackChunkSize);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * UnpackChunkSize;
+		const int32 End = FMath::Min(Start + UnpackChunkSize, NumParticles);
+
+		for (const FKawaiiFluidReadbackFieldSlot& Slot : Layout.Slots)
+		{
+			const uint32* Source = Records + Slot.WordOffset;
+
+			switch (Slot.Encoding)
+			{
+			case EKawaiiFluidReadbackEncoding::Float3:
+			{
+				FVector3f* Column = GetVectorColumn(OutColumns, Slot.FieldIndex);
+				for (int32 i = Start; i < End; ++i)
+				{
+					const uint32* Word = Source + i * Stride;
+					Column[i] = FVector3f(FMath::AsFloat(Word[0]), FMath::AsFloat(Word[1]), FMath::AsFloat(Word[2]));
+				}
+				break;
+			}
+			case EKawaiiFluidReadbackEncoding::Half3:
+			{
+				FVector3f* Column = GetVectorColumn(OutColumns, Slot.FieldIndex);
+				for (int32 i = Start; i < End; ++i)
+				{
+					const uint32* Word = Source + i * Stride;
+					Column[i] = FVector3f(HalfBitsToFloat(Word[0]), HalfBitsToFloat(Word[0] >> 16), HalfBitsToFloat(Word[1]));
+				}
+				break;
+			}
+			case EKawaiiFluidReadbackEncoding::Word:
+			{
+				uint32* Column = GetScalarColumn(OutColumns, Slot.FieldIndex);
+				for (int32 i = Start; i < End; ++i)
+				{
+					Column[i] = Source[i * Stride];
+				}
+				break;
+			}
+			case EKawaiiFluidReadbackEncoding::Low16:
+			case EKawaiiFluidReadbackEncoding::High16:
+			{
+				const uint32 Shift = Slot.Encoding == EKawaiiFluidReadbackEncoding::High16 ? 16 : 0;
+				uint32* Column = GetScalarColumn(OutColumns, Slot.FieldIndex);
+				for (int32 i = Start; i < End; ++i)
+				{
+					Column[i] = (Source[i * Stride] >> Shift) & 0xFFFF;
+				}
+				break;
+			}
+			case EKawaiiFluidReadbackEncoding::HalfLow:
+			case EKawaiiFluidReadbackEncoding::HalfHigh:
+			{
+				const uint32 Shift = Slot.Encoding == EKawaiiFluidReadbackEncoding::HalfHigh ? 16 : 0;
+				uint32* Column = GetScalarColumn(OutColumns, Slot.FieldIndex);
+				for (int32 i = Start; i < End; ++i)
+				{
+					Column[i] = FMath::AsUInt(HalfBitsToFloat(Source[i * Stride] >> Shift));
+				}
+				break;
+			}
+			}
+		}
+	}, NumParticles < UnpackChunkSize ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+/**
+ * @brief CPU reference of the GPU packing pass (PackReadbackCS).
+ * @param Layout Record layout.
+ * @param Particles Source particles.
+ * @param OutRecords Packed records (Particles.Num() * StrideWords words).
+ */
+void FKawaiiFluidReadbackUnpacker::Pack(const FKawaiiFluidReadbackLayout& Layout, TConstArrayView<FGPUFluidParticle> Particles, TArray<uint32>& OutRecords)
+{
+	const int32 Stride = Layout.StrideWords;
+	OutRecords.SetNumUninitialized(Particles.Num() * Stride);
+	if (Stride > 0)
+	{
+		FMemory::Memzero(OutRecords.GetData(), OutRecords.Num() * sizeof(uint32));
+	}
+
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		const FGPUFluidParticle& Particle = Particles[i];
+		uint32* Record = OutRecords.GetData() + i * Stride;
+
+		for (const FKawaiiFluidReadbackFieldSlot& Slot : Layout.Slots)
+		{
+			uint32* Word = Record + Slot.WordOffset;
+
+			switch (Slot.Encoding)
+			{
+			case EKawaiiFluidReadbackEncoding::Float3:
+			case EKawaiiFluidReadbackEncoding::Half3:
+			{
+				const FVector3f& Value = Slot.FieldIndex == PositionIndex ? Particle.Position : Particle.Velocity;
+				if (Slot.Encoding == EKawaiiFluidReadbackEncoding::Float3)
+				{
+					Word[0] = FMath::AsUInt(Value.X);
+					Word[1] = FMath::AsUInt(Value.Y);
+					Word[2] = FMath::AsUInt(Value.Z);
+				}
+				else
+				{
+					Word[0] = FloatToHalfBits(Value.X) | (FloatToHalfBits(Value.Y) << 16);
+					Word[1] = FloatToHalfBits(Value.Z);
+				}
+				break;
+			}
+			case EKawaiiFluidReadbackEncoding::Word:
+				Word[0] = GetScalarBits(Particle, Slot.FieldIndex);
+				break;
+			case EKawaiiFluidReadbackEncoding::Low16:
+				Word[0] |= FMath::Min(GetScalarBits(Particle, Slot.FieldIndex), 0xFFFFu);
+				break;
+			case EKawaiiFluidReadbackEncoding::High16:
+				Word[0] |= FMath::Min(GetScalarBits(Particle, Slot.FieldIndex), 0xFFFFu) << 16;
+				break;
+			case EKawaiiFluidReadbackEncoding::HalfLow:
+				Word[0] |= FloatToHalfBits(FMath::AsFloat(GetScalarBits(Particle, Slot.FieldIndex)));
+				break;
+			case EKawaiiFluidReadbackEncoding::HalfHigh:
+				Word[0] |= FloatToHalfBits(FMath::AsFloat(GetScalarBits(Particle, Slot.FieldIndex))) << 16;
+				break;
+			}
+		}
+	}
+}
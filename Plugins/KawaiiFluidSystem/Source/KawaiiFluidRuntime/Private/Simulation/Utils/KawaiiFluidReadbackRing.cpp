@@ -0,0 +1,71 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidReadbackRing.h"
+
+/**
+ * @brief Add one consumed readback to the age histogram.
+ * @param AgeFrames Frames between enqueue and consume.
+ */
+void FKawaiiFluidReadbackRingStats::RecordAge(uint64 AgeFrames)
+{
+	const int32 Bucket = static_cast<int32>(FMath::Min<uint64>(AgeFrames, NumAgeBuckets - 1));
+	++AgeHistogram[Bucket];
+	LastAge = static_cast<int32>(FMath::Min<uint64>(AgeFrames, MAX_int32));
+}
+
+/**
+ * @brief Mean age of consumed readbacks.
+ * @return Mean age in frames (0 if nothing was consumed).
+ */
+float FKawaiiFluidReadbackRingStats::GetMeanAge() const
+{
+	uint64 Total = 0;
+	uint64 WeightedSum = 0;
+	for (int32 Bucket = 0; Bucket < NumAgeBuckets; ++Bucket)
+	{
+		Total += AgeHistogram[Bucket];
+		WeightedSum += AgeHistogram[Bucket] * static_cast<uint64>(Bucket);
+	}
+	return Total > 0 ? static_cast<float>(static_cast<double>(WeightedSum) / static_cast<double>(Total)) : 0.0f;
+}
+
+/**
+ * @brief Age bucket below which the given fraction of consumed readbacks falls.
+ * @param Fraction Fraction in [0, 1] (0.5 = median).
+ * @return Age in frames (NumAgeBuckets - 1 means "that old or older").
+ */
+int32 FKawaiiFluidReadbackRingStats::GetAgePercentile(float Fraction) const
+{
+	uint64 Total = 0;
+	for (const uint64 Count : AgeHistogram)
+	{
+		Total += Count;
+	}
+	if (Total == 0)
+	{
+		return 0;
+	}
+
+	const uint64 Threshold = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(Fraction, 0.0f, 1.0f) * Total)));
+	uint64 Running = 0;
+	for (int32 Bucket = 0; Bucket < NumAgeBuckets; ++Bucket)
+	{
+		Running += AgeHistogram[Bucket];
+		if (Running >= Threshold)
+		{
+			return Bucket;
+		}
+	}
+	return NumAgeBuckets - 1;
+}
+
+/**
+ * @brief One-line summary for logs.
+ * @return Formatted telemetry.
+ */
+FString FKawaiiFluidReadbackRingStats::ToString() const
+{
+	return FString::Printf(TEXT("Depth=%d InFlight=%d (max %d) Enqueued=%llu Consumed=%llu Stale=%llu Overrun=%llu Discarded=%llu Age mean=%.2f p50=%d p95=%d"),
+		Depth, FramesInFlight, MaxFramesInFlight, NumEnqueued, NumConsumed, NumDroppedStale, NumDroppedOverrun, NumDiscarded,
+		GetMeanAge(), GetAgePercentile(0.5f), GetAgePercentile(0.95f));
+}
@@ -0,0 +1,123 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidSourceParticleIndex.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "Async/ParallelFor.h"
+
+/**
+ * @brief Rebuild the index with a three-pass counting sort (max SourceID, count, scatter), each pass parallel over chunks.
+ * @param SourceIDs SourceID per particle (-1 or out of range = no source).
+ * @param ParticleIDs ParticleID per particle, parallel to SourceIDs.
+ */
+void FKawaiiFluidSourceParticleIndex::Build(TConstArrayView<int32> SourceIDs, TConstArrayView<int32> ParticleIDs)
+{
+	check(SourceIDs.Num() == ParticleIDs.Num());
+
+	const int32 NumParticles = SourceIDs.Num();
+	if (NumParticles == 0)
+	{
+		Reset();
+		return;
+	}
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumParticles, ChunkSize);
+	const EParallelForFlags ForFlags = NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+	// Pass 1: table width = highest valid SourceID + 1 (SourceIDs are dense slot indices)
+	ChunkMaxSourceIDs.SetNumUninitialized(NumChunks, EAllowShrinking::No);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, NumParticles);
+
+		int32 MaxSourceID = INDEX_NONE;
+		for (int32 i = Start; i < End; ++i)
+		{
+			const int32 SourceID = SourceIDs[i];
+			if (SourceID < EGPUParticleSource::MaxSourceCount)
+			{
+				MaxSourceID = FMath::Max(MaxSourceID, SourceID);
+			}
+		}
+		ChunkMaxSourceIDs[ChunkIndex] = MaxSourceID;
+	}, ForFlags);
+
+	int32 NumSources = 0;
+	for (const int32 MaxSourceID : ChunkMaxSourceIDs)
+	{
+		NumSources = FMath::Max(NumSources, MaxSourceID + 1);
+	}
+
+	SourceOffsets.SetNumUninitialized(NumSources + 1, EAllowShrinking::No);
+	if (NumSources == 0)
+	{
+		SourceOffsets[0] = 0;
+		SortedParticleIDs.Reset();
+		return;
+	}
+
+	// Pass 2: per-chunk histograms, one flat row per chunk
+	ChunkCursors.SetNumUninitialized(NumChunks * NumSources, EAllowShrinking::No);
+	FMemory::Memzero(ChunkCursors.GetData(), ChunkCursors.Num() * sizeof(int32));
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, NumParticles);
+
+		int32* Counts = ChunkCursors.GetData() + ChunkIndex * NumSources;
+		for (int32 i = Start; i < End; ++i)
+		{
+			const int32 SourceID = SourceIDs[i];
+			if (SourceID >= 0 && SourceID < NumSources)
+			{
+				++Counts[SourceID];
+			}
+		}
+	}, ForFlags);
+
+	// Exclusive scan in (source, chunk) order turns the counts into write cursors.
+	// Chunks of one source are laid out in chunk order, which keeps each source's IDs in input order.
+	int32 Running = 0;
+	for (int32 SourceID = 0; SourceID < NumSources; ++SourceID)
+	{
+		SourceOffsets[SourceID] = Running;
+		for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+		{
+			int32& Cursor = ChunkCursors[ChunkIndex * NumSources + SourceID];
+			const int32 Count = Cursor;
+			Cursor = Running;
+			Running += Count;
+		}
+	}
+	SourceOffsets[NumSources] = Running;
+
+	// Pass 3: scatter, each chunk writes only to its own cursor ranges
+	// Capacity is sized to the particle count, so frames with more sourced particles do not regrow it
+	SortedParticleIDs.Reserve(NumParticles);
+	SortedParticleIDs.SetNumUninitialized(Running, EAllowShrinking::No);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, NumParticles);
+
+		int32* Cursors = ChunkCursors.GetData() + ChunkIndex * NumSources;
+		int32* Sorted = SortedParticleIDs.GetData();
+		for (int32 i = Start; i < End; ++i)
+		{
+			const int32 SourceID = SourceIDs[i];
+			if (SourceID >= 0 && SourceID < NumSources)
+			{
+				Sorted[Cursors[SourceID]++] = ParticleIDs[i];
+			}
+		}
+	}, ForFlags);
+}
+
+/**
+ * @brief Empty the index, keeping its allocations for the next build.
+ */
+void FKawaiiFluidSourceParticleIndex::Reset()
+{
+	SourceOffsets.Reset();
+	SortedParticleIDs.Reset();
+}
@@ -0,0 +1,352 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidSparseBrickGrid.h"
+#include "Logging/KawaiiFluidLog.h"
+#include "Algo/Sort.h"
+
+namespace
+{
+	constexpr int32 MinHashCapacity = 64;
+	constexpr int32 BrickCoordBias = 1 << (FKawaiiFluidSparseBrickGrid::BrickCoordBits - 1);
+	constexpr uint64 BrickAxisMask = (1ull << FKawaiiFluidSparseBrickGrid::BrickCoordBits) - 1;
+
+	/**
+	 * @brief Biased brick coordinates, 21 bits per axis.
+	 * @param BrickCoord Brick coordinate.
+	 * @param OutPacked Packed coordinate.
+	 * @return False if an axis lies outside ±2^20 bricks (never clamped, distant bricks must not merge).
+	 */
+	bool TryPackBrick(const FIntVector& BrickCoord, uint64& OutPacked)
+	{
+		auto InRange = [](int32 V) { return V >= -BrickCoordBias && V < BrickCoordBias; };
+		if (!InRange(BrickCoord.X) || !InRange(BrickCoord.Y) || !InRange(BrickCoord.Z))
+		{
+			return false;
+		}
+
+		auto PackAxis = [](int32 V) { return static_cast<uint64>(V + BrickCoordBias); };
+		OutPacked = PackAxis(BrickCoord.X)
+			| (PackAxis(BrickCoord.Y) << FKawaiiFluidSparseBrickGrid::BrickCoordBits)
+			| (PackAxis(BrickCoord.Z) << (FKawaiiFluidSparseBrickGrid::BrickCoordBits * 2));
+		return true;
+	}
+
+	FIntVector UnpackBrick(uint64 Packed)
+	{
+		return FIntVector(
+			static_cast<int32>(Packed & BrickAxisMask) - BrickCoordBias,
+			static_cast<int32>((Packed >> FKawaiiFluidSparseBrickGrid::BrickCoordBits) & BrickAxisMask) - BrickCoordBias,
+			static_cast<int32>((Packed >> (FKawaiiFluidSparseBrickGrid::BrickCoordBits * 2)) & BrickAxisMask) - BrickCoordBias);
+	}
+
+	/** Spread 21 bits to every third bit of a 63-bit word */
+	uint64 ExpandBits21(uint64 V)
+	{
+		V &= BrickAxisMask;
+		V = (V | (V << 32)) & 0x001F00000000FFFFull;
+		V = (V | (V << 16)) & 0x001F0000FF0000FFull;
+		V = (V | (V << 8)) & 0x100F00F00F00F00Full;
+		V = (V | (V << 4)) & 0x10C30C30C30C30C3ull;
+		V = (V | (V << 2)) & 0x1249249249249249ull;
+		return V;
+	}
+
+	/** Z-order rank of a brick among all bricks (Morton code of the biased coordinate) */
+	uint64 BrickMorton(uint64 Packed)
+	{
+		return ExpandBits21(Packed)
+			| (ExpandBits21(Packed >> FKawaiiFluidSparseBrickGrid::BrickCoordBits) << 1)
+			| (ExpandBits21(Packed >> (FKawaiiFluidSparseBrickGrid::BrickCoordBits * 2)) << 2);
+	}
+
+	/** splitmix64 finalizer: packed coordinates of neighboring bricks land far apart */
+	uint32 HashSlot(uint64 Packed, int32 Capacity)
+	{
+		Packed ^= Packed >> 30;
+		Packed *= 0xBF58476D1CE4E5B9ull;
+		Packed ^= Packed >> 27;
+		Packed *= 0x94D049BB133111EBull;
+		Packed ^= Packed >> 31;
+		return static_cast<uint32>(Packed) & static_cast<uint32>(Capacity - 1);
+	}
+}
+
+/**
+ * @brief Set the cell size and brick size of the next build.
+ * @param InCellSize Cell size (cm).
+ * @param InBrickBits Cells per brick axis as a power of two (2 or 3).
+ */
+void FKawaiiFluidSparseBrickGrid::SetLayout(float InCellSize, int32 InBrickBits)
+{
+	CellSize = InCellSize;
+	BrickBits = FMath::Clamp(InBrickBits, 2, 3);
+}
+
+/**
+ * @brief Release every buffer.
+ */
+void FKawaiiFluidSparseBrickGrid::Reset()
+{
+	CellCoords.Empty();
+	Keys.Empty();
+	HashKeys.Empty();
+	HashValues.Empty();
+	BrickCoords.Empty();
+	BrickOrder.Empty();
+	BrickRemap.Empty();
+	CellStart.Empty();
+	CellEnd.Empty();
+	NumRejected = 0;
+}
+
+/**
+ * @brief Collect the occupied bricks, rank them in Z-order and key every element by (rank, local Morton code).
+ *
+ * Elements whose brick cannot be packed are rejected: they get the rank after the last brick, so they sort
+ * behind every cell and no query finds them.
+ */
+void FKawaiiFluidSparseBrickGrid::BuildKeys()
+{
+	const int32 Num = CellCoords.Num();
+	const int32 LocalBits = BrickBits * 3;
+
+	// Size the table for last build's bricks so a steady state never rehashes
+	const int32 Capacity = FMath::Max(static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(BrickCoords.Num()) * 2)), MinHashCapacity);
+	HashKeys.SetNumUninitialized(Capacity, EAllowShrinking::No);
+	HashValues.SetNumUninitialized(Capacity, EAllowShrinking::No);
+	FMemory::Memset(HashKeys.GetData(), 0xFF, Capacity * sizeof(uint64));
+	BrickOrder.Reset();
+
+	// Insertion index per element; neighbors in memory usually share a brick
+	Keys.SetNumUninitialized(Num, EAllowShrinking::No);
+	NumRejected = 0;
+	uint64 LastPacked = EmptySlot;
+	int32 LastBrick = INDEX_NONE;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		uint64 Packed = 0;
+		if (!TryPackBrick(GetBrickCoord(CellCoords[i]), Packed))
+		{
+			Keys[i] = InvalidIndex;
+			++NumRejected;
+			continue;
+		}
+
+		if (Packed != LastPacked)
+		{
+			LastPacked = Packed;
+			LastBrick = InsertBrick(Packed);
+		}
+		Keys[i] = static_cast<uint32>(LastBrick);
+	}
+
+	if (NumRejected > 0)
+	{
+		KF_LOG(Warning, TEXT("Sparse brick grid: %d elements lie outside the +/-%d brick range, are excluded from the grid and get no neighbors"),
+			NumRejected, BrickCoordBias);
+	}
+
+	// Rank bricks by their Z-order, then point the table at ranks
+	const int32 NumBricks = BrickOrder.Num();
+	Algo::Sort(BrickOrder, [](const TPair<uint64, int32>& A, const TPair<uint64, int32>& B) { return A.Key < B.Key; });
+	BrickRemap.SetNumUninitialized(NumBricks, EAllowShrinking::No);
+	for (int32 Rank = 0; Rank < NumBricks; ++Rank)
+	{
+		BrickRemap[BrickOrder[Rank].Value] = Rank;
+	}
+
+	BrickCoords.SetNumUninitialized(NumBricks, EAllowShrinking::No);
+	for (int32 Slot = 0; Slot < HashKeys.Num(); ++Slot)
+	{
+		if (HashKeys[Slot] != EmptySlot)
+		{
+			const int32 Rank = BrickRemap[HashValues[Slot]];
+			HashValues[Slot] = Rank;
+			BrickCoords[Rank] = UnpackBrick(HashKeys[Slot]);
+		}
+	}
+
+	checkf(GetKeyBits() <= 32, TEXT("Sparse brick grid: %d occupied bricks exceed the 32-bit key range"), NumBricks);
+
+	const uint32 RejectedKey = static_cast<uint32>(NumBricks) << LocalBits;
+	ParallelFor(FMath::DivideAndRoundUp(Num, FKawaiiFluidMortonSorter::ChunkSize), [&](int32 ChunkIndex)
+	{
+		const int32 End = FMath::Min((ChunkIndex + 1) * FKawaiiFluidMortonSorter::ChunkSize, Num);
+		for (int32 i = ChunkIndex * FKawaiiFluidMortonSorter::ChunkSize; i < End; ++i)
+		{
+			Keys[i] = Keys[i] == InvalidIndex
+				? RejectedKey
+				: (static_cast<uint32>(BrickRemap[Keys[i]]) << LocalBits) | GetLocalMorton(CellCoords[i]);
+		}
+	}, Num > FKawaiiFluidMortonSorter::ChunkSize ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+/**
+ * @brief Mark the first and last sorted element of every occupied cell slot.
+ * @param SortedKeys Keys in sorted order.
+ */
+void FKawaiiFluidSparseBrickGrid::BuildCellRanges(TConstArrayView<uint32> SortedKeys)
+{
+	const int32 NumSlots = GetNumBricks() * GetCellsPerBrick();
+
+	// Rejected elements sort last and belong to no cell
+	const int32 Num = SortedKeys.Num() - NumRejected;
+
+	CellStart.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+	CellEnd.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+	FMemory::Memset(CellStart.GetData(), 0xFF, NumSlots * sizeof(uint32));
+	FMemory::Memset(CellEnd.GetData(), 0xFF, NumSlots * sizeof(uint32));
+
+	// Every boundary is written by exactly one element
+	ParallelFor(FMath::DivideAndRoundUp(Num, FKawaiiFluidMortonSorter::ChunkSize), [&](int32 ChunkIndex)
+	{
+		const int32 End = FMath::Min((ChunkIndex + 1) * FKawaiiFluidMortonSorter::ChunkSize, Num);
+		for (int32 i = ChunkIndex * FKawaiiFluidMortonSorter::ChunkSize; i < End; ++i)
+		{
+			const uint32 Key = SortedKeys[i];
+			if (i == 0 || SortedKeys[i - 1] != Key)
+			{
+				CellStart[Key] = static_cast<uint32>(i);
+			}
+			if (i == Num - 1 || SortedKeys[i + 1] != Key)
+			{
+				CellEnd[Key] = static_cast<uint32>(i);
+			}
+		}
+	}, Num > FKawaiiFluidMortonSorter::ChunkSize ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+/**
+ * @brief Find or add a brick (linear probing on the exact packed coordinate).
+ * @param PackedCoord Packed brick coordinate.
+ * @return Insertion index of the brick.
+ */
+int32 FKawaiiFluidSparseBrickGrid::InsertBrick(uint64 PackedCoord)
+{
+	if ((BrickOrder.Num() + 1) * 2 > HashKeys.Num())
+	{
+		GrowHashTable(HashKeys.Num() * 2);
+	}
+
+	const uint32 Mask = static_cast<uint32>(HashKeys.Num() - 1);
+	for (uint32 Slot = HashSlot(PackedCoord, HashKeys.Num()); ; Slot = (Slot + 1) & Mask)
+	{
+		if (HashKeys[Slot] == PackedCoord)
+		{
+			return HashValues[Slot];
+		}
+
+		if (HashKeys[Slot] == EmptySlot)
+		{
+			HashKeys[Slot] = PackedCoord;
+			HashValues[Slot] = BrickOrder.Num();
+			BrickOrder.Emplace(BrickMorton(PackedCoord), BrickOrder.Num());
+			return HashValues[Slot];
+		}
+	}
+}
+
+/**
+ * @brief Rehash into a larger table.
+ * @param NewCapacity New slot count (power of two).
+ */
+void FKawaiiFluidSparseBrickGrid::GrowHashTable(int32 NewCapacity)
+{
+	TArray<uint64> OldKeys = MoveTemp(HashKeys);
+	TArray<int32> OldValues = MoveTemp(HashValues);
+
+	HashKeys.Init(EmptySlot, NewCapacity);
+	HashValues.SetNumUninitialized(NewCapacity);
+
+	const uint32 Mask = static_cast<uint32>(NewCapacity - 1);
+	for (int32 OldSlot = 0; OldSlot < OldKeys.Num(); ++OldSlot)
+	{
+		if (OldKeys[OldSlot] == EmptySlot)
+		{
+			continue;
+		}
+
+		uint32 Slot = HashSlot(OldKeys[OldSlot], NewCapacity);
+		while (HashKeys[Slot] != EmptySlot)
+		{
+			Slot = (Slot + 1) & Mask;
+		}
+		HashKeys[Slot] = OldKeys[OldSlot];
+		HashValues[Slot] = OldValues[OldSlot];
+	}
+}
+
+/**
+ * @brief Rank of an occupied brick.
+ * @param BrickCoord Brick coordinate.
+ * @return Brick rank, INDEX_NONE if no element of the last build lies in it.
+ */
+int32 FKawaiiFluidSparseBrickGrid::FindBrick(const FIntVector& BrickCoord) const
+{
+	if (HashKeys.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	uint64 Packed = 0;
+	if (!TryPackBrick(BrickCoord, Packed))
+	{
+		return INDEX_NONE;
+	}
+
+	const uint32 Mask = static_cast<uint32>(HashKeys.Num() - 1);
+	for (uint32 Slot = HashSlot(Packed, HashKeys.Num()); ; Slot = (Slot + 1) & Mask)
+	{
+		if (HashKeys[Slot] == Packed)
+		{
+			return HashValues[Slot];
+		}
+
+		if (HashKeys[Slot] == EmptySlot)
+		{
+			return INDEX_NONE;
+		}
+	}
+}
+
+/**
+ * @brief Cell slot of a cell coordinate (the sort key its elements carry).
+ * @param CellCoord Cell coordinate.
+ * @return Slot in CellStart/CellEnd, InvalidIndex if the brick is unoccupied.
+ */
+uint32 FKawaiiFluidSparseBrickGrid::GetCellSlot(const FIntVector& CellCoord) const
+{
+	const int32 Rank = FindBrick(GetBrickCoord(CellCoord));
+	if (Rank == INDEX_NONE)
+	{
+		return InvalidIndex;
+	}
+
+	return (static_cast<uint32>(Rank) << (BrickBits * 3)) | GetLocalMorton(CellCoord);
+}
+
+/**
+ * @brief Significant key bits: brick rank bits above the local Morton bits (one extra rank holds rejected elements).
+ * @return Key bits of the last build (at least 1).
+ */
+int32 FKawaiiFluidSparseBrickGrid::GetKeyBits() const
+{
+	const int32 NumRanks = GetNumBricks() + (NumRejected > 0 ? 1 : 0);
+	const int32 RankBits = NumRanks > 1 ? static_cast<int32>(FMath::CeilLogTwo(static_cast<uint32>(NumRanks))) : 0;
+	return RankBits + BrickBits * 3;
+}
+
+/**
+ * @brief Morton code of a cell inside its brick.
+ * @param CellCoord Cell coordinate.
+ * @return Local Morton code (BrickBits * 3 bits).
+ */
+uint32 FKawaiiFluidSparseBrickGrid::GetLocalMorton(const FIntVector& CellCoord) const
+{
+	const uint32 LocalMask = (1u << BrickBits) - 1;
+	return KawaiiFluidMorton::Morton3D(
+		static_cast<uint32>(CellCoord.X) & LocalMask,
+		static_cast<uint32>(CellCoord.Y) & LocalMask,
+		static_cast<uint32>(CellCoord.Z) & LocalMask,
+		BrickBits);
+}
@@ -0,0 +1,648 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Simulation/Utils/KawaiiFluidSpawnLattice.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	/** Points per ParallelFor chunk in the transform pass */
+	constexpr int32 TransformChunkSize = 2048;
+
+	/**
+	 * @struct FLatticeKey
+	 * @brief Cache key for a lattice template.
+	 * @param Shape Lattice shape.
+	 * @param Spacing Particle spacing.
+	 * @param Dimensions Shape dimensions (see FKawaiiFluidSpawnLattice dimension helpers).
+	 */
+	struct FLatticeKey
+	{
+		EKawaiiFluidLatticeShape Shape;
+
+		float Spacing;
+
+		FVector3f Dimensions;
+
+		bool operator==(const FLatticeKey& Other) const
+		{
+			return Shape == Other.Shape && Spacing == Other.Spacing && Dimensions == Other.Dimensions;
+		}
+
+		friend uint32 GetTypeHash(const FLatticeKey& Key)
+		{
+			uint32 Hash = ::GetTypeHash(static_cast<uint8>(Key.Shape));
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Key.Spacing));
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Key.Dimensions.X));
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Key.Dimensions.Y));
+			return HashCombineFast(Hash, ::GetTypeHash(Key.Dimensions.Z));
+		}
+	};
+
+	FCriticalSection TemplateCacheLock;
+
+	TMap<FLatticeKey, TSharedRef<const FKawaiiFluidLatticeTemplate>> TemplateCache;
+
+	/**
+	 * @brief ABC stacking offset of an HCP layer.
+	 * @param LayerMod Layer index modulo 3.
+	 * @param AdjustedSpacing In-plane spacing.
+	 * @param RowSpacingY Row spacing.
+	 * @return XY offset of the layer.
+	 */
+	FVector2D GetHCPLayerOffset(int32 LayerMod, float AdjustedSpacing, float RowSpacingY)
+	{
+		if (LayerMod == 1)
+		{
+			return FVector2D(AdjustedSpacing * 0.5f, RowSpacingY / 3.0f);
+		}
+		if (LayerMod == 2)
+		{
+			return FVector2D(AdjustedSpacing * 0.25f, RowSpacingY * 2.0f / 3.0f);
+		}
+		return FVector2D::ZeroVector;
+	}
+
+	/**
+	 * @brief HCP lattice filling a sphere; jitter falls off from 100% at the center to 0% at the surface.
+	 * @param Radius Sphere radius.
+	 * @param Spacing Particle spacing (before HCP compensation).
+	 * @param Out Template to fill.
+	 */
+	void BuildSphere(float Radius, float Spacing, FKawaiiFluidLatticeTemplate& Out)
+	{
+		const float AdjustedSpacing = Spacing * FKawaiiFluidSpawnLattice::HCPCompensation;
+		const float RowSpacingY = AdjustedSpacing * 0.866025f;   // sqrt(3)/2
+		const float LayerSpacingZ = AdjustedSpacing * 0.816497f; // sqrt(2/3)
+		const float RadiusSq = Radius * Radius;
+
+		const int32 GridSize = FMath::CeilToInt(Radius / AdjustedSpacing) + 1;
+		const int32 GridSizeY = FMath::CeilToInt(Radius / RowSpacingY) + 1;
+		const int32 GridSizeZ = FMath::CeilToInt(Radius / LayerSpacingZ) + 1;
+
+		const float EstimatedCount = (4.0f / 3.0f) * PI * Radius * Radius * Radius / (AdjustedSpacing * AdjustedSpacing * AdjustedSpacing);
+		Out.LocalPositions.Reserve(FMath::CeilToInt(EstimatedCount));
+		Out.JitterScales.Reserve(FMath::CeilToInt(EstimatedCount));
+
+		for (int32 z = -GridSizeZ; z <= GridSizeZ; ++z)
+		{
+			const FVector2D LayerOffset = GetHCPLayerOffset((z + GridSizeZ) % 3, AdjustedSpacing, RowSpacingY);
+
+			for (int32 y = -GridSizeY; y <= GridSizeY; ++y)
+			{
+				const float RowOffsetX = (((y + GridSizeY) % 2) == 1) ? AdjustedSpacing * 0.5f : 0.0f;
+
+				for (int32 x = -GridSize; x <= GridSize; ++x)
+				{
+					const FVector3f LocalPos(
+						x * AdjustedSpacing + RowOffsetX + LayerOffset.X,
+						y * RowSpacingY + LayerOffset.Y,
+						z * LayerSpacingZ
+					);
+
+					const float DistSq = LocalPos.SizeSquared();
+					if (DistSq > RadiusSq)
+					{
+						continue;
+					}
+
+					Out.LocalPositions.Add(LocalPos);
+					Out.JitterScales.Add(AdjustedSpacing * FMath::Clamp(1.0f - (FMath::Sqrt(DistSq) / Radius), 0.0f, 1.0f));
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief HCP lattice filling a box; jitter falls off towards the nearest face.
+	 * @param HalfSize Box half-extent.
+	 * @param Spacing Particle spacing (before HCP compensation).
+	 * @param Out Template to fill.
+	 */
+	void BuildBox(const FVector3f& HalfSize, float Spacing, FKawaiiFluidLatticeTemplate& Out)
+	{
+		const float AdjustedSpacing = Spacing * FKawaiiFluidSpawnLattice::HCPCompensation;
+		const float RowSpacingY = AdjustedSpacing * 0.866025f;   // sqrt(3)/2
+		const float LayerSpacingZ = AdjustedSpacing * 0.816497f; // sqrt(2/3)
+
+		const int32 CountX = FMath::Max(1, FMath::CeilToInt(HalfSize.X * 2.0f / AdjustedSpacing));
+		const int32 CountY = FMath::Max(1, FMath::CeilToInt(HalfSize.Y * 2.0f / RowSpacingY));
+		const int32 CountZ = FMath::Max(1, FMath::CeilToInt(HalfSize.Z * 2.0f / LayerSpacingZ));
+
+		Out.LocalPositions.Reserve(CountX * CountY * CountZ);
+		Out.JitterScales.Reserve(CountX * CountY * CountZ);
+
+		// Start at the bottom-left-back corner with a half-spacing inset
+		const FVector3f LocalStart(-HalfSize.X + AdjustedSpacing * 0.5f, -HalfSize.Y + RowSpacingY * 0.5f, -HalfSize.Z + LayerSpacingZ * 0.5f);
+		const float MaxDist = FMath::Min3(HalfSize.X, HalfSize.Y, HalfSize.Z);
+
+		for (int32 z = 0; z < CountZ; ++z)
+		{
+			const FVector2D LayerOffset = GetHCPLayerOffset(z % 3, AdjustedSpacing, RowSpacingY);
+
+			for (int32 y = 0; y < CountY; ++y)
+			{
+				const float RowOffsetX = (y % 2 == 1) ? AdjustedSpacing * 0.5f : 0.0f;
+
+				for (int32 x = 0; x < CountX; ++x)
+				{
+					const FVector3f LocalPos(
+						LocalStart.X + x * AdjustedSpacing + RowOffsetX + LayerOffset.X,
+						LocalStart.Y + y * RowSpacingY + LayerOffset.Y,
+						LocalStart.Z + z * LayerSpacingZ
+					);
+
+					if (FMath::Abs(LocalPos.X) > HalfSize.X ||
+					    FMath::Abs(LocalPos.Y) > HalfSize.Y ||
+					    FMath::Abs(LocalPos.Z) > HalfSize.Z)
+					{
+						continue;
+					}
+
+					float JitterScale = 0.0f;
+					if (MaxDist > 0.0f)
+					{
+						const float MinDistToSurface = FMath::Min3(
+							HalfSize.X - FMath::Abs(LocalPos.X),
+							HalfSize.Y - FMath::Abs(LocalPos.Y),
+							HalfSize.Z - FMath::Abs(LocalPos.Z));
+						JitterScale = AdjustedSpacing * FMath::Clamp(MinDistToSurface / MaxDist, 0.0f, 1.0f);
+					}
+
+					Out.LocalPositions.Add(LocalPos);
+					Out.JitterScales.Add(JitterScale);
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief HCP lattice filling a cylinder (axis along local Z); jitter falls off towards the wall and caps.
+	 * @param Radius Cylinder radius.
+	 * @param HalfHeight Cylinder half-height.
+	 * @param Spacing Particle spacing (before HCP compensation).
+	 * @param Out Template to fill.
+	 */
+	void BuildCylinder(float Radius, float HalfHeight, float Spacing, FKawaiiFluidLatticeTemplate& Out)
+	{
+		const float AdjustedSpacing = Spacing * FKawaiiFluidSpawnLattice::HCPCompensation;
+		const float RowSpacingY = AdjustedSpacing * 0.866025f;   // sqrt(3)/2
+		const float LayerSpacingZ = AdjustedSpacing * 0.816497f; // sqrt(2/3)
+		const float RadiusSq = Radius * Radius;
+
+		const int32 GridSizeXY = FMath::CeilToInt(Radius / AdjustedSpacing) + 1;
+		const int32 GridSizeY = FMath::CeilToInt(Radius / RowSpacingY) + 1;
+		const int32 GridSizeZ = FMath::CeilToInt(HalfHeight / LayerSpacingZ);
+
+		const float EstimatedCount = PI * Radius * Radius * HalfHeight * 2.0f / (AdjustedSpacing * AdjustedSpacing * AdjustedSpacing);
+		Out.LocalPositions.Reserve(FMath::CeilToInt(EstimatedCount));
+		Out.JitterScales.Reserve(FMath::CeilToInt(EstimatedCount));
+
+		const float MaxDist = FMath::Min(Radius, HalfHeight);
+
+		for (int32 z = -GridSizeZ; z <= GridSizeZ; ++z)
+		{
+			const FVector2D LayerOffset = GetHCPLayerOffset((z + GridSizeZ) % 3, AdjustedSpacing, RowSpacingY);
+
+			for (int32 y = -GridSizeY; y <= GridSizeY; ++y)
+			{
+				const float RowOffsetX = (((y + GridSizeY) % 2) == 1) ? AdjustedSpacing * 0.5f : 0.0f;
+
+				for (int32 x = -GridSizeXY; x <= GridSizeXY; ++x)
+				{
+					const FVector3f LocalPos(
+						x * AdjustedSpacing + RowOffsetX + LayerOffset.X,
+						y * RowSpacingY + LayerOffset.Y,
+						z * LayerSpacingZ
+					);
+
+					// Radius in the XY plane, height along Z
+					const float XYDistSq = LocalPos.X * LocalPos.X + LocalPos.Y * LocalPos.Y;
+					if (XYDistSq > RadiusSq || FMath::Abs(LocalPos.Z) > HalfHeight)
+					{
+						continue;
+					}
+
+					const float MinDistToSurface = FMath::Min(Radius - FMath::Sqrt(XYDistSq), HalfHeight - FMath::Abs(LocalPos.Z));
+
+					Out.LocalPositions.Add(LocalPos);
+					Out.JitterScales.Add(AdjustedSpacing * FMath::Clamp(MinDistToSurface / MaxDist, 0.0f, 1.0f));
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief 2D hexagonal disc candidates in the local XY plane (no HCP compensation).
+	 *
+	 * Candidates just outside the circle are kept; the inside-circle test runs after jitter
+	 * in the transform pass.
+	 *
+	 * @param Radius Disc radius.
+	 * @param Spacing Particle spacing.
+	 * @param Out Template to fill.
+	 */
+	void BuildStreamDisc(float Radius, float Spacing, FKawaiiFluidLatticeTemplate& Out)
+	{
+		const float RowSpacing = Spacing * FMath::Sqrt(3.0f) * 0.5f;  // ~0.866 * Spacing
+		const float RadiusSq = Radius * Radius;
+
+		const int32 NumRows = FMath::CeilToInt(Radius / RowSpacing) * 2 + 1;
+		const int32 HalfRows = NumRows / 2;
+
+		Out.ClipRadiusSq = RadiusSq;
+		Out.bPlanarJitter = true;
+		Out.LocalPositions.Reserve(FMath::CeilToInt((PI * RadiusSq) / (Spacing * Spacing)));
+
+		for (int32 RowIdx = -HalfRows; RowIdx <= HalfRows; ++RowIdx)
+		{
+			const float LocalY = RowIdx * RowSpacing;
+			const float LocalYSq = LocalY * LocalY;
+			if (LocalYSq > RadiusSq)
+			{
+				continue;
+			}
+
+			const float MaxX = FMath::Sqrt(RadiusSq - LocalYSq);
+
+			// Odd rows get a half-spacing X offset (hexagonal packing)
+			const float XOffset = (FMath::Abs(RowIdx) % 2 != 0) ? Spacing * 0.5f : 0.0f;
+			const int32 NumCols = FMath::FloorToInt(MaxX / Spacing);
+
+			for (int32 ColIdx = -NumCols; ColIdx <= NumCols; ++ColIdx)
+			{
+				Out.LocalPositions.Add(FVector3f(ColIdx * Spacing + XOffset, LocalY, 0.0f));
+				Out.JitterScales.Add(Spacing);
+			}
+		}
+	}
+
+	/**
+	 * @brief Transform-and-jitter pass shared by every output format.
+	 *
+	 * Volumetric templates run in parallel chunks with one random stream per chunk and write to
+	 * preallocated slots. Clipped (stream disc) templates are small and run serially with compaction.
+	 *
+	 * @param Template Cached lattice.
+	 * @param Origin World-space origin.
+	 * @param AxisX World direction of local X.
+	 * @param AxisY World direction of local Y.
+	 * @param AxisZ World direction of local Z.
+	 * @param JitterAmount Jitter as a fraction of the template's per-point scale (0 disables).
+	 * @param Count Number of template points to process (prefix of the template).
+	 * @param Write Callback (OutIndex, WorldPosition) writing one output element.
+	 * @return Number of elements written.
+	 */
+	template <typename WriteFunc>
+	int32 TransformTemplate(const FKawaiiFluidLatticeTemplate& Template, const FVector& Origin,
+		const FVector& AxisX, const FVector& AxisY, const FVector& AxisZ, float JitterAmount, int32 Count, WriteFunc&& Write)
+	{
+		const FVector3f* RESTRICT Locals = Template.LocalPositions.GetData();
+		const float* RESTRICT Scales = Template.JitterScales.GetData();
+		const bool bJitter = JitterAmount > KINDA_SMALL_NUMBER;
+
+		if (Template.ClipRadiusSq > 0.0f)
+		{
+			FRandomStream Random(FMath::Rand());
+			int32 Written = 0;
+			for (int32 i = 0; i < Count; ++i)
+			{
+				float LocalX = Locals[i].X;
+				float LocalY = Locals[i].Y;
+				if (bJitter)
+				{
+					const float Range = Scales[i] * JitterAmount;
+					LocalX += Random.FRandRange(-Range, Range);
+					LocalY += Random.FRandRange(-Range, Range);
+				}
+
+				// Inside-circle test after jitter
+				if (LocalX * LocalX + LocalY * LocalY <= Template.ClipRadiusSq)
+				{
+					Write(Written++, Origin + AxisX * LocalX + AxisY * LocalY);
+				}
+			}
+			return Written;
+		}
+
+		const int32 BaseSeed = FMath::Rand();
+		const int32 NumChunks = FMath::DivideAndRoundUp(Count, TransformChunkSize);
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			FRandomStream Random(BaseSeed + ChunkIndex);
+			const int32 Start = ChunkIndex * TransformChunkSize;
+			const int32 End = FMath::Min(Start + TransformChunkSize, Count);
+
+			for (int32 i = Start; i < End; ++i)
+			{
+				FVector Local(Locals[i]);
+				if (bJitter)
+				{
+					const float Range = Scales[i] * JitterAmount;
+					if (Range > 0.0f)
+					{
+						Local.X += Random.FRandRange(-Range, Range);
+						Local.Y += Random.FRandRange(-Range, Range);
+						if (!Template.bPlanarJitter)
+						{
+							Local.Z += Random.FRandRange(-Range, Range);
+						}
+					}
+				}
+
+				Write(i, Origin + AxisX * Local.X + AxisY * Local.Y + AxisZ * Local.Z);
+			}
+		}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		return Count;
+	}
+
+	/**
+	 * @brief Transform a template into world positions appended to OutPositions.
+	 * @param Template Cached lattice.
+	 * @param Origin World-space origin.
+	 * @param AxisX World direction of local X.
+	 * @param AxisY World direction of local Y.
+	 * @param AxisZ World direction of local Z.
+	 * @param JitterAmount Jitter fraction.
+	 * @param MaxCount Maximum number of positions (<= 0 = unlimited).
+	 * @param OutPositions Positions are appended here.
+	 * @return Number of positions added.
+	 */
+	int32 AppendPositions(const FKawaiiFluidLatticeTemplate& Template, const FVector& Origin,
+		const FVector& AxisX, const FVector& AxisY, const FVector& AxisZ, float JitterAmount, int32 MaxCount, TArray<FVector>& OutPositions)
+	{
+		const int32 Count = MaxCount > 0 ? FMath::Min(MaxCount, Template.Num()) : Template.Num();
+		const int32 StartNum = OutPositions.Num();
+		OutPositions.SetNumUninitialized(StartNum + Count, EAllowShrinking::No);
+
+		FVector* Dest = OutPositions.GetData() + StartNum;
+		const int32 Written = TransformTemplate(Template, Origin, AxisX, AxisY, AxisZ, JitterAmount, Count,
+			[Dest](int32 Index, const FVector& WorldPos) { Dest[Index] = WorldPos; });
+
+		OutPositions.SetNum(StartNum + Written, EAllowShrinking::No);
+		return Written;
+	}
+
+	/**
+	 * @brief Transform a template into complete spawn requests appended to OutRequests.
+	 *
+	 * Mass and Radius are left at 0 so the volume fills in the preset defaults.
+	 *
+	 * @param Template Cached lattice.
+	 * @param Origin World-space origin.
+	 * @param AxisX World direction of local X.
+	 * @param AxisY World direction of local Y.
+	 * @param AxisZ World direction of local Z.
+	 * @param JitterAmount Jitter fraction.
+	 * @param MaxCount Maximum number of requests (<= 0 = unlimited).
+	 * @param Velocity Initial velocity for every request.
+	 * @param SourceID Source ID for every request.
+	 * @param OutRequests Requests are appended here.
+	 * @return Number of requests added.
+	 */
+	int32 AppendSpawnRequests(const FKawaiiFluidLatticeTemplate& Template, const FVector& Origin,
+		const FVector& AxisX, const FVector& AxisY, const FVector& AxisZ, float JitterAmount, int32 MaxCount,
+		const FVector& Velocity, int32 SourceID, TArray<FGPUSpawnRequest>& OutRequests)
+	{
+		const int32 Count = MaxCount > 0 ? FMath::Min(MaxCount, Template.Num()) : Template.Num();
+		const int32 StartNum = OutRequests.Num();
+		OutRequests.SetNumUninitialized(StartNum + Count, EAllowShrinking::No);
+
+		FGPUSpawnRequest* Dest = OutRequests.GetData() + StartNum;
+		const FVector3f Velocity3f(Velocity);
+		const int32 Written = TransformTemplate(Template, Origin, AxisX, AxisY, AxisZ, JitterAmount, Count,
+			[Dest, Velocity3f, SourceID](int32 Index, const FVector& WorldPos)
+			{
+				Dest[Index] = FGPUSpawnRequest(FVector3f(WorldPos), Velocity3f, SourceID, 0.0f);
+			});
+
+		OutRequests.SetNum(StartNum + Written, EAllowShrinking::No);
+		return Written;
+	}
+
+	/**
+	 * @brief Orthonormal basis of a stream layer (local Z along the layer direction).
+	 * @param LayerDirection Disc normal (defaults to -Z when degenerate).
+	 * @param OutRight World direction of local X.
+	 * @param OutUp World direction of local Y.
+	 * @param OutDir World direction of local Z.
+	 */
+	void GetStreamLayerBasis(const FVector& LayerDirection, FVector& OutRight, FVector& OutUp, FVector& OutDir)
+	{
+		OutDir = LayerDirection.GetSafeNormal();
+		if (OutDir.IsNearlyZero())
+		{
+			OutDir = FVector(0, 0, -1);
+		}
+		OutDir.FindBestAxisVectors(OutRight, OutUp);
+	}
+}
+
+//========================================
+// Template Cache
+//========================================
+
+/**
+ * @brief Returns the cached local-space lattice for a shape, building it on first use.
+ * @param Shape Lattice shape.
+ * @param Spacing Particle spacing (before HCP compensation for volumetric shapes).
+ * @param Dimensions Box half-size, or the dimension helper result for other shapes.
+ * @return Shared, immutable lattice template (empty for invalid input).
+ */
+TSharedRef<const FKawaiiFluidLatticeTemplate> FKawaiiFluidSpawnLattice::GetTemplate(EKawaiiFluidLatticeShape Shape, float Spacing, const FVector& Dimensions)
+{
+	const FLatticeKey Key{ Shape, Spacing, FVector3f(Dimensions) };
+
+	{
+		FScopeLock Lock(&TemplateCacheLock);
+		if (const TSharedRef<const FKawaiiFluidLatticeTemplate>* Found = TemplateCache.Find(Key))
+		{
+			return *Found;
+		}
+	}
+
+	TSharedRef<FKawaiiFluidLatticeTemplate> Template = MakeShared<FKawaiiFluidLatticeTemplate>();
+	Template->Shape = Shape;
+
+	if (Spacing > 0.0f)
+	{
+		switch (Shape)
+		{
+		case EKawaiiFluidLatticeShape::Sphere:
+			if (Key.Dimensions.X > 0.0f)
+			{
+				BuildSphere(Key.Dimensions.X, Spacing, *Template);
+			}
+			break;
+
+		case EKawaiiFluidLatticeShape::Box:
+			BuildBox(Key.Dimensions, Spacing, *Template);
+			break;
+
+		case EKawaiiFluidLatticeShape::Cylinder:
+			if (Key.Dimensions.X > 0.0f && Key.Dimensions.Z > 0.0f)
+			{
+				BuildCylinder(Key.Dimensions.X, Key.Dimensions.Z, Spacing, *Template);
+			}
+			break;
+
+		case EKawaiiFluidLatticeShape::StreamDisc:
+			if (Key.Dimensions.X > 0.0f)
+			{
+				BuildStreamDisc(Key.Dimensions.X, Spacing, *Template);
+			}
+			break;
+		}
+	}
+
+	FScopeLock Lock(&TemplateCacheLock);
+	if (TemplateCache.Num() >= MaxCachedTemplates)
+	{
+		// Outstanding references keep their templates alive
+		TemplateCache.Reset();
+	}
+	return TemplateCache.Emplace(Key, Template);
+}
+
+/**
+ * @brief Number of templates currently cached.
+ * @return Cache size.
+ */
+int32 FKawaiiFluidSpawnLattice::GetNumCachedTemplates()
+{
+	FScopeLock Lock(&TemplateCacheLock);
+	return TemplateCache.Num();
+}
+
+/**
+ * @brief Drops every cached template.
+ */
+void FKawaiiFluidSpawnLattice::ClearCache()
+{
+	FScopeLock Lock(&TemplateCacheLock);
+	TemplateCache.Reset();
+}
+
+//========================================
+// Transform Passes
+//========================================
+
+/**
+ * @brief Transform and jitter a volumetric template straight into spawn requests.
+ * @param Template Cached lattice (Sphere, Box or Cylinder).
+ * @param Origin World-space shape center.
+ * @param Rotation Shape orientation.
+ * @param JitterAmount Jitter as a fraction of spacing (0 disables), falling off to zero at the surface.
+ * @param MaxCount Maximum number of requests (<= 0 = unlimited).
+ * @param Velocity Initial velocity.
+ * @param SourceID Source ID written into every request.
+ * @param OutRequests Requests are appended here (reuse the array to keep its allocation).
+ * @return Number of requests added.
+ */
+int32 FKawaiiFluidSpawnLattice::TransformToSpawnRequests(const FKawaiiFluidLatticeTemplate& Template, const FVector& Origin, const FQuat& Rotation,
+	float JitterAmount, int32 MaxCount, const FVector& Velocity, int32 SourceID, TArray<FGPUSpawnRequest>& OutRequests)
+{
+	return AppendSpawnRequests(Template, Origin, Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ(),
+		JitterAmount, MaxCount, Velocity, SourceID, OutRequests);
+}
+
+/**
+ * @brief Transform and jitter a stream disc template straight into spawn requests.
+ * @param Template Cached StreamDisc lattice.
+ * @param Position World-space disc center.
+ * @param LayerDirection Disc normal (defaults to -Z when degenerate).
+ * @param Jitter In-plane jitter as a fraction of spacing (clamped to 0.5, 0 disables).
+ * @param Velocity Initial velocity.
+ * @param SourceID Source ID written into every request.
+ * @param OutRequests Requests are appended here.
+ * @return Number of requests added.
+ */
+int32 FKawaiiFluidSpawnLattice::TransformStreamLayerToSpawnRequests(const FKawaiiFluidLatticeTemplate& Template, const FVector& Position,
+	const FVector& LayerDirection, float Jitter, const FVector& Velocity, int32 SourceID, TArray<FGPUSpawnRequest>& OutRequests)
+{
+	FVector Right, Up, Dir;
+	GetStreamLayerBasis(LayerDirection, Right, Up, Dir);
+	return AppendSpawnRequests(Template, Position, Right, Up, Dir, FMath::Clamp(Jitter, 0.0f, 0.5f), 0, Velocity, SourceID, OutRequests);
+}
+
+//========================================
+// Position Generation
+//========================================
+
+/**
+ * @brief HCP lattice filling a sphere.
+ * @param Center World-space center.
+ * @param Rotation Shape orientation.
+ * @param Radius Sphere radius.
+ * @param Spacing Particle spacing (before HCP compensation).
+ * @param JitterAmount Jitter as a fraction of spacing (0 disables), falling off to zero at the surface.
+ * @param MaxCount Maximum number of positions to add (<= 0 = unlimited).
+ * @param OutPositions Positions are appended here.
+ * @return Number of positions added.
+ */
+int32 FKawaiiFluidSpawnLattice::GenerateSphere(const FVector& Center, const FQuat& Rotation, float Radius, float Spacing,
+	float JitterAmount, int32 MaxCount, TArray<FVector>& OutPositions)
+{
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Template = GetTemplate(EKawaiiFluidLatticeShape::Sphere, Spacing, SphereDimensions(Radius));
+	return AppendPositions(*Template, Center, Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ(), JitterAmount, MaxCount, OutPositions);
+}
+
+/**
+ * @brief HCP lattice filling an oriented box.
+ * @param Center World-space center.
+ * @param Rotation Shape orientation.
+ * @param HalfSize Box half-extent.
+ * @param Spacing Particle spacing (before HCP compensation).
+ * @param JitterAmount Jitter as a fraction of spacing (0 disables), falling off to zero at the faces.
+ * @param MaxCount Maximum number of positions to add (<= 0 = unlimited).
+ * @param OutPositions Positions are appended here.
+ * @return Number of positions added.
+ */
+int32 FKawaiiFluidSpawnLattice::GenerateBox(const FVector& Center, const FQuat& Rotation, const FVector& HalfSize, float Spacing,
+	float JitterAmount, int32 MaxCount, TArray<FVector>& OutPositions)
+{
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Template = GetTemplate(EKawaiiFluidLatticeShape::Box, Spacing, HalfSize);
+	return AppendPositions(*Template, Center, Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ(), JitterAmount, MaxCount, OutPositions);
+}
+
+/**
+ * @brief HCP lattice filling an oriented cylinder (axis along local Z).
+ * @param Center World-space center.
+ * @param Rotation Shape orientation.
+ * @param Radius Cylinder radius.
+ * @param HalfHeight Cylinder half-height.
+ * @param Spacing Particle spacing (before HCP compensation).
+ * @param JitterAmount Jitter as a fraction of spacing (0 disables), falling off to zero at the surface.
+ * @param MaxCount Maximum number of positions to add (<= 0 = unlimited).
+ * @param OutPositions Positions are appended here.
+ * @return Number of positions added.
+ */
+int32 FKawaiiFluidSpawnLattice::GenerateCylinder(const FVector& Center, const FQuat& Rotation, float Radius, float HalfHeight, float Spacing,
+	float JitterAmount, int32 MaxCount, TArray<FVector>& OutPositions)
+{
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Template = GetTemplate(EKawaiiFluidLatticeShape::Cylinder, Spacing, CylinderDimensions(Radius, HalfHeight));
+	return AppendPositions(*Template, Center, Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ(), JitterAmount, MaxCount, OutPositions);
+}
+
+/**
+ * @brief 2D hexagonal disc of particles perpendicular to the emission direction (no HCP compensation).
+ * @param Position World-space disc center.
+ * @param LayerDirection Disc normal (defaults to -Z when degenerate).
+ * @param Radius Disc radius.
+ * @param Spacing Particle spacing.
+ * @param Jitter In-plane jitter as a fraction of spacing (clamped to 0.5, 0 disables).
+ * @param OutPositions Positions are appended here.
+ * @return Number of positions added.
+ */
+int32 FKawaiiFluidSpawnLattice::GenerateStreamLayer(const FVector& Position, const FVector& LayerDirection, float Radius, float Spacing,
+	float Jitter, TArray<FVector>& OutPositions)
+{
+	FVector Right, Up, Dir;
+	GetStreamLayerBasis(LayerDirection, Right, Up, Dir);
+
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Template = GetTemplate(EKawaiiFluidLatticeShape::StreamDisc, Spacing, StreamDiscDimensions(Radius));
+	return AppendPositions(*Template, Position, Right, Up, Dir, FMath::Clamp(Jitter, 0.0f, 0.5f), 0, OutPositions);
+}
@@ -0,0 +1,195 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/Package.h"
+#include "Core/KawaiiFluidSimulationContext.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+#include "Core/KawaiiFluidSpatialHash.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAdaptiveStepTest_CFLSubsteps,
+	"KawaiiFluid.Simulation.AdaptiveStep.T01_CFLSubsteps",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAdaptiveStepTest_SubstepCeiling,
+	"KawaiiFluid.Simulation.AdaptiveStep.T02_SubstepCeiling",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAdaptiveStepTest_SolverEarlyExit,
+	"KawaiiFluid.Simulation.AdaptiveStep.T03_SolverEarlyExit",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float FrameDeltaTime = 1.0f / 60.0f;
+	constexpr float FastSpeed = 3000.0f;
+
+	/**
+	 * @brief Helper: Build a cubic block of particles moving with a uniform velocity.
+	 * @param Preset Preset providing spacing and mass.
+	 * @param Velocity Initial velocity of every particle.
+	 * @return Particle array.
+	 */
+	TArray<FKawaiiFluidParticle> MakeBlock(const UKawaiiFluidPresetDataAsset* Preset, const FVector& Velocity)
+	{
+		TArray<FKawaiiFluidParticle> Particles;
+		for (int32 Z = 0; Z < 5; ++Z)
+		{
+			for (int32 Y = 0; Y < 5; ++Y)
+			{
+				for (int32 X = 0; X < 5; ++X)
+				{
+					FKawaiiFluidParticle& Particle = Particles.Emplace_GetRef(FVector(X, Y, Z) * Preset->ParticleSpacing + FVector(0.0f, 0.0f, 100.0f), Particles.Num());
+					Particle.Mass = Preset->ParticleMass;
+					Particle.Velocity = Velocity;
+				}
+			}
+		}
+		return Particles;
+	}
+
+	/**
+	 * @brief Helper: Simulation parameters with a container large enough to ignore.
+	 * @param Preset Preset providing the particle radius.
+	 * @return Simulation parameters.
+	 */
+	FKawaiiFluidSimulationParams MakeParams(const UKawaiiFluidPresetDataAsset* Preset)
+	{
+		FKawaiiFluidSimulationParams Params;
+		Params.ParticleRadius = Preset->ParticleRadius;
+		Params.bUseWorldCollision = false;
+		Params.WorldBounds = FBox(FVector(-10000.0f), FVector(10000.0f));
+		return Params;
+	}
+
+	/**
+	 * @brief Helper: Create an initialized simulation context for a preset.
+	 * @param Preset Preset to initialize the solvers with.
+	 * @return Context kept alive by the returned pointer.
+	 */
+	TStrongObjectPtr<UKawaiiFluidSimulationContext> MakeContext(UKawaiiFluidPresetDataAsset* Preset)
+	{
+		TStrongObjectPtr<UKawaiiFluidSimulationContext> Context(NewObject<UKawaiiFluidSimulationContext>(GetTransientPackage()));
+		Context->InitializeSolvers(Preset);
+		return Context;
+	}
+}
+
+/**
+ * @brief Fast particles get more and smaller substeps than resting ones, and the frame time is fully consumed.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidAdaptiveStepTest_CFLSubsteps::RunTest(const FString& Parameters)
+{
+	TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Preset(NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage()));
+	Preset->bEnableAdaptiveSubstepping = true;
+	Preset->MaxAdaptiveSubsteps = 64;
+	Preset->RecalculateDerivedParameters();
+
+	TStrongObjectPtr<UKawaiiFluidSimulationContext> Context = MakeContext(Preset.Get());
+	FKawaiiFluidSpatialHash SpatialHash(Preset->SmoothingRadius);
+	const FKawaiiFluidSimulationParams Params = MakeParams(Preset.Get());
+
+	// Resting block: only gravity limits the step, one MaxAdaptiveSubstepDeltaTime step covers the frame
+	TArray<FKawaiiFluidParticle> Calm = MakeBlock(Preset.Get(), FVector::ZeroVector);
+	float AccumulatedTime = 0.0f;
+	Context->SimulateCPU(Calm, Preset.Get(), Params, SpatialHash, FrameDeltaTime, AccumulatedTime);
+	const int32 CalmSubsteps = Context->GetLastAdaptiveStepStats().NumSubsteps;
+	TestEqual(TEXT("Resting block needs a single substep"), CalmSubsteps, 1);
+
+	// Fast block: the first step obeys dt <= CFL * h / v
+	TArray<FKawaiiFluidParticle> Fast = MakeBlock(Preset.Get(), FVector(FastSpeed, 0.0f, 0.0f));
+	AccumulatedTime = 0.0f;
+	Context->SimulateCPU(Fast, Preset.Get(), Params, SpatialHash, FrameDeltaTime, AccumulatedTime);
+	const FKawaiiFluidAdaptiveStepStats& Stats = Context->GetLastAdaptiveStepStats();
+
+	const float CFLStep = Preset->CFLNumber * Preset->SmoothingRadius / FastSpeed;
+	TestTrue(TEXT("Fast block takes more substeps"), Stats.NumSubsteps > CalmSubsteps);
+	TestTrue(TEXT("Smallest substep respects the CFL condition"), Stats.MinSubstepDeltaTime <= CFLStep * 1.001f);
+	TestTrue(TEXT("Largest substep respects the step cap"), Stats.MaxSubstepDeltaTime <= Preset->MaxAdaptiveSubstepDeltaTime * 1.001f);
+	TestTrue(TEXT("Fast block speed is seen by the CFL condition"), Stats.MaxSpeed >= FastSpeed * 0.99f);
+	TestEqual(TEXT("No time is dropped below the ceiling"), Stats.DroppedTime, 0.0f);
+	TestTrue(TEXT("Frame time is fully consumed"), FMath::IsNearlyZero(AccumulatedTime, 1.0e-5f));
+
+	return true;
+}
+
+/**
+ * @brief The substep ceiling bounds the work per frame and drops the time it cannot cover.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidAdaptiveStepTest_SubstepCeiling::RunTest(const FString& Parameters)
+{
+	TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Preset(NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage()));
+	Preset->bEnableAdaptiveSubstepping = true;
+	Preset->MaxAdaptiveSubsteps = 2;
+	Preset->RecalculateDerivedParameters();
+
+	TStrongObjectPtr<UKawaiiFluidSimulationContext> Context = MakeContext(Preset.Get());
+	FKawaiiFluidSpatialHash SpatialHash(Preset->SmoothingRadius);
+	const FKawaiiFluidSimulationParams Params = MakeParams(Preset.Get());
+
+	TArray<FKawaiiFluidParticle> Fast = MakeBlock(Preset.Get(), FVector(FastSpeed, 0.0f, 0.0f));
+	float AccumulatedTime = 0.0f;
+	Context->SimulateCPU(Fast, Preset.Get(), Params, SpatialHash, FrameDeltaTime, AccumulatedTime);
+	const FKawaiiFluidAdaptiveStepStats& Stats = Context->GetLastAdaptiveStepStats();
+
+	TestEqual(TEXT("Substeps stop at the ceiling"), Stats.NumSubsteps, 2);
+	TestTrue(TEXT("Uncovered time is dropped"), Stats.DroppedTime > 0.0f);
+	TestTrue(TEXT("Simulated plus dropped time is the frame time"),
+		FMath::IsNearlyEqual(Stats.DroppedTime + Stats.MinSubstepDeltaTime + Stats.MaxSubstepDeltaTime, FrameDeltaTime, 1.0e-4f));
+	TestTrue(TEXT("Dropped time does not carry over"), FMath::IsNearlyZero(AccumulatedTime, 1.0e-5f));
+
+	return true;
+}
+
+/**
+ * @brief Density iterations stop at the error tolerance and never exceed the per-frame budget.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidAdaptiveStepTest_SolverEarlyExit::RunTest(const FString& Parameters)
+{
+	TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Preset(NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage()));
+	Preset->SolverIterations = 4;
+	Preset->bEnableSolverEarlyExit = true;
+	Preset->MinSolverIterations = 1;
+	Preset->DensityErrorTolerance = 100.0f;
+	Preset->MaxDensityErrorTolerance = 1000.0f;
+	Preset->RecalculateDerivedParameters();
+
+	TStrongObjectPtr<UKawaiiFluidSimulationContext> Context = MakeContext(Preset.Get());
+	FKawaiiFluidSpatialHash SpatialHash(Preset->SmoothingRadius);
+	const FKawaiiFluidSimulationParams Params = MakeParams(Preset.Get());
+
+	// A loose tolerance is met after MinSolverIterations in every substep
+	TArray<FKawaiiFluidParticle> Particles = MakeBlock(Preset.Get(), FVector::ZeroVector);
+	float AccumulatedTime = 0.0f;
+	Context->SimulateCPU(Particles, Preset.Get(), Params, SpatialHash, FrameDeltaTime, AccumulatedTime);
+	{
+		const FKawaiiFluidAdaptiveStepStats& Stats = Context->GetLastAdaptiveStepStats();
+		TestTrue(TEXT("Substeps ran"), Stats.NumSubsteps > 0);
+		TestEqual(TEXT("Every substep exits early"), Stats.NumEarlyExits, Stats.NumSubsteps);
+		TestEqual(TEXT("One iteration per substep"), Stats.NumSolverIterations, Stats.NumSubsteps);
+	}
+
+	// Without early exit the per-frame budget caps the iterations, keeping one per substep
+	Preset->bEnableSolverEarlyExit = false;
+	Preset->MaxSolverIterationsPerFrame = 5;
+	Context->SimulateCPU(Particles, Preset.Get(), Params, SpatialHash, FrameDeltaTime, AccumulatedTime);
+	{
+		const FKawaiiFluidAdaptiveStepStats& Stats = Context->GetLastAdaptiveStepStats();
+		TestEqual(TEXT("No early exits when disabled"), Stats.NumEarlyExits, 0);
+		TestTrue(TEXT("Iteration budget is respected"), Stats.NumSolverIterations <= FMath::Max(Preset->MaxSolverIterationsPerFrame, Stats.NumSubsteps));
+		TestTrue(TEXT("Every substep keeps at least one iteration"), Stats.NumSolverIterations >= Stats.NumSubsteps);
+	}
+
+	return true;
+}
+
+#endif
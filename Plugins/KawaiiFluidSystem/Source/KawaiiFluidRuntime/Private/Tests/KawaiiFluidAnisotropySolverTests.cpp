@@ -0,0 +1,395 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Algo/Sort.h"
+#include "Core/KawaiiFluidParticle.h"
+#include "Simulation/Physics/KawaiiFluidAnisotropySolver.h"
+#include "Simulation/Utils/KawaiiFluidSparseBrickGrid.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_EigenDegenerate,
+	"KawaiiFluid.Simulation.Anisotropy.T01_EigenDegenerate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_EigenRandom,
+	"KawaiiFluid.Simulation.Anisotropy.T02_EigenRandom",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_DensityShapes,
+	"KawaiiFluid.Simulation.Anisotropy.T03_DensityShapes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_IntervalAndSmoothing,
+	"KawaiiFluid.Simulation.Anisotropy.T04_IntervalAndSmoothing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidAnisotropyTest_NeighborCSR,
+	"KawaiiFluid.Simulation.Anisotropy.T05_NeighborCSR",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float SmoothingRadius = 20.0f;
+
+	/**
+	 * @struct FTestMatrix
+	 * @brief Helper: Symmetric 3x3 matrix given by its upper triangle.
+	 */
+	struct FTestMatrix
+	{
+		float M00, M01, M02, M11, M12, M22;
+
+		FVector3f Multiply(const FVector3f& V) const
+		{
+			return FVector3f(
+				M00 * V.X + M01 * V.Y + M02 * V.Z,
+				M01 * V.X + M11 * V.Y + M12 * V.Z,
+				M02 * V.X + M12 * V.Y + M22 * V.Z);
+		}
+
+		float MaxAbs() const
+		{
+			return FMath::Max(FMath::Max3(FMath::Abs(M00), FMath::Abs(M01), FMath::Abs(M02)),
+				FMath::Max3(FMath::Abs(M11), FMath::Abs(M12), FMath::Abs(M22)));
+		}
+
+		KawaiiFluidAnisotropyMath::FSymmetricEigen3 Solve() const
+		{
+			return KawaiiFluidAnisotropyMath::SolveSymmetricEigen3x3(M00, M01, M02, M11, M12, M22);
+		}
+	};
+
+	/**
+	 * @brief Helper: R * diag(Values) * R^T.
+	 * @param Rotation Rotation R.
+	 * @param Values Diagonal entries.
+	 * @return Symmetric matrix with the given eigenvalues.
+	 */
+	FTestMatrix MakeRotated(const FQuat4f& Rotation, const FVector3f& Values)
+	{
+		const FVector3f Axes[3] = { Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ() };
+		FTestMatrix Matrix = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+		for (int32 k = 0; k < 3; ++k)
+		{
+			const FVector3f& A = Axes[k];
+			Matrix.M00 += Values[k] * A.X * A.X;
+			Matrix.M01 += Values[k] * A.X * A.Y;
+			Matrix.M02 += Values[k] * A.X * A.Z;
+			Matrix.M11 += Values[k] * A.Y * A.Y;
+			Matrix.M12 += Values[k] * A.Y * A.Z;
+			Matrix.M22 += Values[k] * A.Z * A.Z;
+		}
+		return Matrix;
+	}
+
+	/**
+	 * @brief Helper: Check descending order, an orthonormal right-handed basis and |Av - lv| relative to the largest entry.
+	 * @param Matrix Input matrix.
+	 * @param Eigen Decomposition under test.
+	 * @param RelTolerance Residual tolerance relative to the largest entry.
+	 * @return True if the decomposition is valid.
+	 */
+	bool IsValidDecomposition(const FTestMatrix& Matrix, const KawaiiFluidAnisotropyMath::FSymmetricEigen3& Eigen, float RelTolerance)
+	{
+		if (Eigen.Values[0] < Eigen.Values[1] || Eigen.Values[1] < Eigen.Values[2])
+		{
+			return false;
+		}
+
+		for (int32 k = 0; k < 3; ++k)
+		{
+			if (!FMath::IsNearlyEqual(Eigen.Vectors[k].Size(), 1.0f, 1.0e-4f)
+				|| FMath::Abs(FVector3f::DotProduct(Eigen.Vectors[k], Eigen.Vectors[(k + 1) % 3])) > 1.0e-4f)
+			{
+				return false;
+			}
+		}
+
+		if (FVector3f::DotProduct(FVector3f::CrossProduct(Eigen.Vectors[0], Eigen.Vectors[1]), Eigen.Vectors[2]) < 0.999f)
+		{
+			return false;
+		}
+
+		const float Tolerance = RelTolerance * FMath::Max(Matrix.MaxAbs(), UE_SMALL_NUMBER);
+		for (int32 k = 0; k < 3; ++k)
+		{
+			const FVector3f Residual = Matrix.Multiply(Eigen.Vectors[k]) - Eigen.Values[k] * Eigen.Vectors[k];
+			if (Residual.Size() > Tolerance)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Helper: Particles with brute-force neighbor lists that include the particle itself, like the spatial hash.
+	 * @param Positions Particle positions (cm).
+	 * @return Particles at rest.
+	 */
+	TArray<FKawaiiFluidParticle> MakeParticles(const TArray<FVector3f>& Positions)
+	{
+		TArray<FKawaiiFluidParticle> Particles;
+		Particles.SetNum(Positions.Num());
+		for (int32 i = 0; i < Positions.Num(); ++i)
+		{
+			Particles[i].Position = FVector(Positions[i]);
+			for (int32 j = 0; j < Positions.Num(); ++j)
+			{
+				if (FVector3f::DistSquared(Positions[i], Positions[j]) < SmoothingRadius * SmoothingRadius)
+				{
+					Particles[i].NeighborIndices.Add(j);
+				}
+			}
+		}
+		return Particles;
+	}
+
+	/**
+	 * @brief Helper: Enabled parameters that compute every call without temporal smoothing.
+	 * @param Mode Anisotropy mode.
+	 * @return Parameters.
+	 */
+	FKawaiiFluidAnisotropyParams MakeParams(EKawaiiFluidAnisotropyMode Mode)
+	{
+		FKawaiiFluidAnisotropyParams Params;
+		Params.bEnabled = true;
+		Params.Mode = Mode;
+		Params.UpdateInterval = 1;
+		Params.bEnableTemporalSmoothing = false;
+		return Params;
+	}
+
+	FVector3f AxisOf(const FVector4f& Axis)
+	{
+		return FVector3f(Axis.X, Axis.Y, Axis.Z);
+	}
+}
+
+/**
+ * @brief Jacobi solver on zero, identity, unsorted diagonal, rank-1/2, repeated, nearly diagonal, badly scaled and NaN input.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidAnisotropyTest_EigenDegenerate::RunTest(const FString& Parameters)
+{
+	const FQuat4f Rotation = FQuat4f(FVector3f(1.0f, 2.0f, -0.5f).GetSafeNormal(), 0.7f);
+
+	struct FCase
+	{
+		const TCHAR* Name;
+		FTestMatrix Matrix;
+		FVector3f ExpectedValues;
+	};
+
+	const FCase Cases[] = {
+		{ TEXT("zero"), { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f }, FVector3f(0.0f, 0.0f, 0.0f) },
+		{ TEXT("identity"), { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f }, FVector3f(1.0f, 1.0f, 1.0f) },
+		{ TEXT("unsorted diagonal"), { 1.0f, 0.0f, 0.0f, 3.0f, 0.0f, 2.0f }, FVector3f(3.0f, 2.0f, 1.0f) },
+		{ TEXT("rank 1"), { 1.0f, 2.0f, 3.0f, 4.0f, 6.0f, 9.0f }, FVector3f(14.0f, 0.0f, 0.0f) },
+		{ TEXT("rank 2"), MakeRotated(Rotation, FVector3f(4.0f, 0.0f, 1.0f)), FVector3f(4.0f, 1.0f, 0.0f) },
+		{ TEXT("two equal"), MakeRotated(Rotation, FVector3f(5.0f, 5.0f, 1.0f)), FVector3f(5.0f, 5.0f, 1.0f) },
+		{ TEXT("three equal rotated"), MakeRotated(Rotation, FVector3f(2.0f, 2.0f, 2.0f)), FVector3f(2.0f, 2.0f, 2.0f) },
+		{ TEXT("tiny off-diagonal"), { 1.0f, 1.0e-7f, 0.0f, 1.0f, 1.0e-7f, 2.0f }, FVector3f(2.0f, 1.0f, 1.0f) },
+		{ TEXT("scale 1e6"), MakeRotated(Rotation, FVector3f(3.0e6f, 2.0e6f, 1.0e6f)), FVector3f(3.0e6f, 2.0e6f, 1.0e6f) },
+		{ TEXT("scale 1e-8"), MakeRotated(Rotation, FVector3f(3.0e-8f, 2.0e-8f, 1.0e-8f)), FVector3f(3.0e-8f, 2.0e-8f, 1.0e-8f) },
+		{ TEXT("indefinite"), MakeRotated(Rotation, FVector3f(2.0f, -1.0f, -3.0f)), FVector3f(2.0f, -1.0f, -3.0f) },
+	};
+
+	for (const FCase& Case : Cases)
+	{
+		const KawaiiFluidAnisotropyMath::FSymmetricEigen3 Eigen = Case.Matrix.Solve();
+		TestTrue(FString::Printf(TEXT("%s: valid decomposition"), Case.Name), IsValidDecomposition(Case.Matrix, Eigen, 1.0e-5f));
+
+		const float Tolerance = 1.0e-5f * FMath::Max(Case.Matrix.MaxAbs(), UE_SMALL_NUMBER);
+		TestTrue(FString::Printf(TEXT("%s: eigenvalues"), Case.Name), Eigen.Values.Equals(Case.ExpectedValues, Tolerance));
+	}
+
+	// Non-finite input must not poison the render data
+	const KawaiiFluidAnisotropyMath::FSymmetricEigen3 NaNEigen =
+		KawaiiFluidAnisotropyMath::SolveSymmetricEigen3x3(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f, 1.0f, 0.0f, 1.0f);
+	TestTrue(TEXT("NaN: zero eigenvalues"), NaNEigen.Values.IsZero());
+	TestTrue(TEXT("NaN: identity basis"), NaNEigen.Vectors[0] == FVector3f(1.0f, 0.0f, 0.0f)
+		&& NaNEigen.Vectors[1] == FVector3f(0.0f, 1.0f, 0.0f) && NaNEigen.Vectors[2] == FVector3f(0.0f, 0.0f, 1.0f));
+	return true;
+}
+
+/**
+ * @brief Jacobi solver on random rotated SPD matrices, a third of them with a repeated eigenvalue.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidAnisotropyTest_EigenRandom::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(48);
+	int32 NumInvalid = 0;
+	int32 NumWrongValues = 0;
+	constexpr int32 NumMatrices = 5000;
+
+	for (int32 i = 0; i < NumMatrices; ++i)
+	{
+		const FQuat4f Rotation(FVector3f(Random.GetUnitVector()), Random.FRandRange(0.0f, 2.0f * PI));
+		float Values[3] = { Random.FRandRange(0.0f, 100.0f), Random.FRandRange(0.0f, 100.0f), Random.FRandRange(0.0f, 100.0f) };
+		if (i % 3 == 0)
+		{
+			Values[1] = Values[0];
+		}
+
+		const FTestMatrix Matrix = MakeRotated(Rotation, FVector3f(Values[0], Values[1], Values[2]));
+		const KawaiiFluidAnisotropyMath::FSymmetricEigen3 Eigen = Matrix.Solve();
+
+		Algo::Sort(Values, [](float L, float R) { return L > R; });
+		NumInvalid += IsValidDecomposition(Matrix, Eigen, 1.0e-5f) ? 0 : 1;
+		NumWrongValues += Eigen.Values.Equals(FVector3f(Values[0], Values[1], Values[2]), 1.0e-5f * Matrix.MaxAbs() + 1.0e-6f) ? 0 : 1;
+	}
+
+	TestEqual(TEXT("Invalid decompositions"), NumInvalid, 0);
+	TestEqual(TEXT("Wrong eigenvalues"), NumWrongValues, 0);
+	return true;
+}
+
+/**
+ * @brief Density-based ellipsoids: a sheet flattens along its normal, a line stretches along itself, a loner stays a sphere.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidAnisotropyTest_DensityShapes::RunTest(const FString& Parameters)
+{
+	const FKawaiiFluidAnisotropyParams Params = MakeParams(EKawaiiFluidAnisotropyMode::DensityBased);
+
+	// 9x9 sheet in XY, spacing 5 cm; index 40 is the center
+	{
+		TArray<FVector3f> Positions;
+		for (int32 y = -4; y <= 4; ++y)
+		{
+			for (int32 x = -4; x <= 4; ++x)
+			{
+				Positions.Add(FVector3f(x * 5.0f, y * 5.0f, 0.0f));
+			}
+		}
+
+		FKawaiiFluidAnisotropySolver Solver;
+		TestTrue(TEXT("Sheet: computed"), Solver.Update(Params, MakeParticles(Positions), SmoothingRadius));
+
+		const FVector4f& Major = Solver.GetAxis1()[40];
+		const FVector4f& Minor = Solver.GetAxis3()[40];
+		TestTrue(TEXT("Sheet: minor axis along the normal"), FMath::Abs(Minor.Z) > 0.99f);
+		TestTrue(TEXT("Sheet: flattened"), Minor.W < Major.W * 0.75f);
+		TestTrue(TEXT("Sheet: within stretch limits"), Minor.W >= Params.MinStretch - 1.0e-4f && Major.W <= Params.MaxStretch + 1.0e-4f);
+	}
+
+	// Line along a diagonal, spacing 4 cm, plus a particle far from everything
+	{
+		const FVector3f Direction = FVector3f(1.0f, 1.0f, 0.5f).GetSafeNormal();
+		TArray<FVector3f> Positions;
+		for (int32 i = -5; i <= 5; ++i)
+		{
+			Positions.Add(Direction * (i * 4.0f));
+		}
+		Positions.Add(FVector3f(1000.0f, 0.0f, 0.0f));
+
+		FKawaiiFluidAnisotropySolver Solver;
+		TestTrue(TEXT("Line: computed"), Solver.Update(Params, MakeParticles(Positions), SmoothingRadius));
+
+		const FVector4f& Major = Solver.GetAxis1()[5];
+		TestTrue(TEXT("Line: major axis along the line"), FMath::Abs(FVector3f::DotProduct(AxisOf(Major), Direction)) > 0.99f);
+		TestTrue(TEXT("Line: stretched"), Major.W > Solver.GetAxis3()[5].W);
+
+		const int32 Loner = Positions.Num() - 1;
+		TestTrue(TEXT("Isolated: sphere"), Solver.GetAxis1()[Loner].W == 1.0f && Solver.GetAxis2()[Loner].W == 1.0f && Solver.GetAxis3()[Loner].W == 1.0f);
+	}
+	return true;
+}
+
+/**
+ * @brief UpdateInterval skips like the GPU counter, a count change forces an update, temporal smoothing blends axes.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidAnisotropyTest_IntervalAndSmoothing::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidAnisotropyParams Params = MakeParams(EKawaiiFluidAnisotropyMode::VelocityBased);
+	Params.UpdateInterval = 3;
+
+	const FKawaiiFluidNeighborCSR NoNeighbors;
+	const TArray<FVector3f> Positions = { FVector3f::ZeroVector };
+	const TArray<FVector3f> AlongX = { FVector3f(100.0f, 0.0f, 0.0f) };
+	const TArray<FVector3f> AlongY = { FVector3f(0.0f, 100.0f, 0.0f) };
+
+	FKawaiiFluidAnisotropySolver Solver;
+	TestTrue(TEXT("First call computes"), Solver.Update(Params, Positions, AlongX, NoNeighbors, SmoothingRadius));
+	TestFalse(TEXT("Second call skips"), Solver.Update(Params, Positions, AlongX, NoNeighbors, SmoothingRadius));
+	TestFalse(TEXT("Third call skips"), Solver.Update(Params, Positions, AlongX, NoNeighbors, SmoothingRadius));
+	TestTrue(TEXT("Fourth call computes"), Solver.Update(Params, Positions, AlongX, NoNeighbors, SmoothingRadius));
+
+	// 1 + 100 * 0.01 = 2 along the velocity, 1/sqrt(2) across it
+	TestTrue(TEXT("Velocity axis"), AxisOf(Solver.GetAxis1()[0]).Equals(FVector3f(1.0f, 0.0f, 0.0f), 1.0e-5f));
+	TestTrue(TEXT("Velocity scales"), FMath::IsNearlyEqual(Solver.GetAxis1()[0].W, 2.0f, 1.0e-4f)
+		&& FMath::IsNearlyEqual(Solver.GetAxis2()[0].W, UE_INV_SQRT_2, 1.0e-4f));
+
+	const TArray<FVector3f> TwoPositions = { FVector3f::ZeroVector, FVector3f(100.0f, 0.0f, 0.0f) };
+	const TArray<FVector3f> TwoVelocities = { AlongX[0], AlongX[0] };
+	TestTrue(TEXT("Count change computes"), Solver.Update(Params, TwoPositions, TwoVelocities, NoNeighbors, SmoothingRadius));
+
+	// Smoothing: half way between the previous X axis and the new Y axis
+	Params.UpdateInterval = 1;
+	Params.bEnableTemporalSmoothing = true;
+	Params.TemporalSmoothFactor = 0.5f;
+	Solver.Reset();
+	Solver.Update(Params, Positions, AlongX, NoNeighbors, SmoothingRadius);
+	Solver.Update(Params, Positions, AlongY, NoNeighbors, SmoothingRadius);
+	TestTrue(TEXT("Smoothed axis"), AxisOf(Solver.GetAxis1()[0]).Equals(FVector3f(1.0f, 1.0f, 0.0f).GetSafeNormal(), 1.0e-4f));
+	TestTrue(TEXT("Smoothed scale"), FMath::IsNearlyEqual(Solver.GetAxis1()[0].W, 2.0f, 1.0e-4f));
+
+	Params.bEnabled = false;
+	TestFalse(TEXT("Disabled skips"), Solver.Update(Params, Positions, AlongX, NoNeighbors, SmoothingRadius));
+	TestFalse(TEXT("Disabled drops the result"), Solver.HasResult());
+	return true;
+}
+
+/**
+ * @brief CSR radius search over bare positions matches brute force, self excluded.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidAnisotropyTest_NeighborCSR::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(7);
+	TArray<FVector3f> Positions;
+	for (int32 i = 0; i < 3000; ++i)
+	{
+		const FVector3f Offset = i < 2000 ? FVector3f::ZeroVector : FVector3f(-5.0e5f, 2.0e5f, 1.0e4f);
+		Positions.Add(Offset + FVector3f(Random.FRandRange(-60.0f, 60.0f), Random.FRandRange(-60.0f, 60.0f), Random.FRandRange(-60.0f, 60.0f)));
+	}
+
+	constexpr float Radius = 10.0f;
+	FKawaiiFluidSparseBrickGrid Grid;
+	FKawaiiFluidMortonSorter Sorter;
+	FKawaiiFluidNeighborCSR CSR;
+	CSR.BuildFromPositions(Positions, Radius, Grid, Sorter);
+	TestEqual(TEXT("One list per particle"), CSR.Num(), Positions.Num());
+
+	int32 NumMismatched = 0;
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		TArray<int32> Expected;
+		for (int32 j = 0; j < Positions.Num(); ++j)
+		{
+			if (j != i && FVector3f::DistSquared(Positions[i], Positions[j]) < Radius * Radius)
+			{
+				Expected.Add(j);
+			}
+		}
+
+		TArray<int32> Actual(CSR.GetNeighbors(i));
+		Actual.Sort();
+		NumMismatched += Actual == Expected ? 0 : 1;
+	}
+	TestEqual(TEXT("Lists matching brute force"), NumMismatched, 0);
+	return true;
+}
+
+#endif
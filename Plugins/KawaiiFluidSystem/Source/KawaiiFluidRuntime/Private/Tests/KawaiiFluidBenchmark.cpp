@@ -0,0 +1,846 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "Tests/KawaiiFluidBenchmark.h"
+#include "Tests/KawaiiFluidMetricsCollector.h"
+#include "Tests/KawaiiFluidTestMetrics.h"
+#include "Logging/KawaiiFluidLog.h"
+#include "Core/KawaiiFluidSimulationContext.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+#include "Core/KawaiiFluidSpatialHash.h"
+#include "Core/KawaiiFluidParticle.h"
+#include "Simulation/Collision/KawaiiFluidCapsuleCollider.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformMisc.h"
+#include "Math/RandomStream.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/**
+	 * @brief Initial state of a benchmark scenario.
+	 * @param Container Box the particles are confined to (cm).
+	 * @param Particles Initial particles.
+	 * @param StreamParticlesPerFrame Particles emitted per frame (0 = no stream).
+	 * @param StreamGridSize Side length of the square nozzle lattice.
+	 * @param StreamOrigin Center of the nozzle lattice.
+	 * @param StreamVelocity Initial velocity of emitted particles.
+	 * @param bHasWadingCapsule Whether a capsule collider walks through the fluid.
+	 * @param WadeStart Capsule center at the start of each pass.
+	 * @param WadeEnd Capsule center at the end of each pass.
+	 * @param WadeSpeed Capsule walking speed (cm/s).
+	 * @param WadeRadius Capsule radius (cm).
+	 * @param WadeHalfHeight Capsule half-height (cm).
+	 */
+	struct FBenchmarkScene
+	{
+		FBox Container = FBox(ForceInit);
+
+		TArray<FKawaiiFluidParticle> Particles;
+
+		int32 StreamParticlesPerFrame = 0;
+
+		int32 StreamGridSize = 0;
+
+		FVector StreamOrigin = FVector::ZeroVector;
+
+		FVector StreamVelocity = FVector::ZeroVector;
+
+		bool bHasWadingCapsule = false;
+
+		FVector WadeStart = FVector::ZeroVector;
+
+		FVector WadeEnd = FVector::ZeroVector;
+
+		float WadeSpeed = 150.0f;
+
+		float WadeRadius = 0.0f;
+
+		float WadeHalfHeight = 0.0f;
+	};
+
+	/**
+	 * @brief Helper: Append a jittered lattice of particles filling a box.
+	 * @param OutParticles Particle array to append to.
+	 * @param Block Region to fill (cm).
+	 * @param Spacing Lattice spacing (cm).
+	 * @param Mass Mass of each particle.
+	 * @param MaxCount Upper bound on the number of appended particles.
+	 * @param Random Deterministic random stream for jitter.
+	 */
+	void AddParticleBlock(
+		TArray<FKawaiiFluidParticle>& OutParticles,
+		const FBox& Block,
+		float Spacing,
+		float Mass,
+		int32 MaxCount,
+		FRandomStream& Random)
+	{
+		const FVector Size = Block.GetSize();
+		const int32 CountX = FMath::Max(1, FMath::FloorToInt(Size.X / Spacing));
+		const int32 CountY = FMath::Max(1, FMath::FloorToInt(Size.Y / Spacing));
+		const int32 CountZ = FMath::Max(1, FMath::FloorToInt(Size.Z / Spacing));
+		const FVector Start = Block.Min + FVector(Spacing * 0.5f);
+		const float Jitter = Spacing * 0.01f;
+
+		OutParticles.Reserve(OutParticles.Num() + FMath::Min(MaxCount, CountX * CountY * CountZ));
+
+		int32 Added = 0;
+		for (int32 z = 0; z < CountZ && Added < MaxCount; ++z)
+		{
+			for (int32 y = 0; y < CountY && Added < MaxCount; ++y)
+			{
+				for (int32 x = 0; x < CountX && Added < MaxCount; ++x)
+				{
+					FKawaiiFluidParticle Particle;
+					Particle.Position = Start + FVector(x, y, z) * Spacing
+						+ FVector(Random.FRandRange(-Jitter, Jitter), Random.FRandRange(-Jitter, Jitter), Random.FRandRange(-Jitter, Jitter));
+					Particle.PredictedPosition = Particle.Position;
+					Particle.Mass = Mass;
+					Particle.ParticleID = OutParticles.Num();
+					OutParticles.Add(Particle);
+					++Added;
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief Helper: Footprint of a pool holding a given number of particles.
+	 * @param ParticleCount Number of particles in the pool.
+	 * @param AspectX Pool length relative to its width.
+	 * @param OutSideX Particles along X.
+	 * @param OutSideY Particles along Y.
+	 * @param OutLayers Particle layers along Z.
+	 */
+	void ComputePoolLayout(int32 ParticleCount, int32 AspectX, int32& OutSideX, int32& OutSideY, int32& OutLayers)
+	{
+		OutLayers = FMath::Max(4, FMath::RoundToInt(FMath::Pow(static_cast<float>(ParticleCount), 1.0f / 3.0f) * 0.5f));
+		const float Footprint = static_cast<float>(ParticleCount) / (OutLayers * AspectX);
+		OutSideY = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(Footprint)));
+		OutSideX = OutSideY * AspectX;
+		OutLayers = FMath::CeilToInt(static_cast<float>(ParticleCount) / (OutSideX * OutSideY));
+	}
+
+	/**
+	 * @brief Helper: Build the initial state for a scenario.
+	 * @param Config Benchmark configuration.
+	 * @param Preset Preset providing spacing and mass.
+	 * @return Scene description.
+	 */
+	FBenchmarkScene BuildScene(const FKawaiiFluidBenchmarkConfig& Config, const UKawaiiFluidPresetDataAsset* Preset)
+	{
+		FBenchmarkScene Scene;
+		FRandomStream Random(Config.RandomSeed);
+
+		const float Spacing = Preset->ParticleSpacing;
+		const float Mass = Preset->ParticleMass;
+		const int32 Count = FMath::Max(1, Config.TargetParticleCount);
+
+		switch (Config.Scenario)
+		{
+		case EKawaiiFluidBenchmarkScenario::DamBreak:
+		{
+			// Water column (1 x 1 x 2) against one wall of a 4x longer tank
+			const int32 Side = FMath::Max(2, FMath::CeilToInt(FMath::Pow(Count * 0.5f, 1.0f / 3.0f)));
+			const FVector ColumnSize = FVector(Side, Side, Side * 2) * Spacing;
+			Scene.Container = FBox(FVector::ZeroVector, FVector(ColumnSize.X * 4.0f, ColumnSize.Y, ColumnSize.Z * 1.5f));
+			AddParticleBlock(Scene.Particles, FBox(FVector::ZeroVector, ColumnSize), Spacing, Mass, Count, Random);
+			break;
+		}
+
+		case EKawaiiFluidBenchmarkScenario::PoolAtRest:
+		case EKawaiiFluidBenchmarkScenario::LargeFill:
+		{
+			int32 SideX, SideY, Layers;
+			ComputePoolLayout(Count, 1, SideX, SideY, Layers);
+			const FVector PoolSize = FVector(SideX, SideY, Layers) * Spacing;
+			Scene.Container = FBox(FVector::ZeroVector, FVector(PoolSize.X, PoolSize.Y, PoolSize.Z * 2.0f));
+
+			// Fill drops the block from a small height so the solver has to settle it
+			const FVector Offset = Config.Scenario == EKawaiiFluidBenchmarkScenario::LargeFill
+				? FVector(0.0f, 0.0f, Spacing * 2.0f)
+				: FVector::ZeroVector;
+			AddParticleBlock(Scene.Particles, FBox(Offset, PoolSize + Offset), Spacing, Mass, Count, Random);
+			break;
+		}
+
+		case EKawaiiFluidBenchmarkScenario::StreamIntoBox:
+		{
+			int32 SideX, SideY, Layers;
+			ComputePoolLayout(Count, 1, SideX, SideY, Layers);
+			const FVector PoolSize = FVector(SideX, SideY, Layers) * Spacing;
+			Scene.Container = FBox(FVector::ZeroVector, FVector(PoolSize.X, PoolSize.Y, PoolSize.Z * 3.0f));
+
+			// Emit the full count over the run, one nozzle layer per frame
+			const int32 TotalFrames = FMath::Max(1, Config.WarmupFrames + Config.MeasuredFrames);
+			Scene.StreamParticlesPerFrame = FMath::Max(1, FMath::CeilToInt(static_cast<float>(Count) / TotalFrames));
+			Scene.StreamGridSize = FMath::Min(FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Scene.StreamParticlesPerFrame))), FMath::Max(1, SideX - 2));
+			Scene.StreamOrigin = FVector(PoolSize.X * 0.5f, PoolSize.Y * 0.5f, Scene.Container.Max.Z - Spacing * 2.0f);
+
+			// Layers must travel at least one spacing per frame to avoid overlapping the next layer
+			const float FrameDT = Preset->SubstepDeltaTime * FMath::Max(1, Config.SubstepsPerFrame);
+			Scene.StreamVelocity = FVector(0.0f, 0.0f, -1.2f * Spacing / FrameDT);
+			break;
+		}
+
+		case EKawaiiFluidBenchmarkScenario::CharacterWading:
+		{
+			int32 SideX, SideY, Layers;
+			ComputePoolLayout(Count, 2, SideX, SideY, Layers);
+			const FVector PoolSize = FVector(SideX, SideY, Layers) * Spacing;
+			Scene.Container = FBox(FVector::ZeroVector, FVector(PoolSize.X, PoolSize.Y, PoolSize.Z * 2.0f));
+			AddParticleBlock(Scene.Particles, FBox(FVector::ZeroVector, PoolSize), Spacing, Mass, Count, Random);
+
+			// Leg-sized capsule standing on the floor, walking along the pool
+			Scene.bHasWadingCapsule = true;
+			Scene.WadeRadius = FMath::Max(Spacing * 2.0f, PoolSize.Y * 0.1f);
+			Scene.WadeHalfHeight = PoolSize.Z;
+			Scene.WadeStart = FVector(Scene.WadeRadius * 2.0f, PoolSize.Y * 0.5f, Scene.WadeHalfHeight);
+			Scene.WadeEnd = FVector(PoolSize.X - Scene.WadeRadius * 2.0f, PoolSize.Y * 0.5f, Scene.WadeHalfHeight);
+			break;
+		}
+		}
+
+		return Scene;
+	}
+
+	/**
+	 * @brief Helper: Emit one nozzle layer of the stream scenario.
+	 * @param Scene Scene providing nozzle parameters.
+	 * @param Particles Particle array to append to.
+	 * @param Mass Mass of each particle.
+	 * @param Spacing Nozzle lattice spacing.
+	 * @param MaxCount Upper bound on the total particle count.
+	 */
+	void EmitStream(const FBenchmarkScene& Scene, TArray<FKawaiiFluidParticle>& Particles, float Mass, float Spacing, int32 MaxCount)
+	{
+		const int32 Grid = Scene.StreamGridSize;
+		const float HalfExtent = (Grid - 1) * Spacing * 0.5f;
+
+		int32 Emitted = 0;
+		for (int32 y = 0; y < Grid && Emitted < Scene.StreamParticlesPerFrame; ++y)
+		{
+			for (int32 x = 0; x < Grid && Emitted < Scene.StreamParticlesPerFrame; ++x)
+			{
+				if (Particles.Num() >= MaxCount)
+				{
+					return;
+				}
+
+				FKawaiiFluidParticle Particle;
+				Particle.Position = Scene.StreamOrigin + FVector(x * Spacing - HalfExtent, y * Spacing - HalfExtent, 0.0f);
+				Particle.PredictedPosition = Particle.Position;
+				Particle.Velocity = Scene.StreamVelocity;
+				Particle.Mass = Mass;
+				Particle.ParticleID = Particles.Num();
+				Particles.Add(Particle);
+				++Emitted;
+			}
+		}
+	}
+
+	/**
+	 * @brief Helper: Capsule position for a ping-pong walk between two points.
+	 * @param Scene Scene providing the walk.
+	 * @param Time Elapsed simulation time (s).
+	 * @return Capsule center.
+	 */
+	FVector GetWadePosition(const FBenchmarkScene& Scene, float Time)
+	{
+		const float Length = FVector::Dist(Scene.WadeStart, Scene.WadeEnd);
+		if (Length <= KINDA_SMALL_NUMBER)
+		{
+			return Scene.WadeStart;
+		}
+
+		const float Travel = FMath::Fmod(Time * Scene.WadeSpeed, Length * 2.0f);
+		const float Alpha = Travel <= Length ? Travel / Length : 2.0f - Travel / Length;
+		return FMath::Lerp(Scene.WadeStart, Scene.WadeEnd, Alpha);
+	}
+}
+
+//========================================
+// FKawaiiFluidBenchmarkConfig
+//========================================
+
+/**
+ * @brief Default configuration for a scenario.
+ * @param InScenario Scenario to configure.
+ * @return Configuration sized so each scenario finishes in seconds on a desktop CPU.
+ */
+FKawaiiFluidBenchmarkConfig FKawaiiFluidBenchmarkConfig::MakeDefault(EKawaiiFluidBenchmarkScenario InScenario)
+{
+	FKawaiiFluidBenchmarkConfig Config;
+	Config.Scenario = InScenario;
+
+	switch (InScenario)
+	{
+	case EKawaiiFluidBenchmarkScenario::DamBreak:
+		Config.TargetParticleCount = 8000;
+		Config.MeasuredFrames = 60;
+		break;
+
+	case EKawaiiFluidBenchmarkScenario::PoolAtRest:
+		Config.TargetParticleCount = 8000;
+		Config.MeasuredFrames = 90;
+		break;
+
+	case EKawaiiFluidBenchmarkScenario::StreamIntoBox:
+		Config.TargetParticleCount = 8000;
+		Config.WarmupFrames = 0;
+		Config.MeasuredFrames = 120;
+		break;
+
+	case EKawaiiFluidBenchmarkScenario::CharacterWading:
+		Config.TargetParticleCount = 12000;
+		Config.MeasuredFrames = 60;
+		break;
+
+	case EKawaiiFluidBenchmarkScenario::LargeFill:
+		Config.TargetParticleCount = 200000;
+		Config.WarmupFrames = 1;
+		Config.MeasuredFrames = 5;
+		break;
+	}
+
+	return Config;
+}
+
+//========================================
+// FKawaiiFluidBenchmarkResult / Comparison
+//========================================
+
+/**
+ * @brief Format a one-line summary of the result.
+ * @return Summary string.
+ */
+FString FKawaiiFluidBenchmarkResult::ToString() const
+{
+	return FString::Printf(
+		TEXT("%s | Particles: %d | Frame: %.2fms (max %.2fms) | %.2fM particle-substeps/s | DensityErr: %.4f (max %.4f) | Stages: predict %.2f, neighbors %.2f, density %.2f, viscosity %.2f, cohesion %.2f ms"),
+		*ScenarioName,
+		ParticleCount,
+		AverageFrameMs,
+		MaxFrameMs,
+		ParticlesPerSecond / 1.0e6,
+		AverageDensityError,
+		MaxDensityError,
+		AverageStageTimings.PredictMs,
+		AverageStageTimings.NeighborsMs,
+		AverageStageTimings.DensityMs,
+		AverageStageTimings.ViscosityMs,
+		AverageStageTimings.CohesionMs);
+}
+
+/**
+ * @brief Format a one-line summary of the comparison.
+ * @return Summary string.
+ */
+FString FKawaiiFluidBenchmarkComparison::ToString() const
+{
+	if (!bHasBaseline)
+	{
+		return FString::Printf(TEXT("%s | no baseline entry (%.2fms)"), *ScenarioName, CurrentFrameMs);
+	}
+
+	return FString::Printf(
+		TEXT("%s | Frame: %.2fms -> %.2fms (%+.1f%%) | DensityErr: %.4f -> %.4f%s%s"),
+		*ScenarioName,
+		BaselineFrameMs,
+		CurrentFrameMs,
+		FrameTimeChangePercent,
+		BaselineDensityError,
+		CurrentDensityError,
+		bTimeRegressed ? TEXT(" | TIME REGRESSION") : TEXT(""),
+		bDensityRegressed ? TEXT(" | DENSITY REGRESSION") : TEXT(""));
+}
+
+//========================================
+// FKawaiiFluidBenchmarkRunner
+//========================================
+
+/**
+ * @brief Run one scenario on the CPU solver path.
+ * @param Config Scenario configuration.
+ * @return Timings and density statistics of the measured frames.
+ */
+FKawaiiFluidBenchmarkResult FKawaiiFluidBenchmarkRunner::RunScenario(const FKawaiiFluidBenchmarkConfig& Config)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(KawaiiFluidBenchmark_RunScenario);
+
+	FKawaiiFluidBenchmarkResult Result;
+	Result.ScenarioName = GetScenarioName(Config.Scenario);
+	Result.SubstepsPerFrame = FMath::Max(1, Config.SubstepsPerFrame);
+
+	// Transient preset and context (no world, no GPU simulator)
+	TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Preset(NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage()));
+	Preset->ParticleRadius = Config.ParticleRadius;
+	Preset->SolverIterations = FMath::Max(1, Config.SolverIterations);
+	Preset->RecalculateDerivedParameters();
+
+	TStrongObjectPtr<UKawaiiFluidSimulationContext> Context(NewObject<UKawaiiFluidSimulationContext>(GetTransientPackage()));
+	Context->InitializeSolvers(Preset.Get());
+
+	FBenchmarkScene Scene = BuildScene(Config, Preset.Get());
+	TArray<FKawaiiFluidParticle>& Particles = Scene.Particles;
+
+	FKawaiiFluidSimulationParams Params;
+	Params.ParticleRadius = Preset->ParticleRadius;
+	Params.bUseWorldCollision = false;
+
+	TStrongObjectPtr<UKawaiiFluidCapsuleCollider> WadingCapsule;
+	if (Scene.bHasWadingCapsule)
+	{
+		// Owner-less capsule: LocalOffset is its world-space center
+		WadingCapsule.Reset(NewObject<UKawaiiFluidCapsuleCollider>(GetTransientPackage()));
+		WadingCapsule->Radius = Scene.WadeRadius;
+		WadingCapsule->HalfHeight = Scene.WadeHalfHeight;
+		WadingCapsule->LocalOffset = Scene.WadeStart;
+		Params.Colliders.Add(WadingCapsule.Get());
+	}
+
+	FKawaiiFluidSpatialHash SpatialHash(Preset->SmoothingRadius);
+	FFluidTestMetricsHistory History;
+	History.MaxSamples = FMath::Max(1, Config.MeasuredFrames);
+
+	const float SubstepDT = Preset->SubstepDeltaTime;
+	const int32 TotalFrames = FMath::Max(0, Config.WarmupFrames) + FMath::Max(1, Config.MeasuredFrames);
+	const FBox MetricsBounds = Scene.Container.ExpandBy(Preset->ParticleRadius);
+
+	FKawaiiFluidSubstepTimings StageSum;
+	double FrameTimeSumMs = 0.0;
+	double ParticleSubsteps = 0.0;
+	double DensityErrorSum = 0.0;
+	int32 MeasuredFrameCount = 0;
+	float SimulationTime = 0.0f;
+
+	for (int32 Frame = 0; Frame < TotalFrames; ++Frame)
+	{
+		const bool bMeasured = Frame >= Config.WarmupFrames;
+
+		if (Scene.StreamParticlesPerFrame > 0)
+		{
+			EmitStream(Scene, Particles, Preset->ParticleMass, Preset->ParticleSpacing, Config.TargetParticleCount);
+		}
+
+		const uint64 FrameStartCycles = FPlatformTime::Cycles64();
+
+		for (int32 Substep = 0; Substep < Result.SubstepsPerFrame; ++Substep)
+		{
+			if (WadingCapsule.IsValid())
+			{
+				WadingCapsule->LocalOffset = GetWadePosition(Scene, SimulationTime);
+			}
+
+			Context->SimulateSubstep(Particles, Preset.Get(), Params, SpatialHash, SubstepDT);
+			UKawaiiFluidSimulationContext::ApplyBoundsContainment(Particles, Scene.Container, Preset->ParticleRadius, Preset->Bounciness, Preset->Friction);
+			SimulationTime += SubstepDT;
+
+			if (bMeasured)
+			{
+				StageSum += Context->GetLastSubstepTimings();
+				ParticleSubsteps += Particles.Num();
+			}
+		}
+
+		const double FrameMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FrameStartCycles);
+
+		if (!bMeasured)
+		{
+			continue;
+		}
+
+		FrameTimeSumMs += FrameMs;
+		Result.MaxFrameMs = FMath::Max(Result.MaxFrameMs, FrameMs);
+		++MeasuredFrameCount;
+
+		// Metrics are gathered outside the timed region
+		FKawaiiFluidTestMetrics Metrics = FKawaiiFluidMetricsCollector::CollectFromParticles(Particles, Preset->Density, MetricsBounds);
+		Metrics.AverageConstraintError = FKawaiiFluidMetricsCollector::CalculateAverageConstraintError(Particles, Preset->Density);
+		Metrics.MaxConstraintError = FKawaiiFluidMetricsCollector::CalculateMaxConstraintError(Particles, Preset->Density);
+		Metrics.SolverIterations = Preset->SolverIterations;
+		Metrics.SimulationTimeMs = static_cast<float>(FrameMs);
+		Metrics.FrameNumber = Frame;
+		Metrics.SimulationElapsedTime = SimulationTime;
+		History.AddSample(Metrics);
+
+		DensityErrorSum += Metrics.AverageConstraintError;
+		Result.MaxDensityError = FMath::Max(Result.MaxDensityError, Metrics.MaxConstraintError);
+		Result.AverageNeighborCount = Metrics.AverageNeighborCount;
+		Result.ParticlesOutOfBounds = Metrics.ParticlesOutOfBounds;
+		Result.InvalidParticles = Metrics.InvalidParticles;
+	}
+
+	Result.ParticleCount = Particles.Num();
+	Result.MeasuredFrames = MeasuredFrameCount;
+
+	if (MeasuredFrameCount > 0)
+	{
+		Result.AverageFrameMs = FrameTimeSumMs / MeasuredFrameCount;
+		Result.AverageDensityError = static_cast<float>(DensityErrorSum / MeasuredFrameCount);
+		Result.AverageStageTimings = StageSum * (1.0 / (MeasuredFrameCount * Result.SubstepsPerFrame));
+	}
+
+	if (FrameTimeSumMs > 0.0)
+	{
+		Result.ParticlesPerSecond = ParticleSubsteps / (FrameTimeSumMs * 0.001);
+	}
+
+	Result.bReachedEquilibrium = FKawaiiFluidMetricsCollector::IsInEquilibrium(History, 10.0f, 5.0f, FMath::Min(60, History.Samples.Num()));
+
+	KF_LOG(Log, TEXT("Benchmark: %s"), *Result.ToString());
+
+	return Result;
+}
+
+/**
+ * @brief Stable identifier of a scenario, used in reports and baselines.
+ * @param Scenario Scenario.
+ * @return Scenario name.
+ */
+FString FKawaiiFluidBenchmarkRunner::GetScenarioName(EKawaiiFluidBenchmarkScenario Scenario)
+{
+	switch (Scenario)
+	{
+	case EKawaiiFluidBenchmarkScenario::DamBreak:        return TEXT("DamBreak");
+	case EKawaiiFluidBenchmarkScenario::PoolAtRest:      return TEXT("PoolAtRest");
+	case EKawaiiFluidBenchmarkScenario::StreamIntoBox:   return TEXT("StreamIntoBox");
+	case EKawaiiFluidBenchmarkScenario::CharacterWading: return TEXT("CharacterWading");
+	case EKawaiiFluidBenchmarkScenario::LargeFill:       return TEXT("LargeFill");
+	}
+
+	return TEXT("Unknown");
+}
+
+/**
+ * @brief Directory that receives benchmark reports.
+ * @return Saved/KawaiiFluid/Benchmarks.
+ */
+FString FKawaiiFluidBenchmarkRunner::GetReportDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("KawaiiFluid"), TEXT("Benchmarks"));
+}
+
+/**
+ * @brief Baseline file used when none is given on the command line.
+ * @return Saved/KawaiiFluid/Benchmarks/Baseline.csv.
+ */
+FString FKawaiiFluidBenchmarkRunner::GetDefaultBaselinePath()
+{
+	return FPaths::Combine(GetReportDirectory(), TEXT("Baseline.csv"));
+}
+
+/**
+ * @brief Serialize results into a JSON report including machine information.
+ * @param Results Results to serialize.
+ * @return JSON string.
+ */
+FString FKawaiiFluidBenchmarkRunner::ToJson(const TArray<FKawaiiFluidBenchmarkResult>& Results)
+{
+	FString Output = TEXT("{\n");
+	Output += FString::Printf(TEXT("\t\"version\": 1,\n\t\"timestamp\": \"%s\",\n\t\"cpu\": \"%s\",\n\t\"logicalCores\": %d,\n\t\"scenarios\": ["),
+		*FDateTime::UtcNow().ToIso8601(),
+		*FPlatformMisc::GetCPUBrand().TrimStartAndEnd().ReplaceCharWithEscapedChar(),
+		FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+
+	for (int32 i = 0; i < Results.Num(); ++i)
+	{
+		const FKawaiiFluidBenchmarkResult& Result = Results[i];
+		const FKawaiiFluidSubstepTimings& Stages = Result.AverageStageTimings;
+		Output += FString::Printf(
+			TEXT("%s\n\t\t{\n\t\t\t\"scenario\": \"%s\",\n\t\t\t\"particleCount\": %d,\n\t\t\t\"measuredFrames\": %d,\n\t\t\t\"substepsPerFrame\": %d,\n")
+			TEXT("\t\t\t\"averageFrameMs\": %.4f,\n\t\t\t\"maxFrameMs\": %.4f,\n\t\t\t\"particlesPerSecond\": %.0f,\n")
+			TEXT("\t\t\t\"averageDensityError\": %.6f,\n\t\t\t\"maxDensityError\": %.6f,\n\t\t\t\"averageNeighborCount\": %.2f,\n")
+			TEXT("\t\t\t\"particlesOutOfBounds\": %d,\n\t\t\t\"invalidParticles\": %d,\n\t\t\t\"reachedEquilibrium\": %s,\n"),
+			i > 0 ? TEXT(",") : TEXT(""),
+			*Result.ScenarioName.ReplaceCharWithEscapedChar(),
+			Result.ParticleCount,
+			Result.MeasuredFrames,
+			Result.SubstepsPerFrame,
+			Result.AverageFrameMs,
+			Result.MaxFrameMs,
+			Result.ParticlesPerSecond,
+			Result.AverageDensityError,
+			Result.MaxDensityError,
+			Result.AverageNeighborCount,
+			Result.ParticlesOutOfBounds,
+			Result.InvalidParticles,
+			Result.bReachedEquilibrium ? TEXT("true") : TEXT("false"));
+		Output += FString::Printf(
+			TEXT("\t\t\t\"stageMs\": { \"predict\": %.4f, \"neighbors\": %.4f, \"density\": %.4f, \"collision\": %.4f, \"worldCollision\": %.4f, ")
+			TEXT("\"finalize\": %.4f, \"viscosity\": %.4f, \"adhesion\": %.4f, \"cohesion\": %.4f, \"stackPressure\": %.4f, \"total\": %.4f }\n\t\t}"),
+			Stages.PredictMs,
+			Stages.NeighborsMs,
+			Stages.DensityMs,
+			Stages.CollisionMs,
+			Stages.WorldCollisionMs,
+			Stages.FinalizeMs,
+			Stages.ViscosityMs,
+			Stages.AdhesionMs,
+			Stages.CohesionMs,
+			Stages.StackPressureMs,
+			Stages.TotalMs);
+	}
+
+	Output += TEXT("\n\t]\n}\n");
+	return Output;
+}
+
+/**
+ * @brief Serialize results into CSV (one row per scenario).
+ * @param Results Results to serialize.
+ * @return CSV string with header row.
+ */
+FString FKawaiiFluidBenchmarkRunner::ToCsv(const TArray<FKawaiiFluidBenchmarkResult>& Results)
+{
+	FString Output = TEXT("Scenario,ParticleCount,MeasuredFrames,SubstepsPerFrame,AverageFrameMs,MaxFrameMs,ParticlesPerSecond,")
+		TEXT("AverageDensityError,MaxDensityError,AverageNeighborCount,ParticlesOutOfBounds,InvalidParticles,")
+		TEXT("PredictMs,NeighborsMs,DensityMs,CollisionMs,WorldCollisionMs,FinalizeMs,ViscosityMs,AdhesionMs,CohesionMs,StackPressureMs,SubstepTotalMs\n");
+
+	for (const FKawaiiFluidBenchmarkResult& Result : Results)
+	{
+		const FKawaiiFluidSubstepTimings& Stages = Result.AverageStageTimings;
+		Output += FString::Printf(
+			TEXT("%s,%d,%d,%d,%.4f,%.4f,%.0f,%.6f,%.6f,%.2f,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n"),
+			*Result.ScenarioName,
+			Result.ParticleCount,
+			Result.MeasuredFrames,
+			Result.SubstepsPerFrame,
+			Result.AverageFrameMs,
+			Result.MaxFrameMs,
+			Result.ParticlesPerSecond,
+			Result.AverageDensityError,
+			Result.MaxDensityError,
+			Result.AverageNeighborCount,
+			Result.ParticlesOutOfBounds,
+			Result.InvalidParticles,
+			Stages.PredictMs,
+			Stages.NeighborsMs,
+			Stages.DensityMs,
+			Stages.CollisionMs,
+			Stages.WorldCollisionMs,
+			Stages.FinalizeMs,
+			Stages.ViscosityMs,
+			Stages.AdhesionMs,
+			Stages.CohesionMs,
+			Stages.StackPressureMs,
+			Stages.TotalMs);
+	}
+
+	return Output;
+}
+
+/**
+ * @brief Parse a CSV report produced by ToCsv (columns are matched by header name).
+ * @param CsvString Report contents.
+ * @param OutResults Parsed scenario results.
+ * @return True if the report has a valid header.
+ */
+bool FKawaiiFluidBenchmarkRunner::ParseCsv(const FString& CsvString, TArray<FKawaiiFluidBenchmarkResult>& OutResults)
+{
+	OutResults.Reset();
+
+	TArray<FString> Lines;
+	CsvString.ParseIntoArrayLines(Lines);
+	if (Lines.Num() == 0)
+	{
+		return false;
+	}
+
+	TArray<FString> Header;
+	Lines[0].ParseIntoArray(Header, TEXT(","), false);
+	if (Header.Num() == 0 || Header[0] != TEXT("Scenario"))
+	{
+		return false;
+	}
+
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		TArray<FString> Fields;
+		Lines[LineIndex].ParseIntoArray(Fields, TEXT(","), false);
+		if (Fields.Num() != Header.Num() || Fields[0].IsEmpty())
+		{
+			continue;
+		}
+
+		auto Column = [&Header, &Fields](const TCHAR* Name) -> const TCHAR*
+		{
+			const int32 Index = Header.IndexOfByKey(Name);
+			return Index != INDEX_NONE ? *Fields[Index] : nullptr;
+		};
+		auto Read = [&Column](const TCHAR* Name, auto& OutValue)
+		{
+			if (const TCHAR* Value = Column(Name))
+			{
+				OutValue = static_cast<std::remove_reference_t<decltype(OutValue)>>(FCString::Atod(Value));
+			}
+		};
+
+		FKawaiiFluidBenchmarkResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.ScenarioName = Fields[0];
+		Read(TEXT("ParticleCount"), Result.ParticleCount);
+		Read(TEXT("MeasuredFrames"), Result.MeasuredFrames);
+		Read(TEXT("SubstepsPerFrame"), Result.SubstepsPerFrame);
+		Read(TEXT("AverageFrameMs"), Result.AverageFrameMs);
+		Read(TEXT("MaxFrameMs"), Result.MaxFrameMs);
+		Read(TEXT("ParticlesPerSecond"), Result.ParticlesPerSecond);
+		Read(TEXT("AverageDensityError"), Result.AverageDensityError);
+		Read(TEXT("MaxDensityError"), Result.MaxDensityError);
+		Read(TEXT("AverageNeighborCount"), Result.AverageNeighborCount);
+		Read(TEXT("ParticlesOutOfBounds"), Result.ParticlesOutOfBounds);
+		Read(TEXT("InvalidParticles"), Result.InvalidParticles);
+
+		FKawaiiFluidSubstepTimings& Stages = Result.AverageStageTimings;
+		Read(TEXT("PredictMs"), Stages.PredictMs);
+		Read(TEXT("NeighborsMs"), Stages.NeighborsMs);
+		Read(TEXT("DensityMs"), Stages.DensityMs);
+		Read(TEXT("CollisionMs"), Stages.CollisionMs);
+		Read(TEXT("WorldCollisionMs"), Stages.WorldCollisionMs);
+		Read(TEXT("FinalizeMs"), Stages.FinalizeMs);
+		Read(TEXT("ViscosityMs"), Stages.ViscosityMs);
+		Read(TEXT("AdhesionMs"), Stages.AdhesionMs);
+		Read(TEXT("CohesionMs"), Stages.CohesionMs);
+		Read(TEXT("StackPressureMs"), Stages.StackPressureMs);
+		Read(TEXT("SubstepTotalMs"), Stages.TotalMs);
+	}
+
+	return true;
+}
+
+/**
+ * @brief Write <ReportName>.json and <ReportName>.csv into the report directory.
+ * @param Results Results to write.
+ * @param ReportName File name without extension.
+ * @return True if both files were written.
+ */
+bool FKawaiiFluidBenchmarkRunner::WriteReport(const TArray<FKawaiiFluidBenchmarkResult>& Results, const FString& ReportName)
+{
+	const FString BasePath = FPaths::Combine(GetReportDirectory(), ReportName);
+	const bool bJsonWritten = FFileHelper::SaveStringToFile(ToJson(Results), *(BasePath + TEXT(".json")));
+	const bool bCsvWritten = FFileHelper::SaveStringToFile(ToCsv(Results), *(BasePath + TEXT(".csv")));
+
+	if (!bJsonWritten || !bCsvWritten)
+	{
+		KF_LOG(Warning, TEXT("Benchmark: Failed to write report %s"), *BasePath);
+		return false;
+	}
+
+	KF_LOG(Log, TEXT("Benchmark: Report written to %s.json/.csv"), *BasePath);
+	return true;
+}
+
+/**
+ * @brief Load baseline results from disk.
+ * @param BaselinePath Baseline CSV file.
+ * @param OutBaseline Parsed baseline results.
+ * @return True if the file exists and could be parsed.
+ */
+bool FKawaiiFluidBenchmarkRunner::LoadBaseline(const FString& BaselinePath, TArray<FKawaiiFluidBenchmarkResult>& OutBaseline)
+{
+	OutBaseline.Reset();
+
+	FString CsvString;
+	if (!FFileHelper::LoadFileToString(CsvString, *BaselinePath))
+	{
+		return false;
+	}
+
+	return ParseCsv(CsvString, OutBaseline);
+}
+
+/**
+ * @brief Merge results into the baseline file, replacing entries with the same scenario name.
+ * @param BaselinePath Baseline CSV file.
+ * @param Results Results to merge.
+ * @return True if the baseline was written.
+ */
+bool FKawaiiFluidBenchmarkRunner::UpdateBaseline(const FString& BaselinePath, const TArray<FKawaiiFluidBenchmarkResult>& Results)
+{
+	TArray<FKawaiiFluidBenchmarkResult> Baseline;
+	LoadBaseline(BaselinePath, Baseline);
+
+	for (const FKawaiiFluidBenchmarkResult& Result : Results)
+	{
+		const int32 ExistingIndex = Baseline.IndexOfByPredicate([&Result](const FKawaiiFluidBenchmarkResult& Entry)
+		{
+			return Entry.ScenarioName == Result.ScenarioName;
+		});
+
+		if (ExistingIndex != INDEX_NONE)
+		{
+			Baseline[ExistingIndex] = Result;
+		}
+		else
+		{
+			Baseline.Add(Result);
+		}
+	}
+
+	const bool bWritten = FFileHelper::SaveStringToFile(ToCsv(Baseline), *BaselinePath);
+	if (bWritten)
+	{
+		KF_LOG(Log, TEXT("Benchmark: Baseline updated at %s"), *BaselinePath);
+	}
+	return bWritten;
+}
+
+/**
+ * @brief Compare a result with its baseline entry.
+ *
+ * Frame time regresses when it exceeds the baseline by more than TolerancePercent.
+ * Density error regresses when it exceeds the baseline by more than TolerancePercent,
+ * with an absolute floor of 0.005 so near-zero baselines do not flag noise.
+ *
+ * @param Current Result of the current run.
+ * @param Baseline Baseline results.
+ * @param TolerancePercent Allowed relative regression in percent.
+ * @return Comparison for the scenario.
+ */
+FKawaiiFluidBenchmarkComparison FKawaiiFluidBenchmarkRunner::CompareWithBaseline(
+	const FKawaiiFluidBenchmarkResult& Current,
+	const TArray<FKawaiiFluidBenchmarkResult>& Baseline,
+	float TolerancePercent)
+{
+	FKawaiiFluidBenchmarkComparison Comparison;
+	Comparison.ScenarioName = Current.ScenarioName;
+	Comparison.CurrentFrameMs = Current.AverageFrameMs;
+	Comparison.CurrentDensityError = Current.AverageDensityError;
+
+	const FKawaiiFluidBenchmarkResult* Entry = Baseline.FindByPredicate([&Current](const FKawaiiFluidBenchmarkResult& Candidate)
+	{
+		return Candidate.ScenarioName == Current.ScenarioName;
+	});
+
+	if (!Entry)
+	{
+		return Comparison;
+	}
+
+	Comparison.bHasBaseline = true;
+	Comparison.BaselineFrameMs = Entry->AverageFrameMs;
+	Comparison.BaselineDensityError = Entry->AverageDensityError;
+
+	const double Tolerance = FMath::Max(0.0f, TolerancePercent) / 100.0;
+
+	if (Entry->AverageFrameMs > 0.0)
+	{
+		Comparison.FrameTimeChangePercent = (Current.AverageFrameMs / Entry->AverageFrameMs - 1.0) * 100.0;
+		Comparison.bTimeRegressed = Current.AverageFrameMs > Entry->AverageFrameMs * (1.0 + Tolerance);
+	}
+
+	constexpr float DensityErrorFloor = 0.005f;
+	const float AllowedDensityError = FMath::Max(
+		Entry->AverageDensityError * static_cast<float>(1.0 + Tolerance),
+		Entry->AverageDensityError + DensityErrorFloor);
+	Comparison.bDensityRegressed = Current.AverageDensityError > AllowedDensityError;
+
+	return Comparison;
+}
+
+#endif
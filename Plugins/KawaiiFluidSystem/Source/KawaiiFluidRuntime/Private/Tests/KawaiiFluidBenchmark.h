@@ -0,0 +1,191 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidSimulationTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * @brief Canonical scenarios driven by the headless CPU benchmark suite.
+ */
+enum class EKawaiiFluidBenchmarkScenario : uint8
+{
+	DamBreak,
+	PoolAtRest,
+	StreamIntoBox,
+	CharacterWading,
+	LargeFill
+};
+
+/**
+ * @struct FKawaiiFluidBenchmarkConfig
+ * @brief Configuration for a single benchmark scenario run.
+ *
+ * @param Scenario Scenario to run.
+ * @param TargetParticleCount Approximate number of particles in the scenario (final count for streaming scenarios).
+ * @param WarmupFrames Frames simulated before measurement starts.
+ * @param MeasuredFrames Frames included in the timing and density statistics.
+ * @param SubstepsPerFrame CPU substeps per frame (each uses the preset's SubstepDeltaTime).
+ * @param ParticleRadius Particle radius used to derive spacing, smoothing radius and mass (cm).
+ * @param SolverIterations Density solver iterations per substep.
+ * @param RandomSeed Seed for the deterministic placement jitter.
+ */
+struct FKawaiiFluidBenchmarkConfig
+{
+	EKawaiiFluidBenchmarkScenario Scenario = EKawaiiFluidBenchmarkScenario::DamBreak;
+
+	int32 TargetParticleCount = 8000;
+
+	int32 WarmupFrames = 5;
+
+	int32 MeasuredFrames = 60;
+
+	int32 SubstepsPerFrame = 2;
+
+	float ParticleRadius = 5.0f;
+
+	int32 SolverIterations = 3;
+
+	int32 RandomSeed = 1337;
+
+	static FKawaiiFluidBenchmarkConfig MakeDefault(EKawaiiFluidBenchmarkScenario InScenario);
+};
+
+/**
+ * @struct FKawaiiFluidBenchmarkResult
+ * @brief Timing and accuracy results of a single benchmark scenario.
+ *
+ * @param ScenarioName Stable scenario identifier used to match baseline entries.
+ * @param ParticleCount Particle count at the end of the run.
+ * @param MeasuredFrames Number of measured frames.
+ * @param SubstepsPerFrame CPU substeps per frame.
+ * @param AverageStageTimings Per-stage timings averaged over all measured substeps (ms).
+ * @param AverageFrameMs Mean wall-clock time per frame (ms).
+ * @param MaxFrameMs Slowest measured frame (ms).
+ * @param ParticlesPerSecond Particle-substeps processed per second of wall-clock time.
+ * @param AverageDensityError Mean absolute relative density error over the measured frames.
+ * @param MaxDensityError Peak absolute relative density error over the measured frames.
+ * @param AverageNeighborCount Mean neighbor count in the final frame.
+ * @param ParticlesOutOfBounds Particles outside the container at the end of the run.
+ * @param InvalidParticles Particles with NaN or infinite state at the end of the run.
+ * @param bReachedEquilibrium Whether the metrics history settled (only meaningful for resting scenarios).
+ */
+struct FKawaiiFluidBenchmarkResult
+{
+	FString ScenarioName;
+
+	int32 ParticleCount = 0;
+
+	int32 MeasuredFrames = 0;
+
+	int32 SubstepsPerFrame = 0;
+
+	FKawaiiFluidSubstepTimings AverageStageTimings;
+
+	double AverageFrameMs = 0.0;
+
+	double MaxFrameMs = 0.0;
+
+	double ParticlesPerSecond = 0.0;
+
+	float AverageDensityError = 0.0f;
+
+	float MaxDensityError = 0.0f;
+
+	float AverageNeighborCount = 0.0f;
+
+	int32 ParticlesOutOfBounds = 0;
+
+	int32 InvalidParticles = 0;
+
+	bool bReachedEquilibrium = false;
+
+	FString ToString() const;
+};
+
+/**
+ * @struct FKawaiiFluidBenchmarkComparison
+ * @brief Result of comparing a benchmark run against its baseline entry.
+ *
+ * @param ScenarioName Scenario being compared.
+ * @param bHasBaseline Whether a baseline entry existed for this scenario.
+ * @param BaselineFrameMs Baseline mean frame time (ms).
+ * @param CurrentFrameMs Current mean frame time (ms).
+ * @param FrameTimeChangePercent Relative frame time change (positive = slower).
+ * @param BaselineDensityError Baseline mean density error.
+ * @param CurrentDensityError Current mean density error.
+ * @param bTimeRegressed Frame time exceeded the baseline by more than the tolerance.
+ * @param bDensityRegressed Density error exceeded the baseline by more than the tolerance.
+ */
+struct FKawaiiFluidBenchmarkComparison
+{
+	FString ScenarioName;
+
+	bool bHasBaseline = false;
+
+	double BaselineFrameMs = 0.0;
+
+	double CurrentFrameMs = 0.0;
+
+	double FrameTimeChangePercent = 0.0;
+
+	float BaselineDensityError = 0.0f;
+
+	float CurrentDensityError = 0.0f;
+
+	bool bTimeRegressed = false;
+
+	bool bDensityRegressed = false;
+
+	bool IsRegression() const { return bTimeRegressed || bDensityRegressed; }
+
+	FString ToString() const;
+};
+
+/**
+ * @class FKawaiiFluidBenchmarkRunner
+ * @brief Runs canonical fluid scenarios on the CPU solver path and produces JSON/CSV reports.
+ *
+ * Scenarios drive UKawaiiFluidSimulationContext::SimulateSubstep directly with a transient preset,
+ * so they do not need a world, a renderer or the GPU simulator and run under -nullrhi.
+ * Development-only: compiled with the automation tests and kept out of shipping builds. The JSON
+ * report is written by hand and the baseline is the CSV report, so the runtime needs no Json module.
+ *
+ * Command line options (read by the automation tests):
+ * -KawaiiFluidBenchmarkBaseline=<path>   Baseline CSV to compare against (default: Saved/KawaiiFluid/Benchmarks/Baseline.csv)
+ * -KawaiiFluidBenchmarkTolerance=<pct>   Allowed frame time / density error regression in percent (default: 15)
+ * -KawaiiFluidBenchmarkUpdateBaseline    Merge the current results into the baseline file instead of comparing
+ * -KawaiiFluidBenchmarkFrames=<n>        Override the number of measured frames for every scenario
+ */
+class FKawaiiFluidBenchmarkRunner
+{
+public:
+	static FKawaiiFluidBenchmarkResult RunScenario(const FKawaiiFluidBenchmarkConfig& Config);
+
+	static FString GetScenarioName(EKawaiiFluidBenchmarkScenario Scenario);
+
+	static FString GetReportDirectory();
+
+	static FString GetDefaultBaselinePath();
+
+	static FString ToJson(const TArray<FKawaiiFluidBenchmarkResult>& Results);
+
+	static FString ToCsv(const TArray<FKawaiiFluidBenchmarkResult>& Results);
+
+	static bool ParseCsv(const FString& CsvString, TArray<FKawaiiFluidBenchmarkResult>& OutResults);
+
+	static bool WriteReport(const TArray<FKawaiiFluidBenchmarkResult>& Results, const FString& ReportName);
+
+	static bool LoadBaseline(const FString& BaselinePath, TArray<FKawaiiFluidBenchmarkResult>& OutBaseline);
+
+	static bool UpdateBaseline(const FString& BaselinePath, const TArray<FKawaiiFluidBenchmarkResult>& Results);
+
+	static FKawaiiFluidBenchmarkComparison CompareWithBaseline(
+		const FKawaiiFluidBenchmarkResult& Current,
+		const TArray<FKawaiiFluidBenchmarkResult>& Baseline,
+		float TolerancePercent);
+};
+
+#endif
@@ -0,0 +1,205 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Tests/KawaiiFluidBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//========================================
+// Headless CPU benchmark suite
+// Run with: UnrealEditor-Cmd <Project> -nullrhi -unattended
+//           -ExecCmds="Automation RunTests KawaiiFluid.Performance.Benchmark; Quit"
+//========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmarkTest_DamBreak,
+	"KawaiiFluid.Performance.Benchmark.B01_DamBreak",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmarkTest_PoolAtRest,
+	"KawaiiFluid.Performance.Benchmark.B02_PoolAtRest",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmarkTest_StreamIntoBox,
+	"KawaiiFluid.Performance.Benchmark.B03_StreamIntoBox",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmarkTest_CharacterWading,
+	"KawaiiFluid.Performance.Benchmark.B04_CharacterWading",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmarkTest_LargeFill,
+	"KawaiiFluid.Performance.Benchmark.B05_LargeFill",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBenchmarkTest_ReportRoundTrip,
+	"KawaiiFluid.Performance.Benchmark.B06_ReportRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Run a scenario, write its report and compare it with the baseline.
+	 * @param Test Owning automation test.
+	 * @param Scenario Scenario to run.
+	 * @return True if the run was stable and did not regress.
+	 */
+	bool RunBenchmarkScenario(FAutomationTestBase& Test, EKawaiiFluidBenchmarkScenario Scenario)
+	{
+		FKawaiiFluidBenchmarkConfig Config = FKawaiiFluidBenchmarkConfig::MakeDefault(Scenario);
+
+		int32 FramesOverride = 0;
+		if (FParse::Value(FCommandLine::Get(), TEXT("KawaiiFluidBenchmarkFrames="), FramesOverride) && FramesOverride > 0)
+		{
+			Config.MeasuredFrames = FramesOverride;
+		}
+
+		const FKawaiiFluidBenchmarkResult Result = FKawaiiFluidBenchmarkRunner::RunScenario(Config);
+		Test.AddInfo(Result.ToString());
+
+		const TArray<FKawaiiFluidBenchmarkResult> Results = { Result };
+		FKawaiiFluidBenchmarkRunner::WriteReport(Results, FString::Printf(TEXT("Benchmark_%s"), *Result.ScenarioName));
+
+		Test.TestEqual(TEXT("No invalid (NaN/Inf) particles"), Result.InvalidParticles, 0);
+		Test.TestEqual(TEXT("No particles escaped the container"), Result.ParticlesOutOfBounds, 0);
+		Test.TestTrue(TEXT("Measured frames ran"), Result.MeasuredFrames > 0 && Result.AverageFrameMs > 0.0);
+
+		FString BaselinePath = FKawaiiFluidBenchmarkRunner::GetDefaultBaselinePath();
+		FParse::Value(FCommandLine::Get(), TEXT("KawaiiFluidBenchmarkBaseline="), BaselinePath);
+
+		if (FParse::Param(FCommandLine::Get(), TEXT("KawaiiFluidBenchmarkUpdateBaseline")))
+		{
+			FKawaiiFluidBenchmarkRunner::UpdateBaseline(BaselinePath, Results);
+			return !Test.HasAnyErrors();
+		}
+
+		TArray<FKawaiiFluidBenchmarkResult> Baseline;
+		if (!FKawaiiFluidBenchmarkRunner::LoadBaseline(BaselinePath, Baseline))
+		{
+			Test.AddInfo(FString::Printf(TEXT("No baseline at %s (run with -KawaiiFluidBenchmarkUpdateBaseline to create one)"), *BaselinePath));
+			return !Test.HasAnyErrors();
+		}
+
+		float TolerancePercent = 15.0f;
+		FParse::Value(FCommandLine::Get(), TEXT("KawaiiFluidBenchmarkTolerance="), TolerancePercent);
+
+		const FKawaiiFluidBenchmarkComparison Comparison = FKawaiiFluidBenchmarkRunner::CompareWithBaseline(Result, Baseline, TolerancePercent);
+		Test.AddInfo(Comparison.ToString());
+
+		Test.TestFalse(TEXT("Frame time within baseline tolerance"), Comparison.bTimeRegressed);
+		Test.TestFalse(TEXT("Density error within baseline tolerance"), Comparison.bDensityRegressed);
+
+		return !Test.HasAnyErrors();
+	}
+}
+
+/**
+ * @brief Dam break: a 1x1x2 column collapsing into a long tank.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidBenchmarkTest_DamBreak::RunTest(const FString& Parameters)
+{
+	return RunBenchmarkScenario(*this, EKawaiiFluidBenchmarkScenario::DamBreak);
+}
+
+/**
+ * @brief Pool at rest: a settled pool, exercising the steady-state solver cost.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidBenchmarkTest_PoolAtRest::RunTest(const FString& Parameters)
+{
+	return RunBenchmarkScenario(*this, EKawaiiFluidBenchmarkScenario::PoolAtRest);
+}
+
+/**
+ * @brief Stream into box: a nozzle filling an empty box, particle count grows every frame.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidBenchmarkTest_StreamIntoBox::RunTest(const FString& Parameters)
+{
+	return RunBenchmarkScenario(*this, EKawaiiFluidBenchmarkScenario::StreamIntoBox);
+}
+
+/**
+ * @brief Character wading: a capsule collider walking back and forth through a pool.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidBenchmarkTest_CharacterWading::RunTest(const FString& Parameters)
+{
+	return RunBenchmarkScenario(*this, EKawaiiFluidBenchmarkScenario::CharacterWading);
+}
+
+/**
+ * @brief Large fill: 200k particles dropped into a box.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidBenchmarkTest_LargeFill::RunTest(const FString& Parameters)
+{
+	return RunBenchmarkScenario(*this, EKawaiiFluidBenchmarkScenario::LargeFill);
+}
+
+/**
+ * @brief Report serialization and baseline comparison logic (no simulation).
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidBenchmarkTest_ReportRoundTrip::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidBenchmarkResult Baseline;
+	Baseline.ScenarioName = TEXT("DamBreak");
+	Baseline.ParticleCount = 8000;
+	Baseline.MeasuredFrames = 60;
+	Baseline.SubstepsPerFrame = 2;
+	Baseline.AverageFrameMs = 10.0;
+	Baseline.AverageDensityError = 0.02f;
+	Baseline.AverageStageTimings.DensityMs = 2.5;
+
+	TArray<FKawaiiFluidBenchmarkResult> Parsed;
+	TestTrue(TEXT("CSV baseline parses"), FKawaiiFluidBenchmarkRunner::ParseCsv(FKawaiiFluidBenchmarkRunner::ToCsv({ Baseline }), Parsed));
+	TestEqual(TEXT("One scenario parsed"), Parsed.Num(), 1);
+	if (Parsed.Num() == 1)
+	{
+		TestEqual(TEXT("Scenario name round-trips"), Parsed[0].ScenarioName, Baseline.ScenarioName);
+		TestEqual(TEXT("Particle count round-trips"), Parsed[0].ParticleCount, Baseline.ParticleCount);
+		TestEqual(TEXT("Frame time round-trips"), Parsed[0].AverageFrameMs, Baseline.AverageFrameMs, 1e-6);
+		TestEqual(TEXT("Stage timing round-trips"), Parsed[0].AverageStageTimings.DensityMs, Baseline.AverageStageTimings.DensityMs, 1e-6);
+	}
+
+	const FString Csv = FKawaiiFluidBenchmarkRunner::ToCsv({ Baseline });
+	TArray<FString> CsvLines;
+	Csv.ParseIntoArrayLines(CsvLines);
+	TestEqual(TEXT("CSV has header + one row"), CsvLines.Num(), 2);
+
+	const FString Json = FKawaiiFluidBenchmarkRunner::ToJson({ Baseline });
+	TestTrue(TEXT("JSON report names the scenario"), Json.Contains(TEXT("\"scenario\": \"DamBreak\"")));
+	TestTrue(TEXT("JSON report is one object"), Json.StartsWith(TEXT("{")) && Json.TrimEnd().EndsWith(TEXT("}")));
+
+	FKawaiiFluidBenchmarkResult Current = Baseline;
+	Current.AverageFrameMs = 11.0;
+	TestFalse(TEXT("+10% frame time is within 15% tolerance"),
+		FKawaiiFluidBenchmarkRunner::CompareWithBaseline(Current, Parsed, 15.0f).IsRegression());
+
+	Current.AverageFrameMs = 12.0;
+	TestTrue(TEXT("+20% frame time is a regression"),
+		FKawaiiFluidBenchmarkRunner::CompareWithBaseline(Current, Parsed, 15.0f).bTimeRegressed);
+
+	Current.AverageFrameMs = 10.0;
+	Current.AverageDensityError = 0.05f;
+	TestTrue(TEXT("Density error increase is a regression"),
+		FKawaiiFluidBenchmarkRunner::CompareWithBaseline(Current, Parsed, 15.0f).bDensityRegressed);
+
+	Current.ScenarioName = TEXT("Unknown");
+	TestFalse(TEXT("Missing baseline entry is reported, not failed"),
+		FKawaiiFluidBenchmarkRunner::CompareWithBaseline(Current, Parsed, 15.0f).bHasBaseline);
+
+	return true;
+}
+
+#endif
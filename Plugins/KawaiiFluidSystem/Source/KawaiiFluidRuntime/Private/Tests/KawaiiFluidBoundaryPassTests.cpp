@@ -0,0 +1,214 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Core/KawaiiFluidParticle.h"
+#include "Simulation/Utils/KawaiiFluidBoundaryPass.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBoundaryPassTest_MatchesSerial,
+	"KawaiiFluid.Simulation.BoundaryPass.T01_MatchesSerial",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+//========================================
+// Micro-benchmark (fused parallel pass vs serial resolve + serial bounds)
+// Run with: -ExecCmds="Automation RunTests KawaiiFluid.Performance.Micro.BoundaryPass; Quit"
+//========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidBoundaryPassTest_MicroBenchmark,
+	"KawaiiFluid.Performance.Micro.BoundaryPass",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Scatter particles through a box larger than the container, with random velocities.
+	 * @param Count Number of particles.
+	 * @param Seed Random seed.
+	 * @param OutParticles Output particles (Position == PredictedPosition).
+	 */
+	void MakeScatteredParticles(int32 Count, int32 Seed, TArray<FKawaiiFluidParticle>& OutParticles)
+	{
+		FRandomStream Random(Seed);
+		OutParticles.SetNum(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FKawaiiFluidParticle& P = OutParticles[i];
+			P.Position = FVector(Random.FRandRange(-150.0f, 150.0f), Random.FRandRange(-150.0f, 150.0f), Random.FRandRange(-150.0f, 150.0f));
+			P.PredictedPosition = P.Position;
+			P.Velocity = FVector(Random.FRandRange(-300.0f, 300.0f), Random.FRandRange(-300.0f, 300.0f), Random.FRandRange(-300.0f, 300.0f));
+		}
+	}
+
+	/**
+	 * @brief Helper: Serial reference (the original per-particle OBB loop followed by a separate bounds walk).
+	 * @param Particles Particles to resolve.
+	 * @param Box Containment box.
+	 * @return Particle AABB.
+	 */
+	FBox ResolveSerialReference(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidBoundaryBox& Box)
+	{
+		const FQuat InverseRotation = Box.Rotation.Inverse();
+		const float TangentScale = 1.0f - Box.Friction;
+
+		for (FKawaiiFluidParticle& P : Particles)
+		{
+			FVector LocalPos = InverseRotation.RotateVector(P.PredictedPosition - Box.Center);
+			FVector LocalVel = InverseRotation.RotateVector(P.Velocity);
+			bool bCollided = false;
+
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const int32 AxisA = (Axis + 1) % 3;
+				const int32 AxisB = (Axis + 2) % 3;
+				if (LocalPos[Axis] < -Box.HalfExtent[Axis] || LocalPos[Axis] > Box.HalfExtent[Axis])
+				{
+					const double Sign = LocalPos[Axis] < 0.0 ? -1.0 : 1.0;
+					LocalPos[Axis] = Sign * Box.HalfExtent[Axis];
+					if (LocalVel[Axis] * Sign > 0.0)
+					{
+						LocalVel[Axis] = -LocalVel[Axis] * Box.Bounce;
+					}
+					LocalVel[AxisA] *= TangentScale;
+					LocalVel[AxisB] *= TangentScale;
+					bCollided = true;
+				}
+			}
+
+			if (bCollided)
+			{
+				P.PredictedPosition = Box.Center + Box.Rotation.RotateVector(LocalPos);
+				P.Position = P.PredictedPosition;
+				P.Velocity = Box.Rotation.RotateVector(LocalVel);
+			}
+		}
+
+		FBox Bounds(ForceInit);
+		for (const FKawaiiFluidParticle& P : Particles)
+		{
+			Bounds += P.Position;
+		}
+		return Bounds;
+	}
+
+	/**
+	 * @brief Helper: Test container, optionally rotated.
+	 * @param bRotated Use a rotated OBB.
+	 * @return Boundary box.
+	 */
+	FKawaiiFluidBoundaryBox MakeTestBox(bool bRotated)
+	{
+		FKawaiiFluidBoundaryBox Box;
+		Box.Center = FVector(10.0, -5.0, 20.0);
+		Box.HalfExtent = FVector(100.0, 80.0, 60.0);
+		Box.Rotation = bRotated ? FQuat(FRotator(15.0, 30.0, -10.0)) : FQuat::Identity;
+		Box.Bounce = 0.3f;
+		Box.Friction = 0.2f;
+		return Box;
+	}
+}
+
+/**
+ * @brief The fused parallel pass matches the serial loop for rotated and axis-aligned boxes.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidBoundaryPassTest_MatchesSerial::RunTest(const FString& Parameters)
+{
+	for (const bool bRotated : { false, true })
+	{
+		const FKawaiiFluidBoundaryBox Box = MakeTestBox(bRotated);
+
+		// Spans several chunks so the per-chunk reduction is exercised
+		TArray<FKawaiiFluidParticle> Fused;
+		MakeScatteredParticles(FKawaiiFluidBoundaryPass::ChunkSize * 3 + 123, 42, Fused);
+		TArray<FKawaiiFluidParticle> Reference = Fused;
+
+		const FBox FusedBounds = FKawaiiFluidBoundaryPass::ResolveAndComputeBounds(Fused, Box);
+		const FBox ReferenceBounds = ResolveSerialReference(Reference, Box);
+
+		bool bSame = true;
+		bool bInside = true;
+		for (int32 i = 0; i < Fused.Num(); ++i)
+		{
+			bSame &= Fused[i].Position.Equals(Reference[i].Position, 1e-4) && Fused[i].Velocity.Equals(Reference[i].Velocity, 1e-4);
+
+			const FVector Local = Box.Rotation.UnrotateVector(Fused[i].Position - Box.Center);
+			bInside &= FMath::Abs(Local.X) <= Box.HalfExtent.X + 1e-3 && FMath::Abs(Local.Y) <= Box.HalfExtent.Y + 1e-3 && FMath::Abs(Local.Z) <= Box.HalfExtent.Z + 1e-3;
+		}
+
+		const TCHAR* Label = bRotated ? TEXT("rotated") : TEXT("axis-aligned");
+		TestTrue(FString::Printf(TEXT("Positions and velocities match serial (%s)"), Label), bSame);
+		TestTrue(FString::Printf(TEXT("Particles inside the box (%s)"), Label), bInside);
+		TestTrue(FString::Printf(TEXT("Reduced bounds match serial (%s)"), Label),
+			FusedBounds.Min.Equals(ReferenceBounds.Min, 1e-4) && FusedBounds.Max.Equals(ReferenceBounds.Max, 1e-4));
+		TestTrue(FString::Printf(TEXT("Bounds-only reduction agrees (%s)"), Label),
+			FKawaiiFluidBoundaryPass::ComputeBounds(Fused).Equals(FusedBounds, 1e-6));
+	}
+
+	// Resolve-only overload applies the same response
+	TArray<FKawaiiFluidParticle> ResolveOnly;
+	MakeScatteredParticles(1000, 7, ResolveOnly);
+	TArray<FKawaiiFluidParticle> Reference = ResolveOnly;
+	FKawaiiFluidBoundaryPass::Resolve(ResolveOnly, MakeTestBox(true));
+	ResolveSerialReference(Reference, MakeTestBox(true));
+	bool bResolveSame = true;
+	for (int32 i = 0; i < ResolveOnly.Num(); ++i)
+	{
+		bResolveSame &= ResolveOnly[i].Position.Equals(Reference[i].Position, 1e-4);
+	}
+	TestTrue(TEXT("Resolve matches the fused pass"), bResolveSame);
+
+	TArray<FKawaiiFluidParticle> Empty;
+	TestFalse(TEXT("Empty input yields invalid bounds"), FKawaiiFluidBoundaryPass::ResolveAndComputeBounds(Empty, MakeTestBox(false)).IsValid != 0);
+
+	return true;
+}
+
+/**
+ * @brief Time the fused parallel pass against serial resolve + serial bounds at 10k, 100k and 1M particles.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidBoundaryPassTest_MicroBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumIterations = 20;
+	const FKawaiiFluidBoundaryBox Box = MakeTestBox(true);
+
+	for (const int32 Count : { 10000, 100000, 1000000 })
+	{
+		TArray<FKawaiiFluidParticle> Source;
+		MakeScatteredParticles(Count, 1234, Source);
+
+		double SerialMs = 0.0;
+		double FusedMs = 0.0;
+		TArray<FKawaiiFluidParticle> Working;
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Working = Source;
+			uint64 StartCycles = FPlatformTime::Cycles64();
+			ResolveSerialReference(Working, Box);
+			SerialMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+			Working = Source;
+			StartCycles = FPlatformTime::Cycles64();
+			const FBox Bounds = FKawaiiFluidBoundaryPass::ResolveAndComputeBounds(Working, Box);
+			FusedMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+			TestTrue(TEXT("Fused pass produced valid bounds"), Bounds.IsValid != 0);
+		}
+
+		SerialMs /= NumIterations;
+		FusedMs /= NumIterations;
+		AddInfo(FString::Printf(TEXT("BoundaryPass %7d particles: serial %.3f ms, fused parallel %.3f ms (x%.2f)"),
+			Count, SerialMs, FusedMs, FusedMs > 0.0 ? SerialMs / FusedMs : 0.0));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,106 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Rendering/KawaiiFluidDebugPointBatcher.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidDebugPointTest_BudgetAndLUT,
+	"KawaiiFluid.Rendering.DebugPoints.T01_BudgetAndLUT",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidDebugPointTest_Decimation,
+	"KawaiiFluid.Rendering.DebugPoints.T02_ScreenSpaceDecimation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * @brief Every mode has a 256-entry LUT, the point budget caps the buffer, and versioned builds are reused.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidDebugPointTest_BudgetAndLUT::RunTest(const FString& Parameters)
+{
+	for (int32 ModeIndex = 0; ModeIndex <= static_cast<int32>(EKawaiiFluidDebugDrawMode::DebugDraw); ++ModeIndex)
+	{
+		TestEqual(TEXT("LUT has 256 entries"), FKawaiiFluidDebugPointBatcher::GetColorLUT(static_cast<EKawaiiFluidDebugDrawMode>(ModeIndex)).Num(), 256);
+	}
+
+	TArray<FVector3f> Positions;
+	for (int32 i = 0; i < 20000; ++i)
+	{
+		Positions.Add(FVector3f(static_cast<float>(i % 100) * 10.0f, static_cast<float>(i / 100) * 10.0f, 0.0f));
+	}
+
+	FKawaiiFluidDebugPointSource Source;
+	Source.Positions = Positions;
+
+	FKawaiiFluidDebugPointSettings Settings;
+	Settings.Mode = EKawaiiFluidDebugDrawMode::Point_PositionX;
+	Settings.MaxPoints = 0;
+
+	FKawaiiFluidDebugPointBatcher Batcher;
+	Batcher.Build(Source, Settings, nullptr, 1);
+	TestEqual(TEXT("Unlimited budget keeps every point"), Batcher.GetNumPoints(), Positions.Num());
+	TestEqual(TEXT("Colors parallel to points"), Batcher.GetColors().Num(), Batcher.GetNumPoints());
+	TestTrue(TEXT("Same version and settings is up to date"), Batcher.IsUpToDate(Settings, nullptr, 1));
+	TestFalse(TEXT("New source version forces a rebuild"), Batcher.IsUpToDate(Settings, nullptr, 2));
+	TestFalse(TEXT("Unversioned source is never up to date"), Batcher.IsUpToDate(Settings, nullptr, 0));
+
+	Settings.MaxPoints = 5000;
+	TestFalse(TEXT("Budget change forces a rebuild"), Batcher.IsUpToDate(Settings, nullptr, 1));
+	Batcher.Build(Source, Settings, nullptr, 1);
+	TestEqual(TEXT("Budget caps the point count"), Batcher.GetNumPoints(), Settings.MaxPoints);
+
+	// Strided subset still spans the whole X range
+	FBox PointBounds(Batcher.GetPoints());
+	TestTrue(TEXT("Budgeted subset is spatially unbiased"), PointBounds.GetSize().X > 900.0);
+
+	return true;
+}
+
+/**
+ * @brief Particles along one view ray collapse to the nearest one; well-separated particles survive.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidDebugPointTest_Decimation::RunTest(const FString& Parameters)
+{
+	// 100 particles stacked along +X, plus 4 particles in clearly different directions
+	TArray<FVector3f> Positions;
+	for (int32 i = 0; i < 100; ++i)
+	{
+		Positions.Add(FVector3f(100.0f + static_cast<float>(99 - i) * 10.0f, 0.0f, 0.0f));
+	}
+	Positions.Add(FVector3f(0.0f, 500.0f, 0.0f));
+	Positions.Add(FVector3f(0.0f, -500.0f, 0.0f));
+	Positions.Add(FVector3f(0.0f, 0.0f, 500.0f));
+	Positions.Add(FVector3f(0.0f, 0.0f, -500.0f));
+
+	FKawaiiFluidDebugPointSource Source;
+	Source.Positions = Positions;
+
+	FKawaiiFluidDebugPointSettings Settings;
+	Settings.DecimationPixels = 2.0f;
+	Settings.PixelAngle = FMath::DegreesToRadians(90.0f) / 1920.0f;
+
+	const FVector ViewLocation = FVector::ZeroVector;
+	FKawaiiFluidDebugPointBatcher Batcher;
+	Batcher.Build(Source, Settings, &ViewLocation, 1);
+
+	TestEqual(TEXT("Ray-aligned particles collapse into one point"), Batcher.GetNumPoints(), 5);
+	TestTrue(TEXT("Nearest particle on the ray is kept"), Batcher.GetPoints().Contains(FVector(100.0, 0.0, 0.0)));
+
+	// Turning in place does not invalidate the build; moving does
+	TestTrue(TEXT("Same view is up to date"), Batcher.IsUpToDate(Settings, &ViewLocation, 1));
+	const FVector MovedView(1000.0, 0.0, 0.0);
+	TestFalse(TEXT("Moved view forces a rebuild"), Batcher.IsUpToDate(Settings, &MovedView, 1));
+
+	Settings.DecimationPixels = 0.0f;
+	Batcher.Build(Source, Settings, &ViewLocation, 1);
+	TestEqual(TEXT("Disabled decimation keeps every point"), Batcher.GetNumPoints(), Positions.Num());
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,397 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+#include "Simulation/Physics/KawaiiFluidGPUReferenceSolver.h"
+#include "Simulation/Shaders/KawaiiFluidSimulatorShaders.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidGPUReferenceTest_MortonKeys,
+	"KawaiiFluid.Simulation.GPUReference.T01_MortonKeys",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidGPUReferenceTest_CellRanges,
+	"KawaiiFluid.Simulation.GPUReference.T02_CellRanges",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidGPUReferenceTest_DensityMatchesBruteForce,
+	"KawaiiFluid.Simulation.GPUReference.T03_DensityMatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidGPUReferenceTest_Collisions,
+	"KawaiiFluid.Simulation.GPUReference.T04_Collisions",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidGPUReferenceTest_DamBreakRegression,
+	"KawaiiFluid.Simulation.GPUReference.T05_DamBreakRegression",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float Spacing = 10.0f;
+	constexpr float BoundsHalfExtent = 100.0f;
+
+	/**
+	 * @brief Helper: Parameters of a 1 kg / 10 cm particle fluid in a 2 m box.
+	 * @param SolverIterations Density solver iterations.
+	 * @return Parameters with kernel coefficients precomputed.
+	 */
+	FGPUFluidSimulationParams MakeParams(int32 SolverIterations)
+	{
+		FGPUFluidSimulationParams Params;
+		Params.SmoothingRadius = 20.0f;
+		Params.CellSize = 20.0f;
+		Params.ParticleRadius = 5.0f;
+		Params.ParticleMass = 1.0f;
+		Params.DeltaTime = 1.0f / 120.0f;
+		Params.SolverIterations = SolverIterations;
+		Params.BoundsMin = FVector3f(-BoundsHalfExtent);
+		Params.BoundsMax = FVector3f(BoundsHalfExtent);
+		Params.BoundsExtent = FVector3f(BoundsHalfExtent);
+		Params.PrecomputeKernelCoefficients();
+		return Params;
+	}
+
+	/**
+	 * @brief Helper: Jittered block of particles at rest.
+	 * @param Side Particles per axis.
+	 * @param Origin Minimum corner (cm).
+	 * @param Seed Jitter seed.
+	 * @return Particles with PredictedPosition = Position.
+	 */
+	TArray<FGPUFluidParticle> MakeBlock(int32 Side, const FVector3f& Origin, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FGPUFluidParticle> Particles;
+		Particles.Reserve(Side * Side * Side);
+
+		for (int32 Z = 0; Z < Side; ++Z)
+		{
+			for (int32 Y = 0; Y < Side; ++Y)
+			{
+				for (int32 X = 0; X < Side; ++X)
+				{
+					FGPUFluidParticle& Particle = Particles.AddDefaulted_GetRef();
+					const FVector3f Jitter(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f));
+					Particle.Position = Origin + FVector3f(X, Y, Z) * Spacing + Jitter;
+					Particle.PredictedPosition = Particle.Position;
+					Particle.ParticleID = Particles.Num() - 1;
+					Particle.SourceID = 0;
+				}
+			}
+		}
+		return Particles;
+	}
+}
+
+/**
+ * @brief Classic keys are bounded Morton codes of the cell offset; hybrid keys put the tile hash above the local Morton code.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidGPUReferenceTest_MortonKeys::RunTest(const FString& Parameters)
+{
+	constexpr float CellSize = 20.0f;
+
+	// Classic Medium: 7 bits per axis, grid origin at cell -64
+	FKawaiiFluidGPUReferenceConfig Classic;
+	Classic.bUseHybridTiledZOrder = false;
+	Classic.GridResolutionPreset = EGridResolutionPreset::Medium;
+	const FKawaiiFluidGPUReferenceSolver ClassicSolver(Classic);
+
+	auto CellCenter = [CellSize](int32 X, int32 Y, int32 Z)
+	{
+		return FVector3f(-1280.0f) + (FVector3f(X, Y, Z) + FVector3f(0.5f)) * CellSize;
+	};
+
+	TestEqual(TEXT("Classic axis bits"), ClassicSolver.GetAxisBits(), 7);
+	TestEqual(TEXT("Classic origin"), ClassicSolver.ComputeSortKey(CellCenter(0, 0, 0), CellSize), 0u);
+	TestEqual(TEXT("Classic +X"), ClassicSolver.ComputeSortKey(CellCenter(1, 0, 0), CellSize), 1u);
+	TestEqual(TEXT("Classic +Y"), ClassicSolver.ComputeSortKey(CellCenter(0, 1, 0), CellSize), 2u);
+	TestEqual(TEXT("Classic +Z"), ClassicSolver.ComputeSortKey(CellCenter(0, 0, 1), CellSize), 4u);
+	TestEqual(TEXT("Classic (1,1,1)"), ClassicSolver.ComputeSortKey(CellCenter(1, 1, 1), CellSize), 7u);
+	TestEqual(TEXT("Classic (2,0,0)"), ClassicSolver.ComputeSortKey(CellCenter(2, 0, 0), CellSize), 8u);
+	TestEqual(TEXT("Classic offset clamps to the last cell"), ClassicSolver.ComputeSortKey(CellCenter(200, 0, 0), CellSize), 0x49249u);
+	TestEqual(TEXT("Classic offset clamps below the origin"), ClassicSolver.ComputeSortKey(CellCenter(-5, 0, 0), CellSize), 0u);
+
+	// Hybrid: Medium cell table regardless of the preset
+	FKawaiiFluidGPUReferenceConfig Hybrid;
+	Hybrid.bUseHybridTiledZOrder = true;
+	Hybrid.GridResolutionPreset = EGridResolutionPreset::Large;
+	const FKawaiiFluidGPUReferenceSolver HybridSolver(Hybrid);
+
+	TestEqual(TEXT("Hybrid forces Medium"), HybridSolver.GetMaxCells(), 1u << 21);
+	TestEqual(TEXT("Hybrid origin cell"), HybridSolver.ComputeSortKey(FVector3f(10.0f), CellSize), 0u);
+
+	// Cell -1: local 63 (0x9249 after bit expansion), tile -1 hashes to (-73856093) & 7 = 3
+	TestEqual(TEXT("Hybrid negative cell"), HybridSolver.ComputeSortKey(FVector3f(-10.0f, 10.0f, 10.0f), CellSize), (3u << 18) | 0x9249u);
+	TestEqual(TEXT("Hybrid cell ID is the key"), HybridSolver.GetCellID(FIntVector(-1, 0, 0), CellSize), (3u << 18) | 0x9249u);
+
+	return true;
+}
+
+/**
+ * @brief The sort is stable by key and CellStart/CellEnd bracket exactly the particles of each key.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidGPUReferenceTest_CellRanges::RunTest(const FString& Parameters)
+{
+	const FGPUFluidSimulationParams Params = MakeParams(1);
+
+	for (const bool bHybrid : { true, false })
+	{
+		FKawaiiFluidGPUReferenceConfig Config;
+		Config.bUseHybridTiledZOrder = bHybrid;
+		FKawaiiFluidGPUReferenceSolver Solver(Config);
+
+		// Scattered particles, some sharing a cell, a few outside the classic grid
+		FRandomStream Random(11);
+		TArray<FGPUFluidParticle> Particles;
+		for (int32 i = 0; i < 3000; ++i)
+		{
+			FGPUFluidParticle& Particle = Particles.AddDefaulted_GetRef();
+			Particle.PredictedPosition = FVector3f(Random.FRandRange(-1500.0f, 1500.0f), Random.FRandRange(-300.0f, 300.0f), Random.FRandRange(-100.0f, 100.0f));
+			Particle.Position = Particle.PredictedPosition;
+			Particle.ParticleID = i;
+		}
+		const TArray<FGPUFluidParticle> Unsorted = Particles;
+
+		// Sort a shifted copy first so the real sort has to clear the cells it left behind
+		for (FGPUFluidParticle& Particle : Particles)
+		{
+			Particle.PredictedPosition += FVector3f(0.0f, 0.0f, 500.0f);
+		}
+		Solver.SortParticles(Particles, Params);
+		Particles = Unsorted;
+		Solver.SortParticles(Particles, Params);
+
+		const TConstArrayView<uint32> Keys = Solver.GetSortKeys();
+		const TConstArrayView<uint32> SortedIndices = Solver.GetSortedIndices();
+		const uint32 CellMask = Solver.GetMaxCells() - 1;
+
+		bool bOrdered = true;
+		bool bGathered = true;
+		bool bInRange = true;
+		TSet<uint32> DistinctCells;
+		for (int32 i = 0; i < Particles.Num(); ++i)
+		{
+			if (i > 0)
+			{
+				bOrdered &= Keys[i - 1] < Keys[i] || (Keys[i - 1] == Keys[i] && SortedIndices[i - 1] < SortedIndices[i]);
+			}
+			bGathered &= Particles[i].ParticleID == Unsorted[SortedIndices[i]].ParticleID
+				&& Keys[i] == Solver.ComputeSortKey(Particles[i].PredictedPosition, Params.CellSize);
+
+			const uint32 CellID = Keys[i] & CellMask;
+			bInRange &= Solver.GetCellStart(CellID) <= static_cast<uint32>(i) && static_cast<uint32>(i) <= Solver.GetCellEnd(CellID);
+			DistinctCells.Add(CellID);
+		}
+
+		int32 NumOccupiedCells = 0;
+		for (uint32 CellID = 0; CellID <= CellMask; ++CellID)
+		{
+			NumOccupiedCells += Solver.GetCellStart(CellID) != FKawaiiFluidGPUReferenceSolver::InvalidIndex ? 1 : 0;
+		}
+
+		const TCHAR* Mode = bHybrid ? TEXT("Hybrid") : TEXT("Classic");
+		TestTrue(FString::Printf(TEXT("%s: keys ascending, ties in input order"), Mode), bOrdered);
+		TestTrue(FString::Printf(TEXT("%s: particles gathered by sorted index"), Mode), bGathered);
+		TestTrue(FString::Printf(TEXT("%s: every particle inside its cell range"), Mode), bInRange);
+		TestEqual(FString::Printf(TEXT("%s: no stale cells"), Mode), NumOccupiedCells, DistinctCells.Num());
+	}
+
+	return true;
+}
+
+/**
+ * @brief Iteration 0 finds the same neighbors and density as an O(N²) sum, and caches them for later iterations.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidGPUReferenceTest_DensityMatchesBruteForce::RunTest(const FString& Parameters)
+{
+	FGPUFluidSimulationParams Params = MakeParams(1);
+	Params.bEnablePositionBasedSurfaceTension = 0;
+
+	FKawaiiFluidGPUReferenceSolver Solver;
+	TArray<FGPUFluidParticle> Particles = MakeBlock(8, FVector3f(-40.0f), 3);
+	Solver.SortParticles(Particles, Params);
+	Solver.SplitToSoA(Particles);
+	Solver.SolveDensityPressure(0, Params);
+
+	const float H = Params.SmoothingRadius * 0.01f;
+	const float H2 = H * H;
+	const TConstArrayView<uint32> CachedCounts = Solver.GetCachedNeighborCounts();
+
+	TArray<FGPUFluidParticle> Result;
+	Solver.MergeToAoS(Result, Params);
+
+	float MaxRelativeError = 0.0f;
+	bool bCountsMatch = true;
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		double Density = 0.0;
+		uint32 NeighborCount = 0;
+		for (int32 j = 0; j < Particles.Num(); ++j)
+		{
+			const float R2 = FVector3f::DistSquared(Particles[i].PredictedPosition, Particles[j].PredictedPosition) * 0.0001f;
+			if (R2 < H2)
+			{
+				const double Diff = H2 - R2;
+				Density += Params.ParticleMass * Params.Poly6Coeff * Diff * Diff * Diff;
+				NeighborCount += i != j ? 1 : 0;
+			}
+		}
+
+		MaxRelativeError = FMath::Max(MaxRelativeError, static_cast<float>(FMath::Abs(Solver.GetDensity(i) - Density) / Density));
+		bCountsMatch &= Result[i].NeighborCount == NeighborCount && CachedCounts[i] == FMath::Min<uint32>(NeighborCount + 1, GPU_MAX_NEIGHBORS_PER_PARTICLE);
+	}
+
+	AddInfo(FString::Printf(TEXT("Max relative density error: %.5f"), MaxRelativeError));
+	TestTrue(TEXT("Density within half precision of the brute-force sum"), MaxRelativeError < 2e-3f);
+	TestTrue(TEXT("Neighbor counts match (cache includes self)"), bCountsMatch);
+
+	return true;
+}
+
+/**
+ * @brief Bounds, heightmap and sphere collision push penetrating particles out along the surface normal.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidGPUReferenceTest_Collisions::RunTest(const FString& Parameters)
+{
+	const FGPUFluidSimulationParams Params = MakeParams(1);
+
+	FGPUFluidParticle Particle;
+	Particle.Position = FVector3f(0.0f, 0.0f, -90.0f);
+	Particle.PredictedPosition = FVector3f(0.0f, 0.0f, -100.0f);
+	Particle.Velocity = FVector3f(0.0f, 0.0f, -100.0f);
+	TArray<FGPUFluidParticle> Particles = { Particle };
+
+	// Floor of the bounds, shrunk by the particle radius
+	{
+		FKawaiiFluidGPUReferenceSolver Solver;
+		Solver.SplitToSoA(Particles);
+		Solver.ApplyBoundsCollision(Params);
+
+		TArray<FGPUFluidParticle> Result;
+		Solver.MergeToAoS(Result, Params);
+		TestEqual(TEXT("Bounds: pushed to the floor"), Result[0].PredictedPosition.Z, -BoundsHalfExtent + Params.ParticleRadius, 1e-3f);
+		TestTrue(TEXT("Bounds: NearGround set"), (Result[0].Flags & EGPUParticleFlags::NearGround) != 0);
+		TestTrue(TEXT("Bounds: velocity no longer into the floor"), Result[0].Velocity.Z >= 0.0f);
+	}
+
+	// Flat heightmap at half height: terrain at Z = 50
+	{
+		FGPUHeightmapCollisionParams Heightmap;
+		Heightmap.bEnabled = 1;
+		Heightmap.WorldMin = FVector3f(-100.0f, -100.0f, 0.0f);
+		Heightmap.WorldMax = FVector3f(100.0f, 100.0f, 100.0f);
+		Heightmap.InvWorldExtent = FVector2f(1.0f / 200.0f);
+		Heightmap.TextureWidth = 4;
+		Heightmap.TextureHeight = 4;
+		Heightmap.InvTextureWidth = 0.25f;
+		Heightmap.InvTextureHeight = 0.25f;
+		Heightmap.NormalStrength = 1.0f;
+		Heightmap.CollisionOffset = 0.0f;
+		Heightmap.ParticleRadius = 0.0f;
+
+		TArray<float> Heights;
+		Heights.Init(0.5f, 16);
+
+		FKawaiiFluidGPUReferenceSolver Solver;
+		Solver.SetHeightmap(Heightmap, MoveTemp(Heights));
+
+		TArray<FGPUFluidParticle> Terrain = Particles;
+		Terrain[0].Position = FVector3f(0.0f, 0.0f, 60.0f);
+		Terrain[0].PredictedPosition = FVector3f(0.0f, 0.0f, 52.0f);
+		Solver.SplitToSoA(Terrain);
+		Solver.ApplyHeightmapCollision(Params);
+
+		TArray<FGPUFluidParticle> Result;
+		Solver.MergeToAoS(Result, Params);
+		TestEqual(TEXT("Heightmap: radius above the terrain plus skin"), Result[0].PredictedPosition.Z, 50.0f + Params.ParticleRadius + 0.01f, 1e-3f);
+		TestTrue(TEXT("Heightmap: HasCollided set"), (Result[0].Flags & EGPUParticleFlags::HasCollided) != 0);
+	}
+
+	// Sphere primitive: pushed to the surface plus the 0.1 cm skin
+	{
+		FGPUCollisionPrimitives Primitives;
+		FGPUCollisionSphere& Sphere = Primitives.Spheres.AddDefaulted_GetRef();
+		Sphere.Center = FVector3f::ZeroVector;
+		Sphere.Radius = 20.0f;
+
+		FKawaiiFluidGPUReferenceSolver Solver;
+		Solver.SetCollisionPrimitives(Primitives);
+
+		TArray<FGPUFluidParticle> Inside = Particles;
+		Inside[0].Position = FVector3f(30.0f, 0.0f, 0.0f);
+		Inside[0].PredictedPosition = FVector3f(10.0f, 0.0f, 0.0f);
+		Inside[0].Velocity = FVector3f(-100.0f, 0.0f, 0.0f);
+		Solver.SplitToSoA(Inside);
+		Solver.ApplyPrimitiveCollision(Params);
+
+		TArray<FGPUFluidParticle> Result;
+		Solver.MergeToAoS(Result, Params);
+		TestEqual(TEXT("Sphere: pushed out along the normal"), Result[0].PredictedPosition.X, 20.1f, 1e-2f);
+		TestTrue(TEXT("Sphere: velocity no longer into the sphere"), Result[0].Velocity.X >= 0.0f);
+	}
+
+	return true;
+}
+
+/**
+ * @brief A falling block stays finite and inside the bounds, and two runs produce identical buffers.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidGPUReferenceTest_DamBreakRegression::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumSubsteps = 60;
+	const FGPUFluidSimulationParams Params = MakeParams(3);
+
+	auto Run = [&Params](double& OutSeconds)
+	{
+		FKawaiiFluidGPUReferenceSolver Solver;
+		TArray<FGPUFluidParticle> Particles = MakeBlock(12, FVector3f(-95.0f, -95.0f, -95.0f), 5);
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Substep = 0; Substep < NumSubsteps; ++Substep)
+		{
+			Solver.SimulateSubstep(Particles, Params);
+			Solver.EndFrame();
+		}
+		OutSeconds = FPlatformTime::Seconds() - StartTime;
+		return Particles;
+	};
+
+	double FirstSeconds = 0.0;
+	double SecondSeconds = 0.0;
+	const TArray<FGPUFluidParticle> First = Run(FirstSeconds);
+	const TArray<FGPUFluidParticle> Second = Run(SecondSeconds);
+
+	bool bFinite = true;
+	bool bInBounds = true;
+	for (const FGPUFluidParticle& Particle : First)
+	{
+		bFinite &= !Particle.Position.ContainsNaN() && !Particle.Velocity.ContainsNaN() && FMath::IsFinite(Particle.Density);
+		bInBounds &= Particle.Position.GetAbsMax() <= BoundsHalfExtent + 1.0f;
+	}
+
+	TestEqual(TEXT("No particles lost"), First.Num(), 12 * 12 * 12);
+	TestTrue(TEXT("No NaN or infinity"), bFinite);
+	TestTrue(TEXT("Particles stay inside the bounds"), bInBounds);
+	TestTrue(TEXT("Deterministic across runs"),
+		First.Num() == Second.Num() && FMemory::Memcmp(First.GetData(), Second.GetData(), First.Num() * sizeof(FGPUFluidParticle)) == 0);
+
+	AddInfo(FString::Printf(TEXT("%d particles: %.3f ms per substep"), First.Num(), FMath::Min(FirstSeconds, SecondSeconds) * 1000.0 / NumSubsteps));
+
+	return true;
+}
+
+#endif
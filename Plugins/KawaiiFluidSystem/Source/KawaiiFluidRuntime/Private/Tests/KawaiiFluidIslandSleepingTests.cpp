@@ -0,0 +1,263 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/Package.h"
+#include "Core/KawaiiFluidSimulationContext.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+#include "Core/KawaiiFluidSpatialHash.h"
+#include "Simulation/Physics/KawaiiFluidIslandSolver.h"
+#include "Simulation/Collision/KawaiiFluidCapsuleCollider.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidIslandSleepingTest_RestingPoolBitStable,
+	"KawaiiFluid.Simulation.IslandSleeping.T01_RestingPoolBitStable",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidIslandSleepingTest_WakePropagation,
+	"KawaiiFluid.Simulation.IslandSleeping.T02_WakePropagation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr int32 PoolSide = 8;
+	constexpr int32 PoolLayers = 3;
+	constexpr int32 PoolCount = PoolSide * PoolSide * PoolLayers;
+	constexpr int32 MaxSettleFrames = 600;
+
+	/**
+	 * @brief Two separated resting pools in one container, simulated on the CPU with sleeping enabled.
+	 */
+	struct FSleepingPoolScene
+	{
+		TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Preset;
+		TStrongObjectPtr<UKawaiiFluidSimulationContext> Context;
+		TUniquePtr<FKawaiiFluidSpatialHash> SpatialHash;
+		TArray<FKawaiiFluidParticle> Particles;
+		FKawaiiFluidSimulationParams Params;
+		float AccumulatedTime = 0.0f;
+		float FrameDeltaTime = 0.0f;
+		FVector PoolAOrigin = FVector::ZeroVector;
+
+		/**
+		 * @brief Helper: Build the scene.
+		 */
+		FSleepingPoolScene()
+		{
+			Preset.Reset(NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage()));
+			Preset->bEnableParticleSleeping = true;
+			Preset->SleepVelocityThreshold = 100.0f;
+			Preset->SleepFrameThreshold = 3;
+			// Pools are checked by index range, so keep the array unsorted
+			Preset->CPUZOrderSortInterval = 0;
+			Preset->RecalculateDerivedParameters();
+
+			Context.Reset(NewObject<UKawaiiFluidSimulationContext>(GetTransientPackage()));
+			Context->InitializeSolvers(Preset.Get());
+			SpatialHash = MakeUnique<FKawaiiFluidSpatialHash>(Preset->SmoothingRadius);
+
+			const float Spacing = Preset->ParticleSpacing;
+			const float PoolWidth = PoolSide * Spacing;
+			const float Gap = Preset->SmoothingRadius * 4.0f;
+
+			Params.ParticleRadius = Preset->ParticleRadius;
+			Params.bUseWorldCollision = false;
+			Params.WorldBounds = FBox(FVector::ZeroVector, FVector(PoolWidth * 2.0f + Gap, PoolWidth, PoolLayers * Spacing * 3.0f));
+
+			PoolAOrigin = FVector(Spacing * 0.5f, Spacing * 0.5f, Spacing * 0.5f);
+			AddPool(PoolAOrigin, Spacing, 0);
+			AddPool(PoolAOrigin + FVector(PoolWidth + Gap, 0.0f, 0.0f), Spacing, PoolCount);
+
+			FrameDeltaTime = Preset->SubstepDeltaTime * 2.0f;
+		}
+
+		/**
+		 * @brief Helper: Add a cubic-lattice pool.
+		 * @param Origin First particle position.
+		 * @param Spacing Lattice spacing.
+		 * @param FirstID ParticleID of the first particle.
+		 */
+		void AddPool(const FVector& Origin, float Spacing, int32 FirstID)
+		{
+			int32 ID = FirstID;
+			for (int32 Z = 0; Z < PoolLayers; ++Z)
+			{
+				for (int32 Y = 0; Y < PoolSide; ++Y)
+				{
+					for (int32 X = 0; X < PoolSide; ++X)
+					{
+						FKawaiiFluidParticle& P = Particles.Emplace_GetRef(Origin + FVector(X, Y, Z) * Spacing, ID++);
+						P.Mass = Preset->ParticleMass;
+					}
+				}
+			}
+		}
+
+		/**
+		 * @brief Helper: Advance one frame.
+		 */
+		void Step()
+		{
+			Context->SimulateCPU(Particles, Preset.Get(), Params, *SpatialHash, FrameDeltaTime, AccumulatedTime);
+		}
+
+		/**
+		 * @brief Helper: Step until every particle sleeps.
+		 * @return True if the scene fell asleep within MaxSettleFrames.
+		 */
+		bool SettleToSleep()
+		{
+			for (int32 Frame = 0; Frame < MaxSettleFrames; ++Frame)
+			{
+				Step();
+				if (Context->GetIslandSolver()->GetNumSleepingParticles() == Particles.Num())
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+	};
+
+	/**
+	 * @brief Helper: Exact (bitwise) comparison of particle kinematics over a range.
+	 * @param A First particle array.
+	 * @param B Second particle array.
+	 * @param Start First index to compare.
+	 * @param Count Number of particles to compare.
+	 * @return True if positions, predicted positions and velocities are identical.
+	 */
+	bool IsBitIdentical(const TArray<FKawaiiFluidParticle>& A, const TArray<FKawaiiFluidParticle>& B, int32 Start, int32 Count)
+	{
+		for (int32 i = Start; i < Start + Count; ++i)
+		{
+			if (FMemory::Memcmp(&A[i].Position, &B[i].Position, sizeof(FVector)) != 0
+				|| FMemory::Memcmp(&A[i].PredictedPosition, &B[i].PredictedPosition, sizeof(FVector)) != 0
+				|| FMemory::Memcmp(&A[i].Velocity, &B[i].Velocity, sizeof(FVector)) != 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Helper: Whether every particle in a range sleeps.
+	 * @param Particles Particle array.
+	 * @param Start First index.
+	 * @param Count Number of particles.
+	 * @return True if all sleep.
+	 */
+	bool AllSleeping(const TArray<FKawaiiFluidParticle>& Particles, int32 Start, int32 Count)
+	{
+		for (int32 i = Start; i < Start + Count; ++i)
+		{
+			if (!Particles[i].bIsSleeping)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+/**
+ * @brief Resting pools fall asleep as separate islands and then stay bit-for-bit unchanged.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidIslandSleepingTest_RestingPoolBitStable::RunTest(const FString& Parameters)
+{
+	FSleepingPoolScene Scene;
+	if (!TestTrue(TEXT("Pools fall asleep"), Scene.SettleToSleep()))
+	{
+		return false;
+	}
+
+	const FKawaiiFluidIslandSolver* Islands = Scene.Context->GetIslandSolver();
+	TestEqual(TEXT("Two separated pools form two islands"), Islands->GetNumIslands(), 2);
+	TestEqual(TEXT("Both islands sleep"), Islands->GetNumSleepingIslands(), 2);
+
+	bool bZeroVelocity = true;
+	for (const FKawaiiFluidParticle& P : Scene.Particles)
+	{
+		bZeroVelocity &= P.Velocity.IsZero();
+	}
+	TestTrue(TEXT("Sleeping particles have zero velocity"), bZeroVelocity);
+
+	const TArray<FKawaiiFluidParticle> Snapshot = Scene.Particles;
+	for (int32 Frame = 0; Frame < 120; ++Frame)
+	{
+		Scene.Step();
+	}
+
+	TestTrue(TEXT("Resting pools are bit-stable over 120 frames"), IsBitIdentical(Snapshot, Scene.Particles, 0, Scene.Particles.Num()));
+	TestTrue(TEXT("Pools are still asleep"), AllSleeping(Scene.Particles, 0, Scene.Particles.Num()));
+	TestTrue(TEXT("Fully asleep scene skips island detection"), Islands->WasLastUpdateSkipped());
+	TestTrue(TEXT("Bounds cover the sleeping particles"), Scene.Context->GetLastParticleBounds().IsInsideOrOn(Scene.Particles[0].Position));
+
+	// Disabling sleeping on the preset wakes everything
+	Scene.Preset->bEnableParticleSleeping = false;
+	Scene.Step();
+	TestFalse(TEXT("Disabling sleeping wakes all particles"), Islands->HasSleepingParticles());
+
+	return true;
+}
+
+/**
+ * @brief Spawning next to, despawning from, and moving a collider into an island wakes only that island.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidIslandSleepingTest_WakePropagation::RunTest(const FString& Parameters)
+{
+	FSleepingPoolScene Scene;
+	if (!TestTrue(TEXT("Pools fall asleep"), Scene.SettleToSleep()))
+	{
+		return false;
+	}
+
+	// Spawn: a particle dropped onto pool A joins its island and wakes it
+	const FVector TopOfA = Scene.Particles[PoolCount - 1].Position + FVector(0.0f, 0.0f, Scene.Preset->ParticleSpacing);
+	TArray<FKawaiiFluidParticle> BeforeSpawn = Scene.Particles;
+	Scene.Particles.Emplace(TopOfA, 10000).Mass = Scene.Preset->ParticleMass;
+	Scene.Step();
+
+	TestFalse(TEXT("Spawn wakes the touched island"), AllSleeping(Scene.Particles, 0, PoolCount));
+	TestTrue(TEXT("Other island keeps sleeping"), AllSleeping(Scene.Particles, PoolCount, PoolCount));
+	TestTrue(TEXT("Other island is untouched by the spawn"), IsBitIdentical(BeforeSpawn, Scene.Particles, PoolCount, PoolCount));
+
+	// Despawn: removing a particle from pool B changes its members' neighbor counts and wakes it
+	Scene.Particles.RemoveAt(PoolCount * 2 - 1);
+	Scene.Step();
+	TestFalse(TEXT("Despawn wakes the island it touched"), AllSleeping(Scene.Particles, PoolCount, PoolCount - 1));
+
+	// Collider: settle again, then move a capsule into pool B
+	if (!TestTrue(TEXT("Pools fall asleep again"), Scene.SettleToSleep()))
+	{
+		return false;
+	}
+
+	TStrongObjectPtr<UKawaiiFluidCapsuleCollider> Capsule(NewObject<UKawaiiFluidCapsuleCollider>(GetTransientPackage()));
+	Capsule->Radius = Scene.Preset->ParticleSpacing;
+	Capsule->HalfHeight = Scene.Preset->ParticleSpacing * 2.0f;
+	Capsule->LocalOffset = Scene.Params.WorldBounds.Max + FVector(1000.0f);
+	Scene.Params.Colliders.Add(Capsule.Get());
+
+	Scene.Step();
+	TestTrue(TEXT("Distant collider does not wake anything"), AllSleeping(Scene.Particles, 0, Scene.Particles.Num()));
+	TestTrue(TEXT("Distant collider skips island detection"), Scene.Context->GetIslandSolver()->WasLastUpdateSkipped());
+
+	Capsule->LocalOffset = Scene.Particles[PoolCount + PoolCount / 2].Position;
+	const TArray<FKawaiiFluidParticle> BeforeCollider = Scene.Particles;
+	Scene.Step();
+	TestFalse(TEXT("Overlapping collider wakes pool B"), AllSleeping(Scene.Particles, PoolCount, Scene.Particles.Num() - PoolCount));
+	TestTrue(TEXT("Pool A keeps sleeping"), AllSleeping(Scene.Particles, 0, PoolCount + 1));
+	TestTrue(TEXT("Pool A is untouched by the collider"), IsBitIdentical(BeforeCollider, Scene.Particles, 0, PoolCount + 1));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,287 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/Package.h"
+#include "Core/KawaiiFluidSimulationContext.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+#include "Core/KawaiiFluidSpatialHash.h"
+#include "Simulation/Physics/KawaiiFluidLODSolver.h"
+#include "Simulation/Physics/KawaiiFluidDensityConstraint.h"
+#include "Simulation/Utils/KawaiiFluidParticleSubset.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidLODSolverTest_TierHysteresis,
+	"KawaiiFluid.Simulation.LOD.T01_TierHysteresis",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidLODSolverTest_FarAndFrozenTiers,
+	"KawaiiFluid.Simulation.LOD.T02_FarAndFrozenTiers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidLODSolverTest_TierSeamDensity,
+	"KawaiiFluid.Simulation.LOD.T03_TierSeamDensity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float FarDistance = 1000.0f;
+	constexpr float FrozenDistance = 5000.0f;
+	constexpr float Hysteresis = 0.1f;
+
+	/**
+	 * @brief Helper: Add a small cubic block of particles.
+	 * @param Origin First particle position.
+	 * @param Spacing Lattice spacing.
+	 * @param Mass Particle mass.
+	 * @param OutParticles Particles to append to.
+	 * @return Index of the first added particle.
+	 */
+	int32 AddBlock(const FVector& Origin, float Spacing, float Mass, TArray<FKawaiiFluidParticle>& OutParticles)
+	{
+		const int32 First = OutParticles.Num();
+		for (int32 Z = 0; Z < 4; ++Z)
+		{
+			for (int32 Y = 0; Y < 4; ++Y)
+			{
+				for (int32 X = 0; X < 4; ++X)
+				{
+					OutParticles.Emplace_GetRef(Origin + FVector(X, Y, Z) * Spacing, OutParticles.Num()).Mass = Mass;
+				}
+			}
+		}
+		return First;
+	}
+
+	/**
+	 * @brief Helper: Whether a particle range kept its exact positions and velocities.
+	 * @param A First particle array.
+	 * @param B Second particle array.
+	 * @param Start First index.
+	 * @param Count Number of particles.
+	 * @return True if bit-identical.
+	 */
+	bool IsUnchanged(const TArray<FKawaiiFluidParticle>& A, const TArray<FKawaiiFluidParticle>& B, int32 Start, int32 Count)
+	{
+		for (int32 i = Start; i < Start + Count; ++i)
+		{
+			if (FMemory::Memcmp(&A[i].Position, &B[i].Position, sizeof(FVector)) != 0
+				|| FMemory::Memcmp(&A[i].Velocity, &B[i].Velocity, sizeof(FVector)) != 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Helper: Cache neighbor lists from the predicted positions.
+	 * @param Particles Particles to update.
+	 * @param SmoothingRadius Neighbor search radius.
+	 */
+	void BuildNeighbors(TArray<FKawaiiFluidParticle>& Particles, float SmoothingRadius)
+	{
+		FKawaiiFluidSpatialHash SpatialHash(SmoothingRadius);
+
+		TArray<FVector> Positions;
+		Positions.Reserve(Particles.Num());
+		for (const FKawaiiFluidParticle& P : Particles)
+		{
+			Positions.Add(P.PredictedPosition);
+		}
+		SpatialHash.BuildFromPositions(Positions);
+
+		for (FKawaiiFluidParticle& P : Particles)
+		{
+			SpatialHash.GetNeighbors(P.PredictedPosition, SmoothingRadius, P.NeighborIndices);
+		}
+	}
+}
+
+/**
+ * @brief Tier distances with hysteresis: switching requires crossing the band, not just the distance.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidLODSolverTest_TierHysteresis::RunTest(const FString& Parameters)
+{
+	using ETier = EKawaiiFluidLODTier;
+
+	// Fresh cells use the plain thresholds
+	TestTrue(TEXT("Fresh near"), FKawaiiFluidLODSolver::ResolveTier(500.0f, ETier::Near, FarDistance, FrozenDistance, 0.0f) == ETier::Near);
+	TestTrue(TEXT("Fresh far"), FKawaiiFluidLODSolver::ResolveTier(1500.0f, ETier::Near, FarDistance, FrozenDistance, 0.0f) == ETier::Far);
+	TestTrue(TEXT("Fresh frozen"), FKawaiiFluidLODSolver::ResolveTier(6000.0f, ETier::Near, FarDistance, FrozenDistance, 0.0f) == ETier::Frozen);
+
+	// Inside the band the previous tier is kept, in both directions
+	TestTrue(TEXT("Near stays near just past the far distance"), FKawaiiFluidLODSolver::ResolveTier(1050.0f, ETier::Near, FarDistance, FrozenDistance, Hysteresis) == ETier::Near);
+	TestTrue(TEXT("Far stays far just inside the far distance"), FKawaiiFluidLODSolver::ResolveTier(950.0f, ETier::Far, FarDistance, FrozenDistance, Hysteresis) == ETier::Far);
+	TestTrue(TEXT("Frozen stays frozen just inside the frozen distance"), FKawaiiFluidLODSolver::ResolveTier(4800.0f, ETier::Frozen, FarDistance, FrozenDistance, Hysteresis) == ETier::Frozen);
+
+	// Beyond the band the tier changes, possibly by more than one step
+	TestTrue(TEXT("Near becomes far past the band"), FKawaiiFluidLODSolver::ResolveTier(1150.0f, ETier::Near, FarDistance, FrozenDistance, Hysteresis) == ETier::Far);
+	TestTrue(TEXT("Far becomes near inside the band"), FKawaiiFluidLODSolver::ResolveTier(850.0f, ETier::Far, FarDistance, FrozenDistance, Hysteresis) == ETier::Near);
+	TestTrue(TEXT("Near jumps to frozen"), FKawaiiFluidLODSolver::ResolveTier(9000.0f, ETier::Near, FarDistance, FrozenDistance, Hysteresis) == ETier::Frozen);
+	TestTrue(TEXT("Frozen jumps to near"), FKawaiiFluidLODSolver::ResolveTier(100.0f, ETier::Frozen, FarDistance, FrozenDistance, Hysteresis) == ETier::Near);
+
+	// Far clock: four fine substeps of 1/120 s make one coarse substep of 1/30 s
+	FKawaiiFluidLODSolver Solver;
+	const float FineDT = 1.0f / 120.0f;
+	int32 CoarseSteps = 0;
+	for (int32 Frame = 0; Frame < 60; ++Frame)
+	{
+		CoarseSteps += Solver.AdvanceFarClock(FineDT * 2.0f, FineDT * 4.0f, 2);
+	}
+	TestEqual(TEXT("Far clock runs one coarse step per stride"), CoarseSteps, 30);
+
+	return true;
+}
+
+/**
+ * @brief Far blocks run coarse substeps, frozen blocks stay bit-identical, and a nearby view thaws them.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidLODSolverTest_FarAndFrozenTiers::RunTest(const FString& Parameters)
+{
+	TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Preset(NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage()));
+	Preset->bEnableSimulationLOD = true;
+	Preset->LODFarDistance = FarDistance;
+	Preset->LODFrozenDistance = FrozenDistance;
+	Preset->LODHysteresis = Hysteresis;
+	Preset->LODFarSubstepStride = 4;
+	// Blocks are checked by index range, so keep the array unsorted
+	Preset->CPUZOrderSortInterval = 0;
+	Preset->RecalculateDerivedParameters();
+
+	TStrongObjectPtr<UKawaiiFluidSimulationContext> Context(NewObject<UKawaiiFluidSimulationContext>(GetTransientPackage()));
+	Context->InitializeSolvers(Preset.Get());
+	FKawaiiFluidSpatialHash SpatialHash(Preset->SmoothingRadius);
+
+	// Three falling blocks: near, far and frozen relative to a view at the origin
+	const float Spacing = Preset->ParticleSpacing;
+	TArray<FKawaiiFluidParticle> Particles;
+	const int32 NearStart = AddBlock(FVector(0.0f, 0.0f, 200.0f), Spacing, Preset->ParticleMass, Particles);
+	const int32 FarStart = AddBlock(FVector(2000.0f, 0.0f, 200.0f), Spacing, Preset->ParticleMass, Particles);
+	const int32 FrozenStart = AddBlock(FVector(8000.0f, 0.0f, 200.0f), Spacing, Preset->ParticleMass, Particles);
+	const int32 BlockCount = FarStart - NearStart;
+
+	FKawaiiFluidSimulationParams Params;
+	Params.ParticleRadius = Preset->ParticleRadius;
+	Params.bUseWorldCollision = false;
+	Params.WorldBounds = FBox(FVector(-500.0f, -500.0f, 0.0f), FVector(9000.0f, 500.0f, 1000.0f));
+	Params.LODViewLocations.Add(FVector::ZeroVector);
+
+	float AccumulatedTime = 0.0f;
+	const float FrameDeltaTime = Preset->SubstepDeltaTime * 2.0f;
+	const TArray<FKawaiiFluidParticle> Initial = Particles;
+
+	int32 NearSubsteps = 0;
+	int32 FarSubsteps = 0;
+	for (int32 Frame = 0; Frame < 16; ++Frame)
+	{
+		Context->SimulateCPU(Particles, Preset.Get(), Params, SpatialHash, FrameDeltaTime, AccumulatedTime);
+		const FKawaiiFluidLODSolver* LOD = Context->GetLODSolver();
+		NearSubsteps += LOD->GetTierStats(EKawaiiFluidLODTier::Near).NumSubsteps;
+		FarSubsteps += LOD->GetTierStats(EKawaiiFluidLODTier::Far).NumSubsteps;
+	}
+
+	const FKawaiiFluidLODSolver* LOD = Context->GetLODSolver();
+	TestEqual(TEXT("Near tier particles"), LOD->GetTierStats(EKawaiiFluidLODTier::Near).NumParticles, BlockCount);
+	TestEqual(TEXT("Far tier particles"), LOD->GetTierStats(EKawaiiFluidLODTier::Far).NumParticles, BlockCount);
+	TestEqual(TEXT("Frozen tier particles"), LOD->GetTierStats(EKawaiiFluidLODTier::Frozen).NumParticles, BlockCount);
+	TestTrue(TEXT("Far tier runs about a quarter of the near substeps"), FMath::Abs(FarSubsteps * 4 - NearSubsteps) < 4);
+
+	TestFalse(TEXT("Near block falls"), IsUnchanged(Initial, Particles, NearStart, BlockCount));
+	TestFalse(TEXT("Far block falls"), IsUnchanged(Initial, Particles, FarStart, BlockCount));
+	TestTrue(TEXT("Frozen block is a static snapshot"), IsUnchanged(Initial, Particles, FrozenStart, BlockCount));
+
+	// Moving the view next to the frozen block thaws it
+	Params.LODViewLocations[0] = FVector(8000.0f, 0.0f, 200.0f);
+	Context->SimulateCPU(Particles, Preset.Get(), Params, SpatialHash, FrameDeltaTime, AccumulatedTime);
+	TestFalse(TEXT("Thawed block simulates again"), IsUnchanged(Initial, Particles, FrozenStart, BlockCount));
+	TestEqual(TEXT("The other two blocks are now frozen"), Context->GetLODSolver()->GetTierStats(EKawaiiFluidLODTier::Frozen).NumParticles, BlockCount * 2);
+
+	// Without view locations every particle is simulated at full rate
+	Params.LODViewLocations.Reset();
+	Context->SimulateCPU(Particles, Preset.Get(), Params, SpatialHash, FrameDeltaTime, AccumulatedTime);
+	TestEqual(TEXT("No view disables LOD"), Context->GetLODSolver()->GetTierStats(EKawaiiFluidLODTier::Frozen).NumParticles, 0);
+
+	return true;
+}
+
+/**
+ * @brief A tier solved on its own sees the particles of the next tier as read-only neighbors at the seam.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidLODSolverTest_TierSeamDensity::RunTest(const FString& Parameters)
+{
+	TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Preset(NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage()));
+	Preset->RecalculateDerivedParameters();
+
+	const float Spacing = Preset->ParticleSpacing;
+	const float SmoothingRadius = Preset->SmoothingRadius;
+	const float Compliance = 0.01f;
+	const float DeltaTime = Preset->SubstepDeltaTime;
+
+	// Two touching blocks: the first is the solved tier, the second the tier across the seam
+	TArray<FKawaiiFluidParticle> Particles;
+	AddBlock(FVector::ZeroVector, Spacing, Preset->ParticleMass, Particles);
+	const int32 SecondStart = AddBlock(FVector(Spacing * 4.0f, 0.0f, 0.0f), Spacing, Preset->ParticleMass, Particles);
+	const TArray<FKawaiiFluidParticle> Initial = Particles;
+
+	// Seam particle: last column of the first block
+	const int32 SeamIndex = 3 + 4 + 16;
+
+	TArray<FKawaiiFluidParticle> Full = Particles;
+	BuildNeighbors(Full, SmoothingRadius);
+	FKawaiiFluidDensityConstraint FullSolver(Preset->Density, SmoothingRadius, Compliance);
+	FullSolver.Solve(Full, SmoothingRadius, Preset->Density, Compliance, DeltaTime);
+	const float FullDensity = Full[SeamIndex].Density;
+
+	auto IsFirstBlock = [SecondStart](const FKawaiiFluidParticle&, int32 Index) { return Index < SecondStart; };
+	FKawaiiFluidParticleSubset Subset;
+
+	// Without read-only neighbors the seam loses the density of the other tier
+	{
+		TArray<FKawaiiFluidParticle>& Tier = Subset.Gather(Particles, IsFirstBlock);
+		BuildNeighbors(Tier, SmoothingRadius);
+		FKawaiiFluidDensityConstraint Solver(Preset->Density, SmoothingRadius, Compliance);
+		Solver.Solve(Tier, SmoothingRadius, Preset->Density, Compliance, DeltaTime, Subset.GetNumSolved());
+		TestTrue(TEXT("Isolated tier is under-dense at the seam"), Tier[SeamIndex].Density < FullDensity * 0.95f);
+		Subset.Scatter(Particles);
+	}
+
+	Particles = Initial;
+
+	// With read-only neighbors it matches the full-array solve, and the neighbors do not move
+	{
+		TArray<FKawaiiFluidParticle>& Tier = Subset.Gather(Particles, IsFirstBlock);
+		Subset.GatherReadOnlyNeighbors(Particles, SmoothingRadius);
+		TestTrue(TEXT("Seam neighbors are gathered read-only"), Subset.GetNumReadOnly() > 0);
+		TestEqual(TEXT("Solved count is the gathered tier"), Subset.GetNumSolved(), SecondStart);
+
+		BuildNeighbors(Tier, SmoothingRadius);
+		FKawaiiFluidDensityConstraint Solver(Preset->Density, SmoothingRadius, Compliance);
+		Solver.Solve(Tier, SmoothingRadius, Preset->Density, Compliance, DeltaTime, Subset.GetNumSolved());
+		TestTrue(TEXT("Seam density matches the full solve"), FMath::IsNearlyEqual(Tier[SeamIndex].Density, FullDensity, FullDensity * 1.0e-3f));
+
+		bool bReadOnlyStill = true;
+		for (int32 k = Subset.GetNumSolved(); k < Tier.Num(); ++k)
+		{
+			bReadOnlyStill &= Tier[k].PredictedPosition == Tier[k].Position;
+		}
+		TestTrue(TEXT("Read-only neighbors are not corrected"), bReadOnlyStill);
+
+		Subset.Scatter(Particles);
+	}
+
+	TestEqual(TEXT("Scatter drops the read-only copies"), Subset.Num(), 0);
+	TestTrue(TEXT("Other tier is untouched"), IsUnchanged(Initial, Particles, SecondStart, Particles.Num() - SecondStart));
+
+	return true;
+}
+
+#endif
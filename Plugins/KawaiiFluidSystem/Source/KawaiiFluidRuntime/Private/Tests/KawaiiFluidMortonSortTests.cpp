@@ -0,0 +1,297 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Algo/StableSort.h"
+#include "Simulation/Utils/KawaiiFluidMortonSort.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/Package.h"
+#include "Modules/KawaiiFluidSimulationModule.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidMortonSortTest_KeysMatchShaderLayout,
+	"KawaiiFluid.Simulation.MortonSort.T01_KeysMatchShaderLayout",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidMortonSortTest_RadixSortStable,
+	"KawaiiFluid.Simulation.MortonSort.T02_RadixSortStable",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidMortonSortTest_ReorderGathers,
+	"KawaiiFluid.Simulation.MortonSort.T03_ReorderGathers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidMortonSortTest_ModuleIndicesSurviveSort,
+	"KawaiiFluid.Simulation.MortonSort.T04_ModuleIndicesSurviveSort",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Morton code by interleaving one bit at a time (independent of the magic-number expansion).
+	 * @return Interleaved code, X in bit 0.
+	 */
+	uint32 NaiveMorton3D(uint32 X, uint32 Y, uint32 Z, int32 AxisBits)
+	{
+		uint32 Code = 0;
+		for (int32 Bit = 0; Bit < AxisBits; ++Bit)
+		{
+			Code |= ((X >> Bit) & 1u) << (3 * Bit);
+			Code |= ((Y >> Bit) & 1u) << (3 * Bit + 1);
+			Code |= ((Z >> Bit) & 1u) << (3 * Bit + 2);
+		}
+		return Code;
+	}
+
+	/**
+	 * @brief Helper: Keys with many duplicates so stability is observable.
+	 * @param Num Number of keys.
+	 * @param KeyBits Significant bits.
+	 * @param Seed Random seed.
+	 * @return Keys.
+	 */
+	TArray<uint32> MakeKeys(int32 Num, int32 KeyBits, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		const uint32 Mask = KeyBits >= 32 ? 0xFFFFFFFFu : (1u << KeyBits) - 1;
+		TArray<uint32> Keys;
+		Keys.SetNumUninitialized(Num);
+		for (uint32& Key : Keys)
+		{
+			// Few distinct low digits, spread high bits
+			Key = ((static_cast<uint32>(Random.GetUnsignedInt()) & ~0xFFu) | static_cast<uint32>(Random.RandRange(0, 3))) & Mask;
+		}
+		return Keys;
+	}
+
+	/**
+	 * @brief Helper: Compare the sorter against a comparison-based stable sort.
+	 * @return True if sorted indices, sorted keys and the inverse permutation match.
+	 */
+	bool MatchesStableSort(const FKawaiiFluidMortonSorter& Sorter, const TArray<uint32>& Keys)
+	{
+		TArray<uint32> Expected;
+		Expected.SetNumUninitialized(Keys.Num());
+		for (int32 i = 0; i < Keys.Num(); ++i)
+		{
+			Expected[i] = static_cast<uint32>(i);
+		}
+		Algo::StableSort(Expected, [&Keys](uint32 A, uint32 B) { return Keys[A] < Keys[B]; });
+
+		const TConstArrayView<uint32> SortedIndices = Sorter.GetSortedIndices();
+		const TConstArrayView<uint32> SortedKeys = Sorter.GetSortedKeys();
+		if (SortedIndices.Num() != Expected.Num())
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < Expected.Num(); ++i)
+		{
+			if (SortedIndices[i] != Expected[i] || SortedKeys[i] != Keys[Expected[i]] || Sorter.GetNewIndex(static_cast<int32>(Expected[i])) != i)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+/**
+ * @brief Key functions reproduce KawaiiFluidMortonUtils.ush for every preset and the hybrid tiled layout.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidMortonSortTest_KeysMatchShaderLayout::RunTest(const FString& Parameters)
+{
+	using namespace KawaiiFluidMorton;
+
+	TestEqual(TEXT("6-bit expansion"), ExpandBits(0x3F, 6), 0x9249u);
+	TestEqual(TEXT("7-bit expansion"), ExpandBits(0x7F, 7), 0x49249u);
+	TestEqual(TEXT("8-bit expansion"), ExpandBits(0xFF, 8), 0x249249u);
+	TestEqual(TEXT("Expansion masks to the axis bits"), ExpandBits(0x1FF, 8), 0x249249u);
+	TestEqual(TEXT("X in bit 0, Y in bit 1, Z in bit 2"), Morton3D(1, 2, 3, 7), 53u);
+	TestEqual(TEXT("Coordinates clamp to the grid"), Morton3D(500, 0, 0, 7), 0x49249u);
+
+	FRandomStream Random(3);
+	bool bMatchesNaive = true;
+	for (int32 AxisBits = 6; AxisBits <= 8; ++AxisBits)
+	{
+		for (int32 Sample = 0; Sample < 1000; ++Sample)
+		{
+			const uint32 X = Random.RandRange(0, (1 << AxisBits) - 1);
+			const uint32 Y = Random.RandRange(0, (1 << AxisBits) - 1);
+			const uint32 Z = Random.RandRange(0, (1 << AxisBits) - 1);
+			bMatchesNaive &= Morton3D(X, Y, Z, AxisBits) == NaiveMorton3D(X, Y, Z, AxisBits);
+		}
+	}
+	TestTrue(TEXT("Matches bit-by-bit interleaving for 6/7/8 bits"), bMatchesNaive);
+
+	// Hybrid: tile (1,0,0) hashes to 73856093 & 7 = 5, tile (-1,0,0) to (-73856093) & 7 = 3
+	TestEqual(TEXT("Hybrid origin"), HybridTiledKey(FIntVector(0, 0, 0)), 0u);
+	TestEqual(TEXT("Hybrid next tile"), HybridTiledKey(FIntVector(64, 0, 0)), 5u << HybridLocalMortonBits);
+	TestEqual(TEXT("Hybrid negative tile"), HybridTiledKey(FIntVector(-1, 0, 0)), (3u << HybridLocalMortonBits) | 0x9249u);
+
+	const FKawaiiFluidMortonKeyLayout Large = FKawaiiFluidMortonKeyLayout::FromPreset(EGridResolutionPreset::Large, false, FVector3f(-100.0f), 10.0f);
+	TestEqual(TEXT("Large classic key bits"), Large.GetKeyBits(), 24);
+	TestEqual(TEXT("Classic key is relative to the bounds"), Large.ComputeKey(FVector3f(-95.0f + 10.0f, -95.0f, -95.0f)), 1u);
+
+	const FKawaiiFluidMortonKeyLayout Hybrid = FKawaiiFluidMortonKeyLayout::FromPreset(EGridResolutionPreset::Large, true, FVector3f::ZeroVector, 10.0f);
+	TestEqual(TEXT("Hybrid forces the Medium grid"), Hybrid.AxisBits, 7);
+	TestEqual(TEXT("Hybrid key bits"), Hybrid.GetKeyBits(), HybridKeyBits);
+	TestEqual(TEXT("Hybrid key of a position"), Hybrid.ComputeKey(FVector3f(-5.0f, 5.0f, 5.0f)), (3u << HybridLocalMortonBits) | 0x9249u);
+
+	return true;
+}
+
+/**
+ * @brief The radix sort equals a stable comparison sort for 21/24/32-bit keys across several chunks.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidMortonSortTest_RadixSortStable::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidMortonSorter Sorter;
+	const int32 Num = FKawaiiFluidMortonSorter::ChunkSize * 3 + 77;
+
+	for (const int32 KeyBits : { 21, 24, 32 })
+	{
+		const TArray<uint32> Keys = MakeKeys(Num, KeyBits, KeyBits);
+		Sorter.Sort(Keys, KeyBits);
+		TestTrue(FString::Printf(TEXT("%d-bit keys match a stable sort"), KeyBits), MatchesStableSort(Sorter, Keys));
+	}
+
+	// Sorting sorted keys moves nothing; a warm sorter does not grow
+	const TArray<uint32> Sorted(Sorter.GetSortedKeys());
+	const SIZE_T WarmSize = Sorter.GetAllocatedSize();
+	Sorter.Sort(Sorted, 32);
+	TestEqual(TEXT("Sorted input is left in place"), Sorter.GetNumMoved(), 0);
+	TestEqual(TEXT("Warm sorter does not allocate"), Sorter.GetAllocatedSize(), WarmSize);
+
+	// Single-digit keys skip every pass, a small input runs on one chunk
+	TArray<uint32> Uniform;
+	Uniform.Init(0x00AB0000u, 100);
+	Sorter.Sort(Uniform, 24);
+	TestTrue(TEXT("Uniform keys keep input order"), MatchesStableSort(Sorter, Uniform));
+
+	Sorter.Sort(TConstArrayView<uint32>(), 21);
+	TestEqual(TEXT("Empty input"), Sorter.GetSortedIndices().Num(), 0);
+
+	return true;
+}
+
+/**
+ * @brief Reorder gathers AoS and SoA arrays, including elements that own memory, by sorted index.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidMortonSortTest_ReorderGathers::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(17);
+	const int32 Num = 5000;
+
+	TArray<FVector3f> Positions;
+	TArray<int32> IDs;
+	TArray<TArray<int32>> Lists;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Positions.Add(FVector3f(Random.FRandRange(-500.0f, 500.0f), Random.FRandRange(-500.0f, 500.0f), Random.FRandRange(-500.0f, 500.0f)));
+		IDs.Add(i);
+		Lists.Add(TArray<int32>{ i, -i });
+	}
+	const TArray<FVector3f> Original = Positions;
+
+	FKawaiiFluidMortonKeyLayout Layout;
+	Layout.CellSize = 20.0f;
+
+	FKawaiiFluidMortonSorter Sorter;
+	Sorter.Sort(Num, Layout, [&Positions](int32 Index) { return Positions[Index]; });
+
+	TArray<FVector3f> PositionScratch;
+	TArray<int32> IDScratch;
+	TArray<TArray<int32>> ListScratch;
+	Sorter.Reorder(Positions, PositionScratch);
+	Sorter.Reorder(IDs, IDScratch);
+	Sorter.Reorder(Lists, ListScratch);
+
+	bool bGathered = true;
+	bool bKeysAscending = true;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const int32 OldIndex = IDs[i];
+		bGathered &= Positions[i] == Original[OldIndex] && Lists[i].Num() == 2 && Lists[i][0] == OldIndex
+			&& Sorter.GetNewIndex(OldIndex) == i;
+		bKeysAscending &= i == 0 || Layout.ComputeKey(Positions[i - 1]) <= Layout.ComputeKey(Positions[i]);
+	}
+
+	TestTrue(TEXT("Streams gathered by sorted index"), bGathered);
+	TestTrue(TEXT("Reordered positions are in key order"), bKeysAscending);
+	TestTrue(TEXT("Something moved"), Sorter.GetNumMoved() > 0);
+
+	return true;
+}
+
+/**
+ * @brief Particle indices of the simulation module keep addressing the same particle after a Z-order sort and a spawn.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidMortonSortTest_ModuleIndicesSurviveSort::RunTest(const FString& Parameters)
+{
+	constexpr int32 Num = 512;
+	FRandomStream Random(7);
+
+	TStrongObjectPtr<UKawaiiFluidSimulationModule> Module(NewObject<UKawaiiFluidSimulationModule>(GetTransientPackage()));
+	Module->SetCPUSimulationBackend(true);
+
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Positions.Add(FVector(Random.FRandRange(-500.0f, 500.0f), Random.FRandRange(-500.0f, 500.0f), Random.FRandRange(0.0f, 500.0f)));
+		Velocities.Add(FVector::ZeroVector);
+	}
+	TestEqual(TEXT("All particles spawned"), Module->SpawnParticlesBatch(Positions, Velocities), Num);
+
+	// Same reorder as the CPU solver's periodic re-sort
+	TArray<FKawaiiFluidParticle>& Particles = Module->GetParticlesMutable();
+	FKawaiiFluidMortonKeyLayout Layout;
+	Layout.bHybridTiled = true;
+	Layout.CellSize = 20.0f;
+	FKawaiiFluidMortonSorter Sorter;
+	Sorter.Sort(Particles.Num(), Layout, [&Particles](int32 Index) { return FVector3f(Particles[Index].Position); });
+	TArray<FKawaiiFluidParticle> Scratch;
+	Sorter.Reorder(Particles, Scratch);
+	TestTrue(TEXT("Sort moved particles"), Sorter.GetNumMoved() > 0);
+
+	// A spawn after the sort appends the next index
+	const FVector SpawnedPosition(1000.0f, 1000.0f, 1000.0f);
+	Module->SpawnParticlesBatch({ SpawnedPosition }, { FVector::ZeroVector });
+	Positions.Add(SpawnedPosition);
+
+	bool bInfoMatches = true;
+	const TArray<FVector> ReturnedPositions = Module->GetParticlePositions();
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		FVector Position;
+		FVector Velocity;
+		float Density = 0.0f;
+		bInfoMatches &= Module->GetParticleInfo(i, Position, Velocity, Density) && Position == Positions[i]
+			&& ReturnedPositions[i] == Positions[i];
+	}
+	TestTrue(TEXT("GetParticleInfo and GetParticlePositions follow the particle"), bInfoMatches);
+
+	const int32 Probe = Num / 3;
+	const TArray<int32> Found = Module->GetParticlesInRadius(Positions[Probe], 0.01f);
+	TestTrue(TEXT("Radius query returns the particle's index"), Found.Contains(Probe));
+
+	Module->ApplyForceToParticle(Probe, FVector(0.0f, 0.0f, 100.0f));
+	const FKawaiiFluidParticle* Pushed = Particles.FindByPredicate(
+		[Probe](const FKawaiiFluidParticle& Particle) { return Particle.ParticleID == Probe; });
+	TestTrue(TEXT("ApplyForceToParticle reaches the same particle"), Pushed && Pushed->Velocity.Z == 100.0f);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,227 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Core/KawaiiFluidSpatialHash.h"
+#include "Simulation/Physics/KawaiiFluidNeighborForceSolver.h"
+#include "Simulation/Physics/KawaiiFluidViscositySolver.h"
+#include "Simulation/Physics/KawaiiFluidAdhesionSolver.h"
+#include "Simulation/Physics/KawaiiFluidStackPressureSolver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidNeighborForceSolverTest_MatchesSeparateSolvers,
+	"KawaiiFluid.Simulation.NeighborForces.T01_MatchesSeparateSolvers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+//========================================
+// Micro-benchmark (viscosity + cohesion + stack pressure run separately vs fused gather vs fused symmetric)
+// Run with: -ExecCmds="Automation RunTests KawaiiFluid.Performance.Micro.NeighborForces; Quit"
+//========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidNeighborForceSolverTest_MicroBenchmark,
+	"KawaiiFluid.Performance.Micro.NeighborForces",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+namespace
+{
+	constexpr float SmoothingRadius = 20.0f;
+	constexpr float Spacing = 10.0f;
+	constexpr float Viscosity = 0.5f;
+	constexpr float Cohesion = 2.0f;
+	constexpr float StackScale = 100.0f;
+	constexpr float DeltaTime = 1.0f / 120.0f;
+	const FVector Gravity(0.0f, 0.0f, -980.0f);
+
+	/**
+	 * @brief Helper: Jittered block with random velocities; the lower half is attached to a vertical wall.
+	 * @param Side Particles per block edge.
+	 * @return Particles with cached neighbor lists.
+	 */
+	TArray<FKawaiiFluidParticle> MakeScene(int32 Side = 8)
+	{
+		FRandomStream Random(1234);
+		TArray<FKawaiiFluidParticle> Particles;
+
+		for (int32 Z = 0; Z < Side; ++Z)
+		{
+			for (int32 Y = 0; Y < Side; ++Y)
+			{
+				for (int32 X = 0; X < Side; ++X)
+				{
+					const FVector Jitter(Random.FRandRange(-2.0f, 2.0f), Random.FRandRange(-2.0f, 2.0f), Random.FRandRange(-2.0f, 2.0f));
+					FKawaiiFluidParticle& Particle = Particles.Emplace_GetRef(FVector(X, Y, Z) * Spacing + Jitter, Particles.Num());
+					Particle.PredictedPosition = Particle.Position;
+					Particle.Mass = 1.0f;
+					Particle.Velocity = Random.GetUnitVector() * Random.FRandRange(0.0f, 200.0f);
+
+					if (X < Side / 2)
+					{
+						Particle.bIsAttached = true;
+						Particle.AttachedSurfaceNormal = FVector(1.0f, 0.0f, 0.0f);
+					}
+				}
+			}
+		}
+
+		TArray<FVector> Positions;
+		for (const FKawaiiFluidParticle& Particle : Particles)
+		{
+			Positions.Add(Particle.Position);
+		}
+
+		FKawaiiFluidSpatialHash SpatialHash(SmoothingRadius);
+		SpatialHash.BuildFromPositions(Positions);
+		for (FKawaiiFluidParticle& Particle : Particles)
+		{
+			SpatialHash.GetNeighbors(Particle.Position, SmoothingRadius, Particle.NeighborIndices);
+		}
+
+		return Particles;
+	}
+
+	/**
+	 * @brief Helper: Largest velocity difference between two particle arrays.
+	 * @param A First particle array.
+	 * @param B Second particle array.
+	 * @return Maximum |vA - vB| (cm/s).
+	 */
+	float MaxVelocityDifference(const TArray<FKawaiiFluidParticle>& A, const TArray<FKawaiiFluidParticle>& B)
+	{
+		float MaxDiff = 0.0f;
+		for (int32 i = 0; i < A.Num(); ++i)
+		{
+			MaxDiff = FMath::Max(MaxDiff, static_cast<float>(FVector::Dist(A[i].Velocity, B[i].Velocity)));
+		}
+		return MaxDiff;
+	}
+}
+
+/**
+ * @brief Fused gather and symmetric half-pair passes reproduce viscosity + cohesion + stack pressure run separately.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidNeighborForceSolverTest_MatchesSeparateSolvers::RunTest(const FString& Parameters)
+{
+	const TArray<FKawaiiFluidParticle> Initial = MakeScene();
+
+	// Reference: the three solvers in SimulateSubstep order
+	TArray<FKawaiiFluidParticle> Reference = Initial;
+	FKawaiiFluidViscositySolver().ApplyXSPH(Reference, Viscosity, SmoothingRadius);
+	FKawaiiFluidAdhesionSolver().ApplyCohesion(Reference, Cohesion, SmoothingRadius);
+	FKawaiiFluidStackPressureSolver().Apply(Reference, Gravity, StackScale, SmoothingRadius, DeltaTime);
+
+	const float ReferenceChange = MaxVelocityDifference(Initial, Reference);
+	TestTrue(TEXT("Reference solvers change velocities"), ReferenceChange > 1.0f);
+
+	FKawaiiFluidNeighborForceParams Params;
+	Params.SmoothingRadius = SmoothingRadius;
+	Params.ViscosityCoeff = Viscosity;
+	Params.CohesionStrength = Cohesion;
+	Params.bStackPressure = true;
+	Params.Gravity = Gravity;
+	Params.StackPressureScale = StackScale;
+	Params.StackPressureRadius = SmoothingRadius;
+	Params.DeltaTime = DeltaTime;
+
+	const float Tolerance = FMath::Max(1.0e-3f, ReferenceChange * 1.0e-4f);
+	FKawaiiFluidNeighborForceSolver Solver;
+
+	TArray<FKawaiiFluidParticle> Gathered = Initial;
+	Solver.Apply(Gathered, Params, false);
+	TestTrue(FString::Printf(TEXT("Gather pass matches (max diff %.6f)"), MaxVelocityDifference(Reference, Gathered)),
+		MaxVelocityDifference(Reference, Gathered) <= Tolerance);
+
+	TArray<FKawaiiFluidParticle> Symmetric = Initial;
+	Solver.Apply(Symmetric, Params, true);
+	TestTrue(FString::Printf(TEXT("Symmetric pass matches (max diff %.6f)"), MaxVelocityDifference(Reference, Symmetric)),
+		MaxVelocityDifference(Reference, Symmetric) <= Tolerance);
+
+	// Buffers are reused: a second run on fresh input gives the same result
+	TArray<FKawaiiFluidParticle> Repeated = Initial;
+	Solver.Apply(Repeated, Params, true);
+	TestTrue(TEXT("Reused accumulators are cleared"), MaxVelocityDifference(Symmetric, Repeated) <= 1.0e-5f);
+
+	// Large enough to split into several task ranges, so pairs crossing a range boundary are buffered
+	const TArray<FKawaiiFluidParticle> LargeInitial = MakeScene(16);
+
+	TArray<FKawaiiFluidParticle> LargeGathered = LargeInitial;
+	Solver.Apply(LargeGathered, Params, false);
+
+	TArray<FKawaiiFluidParticle> LargeSymmetric = LargeInitial;
+	Solver.Apply(LargeSymmetric, Params, true);
+	TestTrue(FString::Printf(TEXT("Symmetric pass matches across task ranges (max diff %.6f)"), MaxVelocityDifference(LargeGathered, LargeSymmetric)),
+		MaxVelocityDifference(LargeGathered, LargeSymmetric) <= FMath::Max(1.0e-3f, MaxVelocityDifference(LargeInitial, LargeGathered) * 1.0e-4f));
+
+	return true;
+}
+
+/**
+ * @brief Time the three separate solvers against the fused gather and symmetric sweeps at 4k, 32k and 110k particles.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidNeighborForceSolverTest_MicroBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumIterations = 10;
+
+	FKawaiiFluidNeighborForceParams Params;
+	Params.SmoothingRadius = SmoothingRadius;
+	Params.ViscosityCoeff = Viscosity;
+	Params.CohesionStrength = Cohesion;
+	Params.bStackPressure = true;
+	Params.Gravity = Gravity;
+	Params.StackPressureScale = StackScale;
+	Params.StackPressureRadius = SmoothingRadius;
+	Params.DeltaTime = DeltaTime;
+
+	FKawaiiFluidViscositySolver ViscositySolver;
+	FKawaiiFluidAdhesionSolver AdhesionSolver;
+	FKawaiiFluidStackPressureSolver StackPressureSolver;
+	FKawaiiFluidNeighborForceSolver FusedSolver;
+
+	for (const int32 Side : { 16, 32, 48 })
+	{
+		const TArray<FKawaiiFluidParticle> Initial = MakeScene(Side);
+
+		double SeparateMs = 0.0;
+		double GatherMs = 0.0;
+		double SymmetricMs = 0.0;
+		TArray<FKawaiiFluidParticle> Working;
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Working = Initial;
+			uint64 StartCycles = FPlatformTime::Cycles64();
+			ViscositySolver.ApplyXSPH(Working, Viscosity, SmoothingRadius);
+			AdhesionSolver.ApplyCohesion(Working, Cohesion, SmoothingRadius);
+			StackPressureSolver.Apply(Working, Gravity, StackScale, SmoothingRadius, DeltaTime);
+			SeparateMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+			Working = Initial;
+			StartCycles = FPlatformTime::Cycles64();
+			FusedSolver.Apply(Working, Params, false);
+			GatherMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+			Working = Initial;
+			StartCycles = FPlatformTime::Cycles64();
+			FusedSolver.Apply(Working, Params, true);
+			SymmetricMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		}
+
+		SeparateMs /= NumIterations;
+		GatherMs /= NumIterations;
+		SymmetricMs /= NumIterations;
+		AddInfo(FString::Printf(TEXT("NeighborForces %7d particles: separate %.3f ms, fused gather %.3f ms (x%.2f), fused symmetric %.3f ms (x%.2f)"),
+			Initial.Num(), SeparateMs,
+			GatherMs, GatherMs > 0.0 ? SeparateMs / GatherMs : 0.0,
+			SymmetricMs, SymmetricMs > 0.0 ? SeparateMs / SymmetricMs : 0.0));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,183 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Utils/KawaiiFluidReadbackLayout.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackLayoutTest_Strides,
+	"KawaiiFluid.Simulation.ReadbackLayout.T01_Strides",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackLayoutTest_LosslessRoundTrip,
+	"KawaiiFluid.Simulation.ReadbackLayout.T02_LosslessRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackLayoutTest_QuantizedRoundTrip,
+	"KawaiiFluid.Simulation.ReadbackLayout.T03_QuantizedRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Random particles covering every packed field (more than one unpack chunk).
+	 * @param NumParticles Number of particles.
+	 * @return Particles.
+	 */
+	TArray<FGPUFluidParticle> MakeParticles(int32 NumParticles)
+	{
+		FRandomStream Random(4321);
+		TArray<FGPUFluidParticle> Particles;
+		Particles.SetNum(NumParticles);
+
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			FGPUFluidParticle& Particle = Particles[i];
+			Particle.Position = FVector3f(Random.FRandRange(-5000.0f, 5000.0f), Random.FRandRange(-5000.0f, 5000.0f), Random.FRandRange(0.0f, 2000.0f));
+			Particle.Velocity = FVector3f(Random.FRandRange(-800.0f, 800.0f), Random.FRandRange(-800.0f, 800.0f), Random.FRandRange(-800.0f, 800.0f));
+			Particle.Density = Random.FRandRange(800.0f, 1200.0f);
+			Particle.Mass = Random.FRandRange(0.5f, 2.0f);
+			Particle.ParticleID = i * 7 + 3;
+			Particle.SourceID = (i % 5) - 1;
+			Particle.Flags = static_cast<uint32>(Random.RandRange(0, 0xFF));
+			Particle.NeighborCount = static_cast<uint32>(Random.RandRange(0, 120));
+		}
+		return Particles;
+	}
+}
+
+/**
+ * @brief Record strides follow the field mask, and quantization folds the 16-bit pairs into shared words.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidReadbackLayoutTest_Strides::RunTest(const FString& Parameters)
+{
+	using namespace EKawaiiFluidReadbackField;
+
+	TestTrue(TEXT("Empty mask has no record"), FKawaiiFluidReadbackLayout::Build(None, false).IsEmpty());
+	TestEqual(TEXT("Position only is 12 bytes"), FKawaiiFluidReadbackLayout::Build(Position, false).GetStrideBytes(), 12);
+	TestEqual(TEXT("Shadow set is 28 bytes"), FKawaiiFluidReadbackLayout::Build(ShadowSet, false).GetStrideBytes(), 28);
+	TestEqual(TEXT("All fields are 12 words"), FKawaiiFluidReadbackLayout::Build(All, false).StrideWords, 12);
+	TestEqual(TEXT("Quantized position, velocity and flags are 6 words"), FKawaiiFluidReadbackLayout::Build(Position | Velocity | Flags, true).StrideWords, 6);
+	TestEqual(TEXT("Quantized proxy set is 7 words"), FKawaiiFluidReadbackLayout::Build(ProxySet, true).StrideWords, 7);
+	TestEqual(TEXT("Quantized all fields are 9 words"), FKawaiiFluidReadbackLayout::Build(All, true).StrideWords, 9);
+
+	const FKawaiiFluidReadbackLayout Quantized = FKawaiiFluidReadbackLayout::Build(Flags | NeighborCount, true);
+	const FKawaiiFluidReadbackFieldSlot* FlagsSlot = Quantized.FindSlot(Flags);
+	const FKawaiiFluidReadbackFieldSlot* NeighborSlot = Quantized.FindSlot(NeighborCount);
+	TestTrue(TEXT("Both halves have slots"), FlagsSlot != nullptr && NeighborSlot != nullptr);
+	if (FlagsSlot && NeighborSlot)
+	{
+		TestEqual(TEXT("Flags and neighbor count share one word"), FlagsSlot->WordOffset, NeighborSlot->WordOffset);
+		TestTrue(TEXT("Flags in the low half"), FlagsSlot->Encoding == EKawaiiFluidReadbackEncoding::Low16);
+		TestTrue(TEXT("Neighbor count in the high half"), NeighborSlot->Encoding == EKawaiiFluidReadbackEncoding::High16);
+	}
+	TestTrue(TEXT("Missing field has no slot"), Quantized.FindSlot(Position) == nullptr);
+
+	return true;
+}
+
+/**
+ * @brief Unquantized records unpack bit-exactly, and columns of unrequested fields come back empty.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidReadbackLayoutTest_LosslessRoundTrip::RunTest(const FString& Parameters)
+{
+	const TArray<FGPUFluidParticle> Particles = MakeParticles(10000);
+
+	const FKawaiiFluidReadbackLayout Layout = FKawaiiFluidReadbackLayout::Build(EKawaiiFluidReadbackField::All, false);
+	TArray<uint32> Records;
+	FKawaiiFluidReadbackUnpacker::Pack(Layout, Particles, Records);
+	TestEqual(TEXT("Record buffer size"), Records.Num(), Particles.Num() * Layout.StrideWords);
+
+	FKawaiiFluidReadbackColumns Columns;
+	FKawaiiFluidReadbackUnpacker::Unpack(Layout, Records.GetData(), Particles.Num(), Columns);
+
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		const FGPUFluidParticle& Particle = Particles[i];
+		Mismatches += Columns.Positions[i] != Particle.Position;
+		Mismatches += Columns.Velocities[i] != Particle.Velocity;
+		Mismatches += Columns.ParticleIDs[i] != Particle.ParticleID;
+		Mismatches += Columns.SourceIDs[i] != Particle.SourceID;
+		Mismatches += Columns.Flags[i] != Particle.Flags;
+		Mismatches += Columns.NeighborCounts[i] != Particle.NeighborCount;
+		Mismatches += Columns.Densities[i] != Particle.Density;
+		Mismatches += Columns.Masses[i] != Particle.Mass;
+	}
+	TestEqual(TEXT("All fields round-trip exactly"), Mismatches, 0);
+
+	// Reusing the columns with a narrower layout empties the dropped fields
+	const FKawaiiFluidReadbackLayout ShadowLayout = FKawaiiFluidReadbackLayout::Build(EKawaiiFluidReadbackField::ShadowSet, false);
+	FKawaiiFluidReadbackUnpacker::Pack(ShadowLayout, Particles, Records);
+	FKawaiiFluidReadbackUnpacker::Unpack(ShadowLayout, Records.GetData(), Particles.Num(), Columns);
+
+	TestEqual(TEXT("Positions sized"), Columns.Positions.Num(), Particles.Num());
+	TestEqual(TEXT("Neighbor counts sized"), Columns.NeighborCounts.Num(), Particles.Num());
+	TestEqual(TEXT("Particle IDs dropped"), Columns.ParticleIDs.Num(), 0);
+	TestEqual(TEXT("Flags dropped"), Columns.Flags.Num(), 0);
+	TestEqual(TEXT("Densities dropped"), Columns.Densities.Num(), 0);
+	TestEqual(TEXT("Last neighbor count"), Columns.NeighborCounts.Last(), Particles.Last().NeighborCount);
+
+	return true;
+}
+
+/**
+ * @brief Quantized records keep positions, IDs and 16-bit pairs exact and halves within half-float precision.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidReadbackLayoutTest_QuantizedRoundTrip::RunTest(const FString& Parameters)
+{
+	const TArray<FGPUFluidParticle> Particles = MakeParticles(5000);
+
+	const FKawaiiFluidReadbackLayout Layout = FKawaiiFluidReadbackLayout::Build(EKawaiiFluidReadbackField::All, true);
+	TArray<uint32> Records;
+	FKawaiiFluidReadbackUnpacker::Pack(Layout, Particles, Records);
+
+	FKawaiiFluidReadbackColumns Columns;
+	FKawaiiFluidReadbackUnpacker::Unpack(Layout, Records.GetData(), Particles.Num(), Columns);
+
+	int32 ExactMismatches = 0;
+	float MaxVelocityError = 0.0f;
+	float MaxDensityError = 0.0f;
+	float MaxMassError = 0.0f;
+	for (int32 i = 0; i < Particles.Num(); ++i)
+	{
+		const FGPUFluidParticle& Particle = Particles[i];
+		ExactMismatches += Columns.Positions[i] != Particle.Position;
+		ExactMismatches += Columns.ParticleIDs[i] != Particle.ParticleID;
+		ExactMismatches += Columns.SourceIDs[i] != Particle.SourceID;
+		ExactMismatches += Columns.Flags[i] != Particle.Flags;
+		ExactMismatches += Columns.NeighborCounts[i] != Particle.NeighborCount;
+
+		// Half floats keep 11 significant bits: relative error <= 2^-11
+		const FVector3f VelocityError = (Columns.Velocities[i] - Particle.Velocity).GetAbs();
+		MaxVelocityError = FMath::Max(MaxVelocityError, VelocityError.GetMax() / FMath::Max(Particle.Velocity.GetAbsMax(), 1.0f));
+		MaxDensityError = FMath::Max(MaxDensityError, FMath::Abs(Columns.Densities[i] - Particle.Density) / Particle.Density);
+		MaxMassError = FMath::Max(MaxMassError, FMath::Abs(Columns.Masses[i] - Particle.Mass) / Particle.Mass);
+	}
+
+	TestEqual(TEXT("Unquantized fields stay exact"), ExactMismatches, 0);
+	TestTrue(FString::Printf(TEXT("Velocity within half precision (%.6f)"), MaxVelocityError), MaxVelocityError <= 1.0e-3f);
+	TestTrue(FString::Printf(TEXT("Density within half precision (%.6f)"), MaxDensityError), MaxDensityError <= 1.0e-3f);
+	TestTrue(FString::Printf(TEXT("Mass within half precision (%.6f)"), MaxMassError), MaxMassError <= 1.0e-3f);
+
+	// 16-bit halves saturate instead of wrapping
+	TArray<FGPUFluidParticle> Saturated = MakeParticles(1);
+	Saturated[0].NeighborCount = 70000;
+	FKawaiiFluidReadbackUnpacker::Pack(Layout, Saturated, Records);
+	FKawaiiFluidReadbackUnpacker::Unpack(Layout, Records.GetData(), 1, Columns);
+	TestEqual(TEXT("Neighbor count saturates"), Columns.NeighborCounts[0], 0xFFFFu);
+	TestEqual(TEXT("Shared flags half untouched"), Columns.Flags[0], Saturated[0].Flags);
+
+	return true;
+}
+
+#endif
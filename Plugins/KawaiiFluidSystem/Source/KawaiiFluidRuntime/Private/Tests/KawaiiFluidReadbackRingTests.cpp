@@ -0,0 +1,190 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Simulation/Utils/KawaiiFluidReadbackRing.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackRingTest_NewestDropsStale,
+	"KawaiiFluid.Simulation.ReadbackRing.T01_NewestDropsStale",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackRingTest_OldestInOrder,
+	"KawaiiFluid.Simulation.ReadbackRing.T02_OldestInOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidReadbackRingTest_AdaptiveDepth,
+	"KawaiiFluid.Simulation.ReadbackRing.T03_AdaptiveDepth",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Stand-in for FRHIGPUBufferReadback whose readiness the test controls.
+	 */
+	struct FMockReadback
+	{
+		explicit FMockReadback(FName InName)
+			: Name(InName)
+		{
+		}
+
+		bool IsReady() const { return bReady; }
+
+		FName Name;
+
+		bool bReady = false;
+	};
+
+	constexpr int32 MockMaxDepth = 5;
+
+	using FMockRing = TKawaiiFluidReadbackRing<FMockReadback, int32, MockMaxDepth>;
+
+	/**
+	 * @brief Helper: Enqueue a readback on Frame carrying Frame as payload.
+	 * @return Written slot.
+	 */
+	int32 Write(FMockRing& Ring, uint64 Frame)
+	{
+		const int32 Slot = Ring.BeginWrite(Frame);
+		Ring.GetReadback(Slot).bReady = false;
+		Ring.GetPayload(Slot) = static_cast<int32>(Frame);
+		return Slot;
+	}
+}
+
+/**
+ * @brief Newest policy hands out the latest ready readback and counts older ready ones as stale drops.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidReadbackRingTest_NewestDropsStale::RunTest(const FString& Parameters)
+{
+	FMockRing Ring(TEXT("MockNewest"), EKawaiiFluidReadbackConsumePolicy::Newest);
+	TestEqual(TEXT("Nothing ready on an empty ring"), Ring.FindReadySlot(), static_cast<int32>(INDEX_NONE));
+
+	const int32 Slot1 = Write(Ring, 1);
+	const int32 Slot2 = Write(Ring, 2);
+	const int32 Slot3 = Write(Ring, 3);
+	TestEqual(TEXT("Three in flight"), Ring.GetStats().FramesInFlight, 3);
+	TestTrue(TEXT("Readback objects are named per slot"), Ring.GetReadback(Slot2).Name == FName(TEXT("MockNewest_1")));
+
+	// Frames 1 and 2 land, 3 is still in flight
+	Ring.GetReadback(Slot1).bReady = true;
+	Ring.GetReadback(Slot2).bReady = true;
+
+	const int32 ReadSlot = Ring.FindReadySlot();
+	TestEqual(TEXT("Newest ready readback is picked"), ReadSlot, Slot2);
+	TestEqual(TEXT("Payload travels with the slot"), Ring.GetPayload(ReadSlot), 2);
+	TestEqual(TEXT("Older ready readback dropped as stale"), Ring.GetStats().NumDroppedStale, static_cast<uint64>(1));
+
+	Ring.Consume(ReadSlot, 5);
+	TestEqual(TEXT("Age recorded"), Ring.GetStats().LastAge, 3);
+	TestEqual(TEXT("Age histogram bucket"), Ring.GetStats().AgeHistogram[3], static_cast<uint64>(1));
+	TestEqual(TEXT("Only frame 3 still in flight"), Ring.GetStats().FramesInFlight, 1);
+
+	// The in-flight readback survives and is consumed once it lands
+	Ring.GetReadback(Slot3).bReady = true;
+	TestEqual(TEXT("Newer in-flight readback survived"), Ring.FindReadySlot(), Slot3);
+	Ring.Consume(Slot3, 5);
+	TestEqual(TEXT("Consumed count"), Ring.GetStats().NumConsumed, static_cast<uint64>(2));
+	TestEqual(TEXT("Median age"), Ring.GetStats().GetAgePercentile(0.5f), 2);
+
+	return true;
+}
+
+/**
+ * @brief Oldest policy consumes every readback in enqueue order without dropping any.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidReadbackRingTest_OldestInOrder::RunTest(const FString& Parameters)
+{
+	FMockRing Ring(TEXT("MockOldest"), EKawaiiFluidReadbackConsumePolicy::Oldest);
+
+	TArray<int32> Slots;
+	for (uint64 Frame = 10; Frame < 13; ++Frame)
+	{
+		Slots.Add(Write(Ring, Frame));
+	}
+	for (const int32 Slot : Slots)
+	{
+		Ring.GetReadback(Slot).bReady = true;
+	}
+
+	TArray<int32> ConsumedFrames;
+	for (int32 ReadSlot = Ring.FindReadySlot(); ReadSlot != INDEX_NONE; ReadSlot = Ring.FindReadySlot())
+	{
+		ConsumedFrames.Add(Ring.GetPayload(ReadSlot));
+		Ring.Consume(ReadSlot, 14);
+	}
+
+	TestEqual(TEXT("All consumed"), ConsumedFrames.Num(), 3);
+	TestTrue(TEXT("In enqueue order"), ConsumedFrames == TArray<int32>({ 10, 11, 12 }));
+	TestEqual(TEXT("Nothing dropped"), Ring.GetStats().GetNumDropped(), static_cast<uint64>(0));
+	TestFalse(TEXT("Ring drained"), Ring.HasPending());
+
+	// A rejected readback is freed and counted separately
+	const int32 Rejected = Write(Ring, 20);
+	Ring.GetReadback(Rejected).bReady = true;
+	Ring.Discard(Ring.FindReadySlot());
+	TestEqual(TEXT("Discard counted"), Ring.GetStats().NumDiscarded, static_cast<uint64>(1));
+	TestFalse(TEXT("Discarded slot freed"), Ring.HasPending());
+
+	return true;
+}
+
+/**
+ * @brief A slow consumer grows the ring up to its cap before overruns, and an idle ring shrinks back.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidReadbackRingTest_AdaptiveDepth::RunTest(const FString& Parameters)
+{
+	FMockRing Ring(TEXT("MockAdaptive"), EKawaiiFluidReadbackConsumePolicy::Oldest, 3);
+	TestEqual(TEXT("Initial depth"), Ring.GetDepth(), 3);
+
+	// Nothing lands for 7 frames: 3 fit, 2 grow the ring to its cap, 2 overrun
+	uint64 Frame = 1;
+	for (; Frame <= 7; ++Frame)
+	{
+		Write(Ring, Frame);
+	}
+	TestEqual(TEXT("Grown to the cap"), Ring.GetDepth(), MockMaxDepth);
+	TestEqual(TEXT("Overruns only past the cap"), Ring.GetStats().NumDroppedOverrun, static_cast<uint64>(2));
+	TestEqual(TEXT("Max in flight"), Ring.GetStats().MaxFramesInFlight, MockMaxDepth);
+
+	// Drain, then run a fast consumer (every readback lands and is read the next frame)
+	for (int32 Slot = 0; Slot < MockMaxDepth; ++Slot)
+	{
+		Ring.GetReadback(Slot).bReady = true;
+	}
+	for (int32 ReadSlot = Ring.FindReadySlot(); ReadSlot != INDEX_NONE; ReadSlot = Ring.FindReadySlot())
+	{
+		Ring.Consume(ReadSlot, Frame);
+	}
+
+	for (int32 Step = 0; Step < FMockRing::ShrinkAfterWrites * MockMaxDepth; ++Step, ++Frame)
+	{
+		const int32 Slot = Write(Ring, Frame);
+		Ring.GetReadback(Slot).bReady = true;
+		Ring.Consume(Ring.FindReadySlot(), Frame + 1);
+	}
+	TestEqual(TEXT("Idle ring shrinks to the minimum"), Ring.GetDepth(), FMockRing::MinDepth);
+	TestEqual(TEXT("Fast consumer sees one-frame age"), Ring.GetStats().LastAge, 1);
+
+	// Fixed-depth mode overwrites instead of growing
+	FMockRing Fixed(TEXT("MockFixed"), EKawaiiFluidReadbackConsumePolicy::Newest, 2);
+	Fixed.SetAdaptive(false);
+	for (uint64 FixedFrame = 1; FixedFrame <= 4; ++FixedFrame)
+	{
+		Write(Fixed, FixedFrame);
+	}
+	TestEqual(TEXT("Fixed depth does not grow"), Fixed.GetDepth(), 2);
+	TestEqual(TEXT("Fixed depth overruns"), Fixed.GetStats().NumDroppedOverrun, static_cast<uint64>(2));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,204 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Rendering/KawaiiFluidShadowClustering.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_ThinStream,
+	"KawaiiFluid.Rendering.ShadowClustering.C01_ThinStreamKept",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_DensePool,
+	"KawaiiFluid.Rendering.ShadowClustering.C02_DensePoolCollapsed",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_DistanceLOD,
+	"KawaiiFluid.Rendering.ShadowClustering.C03_DistanceLOD",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidShadowClusterTest_CellBoundary,
+	"KawaiiFluid.Rendering.ShadowClustering.C04_CellKeyMatchesOrigin",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Helper: Fill a box with particles on a regular lattice.
+	 * @param Min Lower corner of the box.
+	 * @param Count Particles per axis.
+	 * @param Spacing Lattice spacing (cm).
+	 * @param OutPositions Appended positions.
+	 */
+	void AddLattice(const FVector& Min, const FIntVector& Count, float Spacing, TArray<FVector>& OutPositions)
+	{
+		for (int32 z = 0; z < Count.Z; ++z)
+		{
+			for (int32 y = 0; y < Count.Y; ++y)
+			{
+				for (int32 x = 0; x < Count.X; ++x)
+				{
+					OutPositions.Add(Min + FVector(x, y, z) * Spacing);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief A sparse stream keeps one instance per particle at the particle radius (no thinning).
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidShadowClusterTest_ThinStream::RunTest(const FString& Parameters)
+{
+	constexpr float Radius = 5.0f;
+
+	// Particles 100 cm apart: every particle lands in its own 20 cm voxel
+	TArray<FVector> Positions;
+	for (int32 i = 0; i < 16; ++i)
+	{
+		Positions.Add(FVector(i * 100.0f + 1.0f, 1.0f, 1.0f));
+	}
+
+	FKawaiiFluidShadowClusterSettings Settings;
+	Settings.LODDistance = 0.0f;
+
+	TArray<FTransform> Transforms;
+	FKawaiiFluidShadowClustering::BuildClusters(Positions.GetData(), Positions.Num(), Radius, Settings, nullptr, Transforms);
+
+	TestEqual(TEXT("One instance per isolated particle"), Transforms.Num(), Positions.Num());
+	for (const FTransform& Transform : Transforms)
+	{
+		TestEqual(TEXT("Isolated instance uses the particle radius"),
+			Transform.GetScale3D().X, static_cast<double>(Radius / FKawaiiFluidShadowClustering::ShadowMeshRadius), 1e-4);
+	}
+
+	return true;
+}
+
+/**
+ * @brief A dense block collapses to one instance per voxel, and the instances still cover the block.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidShadowClusterTest_DensePool::RunTest(const FString& Parameters)
+{
+	constexpr float Radius = 5.0f;
+	constexpr float Spacing = 10.0f;
+
+	// 40x40x10 lattice (16000 particles) spanning 400x400x100 cm, large enough to cluster in parallel
+	TArray<FVector> Positions;
+	AddLattice(FVector(0.5f), FIntVector(40, 40, 10), Spacing, Positions);
+
+	FKawaiiFluidShadowClusterSettings Settings;
+	Settings.CellSizeInRadii = 4.0f;  // 20 cm voxels -> 2x2x2 particles each
+	Settings.LODDistance = 0.0f;
+
+	TArray<FTransform> Transforms;
+	FKawaiiFluidShadowClustering::BuildClusters(Positions.GetData(), Positions.Num(), Radius, Settings, nullptr, Transforms);
+
+	TestEqual(TEXT("One instance per occupied voxel"), Transforms.Num(), 20 * 20 * 5);
+
+	FBox InstanceBounds(ForceInit);
+	for (const FTransform& Transform : Transforms)
+	{
+		const FVector Extent = Transform.GetScale3D() * FKawaiiFluidShadowClustering::ShadowMeshRadius;
+		TestTrue(TEXT("Cluster extent grows beyond a single particle"), Extent.X > Radius);
+		TestTrue(TEXT("Cluster extent stays within half a voxel plus radius"), Extent.X <= 10.0f + Radius + 1e-3);
+		InstanceBounds += FBox(Transform.GetLocation() - Extent, Transform.GetLocation() + Extent);
+	}
+
+	FBox ParticleBounds(Positions);
+	ParticleBounds = ParticleBounds.ExpandBy(Radius);
+	TestTrue(TEXT("Clusters cover the particle bounds"), InstanceBounds.ExpandBy(1e-3).IsInside(ParticleBounds));
+
+	// Deterministic output for identical input (allows frame-to-frame caching)
+	TArray<FTransform> Again;
+	FKawaiiFluidShadowClustering::BuildClusters(Positions.GetData(), Positions.Num(), Radius, Settings, nullptr, Again);
+	TestEqual(TEXT("Repeatable instance count"), Again.Num(), Transforms.Num());
+
+	return true;
+}
+
+/**
+ * @brief Voxels coarsen with camera distance, so distant fluid needs fewer instances.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidShadowClusterTest_DistanceLOD::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidShadowClusterSettings Settings;
+	Settings.LODDistance = 1000.0f;
+	Settings.MaxLODLevel = 3;
+
+	TestEqual(TEXT("Near -> LOD 0"), Settings.GetLODLevel(500.0f), 0);
+	TestEqual(TEXT("1x LOD distance -> LOD 1"), Settings.GetLODLevel(1000.0f), 1);
+	TestEqual(TEXT("2x LOD distance -> LOD 2"), Settings.GetLODLevel(2500.0f), 2);
+	TestEqual(TEXT("Far -> clamped to max level"), Settings.GetLODLevel(100000.0f), 3);
+
+	constexpr float Radius = 5.0f;
+	TArray<FVector> Positions;
+	AddLattice(FVector(0.5f), FIntVector(16, 16, 4), 10.0f, Positions);
+
+	const FVector NearView(80.0f, 80.0f, 200.0f);
+	const FVector FarView(80.0f, 80.0f, 20000.0f);
+
+	TArray<FTransform> Near;
+	TArray<FTransform> Far;
+	FKawaiiFluidShadowClustering::BuildClusters(Positions.GetData(), Positions.Num(), Radius, Settings, &NearView, Near);
+	FKawaiiFluidShadowClustering::BuildClusters(Positions.GetData(), Positions.Num(), Radius, Settings, &FarView, Far);
+
+	TestTrue(TEXT("Distant view produces fewer instances"), Far.Num() < Near.Num());
+	TestTrue(TEXT("Distant view still produces instances"), Far.Num() > 0);
+
+	// A view move far below the LOD distance still moves a particle near a band edge into the next band
+	const FVector EdgePositions[] = { FVector(995.0f, 0.0f, 0.0f), FVector(500.0f, 0.0f, 0.0f) };
+	TArray<uint8> Levels;
+	TArray<uint8> MovedLevels;
+	FKawaiiFluidShadowClustering::ComputeLODLevels(EdgePositions, 2, Settings, FVector::ZeroVector, Levels);
+	FKawaiiFluidShadowClustering::ComputeLODLevels(EdgePositions, 2, Settings, FVector(-10.0f, 0.0f, 0.0f), MovedLevels);
+	TestEqual(TEXT("One level per particle"), Levels.Num(), 2);
+	TestEqual(TEXT("Edge particle starts in LOD 0"), static_cast<int32>(Levels[0]), 0);
+	TestEqual(TEXT("Edge particle crosses into LOD 1"), static_cast<int32>(MovedLevels[0]), 1);
+	TestEqual(TEXT("Interior particle keeps its band"), static_cast<int32>(MovedLevels[1]), 0);
+
+	return true;
+}
+
+/**
+ * @brief Positions just around cell boundaries get the key of the cell whose origin they lie in.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidShadowClusterTest_CellBoundary::RunTest(const FString& Parameters)
+{
+	// 1 / 30 is not exact in float, so a float reciprocal and a double divide disagree near multiples of 30
+	constexpr float CellSize = 30.0f;
+	for (int32 Cell = -200; Cell <= 200; ++Cell)
+	{
+		const double Boundary = static_cast<double>(Cell) * CellSize;
+		for (const double Offset : { -1e-4, 0.0, 1e-4 })
+		{
+			const FVector Position(Boundary + Offset, Boundary - Offset, Boundary);
+			const FIntVector Coord = FKawaiiFluidShadowClustering::GetCellCoord(Position, CellSize);
+			const FVector Origin = FVector(Coord) * static_cast<double>(CellSize);
+
+			if (!TestTrue(TEXT("Position inside its voxel"),
+				Position.X >= Origin.X && Position.X < Origin.X + CellSize &&
+				Position.Y >= Origin.Y && Position.Y < Origin.Y + CellSize &&
+				Position.Z >= Origin.Z && Position.Z < Origin.Z + CellSize))
+			{
+				return false;
+			}
+			TestEqual(TEXT("Position key matches coordinate key"),
+				FKawaiiFluidShadowClustering::MakeCellKey(Position, CellSize, 0),
+				FKawaiiFluidShadowClustering::MakeCellKey(Coord, 0));
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,135 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+#include "Simulation/Utils/KawaiiFluidSourceParticleIndex.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSourceParticleIndexTest_MatchesGrouping,
+	"KawaiiFluid.Simulation.SourceParticleIndex.T01_MatchesGrouping",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSourceParticleIndexTest_SteadyStateNoAllocations,
+	"KawaiiFluid.Simulation.SourceParticleIndex.T02_SteadyStateNoAllocations",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr int32 NumSources = 24;
+
+	/**
+	 * @brief Helper: Random readback-ordered SourceIDs (some without a source) and unique ParticleIDs.
+	 * @param NumParticles Number of particles.
+	 * @param Seed Random seed.
+	 * @param OutSourceIDs SourceID per particle.
+	 * @param OutParticleIDs ParticleID per particle.
+	 */
+	void MakeReadback(int32 NumParticles, int32 Seed, TArray<int32>& OutSourceIDs, TArray<int32>& OutParticleIDs)
+	{
+		FRandomStream Random(Seed);
+		OutSourceIDs.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+		OutParticleIDs.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			OutSourceIDs[i] = Random.RandRange(-1, NumSources - 1);
+			OutParticleIDs[i] = Seed * 1000000 + i;
+		}
+	}
+}
+
+/**
+ * @brief The counting sort groups IDs by source in input order, across several chunks, skipping particles without a source.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSourceParticleIndexTest_MatchesGrouping::RunTest(const FString& Parameters)
+{
+	TArray<int32> SourceIDs;
+	TArray<int32> ParticleIDs;
+	MakeReadback(FKawaiiFluidSourceParticleIndex::ChunkSize * 3 + 123, 7, SourceIDs, ParticleIDs);
+
+	// Reference: naive per-source arrays
+	TArray<TArray<int32>> Expected;
+	Expected.SetNum(NumSources);
+	int32 NumWithSource = 0;
+	for (int32 i = 0; i < SourceIDs.Num(); ++i)
+	{
+		if (SourceIDs[i] >= 0)
+		{
+			Expected[SourceIDs[i]].Add(ParticleIDs[i]);
+			++NumWithSource;
+		}
+	}
+
+	FKawaiiFluidSourceParticleIndex Index;
+	Index.Build(SourceIDs, ParticleIDs);
+
+	TestEqual(TEXT("Covers every source slot"), Index.GetNumSources(), NumSources);
+	TestEqual(TEXT("Indexes only particles with a source"), Index.GetNumIndexed(), NumWithSource);
+
+	for (int32 SourceID = 0; SourceID < NumSources; ++SourceID)
+	{
+		const TConstArrayView<int32> IDs = Index.GetParticleIDs(SourceID);
+		TestTrue(FString::Printf(TEXT("Source %d matches in order"), SourceID),
+			IDs.Num() == Expected[SourceID].Num() && FMemory::Memcmp(IDs.GetData(), Expected[SourceID].GetData(), IDs.Num() * sizeof(int32)) == 0);
+	}
+
+	TestEqual(TEXT("Negative source is empty"), Index.GetParticleIDs(-1).Num(), 0);
+	TestEqual(TEXT("Source past the table is empty"), Index.GetParticleIDs(NumSources).Num(), 0);
+
+	// No particle with a source: empty table
+	const TArray<int32> NoSource = { -1, -1, -1 };
+	const TArray<int32> NoSourceIDs = { 1, 2, 3 };
+	Index.Build(NoSource, NoSourceIDs);
+	TestEqual(TEXT("No sources"), Index.GetNumSources(), 0);
+	TestEqual(TEXT("Nothing indexed"), Index.GetNumIndexed(), 0);
+
+	return true;
+}
+
+/**
+ * @brief Benchmark: rebuilding a warm index with the same particle and source counts allocates nothing.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSourceParticleIndexTest_SteadyStateNoAllocations::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumParticles = 200000;
+	constexpr int32 NumFrames = 30;
+
+	TArray<int32> SourceIDs;
+	TArray<int32> ParticleIDs;
+	MakeReadback(NumParticles, 1, SourceIDs, ParticleIDs);
+
+	// Warm-up frame sizes every buffer
+	FKawaiiFluidSourceParticleIndex Index;
+	Index.Build(SourceIDs, ParticleIDs);
+	const SIZE_T WarmSize = Index.GetAllocatedSize();
+
+	int32 NumResized = 0;
+	double TotalSeconds = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		// New readback contents, same shape (the column buffers themselves are reused too)
+		MakeReadback(NumParticles, Frame + 2, SourceIDs, ParticleIDs);
+
+		const int32* DataBefore = Index.GetParticleIDs(0).GetData();
+		const double StartTime = FPlatformTime::Seconds();
+		Index.Build(SourceIDs, ParticleIDs);
+		TotalSeconds += FPlatformTime::Seconds() - StartTime;
+
+		// Per-source counts vary by frame, but the flat buffer and scratch never exceed the warm capacity
+		NumResized += (Index.GetAllocatedSize() != WarmSize || Index.GetParticleIDs(0).GetData() != DataBefore) ? 1 : 0;
+	}
+
+	TestEqual(TEXT("No buffer was reallocated in steady state"), NumResized, 0);
+	AddInfo(FString::Printf(TEXT("SourceParticleIndex: %d particles, %d sources, %.3f ms per build"),
+		NumParticles, NumSources, TotalSeconds * 1000.0 / NumFrames));
+
+	return true;
+}
+
+#endif
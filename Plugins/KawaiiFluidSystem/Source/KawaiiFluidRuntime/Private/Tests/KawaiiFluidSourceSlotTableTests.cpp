@@ -0,0 +1,202 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidSourceSlotTable.h"
+#include "Simulation/Managers/KawaiiFluidParticleLifecycleManager.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSourceSlotTest_AllocateRelease,
+	"KawaiiFluid.Simulation.SourceSlots.T01_AllocateRelease",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSourceSlotTest_PerSourceAccounting,
+	"KawaiiFluid.Simulation.SourceSlots.T02_PerSourceAccounting4096",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSourceSlotTest_ReleaseQuarantine,
+	"KawaiiFluid.Simulation.SourceSlots.T03_ReleaseQuarantine",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr int32 TestSourceCount = 4096;
+}
+
+/**
+ * @brief Slots are dense, unique, reused before the table grows, and capped at MaxSlots.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSourceSlotTest_AllocateRelease::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSourceSlotTable Table(TestSourceCount);
+	TestEqual(TEXT("Empty table uses the minimum capacity"), Table.GetCapacity(), FKawaiiFluidSourceSlotTable::MinSlotCapacity);
+
+	for (int32 i = 0; i < TestSourceCount; ++i)
+	{
+		if (Table.Allocate() != i)
+		{
+			AddError(FString::Printf(TEXT("Fresh allocation %d is not dense"), i));
+			return false;
+		}
+	}
+
+	TestEqual(TEXT("All slots allocated"), Table.GetNumAllocated(), TestSourceCount);
+	TestEqual(TEXT("Full table refuses further allocations"), Table.Allocate(), static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("Capacity covers the high-water mark"), Table.GetCapacity(), TestSourceCount);
+
+	// Release every third slot, then reallocate: a full table reuses released slots instead of failing
+	TSet<int32> Released;
+	for (int32 i = 0; i < TestSourceCount; i += 3)
+	{
+		TestTrue(TEXT("Release allocated slot"), Table.Release(i));
+		Released.Add(i);
+	}
+	TestFalse(TEXT("Double release is rejected"), Table.Release(0));
+	TestFalse(TEXT("Out-of-range release is rejected"), Table.Release(TestSourceCount));
+	TestEqual(TEXT("Allocated count after release"), Table.GetNumAllocated(), TestSourceCount - Released.Num());
+
+	TSet<int32> Reallocated;
+	for (int32 i = 0; i < Released.Num(); ++i)
+	{
+		const int32 Slot = Table.Allocate();
+		TestTrue(TEXT("Reallocated slot was previously released"), Released.Contains(Slot));
+		Reallocated.Add(Slot);
+	}
+	TestEqual(TEXT("Every released slot handed out exactly once"), Reallocated.Num(), Released.Num());
+	TestEqual(TEXT("High-water mark unchanged by reuse"), Table.GetHighWaterMark(), TestSourceCount);
+
+	TestEqual(TEXT("Capacity rounds up to a power of two"), FKawaiiFluidSourceSlotTable::GetCapacityForSlotCount(65), 128);
+
+	Table.Reset();
+	TestEqual(TEXT("Reset restarts at slot 0"), Table.Allocate(), 0);
+
+	return true;
+}
+
+/**
+ * @brief Per-source counts stay exact at 4,096 sources, through both the CPU count and the compacted readback decode.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSourceSlotTest_PerSourceAccounting::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSourceSlotTable Table(EGPUParticleSource::MaxSourceCount);
+
+	TArray<int32> SourceIDs;
+	for (int32 i = 0; i < TestSourceCount; ++i)
+	{
+		SourceIDs.Add(Table.Allocate());
+	}
+
+	// Churn: release and reallocate a block so live IDs are not simply 0..N-1 in order
+	for (int32 i = 1000; i < 1500; ++i)
+	{
+		Table.Release(SourceIDs[i]);
+	}
+	for (int32 i = 1499; i >= 1000; --i)
+	{
+		SourceIDs[i] = Table.Allocate();
+	}
+	TestEqual(TEXT("Churn does not grow the table"), Table.GetHighWaterMark(), TestSourceCount);
+
+	// Source i owns (i % 5) + 1 particles; interleave sources so counts are not contiguous runs
+	TArray<int32> Expected;
+	Expected.SetNumZeroed(Table.GetHighWaterMark());
+	TArray<FGPUFluidParticle> Particles;
+	for (int32 Round = 0; Round < 5; ++Round)
+	{
+		for (int32 i = 0; i < TestSourceCount; ++i)
+		{
+			if (Round <= i % 5)
+			{
+				FGPUFluidParticle& Particle = Particles.AddDefaulted_GetRef();
+				Particle.ParticleID = Particles.Num() - 1;
+				Particle.SourceID = SourceIDs[i];
+				Expected[SourceIDs[i]]++;
+			}
+		}
+	}
+
+	// Unowned particles are ignored
+	Particles.AddDefaulted();
+
+	TArray<int32> Counts;
+	FKawaiiFluidParticleLifecycleManager::CountParticlesPerSource(Particles, Counts);
+	TestEqual(TEXT("Count table covers the highest live SourceID"), Counts.Num(), Table.GetHighWaterMark());
+
+	int32 Mismatches = 0;
+	for (int32 Slot = 0; Slot < FMath::Min(Counts.Num(), Expected.Num()); ++Slot)
+	{
+		Mismatches += (Counts[Slot] != Expected[Slot]) ? 1 : 0;
+	}
+	TestEqual(TEXT("CPU per-source counts match"), Mismatches, 0);
+
+	// Simulated GPU counter buffer at power-of-two capacity; readback copies only the live prefix
+	const int32 Capacity = Table.GetCapacity();
+	TArray<uint32> GPUCounters;
+	GPUCounters.SetNumZeroed(Capacity);
+	for (int32 Slot = 0; Slot < Expected.Num(); ++Slot)
+	{
+		GPUCounters[Slot] = static_cast<uint32>(Expected[Slot]);
+	}
+
+	TArray<int32> Unpacked;
+	FKawaiiFluidParticleLifecycleManager::UnpackSourceCounts(GPUCounters.GetData(), Table.GetHighWaterMark(), Unpacked);
+	TestEqual(TEXT("Compacted readback size"), Unpacked.Num(), Table.GetHighWaterMark());
+	TestTrue(TEXT("Readback round-trips per-source counts"), Unpacked == Expected);
+
+	int32 Total = 0;
+	for (int32 Count : Unpacked)
+	{
+		Total += Count;
+	}
+	TestEqual(TEXT("Total matches owned particles"), Total, Particles.Num() - 1);
+
+	return true;
+}
+
+/**
+ * @brief A released SourceID is not handed to the next source until its quarantine expires, then slots return FIFO.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSourceSlotTest_ReleaseQuarantine::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSourceSlotTable Table(TestSourceCount);
+	for (int32 i = 0; i < 4; ++i)
+	{
+		Table.Allocate();
+	}
+
+	// Release followed by an immediate allocation must not recycle the ID
+	TestTrue(TEXT("Release slot 1"), Table.Release(1));
+	TestEqual(TEXT("Immediate reallocation extends the table"), Table.Allocate(), 4);
+
+	TestTrue(TEXT("Release slot 2"), Table.Release(2));
+	for (uint32 Frame = 1; Frame < FKawaiiFluidSourceSlotTable::ReleaseQuarantineFrames; ++Frame)
+	{
+		Table.AdvanceFrame();
+		TestNotEqual(TEXT("Quarantined slot 1 not reused"), Table.Allocate(), 1);
+	}
+
+	// Oldest release first once quarantine expires
+	Table.AdvanceFrame();
+	Table.AdvanceFrame();
+	TestEqual(TEXT("Expired slot 1 reused first"), Table.Allocate(), 1);
+	TestEqual(TEXT("Expired slot 2 reused second"), Table.Allocate(), 2);
+
+	// A full table reuses the oldest quarantined slot rather than failing
+	FKawaiiFluidSourceSlotTable FullTable(2);
+	FullTable.Allocate();
+	FullTable.Allocate();
+	TestTrue(TEXT("Release slot 0 of full table"), FullTable.Release(0));
+	TestEqual(TEXT("Full table reuses the quarantined slot"), FullTable.Allocate(), 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,327 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+#include "Simulation/Utils/KawaiiFluidSparseBrickGrid.h"
+#include "Simulation/Physics/KawaiiFluidGPUReferenceSolver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSparseBrickGridTest_CellRanges,
+	"KawaiiFluid.Simulation.SparseBrickGrid.T01_CellRanges",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSparseBrickGridTest_DistantClusters,
+	"KawaiiFluid.Simulation.SparseBrickGrid.T02_DistantClusters",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSparseBrickGridTest_MatchesDenseGrid,
+	"KawaiiFluid.Simulation.SparseBrickGrid.T03_MatchesDenseGrid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float CellSize = 20.0f;
+
+	/**
+	 * @brief Helper: Random points in a cube.
+	 * @param Positions Output array (appended).
+	 * @param Num Number of points.
+	 * @param Center Cube center (cm).
+	 * @param HalfExtent Cube half extent (cm).
+	 * @param Random Random stream.
+	 */
+	void AddCluster(TArray<FVector3f>& Positions, int32 Num, const FVector3f& Center, float HalfExtent, FRandomStream& Random)
+	{
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Positions.Add(Center + FVector3f(
+				Random.FRandRange(-HalfExtent, HalfExtent),
+				Random.FRandRange(-HalfExtent, HalfExtent),
+				Random.FRandRange(-HalfExtent, HalfExtent)));
+		}
+	}
+
+	/**
+	 * @brief Helper: Check that every occupied cell brackets exactly its own sorted points.
+	 * @param Grid Built grid.
+	 * @param Sorter Sorter the grid was built with.
+	 * @param Positions Unsorted positions.
+	 * @return True if all cell ranges are exact.
+	 */
+	bool CellRangesAreExact(const FKawaiiFluidSparseBrickGrid& Grid, const FKawaiiFluidMortonSorter& Sorter, const TArray<FVector3f>& Positions)
+	{
+		const TConstArrayView<uint32> SortedIndices = Sorter.GetSortedIndices();
+		for (int32 i = 0; i < SortedIndices.Num(); ++i)
+		{
+			const FIntVector Cell = KawaiiFluidMorton::WorldToCell(Positions[SortedIndices[i]], CellSize);
+			uint32 Start = 0;
+			uint32 End = 0;
+			if (!Grid.FindCell(Cell, Start, End) || Start > static_cast<uint32>(i) || static_cast<uint32>(i) > End)
+			{
+				return false;
+			}
+
+			// Boundaries: the neighbors outside the range belong to other cells
+			if (Start == static_cast<uint32>(i) && i > 0
+				&& KawaiiFluidMorton::WorldToCell(Positions[SortedIndices[i - 1]], CellSize) == Cell)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+/**
+ * @brief Cell ranges are exact for 4³ and 8³ bricks, across negative coordinates and far-apart clusters.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSparseBrickGridTest_CellRanges::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(11);
+	TArray<FVector3f> Positions;
+	AddCluster(Positions, 4000, FVector3f::ZeroVector, 200.0f, Random);
+	AddCluster(Positions, 4000, FVector3f(1.0e6f, -1.0e6f, 5.0e5f), 150.0f, Random);
+
+	for (const int32 BrickBits : { 2, 3 })
+	{
+		FKawaiiFluidSparseBrickGrid Grid;
+		FKawaiiFluidMortonSorter Sorter;
+		Grid.SetLayout(CellSize, BrickBits);
+		Grid.Build(Positions.Num(), [&Positions](int32 Index) { return Positions[Index]; }, Sorter);
+
+		TSet<FIntVector> Cells;
+		TSet<FIntVector> Bricks;
+		for (const FVector3f& Position : Positions)
+		{
+			const FIntVector Cell = KawaiiFluidMorton::WorldToCell(Position, CellSize);
+			Cells.Add(Cell);
+			Bricks.Add(Grid.GetBrickCoord(Cell));
+		}
+
+		int32 NumOccupiedCells = 0;
+		for (const FIntVector& Brick : Grid.GetBrickCoords())
+		{
+			for (int32 Local = 0; Local < Grid.GetCellsPerBrick(); ++Local)
+			{
+				uint32 Start = 0;
+				uint32 End = 0;
+				const int32 Side = 1 << BrickBits;
+				const FIntVector Cell = Brick * Side + FIntVector(Local % Side, (Local / Side) % Side, Local / (Side * Side));
+				NumOccupiedCells += Grid.FindCell(Cell, Start, End) ? 1 : 0;
+			}
+		}
+
+		const FString Label = FString::Printf(TEXT("%d^3 bricks"), 1 << BrickBits);
+		TestEqual(Label + TEXT(": one brick per occupied brick coordinate"), Grid.GetNumBricks(), Bricks.Num());
+		TestEqual(Label + TEXT(": one range per occupied cell"), NumOccupiedCells, Cells.Num());
+		TestTrue(Label + TEXT(": ranges bracket exactly their cell"), CellRangesAreExact(Grid, Sorter, Positions));
+		TestEqual(Label + TEXT(": unoccupied brick"), Grid.FindBrick(FIntVector(100000, 0, 0)), static_cast<int32>(INDEX_NONE));
+	}
+
+	return true;
+}
+
+/**
+ * @brief Far-apart clusters cost memory proportional to their bricks, neighbor search stays exact, and elements beyond the brick range are rejected.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSparseBrickGridTest_DistantClusters::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(23);
+	TArray<FVector3f> Positions;
+	const FVector3f Centers[] = {
+		FVector3f(0.0f),
+		FVector3f(1.0e7f, 0.0f, 0.0f),
+		FVector3f(-1.0e7f, 1.0e7f, 0.0f),
+		FVector3f(0.0f, -1.0e7f, 1.0e7f)
+	};
+	for (const FVector3f& Center : Centers)
+	{
+		AddCluster(Positions, 16000, Center, 120.0f, Random);
+	}
+
+	FKawaiiFluidSparseBrickGrid Grid;
+	FKawaiiFluidMortonSorter Sorter;
+	Grid.SetLayout(CellSize, 3);
+
+	const double StartTime = FPlatformTime::Seconds();
+	Grid.Build(Positions.Num(), [&Positions](int32 Index) { return Positions[Index]; }, Sorter);
+	const double BuildSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// A 240 cm cluster spans at most 3 bricks of 160 cm per axis
+	TestTrue(TEXT("Bricks bounded by the occupied volume"), Grid.GetNumBricks() <= 4 * 27);
+	TestTrue(TEXT("Hash table at most 4x the bricks"), Grid.GetHashCapacity() <= FMath::Max(4 * Grid.GetNumBricks(), 64));
+	TestTrue(TEXT("Cell table sized by occupied bricks"),
+		Grid.GetAllocatedSize() < static_cast<SIZE_T>(Positions.Num()) * 64 + static_cast<SIZE_T>(Grid.GetNumBricks()) * Grid.GetCellsPerBrick() * 16);
+
+	// Neighbors through the grid equal a brute-force search within the cluster
+	const TConstArrayView<uint32> SortedIndices = Sorter.GetSortedIndices();
+	TArray<FVector3f> Sorted;
+	for (const uint32 Index : SortedIndices)
+	{
+		Sorted.Add(Positions[Index]);
+	}
+
+	bool bNeighborsMatch = true;
+	for (int32 Sample = 0; Sample < 200; ++Sample)
+	{
+		const int32 i = Random.RandRange(0, Sorted.Num() - 1);
+		const FIntVector Center = KawaiiFluidMorton::WorldToCell(Sorted[i], CellSize);
+
+		int32 GridCount = 0;
+		for (int32 Dz = -1; Dz <= 1; ++Dz)
+		{
+			for (int32 Dy = -1; Dy <= 1; ++Dy)
+			{
+				for (int32 Dx = -1; Dx <= 1; ++Dx)
+				{
+					uint32 Start = 0;
+					uint32 End = 0;
+					if (Grid.FindCell(Center + FIntVector(Dx, Dy, Dz), Start, End))
+					{
+						for (uint32 j = Start; j <= End; ++j)
+						{
+							GridCount += FVector3f::DistSquared(Sorted[i], Sorted[j]) < CellSize * CellSize ? 1 : 0;
+						}
+					}
+				}
+			}
+		}
+
+		int32 BruteCount = 0;
+		for (const FVector3f& Other : Sorted)
+		{
+			BruteCount += FVector3f::DistSquared(Sorted[i], Other) < CellSize * CellSize ? 1 : 0;
+		}
+		bNeighborsMatch &= GridCount == BruteCount;
+	}
+	TestTrue(TEXT("Neighbor counts match brute force"), bNeighborsMatch);
+	TestEqual(TEXT("No element rejected in range"), Grid.GetNumRejected(), 0);
+
+	AddInfo(FString::Printf(TEXT("%d particles, %d bricks, %.1f KB: build %.3f ms"),
+		Positions.Num(), Grid.GetNumBricks(), Grid.GetAllocatedSize() / 1024.0, BuildSeconds * 1000.0));
+
+	// Beyond the packable brick range elements are rejected, not merged into the edge brick
+	TArray<FVector3f> OutOfRange;
+	AddCluster(OutOfRange, 100, FVector3f(0.0f), 60.0f, Random);
+	AddCluster(OutOfRange, 10, FVector3f(4.0e8f, 0.0f, 0.0f), 60.0f, Random);
+	AddCluster(OutOfRange, 10, FVector3f(8.0e8f, 0.0f, 0.0f), 60.0f, Random);
+
+	AddExpectedMessage(TEXT("outside the"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 1);
+	Grid.Build(OutOfRange.Num(), [&OutOfRange](int32 Index) { return OutOfRange[Index]; }, Sorter);
+	TestEqual(TEXT("Out-of-range elements rejected"), Grid.GetNumRejected(), 20);
+	TestEqual(TEXT("Out-of-range brick not found"),
+		Grid.FindBrick(Grid.GetBrickCoord(KawaiiFluidMorton::WorldToCell(OutOfRange.Last(), CellSize))), static_cast<int32>(INDEX_NONE));
+
+	bool bRejectedLast = true;
+	bool bInRangeExact = true;
+	const TConstArrayView<uint32> OutOfRangeOrder = Sorter.GetSortedIndices();
+	for (int32 i = 0; i < OutOfRangeOrder.Num(); ++i)
+	{
+		bRejectedLast &= (OutOfRangeOrder[i] >= 100) == (i >= 100);
+
+		uint32 Start = 0;
+		uint32 End = 0;
+		const bool bFound = Grid.FindCell(KawaiiFluidMorton::WorldToCell(OutOfRange[OutOfRangeOrder[i]], CellSize), Start, End);
+		bInRangeExact &= i >= 100 ? !bFound : (bFound && Start <= static_cast<uint32>(i) && static_cast<uint32>(i) <= End);
+	}
+	TestTrue(TEXT("Rejected elements sort behind every cell"), bRejectedLast);
+	TestTrue(TEXT("In-range cells bracket their elements, rejected elements are in no cell"), bInRangeExact);
+
+	return true;
+}
+
+/**
+ * @brief The GPU reference produces the same substep on the sparse grid as on the dense Morton cell table.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSparseBrickGridTest_MatchesDenseGrid::RunTest(const FString& Parameters)
+{
+	FGPUFluidSimulationParams Params;
+	Params.SmoothingRadius = 20.0f;
+	Params.CellSize = CellSize;
+	Params.ParticleRadius = 5.0f;
+	Params.ParticleMass = 1.0f;
+	Params.DeltaTime = 1.0f / 120.0f;
+	Params.SolverIterations = 3;
+	Params.BoundsMin = FVector3f(-100.0f);
+	Params.BoundsMax = FVector3f(100.0f);
+	Params.BoundsExtent = FVector3f(100.0f);
+	Params.PrecomputeKernelCoefficients();
+
+	// Jittered block inside the classic Morton grid, so the dense table never clamps
+	FRandomStream Random(7);
+	TArray<FGPUFluidParticle> Initial;
+	for (int32 Z = 0; Z < 10; ++Z)
+	{
+		for (int32 Y = 0; Y < 10; ++Y)
+		{
+			for (int32 X = 0; X < 10; ++X)
+			{
+				FGPUFluidParticle& Particle = Initial.AddDefaulted_GetRef();
+				Particle.Position = FVector3f(-95.0f) + FVector3f(X, Y, Z) * 10.0f
+					+ FVector3f(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f));
+				Particle.PredictedPosition = Particle.Position;
+				Particle.ParticleID = Initial.Num() - 1;
+			}
+		}
+	}
+
+	auto Run = [&Params, &Initial](bool bSparse, int32 BrickBits, int32 NumSubsteps)
+	{
+		FKawaiiFluidGPUReferenceConfig Config;
+		Config.bUseHybridTiledZOrder = false;
+		Config.bUseSparseBrickGrid = bSparse;
+		Config.SparseBrickBits = BrickBits;
+		FKawaiiFluidGPUReferenceSolver Solver(Config);
+
+		TArray<FGPUFluidParticle> Particles = Initial;
+		for (int32 Substep = 0; Substep < NumSubsteps; ++Substep)
+		{
+			Solver.SimulateSubstep(Particles, Params);
+			Solver.EndFrame();
+		}
+
+		// Back to particle ID order for comparison
+		TArray<FGPUFluidParticle> ByID;
+		ByID.SetNum(Particles.Num());
+		for (const FGPUFluidParticle& Particle : Particles)
+		{
+			ByID[Particle.ParticleID] = Particle;
+		}
+		return ByID;
+	};
+
+	for (const int32 BrickBits : { 2, 3 })
+	{
+		const FString Label = FString::Printf(TEXT("%d^3 bricks"), 1 << BrickBits);
+
+		// First substep: same cells visited in the same order, so the result is bit identical
+		const TArray<FGPUFluidParticle> Dense = Run(false, BrickBits, 1);
+		const TArray<FGPUFluidParticle> Sparse = Run(true, BrickBits, 1);
+		TestTrue(Label + TEXT(": first substep bit identical"),
+			Dense.Num() == Sparse.Num() && FMemory::Memcmp(Dense.GetData(), Sparse.GetData(), Dense.Num() * sizeof(FGPUFluidParticle)) == 0);
+
+		// Later substeps sum neighbors in a different memory order, so only rounding may differ
+		const TArray<FGPUFluidParticle> DenseLong = Run(false, BrickBits, 20);
+		const TArray<FGPUFluidParticle> SparseLong = Run(true, BrickBits, 20);
+		float MaxPositionError = 0.0f;
+		for (int32 i = 0; i < DenseLong.Num(); ++i)
+		{
+			MaxPositionError = FMath::Max(MaxPositionError, FVector3f::Dist(DenseLong[i].Position, SparseLong[i].Position));
+		}
+		AddInfo(FString::Printf(TEXT("%s: max position difference after 20 substeps %.5f cm"), *Label, MaxPositionError));
+		TestTrue(Label + TEXT(": trajectories agree after 20 substeps"), MaxPositionError < 0.5f);
+	}
+
+	return true;
+}
+
+#endif
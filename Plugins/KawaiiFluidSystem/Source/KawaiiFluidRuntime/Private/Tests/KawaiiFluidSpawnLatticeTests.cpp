@@ -0,0 +1,133 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Simulation/Utils/KawaiiFluidSpawnLattice.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnLatticeTest_TemplateCache,
+	"KawaiiFluid.Spawn.Lattice.T01_TemplateCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnLatticeTest_TransformToRequests,
+	"KawaiiFluid.Spawn.Lattice.T02_TransformToRequests",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * @brief Identical keys share one template, different keys do not, and templates outlive a cache flush.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSpawnLatticeTest_TemplateCache::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSpawnLattice::ClearCache();
+
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> SphereA = FKawaiiFluidSpawnLattice::GetTemplate(
+		EKawaiiFluidLatticeShape::Sphere, 10.0f, FKawaiiFluidSpawnLattice::SphereDimensions(50.0f));
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> SphereB = FKawaiiFluidSpawnLattice::GetTemplate(
+		EKawaiiFluidLatticeShape::Sphere, 10.0f, FKawaiiFluidSpawnLattice::SphereDimensions(50.0f));
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> SphereC = FKawaiiFluidSpawnLattice::GetTemplate(
+		EKawaiiFluidLatticeShape::Sphere, 12.0f, FKawaiiFluidSpawnLattice::SphereDimensions(50.0f));
+
+	TestTrue(TEXT("Same key returns the cached template"), &SphereA.Get() == &SphereB.Get());
+	TestTrue(TEXT("Different spacing builds a new template"), &SphereA.Get() != &SphereC.Get());
+	TestEqual(TEXT("Two templates cached"), FKawaiiFluidSpawnLattice::GetNumCachedTemplates(), 2);
+	TestTrue(TEXT("Sphere lattice is non-empty"), SphereA->Num() > 0);
+	TestEqual(TEXT("Jitter scales parallel to positions"), SphereA->JitterScales.Num(), SphereA->Num());
+
+	// Every lattice point is inside the shape
+	bool bAllInside = true;
+	for (const FVector3f& Local : SphereA->LocalPositions)
+	{
+		bAllInside &= Local.Size() <= 50.0f + KINDA_SMALL_NUMBER;
+	}
+	TestTrue(TEXT("Sphere lattice stays inside the radius"), bAllInside);
+
+	const int32 NumBeforeFlush = SphereA->Num();
+	FKawaiiFluidSpawnLattice::ClearCache();
+	TestEqual(TEXT("Cache is empty after ClearCache"), FKawaiiFluidSpawnLattice::GetNumCachedTemplates(), 0);
+	TestEqual(TEXT("Held template survives a flush"), SphereA->Num(), NumBeforeFlush);
+
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Invalid = FKawaiiFluidSpawnLattice::GetTemplate(
+		EKawaiiFluidLatticeShape::Box, 0.0f, FVector(50.0));
+	TestEqual(TEXT("Zero spacing yields an empty template"), Invalid->Num(), 0);
+
+	return true;
+}
+
+/**
+ * @brief Transforming into spawn requests matches the position path and honours MaxCount and the stream clip.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSpawnLatticeTest_TransformToRequests::RunTest(const FString& Parameters)
+{
+	const FVector Center(100.0, -200.0, 300.0);
+	const FQuat Rotation(FVector::UpVector, FMath::DegreesToRadians(30.0f));
+	const FVector HalfSize(40.0, 30.0, 20.0);
+	const FVector Velocity(0.0, 0.0, -250.0);
+
+	TArray<FVector> Positions;
+	const int32 NumPositions = FKawaiiFluidSpawnLattice::GenerateBox(Center, Rotation, HalfSize, 8.0f, 0.0f, 0, Positions);
+
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Box = FKawaiiFluidSpawnLattice::GetTemplate(EKawaiiFluidLatticeShape::Box, 8.0f, HalfSize);
+
+	// Appending into a reused buffer keeps the existing entries
+	TArray<FGPUSpawnRequest> Requests;
+	Requests.Add(FGPUSpawnRequest(FVector3f::ZeroVector, FVector3f::ZeroVector, 99));
+	const int32 NumRequests = FKawaiiFluidSpawnLattice::TransformToSpawnRequests(*Box, Center, Rotation, 0.0f, 0, Velocity, 7, Requests);
+
+	TestEqual(TEXT("Request and position paths produce the same count"), NumRequests, NumPositions);
+	TestEqual(TEXT("Requests are appended"), Requests.Num(), NumRequests + 1);
+	TestEqual(TEXT("Existing entry untouched"), Requests[0].SourceID, 99);
+
+	bool bMatches = true;
+	bool bInside = true;
+	for (int32 i = 0; i < NumRequests; ++i)
+	{
+		const FGPUSpawnRequest& Request = Requests[i + 1];
+		bMatches &= FVector(Request.Position).Equals(Positions[i], 0.01);
+		bMatches &= Request.SourceID == 7 && Request.Velocity == FVector3f(Velocity) && Request.Mass == 0.0f;
+
+		const FVector Local = Rotation.UnrotateVector(FVector(Request.Position) - Center);
+		bInside &= FMath::Abs(Local.X) <= HalfSize.X + 0.01 && FMath::Abs(Local.Y) <= HalfSize.Y + 0.01 && FMath::Abs(Local.Z) <= HalfSize.Z + 0.01;
+	}
+	TestTrue(TEXT("Unjittered requests match generated positions"), bMatches);
+	TestTrue(TEXT("Rotated requests stay inside the box"), bInside);
+
+	// Jitter stays within the per-point range
+	TArray<FGPUSpawnRequest> Jittered;
+	FKawaiiFluidSpawnLattice::TransformToSpawnRequests(*Box, Center, Rotation, 0.5f, 0, Velocity, 7, Jittered);
+	bool bJitterBounded = Jittered.Num() == NumRequests;
+	for (int32 i = 0; i < Jittered.Num() && bJitterBounded; ++i)
+	{
+		const float MaxOffset = Box->JitterScales[i] * 0.5f * UE_SQRT_3 + 0.01f;
+		bJitterBounded &= FVector::Dist(FVector(Jittered[i].Position), Positions[i]) <= MaxOffset;
+	}
+	TestTrue(TEXT("Jitter bounded by the surface falloff"), bJitterBounded);
+
+	TArray<FGPUSpawnRequest> Capped;
+	TestEqual(TEXT("MaxCount caps the request count"),
+		FKawaiiFluidSpawnLattice::TransformToSpawnRequests(*Box, Center, Rotation, 0.0f, 10, Velocity, 7, Capped), 10);
+
+	// Stream discs clip to the radius after jitter
+	const TSharedRef<const FKawaiiFluidLatticeTemplate> Disc = FKawaiiFluidSpawnLattice::GetTemplate(
+		EKawaiiFluidLatticeShape::StreamDisc, 5.0f, FKawaiiFluidSpawnLattice::StreamDiscDimensions(20.0f));
+	TArray<FGPUSpawnRequest> Layer;
+	const int32 NumLayer = FKawaiiFluidSpawnLattice::TransformStreamLayerToSpawnRequests(*Disc, Center, FVector(0.0, 0.0, -1.0), 0.5f, Velocity, 3, Layer);
+	TestTrue(TEXT("Stream layer is non-empty"), NumLayer > 0 && NumLayer <= Disc->Num());
+
+	bool bInDisc = true;
+	for (const FGPUSpawnRequest& Request : Layer)
+	{
+		const FVector Offset = FVector(Request.Position) - Center;
+		bInDisc &= FMath::IsNearlyZero(Offset.Z, 0.01) && Offset.Size2D() <= 20.0 + 0.01;
+	}
+	TestTrue(TEXT("Stream layer stays in the disc plane and radius"), bInDisc);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,259 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "Simulation/Managers/KawaiiFluidSpawnRequestRing.h"
+#include "Simulation/Managers/KawaiiFluidParticleLifecycleManager.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnRequestRingTest_OrderAndCancel,
+	"KawaiiFluid.Simulation.SpawnRing.T01_OrderAndCancel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSpawnRequestRingTest_MillionPerMinute,
+	"KawaiiFluid.Simulation.SpawnRing.T02_MillionPerMinute",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	/**
+	 * @brief Build a request tagged with its publish index in Position.X (exact in float up to 2^24).
+	 * @param Sequence Publish index.
+	 * @param SourceID Source the request belongs to.
+	 * @return Tagged request.
+	 */
+	FGPUSpawnRequest MakeTaggedRequest(int32 Sequence, int32 SourceID)
+	{
+		return FGPUSpawnRequest(FVector3f(static_cast<float>(Sequence), 0.0f, 0.0f), FVector3f::ZeroVector, SourceID, 0.0f);
+	}
+}
+
+/**
+ * @brief Requests come out in publish order across block boundaries, and cancellation only drops earlier requests.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSpawnRequestRingTest_OrderAndCancel::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSpawnRequestRing Ring(1);
+
+	// Batch larger than two blocks
+	const int32 NumBatch = FKawaiiFluidSpawnRequestRing::BlockSize * 2 + 17;
+	TArray<FGPUSpawnRequest> Batch;
+	for (int32 i = 0; i < NumBatch; ++i)
+	{
+		Batch.Add(MakeTaggedRequest(i, i % 3));
+	}
+	Ring.Push(Batch);
+	TestEqual(TEXT("Num counts published requests"), Ring.Num(), NumBatch);
+
+	int32 Expected = 0;
+	bool bInOrder = true;
+	bool bSpansFitBlocks = true;
+	const int32 NumConsumed = Ring.Consume([&](TArrayView<FGPUSpawnRequest> Span)
+	{
+		bSpansFitBlocks &= Span.Num() <= FKawaiiFluidSpawnRequestRing::BlockSize;
+		for (const FGPUSpawnRequest& Request : Span)
+		{
+			bInOrder &= static_cast<int32>(Request.Position.X) == Expected++;
+		}
+	});
+	TestEqual(TEXT("Every request delivered"), NumConsumed, NumBatch);
+	TestTrue(TEXT("Publish order preserved"), bInOrder);
+	TestTrue(TEXT("Spans never cross a block"), bSpansFitBlocks);
+	TestTrue(TEXT("Ring drained"), Ring.IsEmpty());
+	TestEqual(TEXT("Three blocks cover the batch"), Ring.GetNumAllocatedBlocks(), 3);
+
+	// Same volume again reuses the recycled blocks
+	Ring.Push(Batch);
+	Ring.Consume([](TArrayView<FGPUSpawnRequest>) {});
+	TestEqual(TEXT("Recycled blocks reused"), Ring.GetNumAllocatedBlocks(), 3);
+
+	// CancelSource drops requests published before the call only
+	for (int32 i = 0; i < 10; ++i)
+	{
+		Ring.Push(MakeTaggedRequest(i, i % 2));
+	}
+	Ring.CancelSource(1);
+	Ring.Push(MakeTaggedRequest(10, 1));
+
+	TArray<int32> Delivered;
+	Ring.Consume([&Delivered](TArrayView<FGPUSpawnRequest> Span)
+	{
+		for (const FGPUSpawnRequest& Request : Span)
+		{
+			Delivered.Add(static_cast<int32>(Request.Position.X));
+		}
+	});
+	TestTrue(TEXT("Cancelled source dropped, later request kept"), Delivered == TArray<int32>({ 0, 2, 4, 6, 8, 10 }));
+	TestTrue(TEXT("Ring empty after cancelled drain"), Ring.IsEmpty());
+
+	// Fence is gone: new requests from the cancelled source flow again
+	Ring.Push(MakeTaggedRequest(11, 1));
+	TestEqual(TEXT("Fence retired after it was passed"), Ring.Consume([](TArrayView<FGPUSpawnRequest>) {}), 1);
+
+	// CancelAll drops everything pending
+	for (int32 i = 0; i < 50; ++i)
+	{
+		Ring.Push(MakeTaggedRequest(i, i % 4));
+	}
+	Ring.CancelAll();
+	Ring.Push(MakeTaggedRequest(99, 2));
+	Delivered.Reset();
+	Ring.Consume([&Delivered](TArrayView<FGPUSpawnRequest> Span)
+	{
+		for (const FGPUSpawnRequest& Request : Span)
+		{
+			Delivered.Add(static_cast<int32>(Request.Position.X));
+		}
+	});
+	TestTrue(TEXT("CancelAll keeps only later requests"), Delivered == TArray<int32>({ 99 }));
+
+	// Cancelling an empty ring is a no-op
+	Ring.CancelAll();
+	Ring.Push(MakeTaggedRequest(5, 0));
+	TestEqual(TEXT("Cancel on empty ring does not affect later requests"), Ring.Consume([](TArrayView<FGPUSpawnRequest>) {}), 1);
+
+	return true;
+}
+
+/**
+ * @brief One minute at 60 Hz spawning and despawning ~1M particles through the ring and the lifecycle manager.
+ *
+ * A producer thread publishes per-frame emitter batches while the consumer drains the ring into the
+ * lifecycle manager's double buffer, retires particles after a fixed lifetime, and periodically cancels
+ * a source. Checks counts, order, and that no blocks are allocated after warm-up.
+ *
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSpawnRequestRingTest_MillionPerMinute::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumFrames = 60 * 60;
+	constexpr int32 MeanSpawnsPerFrame = 278;
+	constexpr int32 NumSources = 8;
+	constexpr int32 MaxInFlight = MeanSpawnsPerFrame * 4;
+	constexpr int32 LifetimeTicks = 120;
+	constexpr int32 WarmupFrames = 60;
+
+	FKawaiiFluidSpawnRequestRing Ring;
+	FKawaiiFluidParticleLifecycleManager Manager;
+
+	std::atomic<bool> bProducerDone{false};
+	std::atomic<int32> ProducerFrame{0};
+	std::atomic<int32> AllocatedAfterWarmup{0};
+
+	TFuture<int64> Producer = Async(EAsyncExecution::Thread, [&Ring, &bProducerDone, &ProducerFrame, &AllocatedAfterWarmup]() -> int64
+	{
+		TArray<FGPUSpawnRequest> EmitterBatch;
+		EmitterBatch.Reserve(MeanSpawnsPerFrame * 2);
+
+		int64 Published = 0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			// Back-pressure stands in for the frame boundary between game and simulation ticks
+			while (Ring.Num() > MaxInFlight)
+			{
+				FPlatformProcess::Yield();
+			}
+
+			const int32 Count = MeanSpawnsPerFrame + ((Frame * 37) % 157) - 78;
+			EmitterBatch.Reset();
+			for (int32 i = 0; i < Count; ++i)
+			{
+				EmitterBatch.Add(MakeTaggedRequest(static_cast<int32>(Published + i), (Frame + i) % NumSources));
+			}
+			Ring.Push(EmitterBatch);
+			Published += Count;
+
+			ProducerFrame.store(Frame + 1, std::memory_order_release);
+			if (Frame == WarmupFrames)
+			{
+				AllocatedAfterWarmup.store(Ring.GetNumAllocatedBlocks());
+			}
+		}
+
+		bProducerDone.store(true, std::memory_order_release);
+		return Published;
+	});
+
+	int64 Consumed = 0;
+	int64 Spawned = 0;
+	int64 Despawned = 0;
+	int64 CancelledInManager = 0;
+	int32 LastSequence = -1;
+	bool bInOrder = true;
+
+	TArray<int32> SpawnedPerTick;
+	SpawnedPerTick.SetNumZeroed(LifetimeTicks);
+	int32 Tick = 0;
+
+	for (;;)
+	{
+		const bool bDone = bProducerDone.load(std::memory_order_acquire);
+
+		Consumed += Ring.Consume([&](TArrayView<FGPUSpawnRequest> Span)
+		{
+			for (const FGPUSpawnRequest& Request : Span)
+			{
+				const int32 Sequence = static_cast<int32>(Request.Position.X);
+				bInOrder &= Sequence > LastSequence;
+				LastSequence = Sequence;
+			}
+			Manager.AddSpawnRequests(Span);
+		});
+
+		// Simulation tick: occasionally an emitter is cleared before its requests reach the GPU
+		if (Tick % 600 == 599)
+		{
+			CancelledInManager += Manager.CancelPendingSpawnsForSource(Tick % NumSources);
+		}
+
+		Manager.SwapBuffers();
+		const int32 NumActive = Manager.GetActiveRequestCount();
+		Manager.ClearActiveRequests();
+
+		// Particles live for a fixed number of ticks, then despawn
+		const int32 Slot = Tick % LifetimeTicks;
+		Despawned += SpawnedPerTick[Slot];
+		SpawnedPerTick[Slot] = NumActive;
+		Spawned += NumActive;
+		++Tick;
+
+		if (bDone && Ring.IsEmpty())
+		{
+			break;
+		}
+
+		if (NumActive == 0)
+		{
+			FPlatformProcess::Yield();
+		}
+	}
+
+	for (int32 Remaining : SpawnedPerTick)
+	{
+		Despawned += Remaining;
+	}
+
+	const int64 Published = Producer.Get();
+
+	TestTrue(TEXT("About one million requests per simulated minute"), Published >= 990000 && Published <= 1010000);
+	TestEqual(TEXT("Every published request consumed"), Consumed, Published);
+	TestTrue(TEXT("Requests delivered in publish order"), bInOrder);
+	TestEqual(TEXT("Spawned plus cancelled matches consumed"), Spawned + CancelledInManager, Consumed);
+	TestEqual(TEXT("Every spawned particle despawned"), Despawned, Spawned);
+	TestEqual(TEXT("Manager has nothing pending"), Manager.GetPendingSpawnCount(), 0);
+	TestEqual(TEXT("No blocks allocated after warm-up"), Ring.GetNumAllocatedBlocks(), AllocatedAfterWarmup.load());
+	TestTrue(TEXT("Working set stays within a few blocks"),
+		Ring.GetNumAllocatedBlocks() <= FMath::Max(FKawaiiFluidSpawnRequestRing::DefaultPreallocatedBlocks,
+			FMath::DivideAndRoundUp(MaxInFlight + MeanSpawnsPerFrame * 2, FKawaiiFluidSpawnRequestRing::BlockSize) + 2));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,287 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/Package.h"
+#include "Core/KawaiiFluidSimulationStats.h"
+#include "Core/KawaiiFluidSimulationTypes.h"
+#include "Core/KawaiiFluidSimulationContext.h"
+#include "Core/KawaiiFluidPresetDataAsset.h"
+#include "Core/KawaiiFluidSpatialHash.h"
+#include "Simulation/Utils/KawaiiFluidBoundaryPass.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidStatsTest_NeighborHistogramBuckets,
+	"KawaiiFluid.Physics.Stats.S01_NeighborHistogramBuckets",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidStatsTest_DensityIterationError,
+	"KawaiiFluid.Physics.Stats.S02_DensityIterationError",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidStatsTest_AccumulatorMerge,
+	"KawaiiFluid.Physics.Stats.S03_AccumulatorMerge",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidStatsTest_SimulateCPUStageTimings,
+	"KawaiiFluid.Physics.Stats.S04_SimulateCPUStageTimings",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * @brief Verify neighbor counts map to the documented histogram buckets.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidStatsTest_NeighborHistogramBuckets::RunTest(const FString& Parameters)
+{
+	struct FBucketCase
+	{
+		int32 NeighborCount;
+		int32 ExpectedBucket;
+	};
+
+	const FBucketCase Cases[] = {
+		{ 0, 0 }, { 1, 1 }, { 7, 1 }, { 8, 2 }, { 15, 2 }, { 16, 3 },
+		{ 31, 3 }, { 32, 4 }, { 63, 4 }, { 64, 5 }, { 500, 5 }
+	};
+
+	for (const FBucketCase& Case : Cases)
+	{
+		TestEqual(FString::Printf(TEXT("Neighbor count %d bucket"), Case.NeighborCount),
+			FKawaiiFluidSimulationStatsCollector::GetNeighborHistogramBucket(Case.NeighborCount),
+			Case.ExpectedBucket);
+	}
+
+	// Same path as the CPU frame: the fused boundary sweep fills the accumulator, the collector merges it
+	TArray<FKawaiiFluidParticle> Particles;
+	for (const int32 NeighborCount : { 0, 20, 25 })
+	{
+		FKawaiiFluidParticle& Particle = Particles.AddDefaulted_GetRef();
+		Particle.Density = 1000.0f;
+		Particle.NeighborIndices.SetNumZeroed(NeighborCount);
+	}
+
+	FKawaiiFluidStatsAccumulator Accumulator;
+	FKawaiiFluidBoundaryPass::ComputeBounds(Particles, &Accumulator, 1.0f / 1000.0f);
+
+	FKawaiiFluidSimulationStatsCollector Collector;
+	Collector.SetEnabled(true);
+	Collector.BeginFrame();
+	Collector.MergeAccumulator(Accumulator);
+	Collector.EndFrame();
+
+	const FKawaiiFluidSimulationStats& Stats = Collector.GetStats();
+	TestEqual(TEXT("Isolated bucket count"), Stats.NeighborHistogram[0], 1);
+	TestEqual(TEXT("[16-31] bucket count"), Stats.NeighborHistogram[3], 2);
+
+	return true;
+}
+
+/**
+ * @brief Verify per-iteration density error and stage timings are averaged per frame.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidStatsTest_DensityIterationError::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSimulationStatsCollector Collector;
+	Collector.SetEnabled(true);
+	Collector.BeginFrame();
+
+	// Two substeps, three iterations each
+	Collector.AddDensityIterationError(0, 10.0f);
+	Collector.AddDensityIterationError(1, 5.0f);
+	Collector.AddDensityIterationError(2, 2.0f);
+	Collector.AddDensityIterationError(0, 6.0f);
+	Collector.AddDensityIterationError(1, 3.0f);
+	Collector.AddDensityIterationError(2, 1.0f);
+
+	FKawaiiFluidSubstepTimings Timings;
+	Timings.DensityMs = 1.5;
+	Timings.TotalMs = 4.0;
+	Collector.AddSubstepTimings(Timings);
+	Collector.AddSubstepTimings(Timings);
+
+	Collector.EndFrame();
+
+	const FKawaiiFluidSimulationStats& Stats = Collector.GetStats();
+	TestEqual(TEXT("Iteration count"), Stats.DensityErrorPerIteration.Num(), 3);
+	if (Stats.DensityErrorPerIteration.Num() == 3)
+	{
+		TestEqual(TEXT("Iteration 0 average"), Stats.DensityErrorPerIteration[0], 8.0f, KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Iteration 1 average"), Stats.DensityErrorPerIteration[1], 4.0f, KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Iteration 2 average"), Stats.DensityErrorPerIteration[2], 1.5f, KINDA_SMALL_NUMBER);
+	}
+
+	TestEqual(TEXT("Density solve time accumulates over substeps"), Stats.DensitySolveTimeMs, 3.0, 1e-9);
+	TestEqual(TEXT("Total time accumulates over substeps"), Stats.TotalSimulationTimeMs, 8.0, 1e-9);
+
+	// Next frame starts clean
+	Collector.BeginFrame();
+	Collector.EndFrame();
+	TestEqual(TEXT("Iteration errors reset per frame"), Collector.GetStats().DensityErrorPerIteration.Num(), 0);
+
+	return true;
+}
+
+/**
+ * @brief Verify per-thread accumulators merged at frame end match a serial two-pass computation.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidStatsTest_AccumulatorMerge::RunTest(const FString& Parameters)
+{
+	constexpr int32 SampleCount = 1000;
+	constexpr int32 ChunkCount = 7;
+	constexpr float RestDensity = 1000.0f;
+
+	FRandomStream Random(42);
+	TArray<float> Velocities;
+	TArray<float> Densities;
+	TArray<int32> NeighborCounts;
+	for (int32 i = 0; i < SampleCount; ++i)
+	{
+		Velocities.Add(Random.FRandRange(0.0f, 300.0f));
+		Densities.Add(Random.FRandRange(900.0f, 1100.0f));
+		NeighborCounts.Add(Random.RandRange(0, 80));
+	}
+
+	// Reference: serial two-pass mean/variance
+	double VelocityMean = 0.0;
+	double DensityMean = 0.0;
+	for (int32 i = 0; i < SampleCount; ++i)
+	{
+		VelocityMean += Velocities[i];
+		DensityMean += Densities[i];
+	}
+	VelocityMean /= SampleCount;
+	DensityMean /= SampleCount;
+
+	double VelocityVariance = 0.0;
+	double DensityVariance = 0.0;
+	for (int32 i = 0; i < SampleCount; ++i)
+	{
+		VelocityVariance += FMath::Square(Velocities[i] - VelocityMean);
+		DensityVariance += FMath::Square(Densities[i] - DensityMean);
+	}
+	VelocityVariance /= SampleCount;
+	DensityVariance /= SampleCount;
+
+	// Uneven chunks, as produced by ParallelFor task contexts
+	TArray<FKawaiiFluidStatsAccumulator> Chunks;
+	Chunks.SetNum(ChunkCount);
+	for (int32 i = 0; i < SampleCount; ++i)
+	{
+		const int32 Chunk = (i * i) % ChunkCount;
+		Chunks[Chunk].AddParticle(Velocities[i], Densities[i], 1.0f, NeighborCounts[i], 1.0f / RestDensity);
+	}
+
+	FKawaiiFluidStatsAccumulator Merged;
+	Merged.Merge(FKawaiiFluidStatsAccumulator());  // Empty merge is a no-op
+	for (const FKawaiiFluidStatsAccumulator& Chunk : Chunks)
+	{
+		Merged.Merge(Chunk);
+	}
+
+	TestEqual(TEXT("Merged sample count"), static_cast<int32>(Merged.Velocity.Count), SampleCount);
+	TestEqual(TEXT("Velocity mean matches two-pass"), Merged.Velocity.Mean, VelocityMean, 1e-6);
+	TestEqual(TEXT("Velocity variance matches two-pass"), Merged.Velocity.GetVariance(), VelocityVariance, VelocityVariance * 1e-9);
+	TestEqual(TEXT("Density mean matches two-pass"), Merged.Density.Mean, DensityMean, 1e-6);
+	TestEqual(TEXT("Density variance matches two-pass"), Merged.Density.GetVariance(), DensityVariance, DensityVariance * 1e-9);
+	TestEqual(TEXT("Velocity min"), Merged.Velocity.Min, FMath::Min(Velocities));
+	TestEqual(TEXT("Velocity max"), Merged.Velocity.Max, FMath::Max(Velocities));
+
+	int32 HistogramTotal = 0;
+	for (int32 Bucket = 0; Bucket < FKawaiiFluidSimulationStats::NeighborHistogramBucketCount; ++Bucket)
+	{
+		HistogramTotal += Merged.NeighborHistogram[Bucket];
+	}
+	TestEqual(TEXT("Histogram covers every particle"), HistogramTotal, SampleCount);
+
+	// Collector derives the snapshot from the merged accumulator at EndFrame
+	FKawaiiFluidSimulationStatsCollector Collector;
+	Collector.SetEnabled(true);
+	Collector.BeginFrame();
+	Collector.SetRestDensity(RestDensity);
+	for (const FKawaiiFluidStatsAccumulator& Chunk : Chunks)
+	{
+		Collector.MergeAccumulator(Chunk);
+	}
+	Collector.EndFrame();
+
+	const FKawaiiFluidSimulationStats& Stats = Collector.GetStats();
+	TestEqual(TEXT("Avg velocity"), Stats.AvgVelocity, static_cast<float>(VelocityMean), 1e-3f);
+	TestEqual(TEXT("Velocity stddev"), Stats.VelocityStdDev, static_cast<float>(FMath::Sqrt(VelocityVariance)), 1e-3f);
+	TestEqual(TEXT("Density stddev"), Stats.DensityStdDev, static_cast<float>(FMath::Sqrt(DensityVariance)), 1e-3f);
+	TestTrue(TEXT("Stability score in range"), Stats.StabilityScore >= 0.0f && Stats.StabilityScore <= 100.0f);
+
+	// Empty frame leaves extrema at 0 rather than sentinels
+	Collector.BeginFrame();
+	Collector.EndFrame();
+	TestEqual(TEXT("Empty frame min velocity"), Collector.GetStats().MinVelocity, 0.0f);
+	TestEqual(TEXT("Empty frame max neighbors"), Collector.GetStats().MaxNeighborCount, 0);
+
+	return true;
+}
+
+/**
+ * @brief Verify SimulateCPU publishes stage timings and per-iteration density error through the global collector.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidStatsTest_SimulateCPUStageTimings::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSimulationStatsCollector& Collector = GetFluidStatsCollector();
+	const bool bWasEnabled = Collector.IsEnabled();
+	Collector.SetEnabled(true);
+
+	TStrongObjectPtr<UKawaiiFluidPresetDataAsset> Preset(NewObject<UKawaiiFluidPresetDataAsset>(GetTransientPackage()));
+	Preset->RecalculateDerivedParameters();
+
+	TStrongObjectPtr<UKawaiiFluidSimulationContext> Context(NewObject<UKawaiiFluidSimulationContext>(GetTransientPackage()));
+	Context->InitializeSolvers(Preset.Get());
+	FKawaiiFluidSpatialHash SpatialHash(Preset->SmoothingRadius);
+
+	FKawaiiFluidSimulationParams Params;
+	Params.ParticleRadius = Preset->ParticleRadius;
+	Params.bUseWorldCollision = false;
+	Params.WorldBounds = FBox(FVector(-1000.0f), FVector(1000.0f));
+
+	// Compressed block so the density solver has work in every iteration
+	TArray<FKawaiiFluidParticle> Particles;
+	for (int32 Z = 0; Z < 8; ++Z)
+	{
+		for (int32 Y = 0; Y < 8; ++Y)
+		{
+			for (int32 X = 0; X < 8; ++X)
+			{
+				FKawaiiFluidParticle& Particle = Particles.Emplace_GetRef(FVector(X, Y, Z) * Preset->ParticleSpacing * 0.8f, Particles.Num());
+				Particle.Mass = Preset->ParticleMass;
+			}
+		}
+	}
+
+	float AccumulatedTime = 0.0f;
+	for (int32 Frame = 0; Frame < 3; ++Frame)
+	{
+		Context->SimulateCPU(Particles, Preset.Get(), Params, SpatialHash, 1.0f / 60.0f, AccumulatedTime);
+	}
+
+	const FKawaiiFluidSimulationStats& Stats = Collector.GetStats();
+	TestTrue(TEXT("Substeps ran"), Stats.SubstepCount > 0);
+	TestTrue(TEXT("Total simulation time published"), Stats.TotalSimulationTimeMs > 0.0);
+	TestTrue(TEXT("Predict time published"), Stats.PredictTimeMs > 0.0);
+	TestTrue(TEXT("Neighbor time published"), Stats.SpatialHashTimeMs > 0.0);
+	TestTrue(TEXT("Density solve time published"), Stats.DensitySolveTimeMs > 0.0);
+	TestTrue(TEXT("Density error per iteration published"), Stats.DensityErrorPerIteration.Num() > 0);
+	TestTrue(TEXT("Stage times stay within the frame total"),
+		Stats.PredictTimeMs + Stats.SpatialHashTimeMs + Stats.DensitySolveTimeMs <= Stats.TotalSimulationTimeMs + 1e-6);
+
+	Collector.SetEnabled(bWasEnabled);
+	return true;
+}
+
+#endif
@@ -0,0 +1,224 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Core/KawaiiFluidParticle.h"
+#include "Simulation/Physics/KawaiiFluidSurfaceClassifier.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceClassifierTest_BlockSurface,
+	"KawaiiFluid.Simulation.SurfaceClassifier.T01_BlockSurface",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceClassifierTest_Hysteresis,
+	"KawaiiFluid.Simulation.SurfaceClassifier.T02_Hysteresis",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceClassifierTest_CompactList,
+	"KawaiiFluid.Simulation.SurfaceClassifier.T03_CompactList",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float SmoothingRadius = 12.0f;
+	constexpr float Spacing = 5.0f;
+
+	/**
+	 * @brief Helper: Cubic lattice block with neighbor lists from lattice offsets (self included, like the spatial hash).
+	 * @param Particles Output array (appended).
+	 * @param Dim Particles per axis.
+	 * @param Origin Position of the first particle (cm).
+	 */
+	void AddBlock(TArray<FKawaiiFluidParticle>& Particles, int32 Dim, const FVector& Origin)
+	{
+		const int32 Base = Particles.Num();
+		const int32 Reach = FMath::FloorToInt(SmoothingRadius / Spacing);
+		auto IndexOf = [Base, Dim](int32 X, int32 Y, int32 Z) { return Base + (Z * Dim + Y) * Dim + X; };
+
+		for (int32 z = 0; z < Dim; ++z)
+		{
+			for (int32 y = 0; y < Dim; ++y)
+			{
+				for (int32 x = 0; x < Dim; ++x)
+				{
+					FKawaiiFluidParticle& Particle = Particles.AddDefaulted_GetRef();
+					Particle.Position = Origin + FVector(x, y, z) * Spacing;
+					Particle.PredictedPosition = Particle.Position;
+
+					for (int32 Dz = FMath::Max(z - Reach, 0); Dz <= FMath::Min(z + Reach, Dim - 1); ++Dz)
+					{
+						for (int32 Dy = FMath::Max(y - Reach, 0); Dy <= FMath::Min(y + Reach, Dim - 1); ++Dy)
+						{
+							for (int32 Dx = FMath::Max(x - Reach, 0); Dx <= FMath::Min(x + Reach, Dim - 1); ++Dx)
+							{
+								Particle.NeighborIndices.Add(IndexOf(Dx, Dy, Dz));
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief Helper: Default classification inputs at the test kernel radius.
+	 * @return Parameters.
+	 */
+	FKawaiiFluidSurfaceParams MakeParams()
+	{
+		FKawaiiFluidSurfaceParams Params;
+		Params.SmoothingRadius = SmoothingRadius;
+		return Params;
+	}
+
+	/**
+	 * @brief Helper: Check that the compact list holds exactly the flagged particles, ascending, with their normals.
+	 * @param Classifier Classifier after Classify.
+	 * @param Particles Classified particles.
+	 * @return True if the list is consistent with the particles.
+	 */
+	bool IsListConsistent(const FKawaiiFluidSurfaceClassifier& Classifier, const TArray<FKawaiiFluidParticle>& Particles)
+	{
+		const TConstArrayView<int32> Indices = Classifier.GetSurfaceIndices();
+		const TConstArrayView<FVector3f> Normals = Classifier.GetSurfaceNormals();
+		if (Indices.Num() != Normals.Num())
+		{
+			return false;
+		}
+
+		int32 Next = 0;
+		for (int32 i = 0; i < Particles.Num(); ++i)
+		{
+			if (!Particles[i].bIsSurfaceParticle)
+			{
+				continue;
+			}
+
+			if (Next >= Indices.Num() || Indices[Next] != i || !Normals[Next].Equals(FVector3f(Particles[i].SurfaceNormal), 1.0e-6f))
+			{
+				return false;
+			}
+			++Next;
+		}
+		return Next == Indices.Num();
+	}
+}
+
+/**
+ * @brief A lattice block: the outer layer is surface with outward normals, particles deeper than the kernel are interior.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSurfaceClassifierTest_BlockSurface::RunTest(const FString& Parameters)
+{
+	constexpr int32 Dim = 12;
+	TArray<FKawaiiFluidParticle> Particles;
+	AddBlock(Particles, Dim, FVector(-100.0f, 40.0f, 7.0f));
+
+	FKawaiiFluidSurfaceClassifier Classifier;
+	Classifier.Classify(Particles, MakeParams());
+
+	int32 NumOuterMissed = 0;
+	int32 NumDeepFlagged = 0;
+	int32 NumFaceNormalsWrong = 0;
+	const int32 DeepMin = FMath::CeilToInt(SmoothingRadius / Spacing);
+	for (int32 z = 0; z < Dim; ++z)
+	{
+		for (int32 y = 0; y < Dim; ++y)
+		{
+			for (int32 x = 0; x < Dim; ++x)
+			{
+				const FKawaiiFluidParticle& Particle = Particles[(z * Dim + y) * Dim + x];
+				const int32 Depth = FMath::Min(FMath::Min3(x, y, z), FMath::Min3(Dim - 1 - x, Dim - 1 - y, Dim - 1 - z));
+
+				NumOuterMissed += Depth == 0 && !Particle.bIsSurfaceParticle ? 1 : 0;
+				NumDeepFlagged += Depth >= DeepMin && Particle.bIsSurfaceParticle ? 1 : 0;
+
+				// Middle of the top face: straight up
+				const bool bTopFaceCenter = z == Dim - 1 && FMath::Min(x, y) >= DeepMin && FMath::Max(x, y) < Dim - DeepMin;
+				NumFaceNormalsWrong += bTopFaceCenter && Particle.SurfaceNormal.Z < 0.95f ? 1 : 0;
+			}
+		}
+	}
+
+	TestEqual(TEXT("Outer layer particles not classified as surface"), NumOuterMissed, 0);
+	TestEqual(TEXT("Interior particles classified as surface"), NumDeepFlagged, 0);
+	TestEqual(TEXT("Top face normals not pointing up"), NumFaceNormalsWrong, 0);
+	TestTrue(TEXT("Compact list matches the flags"), IsListConsistent(Classifier, Particles));
+	TestTrue(TEXT("Reference neighbor count near the interior lattice count (56)"),
+		Classifier.GetLastReferenceNeighborCount() > 45.0f && Classifier.GetLastReferenceNeighborCount() <= 56.0f);
+
+	AddInfo(FString::Printf(TEXT("%d^3 block: %d surface particles (%.1f%%), reference neighbors %.1f"),
+		Dim, Classifier.GetNumSurface(), 100.0f * Classifier.GetNumSurface() / Particles.Num(), Classifier.GetLastReferenceNeighborCount()));
+	return true;
+}
+
+/**
+ * @brief Scores and the enter/exit thresholds; a second frame on unchanged particles gives the same list.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSurfaceClassifierTest_Hysteresis::RunTest(const FString& Parameters)
+{
+	const FKawaiiFluidSurfaceParams Params = MakeParams();
+	TestTrue(TEXT("Gradient threshold scores 1"), FMath::IsNearlyEqual(FKawaiiFluidSurfaceClassifier::ComputeScore(0.25f, 100, 50.0f, Params), 1.0f));
+	TestTrue(TEXT("Deficiency threshold scores 1"), FMath::IsNearlyEqual(FKawaiiFluidSurfaceClassifier::ComputeScore(0.0f, 30, 50.0f, Params), 1.0f, 1.0e-5f));
+	TestTrue(TEXT("Full neighborhood scores 0"), FKawaiiFluidSurfaceClassifier::ComputeScore(0.0f, 60, 50.0f, Params) == 0.0f);
+
+	TestTrue(TEXT("Enters at 1"), FKawaiiFluidSurfaceClassifier::ResolveSurface(1.0f, false, Params.ExitRatio));
+	TestFalse(TEXT("Interior stays interior between the thresholds"), FKawaiiFluidSurfaceClassifier::ResolveSurface(0.8f, false, Params.ExitRatio));
+	TestTrue(TEXT("Surface stays surface between the thresholds"), FKawaiiFluidSurfaceClassifier::ResolveSurface(0.8f, true, Params.ExitRatio));
+	TestFalse(TEXT("Surface leaves below the exit ratio"), FKawaiiFluidSurfaceClassifier::ResolveSurface(0.6f, true, Params.ExitRatio));
+
+	TArray<FKawaiiFluidParticle> Particles;
+	AddBlock(Particles, 10, FVector::ZeroVector);
+
+	FKawaiiFluidSurfaceClassifier Classifier;
+	Classifier.Classify(Particles, Params);
+	const TArray<int32> FirstFrame(Classifier.GetSurfaceIndices());
+	Classifier.Classify(Particles, Params);
+	TestTrue(TEXT("Stable on an unchanged frame"), FirstFrame == TArray<int32>(Classifier.GetSurfaceIndices()));
+
+	// Exit ratio 0: nothing that was surface ever leaves
+	for (FKawaiiFluidParticle& Particle : Particles)
+	{
+		Particle.bIsSurfaceParticle = true;
+	}
+	FKawaiiFluidSurfaceParams StickyParams = Params;
+	StickyParams.ExitRatio = 0.0f;
+	Classifier.Classify(Particles, StickyParams);
+	TestEqual(TEXT("Exit ratio 0 keeps every particle on the surface"), Classifier.GetNumSurface(), Particles.Num());
+	return true;
+}
+
+/**
+ * @brief Compaction across several chunks, isolated particles are surface and keep their last normal.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSurfaceClassifierTest_CompactList::RunTest(const FString& Parameters)
+{
+	TArray<FKawaiiFluidParticle> Particles;
+	AddBlock(Particles, 12, FVector(0.0f, 0.0f, 0.0f));
+	AddBlock(Particles, 12, FVector(1000.0f, 0.0f, 0.0f));
+	AddBlock(Particles, 12, FVector(0.0f, -1000.0f, 500.0f));
+	TestTrue(TEXT("Spans several compaction chunks"), Particles.Num() > FKawaiiFluidSurfaceClassifier::ChunkSize);
+
+	FKawaiiFluidParticle& Loner = Particles.AddDefaulted_GetRef();
+	Loner.Position = FVector(5000.0f, 5000.0f, 5000.0f);
+	Loner.NeighborIndices.Add(Particles.Num() - 1);
+	Loner.bIsSurfaceParticle = true;
+	Loner.SurfaceNormal = FVector(0.0f, 0.0f, 1.0f);
+
+	FKawaiiFluidSurfaceClassifier Classifier;
+	Classifier.Classify(Particles, MakeParams());
+
+	TestTrue(TEXT("Compact list matches the flags"), IsListConsistent(Classifier, Particles));
+	TestTrue(TEXT("Isolated particle is surface"), Particles.Last().bIsSurfaceParticle);
+	TestTrue(TEXT("Isolated particle keeps its normal"), Particles.Last().SurfaceNormal.Equals(FVector(0.0f, 0.0f, 1.0f)));
+	TestEqual(TEXT("Surface count is three blocks plus the loner"), Classifier.GetNumSurface() % 3, 1);
+	return true;
+}
+
+#endif
@@ -0,0 +1,419 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "MeshDescription.h"
+#include "Rendering/KawaiiFluidSurfaceMesher.h"
+#include "Simulation/Physics/KawaiiFluidAnisotropySolver.h"
+#include "Simulation/Physics/KawaiiFluidGPUReferenceSolver.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Resources/KawaiiFluidParticleSnapshot.h"
+#include "Simulation/Shaders/KawaiiFluidSimulatorShaders.h"
+#include "Simulation/Utils/KawaiiFluidMortonSort.h"
+#include "Simulation/Utils/KawaiiFluidSparseBrickGrid.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceMesherTest_Sphere,
+	"KawaiiFluid.Rendering.SurfaceMesher.T01_Sphere",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceMesherTest_Anisotropy,
+	"KawaiiFluid.Rendering.SurfaceMesher.T02_Anisotropy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceMesherTest_NarrowBand,
+	"KawaiiFluid.Rendering.SurfaceMesher.T03_NarrowBand",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceMesherTest_MeshDescription,
+	"KawaiiFluid.Rendering.SurfaceMesher.T04_MeshDescription",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FKawaiiFluidSurfaceMesherTest_DamBreakSnapshot,
+	"KawaiiFluid.Rendering.SurfaceMesher.T05_DamBreakSnapshot",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+	constexpr float Spacing = 10.0f;
+
+	/**
+	 * @brief Helper: Lattice particles inside a ball (off the lattice origin so no node sits on a particle).
+	 * @param Center Ball center (cm).
+	 * @param Radius Ball radius (cm).
+	 * @return Particle positions.
+	 */
+	TArray<FVector3f> MakeBall(const FVector3f& Center, float Radius)
+	{
+		const int32 Reach = FMath::FloorToInt(Radius / Spacing);
+		TArray<FVector3f> Positions;
+		for (int32 Z = -Reach; Z <= Reach; ++Z)
+		{
+			for (int32 Y = -Reach; Y <= Reach; ++Y)
+			{
+				for (int32 X = -Reach; X <= Reach; ++X)
+				{
+					const FVector3f Offset = FVector3f(X, Y, Z) * Spacing;
+					if (Offset.Size() <= Radius)
+					{
+						Positions.Add(Center + Offset + FVector3f(0.3f, -0.2f, 0.1f));
+					}
+				}
+			}
+		}
+		return Positions;
+	}
+
+	/**
+	 * @brief Helper: Count the undirected edges and check every directed edge is matched by its reverse.
+	 * @param Mesh Mesh to check.
+	 * @param OutNumEdges Undirected edge count.
+	 * @return True if the mesh is closed and consistently wound.
+	 */
+	bool IsClosed(const FKawaiiFluidSurfaceMesh& Mesh, int32& OutNumEdges)
+	{
+		TMap<TPair<int32, int32>, int32> DirectedEdges;
+		for (int32 i = 0; i < Mesh.Indices.Num(); i += 3)
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				++DirectedEdges.FindOrAdd(TPair<int32, int32>(Mesh.Indices[i + Corner], Mesh.Indices[i + (Corner + 1) % 3]));
+			}
+		}
+
+		bool bClosed = true;
+		for (const TPair<TPair<int32, int32>, int32>& Edge : DirectedEdges)
+		{
+			const int32* Reverse = DirectedEdges.Find(TPair<int32, int32>(Edge.Key.Value, Edge.Key.Key));
+			bClosed &= Reverse && *Reverse == Edge.Value;
+		}
+
+		OutNumEdges = DirectedEdges.Num() / 2;
+		return bClosed;
+	}
+
+	/**
+	 * @brief Helper: Triangles whose winding normal points away from a center.
+	 * @param Mesh Mesh to check.
+	 * @param Center Point inside the fluid (cm).
+	 * @return Number of outward triangles.
+	 */
+	int32 CountOutwardTriangles(const FKawaiiFluidSurfaceMesh& Mesh, const FVector3f& Center)
+	{
+		int32 NumOutward = 0;
+		for (int32 i = 0; i < Mesh.Indices.Num(); i += 3)
+		{
+			const FVector3f& P0 = Mesh.Positions[Mesh.Indices[i]];
+			const FVector3f& P1 = Mesh.Positions[Mesh.Indices[i + 1]];
+			const FVector3f& P2 = Mesh.Positions[Mesh.Indices[i + 2]];
+			const FVector3f FaceNormal = FVector3f::CrossProduct(P1 - P0, P2 - P0);
+			NumOutward += FVector3f::DotProduct(FaceNormal, (P0 + P1 + P2) / 3.0f - Center) > 0.0f ? 1 : 0;
+		}
+		return NumOutward;
+	}
+
+	/**
+	 * @brief Helper: Axis-aligned ellipsoids for every particle.
+	 * @param Num Particle count.
+	 * @param Scales Scale along X, Y and Z.
+	 * @return Snapshot shaped like an anisotropy readback.
+	 */
+	FKawaiiFluidAnisotropySnapshot MakeAlignedAnisotropy(int32 Num, const FVector3f& Scales)
+	{
+		FKawaiiFluidAnisotropySnapshot Anisotropy;
+		Anisotropy.Axis1.Init(FVector4f(1.0f, 0.0f, 0.0f, Scales.X), Num);
+		Anisotropy.Axis2.Init(FVector4f(0.0f, 1.0f, 0.0f, Scales.Y), Num);
+		Anisotropy.Axis3.Init(FVector4f(0.0f, 0.0f, 1.0f, Scales.Z), Num);
+		return Anisotropy;
+	}
+}
+
+/**
+ * @brief A lattice ball away from the origin becomes a closed, outward-wound sphere of genus 0 near its radius.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSurfaceMesherTest_Sphere::RunTest(const FString& Parameters)
+{
+	// Negative brick coordinates on two axes
+	const FVector3f Center(-203.7f, 51.2f, -17.4f);
+	const TArray<FVector3f> Positions = MakeBall(Center, 40.0f);
+
+	FKawaiiFluidSurfaceMesher Mesher;
+	FKawaiiFluidSurfaceMesh Mesh;
+	TestTrue(TEXT("Extracted"), Mesher.Extract(Positions, FKawaiiFluidSurfaceMeshSettings(), Mesh));
+	TestEqual(TEXT("One normal per vertex"), Mesh.Normals.Num(), Mesh.NumVertices());
+
+	int32 NumEdges = 0;
+	TestTrue(TEXT("Closed and consistently wound"), IsClosed(Mesh, NumEdges));
+	TestEqual(TEXT("Euler characteristic of a sphere"), Mesh.NumVertices() - NumEdges + Mesh.NumTriangles(), 2);
+	TestEqual(TEXT("Every triangle faces outward"), CountOutwardTriangles(Mesh, Center), Mesh.NumTriangles());
+
+	float MinRadius = TNumericLimits<float>::Max();
+	float MaxRadius = 0.0f;
+	int32 NumInwardNormals = 0;
+	for (int32 i = 0; i < Mesh.NumVertices(); ++i)
+	{
+		const FVector3f Offset = Mesh.Positions[i] - Center;
+		MinRadius = FMath::Min(MinRadius, Offset.Size());
+		MaxRadius = FMath::Max(MaxRadius, Offset.Size());
+		NumInwardNormals += FVector3f::DotProduct(Mesh.Normals[i], Offset.GetSafeNormal()) < 0.5f ? 1 : 0;
+	}
+	TestTrue(TEXT("Surface hugs the outer particles"), MinRadius > 35.0f && MaxRadius < 50.0f);
+	TestEqual(TEXT("Vertex normals point outward"), NumInwardNormals, 0);
+
+	const FKawaiiFluidSurfaceMeshStats& Stats = Mesher.GetLastStats();
+	TestEqual(TEXT("Stats vertices"), Stats.NumVertices, Mesh.NumVertices());
+	TestEqual(TEXT("Stats triangles"), Stats.NumTriangles, Mesh.NumTriangles());
+
+	TestFalse(TEXT("No particles, no mesh"), Mesher.Extract(TConstArrayView<FVector3f>(), FKawaiiFluidSurfaceMeshSettings(), Mesh));
+	TestEqual(TEXT("Empty extraction resets the mesh"), Mesh.NumTriangles(), 0);
+
+	AddInfo(FString::Printf(TEXT("%d particles: %d vertices, %d triangles, radius %.1f..%.1f"),
+		Positions.Num(), Stats.NumVertices, Stats.NumTriangles, MinRadius, MaxRadius));
+	return true;
+}
+
+/**
+ * @brief Ellipsoids flattened along Z thin a particle sheet; disabled or mismatched anisotropy falls back to spheres.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSurfaceMesherTest_Anisotropy::RunTest(const FString& Parameters)
+{
+	constexpr float SheetZ = 30.0f;
+	TArray<FVector3f> Positions;
+	for (int32 Y = 0; Y < 8; ++Y)
+	{
+		for (int32 X = 0; X < 8; ++X)
+		{
+			Positions.Add(FVector3f(X * Spacing + 0.3f, Y * Spacing - 0.2f, SheetZ + 0.1f));
+		}
+	}
+
+	auto HalfThickness = [SheetZ](const FKawaiiFluidSurfaceMesh& Mesh)
+	{
+		float MaxOffset = 0.0f;
+		for (const FVector3f& Position : Mesh.Positions)
+		{
+			MaxOffset = FMath::Max(MaxOffset, FMath::Abs(Position.Z - SheetZ));
+		}
+		return MaxOffset;
+	};
+
+	FKawaiiFluidSurfaceMesher Mesher;
+	FKawaiiFluidSurfaceMeshSettings Settings;
+	const FKawaiiFluidAnisotropySnapshot Flattened = MakeAlignedAnisotropy(Positions.Num(), FVector3f(1.5f, 1.5f, 0.4f));
+
+	FKawaiiFluidSurfaceMesh Isotropic;
+	FKawaiiFluidSurfaceMesh Anisotropic;
+	TestTrue(TEXT("Isotropic extracted"), Mesher.Extract(Positions, Settings, Isotropic));
+	TestTrue(TEXT("Anisotropic extracted"), Mesher.Extract(Positions, Settings, Anisotropic, &Flattened));
+
+	int32 NumEdges = 0;
+	TestTrue(TEXT("Isotropic sheet closed"), IsClosed(Isotropic, NumEdges));
+	TestTrue(TEXT("Anisotropic sheet closed"), IsClosed(Anisotropic, NumEdges));
+	TestEqual(TEXT("Anisotropic sheet is one body"), Anisotropic.NumVertices() - NumEdges + Anisotropic.NumTriangles(), 2);
+	TestTrue(TEXT("Flattened ellipsoids thin the sheet"), HalfThickness(Anisotropic) < 0.7f * HalfThickness(Isotropic));
+
+	FKawaiiFluidSurfaceMesh Ignored;
+	Settings.bUseAnisotropy = false;
+	Mesher.Extract(Positions, Settings, Ignored, &Flattened);
+	TestTrue(TEXT("bUseAnisotropy off splats spheres"), Ignored.Positions == Isotropic.Positions && Ignored.Indices == Isotropic.Indices);
+
+	Settings.bUseAnisotropy = true;
+	const FKawaiiFluidAnisotropySnapshot Stale = MakeAlignedAnisotropy(Positions.Num() - 1, FVector3f(1.5f, 1.5f, 0.4f));
+	Mesher.Extract(Positions, Settings, Ignored, &Stale);
+	TestTrue(TEXT("Mismatched anisotropy splats spheres"), Ignored.Positions == Isotropic.Positions && Ignored.Indices == Isotropic.Indices);
+
+	AddInfo(FString::Printf(TEXT("Sheet half thickness: %.2f cm isotropic, %.2f cm anisotropic"), HalfThickness(Isotropic), HalfThickness(Anisotropic)));
+	return true;
+}
+
+/**
+ * @brief Bricks seeded only by IsSurface particles give the same surface as the full field with fewer bricks.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSurfaceMesherTest_NarrowBand::RunTest(const FString& Parameters)
+{
+	constexpr float BallRadius = 90.0f;
+	const FVector3f Center(17.0f, -33.0f, 250.0f);
+
+	FKawaiiFluidParticleSnapshot Snapshot;
+	Snapshot.Positions = MakeBall(Center, BallRadius);
+	Snapshot.NumParticles = Snapshot.Positions.Num();
+	for (const FVector3f& Position : Snapshot.Positions)
+	{
+		Snapshot.Flags.Add(FVector3f::Dist(Position, Center) > BallRadius - 1.5f * Spacing ? EGPUParticleFlags::IsSurface : EGPUParticleFlags::None);
+	}
+
+	FKawaiiFluidSurfaceMesher Mesher;
+	FKawaiiFluidSurfaceMeshSettings Settings;
+	FKawaiiFluidSurfaceMesh Band;
+	TestTrue(TEXT("Band extracted"), Mesher.Extract(Snapshot, Settings, Band));
+	const FKawaiiFluidSurfaceMeshStats BandStats = Mesher.GetLastStats();
+
+	Settings.bNarrowBand = false;
+	FKawaiiFluidSurfaceMesh Full;
+	TestTrue(TEXT("Full field extracted"), Mesher.Extract(Snapshot, Settings, Full));
+	const FKawaiiFluidSurfaceMeshStats FullStats = Mesher.GetLastStats();
+
+	int32 NumEdges = 0;
+	TestTrue(TEXT("Band mesh closed"), IsClosed(Band, NumEdges));
+	TestEqual(TEXT("Band mesh is a sphere"), Band.NumVertices() - NumEdges + Band.NumTriangles(), 2);
+	TestEqual(TEXT("Same vertex count as the full field"), Band.NumVertices(), Full.NumVertices());
+	TestEqual(TEXT("Same triangle count as the full field"), Band.NumTriangles(), Full.NumTriangles());
+	TestTrue(TEXT("Band skips the core bricks"), BandStats.NumBricks < FullStats.NumBricks);
+
+	// Vertices are emitted in brick order, which differs between the two; compare as sorted sets
+	auto SortedPositions = [](const FKawaiiFluidSurfaceMesh& Mesh)
+	{
+		TArray<FVector3f> Sorted = Mesh.Positions;
+		Sorted.Sort([](const FVector3f& A, const FVector3f& B)
+		{
+			return A.X != B.X ? A.X < B.X : (A.Y != B.Y ? A.Y < B.Y : A.Z < B.Z);
+		});
+		return Sorted;
+	};
+	TestTrue(TEXT("Same vertices as the full field"), SortedPositions(Band) == SortedPositions(Full));
+
+	AddInfo(FString::Printf(TEXT("%d particles: %d bricks (%.1f KB) in band, %d bricks (%.1f KB) full"),
+		Snapshot.Num(), BandStats.NumBricks, BandStats.AllocatedBytes / 1024.0, FullStats.NumBricks, FullStats.AllocatedBytes / 1024.0));
+	return true;
+}
+
+/**
+ * @brief Mesh description conversion: one vertex per mesh vertex, one polygon and three instances per triangle.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSurfaceMesherTest_MeshDescription::RunTest(const FString& Parameters)
+{
+	FKawaiiFluidSurfaceMesher Mesher;
+	FKawaiiFluidSurfaceMesh Mesh;
+	TestTrue(TEXT("Extracted"), Mesher.Extract(MakeBall(FVector3f(0.0f, 0.0f, 100.0f), 20.0f), FKawaiiFluidSurfaceMeshSettings(), Mesh));
+
+	FMeshDescription MeshDescription;
+	Mesh.ToMeshDescription(MeshDescription);
+
+	TestEqual(TEXT("Vertices"), MeshDescription.Vertices().Num(), Mesh.NumVertices());
+	TestEqual(TEXT("Vertex instances"), MeshDescription.VertexInstances().Num(), Mesh.NumTriangles() * 3);
+	TestEqual(TEXT("Polygons"), MeshDescription.Polygons().Num(), Mesh.NumTriangles());
+	TestEqual(TEXT("One polygon group"), MeshDescription.PolygonGroups().Num(), 1);
+	return true;
+}
+
+/**
+ * @brief Recorded dam-break frame from the GPU reference solver, full field and narrow band, spheres and ellipsoids.
+ * @param Parameters Test parameters.
+ * @return True if the test passed.
+ */
+bool FKawaiiFluidSurfaceMesherTest_DamBreakSnapshot::RunTest(const FString& Parameters)
+{
+	constexpr int32 Side = 14;
+	constexpr int32 NumSubsteps = 60;
+	constexpr float BoundsHalfExtent = 100.0f;
+
+	FGPUFluidSimulationParams Params;
+	Params.SmoothingRadius = 20.0f;
+	Params.CellSize = 20.0f;
+	Params.ParticleRadius = 5.0f;
+	Params.ParticleMass = 1.0f;
+	Params.DeltaTime = 1.0f / 120.0f;
+	Params.SolverIterations = 3;
+	Params.BoundsMin = FVector3f(-BoundsHalfExtent);
+	Params.BoundsMax = FVector3f(BoundsHalfExtent);
+	Params.BoundsExtent = FVector3f(BoundsHalfExtent);
+	Params.PrecomputeKernelCoefficients();
+
+	FRandomStream Random(11);
+	TArray<FGPUFluidParticle> Particles;
+	for (int32 Z = 0; Z < Side; ++Z)
+	{
+		for (int32 Y = 0; Y < Side; ++Y)
+		{
+			for (int32 X = 0; X < Side; ++X)
+			{
+				FGPUFluidParticle& Particle = Particles.AddDefaulted_GetRef();
+				const FVector3f Jitter(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f));
+				Particle.Position = FVector3f(-95.0f) + FVector3f(X, Y, Z) * Spacing + Jitter;
+				Particle.PredictedPosition = Particle.Position;
+				Particle.ParticleID = Particles.Num() - 1;
+				Particle.SourceID = 0;
+			}
+		}
+	}
+
+	FKawaiiFluidGPUReferenceSolver Solver;
+	for (int32 Substep = 0; Substep < NumSubsteps; ++Substep)
+	{
+		Solver.SimulateSubstep(Particles, Params);
+		Solver.EndFrame();
+	}
+
+	FKawaiiFluidParticleSnapshot Snapshot;
+	Snapshot.NumParticles = Particles.Num();
+	for (const FGPUFluidParticle& Particle : Particles)
+	{
+		Snapshot.Positions.Add(Particle.Position);
+		Snapshot.Velocities.Add(Particle.Velocity);
+	}
+
+	// Neighbors and density ellipsoids the way an offline bake would rebuild them from the recording
+	FKawaiiFluidSparseBrickGrid Grid;
+	FKawaiiFluidMortonSorter Sorter;
+	FKawaiiFluidNeighborCSR Neighbors;
+	Neighbors.BuildFromPositions(Snapshot.Positions, Params.SmoothingRadius, Grid, Sorter);
+
+	FKawaiiFluidAnisotropyParams AnisotropyParams;
+	AnisotropyParams.bEnabled = true;
+	AnisotropyParams.UpdateInterval = 1;
+	AnisotropyParams.bEnableTemporalSmoothing = false;
+	FKawaiiFluidAnisotropySolver AnisotropySolver;
+	AnisotropySolver.Update(AnisotropyParams, Snapshot.Positions, Snapshot.Velocities, Neighbors, Params.SmoothingRadius);
+	const TSharedRef<FKawaiiFluidAnisotropySnapshot> Anisotropy = AnisotropySolver.MakeSnapshot(1);
+
+	FKawaiiFluidSurfaceMeshSettings Settings;
+	Settings.ParticleRadius = Params.ParticleRadius;
+
+	FKawaiiFluidSurfaceMesher Mesher;
+	FKawaiiFluidSurfaceMesh Mesh;
+	int32 NumEdges = 0;
+
+	TestTrue(TEXT("Spheres extracted"), Mesher.Extract(Snapshot, Settings, Mesh));
+	TestTrue(TEXT("Spheres closed"), IsClosed(Mesh, NumEdges));
+	const FKawaiiFluidSurfaceMeshStats Spheres = Mesher.GetLastStats();
+
+	TestTrue(TEXT("Ellipsoids extracted"), Mesher.Extract(Snapshot, Settings, Mesh, &Anisotropy.Get()));
+	TestTrue(TEXT("Ellipsoids closed"), IsClosed(Mesh, NumEdges));
+	const FKawaiiFluidSurfaceMeshStats Ellipsoids = Mesher.GetLastStats();
+
+	// Narrow band seeded by particles short of neighbors
+	int32 MaxNeighbors = 0;
+	for (int32 i = 0; i < Neighbors.Num(); ++i)
+	{
+		MaxNeighbors = FMath::Max(MaxNeighbors, Neighbors.GetNeighbors(i).Num());
+	}
+	for (int32 i = 0; i < Neighbors.Num(); ++i)
+	{
+		Snapshot.Flags.Add(Neighbors.GetNeighbors(i).Num() < MaxNeighbors * 0.7f ? EGPUParticleFlags::IsSurface : EGPUParticleFlags::None);
+	}
+	TestTrue(TEXT("Band extracted"), Mesher.Extract(Snapshot, Settings, Mesh, &Anisotropy.Get()));
+	const FKawaiiFluidSurfaceMeshStats Band = Mesher.GetLastStats();
+
+	auto Describe = [](const TCHAR* Label, const FKawaiiFluidSurfaceMeshStats& Stats)
+	{
+		return FString::Printf(TEXT("%s: %d bricks, %d splats, %d triangles, splat %.2f ms, contour %.2f ms, %.1f KB"),
+			Label, Stats.NumBricks, Stats.NumSplats, Stats.NumTriangles, Stats.SplatMs, Stats.ContourMs, Stats.AllocatedBytes / 1024.0);
+	};
+	AddInfo(FString::Printf(TEXT("%d particles after %d substeps"), Snapshot.Num(), NumSubsteps));
+	AddInfo(Describe(TEXT("Spheres"), Spheres));
+	AddInfo(Describe(TEXT("Ellipsoids"), Ellipsoids));
+	AddInfo(Describe(TEXT("Ellipsoids, narrow band"), Band));
+	return true;
+}
+
+#endif
@@ -5,8 +5,11 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Resources/KawaiiFluidParticleSnapshot.h"
+#include "Simulation/Managers/KawaiiFluidSpawnRequestRing.h"
 #include "Core/KawaiiFluidSimulationTypes.h"
 #include "Core/KawaiiFluidRenderingTypes.h"
+#include "Rendering/KawaiiFluidDebugPointBatcher.h"
 #include "KawaiiFluidVolume.generated.h"
 
 class UKawaiiFluidVolumeComponent;
@@ -178,23 +181,20 @@ public:
 	/** Queue multiple spawn requests at once (batch version for efficiency) */
 	void QueueSpawnRequests(const TArray<FVector>& Positions, const TArray<FVector>& Velocities, int32 SourceID = -1);
 
+	/** Queue prebuilt spawn requests (Mass/Radius <= 0 are filled from the preset) */
+	void QueueSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests);
+
 	/** Get number of pending spawn requests */
 	UFUNCTION(BlueprintPure, Category = "Spawn")
-	int32 GetPendingSpawnCount() const { return PendingSpawnRequests.Num(); }
+	int32 GetPendingSpawnCount() const { return SpawnRequestRing.IsValid() ? SpawnRequestRing->Num() : 0; }
 
 	/** Clear all pending spawn requests */
 	UFUNCTION(BlueprintCallable, Category = "Spawn")
-	void ClearPendingSpawnRequests() { PendingSpawnRequests.Empty(); }
+	void ClearPendingSpawnRequests();
 
 	/** Clear pending spawn requests for a specific SourceID */
 	UFUNCTION(BlueprintCallable, Category = "Spawn")
-	void ClearPendingSpawnRequestsForSource(int32 SourceID)
-	{
-		PendingSpawnRequests.RemoveAll([SourceID](const FGPUSpawnRequest& Request)
-		{
-			return Request.SourceID == SourceID;
-		});
-	}
+	void ClearPendingSpawnRequestsForSource(int32 SourceID);
 
 	/** Process pending spawn requests (called automatically during simulation) */
 	void ProcessPendingSpawnRequests();
@@ -239,8 +239,11 @@ protected:
 	// Spawn Request Queue
 	//========================================
 
-	/** Pending spawn requests to be processed in the next simulation tick */
-	TArray<FGPUSpawnRequest> PendingSpawnRequests;
+	/** Pending spawn requests (emitters produce, ProcessPendingSpawnRequests consumes); created on first use */
+	TUniquePtr<FKawaiiFluidSpawnRequestRing> SpawnRequestRing;
+
+	/** Get the spawn request ring, creating it on first use */
+	FKawaiiFluidSpawnRequestRing& GetSpawnRequestRing();
 
 	//========================================
 	// Internal
@@ -279,7 +282,7 @@ private:
 	// Debug Draw Helpers
 	//========================================
 
-	/** Draw debug particles using DrawDebugPoint */
+	/** Draw debug particles as one batched, decimated point buffer */
 	void DrawDebugParticles();
 
 	/** Draw static boundary particles for debug visualization */
@@ -309,38 +312,31 @@ private:
 	bool bEditorRenderingInitialized = false;
 #endif
 
-	/** Compute debug color for a particle */
-	FColor ComputeDebugDrawColor(int32 ParticleIndex, int32 TotalCount, const FVector& Position, float Density, bool bNearBoundary = false, int32 ZOrderArrayIndex = -1) const;
+	/** Batched debug point buffer (rebuilt only when readback data, settings or view change) */
+	FKawaiiFluidDebugPointBatcher DebugPointBatcher;
 
-	/** Cached bounds for debug visualization (auto-computed) */
-	FVector DebugDrawBoundsMin = FVector::ZeroVector;
-	FVector DebugDrawBoundsMax = FVector::ZeroVector;
+	/** Reused Z-Order index readback for debug point builds */
+	TArray<int32> DebugPointZOrderIndices;
 
 	//========================================
 	// Shadow Readback Cache (GPU Mode)
 	//========================================
 
-	/** Cached shadow positions from last successful readback */
-	TArray<FVector> CachedShadowPositions;
+	/** Particle snapshot of the last shadow readback (held, not copied) */
+	TSharedPtr<const FKawaiiFluidParticleSnapshot> ShadowSnapshot;
+
+	/** Anisotropy snapshot taken together with ShadowSnapshot, for ellipsoid shadows */
+	TSharedPtr<const FKawaiiFluidAnisotropySnapshot> ShadowAnisotropySnapshot;
 
-	/** Cached shadow velocities for prediction */
+	/** Shadow velocities of the current frame (from ShadowSnapshot or CPU particles) */
 	TArray<FVector> CachedShadowVelocities;
 
-	/** Cached neighbor counts for isolation detection */
+	/** Neighbor counts of the current frame for isolation detection */
 	TArray<int32> CachedNeighborCounts;
 
 	/** Previous frame neighbor counts for state change detection (non-isolated -> isolated) */
 	TArray<int32> PrevNeighborCounts;
 
-	/** Cached anisotropy axis 1 (xyz=direction, w=scale) for ellipsoid shadows */
-	TArray<FVector4> CachedAnisotropyAxis1;
-
-	/** Cached anisotropy axis 2 */
-	TArray<FVector4> CachedAnisotropyAxis2;
-
-	/** Cached anisotropy axis 3 */
-	TArray<FVector4> CachedAnisotropyAxis3;
-
 	/** Frame number of last successful shadow readback */
 	uint64 LastShadowReadbackFrame = 0;
 
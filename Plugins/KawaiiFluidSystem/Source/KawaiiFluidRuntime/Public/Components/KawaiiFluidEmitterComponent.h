@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
 #include "KawaiiFluidEmitterComponent.generated.h"
 
 class AKawaiiFluidEmitter;
@@ -84,6 +85,7 @@ enum class EKawaiiFluidEmitterShapeType : uint8
  * @param StreamParticleSpacing Internal spacing cache
  * @param StreamLayerSpacingRatio Internal HCP ratio for stream
  * @param CachedSourceID Unique ID allocated from Subsystem
+ * @param SpawnRequestBuffer Pooled spawn-request buffer reused by every spawn call
  */
 UCLASS(ClassGroup = (KawaiiFluid), meta = (BlueprintSpawnableComponent, DisplayName = "Kawaii Fluid Emitter"))
 class KAWAIIFLUIDRUNTIME_API UKawaiiFluidEmitterComponent : public USceneComponent
@@ -262,11 +264,11 @@ protected:
 
 	void SpawnStreamLayer(FVector Position, FVector LayerDirection, FVector VelocityDirection, float Speed, float Radius, float Spacing);
 
-	void SpawnStreamLayerBatch(FVector Position, FVector LayerDirection, FVector VelocityDirection, 
+	void SpawnStreamLayerBatch(FVector Position, FVector LayerDirection, FVector VelocityDirection,
 	                           float Speed, float Radius, float Spacing,
-	                           TArray<FVector>& OutPositions, TArray<FVector>& OutVelocities);
+	                           TArray<FGPUSpawnRequest>& OutRequests);
 
-	void QueueSpawnRequest(const TArray<FVector>& Positions, const TArray<FVector>& Velocities);
+	void QueueSpawnRequests(const TArray<FGPUSpawnRequest>& Requests);
 
 	UKawaiiFluidSimulationModule* GetSimulationModule() const;
 
@@ -309,6 +311,8 @@ protected:
 
 	int32 CachedSourceID = -1;
 
+	TArray<FGPUSpawnRequest> SpawnRequestBuffer;
+
 	void RegisterToVolume();
 
 	void UnregisterFromVolume();
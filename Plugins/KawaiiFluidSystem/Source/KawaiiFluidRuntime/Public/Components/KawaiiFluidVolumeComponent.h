@@ -19,7 +19,7 @@ class UNiagaraSystem;
  * @param bUniformSize Use uniform (cube) size for simulation volume
  * @param UniformVolumeSize Cube dimensions in cm
  * @param VolumeSize Per-axis dimensions in cm
- * @param bUseUnlimitedSize Disable volume boundaries entirely
+ * @param bUseUnlimitedSize Disable volume boundaries entirely (neighbor search uses hybrid tiling, whose 3-bit tile hash can merge distant clusters)
  * @param Preset The fluid preset defining physics and rendering
  * @param MaxParticleCount Maximum GPU buffer capacity for this volume
  * @param bUseWorldCollision Enable interaction with world geometry
@@ -41,6 +41,8 @@ class UNiagaraSystem;
  * @param IsolationNeighborThreshold Neighbor count for isolation check
  * @param DebugDrawMode Particle visualization mode
  * @param ISMDebugColor Color for ISM debug particles
+ * @param DebugPointBudget Max debug points submitted per frame in Point modes (0 = unlimited)
+ * @param DebugPointDecimationPixels Screen-space cell size for debug point decimation (0 = off)
  * @param bShowStaticBoundaryParticles Visual debug for boundaries
  * @param StaticBoundaryPointSize Debug point size
  * @param StaticBoundaryColor Debug point color
@@ -174,6 +176,16 @@ public:
 	          meta = (EditCondition = "DebugDrawMode == EKawaiiFluidDebugDrawMode::ISM", EditConditionHides))
 	FLinearColor ISMDebugColor = FLinearColor(0.2f, 0.5f, 1.0f, 0.8f);
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|Debug|Draw Mode",
+	          meta = (ClampMin = "0", UIMin = "1000", UIMax = "200000",
+	                  EditCondition = "DebugDrawMode != EKawaiiFluidDebugDrawMode::None && DebugDrawMode != EKawaiiFluidDebugDrawMode::ISM"))
+	int32 DebugPointBudget = 50000;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|Debug|Draw Mode",
+	          meta = (ClampMin = "0.0", ClampMax = "16.0",
+	                  EditCondition = "DebugDrawMode != EKawaiiFluidDebugDrawMode::None && DebugDrawMode != EKawaiiFluidDebugDrawMode::ISM"))
+	float DebugPointDecimationPixels = 2.0f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Volume|Debug|Boundary")
 	bool bShowStaticBoundaryParticles = false;
 
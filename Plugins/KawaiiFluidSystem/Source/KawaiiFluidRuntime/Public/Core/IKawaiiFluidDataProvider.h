@@ -74,4 +74,10 @@ public:
 	 * @return Pointer to GPU simulator, or nullptr if not using GPU.
 	 */
 	virtual FKawaiiFluidSimulator* GetGPUSimulator() const { return nullptr; }
+
+	/**
+	 * @brief Get a shared reference to the GPU fluid simulator (for consumers that outlive a frame).
+	 * @return Shared GPU simulator, or nullptr if not using GPU.
+	 */
+	virtual TSharedPtr<FKawaiiFluidSimulator> GetGPUSimulatorShared() const { return nullptr; }
 };
@@ -29,6 +29,9 @@
  * @param bIsSurfaceParticle Flag for rendering optimization.
  * @param SurfaceNormal Normal vector used for surface tension calculation.
  * @param bTrailSpawned Flag for trail VFX spawning.
+ * @param bIsSleeping Particle belongs to a sleeping island and is skipped by the CPU solver.
+ * @param SleepFrameCount Consecutive frames the particle's island stayed below the sleep threshold.
+ * @param SleepNeighborCount Neighbor count recorded when the island fell asleep (changes wake it).
  */
 USTRUCT(BlueprintType)
 struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticle
@@ -86,6 +89,13 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticle
 
 	bool bTrailSpawned;
 
+	UPROPERTY(BlueprintReadOnly, Category = "Particle")
+	bool bIsSleeping;
+
+	int32 SleepFrameCount;
+
+	int32 SleepNeighborCount;
+
 	FKawaiiFluidParticle()
 		: Position(FVector::ZeroVector)
 		, PredictedPosition(FVector::ZeroVector)
@@ -105,6 +115,9 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticle
 		, bIsSurfaceParticle(false)
 		, SurfaceNormal(FVector::ZeroVector)
 		, bTrailSpawned(false)
+		, bIsSleeping(false)
+		, SleepFrameCount(0)
+		, SleepNeighborCount(0)
 	{
 	}
 
@@ -127,6 +140,9 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticle
 		, bIsSurfaceParticle(false)
 		, SurfaceNormal(FVector::ZeroVector)
 		, bTrailSpawned(false)
+		, bIsSleeping(false)
+		, SleepFrameCount(0)
+		, SleepNeighborCount(0)
 	{
 	}
 };
@@ -40,6 +40,18 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnPresetPropertyChanged, UKawaiiFluidPreset
  * @param SubstepDeltaTime Target time step for simulation stability.
  * @param MaxSubsteps Upper limit on the number of substeps per frame.
  * @param SolverIterations XPBD constraint solver iterations (4-6 recommended for water).
+ * @param bEnableAdaptiveSubstepping Chooses CPU substep sizes from a CFL condition instead of SubstepDeltaTime.
+ * @param CFLNumber Fraction of the smoothing radius the fastest particle may travel per substep.
+ * @param MaxAdaptiveSubstepDeltaTime Largest adaptive substep (calm fluid).
+ * @param MaxAdaptiveSubsteps Per-frame ceiling on adaptive substeps (remaining time is dropped).
+ * @param bEnableSolverEarlyExit Stops density iterations once the density error is within tolerance (CPU).
+ * @param DensityErrorTolerance Average compression error (%) below which iterations may stop.
+ * @param MaxDensityErrorTolerance Maximum per-particle compression error (%) below which iterations may stop.
+ * @param MinSolverIterations Iterations always run before an early exit.
+ * @param MaxSolverIterationsPerFrame Per-frame ceiling on density iterations over all substeps, per LOD tier (0 = none).
+ * @param bFuseNeighborForcePasses Runs CPU viscosity, cohesion and stack pressure as one neighbor sweep instead of three (KawaiiFluid.Performance.Micro.NeighborForces).
+ * @param bSymmetricNeighborPairs Evaluates each neighbor pair once in the fused sweep (per-range accumulators).
+ * @param CPUZOrderSortInterval Frames between Z-order re-sorts of the CPU particle array (0 = never; the simulation module remaps particle indices by ParticleID).
  * @param ComplianceExponent Scaling factor for compressibility based on SmoothingRadius.
  * @param Gravity Acceleration vector applied to all fluid particles.
  * @param FluidName Unique identifier for collision events (e.g., "Lava", "Water").
@@ -64,6 +76,17 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnPresetPropertyChanged, UKawaiiFluidPreset
  * @param ArtificialPressure Strength of the PBF tensile instability correction (anti-clumping).
  * @param ArtificialPressureExponent Sharpness of the anti-clumping effect.
  * @param ArtificialPressureDeltaQ Reference distance ratio for tensile correction.
+ * @param bEnableSimulationLOD Simulates grid cells far from every view at a coarser step (CPU solver).
+ * @param LODFarDistance View distance beyond which a cell runs the far tier (cm).
+ * @param LODFrozenDistance View distance beyond which a cell is frozen as a static snapshot (cm).
+ * @param LODHysteresis Fraction of a tier distance a cell must cross before it switches tier.
+ * @param LODFarSubstepStride Fine substeps covered by one coarse far-tier substep.
+ * @param LODFarSolverIterations Density solver iterations for the far tier.
+ * @param bEnableSurfaceClassification Classifies surface particles and their normals after each CPU frame.
+ * @param SurfaceGradientThreshold Normalized color-field gradient that marks a surface particle.
+ * @param SurfaceNeighborDeficiency Fraction of the interior neighbor count below which a particle is surface (0 = off).
+ * @param SurfaceExitRatio Fraction of the entry score a surface particle must drop below to become interior.
+ * @param SurfaceNormalSmoothing Weight of the previous frame's normal for particles that stay on the surface.
  * @param SurfaceTensionActivationRatio Radius ratio where surface tension starts.
  * @param SurfaceTensionFalloffRatio Radius ratio where surface tension reaches zero.
  * @param SurfaceTensionSurfaceThreshold Neighbor count for identifying surface particles.
@@ -158,6 +181,51 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver", meta = (ClampMin = "1", ClampMax = "10"))
 	int32 SolverIterations = 3;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|Adaptive")
+	bool bEnableAdaptiveSubstepping = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|Adaptive",
+		meta = (EditCondition = "bEnableAdaptiveSubstepping", ClampMin = "0.05", ClampMax = "1.0"))
+	float CFLNumber = 0.4f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|Adaptive",
+		meta = (EditCondition = "bEnableAdaptiveSubstepping", ClampMin = "0.001", ClampMax = "0.05"))
+	float MaxAdaptiveSubstepDeltaTime = 1.0f / 60.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|Adaptive",
+		meta = (EditCondition = "bEnableAdaptiveSubstepping", ClampMin = "1", ClampMax = "64"))
+	int32 MaxAdaptiveSubsteps = 16;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|Adaptive")
+	bool bEnableSolverEarlyExit = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|Adaptive",
+		meta = (EditCondition = "bEnableSolverEarlyExit", ClampMin = "0.01", ClampMax = "10.0", Units = "Percent"))
+	float DensityErrorTolerance = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|Adaptive",
+		meta = (EditCondition = "bEnableSolverEarlyExit", ClampMin = "0.1", ClampMax = "50.0", Units = "Percent"))
+	float MaxDensityErrorTolerance = 5.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|Adaptive",
+		meta = (EditCondition = "bEnableSolverEarlyExit", ClampMin = "1", ClampMax = "10"))
+	int32 MinSolverIterations = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|Adaptive",
+		meta = (ClampMin = "0", ClampMax = "200"))
+	int32 MaxSolverIterationsPerFrame = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|CPU")
+	bool bFuseNeighborForcePasses = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|CPU",
+		meta = (EditCondition = "bFuseNeighborForcePasses"))
+	bool bSymmetricNeighborPairs = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver|CPU",
+		meta = (ClampMin = "0", ClampMax = "600"))
+	int32 CPUZOrderSortInterval = 8;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Solver", meta = (ClampMin = "0.0", ClampMax = "10.0"))
 	float ComplianceExponent = 4.0f;
 
@@ -257,6 +325,56 @@ public:
 
 	float ArtificialPressureDeltaQ = 0.0f;
 
+	//========================================
+	// Physics | Simulation | LOD
+	//========================================
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|LOD")
+	bool bEnableSimulationLOD = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|LOD",
+		meta = (EditCondition = "bEnableSimulationLOD", ClampMin = "100.0", Units = "cm"))
+	float LODFarDistance = 3000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|LOD",
+		meta = (EditCondition = "bEnableSimulationLOD", ClampMin = "100.0", Units = "cm"))
+	float LODFrozenDistance = 10000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|LOD",
+		meta = (EditCondition = "bEnableSimulationLOD", ClampMin = "0.0", ClampMax = "0.5"))
+	float LODHysteresis = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|LOD",
+		meta = (EditCondition = "bEnableSimulationLOD", ClampMin = "1", ClampMax = "8"))
+	int32 LODFarSubstepStride = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|LOD",
+		meta = (EditCondition = "bEnableSimulationLOD", ClampMin = "1", ClampMax = "10"))
+	int32 LODFarSolverIterations = 1;
+
+	//========================================
+	// Physics | Simulation | Surface Detection
+	//========================================
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Surface Detection")
+	bool bEnableSurfaceClassification = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Surface Detection",
+		meta = (EditCondition = "bEnableSurfaceClassification", ClampMin = "0.05", ClampMax = "1.0"))
+	float SurfaceGradientThreshold = 0.25f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Surface Detection",
+		meta = (EditCondition = "bEnableSurfaceClassification", ClampMin = "0.0", ClampMax = "0.95"))
+	float SurfaceNeighborDeficiency = 0.6f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Surface Detection",
+		meta = (EditCondition = "bEnableSurfaceClassification", ClampMin = "0.0", ClampMax = "1.0"))
+	float SurfaceExitRatio = 0.7f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Simulation|Surface Detection",
+		meta = (EditCondition = "bEnableSurfaceClassification", ClampMin = "0.0", ClampMax = "0.95"))
+	float SurfaceNormalSmoothing = 0.5f;
+
 	//========================================
 	// Physics | Simulation | Surface Tension
 	//========================================
@@ -17,9 +17,17 @@ class FKawaiiFluidDensityConstraint;
 class FKawaiiFluidViscositySolver;
 class FKawaiiFluidAdhesionSolver;
 class FKawaiiFluidStackPressureSolver;
+class FKawaiiFluidNeighborForceSolver;
+class FKawaiiFluidIslandSolver;
+class FKawaiiFluidLODSolver;
+class FKawaiiFluidSurfaceClassifier;
+class FKawaiiFluidParticleSubset;
+class FKawaiiFluidMortonSorter;
 class FKawaiiFluidSimulator;
 class FKawaiiFluidRenderResource;
 struct FGPUFluidSimulationParams;
+struct FKawaiiFluidBoundaryBox;
+struct FKawaiiFluidStatsAccumulator;
 
 /**
  * @brief Stateless Simulation Context containing pure simulation logic.
@@ -31,7 +39,23 @@ struct FGPUFluidSimulationParams;
  * @param ViscositySolver Solver for applying XSPH-based viscosity.
  * @param AdhesionSolver Solver for surface tension and cohesion forces.
  * @param StackPressureSolver Solver for transferring weight between stacked attached particles.
+ * @param NeighborForceSolver Fused viscosity/cohesion/stack pressure neighbor pass (preset bFuseNeighborForcePasses).
+ * @param IslandSolver Island detection and sleeping for the CPU solver (preset sleeping settings).
+ * @param LODSolver Distance-based simulation LOD tiers for the CPU solver (preset LOD settings).
+ * @param SurfaceClassifier Surface particles, normals and compact surface list of the CPU solver (preset surface detection).
+ * @param SolveSubset Particle subset the CPU substeps run on when sleeping or LOD partitions the particles.
+ * @param MortonSorter Z-order sort of the CPU particle array (preset CPUZOrderSortInterval).
+ * @param ZOrderScratch Gather buffer of the Z-order reorder.
+ * @param FramesSinceZOrderSort CPU frames simulated since the last Z-order sort.
+ * @param SolverIterationsOverride Density solver iterations used instead of the preset's (0 = preset).
+ * @param TierSolverIterations Density iterations run this frame by the current LOD tier (MaxSolverIterationsPerFrame budget).
+ * @param bSolvingSubset The CPU substeps run on SolveSubset, whose read-only neighbors are pinned and not solved.
  * @param bSolversInitialized Internal flag indicating if the solvers have been initialized.
+ * @param LastSubstepTimings Per-stage wall-clock timings of the most recent CPU substep.
+ * @param FrameSubstepTimings Stage timings summed over the current CPU frame, published by CollectSimulationStats.
+ * @param FrameIterationErrors (Iteration, density error %) pairs of the current CPU frame, published by CollectSimulationStats.
+ * @param LastAdaptiveStepStats Substep sizes and solver iterations of the last CPU frame (adaptive stepping / early exit).
+ * @param LastParticleBounds Particle AABB reduced during the final CPU substep of the last frame.
  * @param GPUSimulator The GPU simulator instance for compute-shader based simulation.
  * @param RenderResource Shared resources for batched rendering across multiple components.
  * @param PersistentBoneTransforms Bone transforms from the previous frame used for velocity calculation.
@@ -121,6 +145,40 @@ public:
 		float SubstepDT
 	);
 
+	virtual void SimulateCPU(
+		TArray<FKawaiiFluidParticle>& Particles,
+		const UKawaiiFluidPresetDataAsset* Preset,
+		const FKawaiiFluidSimulationParams& Params,
+		FKawaiiFluidSpatialHash& SpatialHash,
+		float DeltaTime,
+		float& AccumulatedTime
+	);
+
+	static void ApplyBoundsContainment(
+		TArray<FKawaiiFluidParticle>& Particles,
+		const FBox& Bounds,
+		float ParticleRadius,
+		float Bounciness,
+		float Friction
+	);
+
+	const FKawaiiFluidSubstepTimings& GetLastSubstepTimings() const { return LastSubstepTimings; }
+
+	/** Island/sleep state of the CPU solver (null until solvers are initialized) */
+	const FKawaiiFluidIslandSolver* GetIslandSolver() const { return IslandSolver.Get(); }
+
+	/** Simulation LOD tiers of the CPU solver (null until solvers are initialized) */
+	const FKawaiiFluidLODSolver* GetLODSolver() const { return LODSolver.Get(); }
+
+	/** Surface particle list of the last CPU frame (null until solvers are initialized) */
+	const FKawaiiFluidSurfaceClassifier* GetSurfaceClassifier() const { return SurfaceClassifier.Get(); }
+
+	/** Substeps and solver iterations of the most recent SimulateCPU call */
+	const FKawaiiFluidAdaptiveStepStats& GetLastAdaptiveStepStats() const { return LastAdaptiveStepStats; }
+
+	/** AABB of the particle positions after the most recent SimulateCPU call (invalid if empty) */
+	const FBox& GetLastParticleBounds() const { return LastParticleBounds; }
+
 	void RunInitializationSimulation(
 		const UKawaiiFluidPresetDataAsset* Preset,
 		const FKawaiiFluidSimulationParams& Params,
@@ -209,7 +267,8 @@ protected:
 	);
 
 	virtual void CollectSimulationStats(
-		const TArray<FKawaiiFluidParticle>& Particles,
+		const FKawaiiFluidStatsAccumulator& FrameStats,
+		int32 ParticleCount,
 		const UKawaiiFluidPresetDataAsset* Preset,
 		int32 SubstepCount,
 		bool bIsGPU
@@ -250,10 +309,67 @@ protected:
 
 	TSharedPtr<FKawaiiFluidStackPressureSolver> StackPressureSolver;
 
+	TSharedPtr<FKawaiiFluidNeighborForceSolver> NeighborForceSolver;
+
+	TSharedPtr<FKawaiiFluidIslandSolver> IslandSolver;
+
+	TSharedPtr<FKawaiiFluidLODSolver> LODSolver;
+
+	TSharedPtr<FKawaiiFluidSurfaceClassifier> SurfaceClassifier;
+
+	TSharedPtr<FKawaiiFluidParticleSubset> SolveSubset;
+
+	TSharedPtr<FKawaiiFluidMortonSorter> MortonSorter;
+
+	TArray<FKawaiiFluidParticle> ZOrderScratch;
+
+	int32 FramesSinceZOrderSort = 0;
+
+	int32 SolverIterationsOverride = 0;
+
+	int32 TierSolverIterations = 0;
+
+	bool bSolvingSubset = false;
+
 	bool bSolversInitialized = false;
 
+	FKawaiiFluidSubstepTimings LastSubstepTimings;
+
+	FKawaiiFluidSubstepTimings FrameSubstepTimings;
+
+	TArray<TPair<int32, float>> FrameIterationErrors;
+
+	FKawaiiFluidAdaptiveStepStats LastAdaptiveStepStats;
+
+	FBox LastParticleBounds = FBox(ForceInit);
+
 	void EnsureSolversInitialized(const UKawaiiFluidPresetDataAsset* Preset);
 
+	void SortParticlesZOrder(TArray<FKawaiiFluidParticle>& Particles, float CellSize);
+
+	bool RunSubstepsCPU(
+		TArray<FKawaiiFluidParticle>& Particles,
+		const UKawaiiFluidPresetDataAsset* Preset,
+		const FKawaiiFluidSimulationParams& Params,
+		FKawaiiFluidSpatialHash& SpatialHash,
+		const FKawaiiFluidBoundaryBox& BoundaryBox,
+		int32 NumSubsteps,
+		float SubstepDT,
+		bool bReduceBounds,
+		FKawaiiFluidStatsAccumulator* FrameStats = nullptr
+	);
+
+	bool RunAdaptiveSubstepsCPU(
+		TArray<FKawaiiFluidParticle>& Particles,
+		const UKawaiiFluidPresetDataAsset* Preset,
+		const FKawaiiFluidSimulationParams& Params,
+		FKawaiiFluidSpatialHash& SpatialHash,
+		const FKawaiiFluidBoundaryBox& BoundaryBox,
+		float FrameTime,
+		bool bReduceBounds,
+		FKawaiiFluidStatsAccumulator* FrameStats = nullptr
+	);
+
 	//========================================
 	// GPU Simulation
 	//========================================
@@ -5,6 +5,13 @@
 #include "CoreMinimal.h"
 #include "Stats/Stats.h"
 #include "HAL/IConsoleManager.h"
+#include "Trace/Trace.h"
+
+struct FKawaiiFluidSubstepTimings;
+struct FKawaiiFluidAdaptiveStepStats;
+
+/** Insights channel for fine-grained CPU solver scopes (enable with -trace=cpu,KawaiiFluid). */
+UE_TRACE_CHANNEL_EXTERN(KawaiiFluidChannel, KAWAIIFLUIDRUNTIME_API);
 
 DECLARE_STATS_GROUP(TEXT("KawaiiFluidSimulation"), STATGROUP_KawaiiFluidSimulation, STATCAT_Advanced);
 
@@ -34,6 +41,16 @@ DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Per-Particle Error %"), STAT_FluidPerPar
 DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Kinetic Energy"), STAT_FluidKineticEnergy, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
 DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Stability Score"), STAT_FluidStabilityScore, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
 
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Density Error % (First Iter)"), STAT_FluidDensityErrorFirstIter, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Density Error % (Last Iter)"), STAT_FluidDensityErrorLastIter, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Neighbors [0]"), STAT_FluidNeighborHist0, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Neighbors [1-7]"), STAT_FluidNeighborHist1, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Neighbors [8-15]"), STAT_FluidNeighborHist2, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Neighbors [16-31]"), STAT_FluidNeighborHist3, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Neighbors [32-63]"), STAT_FluidNeighborHist4, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Neighbors [64+]"), STAT_FluidNeighborHist5, STATGROUP_KawaiiFluidSimulation, KAWAIIFLUIDRUNTIME_API);
+
 /**
  * @struct FKawaiiFluidSimulationStats
  * @brief Statistics snapshot for a single frame used to monitor and compare simulation behavior.
@@ -64,7 +81,13 @@ DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Stability Score"), STAT_FluidStabilitySc
  * @param PrimitiveCollisionCount Number of collisions with explicitly registered colliders.
  * @param GroundContactCount Number of particles in contact with the world geometry/ground.
  * @param SubstepCount Number of substeps executed in the current frame.
- * @param SolverIterations Number of solver iterations per substep.
+ * @param SolverIterations Number of solver iterations per substep (average when early exit is active on CPU).
+ * @param TotalSolverIterations Density solver iterations run over all substeps this frame (CPU path).
+ * @param EarlyExitCount Substeps whose density iterations stopped within the error tolerance (CPU path).
+ * @param MinSubstepDeltaTime Smallest substep of the frame in seconds (CPU path).
+ * @param MaxSubstepDeltaTime Largest substep of the frame in seconds (CPU path).
+ * @param MaxCFLSpeed Largest particle speed seen by the adaptive CFL step in cm/s (CPU path).
+ * @param DroppedSimulationTime Simulation time dropped at the adaptive substep ceiling in seconds (CPU path).
  * @param TotalSimulationTimeMs Total CPU/GPU time for simulation in milliseconds.
  * @param SpatialHashTimeMs Time spent building and querying the spatial hash.
  * @param DensitySolveTimeMs Time spent in the PBF density constraint solver.
@@ -73,6 +96,15 @@ DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Stability Score"), STAT_FluidStabilitySc
  * @param CollisionTimeMs Time spent resolving all types of collisions.
  * @param GPUSimulationTimeMs Time spent on GPU compute shaders.
  * @param GPUReadbackTimeMs Time spent transferring data from GPU to CPU.
+ * @param PredictTimeMs Time spent predicting positions (CPU path).
+ * @param FinalizeTimeMs Time spent deriving velocities from displacement (CPU path).
+ * @param AdhesionTimeMs Time spent applying adhesion (CPU path).
+ * @param StackPressureTimeMs Time spent applying stack pressure (CPU path).
+ * @param NeighborHistogram Per-particle neighbor counts bucketed as [0], [1-7], [8-15], [16-31], [32-63], [64+].
+ * @param DensityErrorPerIteration Mean |ρ/ρ₀ - 1| (%) at each density solver iteration, averaged over substeps.
+ * @param LODTierParticleCount Particles per simulation LOD tier (Near, Far, Frozen; CPU path).
+ * @param LODTierSubstepCount Substeps run per simulation LOD tier this frame (CPU path).
+ * @param LODTierTimeMs Wall-clock time spent simulating each LOD tier this frame (CPU path).
  * @param bIsGPUSimulation Flag indicating if this is a GPU-based simulation.
  */
 struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSimulationStats
@@ -112,6 +144,12 @@ public:
 
 	int32 SubstepCount = 0;
 	int32 SolverIterations = 0;
+	int32 TotalSolverIterations = 0;
+	int32 EarlyExitCount = 0;
+	float MinSubstepDeltaTime = 0.0f;
+	float MaxSubstepDeltaTime = 0.0f;
+	float MaxCFLSpeed = 0.0f;
+	float DroppedSimulationTime = 0.0f;
 
 	double TotalSimulationTimeMs = 0.0;
 	double SpatialHashTimeMs = 0.0;
@@ -122,6 +160,21 @@ public:
 	double GPUSimulationTimeMs = 0.0;
 	double GPUReadbackTimeMs = 0.0;
 
+	double PredictTimeMs = 0.0;
+	double FinalizeTimeMs = 0.0;
+	double AdhesionTimeMs = 0.0;
+	double StackPressureTimeMs = 0.0;
+
+	static constexpr int32 NeighborHistogramBucketCount = 6;
+	int32 NeighborHistogram[NeighborHistogramBucketCount] = {};
+
+	TArray<float> DensityErrorPerIteration;
+
+	static constexpr int32 LODTierCount = 3;
+	int32 LODTierParticleCount[LODTierCount] = {};
+	int32 LODTierSubstepCount[LODTierCount] = {};
+	double LODTierTimeMs[LODTierCount] = {};
+
 	bool bIsGPUSimulation = false;
 
 	void Reset();
@@ -133,24 +186,159 @@ public:
 	FString CompareWith(const FKawaiiFluidSimulationStats& Other, const FString& OtherLabel = TEXT("Other")) const;
 };
 
+/**
+ * @struct FKawaiiFluidRunningStat
+ * @brief Single-pass running mean/variance (Welford) with min/max, mergeable across threads.
+ * 
+ * @param Count Number of samples.
+ * @param Mean Running mean.
+ * @param M2 Sum of squared deviations from the running mean.
+ * @param Min Smallest sample.
+ * @param Max Largest sample.
+ */
+struct FKawaiiFluidRunningStat
+{
+	int64 Count = 0;
+	double Mean = 0.0;
+	double M2 = 0.0;
+	float Min = TNumericLimits<float>::Max();
+	float Max = TNumericLimits<float>::Lowest();
+
+	FORCEINLINE void Add(float Value)
+	{
+		++Count;
+		const double Delta = Value - Mean;
+		Mean += Delta / static_cast<double>(Count);
+		M2 += Delta * (Value - Mean);
+		Min = FMath::Min(Min, Value);
+		Max = FMath::Max(Max, Value);
+	}
+
+	/** Combine with another partial result (Chan et al. parallel variance). */
+	void Merge(const FKawaiiFluidRunningStat& Other)
+	{
+		if (Other.Count == 0)
+		{
+			return;
+		}
+		if (Count == 0)
+		{
+			*this = Other;
+			return;
+		}
+
+		const double Total = static_cast<double>(Count + Other.Count);
+		const double Delta = Other.Mean - Mean;
+		Mean += Delta * (static_cast<double>(Other.Count) / Total);
+		M2 += Other.M2 + Delta * Delta * (static_cast<double>(Count) * static_cast<double>(Other.Count) / Total);
+		Count += Other.Count;
+		Min = FMath::Min(Min, Other.Min);
+		Max = FMath::Max(Max, Other.Max);
+	}
+
+	bool HasSamples() const { return Count > 0; }
+
+	/** Population variance, matching the previous two-pass calculation. */
+	double GetVariance() const { return Count > 0 ? M2 / static_cast<double>(Count) : 0.0; }
+
+	double GetStdDev() const { return FMath::Sqrt(FMath::Max(0.0, GetVariance())); }
+};
+
+/**
+ * @struct FKawaiiFluidStatsAccumulator
+ * @brief Per-thread particle statistics filled inside parallel solver loops and merged once per frame.
+ * 
+ * @param Velocity Velocity magnitude statistics (cm/s).
+ * @param Density Density statistics.
+ * @param Neighbors Neighbor count statistics.
+ * @param PressureCorrection Pressure correction magnitude statistics.
+ * @param ViscosityForce Viscosity force magnitude statistics.
+ * @param CohesionForce Cohesion force magnitude statistics.
+ * @param KineticEnergySum Sum of 0.5 * m * v².
+ * @param DensityErrorSum Sum of per-particle |ρ - ρ₀| / ρ₀ * 100.
+ * @param AttachedCount Number of attached particles.
+ * @param GroundContactCount Number of particles near the ground.
+ * @param NeighborHistogram Neighbor counts bucketed as in FKawaiiFluidSimulationStats::NeighborHistogram.
+ */
+struct FKawaiiFluidStatsAccumulator
+{
+	FKawaiiFluidRunningStat Velocity;
+	FKawaiiFluidRunningStat Density;
+	FKawaiiFluidRunningStat Neighbors;
+	FKawaiiFluidRunningStat PressureCorrection;
+	FKawaiiFluidRunningStat ViscosityForce;
+	FKawaiiFluidRunningStat CohesionForce;
+
+	double KineticEnergySum = 0.0;
+	double DensityErrorSum = 0.0;
+
+	int32 AttachedCount = 0;
+	int32 GroundContactCount = 0;
+
+	int32 NeighborHistogram[FKawaiiFluidSimulationStats::NeighborHistogramBucketCount] = {};
+
+	/** Bucket for a neighbor count: [0], [1-7], [8-15], [16-31], [32-63], [64+]. */
+	static FORCEINLINE int32 GetNeighborHistogramBucket(int32 NeighborCount)
+	{
+		if (NeighborCount <= 0)
+		{
+			return 0;
+		}
+
+		const int32 Log2 = static_cast<int32>(FMath::FloorLog2(static_cast<uint32>(NeighborCount)));
+		return FMath::Clamp(Log2 - 1, 1, FKawaiiFluidSimulationStats::NeighborHistogramBucketCount - 1);
+	}
+
+	/** Add all per-particle quantities in one call (InvRestDensity = 0 skips density error). */
+	FORCEINLINE void AddParticle(float VelocityMagnitude, float InDensity, float Mass, int32 NeighborCount, float InvRestDensity)
+	{
+		Velocity.Add(VelocityMagnitude);
+		Density.Add(InDensity);
+		Neighbors.Add(static_cast<float>(NeighborCount));
+		KineticEnergySum += 0.5 * Mass * VelocityMagnitude * VelocityMagnitude;
+		if (InvRestDensity > 0.0f)
+		{
+			DensityErrorSum += FMath::Abs(InDensity * InvRestDensity - 1.0f) * 100.0;
+		}
+		NeighborHistogram[GetNeighborHistogramBucket(NeighborCount)]++;
+	}
+
+	void Merge(const FKawaiiFluidStatsAccumulator& Other)
+	{
+		Velocity.Merge(Other.Velocity);
+		Density.Merge(Other.Density);
+		Neighbors.Merge(Other.Neighbors);
+		PressureCorrection.Merge(Other.PressureCorrection);
+		ViscosityForce.Merge(Other.ViscosityForce);
+		CohesionForce.Merge(Other.CohesionForce);
+		KineticEnergySum += Other.KineticEnergySum;
+		DensityErrorSum += Other.DensityErrorSum;
+		AttachedCount += Other.AttachedCount;
+		GroundContactCount += Other.GroundContactCount;
+		for (int32 Bucket = 0; Bucket < FKawaiiFluidSimulationStats::NeighborHistogramBucketCount; ++Bucket)
+		{
+			NeighborHistogram[Bucket] += Other.NeighborHistogram[Bucket];
+		}
+	}
+
+	void Reset()
+	{
+		*this = FKawaiiFluidStatsAccumulator();
+	}
+};
+
 /**
  * @class FKawaiiFluidSimulationStatsCollector
  * @brief Collector class that accumulates and aggregates statistics during the simulation loop.
  * 
+ * Per-particle data is gathered in FKawaiiFluidStatsAccumulator instances owned by the worker
+ * threads of the solver loops and merged once (MergeAccumulator) instead of per-sample calls.
+ * 
  * @param CurrentStats Statistics currently being collected for the active frame.
  * @param PreviousStats Finalized statistics from the last completed frame.
- * @param VelocitySum Accumulator for averaging particle velocity.
- * @param VelocitySampleCount Number of velocity samples collected.
- * @param DensitySum Accumulator for averaging particle density.
- * @param DensitySampleCount Number of density samples collected.
- * @param NeighborSum Accumulator for averaging neighbor counts.
- * @param NeighborSampleCount Number of neighbor count samples.
- * @param PressureCorrectionSum Accumulator for averaging pressure correction displacement.
- * @param PressureCorrectionSampleCount Number of pressure correction samples.
- * @param ViscosityForceSum Accumulator for averaging viscosity forces.
- * @param ViscosityForceSampleCount Number of viscosity force samples.
- * @param CohesionForceSum Accumulator for averaging cohesion forces.
- * @param CohesionForceSampleCount Number of cohesion force samples.
+ * @param FrameAccumulator Merged accumulator for the active frame (also receives single-threaded Add*Sample calls).
+ * @param DensityIterationErrorSums Per-iteration density error accumulators (one entry per solver iteration).
+ * @param DensityIterationSampleCounts Number of substeps contributing to each iteration accumulator.
  * @param bEnabled Global flag to enable or disable statistics collection.
  * @param bDetailedGPU Enable detailed GPU metrics that require expensive readbacks.
  * @param bReadbackRequested Flag indicating if a debug readback is needed for visualization.
@@ -206,6 +394,20 @@ public:
 
 	void AddCohesionForceSample(float ForceMagnitude);
 
+	void MergeAccumulator(const FKawaiiFluidStatsAccumulator& Accumulator);
+
+	void ApplyParticleAccumulator(const FKawaiiFluidStatsAccumulator& Accumulator, float RestDensity);
+
+	void AddDensityIterationError(int32 Iteration, float ErrorPercent);
+
+	void AddSubstepTimings(const FKawaiiFluidSubstepTimings& Timings);
+
+	static void TraceSubstepTimings(const FKawaiiFluidSubstepTimings& Timings);
+
+	static void TraceDensityIterationError(float ErrorPercent);
+
+	static int32 GetNeighborHistogramBucket(int32 NeighborCount) { return FKawaiiFluidStatsAccumulator::GetNeighborHistogramBucket(NeighborCount); }
+
 	void AddBoundsCollision() { CurrentStats.BoundsCollisionCount++; }
 
 	void AddPrimitiveCollision() { CurrentStats.PrimitiveCollisionCount++; }
@@ -216,6 +418,10 @@ public:
 
 	void SetSolverIterations(int32 Iterations) { CurrentStats.SolverIterations = Iterations; }
 
+	void SetLODTierStats(int32 Tier, int32 ParticleCount, int32 SubstepCount, double TimeMs);
+
+	void SetAdaptiveStepStats(const FKawaiiFluidAdaptiveStepStats& StepStats);
+
 	void SetGPUSimulation(bool bGPU) { CurrentStats.bIsGPUSimulation = bGPU; }
 
 	void SetTotalSimulationTime(double Ms) { CurrentStats.TotalSimulationTimeMs = Ms; }
@@ -233,23 +439,14 @@ private:
 	FKawaiiFluidSimulationStats CurrentStats;
 	FKawaiiFluidSimulationStats PreviousStats;
 
-	double VelocitySum = 0.0;
-	int32 VelocitySampleCount = 0;
-
-	double DensitySum = 0.0;
-	int32 DensitySampleCount = 0;
-
-	double NeighborSum = 0.0;
-	int32 NeighborSampleCount = 0;
+	FKawaiiFluidStatsAccumulator FrameAccumulator;
 
-	double PressureCorrectionSum = 0.0;
-	int32 PressureCorrectionSampleCount = 0;
+	TArray<double> DensityIterationErrorSums;
+	TArray<int32> DensityIterationSampleCounts;
 
-	double ViscosityForceSum = 0.0;
-	int32 ViscosityForceSampleCount = 0;
+	static void ApplyAccumulatorToStats(const FKawaiiFluidStatsAccumulator& Accumulator, float RestDensity, FKawaiiFluidSimulationStats& OutStats);
 
-	double CohesionForceSum = 0.0;
-	int32 CohesionForceSampleCount = 0;
+	static void UpdateStabilityScore(FKawaiiFluidSimulationStats& InOutStats);
 
 	bool bEnabled = false;
 	bool bDetailedGPU = false;
@@ -205,6 +205,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
  * @param SurfaceNeighborThreshold Neighbor count threshold for identifying surface particles.
  * @param CPUCollisionFeedbackBufferPtr Buffer for deferred collision processing on the CPU.
  * @param CPUCollisionFeedbackLockPtr Critical section for thread-safe buffer access.
+ * @param LODViewLocations World-space view locations driving the CPU simulation LOD tiers (empty = no LOD).
  */
 USTRUCT(BlueprintType)
 struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSimulationParams
@@ -282,6 +283,8 @@ struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSimulationParams
 
 	FCriticalSection* CPUCollisionFeedbackLockPtr = nullptr;
 
+	TArray<FVector> LODViewLocations;
+
 	FKawaiiFluidSimulationParams() = default;
 };
 
@@ -305,3 +308,123 @@ struct FKawaiiFluidModuleBatchInfo
 	FKawaiiFluidModuleBatchInfo(UKawaiiFluidSimulationModule* InModule, int32 InStart, int32 InCount)
 		: Module(InModule), StartIndex(InStart), ParticleCount(InCount) {}
 };
+
+/**
+ * @struct FKawaiiFluidAdaptiveStepStats
+ * @brief Substeps and solver iterations the CPU solver chose for the last frame.
+ * 
+ * @param NumSubsteps Substeps run (near tier when LOD is active).
+ * @param NumSolverIterations Density iterations run over all substeps and tiers.
+ * @param NumEarlyExits Substeps whose density iterations stopped within tolerance.
+ * @param MinSubstepDeltaTime Smallest substep of the frame (s).
+ * @param MaxSubstepDeltaTime Largest substep of the frame (s).
+ * @param MaxSpeed Largest particle speed seen by the CFL condition (cm/s).
+ * @param DroppedTime Simulation time dropped because the substep ceiling was reached (s).
+ */
+struct FKawaiiFluidAdaptiveStepStats
+{
+	int32 NumSubsteps = 0;
+
+	int32 NumSolverIterations = 0;
+
+	int32 NumEarlyExits = 0;
+
+	float MinSubstepDeltaTime = 0.0f;
+
+	float MaxSubstepDeltaTime = 0.0f;
+
+	float MaxSpeed = 0.0f;
+
+	float DroppedTime = 0.0f;
+
+	void Reset()
+	{
+		*this = FKawaiiFluidAdaptiveStepStats();
+	}
+
+	void AddSubstep(float SubstepDT)
+	{
+		MinSubstepDeltaTime = NumSubsteps == 0 ? SubstepDT : FMath::Min(MinSubstepDeltaTime, SubstepDT);
+		MaxSubstepDeltaTime = FMath::Max(MaxSubstepDeltaTime, SubstepDT);
+		NumSubsteps++;
+	}
+};
+
+/**
+ * @struct FKawaiiFluidSubstepTimings
+ * @brief Wall-clock time spent in each stage of a CPU simulation substep (ms).
+ * 
+ * @param PredictMs Time spent predicting positions.
+ * @param NeighborsMs Time spent rebuilding the spatial hash and caching neighbors.
+ * @param DensityMs Time spent in the XPBD density solver iterations.
+ * @param CollisionMs Time spent resolving collider collisions.
+ * @param WorldCollisionMs Time spent resolving world geometry collisions.
+ * @param FinalizeMs Time spent deriving velocities from displacement.
+ * @param ViscosityMs Time spent applying XSPH viscosity.
+ * @param AdhesionMs Time spent applying adhesion.
+ * @param CohesionMs Time spent applying cohesion (surface tension).
+ * @param StackPressureMs Time spent applying stack pressure.
+ * @param TotalMs Total time of the substep.
+ */
+struct FKawaiiFluidSubstepTimings
+{
+	double PredictMs = 0.0;
+
+	double NeighborsMs = 0.0;
+
+	double DensityMs = 0.0;
+
+	double CollisionMs = 0.0;
+
+	double WorldCollisionMs = 0.0;
+
+	double FinalizeMs = 0.0;
+
+	double ViscosityMs = 0.0;
+
+	double AdhesionMs = 0.0;
+
+	double CohesionMs = 0.0;
+
+	double StackPressureMs = 0.0;
+
+	double TotalMs = 0.0;
+
+	void Reset()
+	{
+		*this = FKawaiiFluidSubstepTimings();
+	}
+
+	FKawaiiFluidSubstepTimings& operator+=(const FKawaiiFluidSubstepTimings& Other)
+	{
+		PredictMs += Other.PredictMs;
+		NeighborsMs += Other.NeighborsMs;
+		DensityMs += Other.DensityMs;
+		CollisionMs += Other.CollisionMs;
+		WorldCollisionMs += Other.WorldCollisionMs;
+		FinalizeMs += Other.FinalizeMs;
+		ViscosityMs += Other.ViscosityMs;
+		AdhesionMs += Other.AdhesionMs;
+		CohesionMs += Other.CohesionMs;
+		StackPressureMs += Other.StackPressureMs;
+		TotalMs += Other.TotalMs;
+		return *this;
+	}
+
+	FKawaiiFluidSubstepTimings operator*(double Scale) const
+	{
+		FKawaiiFluidSubstepTimings Result;
+		Result.PredictMs = PredictMs * Scale;
+		Result.NeighborsMs = NeighborsMs * Scale;
+		Result.DensityMs = DensityMs * Scale;
+		Result.CollisionMs = CollisionMs * Scale;
+		Result.WorldCollisionMs = WorldCollisionMs * Scale;
+		Result.FinalizeMs = FinalizeMs * Scale;
+		Result.ViscosityMs = ViscosityMs * Scale;
+		Result.AdhesionMs = AdhesionMs * Scale;
+		Result.CohesionMs = CohesionMs * Scale;
+		Result.StackPressureMs = StackPressureMs * Scale;
+		Result.TotalMs = TotalMs * Scale;
+		return Result;
+	}
+};
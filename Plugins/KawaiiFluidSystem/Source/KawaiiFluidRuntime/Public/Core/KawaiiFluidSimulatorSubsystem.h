@@ -8,6 +8,7 @@
 #include "Core/KawaiiFluidSimulationTypes.h"
 #include "Components/KawaiiFluidInteractionComponent.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
+#include "Core/KawaiiFluidSourceSlotTable.h"
 #include "KawaiiFluidSimulatorSubsystem.generated.h"
 
 class UKawaiiFluidSimulationModule;
@@ -70,8 +71,7 @@ struct FContextCacheKey
  * global collider coordination, and providing a query API for fluid particles.
  * 
  * @param AllModules All currently registered simulation modules.
- * @param UsedSourceIDs Bitfield tracking assigned SourceIDs for GPU tracking.
- * @param NextSourceIDHint Optimization hint for the next SourceID allocation.
+ * @param SourceSlotTable O(1) free-list allocator for SourceIDs used by GPU per-source counters.
  * @param AllVolumes All registered fluid volume actors (New Architecture).
  * @param AllVolumeComponents All registered simulation volume components (Legacy).
  * @param GlobalColliders Colliders that affect all fluid simulations globally.
@@ -212,9 +212,7 @@ private:
 	// SourceID Allocation State
 	//========================================
 
-	TBitArray<> UsedSourceIDs;
-
-	int32 NextSourceIDHint = 0;
+	FKawaiiFluidSourceSlotTable SourceSlotTable{ EGPUParticleSource::MaxSourceCount };
 
 	//========================================
 	// Volume Actor Management
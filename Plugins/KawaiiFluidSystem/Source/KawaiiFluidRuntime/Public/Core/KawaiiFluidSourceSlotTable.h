@@ -0,0 +1,80 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Deque.h"
+
+/**
+ * @class FKawaiiFluidSourceSlotTable
+ * @brief O(1) SourceID allocator backing the per-source GPU counter table.
+ *
+ * SourceIDs are dense slot indices. GPU particles, queued spawn requests and in-flight readbacks
+ * keep a released ID for a few frames, so a released slot is quarantined for
+ * ReleaseQuarantineFrames (counted by AdvanceFrame) before it is handed out again; until then the
+ * table extends its high-water mark instead. Expired slots are reused oldest first (FIFO), so every
+ * live ID stays inside [0, HighWaterMark). Only a table at MaxSlots reuses a quarantined slot
+ * early, oldest first, rather than failing the allocation. GPU counter buffers are sized from the
+ * high-water mark (rounded up to GetCapacityForSlotCount) and readbacks copy only that prefix
+ * instead of a fixed-size table.
+ *
+ * @param MaxSlots Hard upper bound on concurrently allocated slots.
+ * @param FreeSlots Released slots below the high-water mark, oldest release first.
+ * @param AllocatedSlots Bitfield of currently allocated slots (guards double release).
+ * @param HighWaterMark One past the highest slot ever handed out.
+ * @param NumAllocated Number of currently allocated slots.
+ * @param CurrentFrame Frame counter advanced by AdvanceFrame, stamped on released slots.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSourceSlotTable
+{
+public:
+	/** Smallest GPU counter table size; capacities grow in powers of two from here. */
+	static constexpr int32 MinSlotCapacity = 64;
+
+	/** Frames a released slot waits before reuse (covers readback latency and queued spawn requests) */
+	static constexpr uint32 ReleaseQuarantineFrames = 8;
+
+	explicit FKawaiiFluidSourceSlotTable(int32 InMaxSlots);
+
+	int32 Allocate();
+
+	bool Release(int32 SlotIndex);
+
+	void Reset();
+
+	void AdvanceFrame() { ++CurrentFrame; }
+
+	bool IsAllocated(int32 SlotIndex) const
+	{
+		return SlotIndex >= 0 && SlotIndex < HighWaterMark && AllocatedSlots[SlotIndex];
+	}
+
+	int32 GetNumAllocated() const { return NumAllocated; }
+
+	int32 GetHighWaterMark() const { return HighWaterMark; }
+
+	int32 GetMaxSlots() const { return MaxSlots; }
+
+	int32 GetCapacity() const { return GetCapacityForSlotCount(HighWaterMark); }
+
+	static int32 GetCapacityForSlotCount(int32 SlotCount);
+
+private:
+	int32 MaxSlots = 0;
+
+	struct FReleasedSlot
+	{
+		int32 SlotIndex;
+		uint32 ReleaseFrame;
+	};
+
+	TDeque<FReleasedSlot> FreeSlots;
+
+	TBitArray<> AllocatedSlots;
+
+	int32 HighWaterMark = 0;
+
+	int32 NumAllocated = 0;
+
+	uint32 CurrentFrame = 0;
+};
@@ -21,6 +21,7 @@ class UKawaiiFluidInteractionComponent;
 class UKawaiiFluidSimulationContext;
 class UKawaiiFluidVolumeComponent;
 class AKawaiiFluidVolume;
+struct FKawaiiFluidBoundaryBox;
 
 /**
  * @class UKawaiiFluidSimulationModule
@@ -64,6 +65,13 @@ class AKawaiiFluidVolume;
  * @param ParticleLastEventTime Tracking map for particle-specific event cooldowns.
  * @param WeakGPUSimulator Weak pointer to the shared GPU simulator instance.
  * @param bGPUSimulationActive Flag indicating if GPU-based simulation is currently used.
+ * @param bCPUSimulationBackend If true, spawn APIs append to Particles and the CPU solver owns them (editor preview).
+ * @param MaxCPUParticles Particle budget of the CPU backend (0 = unlimited).
+ * @param NextCPUParticleID Next ParticleID handed out by the CPU backend.
+ * @param ParticleIndexRemap Particle index of the index-based APIs -> Particles slot, in ascending ParticleID (CPU backend).
+ * @param ParticleIndexRemapIDs ParticleID each remap entry was built for (a mismatch means Particles was reordered).
+ * @param ParticleIndexRemapNextID NextCPUParticleID when the remap was built (detects spawns).
+ * @param CachedParticleBounds Particle AABB reduced by the last CPU boundary sweep.
  * @param CachedSimulationContext Reference to the context assigned during subsystem registration.
  * @param OwnedVolumeComponent Internally managed component providing bounds data.
  * @param PreviousRegisteredVolume Tracking reference for volume re-registration in the editor.
@@ -268,6 +276,8 @@ public:
 	                                             float Radius, float Spacing, float Jitter,
 	                                             TArray<FGPUSpawnRequest>& OutBatch);
 
+	int32 SpawnParticlesBatch(const TArray<FVector>& Positions, const TArray<FVector>& Velocities);
+
 	UFUNCTION(BlueprintCallable, Category = "Fluid")
 	void ClearAllParticles();
 
@@ -356,6 +366,11 @@ public:
 
 	void ResolveContainmentCollisions();
 
+	FKawaiiFluidBoundaryBox GetVolumeBoundaryBox() const;
+
+	/** Particle AABB from the last ResolveVolumeBoundaryCollisions sweep (invalid if never run or empty) */
+	const FBox& GetCachedParticleBounds() const { return CachedParticleBounds; }
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Events")
 	bool bEnableCollisionEvents = false;
 
@@ -431,10 +446,18 @@ public:
 
 	virtual FKawaiiFluidSimulator* GetGPUSimulator() const override { return WeakGPUSimulator.Pin().Get(); }
 
+	virtual TSharedPtr<FKawaiiFluidSimulator> GetGPUSimulatorShared() const override { return WeakGPUSimulator.Pin(); }
+
 	void SetGPUSimulator(const TSharedPtr<FKawaiiFluidSimulator>& InSimulator) { WeakGPUSimulator = InSimulator; }
 
 	void SetGPUSimulationActive(bool bActive) { bGPUSimulationActive = bActive; }
 
+	void SetCPUSimulationBackend(bool bEnable, int32 InMaxCPUParticles = 0);
+
+	bool IsCPUSimulationBackend() const { return bCPUSimulationBackend; }
+
+	int32 GetMaxCPUParticles() const { return MaxCPUParticles; }
+
 	UFUNCTION(BlueprintCallable, Category = "Fluid|Module")
 	void SyncGPUParticlesToCPU();
 
@@ -461,6 +484,28 @@ private:
 
 	bool bGPUSimulationActive = false;
 
+	bool bCPUSimulationBackend = false;
+
+	int32 MaxCPUParticles = 0;
+
+	int32 NextCPUParticleID = 0;
+
+	mutable TArray<int32> ParticleIndexRemap;
+
+	mutable TArray<int32> ParticleIndexRemapIDs;
+
+	mutable int32 ParticleIndexRemapNextID = 0;
+
+	FBox CachedParticleBounds = FBox(ForceInit);
+
+	int32 AddCPUParticle(const FVector& Position, const FVector& Velocity);
+
+	void RebuildParticleIndexRemap() const;
+
+	const TArray<int32>* GetParticleIndexRemap() const;
+
+	int32 ResolveParticleIndex(int32 ParticleIndex) const;
+
 	UKawaiiFluidSimulationContext* CachedSimulationContext = nullptr;
 
 	UPROPERTY(Transient)
@@ -0,0 +1,133 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidRenderingTypes.h"
+#include "Core/KawaiiFluidParticle.h"
+
+/**
+ * @struct FKawaiiFluidDebugPointSource
+ * @brief Non-owning view of the particle data a debug point buffer is built from.
+ *
+ * @param Positions GPU readback positions (takes precedence over Particles when non-empty).
+ * @param Particles CPU simulation particles (positions and densities).
+ * @param ParticleIDs Per-particle IDs (Z-Order pre-sort coloring and post-sort lookup).
+ * @param ZOrderIndices Z-Order array index per ParticleID (post-sort coloring).
+ * @param Flags Per-particle EGPUParticleFlags (boundary coloring).
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidDebugPointSource
+{
+	TConstArrayView<FVector3f> Positions;
+
+	TConstArrayView<FKawaiiFluidParticle> Particles;
+
+	TConstArrayView<int32> ParticleIDs;
+
+	TConstArrayView<int32> ZOrderIndices;
+
+	TConstArrayView<uint32> Flags;
+
+	int32 Num() const;
+
+	FVector GetPosition(int32 Index) const;
+
+	float GetDensity(int32 Index) const;
+};
+
+/**
+ * @struct FKawaiiFluidDebugPointSettings
+ * @brief Appearance, decimation and budget parameters for batched debug points.
+ *
+ * @param Mode Point debug mode (selects the color LUT and the per-particle LUT coordinate).
+ * @param PointSize Debug point size.
+ * @param RestDensity Rest density used to normalize the density mode.
+ * @param DecimationPixels Screen-space cell size in pixels; one point (the nearest) is kept per cell (<= 0 disables).
+ * @param PixelAngle Angle subtended by one screen pixel (radians, <= 0 disables decimation).
+ * @param MaxPoints Frame budget: upper bound on points submitted per frame (<= 0 = unlimited).
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidDebugPointSettings
+{
+	EKawaiiFluidDebugDrawMode Mode = EKawaiiFluidDebugDrawMode::Point_ZOrderArrayIndex;
+
+	float PointSize = 5.0f;
+
+	float RestDensity = 1000.0f;
+
+	float DecimationPixels = 2.0f;
+
+	float PixelAngle = 0.0f;
+
+	int32 MaxPoints = 50000;
+
+	bool operator==(const FKawaiiFluidDebugPointSettings& Other) const
+	{
+		return Mode == Other.Mode && PointSize == Other.PointSize && RestDensity == Other.RestDensity &&
+			DecimationPixels == Other.DecimationPixels && PixelAngle == Other.PixelAngle && MaxPoints == Other.MaxPoints;
+	}
+};
+
+/**
+ * @class FKawaiiFluidDebugPointBatcher
+ * @brief Builds one batched, decimated, colored point buffer for particle debug views and submits it per frame.
+ *
+ * Build runs in parallel: a bounds reduction, a screen-space decimation pass that keeps the nearest
+ * particle per angular cell around the view, a stride down to the frame budget, and a color pass through
+ * a 256-entry per-mode LUT. The result is kept between frames and only rebuilt when the source data,
+ * settings or view change, while Draw pushes it straight into the world line batcher.
+ *
+ * @param Points Batched point positions.
+ * @param Colors Batched point colors (parallel to Points).
+ * @param KeptIndices Scratch: source indices surviving decimation (reused across builds).
+ * @param Bounds Bounds of all source particles from the last build (position-based modes).
+ * @param LastSettings Settings used for the last build.
+ * @param LastViewLocation View location used for the last build.
+ * @param LastSourceVersion Source data version used for the last build (0 = unversioned).
+ * @param bHasView Whether the last build used view-based decimation.
+ * @param bBuilt Whether Points/Colors hold a valid build.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidDebugPointBatcher
+{
+public:
+	void Build(const FKawaiiFluidDebugPointSource& Source, const FKawaiiFluidDebugPointSettings& Settings,
+		const FVector* ViewLocation, uint64 SourceVersion = 0);
+
+	bool IsUpToDate(const FKawaiiFluidDebugPointSettings& Settings, const FVector* ViewLocation, uint64 SourceVersion) const;
+
+	void Draw(UWorld* World) const;
+
+	void Reset();
+
+	int32 GetNumPoints() const { return Points.Num(); }
+
+	const TArray<FVector>& GetPoints() const { return Points; }
+
+	const TArray<FLinearColor>& GetColors() const { return Colors; }
+
+	static const TArray<FColor>& GetColorLUT(EKawaiiFluidDebugDrawMode Mode);
+
+	static bool GetDebugView(const UWorld* World, FVector& OutViewLocation, float& OutPixelAngle);
+
+private:
+	TArray<FVector> Points;
+
+	TArray<FLinearColor> Colors;
+
+	TArray<int32> KeptIndices;
+
+	FBox Bounds = FBox(ForceInit);
+
+	FKawaiiFluidDebugPointSettings LastSettings;
+
+	FVector LastViewLocation = FVector::ZeroVector;
+
+	uint64 LastSourceVersion = 0;
+
+	bool bHasView = false;
+
+	bool bBuilt = false;
+
+	void DecimateInScreenSpace(const FKawaiiFluidDebugPointSource& Source, const FKawaiiFluidDebugPointSettings& Settings, const FVector& ViewLocation);
+
+	uint8 GetLUTCoordinate(const FKawaiiFluidDebugPointSource& Source, const FKawaiiFluidDebugPointSettings& Settings, int32 Index, int32 TotalCount) const;
+};
@@ -8,6 +8,7 @@
 #include "KawaiiFluidProxyRenderer.generated.h"
 
 class IKawaiiFluidDataProvider;
+class FKawaiiFluidSimulator;
 
 /**
  * @class UKawaiiFluidProxyRenderer
@@ -16,6 +17,12 @@ class IKawaiiFluidDataProvider;
  * Each particle is rendered as an efficient mesh instance using GPU instancing (ISM), supporting 
  * velocity-based colors, rotations, and shadow casting for the fluid volume.
  * 
+ * Instances live in a persistent pool that grows and shrinks in InstancePoolChunkSize steps. Particle i
+ * always maps to instance i; unused slots are hidden with a zero scale. Transforms are built in parallel
+ * and only blocks containing moved particles are submitted via BatchUpdateInstancesTransforms.
+ * Each slot remembers the ParticleID it shows, so a slot whose particle changed (Z-order sort,
+ * compaction) is always rewritten instead of being skipped as sleeping or unchanged.
+ * 
  * @param bEnabled Toggle for the Proxy renderer.
  * @param CullDistance Distance at which instances are no longer rendered (cm).
  * @param bCastShadow Whether the particle instances should cast shadows.
@@ -28,6 +35,14 @@ class IKawaiiFluidDataProvider;
  * @param CachedWorld Cached pointer to the world context.
  * @param CachedOwnerComponent Component to which the internal instances are attached.
  * @param CachedPreset The data asset containing fluid physical properties.
+ * @param InstanceTransforms World-space transforms last submitted for each pool slot.
+ * @param InstanceCustomData RGBA custom data last submitted for each pool slot.
+ * @param RenderedPositions Particle positions that produced the current slot transforms.
+ * @param RenderedVelocities Particle velocities that produced the current slot transforms/colors.
+ * @param RenderedParticleIDs ParticleID shown by each slot (INDEX_NONE = unknown, always rewritten).
+ * @param ActiveInstanceCount Number of leading pool slots that currently show a particle.
+ * @param LastSettingsHash Hash of the visual settings used for the current slots (forces a full update on change).
+ * @param ReadbackSimulator GPU simulator holding the Proxy readback registration (cleared on disable and cleanup).
  */
 UCLASS()
 class KAWAIIFLUIDRUNTIME_API UKawaiiFluidProxyRenderer : public UObject
@@ -107,4 +122,40 @@ protected:
 	UStaticMesh* GetDefaultParticleMesh();
 
 	UMaterialInterface* GetDefaultParticleMaterial();
+
+	//========================================
+	// Instance Pool
+	//========================================
+
+	static constexpr int32 InstancePoolChunkSize = 4096;
+
+	static constexpr int32 InstanceUpdateBlockSize = 1024;
+
+	void ResizeInstancePool(int32 RequiredCount);
+
+	void ReleaseInstancePool();
+
+	uint32 ComputeSettingsHash(float ScaleFactor) const;
+
+	TArray<FTransform> InstanceTransforms;
+
+	TArray<float> InstanceCustomData;
+
+	TArray<FVector3f> RenderedPositions;
+
+	TArray<FVector3f> RenderedVelocities;
+
+	TArray<int32> RenderedParticleIDs;
+
+	int32 ActiveInstanceCount = 0;
+
+	uint32 LastSettingsHash = 0;
+
+	//========================================
+	// GPU Readback
+	//========================================
+
+	void ReleaseReadbackFields();
+
+	TWeakPtr<FKawaiiFluidSimulator> ReadbackSimulator;
 };
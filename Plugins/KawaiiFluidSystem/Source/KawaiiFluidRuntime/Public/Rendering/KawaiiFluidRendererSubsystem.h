@@ -17,6 +17,31 @@ class UStaticMesh;
 /** Number of shadow quality levels (Low, Medium, High) */
 static constexpr int32 NUM_SHADOW_QUALITY_LEVELS = 3;
 
+/**
+ * @struct FKawaiiFluidShadowClusterCacheEntry
+ * @brief Clustered shadow instances of one RegisterShadowParticles call, reused while its particles do not move.
+ * 
+ * @param Positions Particle positions the clusters were built from.
+ * @param Transforms Cluster instance transforms.
+ * @param ViewLocation View location used for the LOD assignment.
+ * @param LODLevels Per-particle LOD levels the clusters were built with (empty without a view).
+ * @param bHasView Whether the clusters were built with distance LOD.
+ * @param ParticleRadius Shadow particle radius used for the clusters.
+ * @param SettingsHash Hash of the clustering settings used for the clusters.
+ * @param QualityIndex Shadow quality the clusters were registered with.
+ */
+struct FKawaiiFluidShadowClusterCacheEntry
+{
+	TArray<FVector> Positions;
+	TArray<FTransform> Transforms;
+	FVector ViewLocation = FVector::ZeroVector;
+	TArray<uint8> LODLevels;
+	bool bHasView = false;
+	float ParticleRadius = 0.0f;
+	uint32 SettingsHash = 0;
+	int32 QualityIndex = INDEX_NONE;
+};
+
 /**
  * @class UKawaiiFluidRendererSubsystem
  * @brief World subsystem responsible for coordinating fluid rendering and managing global shadow aggregation.
@@ -28,14 +53,19 @@ static constexpr int32 NUM_SHADOW_QUALITY_LEVELS = 3;
  * @param RegisteredRenderingModules List of active rendering modules being managed.
  * @param ViewExtension Scene view extension for pipeline injection.
  * @param bEnableISMShadow Toggle for particle-based shadow casting via ISM.
- * @param ParticleSkipFactor Optimization factor for shadow instance conversion.
+ * @param bClusterShadowParticles Collapse shadow particles into one instance per occupied voxel.
+ * @param ShadowClusterCellSize Voxel edge length at LOD 0, in multiples of the shadow particle radius.
+ * @param ShadowLODDistance Camera distance at which the shadow voxel size doubles.
+ * @param ShadowMaxLODLevel Highest shadow voxel LOD level.
+ * @param ParticleSkipFactor Optimization factor for shadow instance conversion (clustering disabled only).
  * @param ShadowProxyActor Internal actor holding the shadow ISM components.
  * @param ShadowInstanceComponents Array of ISM components per shadow quality level.
  * @param ShadowSphereMeshes Cached low-poly meshes for shadow spheres.
- * @param AggregatedPositions Buffered particle positions for the current frame's shadow pass.
- * @param AggregatedRadius Current frame's max particle radius per quality level.
+ * @param AggregatedTransforms Buffered shadow instance transforms for the current frame per quality level.
  * @param bHasParticlesThisFrame Tracking flag for shadow buffer status.
- * @param CachedInstanceTransforms Reusable transform buffer for batch ISM updates.
+ * @param bAggregationChanged Whether any registration this frame produced new transforms per quality level.
+ * @param ShadowClusterCache Clusters of the previous frame's registrations, indexed by registration order.
+ * @param ShadowRegistrationIndex Number of RegisterShadowParticles calls in the current frame.
  */
 UCLASS()
 class KAWAIIFLUIDRUNTIME_API UKawaiiFluidRendererSubsystem : public UWorldSubsystem, public FTickableGameObject
@@ -95,7 +125,19 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ToolTip = "Enable/disable ISM shadow via instanced spheres. When enabled, creates sphere instances at particle positions for shadow casting."))
 	bool bEnableISMShadow = true;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "1", ClampMax = "10", ToolTip = "Skip factor for particle-to-instance conversion. Higher values improve performance but reduce shadow detail."))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ToolTip = "Cluster shadow particles into a coarse voxel grid with one scaled instance per occupied voxel. Keeps thin streams while reducing instances in dense pools."))
+	bool bClusterShadowParticles = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "1.0", ClampMax = "32.0", EditCondition = "bClusterShadowParticles", ToolTip = "Voxel edge length near the camera, in multiples of the shadow particle radius."))
+	float ShadowClusterCellSize = 4.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "0.0", Units = "cm", EditCondition = "bClusterShadowParticles", ToolTip = "Camera distance at which the voxel size doubles (and doubles again at 2x, 4x ...). 0 disables distance LOD."))
+	float ShadowLODDistance = 2000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "0", ClampMax = "7", EditCondition = "bClusterShadowParticles", ToolTip = "Highest voxel LOD level (voxel size = base * 2^Level)."))
+	int32 ShadowMaxLODLevel = 3;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Shadow|ISM", meta = (ClampMin = "1", ClampMax = "10", EditCondition = "!bClusterShadowParticles", ToolTip = "Skip factor for particle-to-instance conversion when clustering is disabled. Higher values improve performance but reduce shadow detail."))
 	int32 ParticleSkipFactor = 1;
 
 	void RegisterShadowParticles(const FVector* ParticlePositions, int32 NumParticles, float ParticleRadius, EFluidShadowMeshQuality Quality);
@@ -118,13 +160,17 @@ private:
 	// Particle Aggregation Buffers
 	//========================================
 
-	TArray<FVector> AggregatedPositions[NUM_SHADOW_QUALITY_LEVELS];
-
-	float AggregatedRadius[NUM_SHADOW_QUALITY_LEVELS] = { 0.0f, 0.0f, 0.0f };
+	TArray<FTransform> AggregatedTransforms[NUM_SHADOW_QUALITY_LEVELS];
 
 	bool bHasParticlesThisFrame[NUM_SHADOW_QUALITY_LEVELS] = { false, false, false };
 
-	TArray<FTransform> CachedInstanceTransforms;
+	bool bAggregationChanged[NUM_SHADOW_QUALITY_LEVELS] = { false, false, false };
+
+	TArray<FKawaiiFluidShadowClusterCacheEntry> ShadowClusterCache;
+
+	int32 ShadowRegistrationIndex = 0;
+
+	bool GetShadowViewLocation(FVector& OutViewLocation) const;
 
 	void FlushShadowInstances();
 
@@ -0,0 +1,64 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @struct FKawaiiFluidShadowClusterSettings
+ * @brief Voxel clustering parameters for ISM shadow proxies.
+ *
+ * @param CellSizeInRadii Voxel edge length at LOD 0, in multiples of the particle radius.
+ * @param LODDistance Camera distance at which the voxel size first doubles (cm, <= 0 disables LOD).
+ * @param MaxLODLevel Highest LOD level (voxel size = base * 2^Level).
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidShadowClusterSettings
+{
+	float CellSizeInRadii = 4.0f;
+
+	float LODDistance = 2000.0f;
+
+	int32 MaxLODLevel = 3;
+
+	int32 GetLODLevel(float DistanceToView) const;
+};
+
+/**
+ * @class FKawaiiFluidShadowClustering
+ * @brief Collapses shadow particles into one scaled sphere instance per occupied voxel.
+ *
+ * Each particle is assigned to a voxel whose size depends on its LOD level (distance to the view).
+ * Every occupied voxel produces one ellipsoid covering the particles inside it: centered on their
+ * centroid, with per-axis extents derived from their spread plus the particle radius. A single
+ * isolated particle therefore keeps its own sphere (thin streams survive), while a dense pool
+ * collapses to roughly one instance per voxel.
+ *
+ * Clustering runs in parallel over particle chunks with per-chunk voxel maps merged once.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidShadowClustering
+{
+public:
+	/** Radius of the shadow sphere mesh the instance scales are relative to (cm). */
+	static constexpr float ShadowMeshRadius = 50.0f;
+
+	static void BuildClusters(
+		const FVector* Positions,
+		int32 NumParticles,
+		float ParticleRadius,
+		const FKawaiiFluidShadowClusterSettings& Settings,
+		const FVector* ViewLocation,
+		TArray<FTransform>& OutTransforms);
+
+	static void ComputeLODLevels(
+		const FVector* Positions,
+		int32 NumParticles,
+		const FKawaiiFluidShadowClusterSettings& Settings,
+		const FVector& ViewLocation,
+		TArray<uint8>& OutLevels);
+
+	static FIntVector GetCellCoord(const FVector& Position, float CellSize);
+
+	static uint64 MakeCellKey(const FIntVector& Cell, int32 LODLevel);
+
+	static uint64 MakeCellKey(const FVector& Position, float CellSize, int32 LODLevel);
+};
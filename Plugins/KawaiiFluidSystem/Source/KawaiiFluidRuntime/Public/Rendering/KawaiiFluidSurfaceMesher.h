@@ -0,0 +1,193 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMeshDescription;
+struct FKawaiiFluidParticleSnapshot;
+struct FKawaiiFluidAnisotropySnapshot;
+
+/**
+ * @struct FKawaiiFluidSurfaceMeshSettings
+ * @brief Resolution and field parameters of the offline surface reconstruction.
+ *
+ * Every particle splats (1 - (d/R)^2)^3 with R = ParticleRadius * KernelRadiusScale; the surface is the
+ * IsoLevel contour of the summed field. With the defaults an isolated particle becomes a sphere of about
+ * 1.4 particle radii and particles at rest spacing (two radii) merge into a closed body.
+ *
+ * @param ParticleRadius Particle radius (cm).
+ * @param VoxelSize Edge length of a field voxel (cm, 0 = half the particle radius).
+ * @param KernelRadiusScale Splat radius in particle radii.
+ * @param IsoLevel Field value of the surface.
+ * @param bUseAnisotropy Splat ellipsoids when anisotropy axes are passed in (spheres otherwise).
+ * @param bNarrowBand Only build bricks around particles flagged IsSurface when flags are passed in.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSurfaceMeshSettings
+{
+	float ParticleRadius = 5.0f;
+
+	float VoxelSize = 0.0f;
+
+	float KernelRadiusScale = 3.0f;
+
+	float IsoLevel = 0.5f;
+
+	bool bUseAnisotropy = true;
+
+	bool bNarrowBand = true;
+
+	float GetVoxelSize() const { return VoxelSize > 0.0f ? VoxelSize : ParticleRadius * 0.5f; }
+
+	float GetKernelRadius() const { return ParticleRadius * KernelRadiusScale; }
+};
+
+/**
+ * @struct FKawaiiFluidSurfaceMesh
+ * @brief Welded triangle mesh of a fluid surface.
+ *
+ * Triangles wind so that (P1 - P0) x (P2 - P0) points out of the fluid, like the shadow sphere meshes.
+ *
+ * @param Positions Vertex positions (cm).
+ * @param Normals Outward area-weighted vertex normals.
+ * @param Indices Three vertex indices per triangle.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidSurfaceMesh
+{
+	TArray<FVector3f> Positions;
+
+	TArray<FVector3f> Normals;
+
+	TArray<int32> Indices;
+
+	int32 NumVertices() const { return Positions.Num(); }
+
+	int32 NumTriangles() const { return Indices.Num() / 3; }
+
+	void Reset()
+	{
+		Positions.Reset();
+		Normals.Reset();
+		Indices.Reset();
+	}
+
+	/** Fill a mesh description (static mesh attributes, one polygon group) for baking into assets */
+	void ToMeshDescription(FMeshDescription& OutMeshDescription) const;
+};
+
+/**
+ * @struct FKawaiiFluidSurfaceMeshStats
+ * @brief Size and timing of the last extraction.
+ *
+ * @param NumBricks Field bricks built.
+ * @param NumSplats Particle-brick overlaps splatted.
+ * @param NumVertices Output vertices (one per surface voxel).
+ * @param NumTriangles Output triangles.
+ * @param SplatMs Brick discovery and field splatting time.
+ * @param ContourMs Vertex placement, quad emission and normal time.
+ * @param AllocatedBytes Field and scratch memory held by the mesher.
+ */
+struct FKawaiiFluidSurfaceMeshStats
+{
+	int32 NumBricks = 0;
+
+	int32 NumSplats = 0;
+
+	int32 NumVertices = 0;
+
+	int32 NumTriangles = 0;
+
+	double SplatMs = 0.0;
+
+	double ContourMs = 0.0;
+
+	SIZE_T AllocatedBytes = 0;
+};
+
+/**
+ * @class FKawaiiFluidSurfaceMesher
+ * @brief CPU surface reconstruction of particle state for baked cinematics, collision proxies and offline renders.
+ *
+ * The field lives on a sparse set of 8^3-voxel bricks keyed by brick coordinate, created only where a
+ * particle's splat reaches (narrow band: only around surface particles, with every particle still
+ * contributing). Bricks are splatted in parallel, each gathering its overlapping particles, so there are
+ * no write races.
+ *
+ * The contour is extracted with surface nets (dual contouring with mass-point vertices): one vertex per
+ * voxel with a sign change at the mean of its edge crossings, and one quad per crossing edge joining the
+ * four voxels around it. Vertices are owned by their voxel, so the mesh is welded by construction and
+ * closed wherever the band is; vertex placement and quad emission both run in parallel over bricks.
+ *
+ * @param BrickMap Brick coordinate to brick index.
+ * @param BrickCoords Coordinate of each brick.
+ * @param Field Node values, BrickVolume per brick.
+ * @param SplatOffsets Start of each brick's particle list (CSR).
+ * @param SplatParticles Particles overlapping each brick.
+ * @param SplatRadii Support radius of each particle's splat (cm).
+ * @param VoxelVertices Brick-local vertex index of each voxel (INDEX_NONE = no surface), BrickVolume per brick.
+ * @param BrickVertexOffsets First global vertex of each brick.
+ * @param BrickVertices Vertex positions per brick before concatenation.
+ * @param BrickIndices Triangles per brick before concatenation.
+ * @param LastStats Size and timing of the last extraction.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSurfaceMesher
+{
+public:
+	/**
+	 * @brief Reconstruct the surface of a particle set.
+	 * @param Positions Particle positions (cm).
+	 * @param Settings Resolution and field parameters.
+	 * @param OutMesh Output mesh (reset first).
+	 * @param Anisotropy Optional ellipsoid axes matching Positions.
+	 * @param Flags Optional EGPUParticleFlags matching Positions (IsSurface drives the narrow band).
+	 * @return True if a non-empty mesh was produced.
+	 */
+	bool Extract(TConstArrayView<FVector3f> Positions, const FKawaiiFluidSurfaceMeshSettings& Settings, FKawaiiFluidSurfaceMesh& OutMesh,
+		const FKawaiiFluidAnisotropySnapshot* Anisotropy = nullptr, TConstArrayView<uint32> Flags = TConstArrayView<uint32>());
+
+	/** Reconstruct the surface of a readback snapshot (flags and anisotropy used when present) */
+	bool Extract(const FKawaiiFluidParticleSnapshot& Snapshot, const FKawaiiFluidSurfaceMeshSettings& Settings, FKawaiiFluidSurfaceMesh& OutMesh,
+		const FKawaiiFluidAnisotropySnapshot* Anisotropy = nullptr);
+
+	/** Release the field and scratch memory */
+	void Reset();
+
+	const FKawaiiFluidSurfaceMeshStats& GetLastStats() const { return LastStats; }
+
+	SIZE_T GetAllocatedSize() const;
+
+	/** Voxels per brick edge */
+	static constexpr int32 BrickBits = 3;
+	static constexpr int32 BrickSide = 1 << BrickBits;
+	static constexpr int32 BrickVolume = BrickSide * BrickSide * BrickSide;
+
+private:
+	void BuildBricks(TConstArrayView<FVector3f> Positions, const FKawaiiFluidSurfaceMeshSettings& Settings,
+		const FKawaiiFluidAnisotropySnapshot* Anisotropy, TConstArrayView<uint32> Flags);
+
+	void SplatField(TConstArrayView<FVector3f> Positions, const FKawaiiFluidSurfaceMeshSettings& Settings, const FKawaiiFluidAnisotropySnapshot* Anisotropy);
+
+	void Contour(const FKawaiiFluidSurfaceMeshSettings& Settings, bool bBandLimited, FKawaiiFluidSurfaceMesh& OutMesh);
+
+	TMap<FIntVector, int32> BrickMap;
+
+	TArray<FIntVector> BrickCoords;
+
+	TArray<float> Field;
+
+	TArray<int32> SplatOffsets;
+
+	TArray<int32> SplatParticles;
+
+	TArray<float> SplatRadii;
+
+	TArray<int32> VoxelVertices;
+
+	TArray<int32> BrickVertexOffsets;
+
+	TArray<TArray<FVector3f>> BrickVertices;
+
+	TArray<TArray<int32>> BrickIndices;
+
+	FKawaiiFluidSurfaceMeshStats LastStats;
+};
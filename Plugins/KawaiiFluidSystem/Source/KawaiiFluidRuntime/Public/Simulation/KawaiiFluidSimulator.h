@@ -15,6 +15,9 @@
 #include "Simulation/Managers/KawaiiFluidAdhesionManager.h"
 #include "Simulation/Managers/KawaiiFluidStaticBoundaryGenerator.h"
 #include "Simulation/Resources/GPUBoneDeltaAttachment.h"
+#include "Simulation/Resources/KawaiiFluidParticleSnapshot.h"
+#include "Simulation/Utils/KawaiiFluidReadbackLayout.h"
+#include "Simulation/Utils/KawaiiFluidReadbackRing.h"
 #include "Core/KawaiiFluidAnisotropy.h"
 #include <atomic>
 
@@ -676,9 +679,9 @@ public:
 
 	/**
 	 * Add multiple spawn requests at once (thread-safe, more efficient than individual calls)
-	 * @param Requests - Array of spawn requests to add
+	 * @param Requests - Spawn requests to add (copied)
 	 */
-	void AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests);
+	void AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests);
 
 	/**
 	 * Add GPU brush despawn request - removes particles within radius (thread-safe)
@@ -696,58 +699,61 @@ public:
 	/**
 	 * Set per-source emitter max for GPU-driven recycling (thread-safe)
 	 * GPU automatically removes oldest particles to keep each source under its limit
-	 * @param SourceID - Source component ID (0 to MaxSourceCount-1)
+	 * @param SourceID - Source component ID (dense slot index below MaxSourceCount)
 	 * @param MaxCount - Max particles for this source (0 = no limit / disable)
 	 */
 	void SetSourceEmitterMax(int32 SourceID, int32 MaxCount);
 
 	/**
-	 * Lightweight API for despawn operations - returns positions, IDs and source IDs
-	 * Uses cached data from ProcessStatsReadback (no sync GPU readback needed)
-	 * @param OutPositions - Output array of particle positions
-	 * @param OutParticleIDs - Output array of particle IDs (same index as positions)
-	 * @param OutSourceIDs - Output array of source IDs (same index as positions)
-	 * @return true if valid data was copied
+	 * Latest particle snapshot (positions, velocities, flags, IDs) from ProcessStatsReadback or FinalizeUpload
+	 * The snapshot is immutable: hold the pointer as long as needed and read it without locking
+	 * Only the pointer copy is guarded, publishing a new snapshot never touches one a consumer holds
+	 * Each call returns a separate strong handle; a weak pointer made from it cannot be pinned once the
+	 * consumer's strong handles are gone, so it never observes a snapshot that is being recycled
+	 * @return Shared snapshot, or nullptr if nothing was published yet
 	 */
-	bool GetParticlePositionsAndIDs(TArray<FVector3f>& OutPositions, TArray<int32>& OutParticleIDs, TArray<int32>& OutSourceIDs);
+	TSharedPtr<const FKawaiiFluidParticleSnapshot> GetParticleSnapshot() const;
 
 	/**
-	 * Lightweight API for ISM rendering - returns positions and velocities only
-	 * Much faster than GetAllGPUParticles (24 bytes vs 64 bytes per particle)
-	 * @param OutPositions - Output array of positions
-	 * @param OutVelocities - Output array of velocities
-	 * @return true if valid data was copied
+	 * Latest anisotropy snapshot from ProcessAnisotropyReadback (published on its own ring)
+	 * @return Shared snapshot, or nullptr if no anisotropy readback completed yet
 	 */
-	bool GetParticlePositionsAndVelocities(TArray<FVector3f>& OutPositions, TArray<FVector3f>& OutVelocities);
+	TSharedPtr<const FKawaiiFluidAnisotropySnapshot> GetAnisotropySnapshot() const;
 
 	/**
-	 * Enable/disable velocity readback for ISM rendering
-	 * When enabled, CachedParticleVelocities is populated during ProcessStatsReadback
+	 * Register the particle fields a readback consumer needs (thread-safe)
+	 * The stats readback packs only the union of all registered fields (plus what the stats collector asks for)
+	 * @param Consumer - Consumer slot
+	 * @param FieldMask - EKawaiiFluidReadbackField bits, None to unregister
 	 */
-	void SetFullReadbackEnabled(bool bEnabled) { bFullReadbackEnabled.store(bEnabled); }
+	void SetReadbackConsumerFields(EKawaiiFluidReadbackConsumer Consumer, uint32 FieldMask) { ReadbackConsumerFields[static_cast<int32>(Consumer)].store(FieldMask); }
 
 	/**
-	 * Get particle IDs for a specific SourceID from cached readback data
-	 * Returns nullptr if no cached data or SourceID not found
-	 * Uses CachedSourceIDToParticleIDs built during readback processing
-	 * @param SourceID - Source component ID to query
-	 * @return Pointer to array of particle IDs, or nullptr if not available
+	 * Fields currently registered by a readback consumer
+	 * @param Consumer - Consumer slot
+	 * @return EKawaiiFluidReadbackField bits
 	 */
-	const TArray<int32>* GetParticleIDsBySourceID(int32 SourceID) const;
+	uint32 GetReadbackConsumerFields(EKawaiiFluidReadbackConsumer Consumer) const { return ReadbackConsumerFields[static_cast<int32>(Consumer)].load(); }
 
 	/**
-	 * Get all particle IDs from cached readback data
-	 * Returns nullptr if no cached data available
-	 * @return Pointer to array of all particle IDs, or nullptr if not available
+	 * Union of all registered fields and the fields the stats collector needs this frame
+	 * @return EKawaiiFluidReadbackField bits (None = no stats readback)
 	 */
-	const TArray<int32>* GetAllParticleIDs() const;
+	uint32 ResolveReadbackFieldMask() const;
 
 	/**
-	 * Get particle flags from cached readback data
-	 * Returns nullptr if no cached data available
-	 * @return Pointer to array of particle flags, or nullptr if not available
+	 * Version of the latest particle snapshot
+	 * Incremented each time a snapshot is published; 0 means no readback yet
+	 * @return Monotonic snapshot version
 	 */
-	const TArray<uint32>* GetParticleFlags() const;
+	uint64 GetParticleCacheVersion() const { return ParticleCacheVersion.load(); }
+
+	/**
+	 * Latency and drop telemetry of one readback ring, as of the last BeginFrame (thread-safe)
+	 * @param Ring - Readback ring
+	 * @return Copy of the ring's counters and age histogram
+	 */
+	FKawaiiFluidReadbackRingStats GetReadbackRingStats(EKawaiiFluidReadbackRing Ring) const;
 
 	/**
 	 * Clear all pending spawn requests
@@ -1116,21 +1122,30 @@ private:
 
 	TArray<FGPUFluidParticle> CachedGPUParticles;
 
-	TArray<TArray<int32>> CachedSourceIDToParticleIDs;
+	/** Latest published particle snapshot (pointer swapped under SnapshotLock, never handed out directly) */
+	TSharedPtr<FKawaiiFluidParticleSnapshot> ParticleSnapshot;
 
-	TArray<int32> CachedAllParticleIDs;
+	/** Snapshot replaced by the latest publish, reused by the next readback once no consumer holds it */
+	TSharedPtr<FKawaiiFluidParticleSnapshot> RetiredParticleSnapshot;
 
-	TArray<FVector3f> CachedParticlePositions;
+	/** Latest published anisotropy snapshot (pointer swapped under SnapshotLock) */
+	TSharedPtr<const FKawaiiFluidAnisotropySnapshot> AnisotropySnapshot;
 
-	TArray<int32> CachedParticleSourceIDs;
+	/** Guards the snapshot pointers only, never held while a snapshot is built */
+	mutable FCriticalSection SnapshotLock;
 
-	TArray<FVector3f> CachedParticleVelocities;
+	std::atomic<bool> bHasValidGPUResults{false};
 
-	TArray<uint32> CachedParticleFlags;
+	std::atomic<uint64> ParticleCacheVersion{0};
 
-	std::atomic<bool> bHasValidGPUResults{false};
+	/** Ring telemetry copied from the render thread once per BeginFrame */
+	FKawaiiFluidReadbackRingStats PublishedReadbackRingStats[static_cast<int32>(EKawaiiFluidReadbackRing::Count)];
 
-	std::atomic<bool> bFullReadbackEnabled{false};
+	/** Guards PublishedReadbackRingStats */
+	mutable FCriticalSection ReadbackRingStatsLock;
+
+	/** Fields registered per EKawaiiFluidReadbackConsumer */
+	std::atomic<uint32> ReadbackConsumerFields[static_cast<int32>(EKawaiiFluidReadbackConsumer::Count)] = {};
 
 	TRefCountPtr<FRDGPooledBuffer> PersistentParticleBuffer;
 
@@ -1218,12 +1233,10 @@ private:
 	/** GPU-authoritative particle count buffer for DispatchIndirect */
 	TRefCountPtr<FRDGPooledBuffer> PersistentParticleCountBuffer;
 
-	/** Triple-buffered async readback for GPU particle count → CPU CurrentParticleCount */
-	static constexpr int32 NUM_COUNT_READBACK_BUFFERS = 3;
-	FRHIGPUBufferReadback* CountReadbacks[NUM_COUNT_READBACK_BUFFERS] = { nullptr };
-	bool bCountReadbackValid[NUM_COUNT_READBACK_BUFFERS] = { false, false, false };
-	uint64 CountReadbackFrameNumbers[NUM_COUNT_READBACK_BUFFERS] = { 0 };
-	int32 CountReadbackWriteIndex = 0;
+	/** Async readback for GPU particle count → CPU CurrentParticleCount (newest wins) */
+	static constexpr int32 MAX_COUNT_READBACK_DEPTH = 6;
+	TKawaiiFluidReadbackRing<FRHIGPUBufferReadback, FKawaiiFluidReadbackNoPayload, MAX_COUNT_READBACK_DEPTH> CountReadbackRing{
+		TEXT("ParticleCountReadback"), EKawaiiFluidReadbackConsumePolicy::Newest };
 
 	/** True once particles have ever existed (replaces CurrentParticleCount==0 early-out) */
 	bool bEverHadParticles = false;
@@ -1288,78 +1301,61 @@ private:
 	/** Current capacity of BoneDeltaAttachment buffer */
 	int32 BoneDeltaAttachmentCapacity = 0;
 
-	//=============================================================================
-	// Shadow Data (extracted from StatsReadback in ProcessStatsReadback)
-	//=============================================================================
-
-	/** Ready positions (extracted from StatsReadback) */
-	TArray<FVector3f> ReadyShadowPositions;
-
-	/** Ready velocities (extracted from StatsReadback, for prediction) */
-	TArray<FVector3f> ReadyShadowVelocities;
-
-	/** Ready neighbor counts (extracted from StatsReadback, for isolation detection) */
-	TArray<uint32> ReadyShadowNeighborCounts;
-
-	/** Frame number of ready shadow data */
-	std::atomic<uint64> ReadyShadowPositionsFrame{0};
-
-	/** Enable flag for shadow data extraction */
-	std::atomic<bool> bShadowReadbackEnabled{false};
-
 	//=============================================================================
 	// Anisotropy Readback (Async GPU→CPU for Ellipsoid ISM Shadows)
 	// Uses FRHIGPUBufferReadback for non-blocking readback (2-3 frame latency)
 	//=============================================================================
 
-	static constexpr int32 NUM_ANISOTROPY_READBACK_BUFFERS = 3;  // Triple buffering
-
-	/** Async readback objects for anisotropy data (3 axes) */
-	FRHIGPUBufferReadback* AnisotropyReadbacks[NUM_ANISOTROPY_READBACK_BUFFERS][3] = { {nullptr} };
+	static constexpr int32 MAX_ANISOTROPY_READBACK_DEPTH = 6;
 
-	/** Current write index for anisotropy ring buffer */
-	int32 AnisotropyReadbackWriteIndex = 0;
-
-	/** Frame number tracking for each anisotropy readback buffer */
-	uint64 AnisotropyReadbackFrameNumbers[NUM_ANISOTROPY_READBACK_BUFFERS] = { 0 };
+	/**
+	 * One anisotropy readback: the three axis buffers, ready when all of them are
+	 * @param Axes - Readback per ellipsoid axis
+	 */
+	struct FAnisotropyReadbackSet
+	{
+		explicit FAnisotropyReadbackSet(FName InName);
+		~FAnisotropyReadbackSet();
 
-	/** Particle count at the time anisotropy readback was enqueued */
-	int32 AnisotropyReadbackParticleCounts[NUM_ANISOTROPY_READBACK_BUFFERS] = { 0 };
+		bool IsReady() const;
 
-	/** Ready anisotropy data (copied from completed readback, for ellipsoid shadows) */
-	TArray<FVector4f> ReadyShadowAnisotropyAxis1;
-	TArray<FVector4f> ReadyShadowAnisotropyAxis2;
-	TArray<FVector4f> ReadyShadowAnisotropyAxis3;
+		TUniquePtr<FRHIGPUBufferReadback> Axes[3];
+	};
 
-	/** Frame number of ready anisotropy */
-	std::atomic<uint64> ReadyShadowAnisotropyFrame{0};
+	/** Anisotropy readback ring (oldest first), payload = particle count at enqueue */
+	TKawaiiFluidReadbackRing<FAnisotropyReadbackSet, int32, MAX_ANISOTROPY_READBACK_DEPTH> AnisotropyReadbackRing{
+		TEXT("AnisotropyReadback"), EKawaiiFluidReadbackConsumePolicy::Oldest };
 
 	//=============================================================================
 	// Stats/Recycle Readback (Async GPU→CPU for ParticleID-based operations)
 	// Uses FRHIGPUBufferReadback for non-blocking readback (2-3 frame latency)
 	//=============================================================================
 
-	static constexpr int32 NUM_STATS_READBACK_BUFFERS = 3;  // Triple buffering
-
-	/** Async readback objects for full particle data (for ID-based operations) */
-	FRHIGPUBufferReadback* StatsReadbacks[NUM_STATS_READBACK_BUFFERS] = { nullptr };
+	static constexpr int32 MAX_STATS_READBACK_DEPTH = 6;
 
-	/** Current write index for stats readback ring buffer */
-	int32 StatsReadbackWriteIndex = 0;
+	/**
+	 * What a stats readback slot was written with
+	 * @param ParticleCount - Records in the readback
+	 * @param Layout - Packed record layout
+	 */
+	struct FStatsReadbackPayload
+	{
+		int32 ParticleCount = 0;
 
-	/** Frame number tracking for each stats readback buffer */
-	uint64 StatsReadbackFrameNumbers[NUM_STATS_READBACK_BUFFERS] = { 0 };
+		FKawaiiFluidReadbackLayout Layout;
+	};
 
-	/** Particle count for each stats readback buffer */
-	int32 StatsReadbackParticleCounts[NUM_STATS_READBACK_BUFFERS] = { 0 };
+	/** Packed particle readback ring (newest wins, older ready slots are stale pre-despawn data) */
+	TKawaiiFluidReadbackRing<FRHIGPUBufferReadback, FStatsReadbackPayload, MAX_STATS_READBACK_DEPTH> StatsReadbackRing{
+		TEXT("StatsReadback"), EKawaiiFluidReadbackConsumePolicy::Newest };
 
-	/** Compact stats readback mode tracking (true = compact 32-byte, false = full 64-byte) */
-	bool bStatsReadbackCompactMode[NUM_STATS_READBACK_BUFFERS] = { false };
+	/** Unpack destination kept across readbacks (snapshot columns are swapped in and out, stats columns stay) */
+	FKawaiiFluidReadbackColumns StatsReadbackColumns;
 
 	/** Persistent compact stats buffer for GPU extraction */
 	TRefCountPtr<FRDGPooledBuffer> PersistentCompactStatsBuffer;
 
-	/** Enable flag for anisotropy readback (requires bShadowReadbackEnabled) */
+	/** Enable flag for anisotropy readback (requires the Shadow consumer fields) */
 	std::atomic<bool> bAnisotropyReadbackEnabled{false};
 
 	//=============================================================================
@@ -1368,19 +1364,11 @@ private:
 	// Uses FRHIGPUBufferReadback for non-blocking readback (2-3 frame latency)
 	//=============================================================================
 
-	static constexpr int32 NUM_DEBUG_INDEX_READBACK_BUFFERS = 3;  // Triple buffering
-
-	/** Async readback objects for debug Z-Order array indices */
-	FRHIGPUBufferReadback* DebugIndexReadbacks[NUM_DEBUG_INDEX_READBACK_BUFFERS] = { nullptr };
-
-	/** Current write index for debug index readback ring buffer */
-	int32 DebugIndexReadbackWriteIndex = 0;
-
-	/** Frame number tracking for each debug index readback buffer */
-	uint64 DebugIndexReadbackFrameNumbers[NUM_DEBUG_INDEX_READBACK_BUFFERS] = { 0 };
+	static constexpr int32 MAX_DEBUG_INDEX_READBACK_DEPTH = 6;
 
-	/** Particle count for each debug index readback buffer */
-	int32 DebugIndexReadbackParticleCounts[NUM_DEBUG_INDEX_READBACK_BUFFERS] = { 0 };
+	/** Debug Z-Order index readback ring (oldest first), payload = particle count at enqueue */
+	TKawaiiFluidReadbackRing<FRHIGPUBufferReadback, int32, MAX_DEBUG_INDEX_READBACK_DEPTH> DebugIndexReadbackRing{
+		TEXT("DebugIndexReadback"), EKawaiiFluidReadbackConsumePolicy::Oldest };
 
 	/** Persistent GPU buffer for debug Z-Order array indices (int32 per particle) */
 	TRefCountPtr<FRDGPooledBuffer> PersistentDebugZOrderIndexBuffer;
@@ -1400,16 +1388,11 @@ private:
 	// Uses FRHIGPUBufferReadback for non-blocking readback (2-3 frame latency)
 	//=============================================================================
 
-	static constexpr int32 NUM_PARTICLE_BOUNDS_READBACK_BUFFERS = 3;  // Triple buffering
+	static constexpr int32 MAX_PARTICLE_BOUNDS_READBACK_DEPTH = 6;
 
-	/** Async readback objects for particle bounds (2 × FVector3f: Min, Max) */
-	FRHIGPUBufferReadback* ParticleBoundsReadbacks[NUM_PARTICLE_BOUNDS_READBACK_BUFFERS] = { nullptr };
-
-	/** Current write index for particle bounds readback ring buffer */
-	int32 ParticleBoundsReadbackWriteIndex = 0;
-
-	/** Frame number tracking for each particle bounds readback buffer */
-	uint64 ParticleBoundsReadbackFrameNumbers[NUM_PARTICLE_BOUNDS_READBACK_BUFFERS] = { 0 };
+	/** Particle bounds readback ring (oldest first, 2 × FVector3f: Min, Max) */
+	TKawaiiFluidReadbackRing<FRHIGPUBufferReadback, FKawaiiFluidReadbackNoPayload, MAX_PARTICLE_BOUNDS_READBACK_DEPTH> ParticleBoundsReadbackRing{
+		TEXT("ParticleBoundsReadback"), EKawaiiFluidReadbackConsumePolicy::Oldest };
 
 	/** Cached particle bounds (AABB from GPU readback) */
 	FBox CachedParticleBounds;
@@ -1463,47 +1446,11 @@ public:
 	void EnqueueParticleBoundsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer);
 
 	//=============================================================================
-	// Shadow Position Readback API
+	// Shadow Anisotropy Readback API
+	// Shadow positions, velocities and neighbor counts come with the particle snapshot
+	// (EKawaiiFluidReadbackConsumer::Shadow)
 	//=============================================================================
 
-	/**
-	 * Enable or disable shadow position readback
-	 * When enabled, particle positions are asynchronously read back for ISM shadows
-	 * @param bEnabled - true to enable async position readback
-	 */
-	void SetShadowReadbackEnabled(bool bEnabled) { bShadowReadbackEnabled.store(bEnabled); }
-
-	/**
-	 * Check if shadow readback is enabled
-	 */
-	bool IsShadowReadbackEnabled() const { return bShadowReadbackEnabled.load(); }
-
-	/**
-	 * Check if shadow positions are ready for use
-	 * @return true if async readback has completed and positions are available
-	 */
-	bool HasReadyShadowPositions() const { return ReadyShadowPositionsFrame.load() > 0 && ReadyShadowPositions.Num() > 0; }
-
-	/**
-	 * Get shadow positions (non-blocking, returns previously completed readback)
-	 * @param OutPositions - Output array of particle positions
-	 * @return true if valid positions were retrieved
-	 */
-	bool GetShadowPositions(TArray<FVector>& OutPositions) const;
-
-	/**
-	 * Get shadow positions and velocities (non-blocking, for prediction)
-	 * @param OutPositions - Output array of particle positions
-	 * @param OutVelocities - Output array of particle velocities
-	 * @return true if valid data was retrieved
-	 */
-	bool GetShadowPositionsAndVelocities(TArray<FVector>& OutPositions, TArray<FVector>& OutVelocities) const;
-
-	/**
-	 * Get shadow position count
-	 */
-	int32 GetShadowPositionCount() const { return ReadyShadowPositions.Num(); }
-
 	/**
 	 * Enable or disable anisotropy readback for ellipsoid shadows
 	 * Requires shadow readback to be enabled first
@@ -1516,47 +1463,6 @@ public:
 	 */
 	bool IsAnisotropyReadbackEnabled() const { return bAnisotropyReadbackEnabled.load(); }
 
-	/**
-	 * Check if anisotropy data is ready for use
-	 * @return true if anisotropy readback has completed
-	 */
-	bool HasReadyAnisotropyData() const { return ReadyShadowAnisotropyAxis1.Num() > 0; }
-
-	/**
-	 * Get shadow data with anisotropy (non-blocking, for ellipsoid ISM shadows)
-	 * @param OutPositions - Output array of particle positions
-	 * @param OutVelocities - Output array of particle velocities
-	 * @param OutAnisotropyAxis1 - Output array of first ellipsoid axis (xyz=dir, w=scale)
-	 * @param OutAnisotropyAxis2 - Output array of second ellipsoid axis
-	 * @param OutAnisotropyAxis3 - Output array of third ellipsoid axis
-	 * @return true if valid data was retrieved
-	 */
-	bool GetShadowDataWithAnisotropy(
-		TArray<FVector>& OutPositions,
-		TArray<FVector>& OutVelocities,
-		TArray<FVector4>& OutAnisotropyAxis1,
-		TArray<FVector4>& OutAnisotropyAxis2,
-		TArray<FVector4>& OutAnisotropyAxis3) const;
-
-	//=============================================================================
-	// Neighbor Count Readback API (for isolation detection)
-	// Note: Neighbor counts are automatically included in shadow position readback
-	// since FGPUFluidParticle already contains NeighborCount field.
-	//=============================================================================
-
-	/**
-	 * Check if neighbor count data is ready for use
-	 * @return true if shadow readback has completed (neighbor counts are included)
-	 */
-	bool HasReadyNeighborCountData() const { return ReadyShadowNeighborCounts.Num() > 0; }
-
-	/**
-	 * Get neighbor counts (non-blocking, for isolation detection)
-	 * @param OutNeighborCounts - Output array of neighbor counts per particle
-	 * @return true if valid data was retrieved
-	 */
-	bool GetShadowNeighborCounts(TArray<int32>& OutNeighborCounts) const;
-
 	//=============================================================================
 	// Debug Z-Order Array Index API (for visualization)
 	// Returns array indices after Z-Order sort, before ParticleID re-sort
@@ -1589,23 +1495,25 @@ public:
 	bool GetZOrderArrayIndices(TArray<int32>& OutIndices) const;
 
 private:
-	void AllocateAnisotropyReadbackObjects(FRHICommandListImmediate& RHICmdList);
-
 	void ReleaseAnisotropyReadbackObjects();
 
 	void EnqueueAnisotropyReadback(FRHICommandListImmediate& RHICmdList, int32 ParticleCount);
 
 	void ProcessAnisotropyReadback();
 
-	void AllocateStatsReadbackObjects(FRHICommandListImmediate& RHICmdList);
-
 	void ReleaseStatsReadbackObjects();
 
-	void EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, bool bCompactMode = false);
+	void EnqueueStatsReadback(FRHICommandListImmediate& RHICmdList, FRHIBuffer* SourceBuffer, int32 ParticleCount, const FKawaiiFluidReadbackLayout& Layout);
 
 	void ProcessStatsReadback(FRHICommandListImmediate& RHICmdList);
 
-	void AllocateDebugIndexReadbackObjects(FRHICommandListImmediate& RHICmdList);
+	TSharedRef<FKawaiiFluidParticleSnapshot> AcquireRecycledParticleSnapshot();
+
+	void PublishParticleSnapshot(const TSharedRef<FKawaiiFluidParticleSnapshot>& Snapshot);
+
+	void PublishAnisotropySnapshot(const TSharedRef<FKawaiiFluidAnisotropySnapshot>& Snapshot);
+
+	void ResetSnapshots();
 
 	void ReleaseDebugIndexReadbackObjects();
 
@@ -1615,9 +1523,9 @@ private:
 
 	void AddRecordZOrderIndicesPass(FRDGBuilder& GraphBuilder, FRDGBufferRef ParticleBuffer, int32 ParticleCount);
 
-	void AllocateParticleBoundsReadbackObjects(FRHICommandListImmediate& RHICmdList);
-
 	void ReleaseParticleBoundsReadbackObjects();
 
 	void ProcessParticleBoundsReadback();
+
+	void PublishReadbackRingStats();
 };
@@ -27,10 +27,10 @@ class FRDGBuilder;
  * @param ActiveGPUSourceDespawns Buffer for source despawns being processed.
  * @param GPUDespawnLock Critical section for despawn request thread safety.
  * @param bHasPendingGPUDespawnRequests Atomic flag for quick despawn pending check.
- * @param PersistentIDHistogramBuffer GPU buffer for ID distribution histogram.
- * @param PersistentOldestThresholdBuffer GPU buffer for oldest-particle ID thresholds.
- * @param PersistentBoundaryCounterBuffer GPU buffer for atomic counter.
- * @param EmitterMaxCountsCPU CPU-side per-source particle limits.
+ * @param PersistentIDHistogramBuffer GPU buffer for the per-source ID distribution histograms.
+ * @param PersistentOldestThresholdBuffer GPU buffer for per-source oldest-particle ID thresholds.
+ * @param PersistentBoundaryCounterBuffer GPU buffer for per-source atomic boundary counters.
+ * @param EmitterMaxCountsCPU CPU-side per-source particle limits (grown on demand).
  * @param bEmitterMaxCountsDirty Flag indicating need to update GPU emitter limits.
  * @param ActiveEmitterMaxCount Number of sources with active limits.
  * @param PersistentEmitterMaxCountsBuffer GPU buffer for source limits.
@@ -38,12 +38,16 @@ class FRDGBuilder;
  * @param NextParticleID Atomic counter for assigning unique particle IDs.
  * @param DefaultSpawnRadius Default radius assigned to new particles.
  * @param DefaultSpawnMass Default mass assigned to new particles.
- * @param SourceCounterBuffer GPU buffer tracking particle count per source.
+ * @param SourceSlotCount One past the highest SourceID that may hold particles (sizes readbacks and recycle passes).
+ * @param RecentReservedSlotCount One past the highest SourceID reserved since the last counter readback was enqueued.
+ * @param SourceCounterBuffer GPU buffer tracking particle count per source (power-of-two capacity).
  * @param SourceCounterReadbacks Ring buffer for async GPU->CPU source count transfers.
+ * @param SourceCounterReadbackSlotCounts Number of slots copied by each in-flight readback.
+ * @param SourceCounterReadbackReservedCounts RecentReservedSlotCount captured when each readback was enqueued.
  * @param SourceCounterWriteIndex Current write index in readback ring buffer.
  * @param SourceCounterReadIndex Current read index in readback ring buffer.
  * @param SourceCounterPendingCount Number of active readback operations.
- * @param CachedSourceCounts Locally cached particle counts per source.
+ * @param CachedSourceCounts Locally cached particle counts per source ([0, SourceSlotCount) prefix).
  * @param SourceCountLock Critical section for source count access.
  * @param PersistentAliveMaskBuffer Reusable GPU buffer for particle survival flags.
  * @param PersistentPrefixSumsBuffer Reusable GPU buffer for parallel scan outputs.
@@ -101,7 +105,7 @@ public:
 
 	void AddSpawnRequest(const FVector3f& Position, const FVector3f& Velocity, float Mass = 1.0f);
 
-	void AddSpawnRequests(const TArray<FGPUSpawnRequest>& Requests);
+	void AddSpawnRequests(TConstArrayView<FGPUSpawnRequest> Requests);
 
 	void ClearSpawnRequests();
 
@@ -154,6 +158,14 @@ public:
 
 	void InitializeSourceCountersFromParticles(const TArray<FGPUFluidParticle>& Particles);
 
+	void ReserveSourceSlot(int32 SourceID);
+
+	int32 GetSourceSlotCount() const { return SourceSlotCount.load(); }
+
+	static void CountParticlesPerSource(const TArray<FGPUFluidParticle>& Particles, TArray<int32>& OutCounts);
+
+	static void UnpackSourceCounts(const uint32* Data, int32 SlotCount, TArray<int32>& OutCounts);
+
 	//=========================================================================
 	// Configuration
 	//=========================================================================
@@ -192,7 +204,7 @@ public:
 
 	const TArray<FGPUSpawnRequest>& GetActiveRequests() const { return ActiveSpawnRequests; }
 
-	void ClearActiveRequests() { ActiveSpawnRequests.Empty(); }
+	void ClearActiveRequests() { ActiveSpawnRequests.Reset(); }
 
 	void AddSpawnParticlesPass(
 		FRDGBuilder& GraphBuilder,
@@ -232,19 +244,19 @@ private:
 	// Lock-free flag for quick pending check
 	std::atomic<bool> bHasPendingGPUDespawnRequests{false};
 
-	// Persistent buffers for Oldest despawn histogram
-	TRefCountPtr<FRDGPooledBuffer> PersistentIDHistogramBuffer;      // uint32 x 256
-	TRefCountPtr<FRDGPooledBuffer> PersistentOldestThresholdBuffer;  // uint32 x 2
-	TRefCountPtr<FRDGPooledBuffer> PersistentBoundaryCounterBuffer;  // uint32 x 1
+	// Persistent buffers for Oldest despawn histogram (one table entry per limited source slot)
+	TRefCountPtr<FRDGPooledBuffer> PersistentIDHistogramBuffer;      // uint32 x 256 x sources
+	TRefCountPtr<FRDGPooledBuffer> PersistentOldestThresholdBuffer;  // uint32 x 2 x sources
+	TRefCountPtr<FRDGPooledBuffer> PersistentBoundaryCounterBuffer;  // uint32 x sources
 
 	//=========================================================================
 	// Per-Source Emitter Max (GPU-Driven Recycle)
 	//=========================================================================
-	TArray<int32> EmitterMaxCountsCPU;                                // [MaxSourceCount], 0 = no limit
+	TArray<int32> EmitterMaxCountsCPU;                                // [highest limited SourceID + 1], 0 = no limit
 	bool bEmitterMaxCountsDirty = false;
 	int32 ActiveEmitterMaxCount = 0;                                  // Count of non-zero entries
-	TRefCountPtr<FRDGPooledBuffer> PersistentEmitterMaxCountsBuffer;  // uint32 x MaxSourceCount
-	TRefCountPtr<FRDGPooledBuffer> PersistentPerSourceExcessBuffer;   // uint32 x MaxSourceCount
+	TRefCountPtr<FRDGPooledBuffer> PersistentEmitterMaxCountsBuffer;  // uint32 x source counter capacity
+	TRefCountPtr<FRDGPooledBuffer> PersistentPerSourceExcessBuffer;   // uint32 x source counter capacity
 
 	//=========================================================================
 	// Particle ID Tracking
@@ -264,7 +276,14 @@ private:
 	// Source Counter (Per-Component Particle Count)
 	//=========================================================================
 
-	// GPU buffer storing per-source particle counts [MaxSourceCount]
+	// One past the highest SourceID that may hold particles (lock-free max, written from any thread;
+	// trimmed back to the highest counted slot when a counter readback completes)
+	std::atomic<int32> SourceSlotCount{0};
+
+	// Reservations not yet covered by an enqueued readback (keeps freshly used slots alive across the trim)
+	std::atomic<int32> RecentReservedSlotCount{0};
+
+	// GPU buffer storing per-source particle counts [GetCapacityForSlotCount(SourceSlotCount)]
 	TRefCountPtr<FRDGPooledBuffer> SourceCounterBuffer;
 
 	// Ring buffer for async GPU→CPU readback (handles GPU latency)
@@ -273,6 +292,8 @@ private:
 	int32 SourceCounterWriteIndex = 0;  // Next slot to write (enqueue)
 	int32 SourceCounterReadIndex = 0;   // Next slot to read (process)
 	int32 SourceCounterPendingCount = 0; // Number of pending readbacks
+	int32 SourceCounterReadbackSlotCounts[SourceCounterRingBufferSize] = {};
+	int32 SourceCounterReadbackReservedCounts[SourceCounterRingBufferSize] = {};
 
 	// CPU-cached source counts (updated from readback)
 	TArray<int32> CachedSourceCounts;
@@ -290,6 +311,12 @@ private:
 	int32 CompactedBufferIndex = 0;
 	int32 StreamCompactionCapacity = 0;
 
+	/** Slot count of the GPU source counter buffer (0 if not yet created) */
+	int32 GetSourceCounterCapacity() const { return SourceCounterBuffer.IsValid() ? static_cast<int32>(SourceCounterBuffer->Desc.NumElements) : 0; }
+
+	/** Shrink SourceSlotCount to the live slots after a counter readback (never below a pending reservation) */
+	void TrimSourceSlotCount(int32 HighestCountedSlotCount);
+
 	/** Ensure stream compaction buffers are allocated with sufficient capacity */
 	void EnsureStreamCompactionBuffers(FRDGBuilder& GraphBuilder, int32 RequiredCapacity);
 
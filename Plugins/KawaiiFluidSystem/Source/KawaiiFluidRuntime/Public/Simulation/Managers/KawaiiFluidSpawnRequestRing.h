@@ -0,0 +1,127 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include <atomic>
+
+/**
+ * @class FKawaiiFluidSpawnRequestRing
+ * @brief Single-producer/single-consumer queue of spawn requests built from recycled, preallocated blocks.
+ *
+ * Emitters (producer) copy requests straight into fixed-size blocks and publish them with a release store;
+ * the owning volume (consumer) visits committed requests in place, block by block, and hands consumed
+ * blocks back to a free list. New blocks are only allocated while the in-flight high-water mark grows,
+ * so steady-state spawning performs no allocations and never drops requests.
+ *
+ * Cancellation is fenced: CancelSource/CancelAll record the producer's write position, and the consumer
+ * skips matching requests written before that position.
+ *
+ * @param HeadBlock Consumer: block being read.
+ * @param HeadReadIndex Consumer: next unread slot in HeadBlock.
+ * @param ReadSequence Consumer: absolute index of the next unread request.
+ * @param TailBlock Producer: block being written.
+ * @param WrittenCount Total requests published by the producer.
+ * @param ConsumedCount Total requests passed by the consumer (delivered or cancelled).
+ * @param FreeBlocks Recycled blocks available to the producer.
+ * @param FreeLock Guards FreeBlocks (taken once per block, not per request).
+ * @param NumAllocatedBlocks Blocks allocated over the ring's lifetime.
+ * @param CancelFences Pending cancellations (SourceID + write position).
+ * @param CancelLock Guards CancelFences.
+ * @param bHasCancelFences Lock-free check for pending cancellations.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSpawnRequestRing
+{
+public:
+	/** Requests per block */
+	static constexpr int32 BlockSize = 1024;
+
+	/** Blocks allocated up front */
+	static constexpr int32 DefaultPreallocatedBlocks = 4;
+
+	explicit FKawaiiFluidSpawnRequestRing(int32 NumPreallocatedBlocks = DefaultPreallocatedBlocks);
+
+	~FKawaiiFluidSpawnRequestRing();
+
+	FKawaiiFluidSpawnRequestRing(const FKawaiiFluidSpawnRequestRing&) = delete;
+
+	FKawaiiFluidSpawnRequestRing& operator=(const FKawaiiFluidSpawnRequestRing&) = delete;
+
+	//========================================
+	// Producer
+	//========================================
+
+	void Push(const FGPUSpawnRequest& Request);
+
+	void Push(TConstArrayView<FGPUSpawnRequest> Requests);
+
+	void CancelSource(int32 SourceID);
+
+	void CancelAll();
+
+	//========================================
+	// Consumer
+	//========================================
+
+	int32 Consume(TFunctionRef<void(TArrayView<FGPUSpawnRequest>)> Visitor);
+
+	//========================================
+	// Queries (any thread, approximate while in flight)
+	//========================================
+
+	int32 Num() const { return static_cast<int32>(WrittenCount.load(std::memory_order_acquire) - ConsumedCount.load(std::memory_order_acquire)); }
+
+	bool IsEmpty() const { return Num() == 0; }
+
+	int32 GetNumAllocatedBlocks() const { return NumAllocatedBlocks.load(std::memory_order_relaxed); }
+
+private:
+	struct FBlock
+	{
+		FGPUSpawnRequest Requests[BlockSize];
+
+		std::atomic<int32> Committed{0};
+
+		std::atomic<FBlock*> Next{nullptr};
+	};
+
+	struct FCancelFence
+	{
+		int32 SourceID;
+
+		uint64 Sequence;
+	};
+
+	static constexpr int32 AllSources = MIN_int32;
+
+	FBlock* AcquireBlock();
+
+	void ReleaseBlock(FBlock* Block);
+
+	void AddCancelFence(int32 SourceID);
+
+	FBlock* HeadBlock = nullptr;
+
+	int32 HeadReadIndex = 0;
+
+	uint64 ReadSequence = 0;
+
+	FBlock* TailBlock = nullptr;
+
+	std::atomic<uint64> WrittenCount{0};
+
+	std::atomic<uint64> ConsumedCount{0};
+
+	TArray<FBlock*> FreeBlocks;
+
+	FCriticalSection FreeLock;
+
+	std::atomic<int32> NumAllocatedBlocks{0};
+
+	TArray<FCancelFence, TInlineAllocator<8>> CancelFences;
+
+	FCriticalSection CancelLock;
+
+	std::atomic<bool> bHasCancelFences{false};
+};
@@ -0,0 +1,116 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidAnisotropy.h"
+#include "Simulation/Utils/KawaiiFluidNeighborCSR.h"
+
+struct FKawaiiFluidAnisotropySnapshot;
+
+namespace KawaiiFluidAnisotropyMath
+{
+	/**
+	 * @struct FSymmetricEigen3
+	 * @brief Eigen decomposition of a symmetric 3x3 matrix.
+	 *
+	 * @param Values Eigenvalues in descending order.
+	 * @param Vectors Orthonormal, right-handed eigenvectors matching Values.
+	 */
+	struct FSymmetricEigen3
+	{
+		FVector3f Values = FVector3f::ZeroVector;
+
+		FVector3f Vectors[3] = { FVector3f(1.0f, 0.0f, 0.0f), FVector3f(0.0f, 1.0f, 0.0f), FVector3f(0.0f, 0.0f, 1.0f) };
+	};
+
+	/**
+	 * @brief Cyclic Jacobi eigen solver for symmetric 3x3 matrices (upper triangle given).
+	 *
+	 * Unlike the closed-form SymmetricEigen3x3 of the shader it stays accurate for repeated and
+	 * near-repeated eigenvalues, rank-deficient and badly scaled matrices, and always returns an
+	 * orthonormal basis. Non-finite input yields zero eigenvalues and the identity basis.
+	 */
+	KAWAIIFLUIDRUNTIME_API FSymmetricEigen3 SolveSymmetricEigen3x3(float M00, float M01, float M02, float M11, float M12, float M22);
+
+	/** BuildOrthonormalBasis of the shader (Frisvad): T and B complete the unit vector N */
+	KAWAIIFLUIDRUNTIME_API void BuildOrthonormalBasis(const FVector3f& N, FVector3f& OutT, FVector3f& OutB);
+
+	/** KernelWeight of the shader: cubic spline, 1 at the center, 0 at H */
+	KAWAIIFLUIDRUNTIME_API float KernelWeight(float Distance, float H);
+}
+
+/**
+ * @class FKawaiiFluidAnisotropySolver
+ * @brief Parallel CPU port of KawaiiFluidSimulationAnisotropy.usf for consumers without a GPU round-trip.
+ *
+ * Computes the same ellipsoids as the compute shader from positions, velocities and CSR neighbor lists:
+ * velocity-based, density-based (weighted covariance around the smoothed center, Yu & Turk ratio clamp,
+ * log-space volume preservation or FleX scales) and hybrid, with the MinStretch/MaxStretch clamps,
+ * UpdateInterval and per-index temporal smoothing. Output uses the layout of the anisotropy readback
+ * (xyz = axis, w = scale), so shadows, ISM proxies and exports can use either source.
+ *
+ * Differences to the GPU: the covariance uses every neighbor instead of the first 32, the eigen solver is
+ * Jacobi instead of Cardano, and the collider surface-normal pancakes and boundary particle covariance
+ * are not covered.
+ *
+ * @param Axis1 Major axis and scale per particle.
+ * @param Axis2 Intermediate axis and scale per particle.
+ * @param Axis3 Minor axis and scale per particle.
+ * @param FramesSinceUpdate Frames since the last computed update (UpdateInterval).
+ * @param Neighbors CSR scratch of the particle overload.
+ * @param PositionScratch Position scratch of the particle overload.
+ * @param VelocityScratch Velocity scratch of the particle overload.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidAnisotropySolver
+{
+public:
+	/**
+	 * @brief Compute ellipsoids when UpdateInterval has elapsed or the particle count changed.
+	 * @param Params Anisotropy parameters.
+	 * @param Positions Particle positions (cm).
+	 * @param Velocities Particle velocities (cm/s), same count as Positions.
+	 * @param InNeighbors Neighbor lists of the particles.
+	 * @param SmoothingRadius Kernel radius (cm).
+	 * @return True if new ellipsoids were computed this call.
+	 */
+	bool Update(const FKawaiiFluidAnisotropyParams& Params, TConstArrayView<FVector3f> Positions, TConstArrayView<FVector3f> Velocities,
+		const FKawaiiFluidNeighborCSR& InNeighbors, float SmoothingRadius);
+
+	/** Update from CPU simulation particles and their cached neighbor lists */
+	bool Update(const FKawaiiFluidAnisotropyParams& Params, const TArray<FKawaiiFluidParticle>& Particles, float SmoothingRadius);
+
+	/** Forget the results and the temporal history */
+	void Reset();
+
+	bool HasResult() const { return Axis1.Num() > 0; }
+
+	TConstArrayView<FVector4f> GetAxis1() const { return Axis1; }
+
+	TConstArrayView<FVector4f> GetAxis2() const { return Axis2; }
+
+	TConstArrayView<FVector4f> GetAxis3() const { return Axis3; }
+
+	/** Copy the current ellipsoids into a snapshot shaped like an anisotropy readback */
+	TSharedRef<FKawaiiFluidAnisotropySnapshot> MakeSnapshot(uint64 Frame) const;
+
+private:
+	bool ShouldUpdate(const FKawaiiFluidAnisotropyParams& Params, int32 Num);
+
+	void Compute(const FKawaiiFluidAnisotropyParams& Params, TConstArrayView<FVector3f> Positions, TConstArrayView<FVector3f> Velocities,
+		const FKawaiiFluidNeighborCSR& InNeighbors, float SmoothingRadius);
+
+	TArray<FVector4f> Axis1;
+
+	TArray<FVector4f> Axis2;
+
+	TArray<FVector4f> Axis3;
+
+	int32 FramesSinceUpdate = 0;
+
+	FKawaiiFluidNeighborCSR Neighbors;
+
+	TArray<FVector3f> PositionScratch;
+
+	TArray<FVector3f> VelocityScratch;
+};
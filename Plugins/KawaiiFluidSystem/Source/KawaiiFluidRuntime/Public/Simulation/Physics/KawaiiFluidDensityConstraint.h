@@ -55,6 +55,7 @@ struct FSPHKernelCoeffs
  * @brief Solver for enforcing fluid incompressibility using Position-Based Fluids (PBF) constraints.
  *
  * Enforces the density constraint: C_i = (ρ_i / ρ_0) - 1 = 0 by iteratively correcting particle positions.
+ * Particles past NumSolved are read-only neighbors: they add density and keep their own Lambda, but are not corrected.
  * 
  * @param RestDensity Target rest density of the fluid (kg/m³).
  * @param Epsilon Stability constant / XPBD compliance factor (α̃ = α / dt²).
@@ -68,6 +69,8 @@ struct FSPHKernelCoeffs
  * @param DeltaPX Array of calculated position X corrections (SoA format).
  * @param DeltaPY Array of calculated position Y corrections (SoA format).
  * @param DeltaPZ Array of calculated position Z corrections (SoA format).
+ * @param PendingCoeffs Kernel coefficients of the last EvaluateDensities, used by ApplyCorrections.
+ * @param PendingNumSolved Solved particle count of the last EvaluateDensities.
  */
 class KAWAIIFLUIDRUNTIME_API FKawaiiFluidDensityConstraint
 {
@@ -75,7 +78,7 @@ public:
 	FKawaiiFluidDensityConstraint();
 	FKawaiiFluidDensityConstraint(float InRestDensity, float InSmoothingRadius, float InEpsilon);
 
-	void Solve(TArray<FKawaiiFluidParticle>& Particles, float InSmoothingRadius, float InRestDensity, float InCompliance, float DeltaTime);
+	void Solve(TArray<FKawaiiFluidParticle>& Particles, float InSmoothingRadius, float InRestDensity, float InCompliance, float DeltaTime, int32 NumSolved = INDEX_NONE);
 
 	void SolveWithTensileCorrection(
 		TArray<FKawaiiFluidParticle>& Particles,
@@ -83,7 +86,22 @@ public:
 		float InRestDensity,
 		float InCompliance,
 		float DeltaTime,
-		const FTensileInstabilityParams& TensileParams);
+		const FTensileInstabilityParams& TensileParams,
+		int32 NumSolved = INDEX_NONE);
+
+	void EvaluateDensities(
+		const TArray<FKawaiiFluidParticle>& Particles,
+		float InSmoothingRadius,
+		float InRestDensity,
+		float InCompliance,
+		float DeltaTime,
+		const FTensileInstabilityParams& TensileParams,
+		int32 NumSolved = INDEX_NONE);
+
+	void ApplyCorrections(TArray<FKawaiiFluidParticle>& Particles, bool bApplyCorrection);
+
+	/** Densities of the last EvaluateDensities (valid for the solved particles) */
+	const TArray<float>& GetDensities() const { return Densities; }
 
 	void SetRestDensity(float NewRestDensity);
 	void SetEpsilon(float NewEpsilon);
@@ -99,17 +117,22 @@ private:
 	TArray<float> Lambdas;
 	TArray<float> DeltaPX, DeltaPY, DeltaPZ;
 
+	FSPHKernelCoeffs PendingCoeffs;
+	int32 PendingNumSolved = 0;
+
 	void ResizeSoAArrays(int32 NumParticles);
-	void CopyToSoA(const TArray<FKawaiiFluidParticle>& Particles);
-	void ApplyFromSoA(TArray<FKawaiiFluidParticle>& Particles);
+	void CopyToSoA(const TArray<FKawaiiFluidParticle>& Particles, int32 NumSolved);
+	void ApplyFromSoA(TArray<FKawaiiFluidParticle>& Particles, int32 NumSolved);
 
 	void ComputeDensityAndLambda_SIMD(
 		const TArray<FKawaiiFluidParticle>& Particles,
-		const FSPHKernelCoeffs& Coeffs);
+		const FSPHKernelCoeffs& Coeffs,
+		int32 NumSolved);
 
 	void ComputeDeltaP_SIMD(
 		const TArray<FKawaiiFluidParticle>& Particles,
-		const FSPHKernelCoeffs& Coeffs);
+		const FSPHKernelCoeffs& Coeffs,
+		int32 NumSolved);
 
 	//========================================
 	// Legacy Functions
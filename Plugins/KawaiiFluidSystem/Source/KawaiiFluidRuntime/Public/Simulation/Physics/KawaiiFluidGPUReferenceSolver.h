@@ -0,0 +1,263 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidSimulationTypes.h"
+#include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Utils/KawaiiFluidMortonSort.h"
+#include "Simulation/Utils/KawaiiFluidSparseBrickGrid.h"
+
+/**
+ * @struct FKawaiiFluidGPUReferenceConfig
+ * @brief Simulator state the GPU substep reads besides FGPUFluidSimulationParams.
+ *
+ * @param GridResolutionPreset Morton grid preset of classic Z-order mode (hybrid mode always uses Medium, like FKawaiiFluidZOrderSortManager).
+ * @param bUseHybridTiledZOrder 21-bit hybrid tiled keys instead of bounded Morton codes.
+ * @param SimulationBoundsMin Morton grid origin of classic mode (cm).
+ * @param SimulationBoundsMax Morton grid end of classic mode (cm).
+ * @param bUseSparseBrickGrid Sort and search on the sparse brick grid instead of the Morton cell table (±2^20 bricks per axis, particles beyond it get no neighbors).
+ * @param SparseBrickBits Cells per brick axis of the sparse grid as a power of two (2 = 4³, 3 = 8³).
+ * @param ExternalForce External acceleration added in PredictPositions (cm/s²).
+ * @param MaxVelocity Speed clamp of FinalizePositions (cm/s).
+ * @param PrimitiveCollisionThreshold Signed distance below which a collision primitive responds (cm).
+ * @param bRunSleepingPass Run the sleeping pass (compiled out of the GPU substep, so off by default).
+ */
+struct FKawaiiFluidGPUReferenceConfig
+{
+	EGridResolutionPreset GridResolutionPreset = EGridResolutionPreset::Medium;
+
+	bool bUseHybridTiledZOrder = true;
+
+	FVector3f SimulationBoundsMin = FVector3f(-1280.0f);
+
+	FVector3f SimulationBoundsMax = FVector3f(1280.0f);
+
+	bool bUseSparseBrickGrid = false;
+
+	int32 SparseBrickBits = 3;
+
+	FVector3f ExternalForce = FVector3f::ZeroVector;
+
+	float MaxVelocity = 50000.0f;
+
+	float PrimitiveCollisionThreshold = 1.0f;
+
+	bool bRunSleepingPass = false;
+};
+
+/**
+ * @class FKawaiiFluidGPUReferenceSolver
+ * @brief CPU port of the Z-order GPU substep (SimulateSubstep_RDG) on FGPUFluidParticle buffers.
+ *
+ * Runs PredictPositions, the Morton/hybrid key sort with CellStart/End, the SoA split, the solver loop
+ * (SolveDensityPressure with neighbor caching, bounds, primitive and heightmap collision),
+ * FinalizePositions and the SoA merge with the same formulas, constants and half-precision packing as
+ * the compute shaders, so it can serve as a test oracle and as a headless regression path.
+ *
+ * Where the GPU result depends on thread scheduling the reference picks the race-free reading:
+ * neighbor data of a pass comes from a snapshot taken before the pass (the LDS tile semantics,
+ * extended to cross-tile reads), which makes every pass deterministic and order independent. Results
+ * therefore match the GPU up to rsqrt/half rounding and those races, not bit for bit.
+ *
+ * Not covered: the legacy atomic hash path, bone attachment and boundary skinning (boundary particles
+ * are supplied in world space and searched brute force), adhesion, stack pressure, anisotropy and
+ * collision feedback.
+ *
+ * @param Config Simulator state.
+ * @param Primitives Collision primitives (world space).
+ * @param HeightmapParams Heightmap collision parameters (bEnabled == 0 skips the pass).
+ * @param HeightmapHeights Normalized heightmap texels, row-major TextureWidth x TextureHeight.
+ * @param BoundaryParticles World-space boundary particles.
+ * @param Sorter Morton key radix sort (sort keys and pre-sort index per sorted particle).
+ * @param CellStart First sorted particle per cell ID (InvalidIndex = empty).
+ * @param CellEnd Last sorted particle per cell ID (InvalidIndex = empty).
+ * @param TouchedCells Cell IDs written by the last sort, cleared before the next one.
+ * @param BrickGrid Cell ranges of sparse brick grid mode (CellStart/CellEnd stay unused).
+ * @param Positions SoA positions (float).
+ * @param PredictedPositions SoA predicted positions (float).
+ * @param PackedVelocities SoA velocities (half3 in two words).
+ * @param PackedDensityLambda SoA density and lambda (half2).
+ * @param Flags SoA flags.
+ * @param NeighborCountField SoA neighbor count (particle field, excludes self).
+ * @param ParticleIDs SoA particle IDs.
+ * @param SourceIDs SoA source IDs.
+ * @param NeighborLists Neighbor cache double buffer (MAX_NEIGHBORS_PER_PARTICLE slots per particle).
+ * @param CachedNeighborCounts Cached neighbor count per particle, double buffered (includes self).
+ * @param NeighborParticleCounts Particle count each neighbor buffer was written for.
+ * @param WriteBufferIndex Neighbor buffer the solver writes this frame.
+ * @param bPrevNeighborCacheValid Whether the other buffer holds last frame's cache.
+ * @param SleepCounters Sleep frame counter per particle index.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidGPUReferenceSolver
+{
+public:
+	static constexpr uint32 InvalidIndex = 0xFFFFFFFFu;
+
+	explicit FKawaiiFluidGPUReferenceSolver(const FKawaiiFluidGPUReferenceConfig& InConfig = FKawaiiFluidGPUReferenceConfig());
+
+	//========================================
+	// Inputs
+	//========================================
+
+	void SetConfig(const FKawaiiFluidGPUReferenceConfig& InConfig) { Config = InConfig; }
+
+	const FKawaiiFluidGPUReferenceConfig& GetConfig() const { return Config; }
+
+	void SetCollisionPrimitives(const FGPUCollisionPrimitives& InPrimitives) { Primitives = InPrimitives; }
+
+	void SetHeightmap(const FGPUHeightmapCollisionParams& InParams, TArray<float> InHeights);
+
+	void SetBoundaryParticles(TConstArrayView<FGPUBoundaryParticle> InBoundaryParticles) { BoundaryParticles = InBoundaryParticles; }
+
+	//========================================
+	// Substep
+	//========================================
+
+	void SimulateSubstep(TArray<FGPUFluidParticle>& Particles, const FGPUFluidSimulationParams& Params);
+
+	/** Swap the neighbor cache buffers like SwapNeighborCacheBuffers at the end of a GPU frame */
+	void EndFrame();
+
+	/** Forget the neighbor cache, cells and sleep counters */
+	void Reset();
+
+	//========================================
+	// Individual passes (in substep order)
+	//========================================
+
+	void PredictPositions(TArray<FGPUFluidParticle>& Particles, const FGPUFluidSimulationParams& Params);
+
+	void SortParticles(TArray<FGPUFluidParticle>& Particles, const FGPUFluidSimulationParams& Params);
+
+	void SplitToSoA(const TArray<FGPUFluidParticle>& Particles);
+
+	void SolveDensityPressure(int32 IterationIndex, const FGPUFluidSimulationParams& Params);
+
+	void ApplyBoundsCollision(const FGPUFluidSimulationParams& Params);
+
+	void ApplyPrimitiveCollision(const FGPUFluidSimulationParams& Params);
+
+	void ApplyHeightmapCollision(const FGPUFluidSimulationParams& Params);
+
+	void FinalizePositions(const FGPUFluidSimulationParams& Params);
+
+	void MergeToAoS(TArray<FGPUFluidParticle>& Particles, const FGPUFluidSimulationParams& Params) const;
+
+	void UpdateSleeping(TArray<FGPUFluidParticle>& Particles, const FGPUFluidSimulationParams& Params);
+
+	//========================================
+	// Cell keys
+	//========================================
+
+	int32 GetAxisBits() const;
+
+	uint32 GetMaxCells() const;
+
+	FKawaiiFluidMortonKeyLayout GetKeyLayout(float CellSize) const;
+
+	uint32 ComputeSortKey(const FVector3f& Position, float CellSize) const;
+
+	uint32 GetCellID(const FIntVector& CellCoord, float CellSize) const;
+
+	bool FindCellRange(const FIntVector& CellCoord, float CellSize, uint32& OutStart, uint32& OutEnd) const;
+
+	//========================================
+	// Results
+	//========================================
+
+	TConstArrayView<uint32> GetSortKeys() const { return Sorter.GetSortedKeys(); }
+
+	TConstArrayView<uint32> GetSortedIndices() const { return Sorter.GetSortedIndices(); }
+
+	uint32 GetCellStart(uint32 CellID) const { return CellStart.IsValidIndex(CellID) ? CellStart[CellID] : InvalidIndex; }
+
+	uint32 GetCellEnd(uint32 CellID) const { return CellEnd.IsValidIndex(CellID) ? CellEnd[CellID] : InvalidIndex; }
+
+	const FKawaiiFluidSparseBrickGrid& GetBrickGrid() const { return BrickGrid; }
+
+	TConstArrayView<uint32> GetNeighborList() const { return NeighborLists[WriteBufferIndex]; }
+
+	TConstArrayView<uint32> GetCachedNeighborCounts() const { return CachedNeighborCounts[WriteBufferIndex]; }
+
+	TConstArrayView<FVector3f> GetPredictedPositions() const { return PredictedPositions; }
+
+	float GetDensity(int32 Index) const;
+
+	float GetLambda(int32 Index) const;
+
+	//========================================
+	// Half packing (f32tof16 / f16tof32)
+	//========================================
+
+	static uint32 PackHalf2(float X, float Y);
+
+	static FVector2f UnpackHalf2(uint32 Packed);
+
+private:
+	FVector3f UnpackVelocity(int32 Index) const;
+
+	void PackVelocity(int32 Index, const FVector3f& Velocity);
+
+	float SampleHeightmap(float U, float V) const;
+
+	FKawaiiFluidGPUReferenceConfig Config;
+
+	FGPUCollisionPrimitives Primitives;
+
+	FGPUHeightmapCollisionParams HeightmapParams;
+
+	TArray<float> HeightmapHeights;
+
+	TArray<FGPUBoundaryParticle> BoundaryParticles;
+
+	// Sorting
+	FKawaiiFluidMortonSorter Sorter;
+
+	TArray<uint32> CellStart;
+
+	TArray<uint32> CellEnd;
+
+	TArray<uint32> TouchedCells;
+
+	FKawaiiFluidSparseBrickGrid BrickGrid;
+
+	TArray<FGPUFluidParticle> SortScratch;
+
+	// SoA buffers
+	TArray<FVector3f> Positions;
+
+	TArray<FVector3f> PredictedPositions;
+
+	TArray<FUintVector2> PackedVelocities;
+
+	TArray<uint32> PackedDensityLambda;
+
+	TArray<uint32> Flags;
+
+	TArray<uint32> NeighborCountField;
+
+	TArray<int32> ParticleIDs;
+
+	TArray<int32> SourceIDs;
+
+	// Per-pass snapshots (race-free reading of in-place GPU passes)
+	TArray<FVector3f> VelocitySnapshot;
+
+	TArray<FVector3f> PredictedSnapshot;
+
+	TArray<uint32> DensityLambdaSnapshot;
+
+	// Neighbor cache
+	TArray<uint32> NeighborLists[2];
+
+	TArray<uint32> CachedNeighborCounts[2];
+
+	int32 NeighborParticleCounts[2] = { 0, 0 };
+
+	int32 WriteBufferIndex = 0;
+
+	bool bPrevNeighborCacheValid = false;
+
+	TArray<uint32> SleepCounters;
+};
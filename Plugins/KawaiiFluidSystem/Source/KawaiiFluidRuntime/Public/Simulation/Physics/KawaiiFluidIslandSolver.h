@@ -0,0 +1,123 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidParticle.h"
+
+class UKawaiiFluidCollider;
+
+/**
+ * @class FKawaiiFluidIslandSolver
+ * @brief Connected-component island detection and whole-island sleeping for the CPU solver.
+ *
+ * Islands are connected components of the neighbor graph (union-find over NeighborIndices). An island
+ * falls asleep after its mean squared speed stays below SleepVelocityThreshold^2 for SleepFrameThreshold
+ * frames; its particles are then frozen (zero velocity) and the context leaves them out of every
+ * solver stage (see FKawaiiFluidParticleSubset).
+ *
+ * Sleeping islands are kept between updates (islands first, members indexed by a cell map), so an
+ * update only runs union-find over the awake particles, using the neighbor lists of their last substep.
+ * A sleeping island wakes when anything touches it:
+ * - an awake particle comes within SmoothingRadius of a member (spawn, or fluid flowing into it),
+ * - a member's neighbor count changes (a neighbor was despawned; the context rebuilds the lists then),
+ * - an enabled collider's bounds overlap the island's bounds.
+ * With no awake particle and no overlapping collider nothing can change and the update returns at once.
+ *
+ * @param Parents Union-find parent per particle (frame scratch, awake particles only).
+ * @param IslandOfParticle Dense island index per particle, kept for sleeping particles between updates.
+ * @param Islands Per-island aggregates of the last update, sleeping islands first.
+ * @param AwakeIndices Awake particles of the current update (frame scratch).
+ * @param ContactIslands Sleeping island each awake particle touches, or INDEX_NONE (frame scratch).
+ * @param SleepingCells Grid cell -> (first, count) range in SleepingCellParticles.
+ * @param SleepingCellParticles Sleeping particle indices sorted by grid cell.
+ * @param SleepingCellSize Cell size SleepingCells was built with (the smoothing radius).
+ * @param LastNumParticles Particle count of the last update.
+ * @param bIslandsValid Sleeping islands and cells match the particle indices (cleared by reorders).
+ * @param bLastUpdateSkipped The last update returned without changing anything.
+ * @param NumSleepingParticles Sleeping particles after the last update.
+ * @param NumSleepingIslands Sleeping islands after the last update.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidIslandSolver
+{
+public:
+	FKawaiiFluidIslandSolver();
+
+	void Update(
+		TArray<FKawaiiFluidParticle>& Particles,
+		const TArray<TObjectPtr<UKawaiiFluidCollider>>& Colliders,
+		float SleepVelocityThreshold,
+		int32 SleepFrameThreshold,
+		float SmoothingRadius
+	);
+
+	void WakeAll(TArray<FKawaiiFluidParticle>& Particles);
+
+	/** Particle indices changed (e.g. Z-order sort); sleeping islands are rebuilt on the next update */
+	void InvalidateIslands() { bIslandsValid = false; }
+
+	/** Particles were removed while islands sleep: their neighbor lists must be rebuilt before Update */
+	bool NeedsNeighborRebuild(int32 NumParticles) const { return NumSleepingParticles > 0 && NumParticles < LastNumParticles; }
+
+	bool WasLastUpdateSkipped() const { return bLastUpdateSkipped; }
+
+	int32 GetNumIslands() const { return Islands.Num(); }
+
+	int32 GetNumSleepingIslands() const { return NumSleepingIslands; }
+
+	int32 GetNumSleepingParticles() const { return NumSleepingParticles; }
+
+	bool HasSleepingParticles() const { return NumSleepingParticles > 0; }
+
+private:
+	struct FIsland
+	{
+		FBox Bounds = FBox(ForceInit);
+
+		double SumSpeedSq = 0.0;
+
+		int32 NumParticles = 0;
+
+		int32 NumSleeping = 0;
+
+		int32 MinSleepFrames = MAX_int32;
+
+		bool bDisturbed = false;
+	};
+
+	int32 FindRoot(int32 Index);
+
+	void Union(int32 A, int32 B);
+
+	void RebuildSleepingIslands(const TArray<FKawaiiFluidParticle>& Particles);
+
+	void RebuildSleepingCells(const TArray<FKawaiiFluidParticle>& Particles, float CellSize);
+
+	int32 FindContactIsland(const TArray<FKawaiiFluidParticle>& Particles, const FVector& Position) const;
+
+	TArray<int32> Parents;
+
+	TArray<int32> IslandOfParticle;
+
+	TArray<FIsland> Islands;
+
+	TArray<int32> AwakeIndices;
+
+	TArray<int32> ContactIslands;
+
+	TMap<FIntVector, FIntPoint> SleepingCells;
+
+	TArray<int32> SleepingCellParticles;
+
+	float SleepingCellSize = 0.0f;
+
+	int32 LastNumParticles = 0;
+
+	bool bIslandsValid = false;
+
+	bool bLastUpdateSkipped = false;
+
+	int32 NumSleepingParticles = 0;
+
+	int32 NumSleepingIslands = 0;
+};
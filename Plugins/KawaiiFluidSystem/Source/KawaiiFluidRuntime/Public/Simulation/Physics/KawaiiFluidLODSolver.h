@@ -0,0 +1,96 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidParticle.h"
+
+/**
+ * @brief Simulation level of detail of a spatial-grid cell.
+ */
+enum class EKawaiiFluidLODTier : uint8
+{
+	Near,	// Full substeps and solver iterations
+	Far,	// Coarse substeps, reduced solver iterations
+	Frozen	// Not simulated (static snapshot)
+};
+
+/**
+ * @struct FKawaiiFluidLODTierStats
+ * @brief Per-tier counts and timing of the last CPU simulation frame.
+ *
+ * @param NumCells Grid cells assigned to the tier.
+ * @param NumParticles Particles assigned to the tier.
+ * @param NumSubsteps Substeps the tier ran.
+ * @param TimeMs Wall-clock time spent simulating the tier.
+ */
+struct FKawaiiFluidLODTierStats
+{
+	int32 NumCells = 0;
+
+	int32 NumParticles = 0;
+
+	int32 NumSubsteps = 0;
+
+	double TimeMs = 0.0;
+};
+
+/**
+ * @class FKawaiiFluidLODSolver
+ * @brief Distance-based simulation LOD for the CPU solver, driven by the spatial grid.
+ *
+ * Every occupied grid cell (spatial hash cell size) gets a tier from its distance to the nearest
+ * view. A cell only moves to a coarser tier once it is Hysteresis beyond the tier distance, and only
+ * returns once it is Hysteresis inside it, so fluid near a boundary does not flicker between tiers.
+ *
+ * Far cells run one coarse substep per LODFarSubstepStride fine substeps on their own clock;
+ * frozen cells keep their last state untouched until a view comes close again.
+ *
+ * @param CellTiers Tier of every occupied cell after the last update (hysteresis state).
+ * @param NextCellTiers Scratch map for the cells occupied this frame.
+ * @param ParticleTiers Tier of each particle after the last update.
+ * @param TierStats Per-tier counts and timings of the last frame.
+ * @param FarAccumulatedTime Simulated time owed to the far tier (s).
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidLODSolver
+{
+public:
+	FKawaiiFluidLODSolver();
+
+	bool Update(
+		const TArray<FKawaiiFluidParticle>& Particles,
+		TConstArrayView<FVector> ViewLocations,
+		float CellSize,
+		float FarDistance,
+		float FrozenDistance,
+		float Hysteresis
+	);
+
+	int32 AdvanceFarClock(float SimulatedTime, float FarSubstepDeltaTime, int32 MaxFarSubsteps);
+
+	void Reset();
+
+	EKawaiiFluidLODTier GetParticleTier(int32 ParticleIndex) const
+	{
+		return ParticleTiers.IsValidIndex(ParticleIndex) ? static_cast<EKawaiiFluidLODTier>(ParticleTiers[ParticleIndex]) : EKawaiiFluidLODTier::Near;
+	}
+
+	const FKawaiiFluidLODTierStats& GetTierStats(EKawaiiFluidLODTier Tier) const { return TierStats[static_cast<int32>(Tier)]; }
+
+	void SetTierTiming(EKawaiiFluidLODTier Tier, int32 NumSubsteps, double TimeMs);
+
+	static EKawaiiFluidLODTier ResolveTier(float Distance, EKawaiiFluidLODTier PreviousTier, float FarDistance, float FrozenDistance, float Hysteresis);
+
+	static constexpr int32 NumTiers = 3;
+
+private:
+	TMap<FIntVector, EKawaiiFluidLODTier> CellTiers;
+
+	TMap<FIntVector, EKawaiiFluidLODTier> NextCellTiers;
+
+	TArray<uint8> ParticleTiers;
+
+	FKawaiiFluidLODTierStats TierStats[NumTiers];
+
+	float FarAccumulatedTime = 0.0f;
+};
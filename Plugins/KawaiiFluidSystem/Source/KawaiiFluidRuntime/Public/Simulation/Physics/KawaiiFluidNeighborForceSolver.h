@@ -0,0 +1,101 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidParticle.h"
+
+/**
+ * @struct FKawaiiFluidNeighborForceParams
+ * @brief Inputs of the fused post-solve neighbor pass (a term is skipped when its strength is 0).
+ *
+ * @param SmoothingRadius Kernel radius of viscosity and cohesion (cm).
+ * @param ViscosityCoeff XSPH viscosity coefficient (0 = off).
+ * @param CohesionStrength Particle-particle cohesion strength (0 = off).
+ * @param bStackPressure Whether attached particles receive weight from attached particles above them.
+ * @param Gravity World gravity (cm/s²), defines the sliding direction of stack pressure.
+ * @param StackPressureScale Stack pressure multiplier.
+ * @param StackPressureRadius Stack pressure search radius (cm), at most the neighbor search radius.
+ * @param DeltaTime Substep time step (s), stack pressure is an acceleration.
+ */
+struct FKawaiiFluidNeighborForceParams
+{
+	float SmoothingRadius = 0.0f;
+
+	float ViscosityCoeff = 0.0f;
+
+	float CohesionStrength = 0.0f;
+
+	bool bStackPressure = false;
+
+	FVector Gravity = FVector::ZeroVector;
+
+	float StackPressureScale = 0.0f;
+
+	float StackPressureRadius = 0.0f;
+
+	float DeltaTime = 0.0f;
+};
+
+/**
+ * @class FKawaiiFluidNeighborForceSolver
+ * @brief One neighbor sweep for XSPH viscosity, cohesion and stack pressure on the CPU path.
+ *
+ * Produces the same velocity changes as FKawaiiFluidViscositySolver::ApplyXSPH,
+ * FKawaiiFluidAdhesionSolver::ApplyCohesion and FKawaiiFluidStackPressureSolver::Apply run in
+ * sequence (cohesion and stack pressure only read positions, so they commute with viscosity), but
+ * visits every neighbor once and writes into buffers that persist between substeps.
+ *
+ * The symmetric mode evaluates each unordered pair once (j > i) and scatters the equal-and-opposite
+ * viscosity and cohesion terms into accumulators of the task that owns each particle's range; pairs
+ * that cross into a later range are buffered and added by the owning task. Stack pressure is not
+ * symmetric and is gathered for attached particles when each range is finished.
+ *
+ * @param VelocityDeltas Per-particle velocity change of the gather mode.
+ * @param TaskAccumulators Per-task viscosity/cohesion sums of the symmetric mode (sized to the task's range).
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidNeighborForceSolver
+{
+public:
+	FKawaiiFluidNeighborForceSolver();
+
+	void Apply(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidNeighborForceParams& Params, bool bSymmetricPairs);
+
+private:
+	void ApplyGather(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidNeighborForceParams& Params);
+
+	void ApplySymmetric(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidNeighborForceParams& Params);
+
+	/**
+	 * @brief Contribution of one pair to a particle owned by a later task in the symmetric mode.
+	 */
+	struct FCrossPair
+	{
+		int32 Index;
+
+		float ViscosityWeight;
+
+		FVector ViscositySum;
+
+		FVector CohesionForce;
+	};
+
+	/**
+	 * @brief Viscosity and cohesion sums of one task in the symmetric mode (indexed from the start of its range).
+	 */
+	struct FPairAccumulator
+	{
+		TArray<FVector> ViscositySums;
+
+		TArray<float> ViscosityWeights;
+
+		TArray<FVector> CohesionForces;
+
+		/** Pairs reaching into later ranges, bucketed by the owning task */
+		TArray<TArray<FCrossPair>> CrossPairs;
+	};
+
+	TArray<FVector> VelocityDeltas;
+
+	TArray<FPairAccumulator> TaskAccumulators;
+};
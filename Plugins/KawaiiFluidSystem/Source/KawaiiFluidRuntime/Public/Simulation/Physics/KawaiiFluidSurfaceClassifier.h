@@ -0,0 +1,97 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidParticle.h"
+
+/**
+ * @struct FKawaiiFluidSurfaceParams
+ * @brief Inputs of the CPU surface classification.
+ *
+ * A particle's surface score is the larger of its color-field asymmetry over GradientThreshold and its
+ * neighbor deficiency (1 at NeighborDeficiency of the reference count, 0 at the full count). It becomes
+ * a surface particle at score 1 and stays one until the score falls below ExitRatio.
+ *
+ * @param SmoothingRadius Kernel radius (cm), at most the neighbor search radius.
+ * @param GradientThreshold Normalized color-field gradient |sum grad W| / sum |grad W| that marks a surface (0..1).
+ * @param NeighborDeficiency Fraction of the reference neighbor count below which a particle is surface (0 = off).
+ * @param ReferenceNeighborCount Neighbor count of an interior particle (0 = estimated from the frame).
+ * @param ExitRatio Score a surface particle must drop below to become interior again (hysteresis, 0..1).
+ * @param NormalSmoothing Weight of the previous frame's normal for particles that stay on the surface (0..1).
+ */
+struct FKawaiiFluidSurfaceParams
+{
+	float SmoothingRadius = 0.0f;
+
+	float GradientThreshold = 0.25f;
+
+	float NeighborDeficiency = 0.6f;
+
+	float ReferenceNeighborCount = 0.0f;
+
+	float ExitRatio = 0.7f;
+
+	float NormalSmoothing = 0.0f;
+};
+
+/**
+ * @class FKawaiiFluidSurfaceClassifier
+ * @brief Parallel surface detection for the CPU particles with a compact surface list.
+ *
+ * One sweep over the cached neighbor lists accumulates the Spiky-profile color-field gradient (its kernel
+ * constants cancel in the normalized form) and the neighbor count; a second sweep scores, applies the
+ * hysteresis against bIsSurfaceParticle of the previous frame and writes bIsSurfaceParticle and the
+ * outward SurfaceNormal (zero for interior particles). The hysteresis state lives on the particles, so
+ * it survives Z-order sorts, removals and spawns.
+ *
+ * Surface particles are then compacted into ascending indices and matching normals, so shadows, splash
+ * VFX, proxies and trail spawning can visit the surface only.
+ *
+ * @param Asymmetry Normalized color-field gradient per particle (scratch).
+ * @param Normals Outward gradient direction per particle (scratch).
+ * @param NeighborCounts Neighbors per particle, the particle itself excluded (scratch).
+ * @param ChunkOffsets Surface count, then write offset, of each compaction chunk (scratch).
+ * @param SurfaceIndices Indices of the surface particles, ascending.
+ * @param SurfaceNormals Outward normals matching SurfaceIndices.
+ * @param LastReferenceNeighborCount Reference neighbor count used by the last classification.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSurfaceClassifier
+{
+public:
+	void Classify(TArray<FKawaiiFluidParticle>& Particles, const FKawaiiFluidSurfaceParams& Params);
+
+	void Reset();
+
+	TConstArrayView<int32> GetSurfaceIndices() const { return SurfaceIndices; }
+
+	TConstArrayView<FVector3f> GetSurfaceNormals() const { return SurfaceNormals; }
+
+	int32 GetNumSurface() const { return SurfaceIndices.Num(); }
+
+	float GetLastReferenceNeighborCount() const { return LastReferenceNeighborCount; }
+
+	static float ComputeScore(float InAsymmetry, int32 NumNeighbors, float ReferenceNeighborCount, const FKawaiiFluidSurfaceParams& Params);
+
+	static bool ResolveSurface(float Score, bool bWasSurface, float ExitRatio);
+
+	/** Particles per compaction chunk */
+	static constexpr int32 ChunkSize = 4096;
+
+private:
+	float EstimateReferenceNeighborCount() const;
+
+	TArray<float> Asymmetry;
+
+	TArray<FVector3f> Normals;
+
+	TArray<int32> NeighborCounts;
+
+	TArray<int32> ChunkOffsets;
+
+	TArray<int32> SurfaceIndices;
+
+	TArray<FVector3f> SurfaceNormals;
+
+	float LastReferenceNeighborCount = 0.0f;
+};
@@ -77,7 +77,7 @@ namespace EGPUParticleFlags
 namespace EGPUParticleSource
 {
 	constexpr int32 InvalidSourceID = -1;
-	constexpr int32 MaxSourceCount = 64;  // Maximum number of unique sources (components) for GPU counter tracking
+	constexpr int32 MaxSourceCount = 65536;  // Upper bound on concurrently allocated SourceIDs (counter tables grow on demand)
 }
 
 /** Check if SourceID is valid */
@@ -0,0 +1,97 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Simulation/Utils/KawaiiFluidSourceParticleIndex.h"
+
+/**
+ * @struct FKawaiiFluidParticleSnapshot
+ * @brief Immutable per-particle data of one processed GPU readback (or of a CPU upload).
+ *
+ * Built off the lock and published once by FKawaiiFluidSimulator; afterwards nobody writes it, so
+ * consumers keep the shared pointer as long as they need the data and read it without locking.
+ * All arrays are indexed by readback slot. Arrays of fields no readback consumer registered are
+ * empty, so check the Has*() accessors before reading them.
+ *
+ * @param Version Monotonic publish counter (0 = never published).
+ * @param Frame GPU frame the readback was enqueued on (0 = built from a CPU upload).
+ * @param NumParticles Number of particles read back.
+ * @param Positions World positions (cm).
+ * @param Velocities Velocities (cm/s), optional.
+ * @param Flags EGPUParticleFlags per particle.
+ * @param NeighborCounts Neighbor counts, optional.
+ * @param ParticleIDs Particle IDs.
+ * @param SourceIDs Source IDs (-1 = no source).
+ * @param SourceIndex Particle IDs grouped by SourceID, covering [0, highest SourceID].
+ */
+struct FKawaiiFluidParticleSnapshot
+{
+	uint64 Version = 0;
+
+	uint64 Frame = 0;
+
+	int32 NumParticles = 0;
+
+	TArray<FVector3f> Positions;
+
+	TArray<FVector3f> Velocities;
+
+	TArray<uint32> Flags;
+
+	TArray<uint32> NeighborCounts;
+
+	TArray<int32> ParticleIDs;
+
+	TArray<int32> SourceIDs;
+
+	FKawaiiFluidSourceParticleIndex SourceIndex;
+
+	int32 Num() const { return NumParticles; }
+
+	bool HasPositions() const { return Num() > 0 && Positions.Num() == Num(); }
+
+	bool HasVelocities() const { return HasPositions() && Velocities.Num() == Num(); }
+
+	bool HasFlags() const { return HasPositions() && Flags.Num() == Num(); }
+
+	bool HasNeighborCounts() const { return HasPositions() && NeighborCounts.Num() == Num(); }
+
+	bool HasParticleIDs() const { return HasPositions() && ParticleIDs.Num() == Num(); }
+
+	/** Particle IDs of one source (empty if the source has none) */
+	TConstArrayView<int32> GetParticleIDsBySourceID(int32 SourceID) const { return SourceIndex.GetParticleIDs(SourceID); }
+
+	/** Particle IDs of every read back particle, in readback order */
+	TConstArrayView<int32> GetAllParticleIDs() const { return ParticleIDs; }
+};
+
+/**
+ * @struct FKawaiiFluidAnisotropySnapshot
+ * @brief Immutable ellipsoid axes of one anisotropy readback (xyz = direction, w = scale).
+ *
+ * Anisotropy is read back on its own ring, so it is published separately and may lag the particle
+ * snapshot by a frame; consumers should check the counts match before pairing them.
+ *
+ * @param Frame GPU frame the readback was enqueued on.
+ * @param Axis1 First ellipsoid axis per particle.
+ * @param Axis2 Second ellipsoid axis per particle.
+ * @param Axis3 Third ellipsoid axis per particle.
+ */
+struct FKawaiiFluidAnisotropySnapshot
+{
+	uint64 Frame = 0;
+
+	TArray<FVector4f> Axis1;
+
+	TArray<FVector4f> Axis2;
+
+	TArray<FVector4f> Axis3;
+
+	int32 Num() const { return Axis1.Num(); }
+
+	bool Matches(const FKawaiiFluidParticleSnapshot& Particles) const
+	{
+		return Num() > 0 && Num() == Particles.Num() && Axis2.Num() == Num() && Axis3.Num() == Num();
+	}
+};
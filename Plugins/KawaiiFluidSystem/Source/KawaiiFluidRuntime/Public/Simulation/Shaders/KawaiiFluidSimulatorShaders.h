@@ -835,7 +835,7 @@ public:
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment);
 };
 
-// Oldest despawn Pass 1: Build 256-bucket histogram of ParticleID upper bits
+// Oldest despawn Pass 1: Build a 256-bucket histogram of ParticleID upper bits per over-limit source
 class FBuildIDHistogramCS : public FGlobalShader
 {
 public:
@@ -847,7 +847,7 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, IDHistogram)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, PerSourceExcess)
-		SHADER_PARAMETER(int32, FilterSourceID)
+		SHADER_PARAMETER(int32, LimitedSourceCount)
 		SHADER_PARAMETER(int32, IDShiftBits)
 	END_SHADER_PARAMETER_STRUCT()
 
@@ -858,7 +858,7 @@ public:
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment);
 };
 
-// Oldest despawn Pass 2: Find threshold bucket via prefix sum (single thread)
+// Oldest despawn Pass 2: Find each source's threshold bucket via prefix sum (one thread per source)
 class FFindOldestThresholdCS : public FGlobalShader
 {
 public:
@@ -871,13 +871,15 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, OldestThreshold)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, PerSourceExcess)
-		SHADER_PARAMETER(int32, FilterSourceID)
+		SHADER_PARAMETER(int32, LimitedSourceCount)
 	END_SHADER_PARAMETER_STRUCT()
 
+	static constexpr int32 ThreadGroupSize = 64;
+
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters);
 };
 
-// Per-source oldest despawn Pass 3: Mark particles below threshold + atomic boundary
+// Per-source oldest despawn Pass 3: Mark particles below their source's threshold + atomic boundary
 class FMarkOldestParticlesCS : public FGlobalShader
 {
 public:
@@ -892,7 +894,7 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, BoundaryCounter)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, PerSourceExcess)
-		SHADER_PARAMETER(int32, FilterSourceID)
+		SHADER_PARAMETER(int32, LimitedSourceCount)
 		SHADER_PARAMETER(int32, IDShiftBits)
 	END_SHADER_PARAMETER_STRUCT()
 
@@ -918,6 +920,8 @@ public:
 		SHADER_PARAMETER(int32, ActiveSourceCount)
 	END_SHADER_PARAMETER_STRUCT()
 
+	static constexpr int32 ThreadGroupSize = 64;
+
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters);
 };
 
@@ -7,6 +7,7 @@
 #include "ShaderParameterStruct.h"
 #include "RenderGraphResources.h"
 #include "Simulation/Resources/GPUFluidParticle.h"
+#include "Simulation/Utils/KawaiiFluidReadbackLayout.h"
 
 /**
  * @class FCompactStatsCS
@@ -69,3 +70,38 @@ public:
 		const FGlobalShaderPermutationParameters& Parameters,
 		FShaderCompilerEnvironment& OutEnvironment);
 };
+
+/**
+ * @class FPackReadbackCS
+ * @brief Field-masked readback packing compute shader (stride set by FKawaiiFluidReadbackLayout).
+ * 
+ * Writes only the fields the readback consumers registered, optionally quantized.
+ * 
+ * @param InParticles Input particles buffer.
+ * @param OutPackedReadback Output buffer of packed records (StrideWords uints per particle).
+ * @param ParticleCountBuffer GPU-accurate particle count buffer.
+ * @param ReadbackFieldSlots Per-field (word offset, encoding), offset -1 = field absent.
+ * @param ReadbackStrideWords Record size in 32-bit words.
+ */
+class FPackReadbackCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FPackReadbackCS);
+	SHADER_USE_PARAMETER_STRUCT(FPackReadbackCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGPUFluidParticle>, InParticles)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, OutPackedReadback)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ParticleCountBuffer)
+		SHADER_PARAMETER_ARRAY(FIntVector4, ReadbackFieldSlots, [EKawaiiFluidReadbackField::NumFields])
+		SHADER_PARAMETER(uint32, ReadbackStrideWords)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 256;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters);
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters,
+		FShaderCompilerEnvironment& OutEnvironment);
+};
@@ -0,0 +1,55 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FKawaiiFluidParticle;
+struct FKawaiiFluidStatsAccumulator;
+
+/**
+ * @struct FKawaiiFluidBoundaryBox
+ * @brief Oriented containment box for the CPU boundary pass.
+ *
+ * @param Center World-space box center.
+ * @param HalfExtent Local half extent particles are clamped to.
+ * @param Rotation Box orientation (identity takes the axis-aligned fast path).
+ * @param Bounce Restitution applied to the normal velocity on contact.
+ * @param Friction Damping applied to the tangential velocity on contact.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidBoundaryBox
+{
+	FVector Center = FVector::ZeroVector;
+
+	FVector HalfExtent = FVector::ZeroVector;
+
+	FQuat Rotation = FQuat::Identity;
+
+	float Bounce = 0.0f;
+
+	float Friction = 0.0f;
+
+	static FKawaiiFluidBoundaryBox FromAABB(const FBox& Bounds, float Inset, float InBounce, float InFriction);
+};
+
+/**
+ * @class FKawaiiFluidBoundaryPass
+ * @brief Fused, parallel boundary containment and particle AABB reduction for the CPU solver.
+ *
+ * One sweep clamps each particle's predicted position to the box, reflects and damps its velocity,
+ * and accumulates per-chunk min/max that are merged into the particle bounds at the end. The reducing
+ * sweeps can also fill per-chunk frame statistics, so the CPU stats need no sweep of their own.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidBoundaryPass
+{
+public:
+	/** Particles per parallel task (also the single-thread threshold) */
+	static constexpr int32 ChunkSize = 4096;
+
+	static void Resolve(TArrayView<FKawaiiFluidParticle> Particles, const FKawaiiFluidBoundaryBox& Box);
+
+	static FBox ResolveAndComputeBounds(TArrayView<FKawaiiFluidParticle> Particles, const FKawaiiFluidBoundaryBox& Box,
+		FKawaiiFluidStatsAccumulator* OutStats = nullptr, float InvRestDensity = 0.0f);
+
+	static FBox ComputeBounds(TConstArrayView<FKawaiiFluidParticle> Particles, FKawaiiFluidStatsAccumulator* OutStats = nullptr, float InvRestDensity = 0.0f);
+};
@@ -0,0 +1,237 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Core/KawaiiFluidSimulationTypes.h"
+
+/**
+ * CPU copies of the key functions in KawaiiFluidMortonUtils.ush (same bit layout, same integer math).
+ */
+namespace KawaiiFluidMorton
+{
+	/** Hybrid tiled keys: 6-bit local Morton code per axis under a 3-bit tile hash (21 bits) */
+	constexpr int32 HybridTileBits = 6;
+	constexpr uint32 HybridTileMask = 0x3F;
+	constexpr int32 HybridLocalMortonBits = 18;
+	constexpr uint32 HybridTileHashMask = 0x7;
+	constexpr int32 HybridKeyBits = 21;
+
+	/** MortonExpandBits6/7/8: spread the low AxisBits bits of V to every third bit */
+	inline uint32 ExpandBits(uint32 V, int32 AxisBits)
+	{
+		V &= (1u << AxisBits) - 1;
+		V = (V | (V << 8)) & 0x0000F00Fu;
+		V = (V | (V << 4)) & 0x000C30C3u;
+		V = (V | (V << 2)) & 0x00249249u;
+		return V;
+	}
+
+	/** Morton3D_6bit/7bit/8bit: coordinates are clamped to the grid like the HLSL min() */
+	inline uint32 Morton3D(uint32 X, uint32 Y, uint32 Z, int32 AxisBits)
+	{
+		const uint32 MaxValue = (1u << AxisBits) - 1;
+		return (ExpandBits(FMath::Min(Z, MaxValue), AxisBits) << 2)
+			| (ExpandBits(FMath::Min(Y, MaxValue), AxisBits) << 1)
+			| ExpandBits(FMath::Min(X, MaxValue), AxisBits);
+	}
+
+	/** HashTile: wrapping uint multiply of the (possibly negative) tile coordinate */
+	inline uint32 HashTile(const FIntVector& TilePos)
+	{
+		return (static_cast<uint32>(TilePos.X) * 73856093u)
+			^ (static_cast<uint32>(TilePos.Y) * 19349663u)
+			^ (static_cast<uint32>(TilePos.Z) * 83492791u);
+	}
+
+	/** ComputeHybridTiledKey: any cell coordinate, negative tiles via arithmetic shift */
+	inline uint32 HybridTiledKey(const FIntVector& CellCoord)
+	{
+		const uint32 LocalMorton = Morton3D(
+			static_cast<uint32>(CellCoord.X) & HybridTileMask,
+			static_cast<uint32>(CellCoord.Y) & HybridTileMask,
+			static_cast<uint32>(CellCoord.Z) & HybridTileMask,
+			HybridTileBits);
+		const FIntVector TilePos(CellCoord.X >> HybridTileBits, CellCoord.Y >> HybridTileBits, CellCoord.Z >> HybridTileBits);
+		return ((HashTile(TilePos) & HybridTileHashMask) << HybridLocalMortonBits) | LocalMorton;
+	}
+
+	/** floor(Position / CellSize) per axis, as int3 in the shaders */
+	inline FIntVector WorldToCell(const FVector3f& Position, float CellSize)
+	{
+		return FIntVector(
+			FMath::FloorToInt32(Position.X / CellSize),
+			FMath::FloorToInt32(Position.Y / CellSize),
+			FMath::FloorToInt32(Position.Z / CellSize));
+	}
+}
+
+/**
+ * @struct FKawaiiFluidMortonKeyLayout
+ * @brief Which of the GPU key encodings to use and the grid it is taken on.
+ *
+ * @param bHybridTiled 21-bit hybrid tiled keys (unbounded range) instead of bounded Morton codes.
+ * @param AxisBits Morton bits per axis of classic keys (6/7/8 = Small/Medium/Large).
+ * @param BoundsMin Grid origin of classic keys (cm).
+ * @param CellSize Cell size (cm).
+ */
+struct FKawaiiFluidMortonKeyLayout
+{
+	bool bHybridTiled = true;
+
+	int32 AxisBits = 7;
+
+	FVector3f BoundsMin = FVector3f::ZeroVector;
+
+	float CellSize = 20.0f;
+
+	/** Layout the GPU sort uses for a preset (hybrid mode always runs on the Medium grid) */
+	static FKawaiiFluidMortonKeyLayout FromPreset(EGridResolutionPreset Preset, bool bInHybridTiled, const FVector3f& InBoundsMin, float InCellSize)
+	{
+		FKawaiiFluidMortonKeyLayout Layout;
+		Layout.bHybridTiled = bInHybridTiled;
+		Layout.AxisBits = GridResolutionPresetHelper::GetAxisBits(bInHybridTiled ? EGridResolutionPreset::Medium : Preset);
+		Layout.BoundsMin = InBoundsMin;
+		Layout.CellSize = InCellSize;
+		return Layout;
+	}
+
+	/** Significant key bits (radix passes = ceil(KeyBits / 8)) */
+	int32 GetKeyBits() const { return bHybridTiled ? KawaiiFluidMorton::HybridKeyBits : AxisBits * 3; }
+
+	/** GetMortonCellIDFromCellCoord / ComputeHybridTiledKey */
+	uint32 ComputeCellKey(const FIntVector& CellCoord) const
+	{
+		if (bHybridTiled)
+		{
+			return KawaiiFluidMorton::HybridTiledKey(CellCoord);
+		}
+
+		const FIntVector Offset = CellCoord - KawaiiFluidMorton::WorldToCell(BoundsMin, CellSize);
+		return KawaiiFluidMorton::Morton3D(
+			static_cast<uint32>(FMath::Max(Offset.X, 0)),
+			static_cast<uint32>(FMath::Max(Offset.Y, 0)),
+			static_cast<uint32>(FMath::Max(Offset.Z, 0)),
+			AxisBits);
+	}
+
+	uint32 ComputeKey(const FVector3f& Position) const
+	{
+		return ComputeCellKey(KawaiiFluidMorton::WorldToCell(Position, CellSize));
+	}
+};
+
+/**
+ * @class FKawaiiFluidMortonSorter
+ * @brief Parallel CPU Z-order sort: Morton keys, stable LSD radix sort with 8-bit digits, and reorder.
+ *
+ * Mirrors the GPU pipeline (ComputeMortonCodes, RadixSort, ReorderParticles). Each radix pass builds
+ * per-chunk digit histograms in parallel, scans them in (digit, chunk) order and scatters every chunk
+ * to its own cursors, so equal keys keep their input order. Passes whose digit is the same for every
+ * key are skipped, and only ceil(KeyBits / 8) passes run. Buffers only grow, so a warm sorter does not
+ * allocate.
+ *
+ * @param Keys Sort key per element (sorted after Sort).
+ * @param SortedIndices Input index of each sorted element.
+ * @param NewIndices Sorted position of each input element (inverse of SortedIndices).
+ * @param KeysScratch Radix ping-pong buffer for keys.
+ * @param IndicesScratch Radix ping-pong buffer for indices.
+ * @param ChunkCursors Per-chunk digit histograms, then write cursors ([Chunk * NumBuckets + Digit]).
+ * @param NumMoved Elements whose sorted position differs from their input position.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidMortonSorter
+{
+public:
+	/** Elements per histogram/scatter chunk (also the single-thread threshold) */
+	static constexpr int32 ChunkSize = 16384;
+
+	static constexpr int32 RadixBits = 8;
+
+	static constexpr int32 NumBuckets = 1 << RadixBits;
+
+	/**
+	 * @brief Key every element by its position and sort.
+	 * @param Num Number of elements.
+	 * @param Layout Key encoding.
+	 * @param GetPosition Callable (int32 Index) -> FVector3f, invoked in parallel.
+	 */
+	template <typename PositionGetterType>
+	void Sort(int32 Num, const FKawaiiFluidMortonKeyLayout& Layout, PositionGetterType&& GetPosition)
+	{
+		Keys.SetNumUninitialized(Num, EAllowShrinking::No);
+		ParallelFor(FMath::DivideAndRoundUp(Num, ChunkSize), [&](int32 ChunkIndex)
+		{
+			const int32 End = FMath::Min((ChunkIndex + 1) * ChunkSize, Num);
+			for (int32 i = ChunkIndex * ChunkSize; i < End; ++i)
+			{
+				Keys[i] = Layout.ComputeKey(GetPosition(i));
+			}
+		}, Num > ChunkSize ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+		SortKeys(Layout.GetKeyBits());
+	}
+
+	void Sort(TConstArrayView<uint32> InKeys, int32 KeyBits);
+
+	/**
+	 * @brief Move the elements of an AoS array or one SoA stream into sorted order.
+	 * @param Items Array with one element per sorted key.
+	 * @param Scratch Reused gather buffer; holds moved-from elements afterwards.
+	 */
+	template <typename ElementType>
+	void Reorder(TArray<ElementType>& Items, TArray<ElementType>& Scratch) const
+	{
+		const int32 Num = SortedIndices.Num();
+		check(Items.Num() == Num);
+		if (NumMoved == 0)
+		{
+			return;
+		}
+
+		Scratch.SetNum(Num, EAllowShrinking::No);
+		ParallelFor(FMath::DivideAndRoundUp(Num, ChunkSize), [&](int32 ChunkIndex)
+		{
+			const int32 End = FMath::Min((ChunkIndex + 1) * ChunkSize, Num);
+			for (int32 i = ChunkIndex * ChunkSize; i < End; ++i)
+			{
+				Scratch[i] = MoveTemp(Items[SortedIndices[i]]);
+			}
+		}, Num > ChunkSize ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+		Swap(Items, Scratch);
+	}
+
+	/** Sorted position of the element that was at OldIndex */
+	int32 GetNewIndex(int32 OldIndex) const { return static_cast<int32>(NewIndices[OldIndex]); }
+
+	TConstArrayView<uint32> GetSortedKeys() const { return Keys; }
+
+	TConstArrayView<uint32> GetSortedIndices() const { return SortedIndices; }
+
+	TConstArrayView<uint32> GetNewIndices() const { return NewIndices; }
+
+	int32 GetNumMoved() const { return NumMoved; }
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return Keys.GetAllocatedSize() + SortedIndices.GetAllocatedSize() + NewIndices.GetAllocatedSize()
+			+ KeysScratch.GetAllocatedSize() + IndicesScratch.GetAllocatedSize() + ChunkCursors.GetAllocatedSize();
+	}
+
+private:
+	void SortKeys(int32 KeyBits);
+
+	TArray<uint32> Keys;
+
+	TArray<uint32> SortedIndices;
+
+	TArray<uint32> NewIndices;
+
+	TArray<uint32> KeysScratch;
+
+	TArray<uint32> IndicesScratch;
+
+	TArray<int32> ChunkCursors;
+
+	int32 NumMoved = 0;
+};
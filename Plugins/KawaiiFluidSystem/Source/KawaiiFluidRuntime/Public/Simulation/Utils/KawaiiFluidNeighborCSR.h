@@ -0,0 +1,53 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FKawaiiFluidParticle;
+class FKawaiiFluidSparseBrickGrid;
+class FKawaiiFluidMortonSorter;
+
+/**
+ * @struct FKawaiiFluidNeighborCSR
+ * @brief Neighbor lists of all particles in compressed sparse row form.
+ *
+ * The neighbors of particle i are Indices[Offsets[i] .. Offsets[i + 1]). Lists may or may not contain
+ * the particle itself (the CPU spatial hash includes it), so consumers skip j == i where it matters.
+ *
+ * @param Offsets Start of each particle's list, Num() + 1 entries.
+ * @param Indices Neighbor particle indices.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidNeighborCSR
+{
+	TArray<int32> Offsets;
+
+	TArray<int32> Indices;
+
+	/** Flatten the cached NeighborIndices of the CPU particles */
+	void BuildFromParticles(const TArray<FKawaiiFluidParticle>& Particles);
+
+	/**
+	 * @brief Radius search over bare positions (readback snapshots, offline data) through a sparse brick grid.
+	 * @param Positions Particle positions (cm).
+	 * @param Radius Search radius (cm); neighbors closer than this are listed, the particle itself excluded.
+	 * @param Grid Reused grid.
+	 * @param Sorter Reused sorter.
+	 */
+	void BuildFromPositions(TConstArrayView<FVector3f> Positions, float Radius, FKawaiiFluidSparseBrickGrid& Grid, FKawaiiFluidMortonSorter& Sorter);
+
+	void Reset()
+	{
+		Offsets.Reset();
+		Indices.Reset();
+	}
+
+	int32 Num() const { return FMath::Max(Offsets.Num() - 1, 0); }
+
+	TConstArrayView<int32> GetNeighbors(int32 ParticleIndex) const
+	{
+		return TConstArrayView<int32>(Indices.GetData() + Offsets[ParticleIndex], Offsets[ParticleIndex + 1] - Offsets[ParticleIndex]);
+	}
+
+	SIZE_T GetAllocatedSize() const { return Offsets.GetAllocatedSize() + Indices.GetAllocatedSize(); }
+};
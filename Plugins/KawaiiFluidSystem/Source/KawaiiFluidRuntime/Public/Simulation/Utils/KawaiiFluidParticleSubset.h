@@ -0,0 +1,82 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/KawaiiFluidParticle.h"
+
+/**
+ * @class FKawaiiFluidParticleSubset
+ * @brief Moves a filtered subset of particles into a compact array the CPU solver stages run on.
+ *
+ * Gather moves the selected particles out of the full array (the rest stay untouched); Scatter moves
+ * them back and remaps their neighbor lists from subset indices to full-array indices. Used for the
+ * awake subset (island sleeping) and for the simulation LOD tiers.
+ *
+ * GatherReadOnlyNeighbors appends copies of the particles left out (other tiers, sleeping islands)
+ * that lie next to the gathered ones, so density and collision see a continuous fluid across the seam.
+ * They follow the gathered particles in the array, are pinned to their copied state by
+ * PinReadOnlyNeighbors, and are dropped by Scatter.
+ *
+ * @param Indices Full-array index of each gathered particle, then of each read-only neighbor.
+ * @param Particles Gathered particles followed by the read-only neighbors.
+ * @param NumSolved Gathered (solved) particles at the front of Particles.
+ * @param ReadOnlyPositions Position of each read-only neighbor when it was copied.
+ * @param ReadOnlyVelocities Velocity of each read-only neighbor when it was copied.
+ * @param ReadOnlyFlags Frame scratch: full-array particles selected as read-only neighbors.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidParticleSubset
+{
+public:
+	/**
+	 * @brief Move every particle the predicate accepts into the subset.
+	 * @param FullParticles Full particle array (selected entries are moved out until Scatter).
+	 * @param Predicate Callable (const FKawaiiFluidParticle&, int32 Index) -> bool.
+	 * @return Subset-owned array of gathered particles.
+	 */
+	template <typename PredicateType>
+	TArray<FKawaiiFluidParticle>& Gather(TArray<FKawaiiFluidParticle>& FullParticles, PredicateType&& Predicate)
+	{
+		check(Particles.Num() == 0);
+		Indices.Reset();
+		ReadOnlyPositions.Reset();
+		ReadOnlyVelocities.Reset();
+
+		for (int32 i = 0; i < FullParticles.Num(); ++i)
+		{
+			if (Predicate(static_cast<const FKawaiiFluidParticle&>(FullParticles[i]), i))
+			{
+				Indices.Add(i);
+				Particles.Add(MoveTemp(FullParticles[i]));
+			}
+		}
+
+		NumSolved = Particles.Num();
+		return Particles;
+	}
+
+	void GatherReadOnlyNeighbors(const TArray<FKawaiiFluidParticle>& FullParticles, float CellSize);
+
+	void PinReadOnlyNeighbors(TArray<FKawaiiFluidParticle>& SubsetParticles) const;
+
+	void Scatter(TArray<FKawaiiFluidParticle>& FullParticles);
+
+	int32 Num() const { return Particles.Num(); }
+
+	int32 GetNumSolved() const { return NumSolved; }
+
+	int32 GetNumReadOnly() const { return Particles.Num() - NumSolved; }
+
+private:
+	TArray<int32> Indices;
+
+	TArray<FKawaiiFluidParticle> Particles;
+
+	int32 NumSolved = 0;
+
+	TArray<FVector> ReadOnlyPositions;
+
+	TArray<FVector> ReadOnlyVelocities;
+
+	TArray<uint8> ReadOnlyFlags;
+};
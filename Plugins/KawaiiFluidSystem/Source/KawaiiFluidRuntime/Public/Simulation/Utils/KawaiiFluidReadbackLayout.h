@@ -0,0 +1,169 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGPUFluidParticle;
+
+/**
+ * Particle fields a readback consumer can request (bit mask, table order = field index)
+ * Must match READBACK_FIELD_* in KawaiiFluidSimulationDataLayout.usf
+ */
+namespace EKawaiiFluidReadbackField
+{
+	constexpr uint32 None = 0;
+	constexpr uint32 Position = 1 << 0;          // float3, never quantized (world cm)
+	constexpr uint32 Velocity = 1 << 1;          // float3, half3 when quantized
+	constexpr uint32 ParticleID = 1 << 2;
+	constexpr uint32 SourceID = 1 << 3;
+	constexpr uint32 Flags = 1 << 4;             // 16 bits when quantized together with NeighborCount
+	constexpr uint32 NeighborCount = 1 << 5;     // 16 bits when quantized together with Flags
+	constexpr uint32 Density = 1 << 6;           // half when quantized together with Mass
+	constexpr uint32 Mass = 1 << 7;              // half when quantized together with Density
+
+	constexpr int32 NumFields = 8;
+	constexpr uint32 All = (1u << NumFields) - 1;
+
+	// Field sets of the in-tree consumers
+	constexpr uint32 DespawnSet = Position | ParticleID | SourceID;
+	constexpr uint32 ProxySet = Position | Velocity | ParticleID | Flags;
+	constexpr uint32 ShadowSet = Position | Velocity | NeighborCount;
+	constexpr uint32 DebugDrawSet = Position | ParticleID | Flags;
+	constexpr uint32 DetailedStatsSet = Velocity | Flags | NeighborCount | Density | Mass;
+}
+
+/**
+ * @brief Systems that read particle data back from the GPU, each registering its own field mask.
+ */
+enum class EKawaiiFluidReadbackConsumer : uint8
+{
+	Despawn,
+	Proxy,
+	Shadow,
+	DebugDraw,
+	DetailedStats,
+	Interaction,
+
+	Count
+};
+
+/**
+ * @brief How a field is stored in the packed record (must match READBACK_ENCODING_* in the shader).
+ */
+enum class EKawaiiFluidReadbackEncoding : uint8
+{
+	Float3,		// 3 words
+	Half3,		// 2 words: xy, z | 0
+	Word,		// 1 word, raw 32 bits
+	Low16,		// low half of a shared word (uint)
+	High16,		// high half of a shared word (uint)
+	HalfLow,	// low half of a shared word (half float)
+	HalfHigh	// high half of a shared word (half float)
+};
+
+/**
+ * @struct FKawaiiFluidReadbackFieldSlot
+ * @brief Where one field lives in the packed record.
+ *
+ * @param FieldIndex Index of the field bit (0 = Position).
+ * @param WordOffset Offset inside the record in 32-bit words.
+ * @param Encoding Storage format.
+ */
+struct FKawaiiFluidReadbackFieldSlot
+{
+	int32 FieldIndex = 0;
+
+	int32 WordOffset = 0;
+
+	EKawaiiFluidReadbackEncoding Encoding = EKawaiiFluidReadbackEncoding::Word;
+};
+
+/**
+ * @struct FKawaiiFluidReadbackLayout
+ * @brief Packed per-particle record layout for a field mask, shared by the GPU packing pass and the CPU unpacker.
+ *
+ * Fields are laid out in field-index order with no padding. Quantization stores velocity as half3 and
+ * folds NeighborCount/Flags and Density/Mass into one word each when both halves are requested.
+ *
+ * @param FieldMask Requested EKawaiiFluidReadbackField bits.
+ * @param bQuantized Whether the lossy encodings are used.
+ * @param StrideWords Record size in 32-bit words.
+ * @param Slots One slot per requested field, in field-index order.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidReadbackLayout
+{
+	static constexpr int32 MaxStrideWords = 16;
+
+	uint32 FieldMask = EKawaiiFluidReadbackField::None;
+
+	bool bQuantized = false;
+
+	int32 StrideWords = 0;
+
+	TArray<FKawaiiFluidReadbackFieldSlot, TInlineAllocator<EKawaiiFluidReadbackField::NumFields>> Slots;
+
+	static FKawaiiFluidReadbackLayout Build(uint32 FieldMask, bool bQuantize);
+
+	bool IsEmpty() const { return StrideWords == 0; }
+
+	bool HasField(uint32 Field) const { return (FieldMask & Field) != 0; }
+
+	int32 GetStrideBytes() const { return StrideWords * static_cast<int32>(sizeof(uint32)); }
+
+	/** Slot of a field, or nullptr if it is not in the layout */
+	const FKawaiiFluidReadbackFieldSlot* FindSlot(uint32 Field) const;
+
+	bool operator==(const FKawaiiFluidReadbackLayout& Other) const
+	{
+		return FieldMask == Other.FieldMask && bQuantized == Other.bQuantized;
+	}
+};
+
+/**
+ * @struct FKawaiiFluidReadbackColumns
+ * @brief SoA destination of the unpacker; columns of fields missing from the layout are left empty.
+ *
+ * @param Positions World positions (cm).
+ * @param Velocities Velocities (cm/s).
+ * @param ParticleIDs Particle IDs.
+ * @param SourceIDs Source IDs.
+ * @param Flags EGPUParticleFlags.
+ * @param NeighborCounts Neighbor counts.
+ * @param Densities Densities.
+ * @param Masses Masses.
+ */
+struct FKawaiiFluidReadbackColumns
+{
+	TArray<FVector3f> Positions;
+
+	TArray<FVector3f> Velocities;
+
+	TArray<int32> ParticleIDs;
+
+	TArray<int32> SourceIDs;
+
+	TArray<uint32> Flags;
+
+	TArray<uint32> NeighborCounts;
+
+	TArray<float> Densities;
+
+	TArray<float> Masses;
+};
+
+/**
+ * @class FKawaiiFluidReadbackUnpacker
+ * @brief Table-driven conversion between packed readback records and SoA columns.
+ *
+ * Unpack walks the layout slots once per chunk and decodes each field into its column, so adding a
+ * field only touches the layout table. Pack is the CPU reference of the GPU packing pass; it feeds the
+ * unit tests and any CPU fallback.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidReadbackUnpacker
+{
+public:
+	static void Unpack(const FKawaiiFluidReadbackLayout& Layout, const uint32* Records, int32 NumParticles, FKawaiiFluidReadbackColumns& OutColumns);
+
+	static void Pack(const FKawaiiFluidReadbackLayout& Layout, TConstArrayView<FGPUFluidParticle> Particles, TArray<uint32>& OutRecords);
+};
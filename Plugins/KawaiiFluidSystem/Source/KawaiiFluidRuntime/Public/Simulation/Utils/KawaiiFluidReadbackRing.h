@@ -0,0 +1,344 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+/**
+ * @brief Readback rings owned by FKawaiiFluidSimulator (telemetry index).
+ */
+enum class EKawaiiFluidReadbackRing : uint8
+{
+	ParticleCount,
+	Stats,
+	Anisotropy,
+	DebugIndex,
+	ParticleBounds,
+
+	Count
+};
+
+/**
+ * @brief Which ready readback a ring hands out.
+ */
+enum class EKawaiiFluidReadbackConsumePolicy : uint8
+{
+	Newest,	// Latest data wins; older ready slots are dropped as stale
+	Oldest	// Every readback is consumed, in enqueue order
+};
+
+/**
+ * @struct FKawaiiFluidReadbackNoPayload
+ * @brief Payload of rings that need nothing besides the readback itself.
+ */
+struct FKawaiiFluidReadbackNoPayload
+{
+};
+
+/**
+ * @struct FKawaiiFluidReadbackRingStats
+ * @brief Latency and loss telemetry of one readback ring.
+ *
+ * @param NumEnqueued Readbacks written.
+ * @param NumConsumed Readbacks handed to the CPU side.
+ * @param NumDroppedStale Ready readbacks skipped because a newer one was consumed (Newest policy).
+ * @param NumDroppedOverrun Pending readbacks overwritten because the ring was full at its cap.
+ * @param NumDiscarded Readbacks the consumer rejected after picking them (e.g. empty payload).
+ * @param AgeHistogram Consumed readbacks by age in frames; the last bucket collects everything older.
+ * @param FramesInFlight Readbacks currently pending.
+ * @param MaxFramesInFlight Highest FramesInFlight seen.
+ * @param Depth Current ring depth.
+ * @param LastAge Age in frames of the last consumed readback.
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidReadbackRingStats
+{
+	static constexpr int32 NumAgeBuckets = 8;
+
+	uint64 NumEnqueued = 0;
+
+	uint64 NumConsumed = 0;
+
+	uint64 NumDroppedStale = 0;
+
+	uint64 NumDroppedOverrun = 0;
+
+	uint64 NumDiscarded = 0;
+
+	uint64 AgeHistogram[NumAgeBuckets] = {};
+
+	int32 FramesInFlight = 0;
+
+	int32 MaxFramesInFlight = 0;
+
+	int32 Depth = 0;
+
+	int32 LastAge = 0;
+
+	void RecordAge(uint64 AgeFrames);
+
+	uint64 GetNumDropped() const { return NumDroppedStale + NumDroppedOverrun + NumDiscarded; }
+
+	/** Mean age of consumed readbacks (frames, older bucket counted as its lower bound) */
+	float GetMeanAge() const;
+
+	/** Smallest age bucket that covers the given fraction of consumed readbacks */
+	int32 GetAgePercentile(float Fraction) const;
+
+	FString ToString() const;
+};
+
+/**
+ * @class TKawaiiFluidReadbackRing
+ * @brief Ring of async readbacks with a consume policy, telemetry and adaptive depth.
+ *
+ * A slot is free (frame 0) or pending (frame it was enqueued on). BeginWrite takes a free slot below
+ * the current depth; when none is free the ring grows up to MaxDepth, and only at the cap overwrites
+ * the oldest pending slot (an overrun). The depth shrinks again after ShrinkAfterWrites writes that
+ * each left at least two slots unused. ReadbackType only needs a constructor from FName and IsReady(),
+ * so the policy runs unchanged against a mock in the tests.
+ *
+ * @param Name Debug name, also used for the readback objects.
+ * @param Policy Consume policy.
+ * @param InitialDepth Depth after construction and Reset.
+ * @param Depth Slots in use [MinDepth, MaxDepth].
+ * @param bAdaptive Whether the depth follows the load.
+ * @param SpareWriteStreak Consecutive writes that left at least two slots unused.
+ * @param Slots Readback, enqueue frame and payload per slot.
+ * @param Stats Telemetry.
+ */
+template <typename ReadbackType, typename PayloadType, int32 MaxDepth>
+class TKawaiiFluidReadbackRing
+{
+public:
+	static constexpr int32 MinDepth = 2;
+
+	static constexpr int32 ShrinkAfterWrites = 240;
+
+	static_assert(MaxDepth >= MinDepth, "Readback ring cap must allow the minimum depth");
+
+	TKawaiiFluidReadbackRing(const TCHAR* InName, EKawaiiFluidReadbackConsumePolicy InPolicy, int32 InInitialDepth = 3)
+		: Name(InName)
+		, Policy(InPolicy)
+		, InitialDepth(FMath::Clamp(InInitialDepth, MinDepth, MaxDepth))
+		, Depth(InitialDepth)
+	{
+		Stats.Depth = Depth;
+	}
+
+	/**
+	 * @brief Claim a slot for a readback enqueued on Frame, allocating its readback object on first use.
+	 * @param Frame Enqueue frame (> 0).
+	 * @return Slot index; fill GetReadback/GetPayload before the next BeginWrite.
+	 */
+	int32 BeginWrite(uint64 Frame)
+	{
+		check(Frame > 0);
+
+		const int32 NumPending = CountPending();
+		int32 Slot = FindFreeSlot();
+
+		if (Slot == INDEX_NONE && bAdaptive && Depth < MaxDepth)
+		{
+			// Consumer is behind: grow instead of overwriting data that is still in flight
+			Slot = Depth++;
+		}
+		else if (Slot == INDEX_NONE)
+		{
+			Slot = FindOldestPendingSlot();
+			++Stats.NumDroppedOverrun;
+		}
+
+		// Shrink after a long run of writes that never needed the top slots
+		if (bAdaptive && Depth > MinDepth && NumPending + 1 <= Depth - 2)
+		{
+			if (++SpareWriteStreak >= ShrinkAfterWrites && Slots[Depth - 1].Frame == 0 && Slot != Depth - 1)
+			{
+				--Depth;
+				SpareWriteStreak = 0;
+			}
+		}
+		else
+		{
+			SpareWriteStreak = 0;
+		}
+
+		FSlot& Target = Slots[Slot];
+		if (!Target.Readback.IsValid())
+		{
+			Target.Readback = MakeUnique<ReadbackType>(FName(*FString::Printf(TEXT("%s_%d"), *Name, Slot)));
+		}
+		Target.Frame = Frame;
+		Target.Payload = PayloadType();
+
+		++Stats.NumEnqueued;
+		UpdateInFlight();
+		return Slot;
+	}
+
+	/**
+	 * @brief Pick the ready slot the policy hands out; with Newest, older ready slots are dropped as stale.
+	 * @return Slot index, or INDEX_NONE if nothing is ready.
+	 */
+	int32 FindReadySlot()
+	{
+		int32 Selected = INDEX_NONE;
+		for (int32 Slot = 0; Slot < MaxDepth; ++Slot)
+		{
+			const FSlot& Candidate = Slots[Slot];
+			if (Candidate.Frame == 0 || !Candidate.Readback.IsValid() || !Candidate.Readback->IsReady())
+			{
+				continue;
+			}
+
+			const bool bBetter = Selected == INDEX_NONE
+				|| (Policy == EKawaiiFluidReadbackConsumePolicy::Newest ? Candidate.Frame > Slots[Selected].Frame : Candidate.Frame < Slots[Selected].Frame);
+			if (bBetter)
+			{
+				Selected = Slot;
+			}
+		}
+
+		if (Selected != INDEX_NONE && Policy == EKawaiiFluidReadbackConsumePolicy::Newest)
+		{
+			for (int32 Slot = 0; Slot < MaxDepth; ++Slot)
+			{
+				FSlot& Candidate = Slots[Slot];
+				if (Slot != Selected && Candidate.Frame != 0 && Candidate.Frame < Slots[Selected].Frame
+					&& Candidate.Readback.IsValid() && Candidate.Readback->IsReady())
+				{
+					Candidate.Frame = 0;
+					++Stats.NumDroppedStale;
+				}
+			}
+			UpdateInFlight();
+		}
+
+		return Selected;
+	}
+
+	/**
+	 * @brief Free a slot whose data was used and record its age.
+	 * @param Slot Slot returned by FindReadySlot.
+	 * @param CurrentFrame Frame the data is consumed on.
+	 */
+	void Consume(int32 Slot, uint64 CurrentFrame)
+	{
+		FSlot& Target = Slots[Slot];
+		Stats.RecordAge(CurrentFrame > Target.Frame ? CurrentFrame - Target.Frame : 0);
+		++Stats.NumConsumed;
+		Target.Frame = 0;
+		UpdateInFlight();
+	}
+
+	/**
+	 * @brief Free a slot the consumer rejected without using its data.
+	 * @param Slot Slot returned by FindReadySlot.
+	 */
+	void Discard(int32 Slot)
+	{
+		Slots[Slot].Frame = 0;
+		++Stats.NumDiscarded;
+		UpdateInFlight();
+	}
+
+	/** Delete the readback objects and forget pending slots (telemetry is kept) */
+	void Reset()
+	{
+		for (FSlot& Slot : Slots)
+		{
+			Slot.Readback.Reset();
+			Slot.Frame = 0;
+			Slot.Payload = PayloadType();
+		}
+		Depth = InitialDepth;
+		SpareWriteStreak = 0;
+		UpdateInFlight();
+	}
+
+	ReadbackType& GetReadback(int32 Slot) { return *Slots[Slot].Readback; }
+
+	PayloadType& GetPayload(int32 Slot) { return Slots[Slot].Payload; }
+
+	const PayloadType& GetPayload(int32 Slot) const { return Slots[Slot].Payload; }
+
+	uint64 GetFrame(int32 Slot) const { return Slots[Slot].Frame; }
+
+	bool HasPending() const { return Stats.FramesInFlight > 0; }
+
+	int32 GetDepth() const { return Depth; }
+
+	void SetAdaptive(bool bInAdaptive) { bAdaptive = bInAdaptive; }
+
+	const FKawaiiFluidReadbackRingStats& GetStats() const { return Stats; }
+
+	const FString& GetName() const { return Name; }
+
+private:
+	struct FSlot
+	{
+		TUniquePtr<ReadbackType> Readback;
+
+		uint64 Frame = 0;
+
+		PayloadType Payload = PayloadType();
+	};
+
+	int32 CountPending() const
+	{
+		int32 NumPending = 0;
+		for (const FSlot& Slot : Slots)
+		{
+			NumPending += Slot.Frame != 0 ? 1 : 0;
+		}
+		return NumPending;
+	}
+
+	int32 FindFreeSlot() const
+	{
+		for (int32 Slot = 0; Slot < Depth; ++Slot)
+		{
+			if (Slots[Slot].Frame == 0)
+			{
+				return Slot;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	int32 FindOldestPendingSlot() const
+	{
+		int32 Oldest = 0;
+		for (int32 Slot = 1; Slot < Depth; ++Slot)
+		{
+			if (Slots[Slot].Frame < Slots[Oldest].Frame)
+			{
+				Oldest = Slot;
+			}
+		}
+		return Oldest;
+	}
+
+	void UpdateInFlight()
+	{
+		Stats.FramesInFlight = CountPending();
+		Stats.MaxFramesInFlight = FMath::Max(Stats.MaxFramesInFlight, Stats.FramesInFlight);
+		Stats.Depth = Depth;
+	}
+
+	FString Name;
+
+	EKawaiiFluidReadbackConsumePolicy Policy;
+
+	int32 InitialDepth;
+
+	int32 Depth;
+
+	bool bAdaptive = true;
+
+	int32 SpareWriteStreak = 0;
+
+	FSlot Slots[MaxDepth];
+
+	FKawaiiFluidReadbackRingStats Stats;
+};
@@ -0,0 +1,59 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class FKawaiiFluidSourceParticleIndex
+ * @brief Flat SourceID → ParticleID index built with a parallel counting sort.
+ *
+ * The IDs of source S are SortedParticleIDs[SourceOffsets[S], SourceOffsets[S + 1]), in input order.
+ * Build only grows its buffers, so rebuilding an index that has already seen the same particle and
+ * source counts allocates nothing; the simulator recycles snapshots to keep the index warm.
+ *
+ * @param SourceOffsets Start of each source's range in SortedParticleIDs (NumSources + 1 entries).
+ * @param SortedParticleIDs Particle IDs grouped by SourceID.
+ * @param ChunkMaxSourceIDs Scratch: highest valid SourceID per chunk.
+ * @param ChunkCursors Scratch: per-chunk, per-source counts, then write cursors ([Chunk * NumSources + Source]).
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSourceParticleIndex
+{
+public:
+	/** Particles per counting-sort chunk */
+	static constexpr int32 ChunkSize = 16384;
+
+	void Build(TConstArrayView<int32> SourceIDs, TConstArrayView<int32> ParticleIDs);
+
+	void Reset();
+
+	/** Particle IDs of one source (empty if the source has none) */
+	TConstArrayView<int32> GetParticleIDs(int32 SourceID) const
+	{
+		return SourceID >= 0 && SourceID < GetNumSources()
+			? TConstArrayView<int32>(SortedParticleIDs.GetData() + SourceOffsets[SourceID], SourceOffsets[SourceID + 1] - SourceOffsets[SourceID])
+			: TConstArrayView<int32>();
+	}
+
+	/** Number of source slots covered, [0, highest SourceID] */
+	int32 GetNumSources() const { return FMath::Max(SourceOffsets.Num() - 1, 0); }
+
+	/** Number of particles that belong to a source */
+	int32 GetNumIndexed() const { return SortedParticleIDs.Num(); }
+
+	/** Allocated bytes of the index and its scratch (stays flat once warm) */
+	SIZE_T GetAllocatedSize() const
+	{
+		return SourceOffsets.GetAllocatedSize() + SortedParticleIDs.GetAllocatedSize()
+			+ ChunkMaxSourceIDs.GetAllocatedSize() + ChunkCursors.GetAllocatedSize();
+	}
+
+private:
+	TArray<int32> SourceOffsets;
+
+	TArray<int32> SortedParticleIDs;
+
+	TArray<int32> ChunkMaxSourceIDs;
+
+	TArray<int32> ChunkCursors;
+};
@@ -0,0 +1,179 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Simulation/Utils/KawaiiFluidMortonSort.h"
+
+/**
+ * @class FKawaiiFluidSparseBrickGrid
+ * @brief Sparse spatial grid: cells grouped into 4³ or 8³ bricks, bricks found through an exact hash table.
+ *
+ * Only occupied bricks exist. Their full brick coordinates are stored in an open-addressing table, so two
+ * bricks never share a slot the way hybrid tiles share their 3-bit hash. Build time and memory are
+ * O(particles + occupied bricks).
+ *
+ * The grid is sparse, not unbounded: brick coordinates are packed into BrickCoordBits per axis, so every
+ * element must lie within ±2^20 bricks of the origin (±2^20 * 8 * CellSize with 8³ bricks, about ±1,680 km
+ * at a 20 cm cell). Elements outside that range are rejected rather than merged into an edge brick: they are
+ * logged, counted in GetNumRejected and sorted behind every cell, belong to no cell, and therefore neither
+ * find neighbors nor are found as neighbors.
+ *
+ * Only the CPU reference solver (FKawaiiFluidGPUReferenceConfig::bUseSparseBrickGrid) and
+ * FKawaiiFluidNeighborCSR use this grid. The runtime GPU neighbor search of bUseUnlimitedSize volumes is not
+ * replaced and still uses hybrid tiling.
+ *
+ * Bricks are ranked by the 63-bit Morton code of their coordinate. A particle's sort key is
+ * (BrickRank << LocalBits) | LocalMorton, where LocalMorton is the Morton code of the cell inside its brick.
+ * The key is therefore also the cell's index in CellStart/CellEnd, and the sorted order is Z-order both
+ * inside and across bricks.
+ *
+ * @param CellSize Cell size (cm).
+ * @param BrickBits Cells per brick axis as a power of two (2 = 4³, 3 = 8³).
+ * @param CellCoords Cell coordinate per input element (build scratch).
+ * @param Keys Sort key per input element.
+ * @param HashKeys Packed brick coordinate per table slot (EmptySlot = free).
+ * @param HashValues Brick rank per table slot.
+ * @param BrickCoords Brick coordinate per brick rank.
+ * @param BrickOrder Build scratch: (Morton code, insertion index) per brick, sorted into rank order.
+ * @param BrickRemap Build scratch: brick rank per insertion index.
+ * @param CellStart First sorted element per cell slot (InvalidIndex = empty).
+ * @param CellEnd Last sorted element per cell slot (InvalidIndex = empty).
+ * @param NumRejected Elements of the last build outside the packable brick range.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSparseBrickGrid
+{
+public:
+	static constexpr uint32 InvalidIndex = 0xFFFFFFFFu;
+
+	static constexpr uint64 EmptySlot = ~0ull;
+
+	/** Brick coordinates are packed with this many bits per axis (±2^20 bricks) */
+	static constexpr int32 BrickCoordBits = 21;
+
+	void SetLayout(float InCellSize, int32 InBrickBits);
+
+	/**
+	 * @brief Key every element by position, radix sort the keys and build the cell ranges.
+	 * @param Num Number of elements.
+	 * @param GetPosition Callable (int32 Index) -> FVector3f, invoked in parallel.
+	 * @param Sorter Sorter that receives the keys; reorder element arrays with it afterwards.
+	 */
+	template <typename PositionGetterType>
+	void Build(int32 Num, PositionGetterType&& GetPosition, FKawaiiFluidMortonSorter& Sorter)
+	{
+		CellCoords.SetNumUninitialized(Num, EAllowShrinking::No);
+		ParallelFor(FMath::DivideAndRoundUp(Num, FKawaiiFluidMortonSorter::ChunkSize), [&](int32 ChunkIndex)
+		{
+			const int32 End = FMath::Min((ChunkIndex + 1) * FKawaiiFluidMortonSorter::ChunkSize, Num);
+			for (int32 i = ChunkIndex * FKawaiiFluidMortonSorter::ChunkSize; i < End; ++i)
+			{
+				CellCoords[i] = KawaiiFluidMorton::WorldToCell(GetPosition(i), CellSize);
+			}
+		}, Num > FKawaiiFluidMortonSorter::ChunkSize ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+		BuildKeys();
+		Sorter.Sort(Keys, GetKeyBits());
+		BuildCellRanges(Sorter.GetSortedKeys());
+	}
+
+	/** Drop all bricks */
+	void Reset();
+
+	//========================================
+	// Queries (valid after Build)
+	//========================================
+
+	/** Brick rank of a brick coordinate, INDEX_NONE if unoccupied */
+	int32 FindBrick(const FIntVector& BrickCoord) const;
+
+	/** Cell slot (sort key) of a cell coordinate, InvalidIndex if its brick is unoccupied */
+	uint32 GetCellSlot(const FIntVector& CellCoord) const;
+
+	/**
+	 * @brief Sorted element range of a cell.
+	 * @param CellCoord Cell coordinate.
+	 * @param OutStart First sorted element.
+	 * @param OutEnd Last sorted element (inclusive).
+	 * @return False if the cell is empty.
+	 */
+	bool FindCell(const FIntVector& CellCoord, uint32& OutStart, uint32& OutEnd) const
+	{
+		const uint32 Slot = GetCellSlot(CellCoord);
+		if (Slot == InvalidIndex || CellStart[Slot] == InvalidIndex)
+		{
+			return false;
+		}
+
+		OutStart = CellStart[Slot];
+		OutEnd = CellEnd[Slot];
+		return true;
+	}
+
+	FIntVector GetBrickCoord(const FIntVector& CellCoord) const
+	{
+		return FIntVector(CellCoord.X >> BrickBits, CellCoord.Y >> BrickBits, CellCoord.Z >> BrickBits);
+	}
+
+	float GetCellSize() const { return CellSize; }
+
+	int32 GetBrickBits() const { return BrickBits; }
+
+	/** Cell slots per brick (64 or 512) */
+	int32 GetCellsPerBrick() const { return 1 << (BrickBits * 3); }
+
+	int32 GetNumBricks() const { return BrickCoords.Num(); }
+
+	/** Elements of the last build outside the packable brick range (sorted last, in no cell) */
+	int32 GetNumRejected() const { return NumRejected; }
+
+	/** Significant bits of the sort keys of the last build */
+	int32 GetKeyBits() const;
+
+	TConstArrayView<FIntVector> GetBrickCoords() const { return BrickCoords; }
+
+	/** Hash table slots (power of two, at most half full) */
+	int32 GetHashCapacity() const { return HashKeys.Num(); }
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return CellCoords.GetAllocatedSize() + Keys.GetAllocatedSize() + HashKeys.GetAllocatedSize() + HashValues.GetAllocatedSize()
+			+ BrickCoords.GetAllocatedSize() + BrickOrder.GetAllocatedSize() + BrickRemap.GetAllocatedSize() + CellStart.GetAllocatedSize() + CellEnd.GetAllocatedSize();
+	}
+
+private:
+	void BuildKeys();
+
+	void BuildCellRanges(TConstArrayView<uint32> SortedKeys);
+
+	int32 InsertBrick(uint64 PackedCoord);
+
+	void GrowHashTable(int32 NewCapacity);
+
+	uint32 GetLocalMorton(const FIntVector& CellCoord) const;
+
+	float CellSize = 20.0f;
+
+	int32 BrickBits = 3;
+
+	TArray<FIntVector> CellCoords;
+
+	TArray<uint32> Keys;
+
+	TArray<uint64> HashKeys;
+
+	TArray<int32> HashValues;
+
+	TArray<FIntVector> BrickCoords;
+
+	TArray<TPair<uint64, int32>> BrickOrder;
+
+	TArray<int32> BrickRemap;
+
+	TArray<uint32> CellStart;
+
+	TArray<uint32> CellEnd;
+
+	int32 NumRejected = 0;
+};
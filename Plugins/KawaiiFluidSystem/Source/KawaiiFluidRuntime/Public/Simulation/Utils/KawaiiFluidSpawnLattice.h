@@ -0,0 +1,110 @@
+// Copyright 2026 Team_Bruteforce. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGPUSpawnRequest;
+
+/**
+ * @brief Shape of a cached spawn lattice.
+ */
+enum class EKawaiiFluidLatticeShape : uint8
+{
+	Sphere,
+	Box,
+	Cylinder,
+	StreamDisc
+};
+
+/**
+ * @struct FKawaiiFluidLatticeTemplate
+ * @brief Precomputed local-space lattice for one shape, spacing and size.
+ *
+ * @param Shape Shape the lattice fills.
+ * @param LocalPositions Unjittered lattice points in shape-local space (generation order).
+ * @param JitterScales Per-point jitter range per unit JitterAmount (surface falloff baked in).
+ * @param ClipRadiusSq StreamDisc only: in-plane clip radius applied after jitter (0 = no clip).
+ * @param bPlanarJitter Jitter only in the local XY plane (StreamDisc).
+ */
+struct KAWAIIFLUIDRUNTIME_API FKawaiiFluidLatticeTemplate
+{
+	EKawaiiFluidLatticeShape Shape = EKawaiiFluidLatticeShape::Sphere;
+
+	TArray<FVector3f> LocalPositions;
+
+	TArray<float> JitterScales;
+
+	float ClipRadiusSq = 0.0f;
+
+	bool bPlanarJitter = false;
+
+	int32 Num() const { return LocalPositions.Num(); }
+};
+
+/**
+ * @class FKawaiiFluidSpawnLattice
+ * @brief Hexagonal close-packed spawn lattices shared by emitters and the editor preview.
+ *
+ * Shape lattices are HCP (ABC-stacked) with distance-based jitter falloff so surface particles do
+ * not protrude. Stream layers are single 2D hexagonal discs perpendicular to the emission direction.
+ *
+ * Lattices are built once per (shape, spacing, dimensions) in local space and cached. Spawning is a
+ * single transform-and-jitter pass over the cached points that writes world positions, or complete
+ * FGPUSpawnRequests, straight into the caller's (pooled) output array.
+ */
+class KAWAIIFLUIDRUNTIME_API FKawaiiFluidSpawnLattice
+{
+public:
+	/** HCP is ~1.42x denser than cubic for the same spacing; (1/0.707)^(1/3) restores the number density */
+	static constexpr float HCPCompensation = 1.122f;
+
+	/** Upper bound on cached templates; the cache is flushed when exceeded */
+	static constexpr int32 MaxCachedTemplates = 64;
+
+	//========================================
+	// Template Cache
+	//========================================
+
+	static TSharedRef<const FKawaiiFluidLatticeTemplate> GetTemplate(EKawaiiFluidLatticeShape Shape, float Spacing, const FVector& Dimensions);
+
+	static int32 GetNumCachedTemplates();
+
+	static void ClearCache();
+
+	//========================================
+	// Transform Passes
+	//========================================
+
+	static int32 TransformToSpawnRequests(const FKawaiiFluidLatticeTemplate& Template, const FVector& Origin, const FQuat& Rotation,
+		float JitterAmount, int32 MaxCount, const FVector& Velocity, int32 SourceID, TArray<FGPUSpawnRequest>& OutRequests);
+
+	static int32 TransformStreamLayerToSpawnRequests(const FKawaiiFluidLatticeTemplate& Template, const FVector& Position,
+		const FVector& LayerDirection, float Jitter, const FVector& Velocity, int32 SourceID, TArray<FGPUSpawnRequest>& OutRequests);
+
+	//========================================
+	// Position Generation (cached lattice + transform)
+	//========================================
+
+	static int32 GenerateSphere(const FVector& Center, const FQuat& Rotation, float Radius, float Spacing,
+		float JitterAmount, int32 MaxCount, TArray<FVector>& OutPositions);
+
+	static int32 GenerateBox(const FVector& Center, const FQuat& Rotation, const FVector& HalfSize, float Spacing,
+		float JitterAmount, int32 MaxCount, TArray<FVector>& OutPositions);
+
+	static int32 GenerateCylinder(const FVector& Center, const FQuat& Rotation, float Radius, float HalfHeight, float Spacing,
+		float JitterAmount, int32 MaxCount, TArray<FVector>& OutPositions);
+
+	static int32 GenerateStreamLayer(const FVector& Position, const FVector& LayerDirection, float Radius, float Spacing,
+		float Jitter, TArray<FVector>& OutPositions);
+
+	//========================================
+	// Dimension Helpers (template keys)
+	//========================================
+
+	static FVector SphereDimensions(float Radius) { return FVector(Radius, 0.0, 0.0); }
+
+	static FVector CylinderDimensions(float Radius, float HalfHeight) { return FVector(Radius, 0.0, HalfHeight); }
+
+	static FVector StreamDiscDimensions(float Radius) { return FVector(Radius, 0.0, 0.0); }
+};